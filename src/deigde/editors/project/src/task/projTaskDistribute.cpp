@@ -40,11 +40,13 @@
 #include <dragengine/common/exceptions.h>
 #include <dragengine/common/file/decBaseFileReader.h>
 #include <dragengine/common/file/decBaseFileWriter.h>
+#include <dragengine/common/file/decDeflateChunk.h>
 #include <dragengine/common/file/decMemoryFile.h>
 #include <dragengine/common/file/decMemoryFileWriter.h>
 #include <dragengine/common/utils/decDateTime.h>
 #include <dragengine/common/xmlparser/decXmlWriter.h>
 #include <dragengine/deEngine.h>
+#include <dragengine/parallel/deParallelProcessing.h>
 #include <dragengine/systems/deModuleSystem.h>
 #include <dragengine/systems/modules/deLoadableModule.h>
 #include <dragengine/filesystem/deVFSDiskDirectory.h>
@@ -57,9 +59,14 @@
 
 
 
-// Callbacks
-//////////////
+// Definitions
+////////////////
 
+// Size in bytes of chunks large files are split into for compressing in parallel
+#define CHUNK_SIZE 4194304
+
+// Maximum size in bytes of uncompressed data of pending parallel tasks
+#define MAX_PENDING_BYTES 268435456
 
 
 
@@ -136,12 +143,19 @@ pZipFile(nullptr),
 pDelgaSize(0),
 pDelgaPosition(0),
 pDelgaDirectoryCount(0),
-pDelgaFileCount(0)
+pDelgaFileCount(0),
+
+pPendingBytes(0),
+pMaxPendingFiles(4),
+pFileCrc(0),
+pFileSize(0)
 {
-	pReadBuffer.AddRange(1024 * 8, 0); // 8k
+	// keep enough tasks pending for all threads to stay busy
+	pMaxPendingFiles = decMath::max(pMaxPendingFiles, pGetParallelProcessing().GetThreadCount() * 4);
 }
 
 projTaskDistribute::~projTaskDistribute(){
+	pCancelPendingFiles();
 	pCloseDelgaWriter();
 }
 
@@ -164,8 +178,20 @@ bool projTaskDistribute::Step(){
 			return true;
 			
 		case esProcessFiles:
-			pProcessFiles();
+			pWriteFinishedFiles();
+			
 			if(pStackDirectories.IsNotEmpty()){
+				if(pCanAddFileTask()){
+					pProcessFiles();
+					
+				}else{
+					pWaitForNextFile();
+				}
+				return true;
+			}
+			
+			if(pPendingFiles.IsNotEmpty()){
+				pWaitForNextFile();
 				return true;
 			}
 			
@@ -185,6 +211,7 @@ bool projTaskDistribute::Step(){
 		}
 		
 	}catch(const deException &){
+		pCancelPendingFiles();
 		pState = esFinished;
 		throw;
 	}
@@ -355,9 +382,10 @@ void projTaskDistribute::pScanDirectory(const decPath &path){
 }
 
 void projTaskDistribute::pProcessFiles(){
-	int processLimit = 1; // process at most 1 elements per update 1 directory per update
+	// process at most 16 files per update while tasks can be added. directories do not count
+	int processLimit = 16;
 	
-	while(processLimit > 0){
+	while(processLimit > 0 && pCanAddFileTask()){
 		cProcessDirectory * const directory = GetProcessDirectory();
 		if(!directory){
 			break;
@@ -439,9 +467,7 @@ void projTaskDistribute::pProcessFile(const decPath &path){
 		}
 	}
 	
-	pZipBeginFile(path, compress);
-	pCopyFile(path);
-	pZipCloseFile();
+	pAddFileTasks(path, compress);
 }
 
 decString projTaskDistribute::pGetFileExtension(const decPath &path) const{
@@ -522,23 +548,108 @@ const char *projTaskDistribute::pGetModuleTypeName(deModuleSystem::eModuleTypes
 	};
 }
 
-void projTaskDistribute::pCopyFile(const decPath &path){
-	const decBaseFileReader::Ref reader(pVFS->OpenFileForReading(path));
+deParallelProcessing &projTaskDistribute::pGetParallelProcessing() const{
+	return pWindowMain.GetEnvironment().GetEngineController()->GetEngine()->GetParallelProcessing();
+}
+
+bool projTaskDistribute::pCanAddFileTask() const{
+	return pPendingFiles.GetCount() < pMaxPendingFiles && pPendingBytes < MAX_PENDING_BYTES;
+}
+
+void projTaskDistribute::pAddFileTasks(const decPath &path, bool compress){
+	const int level = compress ? Z_DEFAULT_COMPRESSION : Z_NO_COMPRESSION;
+	const int size = (int)pVFS->GetFileSize(path);
+	deParallelProcessing &parallel = pGetParallelProcessing();
 	
-	const long size = reader->GetLength();
-	if(size == 0){
+	// small files are compressed by one task. large files are split into chunks
+	int offset = 0;
+	do{
+		const int length = decMath::min(size - offset, CHUNK_SIZE);
+		const bool lastChunk = offset + length == size;
+		
+		const projTaskDistributeFile::Ref task(projTaskDistributeFile::Ref::New(
+			pVFS, path, level, offset, length, lastChunk));
+		pPendingFiles.Add(task);
+		pPendingBytes += length;
+		parallel.AddTask(task);
+		
+		offset += length;
+	}while(offset < size);
+}
+
+void projTaskDistribute::pWriteFinishedFiles(){
+	// write tasks in the order they have been added to keep the delga file deterministic
+	while(pPendingFiles.IsNotEmpty()){
+		projTaskDistributeFile &task = *pPendingFiles.First();
+		if(!task.GetReady()){
+			break;
+		}
+		
+		pWriteFileTask(task);
+		pPendingBytes -= task.GetLength();
+		pPendingFiles.RemoveFrom(0);
+	}
+}
+
+void projTaskDistribute::pWaitForNextFile(){
+	if(pPendingFiles.IsEmpty()){
 		return;
 	}
 	
-	int position;
-	for(position=0; position<size; position+=pReadBuffer.GetCount()){
-		const int copySize = decMath::min(size - position, pReadBuffer.GetCount());
-		reader->Read(pReadBuffer.GetArrayPointer(), copySize);
-		pZipWriteFile(pReadBuffer.GetArrayPointer(), copySize);
+	deParallelProcessing &parallel = pGetParallelProcessing();
+	if(!parallel.GetPaused()){
+		parallel.WaitForTask(pPendingFiles.First());
 	}
+	
+	pWriteFinishedFiles();
 }
 
-void projTaskDistribute::pZipBeginFile(const decPath &path, bool compress){
+void projTaskDistribute::pCancelPendingFiles(){
+	if(pPendingFiles.IsEmpty()){
+		return;
+	}
+	
+	deParallelProcessing &parallel = pGetParallelProcessing();
+	pPendingFiles.Visit([&](projTaskDistributeFile &task){
+		task.Cancel(parallel);
+	});
+	pPendingFiles.RemoveAll();
+	pPendingBytes = 0;
+}
+
+void projTaskDistribute::pWriteFileTask(projTaskDistributeFile &task){
+	if(task.GetFailed()){
+		decString message;
+		message.Format("Failed processing VFS path %s", task.GetPath().GetPathUnix().GetString());
+		SetMessage(message);
+		DETHROW_INFO(deeReadFile, task.GetError());
+	}
+	
+	if(task.GetFirstChunk()){
+		pZipBeginFile(task.GetPath(), task.GetLevel());
+		pFileCrc = decDeflateChunk::InitialCrc();
+		pFileSize = 0;
+	}
+	
+	const decTList<uint8_t> &compressed = task.GetCompressed();
+	if(compressed.IsNotEmpty()){
+		if(zipWriteInFileInZip(pZipFile, compressed.GetArrayPointer(), compressed.GetCount()) != ZIP_OK){
+			DETHROW(deeInvalidParam);
+		}
+	}
+	task.DropCompressed();
+	
+	pFileCrc = decDeflateChunk::CombineCrc(pFileCrc, task.GetCrc(), task.GetLength());
+	pFileSize += task.GetLength();
+	
+	if(task.GetLastChunk()){
+		if(zipCloseFileInZipRaw(pZipFile, (uLong)pFileSize, (uLong)pFileCrc) != ZIP_OK){
+			DETHROW(deeInvalidParam);
+		}
+	}
+}
+
+void projTaskDistribute::pZipBeginFile(const decPath &path, int level){
 	const decDateTime modtime(pVFS->GetFileModificationTime(path));
 	
 	zip_fileinfo info;
@@ -554,32 +665,15 @@ void projTaskDistribute::pZipBeginFile(const decPath &path, bool compress){
 	info.internal_fa = 0; // no idea what this is
 	info.external_fa = 0; // no idea what this is
 	
-	// NOTE: path contains '/' as prefix. delga files require path without prefix
-	int method = Z_DEFLATED;
-	int level = compress ? Z_DEFAULT_COMPRESSION : Z_NO_COMPRESSION;
+	// NOTE: path contains '/' as prefix. delga files require path without prefix.
+	//       data is already compressed by the file tasks hence it is written raw.
+	//       the level is still required since it is stored in the file header flags.
+	//       files without compression are stored (method 0) so the archive module
+	//       can read them directly from the memory mapped archive
+	const int method = level == Z_NO_COMPRESSION ? 0 : Z_DEFLATED;
 	
-	if(zipOpenNewFileInZip(pZipFile, path.GetPathUnix().GetMiddle(1), &info,
-	nullptr, 0, nullptr, 0, nullptr, method, level) != ZIP_OK){
-		DETHROW(deeInvalidParam);
-	}
-}
-
-void projTaskDistribute::pZipWriteFile(const void *buffer, long size){
-	if(!buffer || size < 0){
-		DETHROW(deeInvalidParam);
-	}
-	
-	if(size == 0){
-		return;
-	}
-	
-	if(zipWriteInFileInZip(pZipFile, buffer, size) != ZIP_OK){
-		DETHROW(deeInvalidParam);
-	}
-}
-
-void projTaskDistribute::pZipCloseFile(){
-	if(zipCloseFileInZip(pZipFile) != ZIP_OK){
+	if(zipOpenNewFileInZip2(pZipFile, path.GetPathUnix().GetMiddle(1), &info,
+	nullptr, 0, nullptr, 0, nullptr, method, level, 1) != ZIP_OK){
 		DETHROW(deeInvalidParam);
 	}
 }
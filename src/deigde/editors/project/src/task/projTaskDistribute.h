@@ -26,6 +26,7 @@
 #define _PROJTASKDISTRIBUTE_H_
 
 #include "zip.h"
+#include "projTaskDistributeFile.h"
 
 #include <deigde/gui/igdeStepableTask.h>
 
@@ -45,11 +46,17 @@ class projProfile;
 
 class decMemoryFile;
 class decXmlWriter;
+class deParallelProcessing;
 
 
 
 /**
  * \brief Distribute game task.
+ * 
+ * Files are read and compressed by parallel tasks. Large files are split into chunks
+ * compressed by individual parallel tasks. Compressed data is written to the delga file
+ * in the order the files are found keeping the output deterministic. Only the main
+ * thread writes to the delga file.
  */
 class projTaskDistribute : public igdeStepableTask{
 public:
@@ -97,7 +104,11 @@ private:
 	int pDelgaDirectoryCount;
 	int pDelgaFileCount;
 	
-	decTList<char> pReadBuffer;
+	decTThreadSafeObjectOrderedSet<projTaskDistributeFile> pPendingFiles;
+	int pPendingBytes;
+	int pMaxPendingFiles;
+	uint32_t pFileCrc;
+	long pFileSize;
 	
 	
 	
@@ -177,10 +188,14 @@ private:
 	decString pGetFileExtension(const decPath &path) const;
 	deLoadableModule *pGetMatchingModule(const decString &extension) const;
 	const char *pGetModuleTypeName(deModuleSystem::eModuleTypes type) const;
-	void pCopyFile(const decPath &path);
-	void pZipBeginFile(const decPath &path, bool compress);
-	void pZipWriteFile(const void *buffer, long size);
-	void pZipCloseFile();
+	deParallelProcessing &pGetParallelProcessing() const;
+	bool pCanAddFileTask() const;
+	void pAddFileTasks(const decPath &path, bool compress);
+	void pWriteFinishedFiles();
+	void pWaitForNextFile();
+	void pCancelPendingFiles();
+	void pWriteFileTask(projTaskDistributeFile &task);
+	void pZipBeginFile(const decPath &path, int level);
 	void pZipWriteMemoryFile(const decMemoryFile &memoryFile);
 	void pCloseDirectory();
 	void pWriteGameXml();
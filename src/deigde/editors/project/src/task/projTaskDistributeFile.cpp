@@ -0,0 +1,102 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "projTaskDistributeFile.h"
+
+#include <dragengine/common/exceptions.h>
+#include <dragengine/common/file/decBaseFileReader.h>
+#include <dragengine/common/file/decDeflateChunk.h>
+
+
+
+// Class projTaskDistributeFile
+/////////////////////////////////
+
+// Constructor, destructor
+////////////////////////////
+
+projTaskDistributeFile::projTaskDistributeFile(deVirtualFileSystem *vfs, const decPath &path,
+int level, int offset, int length, bool lastChunk) :
+deParallelTask(nullptr),
+pVFS(vfs),
+pPath(path),
+pLevel(level),
+pOffset(offset),
+pLength(length),
+pLastChunk(lastChunk),
+pCrc(0),
+pFailed(false),
+pReady(false)
+{
+	DEASSERT_NOTNULL(vfs)
+	DEASSERT_TRUE(offset >= 0)
+	DEASSERT_TRUE(length >= 0)
+	
+	SetMarkFinishedAfterRun(true);
+}
+
+projTaskDistributeFile::~projTaskDistributeFile(){
+}
+
+
+
+// Management
+///////////////
+
+void projTaskDistributeFile::DropCompressed(){
+	pCompressed.RemoveAll();
+}
+
+
+
+void projTaskDistributeFile::Run(){
+	if(IsCancelled()){
+		return;
+	}
+	
+	try{
+		const decBaseFileReader::Ref reader(pVFS->OpenFileForReading(pPath));
+		
+		if(pLevel == decDeflateChunk::LevelStore){
+			pCrc = decDeflateChunk::Store(reader, pOffset, pLength, pCompressed);
+			
+		}else{
+			pCrc = decDeflateChunk::Deflate(reader, pLevel, pOffset, pLength, pLastChunk, pCompressed);
+		}
+		
+	}catch(const deException &e){
+		pError.Format("%s: %s", e.GetName().GetString(), e.GetDescription().GetString());
+		pFailed = true;
+		pCompressed.RemoveAll();
+	}
+	
+	pReady = true;
+}
+
+void projTaskDistributeFile::Finished(){
+}
+
+decString projTaskDistributeFile::GetDebugName() const{
+	return "ProjDistributeFile";
+}
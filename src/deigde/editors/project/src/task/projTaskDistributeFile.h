@@ -0,0 +1,148 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _PROJTASKDISTRIBUTEFILE_H_
+#define _PROJTASKDISTRIBUTEFILE_H_
+
+#include <stdint.h>
+#include <atomic>
+
+#include <dragengine/common/collection/decTList.h>
+#include <dragengine/common/file/decPath.h>
+#include <dragengine/common/string/decString.h>
+#include <dragengine/filesystem/deVirtualFileSystem.h>
+#include <dragengine/parallel/deParallelTask.h>
+
+
+/**
+ * \brief Parallel task reading and compressing a part of a file to distribute.
+ * 
+ * Reads a range of a file and deflates it into memory as raw deflate data using
+ * decDeflateChunk. Small files are compressed by a single task producing the same data
+ * as zip writers do. Large files are split into chunks compressed by individual tasks.
+ * 
+ * Files using no compression level are stored. The chunk data is then a copy of the
+ * file content which is written to the zip entry as is.
+ */
+class projTaskDistributeFile : public deParallelTask{
+public:
+	/** \brief Type holding strong reference. */
+	using Ref = deTThreadSafeObjectReference<projTaskDistributeFile>;
+	
+	
+private:
+	const deVirtualFileSystem::Ref pVFS;
+	const decPath pPath;
+	const int pLevel;
+	const int pOffset;
+	const int pLength;
+	const bool pLastChunk;
+	
+	decTList<uint8_t> pCompressed;
+	uint32_t pCrc;
+	bool pFailed;
+	decString pError;
+	std::atomic<bool> pReady;
+	
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/**
+	 * \brief Create task.
+	 * \param[in] vfs Virtual file system to read file from.
+	 * \param[in] path Path of file.
+	 * \param[in] level Zlib compression level.
+	 * \param[in] offset Offset in bytes of chunk to compress.
+	 * \param[in] length Length in bytes of chunk to compress.
+	 * \param[in] lastChunk Chunk is the last one of the file.
+	 */
+	projTaskDistributeFile(deVirtualFileSystem *vfs, const decPath &path,
+		int level, int offset, int length, bool lastChunk);
+	
+protected:
+	/** \brief Clean up task. */
+	~projTaskDistributeFile() override;
+	/*@}*/
+	
+	
+	
+public:
+	/** \name Management */
+	/*@{*/
+	/** \brief Path of file. */
+	inline const decPath &GetPath() const{ return pPath; }
+	
+	/** \brief Zlib compression level. */
+	inline int GetLevel() const{ return pLevel; }
+	
+	/** \brief Offset in bytes of chunk. */
+	inline int GetOffset() const{ return pOffset; }
+	
+	/** \brief Length in bytes of chunk. */
+	inline int GetLength() const{ return pLength; }
+	
+	/** \brief Chunk is the first one of the file. */
+	inline bool GetFirstChunk() const{ return pOffset == 0; }
+	
+	/** \brief Chunk is the last one of the file. */
+	inline bool GetLastChunk() const{ return pLastChunk; }
+	
+	/**
+	 * \brief Task finished running.
+	 * 
+	 * Result of the task can be accessed once this returns true.
+	 */
+	inline bool GetReady() const{ return pReady; }
+	
+	/** \brief Compressed data or file content if stored. */
+	inline const decTList<uint8_t> &GetCompressed() const{ return pCompressed; }
+	
+	/** \brief CRC32 of uncompressed chunk data. */
+	inline uint32_t GetCrc() const{ return pCrc; }
+	
+	/** \brief Compressing failed. */
+	inline bool GetFailed() const{ return pFailed; }
+	
+	/** \brief Error message if compressing failed. */
+	inline const decString &GetError() const{ return pError; }
+	
+	/** \brief Drop compressed data to free memory. */
+	void DropCompressed();
+	
+	
+	
+	/** \brief Run task. */
+	void Run() override;
+	
+	/** \brief Task finished. */
+	void Finished() override;
+	
+	/** \brief Debug name. */
+	decString GetDebugName() const override;
+	/*@}*/
+};
+
+#endif
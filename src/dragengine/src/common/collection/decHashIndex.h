@@ -0,0 +1,325 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DECHASHINDEX_H_
+#define _DECHASHINDEX_H_
+
+#include <algorithm>
+#include <utility>
+
+#include "../exceptions_reduced.h"
+
+
+/**
+ * \brief Open addressing hash index.
+ * 
+ * Maps hash values to entry indices of a flat array owned by the user of the index.
+ * Used by hashed collections to find entries without comparing all of them. The index
+ * stores only the hash and the entry index in a power of two sized slot array using
+ * linear probing. Removing uses backward shift deletion so no tombstones are required.
+ * 
+ * The slot array grows automatically keeping the load factor at or below 75%. The hash
+ * values are scrambled using fibonacci hashing. This keeps hash values with few
+ * significant low bits like pointers evenly distributed.
+ * 
+ * Key comparison is done by the caller using an evaluator receiving the entry index.
+ */
+class decHashIndex{
+private:
+	struct sSlot{
+		unsigned int hash;
+		int index;
+	};
+	
+	sSlot *pSlots;
+	int pSlotCount;
+	int pShift;
+	int pCount;
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/** \brief Create empty hash index. */
+	decHashIndex() : pSlots(nullptr), pSlotCount(0), pShift(32), pCount(0){
+	}
+	
+	/** \brief Create copy of hash index. */
+	decHashIndex(const decHashIndex &index) : pSlots(nullptr), pSlotCount(0), pShift(32), pCount(0){
+		*this = index;
+	}
+	
+	/** \brief Move hash index. */
+	decHashIndex(decHashIndex &&index) noexcept : pSlots(index.pSlots),
+	pSlotCount(index.pSlotCount), pShift(index.pShift), pCount(index.pCount){
+		index.pSlots = nullptr;
+		index.pSlotCount = 0;
+		index.pShift = 32;
+		index.pCount = 0;
+	}
+	
+	/** \brief Clean up hash index. */
+	~decHashIndex(){
+		if(pSlots){
+			delete [] pSlots;
+		}
+	}
+	/*@}*/
+	
+	
+	/** \name Management */
+	/*@{*/
+	/** \brief Number of indexed entries. */
+	inline int GetCount() const{ return pCount; }
+	
+	/** \brief Number of slots. */
+	inline int GetSlotCount() const{ return pSlotCount; }
+	
+	/**
+	 * \brief Find entry index.
+	 * \param[in] hash Hash of the key to find.
+	 * \param[in] evaluator Evaluator callable invoked as evaluator(int) with the entry index
+	 *                      of entries with matching hash. Returns true if entry key matches.
+	 * \returns Entry index or -1 if not found.
+	 */
+	template<typename Evaluator>
+	int Find(unsigned int hash, Evaluator &&evaluator) const{
+		if(pCount == 0){
+			return -1;
+		}
+		
+		const int mask = pSlotCount - 1;
+		int slot = pHome(hash);
+		
+		while(pSlots[slot].index != -1){
+			if(pSlots[slot].hash == hash && evaluator(pSlots[slot].index)){
+				return pSlots[slot].index;
+			}
+			slot = (slot + 1) & mask;
+		}
+		
+		return -1;
+	}
+	
+	/**
+	 * \brief Add entry index.
+	 * 
+	 * Caller is responsible to not add the same entry index twice.
+	 */
+	void Add(unsigned int hash, int index){
+		DEASSERT_TRUE(index >= 0)
+		
+		if((pCount + 1) * 4 > pSlotCount * 3){
+			pRehash(std::max(pSlotCount * 2, 8));
+		}
+		
+		pInsert(hash, index);
+		pCount++;
+	}
+	
+	/**
+	 * \brief Remove entry index.
+	 * \throws deeInvalidParam Entry index with hash is absent.
+	 */
+	void Remove(unsigned int hash, int index){
+		const int slot = pFindSlot(hash, index);
+		DEASSERT_TRUE(slot != -1)
+		
+		// backward shift deletion. move entries following the removed slot back if their
+		// home slot allows it. this keeps probe sequences intact without tombstones
+		const int mask = pSlotCount - 1;
+		int hole = slot, next = (slot + 1) & mask;
+		
+		while(pSlots[next].index != -1){
+			const int home = pHome(pSlots[next].hash);
+			if(((next - home) & mask) >= ((next - hole) & mask)){
+				pSlots[hole] = pSlots[next];
+				hole = next;
+			}
+			next = (next + 1) & mask;
+		}
+		
+		pSlots[hole].index = -1;
+		pCount--;
+	}
+	
+	/**
+	 * \brief Change entry index of indexed entry.
+	 * 
+	 * Used if entries are moved inside the flat array for example to fill the gap of a
+	 * removed entry with the last entry.
+	 * 
+	 * \throws deeInvalidParam Entry index with hash is absent.
+	 */
+	void Move(unsigned int hash, int index, int newIndex){
+		const int slot = pFindSlot(hash, index);
+		DEASSERT_TRUE(slot != -1)
+		
+		pSlots[slot].index = newIndex;
+	}
+	
+	/** \brief Remove all entry indices keeping the slot array. */
+	void RemoveAll(){
+		int i;
+		for(i=0; i<pSlotCount; i++){
+			pSlots[i].index = -1;
+		}
+		pCount = 0;
+	}
+	
+	/**
+	 * \brief Make sure the index can store count entries without growing.
+	 * 
+	 * Never shrinks the slot array.
+	 */
+	void Reserve(int count){
+		int slotCount = 8;
+		while(count * 4 > slotCount * 3){
+			slotCount *= 2;
+		}
+		
+		if(slotCount > pSlotCount){
+			pRehash(slotCount);
+		}
+	}
+	/*@}*/
+	
+	
+	/** \name Operators */
+	/*@{*/
+	/** \brief Copy hash index. */
+	decHashIndex &operator=(const decHashIndex &index){
+		if(&index == this){
+			return *this;
+		}
+		
+		if(pSlotCount != index.pSlotCount){
+			if(pSlots){
+				delete [] pSlots;
+				pSlots = nullptr;
+			}
+			if(index.pSlotCount > 0){
+				pSlots = new sSlot[index.pSlotCount];
+			}
+		}
+		
+		if(index.pSlotCount > 0){
+			std::copy_n(index.pSlots, index.pSlotCount, pSlots);
+		}
+		
+		pSlotCount = index.pSlotCount;
+		pShift = index.pShift;
+		pCount = index.pCount;
+		return *this;
+	}
+	
+	/** \brief Move hash index. */
+	decHashIndex &operator=(decHashIndex &&index) noexcept{
+		if(&index == this){
+			return *this;
+		}
+		
+		if(pSlots){
+			delete [] pSlots;
+		}
+		
+		pSlots = index.pSlots;
+		pSlotCount = index.pSlotCount;
+		pShift = index.pShift;
+		pCount = index.pCount;
+		
+		index.pSlots = nullptr;
+		index.pSlotCount = 0;
+		index.pShift = 32;
+		index.pCount = 0;
+		return *this;
+	}
+	/*@}*/
+	
+	
+private:
+	inline int pHome(unsigned int hash) const{
+		// fibonacci hashing. pShift is 32 - log2(pSlotCount)
+		return (int)((hash * 2654435769u) >> pShift);
+	}
+	
+	int pFindSlot(unsigned int hash, int index) const{
+		if(pCount == 0){
+			return -1;
+		}
+		
+		const int mask = pSlotCount - 1;
+		int slot = pHome(hash);
+		
+		while(pSlots[slot].index != -1){
+			if(pSlots[slot].index == index){
+				return slot;
+			}
+			slot = (slot + 1) & mask;
+		}
+		
+		return -1;
+	}
+	
+	void pInsert(unsigned int hash, int index){
+		const int mask = pSlotCount - 1;
+		int slot = pHome(hash);
+		
+		while(pSlots[slot].index != -1){
+			slot = (slot + 1) & mask;
+		}
+		
+		pSlots[slot].hash = hash;
+		pSlots[slot].index = index;
+	}
+	
+	void pRehash(int slotCount){
+		sSlot * const oldSlots = pSlots;
+		const int oldSlotCount = pSlotCount;
+		
+		pSlots = new sSlot[slotCount];
+		pSlotCount = slotCount;
+		pShift = 32;
+		while(slotCount > 1){
+			slotCount >>= 1;
+			pShift--;
+		}
+		
+		int i;
+		for(i=0; i<pSlotCount; i++){
+			pSlots[i].index = -1;
+		}
+		
+		if(oldSlots){
+			for(i=0; i<oldSlotCount; i++){
+				if(oldSlots[i].index != -1){
+					pInsert(oldSlots[i].hash, oldSlots[i].index);
+				}
+			}
+			delete [] oldSlots;
+		}
+	}
+};
+
+#endif
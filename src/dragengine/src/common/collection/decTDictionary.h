@@ -22,12 +22,17 @@
  * SOFTWARE.
  */
 
+
 #ifndef _DECTDICTIONARY_H_
 #define _DECTDICTIONARY_H_
 
 #include <algorithm>
+#include <concepts>
+#include <type_traits>
+#include <utility>
 
 #include "decTList.h"
+#include "decHashIndex.h"
 #include "decGlobalFunctions.h"
 #include "../exceptions_reduced.h"
 #include "../string/decString.h"
@@ -40,6 +45,21 @@
  * For type K it is required to exist a global function "unsigned int DEHash(const K&)".
  * Such functions are provided in decGlobalFunctions.h (int, unsigned int, void*) as well as
  * certain classes like decString.
+ * 
+ * Entries are stored in a flat array in insertion order. Removing an entry moves the last
+ * entry into its place. Entries are found using an open addressing decHashIndex which
+ * grows automatically.
+ * 
+ * Keys can be looked up using types other than K and KP if a DEHash function exists for
+ * the type and the type can be compared with K. The hash of the type has to match the
+ * hash of an equal K. This is for example the case for const char* against decString.
+ * 
+ * \warning Pointers and references to keys and values are invalidated if entries are
+ *          added or removed. Adding an entry can grow the entry array moving all entries
+ *          to new storage. Removing an entry moves the last entry into the removed slot.
+ *          Setting the value of a present key keeps pointers valid. Do not hold pointers
+ *          or references obtained from GetAt() or operator[] across SetAt(), Remove(),
+ *          RemoveIfPresent() or RemoveAll() calls on the same dictionary.
  */
 template<typename K, typename V, typename VP = V, typename KP = K>
 class decTDictionary{
@@ -48,36 +68,26 @@ private:
 		unsigned int hash;
 		K key;
 		V value;
-		sDictEntry *next;
-		
-		sDictEntry() : hash(0), next(nullptr){
-		}
-		
-		sDictEntry(const sDictEntry &entry) :
-		hash(entry.hash),
-		key(entry.key),
-		value(entry.value),
-		next(nullptr){
-		}
-		
-		sDictEntry(unsigned int nhash, const K &nkey, const VP &nvalue) :
-		hash(nhash),
-		key(nkey),
-		value(nvalue),
-		next(nullptr){
-		}
 		
-		~sDictEntry(){
-		}
-		
-		void SetValue(const VP &nvalue){
-			value = nvalue;
+		sDictEntry() : hash(0), key(), value(){
 		}
 	};
 	
-	sDictEntry **pBuckets;
-	int pBucketCount;
+	sDictEntry *pEntries;
 	int pEntryCount;
+	int pEntrySize;
+	decHashIndex pIndex;
+	
+	/** \brief Type U can be used for heterogeneous lookup. */
+	template<typename U>
+	static constexpr bool cLookupKey =
+		!std::is_same_v<std::decay_t<U>, K>
+		&& !std::is_same_v<std::decay_t<U>, KP>
+		&& !std::is_arithmetic_v<std::remove_cvref_t<U>>
+		&& requires(const K &k, const U &u){
+			{DEHash(u)} -> std::convertible_to<unsigned int>;
+			{k == u} -> std::convertible_to<bool>;
+		};
 	
 	
 public:
@@ -88,42 +98,45 @@ public:
 	/** \name Constructors and Destructors */
 	/*@{*/
 	/** \brief Create a new dictionary. */
-	decTDictionary() : pBuckets(nullptr), pBucketCount(8), pEntryCount(0){
-		pBuckets = new sDictEntry*[pBucketCount];
-		std::fill_n(pBuckets, pBucketCount, nullptr);
+	decTDictionary() : pEntries(nullptr), pEntryCount(0), pEntrySize(0){
 	}
 	
 	/**
-	 * \brief Create a new dictionary with initial bucket count.
+	 * \brief Create a new dictionary with initial capacity.
+	 * 
+	 * The dictionary grows automatically. The capacity only avoids growing while
+	 * adding the first \em bucketCount entries.
+	 * 
 	 * \throws deeInvalidParam \em bucketCount is less than 1.
 	 */
-	explicit decTDictionary(int bucketCount) : pBuckets(nullptr), pBucketCount(bucketCount), pEntryCount(0){
+	explicit decTDictionary(int bucketCount) : pEntries(nullptr), pEntryCount(0), pEntrySize(0){
 		DEASSERT_TRUE(bucketCount >= 1)
 		
-		pBuckets = new sDictEntry*[bucketCount];
-		std::fill_n(pBuckets, bucketCount, nullptr);
+		pEntries = new sDictEntry[bucketCount];
+		pEntrySize = bucketCount;
+		pIndex.Reserve(bucketCount);
 	}
 	
 	/** \brief Create copy of a dictionary. */
-	decTDictionary(const decTDictionary<K,V,VP,KP> &dict) : pBuckets(nullptr), pBucketCount(dict.pBucketCount), pEntryCount(0){
-		pBuckets = new sDictEntry*[pBucketCount];
-		std::fill_n(pBuckets, pBucketCount, nullptr);
-		
-		int i;
-		for(i=0; i<dict.pBucketCount; i++){
-			sDictEntry *iterEntry = dict.pBuckets[i];
-			while(iterEntry){
-				SetAt(iterEntry->key, iterEntry->value);
-				iterEntry = iterEntry->next;
-			}
+	decTDictionary(const decTDictionary<K,V,VP,KP> &dict) :
+	pEntries(nullptr), pEntryCount(0), pEntrySize(0), pIndex(dict.pIndex){
+		if(dict.pEntryCount == 0){
+			pIndex.RemoveAll();
+			return;
 		}
+		
+		pEntries = new sDictEntry[dict.pEntryCount];
+		pEntrySize = dict.pEntryCount;
+		std::copy_n(dict.pEntries, dict.pEntryCount, pEntries);
+		pEntryCount = dict.pEntryCount;
 	}
 	
 	/** \brief Move dictionary. */
-	decTDictionary(decTDictionary<K,V,VP,KP> &&dict) : pBuckets(dict.pBuckets), pBucketCount(dict.pBucketCount), pEntryCount(dict.pEntryCount){
-		dict.pBuckets = nullptr;
-		dict.pBucketCount = 0;
+	decTDictionary(decTDictionary<K,V,VP,KP> &&dict) : pEntries(dict.pEntries),
+	pEntryCount(dict.pEntryCount), pEntrySize(dict.pEntrySize), pIndex(std::move(dict.pIndex)){
+		dict.pEntries = nullptr;
 		dict.pEntryCount = 0;
+		dict.pEntrySize = 0;
 	}
 	
 	/** \brief Create dictionary from arguments in the form "key1, value1, key2, value2, ...". */
@@ -135,9 +148,8 @@ public:
 	
 	/** \brief Clean up the dictionary. */
 	~decTDictionary(){
-		RemoveAll();
-		if(pBuckets){
-			delete [] pBuckets;
+		if(pEntries){
+			delete [] pEntries;
 		}
 	}
 	/*@}*/
@@ -158,7 +170,12 @@ public:
 	 * \brief Determine if a key is located in the dictionary.
 	 */
 	bool Has(const KP &key) const{
-		return pGetEntry(key) != nullptr;
+		return pIndexOf(key) != -1;
+	}
+	
+	template<typename U> requires cLookupKey<U>
+	bool Has(const U &key) const{
+		return pIndexOf(key) != -1;
 	}
 	
 	/**
@@ -185,13 +202,9 @@ public:
 	template<typename Evaluator>
 	bool AllMatching(Evaluator &evaluator) const{
 		int i;
-		for(i=0; i<pBucketCount; i++){
-			sDictEntry *iterEntry = pBuckets[i];
-			while(iterEntry){
-				if(!evaluator(iterEntry->key, iterEntry->value)){
-					return false;
-				}
-				iterEntry = iterEntry->next;
+		for(i=0; i<pEntryCount; i++){
+			if(!evaluator(pEntries[i].key, pEntries[i].value)){
+				return false;
 			}
 		}
 		return true;
@@ -211,13 +224,9 @@ public:
 	template<typename Evaluator>
 	bool NoneMatching(Evaluator &evaluator) const{
 		int i;
-		for(i=0; i<pBucketCount; i++){
-			sDictEntry *iterEntry = pBuckets[i];
-			while(iterEntry){
-				if(evaluator(iterEntry->key, iterEntry->value)){
-					return false;
-				}
-				iterEntry = iterEntry->next;
+		for(i=0; i<pEntryCount; i++){
+			if(evaluator(pEntries[i].key, pEntries[i].value)){
+				return false;
 			}
 		}
 		return true;
@@ -230,35 +239,64 @@ public:
 	
 	/**
 	 * \brief Value for key.
+	 * \warning Reference is invalidated if entries are added or removed.
 	 * \throws deeInvalidParam \em key is not present in the dictionary.
 	 */
 	const V &GetAt(const KP &key) const{
-		const sDictEntry * const entry = pGetEntry(key);
-		DEASSERT_NOTNULL(entry)
+		const int index = pIndexOf(key);
+		DEASSERT_TRUE(index != -1)
+		
+		return pEntries[index].value;
+	}
+	
+	template<typename U> requires cLookupKey<U>
+	const V &GetAt(const U &key) const{
+		const int index = pIndexOf(key);
+		DEASSERT_TRUE(index != -1)
 		
-		return entry->value;
+		return pEntries[index].value;
 	}
 	
 	/**
 	 * \brief Value for key.
+	 * \warning Reference is invalidated if entries are added or removed.
 	 * \throws deeInvalidParam \em key is not present in the dictionary.
 	 */
 	V &GetAt(const KP &key){
-		sDictEntry * const entry = pGetEntry(key);
-		DEASSERT_NOTNULL(entry)
+		const int index = pIndexOf(key);
+		DEASSERT_TRUE(index != -1)
+		
+		return pEntries[index].value;
+	}
+	
+	template<typename U> requires cLookupKey<U>
+	V &GetAt(const U &key){
+		const int index = pIndexOf(key);
+		DEASSERT_TRUE(index != -1)
 		
-		return entry->value;
+		return pEntries[index].value;
 	}
 	
 	/**
 	 * \brief Value by key
 	 * \retval true Value of \em key stored in \em value.
 	 * \retval false \em key is not present in the dictionary.
+	 * \warning Pointer is invalidated if entries are added or removed.
 	 */
 	bool GetAt(const KP &key, const V *&value) const{
-		const sDictEntry * const entry = pGetEntry(key);
-		if(entry){
-			value = &entry->value;
+		const int index = pIndexOf(key);
+		if(index != -1){
+			value = &pEntries[index].value;
+			return true;
+		}
+		return false;
+	}
+	
+	template<typename U> requires cLookupKey<U>
+	bool GetAt(const U &key, const V *&value) const{
+		const int index = pIndexOf(key);
+		if(index != -1){
+			value = &pEntries[index].value;
 			return true;
 		}
 		return false;
@@ -268,30 +306,48 @@ public:
 	 * \brief Value for key or default value if absent.
 	 */
 	V GetAtOrDefault(const KP &key, const V &defaultValue = V()) const{
-		const sDictEntry * const entry = pGetEntry(key);
-		return entry ? entry->value : defaultValue;
+		const int index = pIndexOf(key);
+		return index != -1 ? pEntries[index].value : defaultValue;
+	}
+	
+	template<typename U> requires cLookupKey<U>
+	V GetAtOrDefault(const U &key, const V &defaultValue = V()) const{
+		const int index = pIndexOf(key);
+		return index != -1 ? pEntries[index].value : defaultValue;
 	}
 	
 	/**
 	 * \brief Set key to value.
 	 */
 	void SetAt(const K &key, const VP &value){
-		sDictEntry *entry = pGetEntry(key);
+		const unsigned int hash = DEHash(key);
+		const int index = pIndexOf(key, hash);
 		
-		if(entry){
-			entry->SetValue(value);
-			
-		}else{
-			const unsigned int hash = DEHash(key);
-			const int bucketIndex = hash % pBucketCount;
-			
-			entry = new sDictEntry(hash, key, value);
-			entry->next = pBuckets[bucketIndex];
-			pBuckets[bucketIndex] = entry;
-			pEntryCount++;
+		if(index != -1){
+			pEntries[index].value = V(value);
+			return;
 		}
 		
-		CheckLoad();
+		if(pEntryCount == pEntrySize){
+			// key and value can reference entries of this dictionary. copy them before
+			// enlarging moves the entries to new storage
+			const K keyCopy(key);
+			V valueCopy(value);
+			pEnlarge(pEntrySize * 3 / 2 + 1);
+
+			sDictEntry &entry = pEntries[pEntryCount];
+			entry.hash = hash;
+			entry.key = keyCopy;
+			entry.value = std::move(valueCopy);
+			pIndex.Add(hash, pEntryCount++);
+			return;
+		}
+
+		sDictEntry &entry = pEntries[pEntryCount];
+		entry.hash = hash;
+		entry.key = key;
+		entry.value = V(value);
+		pIndex.Add(hash, pEntryCount++);
 	}
 	
 	/**
@@ -302,55 +358,42 @@ public:
 		DEASSERT_TRUE(RemoveIfPresent(key))
 	}
 	
+	template<typename U> requires cLookupKey<U>
+	void Remove(const U &key){
+		DEASSERT_TRUE(RemoveIfPresent(key))
+	}
+	
 	/**
 	 * \brief Remove a key if present in the dictionary.
 	 * \returns true if removed.
 	 */
 	bool RemoveIfPresent(const KP &key){
-		const unsigned int hash = DEHash(key);
-		const int bucketIndex = hash % pBucketCount;
-		sDictEntry *iterEntry = pBuckets[bucketIndex];
-		sDictEntry *lastEntry = nullptr;
-		
-		while(iterEntry){
-			if(iterEntry->hash == hash && iterEntry->key == key){
-				if(lastEntry){
-					lastEntry->next = iterEntry->next;
-					
-				}else{
-					pBuckets[bucketIndex] = iterEntry->next;
-				}
-				
-				pEntryCount--;
-				delete iterEntry;
-				return true;
-			}
-			
-			lastEntry = iterEntry;
-			iterEntry = iterEntry->next;
+		const int index = pIndexOf(key);
+		if(index == -1){
+			return false;
 		}
-		return false;
+		
+		pRemoveFrom(index);
+		return true;
+	}
+	
+	template<typename U> requires cLookupKey<U>
+	bool RemoveIfPresent(const U &key){
+		const int index = pIndexOf(key);
+		if(index == -1){
+			return false;
+		}
+		
+		pRemoveFrom(index);
+		return true;
 	}
 	
 	/** \brief Remove all keys from the dictionary. */
 	void RemoveAll(){
-		if(pBuckets){
-			int i;
-			for(i=0; i<pBucketCount; i++){
-				if(pBuckets[i]){
-					sDictEntry *iterEntry = pBuckets[i];
-					pBuckets[i] = nullptr;
-					
-					while(iterEntry){
-						sDictEntry * const delbucket = iterEntry;
-						iterEntry = iterEntry->next;
-						delete delbucket;
-					}
-				}
-			}
+		while(pEntryCount > 0){
+			pEntries[--pEntryCount] = sDictEntry();
 		}
-		
-		pEntryCount = 0;
+		pIndex.RemoveAll();
 	}
 	
 	/** \brief Keys list. */
@@ -360,16 +403,9 @@ public:
 	KeyList GetKeys() const{
 		KeyList keys(pEntryCount);
 		int i;
-		
-		for(i=0; i<pBucketCount; i++){
-			sDictEntry *iterEntry = pBuckets[i];
-			
-			while(iterEntry){
-				keys.Add(iterEntry->key);
-				iterEntry = iterEntry->next;
-			}
+		for(i=0; i<pEntryCount; i++){
+			keys.Add(pEntries[i].key);
 		}
-		
 		return keys;
 	}
 	
@@ -380,16 +416,9 @@ public:
 	ValueList GetValues() const{
 		decTList<V,VP> values(pEntryCount);
 		int i;
-		
-		for(i=0; i<pBucketCount; i++){
-			sDictEntry *iterEntry = pBuckets[i];
-			
-			while(iterEntry){
-				values.Add(iterEntry->value);
-				iterEntry = iterEntry->next;
-			}
+		for(i=0; i<pEntryCount; i++){
+			values.Add(pEntries[i].value);
 		}
-		
 		return values;
 	}
 	
@@ -400,49 +429,24 @@ public:
 		}
 		
 		int i;
-		for(i=0; i<pBucketCount; i++){
-			sDictEntry *iterEntry = pBuckets[i];
-			
-			while(iterEntry){
-				sDictEntry * const otherEntry = dict.pGetEntry(iterEntry->key);
-				if(!otherEntry || !(otherEntry->value == iterEntry->value)){
-					return false;
-				}
-				iterEntry = iterEntry->next;
+		for(i=0; i<pEntryCount; i++){
+			const sDictEntry &entry = pEntries[i];
+			const int index = dict.pIndexOf(entry.key, entry.hash);
+			if(index == -1 || !(dict.pEntries[index].value == entry.value)){
+				return false;
 			}
 		}
 		
 		return true;
 	}
 	
-	/** \brief Check load of the dictionary changing bucket count if required. */
+	/**
+	 * \brief Check load of the dictionary.
+	 * 
+	 * The dictionary grows automatically while adding entries. Calling this function
+	 * is not required anymore and exists only for backwards compatibility.
+	 */
 	void CheckLoad(){
-		if((float)pEntryCount / (float)pBucketCount < 0.7f){
-			return;
-		}
-		
-		const int newBucketCount = pBucketCount + (pBucketCount >> 1); // +50%
-		sDictEntry ** const newBuckets = new sDictEntry*[newBucketCount];
-		
-		std::fill_n(newBuckets, newBucketCount, nullptr);
-		
-		int i;
-		for(i=0; i<pBucketCount; i++){
-			sDictEntry *iterEntry = pBuckets[i];
-			
-			while(iterEntry){
-				sDictEntry * const moveEntry = iterEntry;
-				iterEntry = iterEntry->next;
-				
-				const int bucketIndex = moveEntry->hash % newBucketCount;
-				moveEntry->next = newBuckets[bucketIndex];
-				newBuckets[bucketIndex] = moveEntry;
-			}
-		}
-		
-		delete [] pBuckets;
-		pBuckets = newBuckets;
-		pBucketCount = newBucketCount;
 	}
 	
 	
@@ -453,12 +457,8 @@ public:
 	template<typename Visitor>
 	void Visit(Visitor &visitor) const {
 		int i;
-		for(i=0; i<pBucketCount; i++){
-			const sDictEntry *iterEntry = pBuckets[i];
-			while(iterEntry){
-				visitor(iterEntry->key, iterEntry->value);
-				iterEntry = iterEntry->next;
-			}
+		for(i=0; i<pEntryCount; i++){
+			visitor(pEntries[i].key, pEntries[i].value);
 		}
 	}
 	
@@ -475,13 +475,9 @@ public:
 	template<typename Evaluator>
 	void VisitWhile(Evaluator &evaluator) const{
 		int i;
-		for(i=0; i<pBucketCount; i++){
-			const sDictEntry *iterEntry = pBuckets[i];
-			while(iterEntry){
-				if(!evaluator(iterEntry->key, iterEntry->value)){
-					return;
-				}
-				iterEntry = iterEntry->next;
+		for(i=0; i<pEntryCount; i++){
+			if(!evaluator(pEntries[i].key, pEntries[i].value)){
+				return;
 			}
 		}
 	}
@@ -500,14 +496,10 @@ public:
 	template<typename Evaluator>
 	bool Find(const V* &found, Evaluator &evaluator) const{
 		int i;
-		for(i=0; i<pBucketCount; i++){
-			const sDictEntry *iterEntry = pBuckets[i];
-			while(iterEntry){
-				if(evaluator(iterEntry->key, iterEntry->value)){
-					found = &iterEntry->value;
-					return true;
-				}
-				iterEntry = iterEntry->next;
+		for(i=0; i<pEntryCount; i++){
+			if(evaluator(pEntries[i].key, pEntries[i].value)){
+				found = &pEntries[i].value;
+				return true;
 			}
 		}
 		
@@ -557,18 +549,11 @@ public:
 	decTDictionary<K,V,VP,KP> Collect(Evaluator &evaluator) const{
 		decTDictionary<K,V,VP,KP> collected;
 		int i;
-		
-		for(i=0; i<pBucketCount; i++){
-			const sDictEntry *iterEntry = pBuckets[i];
-			
-			while(iterEntry){
-				if(evaluator(iterEntry->key, iterEntry->value)){
-					collected.SetAt(iterEntry->key, iterEntry->value);
-				}
-				iterEntry = iterEntry->next;
+		for(i=0; i<pEntryCount; i++){
+			if(evaluator(pEntries[i].key, pEntries[i].value)){
+				collected.pAddUnique(pEntries[i]);
 			}
 		}
-		
 		return collected;
 	}
 	
@@ -586,21 +571,10 @@ public:
 	template<typename Combiner>
 	V Fold(Combiner &combiner) const{
 		DEASSERT_TRUE(IsNotEmpty())
-		bool accInitialized = false;
-		V acc = V();
+		V acc = pEntries[0].value;
 		int i;
-		for(i=0; i<pBucketCount; i++){
-			const sDictEntry *iterEntry = pBuckets[i];
-			while(iterEntry){
-				if(!accInitialized){
-					acc = iterEntry->value;
-					accInitialized = true;
-					
-				}else{
-					acc = combiner(acc, iterEntry->value);
-				}
-				iterEntry = iterEntry->next;
-			}
+		for(i=1; i<pEntryCount; i++){
+			acc = combiner(acc, pEntries[i].value);
 		}
 		return acc;
 	}
@@ -620,12 +594,8 @@ public:
 	R Inject(const R &value, Combiner &combiner) const{
 		R acc = value;
 		int i;
-		for(i=0; i<pBucketCount; i++){
-			const sDictEntry *iterEntry = pBuckets[i];
-			while(iterEntry){
-				acc = combiner(acc, iterEntry->value);
-				iterEntry = iterEntry->next;
-			}
+		for(i=0; i<pEntryCount; i++){
+			acc = combiner(acc, pEntries[i].value);
 		}
 		return acc;
 	}
@@ -642,30 +612,14 @@ public:
 	 */
 	template<typename Evaluator>
 	void RemoveIf(Evaluator &evaluator){
-		int i;
-		for(i=0; i<pBucketCount; i++){
-			sDictEntry *iterEntry = pBuckets[i];
-			sDictEntry *lastEntry = nullptr;
-			
-			while(iterEntry){
-				if(evaluator(iterEntry->key, iterEntry->value)){
-					sDictEntry * const delEntry = iterEntry;
-					
-					if(lastEntry){
-						lastEntry->next = iterEntry->next;
-						
-					}else{
-						pBuckets[i] = iterEntry->next;
-					}
-					
-					iterEntry = iterEntry->next;
-					delete delEntry;
-					pEntryCount--;
-					
-				}else{
-					lastEntry = iterEntry;
-					iterEntry = iterEntry->next;
-				}
+		int i = 0;
+		while(i < pEntryCount){
+			if(evaluator(pEntries[i].key, pEntries[i].value)){
+				// last entry moves into this position. check it in the next loop iteration
+				pRemoveFrom(i);
+				
+			}else{
+				i++;
 			}
 		}
 	}
@@ -692,17 +646,7 @@ public:
 	/** \brief New dictionary containing keys of this dictionary and the keys of another applied ontop of it. */
 	decTDictionary<K,V,VP,KP> operator+(const decTDictionary<K,V,VP,KP> &dict) const{
 		decTDictionary<K,V,VP,KP> ndict(*this);
-		int i;
-		
-		for(i=0; i<dict.pBucketCount; i++){
-			sDictEntry *iterEntry = dict.pBuckets[i];
-			
-			while(iterEntry){
-				ndict.SetAt(iterEntry->key, iterEntry->value);
-				iterEntry = iterEntry->next;
-			}
-		}
-		
+		ndict += dict;
 		return ndict;
 	}
 	
@@ -717,18 +661,11 @@ public:
 	decTDictionary<K,V,VP,KP> operator-(const decTDictionary<K,V,VP,KP> &dict) const{
 		decTDictionary<K,V,VP,KP> ndict;
 		int i;
-		
-		for(i=0; i<pBucketCount; i++){
-			sDictEntry *iterEntry = pBuckets[i];
-			
-			while(iterEntry){
-				if(!dict.Has(iterEntry->key)){
-					ndict.SetAt(iterEntry->key, iterEntry->value);
-				}
-				iterEntry = iterEntry->next;
+		for(i=0; i<pEntryCount; i++){
+			if(dict.pIndexOf(pEntries[i].key, pEntries[i].hash) == -1){
+				ndict.pAddUnique(pEntries[i]);
 			}
 		}
-		
 		return ndict;
 	}
 	
@@ -736,23 +673,17 @@ public:
 	decTDictionary<K,V,VP,KP> operator-(const K &key) const{
 		decTDictionary<K,V,VP,KP> ndict;
 		int i;
-		
-		for(i=0; i<pBucketCount; i++){
-			sDictEntry *iterEntry = pBuckets[i];
-			
-			while(iterEntry){
-				if(!(iterEntry->key == key)){
-					ndict.SetAt(iterEntry->key, iterEntry->value);
-				}
-				iterEntry = iterEntry->next;
+		for(i=0; i<pEntryCount; i++){
+			if(!(pEntries[i].key == key)){
+				ndict.pAddUnique(pEntries[i]);
 			}
 		}
-		
 		return ndict;
 	}
 	
 	/**
 	 * \brief Value for key.
+	 * \warning Reference is invalidated if entries are added or removed.
 	 * \throws deeInvalidParam \em key is not present in the dictionary.
 	 */
 	const V &operator[](const KP &key) const{
@@ -761,6 +692,7 @@ public:
 	
 	/**
 	 * \brief Value for key.
+	 * \warning Reference is invalidated if entries are added or removed.
 	 * \throws deeInvalidParam \em key is not present in the dictionary.
 	 */
 	V &operator[](const KP &key){
@@ -775,16 +707,19 @@ public:
 		
 		RemoveAll();
 		
-		int i;
-		for(i=0; i<dict.pBucketCount; i++){
-			sDictEntry *iterEntry = dict.pBuckets[i];
-			
-			while(iterEntry){
-				SetAt(iterEntry->key, iterEntry->value);
-				iterEntry = iterEntry->next;
+		if(dict.pEntryCount > pEntrySize){
+			sDictEntry * const newEntries = new sDictEntry[dict.pEntryCount];
+			if(pEntries){
+				delete [] pEntries;
 			}
+			pEntries = newEntries;
+			pEntrySize = dict.pEntryCount;
 		}
 		
+		std::copy_n(dict.pEntries, dict.pEntryCount, pEntries);
+		pEntryCount = dict.pEntryCount;
+		pIndex = dict.pIndex;
+		
 		return *this;
 	}
 	
@@ -794,19 +729,18 @@ public:
 			return *this;
 		}
 		
-		RemoveAll();
-		
-		if(pBuckets){
-			delete [] pBuckets;
+		if(pEntries){
+			delete [] pEntries;
 		}
 		
-		pBuckets = dict.pBuckets;
-		pBucketCount = dict.pBucketCount;
+		pEntries = dict.pEntries;
 		pEntryCount = dict.pEntryCount;
+		pEntrySize = dict.pEntrySize;
+		pIndex = std::move(dict.pIndex);
 		
-		dict.pBuckets = nullptr;
-		dict.pBucketCount = 0;
+		dict.pEntries = nullptr;
 		dict.pEntryCount = 0;
+		dict.pEntrySize = 0;
 		
 		return *this;
 	}
@@ -814,13 +748,15 @@ public:
 	/** \brief Set all keys from dictionary to this dictionary. */
 	decTDictionary<K,V,VP,KP> &operator+=(const decTDictionary<K,V,VP,KP> &dict){
 		int i;
-		
-		for(i=0; i<dict.pBucketCount; i++){
-			sDictEntry *iterEntry = dict.pBuckets[i];
+		for(i=0; i<dict.pEntryCount; i++){
+			const sDictEntry &entry = dict.pEntries[i];
+			const int index = pIndexOf(entry.key, entry.hash);
 			
-			while(iterEntry){
-				SetAt(iterEntry->key, iterEntry->value);
-				iterEntry = iterEntry->next;
+			if(index != -1){
+				pEntries[index].value = entry.value;
+				
+			}else{
+				pAddUnique(entry);
 			}
 		}
 		
@@ -830,13 +766,10 @@ public:
 	/** \brief Remove all keys from dictionary from this dictionary. */
 	decTDictionary<K,V,VP,KP> &operator-=(const decTDictionary<K,V,VP,KP> &dict){
 		int i;
-		
-		for(i=0; i<dict.pBucketCount; i++){
-			sDictEntry *iterEntry = dict.pBuckets[i];
-			
-			while(iterEntry){
-				RemoveIfPresent(iterEntry->key);
-				iterEntry = iterEntry->next;
+		for(i=0; i<dict.pEntryCount; i++){
+			const int index = pIndexOf(dict.pEntries[i].key, dict.pEntries[i].hash);
+			if(index != -1){
+				pRemoveFrom(index);
 			}
 		}
 		
@@ -853,73 +786,41 @@ public:
 		using reference = value_type;
 		using pointer = void;
 		using difference_type = std::ptrdiff_t;
-
-		const_iterator() : pDict(nullptr), bucketIndex(0), entry(nullptr){}
-		const_iterator(const decTDictionary *d, int b, const sDictEntry *e)
-			: pDict(d), bucketIndex(b), entry(e)
-		{
-			if(pDict && bucketIndex < pDict->pBucketCount && entry == nullptr){
-				entry = pDict->pBuckets[bucketIndex];
-			}
-			advance_to_valid();
-		}
-
+		
+		const_iterator() : pDict(nullptr), pIndex(0){}
+		const_iterator(const decTDictionary *d, int index) : pDict(d), pIndex(index){}
+		
 		bool operator==(const const_iterator &o) const {
-			return pDict == o.pDict && bucketIndex == o.bucketIndex && entry == o.entry;
+			return pDict == o.pDict && pIndex == o.pIndex;
 		}
 		bool operator!=(const const_iterator &o) const { return !(*this == o); }
-
+		
 		const_iterator &operator++(){
-			if(!entry) return *this;
-			entry = entry->next;
-			if(entry) return *this;
-
-			++bucketIndex;
-			while(pDict && bucketIndex < pDict->pBucketCount){
-				entry = pDict->pBuckets[bucketIndex];
-				if(entry) return *this;
-				++bucketIndex;
+			if(pDict && pIndex < pDict->pEntryCount){
+				pIndex++;
 			}
-			entry = nullptr;
 			return *this;
 		}
-
+		
 		const_iterator operator++(int){
 			const_iterator tmp = *this;
 			++*this;
 			return tmp;
 		}
-
+		
 		value_type operator*() const {
-			return value_type(entry->key, entry->value);
+			const sDictEntry &entry = pDict->pEntries[pIndex];
+			return value_type(entry.key, entry.value);
 		}
-
+		
 	private:
 		const decTDictionary *pDict;
-		int bucketIndex;
-		const sDictEntry *entry;
-
-		void advance_to_valid(){
-			if(!pDict){
-				entry = nullptr;
-				bucketIndex = 0;
-				return;
-			}
-			while(bucketIndex < pDict->pBucketCount && entry == nullptr){
-				entry = pDict->pBuckets[bucketIndex];
-				if(entry) break;
-				++bucketIndex;
-			}
-			if(bucketIndex >= pDict->pBucketCount){
-				entry = nullptr;
-				bucketIndex = pDict->pBucketCount;
-			}
-		}
+		int pIndex;
 	}; /* end const_iterator */
-
-	const_iterator cbegin() const { return const_iterator(this, 0, nullptr); }
-	const_iterator cend()   const { return const_iterator(this, pBucketCount, nullptr); }
-
+	
+	const_iterator cbegin() const { return const_iterator(this, 0); }
+	const_iterator cend()   const { return const_iterator(this, pEntryCount); }
+	
 	/* convenience const begin/end */
 	const_iterator begin() const { return cbegin(); }
 	const_iterator end()   const { return cend(); }
@@ -927,19 +828,49 @@ public:
 	
 	
 private:
-	sDictEntry *pGetEntry(const KP &key) const{
-		const unsigned int hash = DEHash(key);
-		const int bucketIndex = hash % pBucketCount;
-		sDictEntry *iterEntry = pBuckets[bucketIndex];
+	template<typename U>
+	inline int pIndexOf(const U &key) const{
+		return pIndexOf(key, DEHash(key));
+	}
+	
+	template<typename U>
+	int pIndexOf(const U &key, unsigned int hash) const{
+		return pIndex.Find(hash, [&](int index){
+			return pEntries[index].key == key;
+		});
+	}
+	
+	void pAddUnique(const sDictEntry &entry){
+		if(pEntryCount == pEntrySize){
+			pEnlarge(pEntrySize * 3 / 2 + 1);
+		}
 		
-		while(iterEntry){
-			if(iterEntry->hash == hash && iterEntry->key == key){
-				return iterEntry;
-			}
-			iterEntry = iterEntry->next;
+		pEntries[pEntryCount] = entry;
+		pIndex.Add(entry.hash, pEntryCount++);
+	}
+	
+	void pRemoveFrom(int index){
+		const int last = pEntryCount - 1;
+		
+		pIndex.Remove(pEntries[index].hash, index);
+		
+		if(index < last){
+			pIndex.Move(pEntries[last].hash, last, index);
+			pEntries[index] = std::move(pEntries[last]);
 		}
 		
-		return nullptr;
+		pEntries[last] = sDictEntry();
+		pEntryCount--;
+	}
+	
+	void pEnlarge(int size){
+		sDictEntry * const newEntries = new sDictEntry[size];
+		if(pEntries){
+			std::move(pEntries, pEntries + pEntryCount, newEntries);
+			delete [] pEntries;
+		}
+		pEntries = newEntries;
+		pEntrySize = size;
 	}
 };
 
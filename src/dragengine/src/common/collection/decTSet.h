@@ -26,12 +26,15 @@
 #define _DECTSET_H_
 
 #include <algorithm>
+#include <concepts>
 #include <iterator>
 #include <cstddef>
 #include <utility>
 #include <type_traits>
 
 #include "decCollectionInterfaces.h"
+#include "decHashIndex.h"
+#include "decGlobalFunctions_safe.h"
 #include "../exceptions_reduced.h"
 #include "../../deTObjectReference.h"
 #include "../../deTUniqueReference.h"
@@ -43,12 +46,26 @@
  * 
  * All elements including default constructed values are allowed and they can occure only once
  * in the set. Sets are equal if they contain the same elements independent of their order.
+ * 
+ * If a global function "unsigned int DEHash(const T&)" exists for T and TP the set builds
+ * a decHashIndex once it contains more than a few elements. Lookups then do not require
+ * comparing all elements. Small sets and sets of types without DEHash use linear search.
  */
 template<typename T, typename TP = T>
 class decTSet{
 private:
 	T *pElements;
 	int pCount, pSize;
+	decHashIndex pIndex;
+	
+	/** \brief Elements can be hashed. */
+	static constexpr bool cHashable = requires(const T &t, const TP &tp){
+		{DEHash(t)} -> std::convertible_to<unsigned int>;
+		{DEHash(tp)} -> std::convertible_to<unsigned int>;
+	};
+	
+	/** \brief Element count above which the hash index is used. */
+	static constexpr int cIndexThreshold = 16;
 	
 	
 public:
@@ -82,10 +99,12 @@ public:
 		
 		std::copy_n(set.pElements, set.pCount, pElements);
 		pCount = set.pCount;
+		pIndex = set.pIndex;
 	}
 	
 	/** \briev Move set. */
-	decTSet(decTSet<T,TP> &&set) : pElements(set.pElements), pCount(set.pCount), pSize(set.pSize){
+	decTSet(decTSet<T,TP> &&set) : pElements(set.pElements), pCount(set.pCount),
+	pSize(set.pSize), pIndex(std::move(set.pIndex)){
 		set.pElements = nullptr;
 		set.pCount = 0;
 		set.pSize = 0;
@@ -166,29 +185,13 @@ public:
 	
 	/** \brief Determine if element exists in the set. */
 	bool Has(const TP &element) const{
-		int p;
-		
-		for(p=0; p<pCount; p++){
-			if(pElements[p] == element){
-				return true;
-			}
-		}
-		
-		return false;
+		return pIndexOf(element) != -1;
 	}
 	
 	template<typename U = T>
 	typename std::enable_if<!std::is_same<U, TP>::value, bool>::type
 	Has(const T &element) const{
-		int p;
-		
-		for(p=0; p<pCount; p++){
-			if(pElements[p] == element){
-				return true;
-			}
-		}
-		
-		return false;
+		return pIndexOf(element) != -1;
 	}
 	
 	/**
@@ -252,29 +255,13 @@ public:
 	
 	/** \brief Index of the first occurance of an element or -1 if not found. */
 	int IndexOf(const TP &element) const{
-		int p;
-		
-		for(p=0; p<pCount; p++){
-			if(pElements[p] == element){
-				return p;
-			}
-		}
-		
-		return -1;
+		return pIndexOf(element);
 	}
 	
 	template<typename U = T>
 	typename std::enable_if<!std::is_same<U, TP>::value, int>::type
 	IndexOf(const T &element) const{
-		int p;
-		
-		for(p=0; p<pCount; p++){
-			if(pElements[p] == element){
-				return p;
-			}
-		}
-		
-		return -1;
+		return pIndexOf(element);
 	}
 	
 	/**
@@ -300,6 +287,7 @@ public:
 		}
 		
 		pElements[pCount++] = element;
+		pIndexAdd(pCount - 1);
 		return true;
 	}
 	
@@ -322,6 +310,7 @@ public:
 		}
 		
 		pElements[pCount++] = element;
+		pIndexAdd(pCount - 1);
 		return true;
 	}
 	
@@ -377,10 +366,7 @@ public:
 			return false;
 		}
 		
-		if(position < pCount - 1){
-			pElements[position] = std::move(pElements[pCount - 1]);
-		}
-		pElements[--pCount] = T();
+		pRemoveFrom(position);
 		return true;
 	}
 	
@@ -392,10 +378,7 @@ public:
 			return false;
 		}
 		
-		if(position < pCount - 1){
-			pElements[position] = std::move(pElements[pCount - 1]);
-		}
-		pElements[--pCount] = T();
+		pRemoveFrom(position);
 		return true;
 	}
 	
@@ -418,6 +401,7 @@ public:
 		while(pCount > 0){
 			pElements[--pCount] = T();
 		}
+		pIndex.RemoveAll();
 	}
 	
 	/** \brief Determine if this set is equal to another set. */
@@ -664,9 +648,14 @@ public:
 			}
 			last++;
 		}
+		if(pCount == last){
+			return;
+		}
+		
 		while(pCount > last){
 			pElements[--pCount] = T();
 		}
+		pRebuildIndex();
 	}
 	
 	template<typename Evaluator>
@@ -691,6 +680,7 @@ public:
 		decTSet<T,TP> nset(pCount + set.pCount);
 		std::copy_n(pElements, pCount, nset.pElements);
 		nset.pCount = pCount;
+		nset.pIndex = pIndex;
 		
 		int i;
 		for(i=0; i<set.pCount; i++){
@@ -705,6 +695,7 @@ public:
 		decTSet<T,TP> nset(pCount + 1);
 		std::copy_n(pElements, pCount, nset.pElements);
 		nset.pCount = pCount;
+		nset.pIndex = pIndex;
 		
 		nset.Add(element);
 		
@@ -764,6 +755,7 @@ public:
 		
 		std::copy_n(set.pElements, set.pCount, pElements);
 		pCount = set.pCount;
+		pIndex = set.pIndex;
 		
 		return *this;
 	}
@@ -783,6 +775,7 @@ public:
 		pElements = set.pElements;
 		pCount = set.pCount;
 		pSize = set.pSize;
+		pIndex = std::move(set.pIndex);
 		
 		set.pElements = nullptr;
 		set.pCount = 0;
@@ -964,6 +957,72 @@ public:
 		return const_reverse_iterator(cbegin());
 	}
 	/*@}*/
+	
+	
+private:
+	template<typename U>
+	int pIndexOf(const U &element) const{
+		if constexpr(cHashable){
+			if(pIndex.GetSlotCount() > 0){
+				return pIndex.Find(DEHash(element), [&](int index){
+					return pElements[index] == element;
+				});
+			}
+		}
+		
+		int p;
+		for(p=0; p<pCount; p++){
+			if(pElements[p] == element){
+				return p;
+			}
+		}
+		return -1;
+	}
+	
+	void pIndexAdd(int index){
+		if constexpr(cHashable){
+			if(pIndex.GetSlotCount() > 0){
+				pIndex.Add(DEHash(pElements[index]), index);
+				
+			}else if(pCount > cIndexThreshold){
+				pRebuildIndex();
+			}
+		}
+	}
+	
+	void pRemoveFrom(int position){
+		const int last = pCount - 1;
+		
+		if constexpr(cHashable){
+			if(pIndex.GetSlotCount() > 0){
+				pIndex.Remove(DEHash(pElements[position]), position);
+				if(position < last){
+					pIndex.Move(DEHash(pElements[last]), last, position);
+				}
+			}
+		}
+		
+		if(position < last){
+			pElements[position] = std::move(pElements[last]);
+		}
+		pElements[--pCount] = T();
+	}
+	
+	void pRebuildIndex(){
+		if constexpr(cHashable){
+			if(pIndex.GetSlotCount() == 0 && pCount <= cIndexThreshold){
+				return;
+			}
+			
+			pIndex.RemoveAll();
+			pIndex.Reserve(pCount);
+			
+			int i;
+			for(i=0; i<pCount; i++){
+				pIndex.Add(DEHash(pElements[i]), i);
+			}
+		}
+	}
 };
 
 
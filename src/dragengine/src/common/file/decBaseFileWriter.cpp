@@ -43,6 +43,15 @@ decBaseFileWriter::~decBaseFileWriter(){
 }
 
 
+
+// Management
+///////////////
+
+void decBaseFileWriter::Flush(){
+}
+
+
+
 // Writing
 ////////////
 
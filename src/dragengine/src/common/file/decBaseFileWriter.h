@@ -86,6 +86,14 @@ public:
 	 */
 	virtual void Write(const void *buffer, int size) = 0;
 	
+	/**
+	 * \brief Flush buffered data to the underlying file.
+	 * \version 1.34
+	 * 
+	 * Default implementation does nothing.
+	 */
+	virtual void Flush();
+	
 	/** \brief Duplicate file writer. */
 	virtual Ref Duplicate() = 0;
 	/*@}*/
@@ -0,0 +1,149 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>
+#include <zlib.h>
+
+#include "decDeflateChunk.h"
+#include "../exceptions.h"
+#include "../math/decMath.h"
+
+
+// Definitions
+////////////////
+
+// Size in bytes of deflate window used as dictionary for chunks
+#define WINDOW_SIZE 32768
+
+// Size in bytes of blocks read from the file
+#define READ_SIZE 65536
+
+
+
+// Class decDeflateChunk
+//////////////////////////
+
+// Management
+///////////////
+
+uint32_t decDeflateChunk::Deflate(decBaseFileReader &reader, int level, int offset, int length,
+bool lastChunk, decTList<uint8_t> &compressed){
+	DEASSERT_TRUE(level != LevelStore)
+	DEASSERT_TRUE(offset >= 0)
+	DEASSERT_TRUE(length >= 0)
+	DEASSERT_TRUE(offset + length <= reader.GetLength())
+	
+	decTList<uint8_t> bufferIn;
+	bufferIn.SetCountDiscard(READ_SIZE);
+	
+	// use the same parameters as the zip writer does
+	z_stream zstream;
+	memset(&zstream, 0, sizeof(zstream));
+	if(deflateInit2(&zstream, level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK){
+		DETHROW(deeOutOfMemory);
+	}
+	
+	uLong crc = crc32(0, nullptr, 0);
+	
+	try{
+		// chunks continue the previous chunk using the last window as dictionary
+		if(offset > 0){
+			const int dictionarySize = decMath::min(offset, WINDOW_SIZE);
+			reader.SetPosition(offset - dictionarySize);
+			reader.Read(bufferIn.GetArrayPointer(), dictionarySize);
+			
+			if(deflateSetDictionary(&zstream, bufferIn.GetArrayPointer(), dictionarySize) != Z_OK){
+				DETHROW_INFO(deeInvalidAction, reader.GetFilename());
+			}
+			
+		}else{
+			reader.SetPosition(0);
+		}
+		
+		compressed.SetCountDiscard((int)deflateBound(&zstream, length) + 16);
+		zstream.next_out = compressed.GetArrayPointer();
+		zstream.avail_out = compressed.GetCount();
+		
+		int remaining = length;
+		
+		while(true){
+			const int readSize = decMath::min(remaining, READ_SIZE);
+			if(readSize > 0){
+				reader.Read(bufferIn.GetArrayPointer(), readSize);
+				crc = crc32(crc, bufferIn.GetArrayPointer(), readSize);
+				remaining -= readSize;
+			}
+			
+			const int flush = remaining > 0 ? Z_NO_FLUSH : (lastChunk ? Z_FINISH : Z_SYNC_FLUSH);
+			zstream.next_in = bufferIn.GetArrayPointer();
+			zstream.avail_in = readSize;
+			
+			const int result = deflate(&zstream, flush);
+			if(result == Z_STREAM_ERROR || zstream.avail_in > 0){
+				DETHROW_INFO(deeInvalidAction, reader.GetFilename());
+			}
+			
+			if(flush != Z_NO_FLUSH){
+				if(flush == Z_FINISH && result != Z_STREAM_END){
+					DETHROW_INFO(deeInvalidAction, reader.GetFilename());
+				}
+				break;
+			}
+		}
+		
+		compressed.SetCount((int)zstream.total_out);
+		
+	}catch(const deException &){
+		deflateEnd(&zstream);
+		compressed.RemoveAll();
+		throw;
+	}
+	
+	deflateEnd(&zstream);
+	return (uint32_t)crc;
+}
+
+uint32_t decDeflateChunk::Store(decBaseFileReader &reader, int offset, int length,
+decTList<uint8_t> &data){
+	DEASSERT_TRUE(offset >= 0)
+	DEASSERT_TRUE(length >= 0)
+	DEASSERT_TRUE(offset + length <= reader.GetLength())
+	
+	data.SetCountDiscard(length);
+	if(length > 0){
+		reader.SetPosition(offset);
+		reader.Read(data.GetArrayPointer(), length);
+	}
+	
+	return (uint32_t)crc32(crc32(0, nullptr, 0), data.GetArrayPointer(), length);
+}
+
+uint32_t decDeflateChunk::InitialCrc(){
+	return (uint32_t)crc32(0, nullptr, 0);
+}
+
+uint32_t decDeflateChunk::CombineCrc(uint32_t crc1, uint32_t crc2, int length2){
+	DEASSERT_TRUE(length2 >= 0)
+	return (uint32_t)crc32_combine(crc1, crc2, length2);
+}
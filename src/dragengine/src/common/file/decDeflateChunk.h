@@ -0,0 +1,99 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DECDEFLATECHUNK_H_
+#define _DECDEFLATECHUNK_H_
+
+#include <stdint.h>
+
+#include "decBaseFileReader.h"
+#include "../collection/decTList.h"
+#include "../../dragengine_export.h"
+
+
+/**
+ * \brief Deflate file content in independent chunks concatenating to one deflate stream.
+ * \version 1.34
+ * 
+ * Large files can be compressed in parallel by splitting them into chunks compressed
+ * individually like pigz does. Chunks use the last 32KB of the previous chunk as
+ * dictionary and end with a sync flush except the last chunk. Concatenating the
+ * compressed chunks in order produces a single valid raw deflate stream as written
+ * by zip writers. A single chunk produces the same data as deflating in one go.
+ * 
+ * The CRC32 of each chunk is calculated while compressing. Use CombineCrc() to
+ * calculate the CRC32 of the entire file from the chunk CRC32 values in order.
+ */
+class DE_DLL_EXPORT decDeflateChunk{
+public:
+	/** \brief Compression level storing data without compression. */
+	static const int LevelStore = 0;
+	
+	/** \brief Default compression level. */
+	static const int LevelDefault = -1;
+	
+	
+	
+	/** \name Management */
+	/*@{*/
+	/**
+	 * \brief Deflate chunk of file.
+	 * \param[in] reader Reader to read file from.
+	 * \param[in] level Zlib compression level from 1 to 9 or \ref LevelDefault.
+	 * \param[in] offset Offset in bytes of chunk to compress.
+	 * \param[in] length Length in bytes of chunk to compress.
+	 * \param[in] lastChunk Chunk is the last one of the file.
+	 * \param[out] compressed Raw deflate data of chunk.
+	 * \returns CRC32 of uncompressed chunk data.
+	 * \throws deeInvalidParam Chunk is not located inside file.
+	 */
+	static uint32_t Deflate(decBaseFileReader &reader, int level, int offset, int length,
+		bool lastChunk, decTList<uint8_t> &compressed);
+	
+	/**
+	 * \brief Read chunk of file to store without compression.
+	 * \param[in] reader Reader to read file from.
+	 * \param[in] offset Offset in bytes of chunk to store.
+	 * \param[in] length Length in bytes of chunk to store.
+	 * \param[out] data Content of chunk.
+	 * \returns CRC32 of chunk data.
+	 * \throws deeInvalidParam Chunk is not located inside file.
+	 */
+	static uint32_t Store(decBaseFileReader &reader, int offset, int length, decTList<uint8_t> &data);
+	
+	/** \brief CRC32 of empty data to start combining chunk CRC32 values with. */
+	static uint32_t InitialCrc();
+	
+	/**
+	 * \brief Combine CRC32 values of two consecutive chunks.
+	 * \param[in] crc1 CRC32 of first chunk.
+	 * \param[in] crc2 CRC32 of second chunk.
+	 * \param[in] length2 Length in bytes of second chunk.
+	 * \returns CRC32 of both chunks concatenated.
+	 */
+	static uint32_t CombineCrc(uint32_t crc1, uint32_t crc2, int length2);
+	/*@}*/
+};
+
+#endif
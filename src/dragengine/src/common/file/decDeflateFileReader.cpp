@@ -0,0 +1,318 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>
+#include <zlib.h>
+
+#include "decDeflateFileReader.h"
+#include "decMappedFileReader.h"
+#include "../exceptions.h"
+
+
+
+// Definitions
+////////////////
+
+// Size in bytes of the input buffer to use if the source reader is not memory mapped
+#define BUFFER_SIZE 16384
+
+
+
+// Class decDeflateFileReader
+///////////////////////////////
+
+// Constructor, Destructor
+////////////////////////////
+
+decDeflateFileReader::decDeflateFileReader(decBaseFileReader *reader, const char *filename,
+TIME_SYSTEM modificationTime, int offset, int compressedLength, int length,
+decDeflateSeekIndex *seekIndex) :
+pReader(reader),
+pModificationTime(modificationTime),
+pOffset(offset),
+pCompressedLength(compressedLength),
+pLength(length),
+pSeekIndex(seekIndex),
+pZStream(nullptr),
+pMappedData(nullptr),
+pPositionIn(0),
+pPosition(0),
+pWindowPosition(0),
+pWindowFill(0)
+{
+	DEASSERT_NOTNULL(reader)
+	DEASSERT_NOTNULL(filename)
+	DEASSERT_TRUE(offset >= 0)
+	DEASSERT_TRUE(compressedLength >= 0)
+	DEASSERT_TRUE(length >= 0)
+	DEASSERT_TRUE(compressedLength <= reader->GetLength() - offset)
+	
+	pFilename = filename;
+	
+	const decMappedFileReader * const mappedReader = dynamic_cast<decMappedFileReader*>(reader);
+	if(mappedReader && mappedReader->GetData()){
+		pMappedData = mappedReader->GetData() + offset;
+		
+	}else{
+		pBufferIn.SetCountDiscard(BUFFER_SIZE);
+	}
+	
+	z_stream * const zstream = new z_stream;
+	memset(zstream, 0, sizeof(z_stream));
+	
+	if(inflateInit2(zstream, -MAX_WBITS) != Z_OK){
+		delete zstream;
+		DETHROW(deeOutOfMemory);
+	}
+	pZStream = zstream;
+	
+	pRestart(nullptr);
+}
+
+decDeflateFileReader::~decDeflateFileReader(){
+	if(pZStream){
+		inflateEnd((z_stream*)pZStream);
+		delete (z_stream*)pZStream;
+	}
+}
+
+
+
+// Management
+///////////////
+
+const char *decDeflateFileReader::GetFilename(){
+	return pFilename;
+}
+
+int decDeflateFileReader::GetLength(){
+	return pLength;
+}
+
+TIME_SYSTEM decDeflateFileReader::GetModificationTime(){
+	return pModificationTime;
+}
+
+
+
+// Seeking
+////////////
+
+int decDeflateFileReader::GetPosition(){
+	return pPosition;
+}
+
+void decDeflateFileReader::SetPosition(int position){
+	DEASSERT_TRUE(position >= 0)
+	DEASSERT_TRUE(position <= pLength)
+	
+	if(position == pPosition){
+		return;
+	}
+	
+	if(pSeekIndex){
+		if(position < pPosition){
+			pSeekIndex->Activate();
+		}
+		
+		// resume at checkpoint if seeking backwards or if the checkpoint skips data
+		const decDeflateSeekIndex::cCheckpoint * const checkpoint = pSeekIndex->FindCheckpoint(position);
+		if(checkpoint && (position < pPosition || checkpoint->GetPositionOut() > pPosition)){
+			pRestart(checkpoint);
+			
+		}else if(position < pPosition){
+			pRestart(nullptr);
+		}
+		
+	}else if(position < pPosition){
+		pRestart(nullptr);
+	}
+	
+	pInflate(nullptr, position - pPosition);
+}
+
+void decDeflateFileReader::MovePosition(int offset){
+	SetPosition(pPosition + offset);
+}
+
+void decDeflateFileReader::SetPositionEnd(int position){
+	SetPosition(pLength - position);
+}
+
+
+
+// Reading
+////////////
+
+void decDeflateFileReader::Read(void *buffer, int size){
+	DEASSERT_NOTNULL(buffer)
+	DEASSERT_TRUE(size >= 0)
+	DEASSERT_TRUE(size <= pLength - pPosition)
+	
+	pInflate((uint8_t*)buffer, size);
+}
+
+decBaseFileReader::Ref decDeflateFileReader::Duplicate(){
+	const decDeflateFileReader::Ref reader(decDeflateFileReader::Ref::New(pReader->Duplicate(),
+		pFilename, pModificationTime, pOffset, pCompressedLength, pLength, pSeekIndex));
+	reader->SetPosition(pPosition);
+	return reader;
+}
+
+
+
+// Private Functions
+//////////////////////
+
+void decDeflateFileReader::pRestart(const decDeflateSeekIndex::cCheckpoint *checkpoint){
+	z_stream &zstream = *((z_stream*)pZStream);
+	
+	if(inflateReset(&zstream) != Z_OK){
+		DETHROW_INFO(deeReadFile, pFilename);
+	}
+	zstream.next_in = nullptr;
+	zstream.avail_in = 0;
+	
+	if(!checkpoint){
+		pPositionIn = 0;
+		pPosition = 0;
+		pWindowPosition = 0;
+		pWindowFill = 0;
+		
+		if(!pMappedData){
+			pReader->SetPosition(pOffset);
+		}
+		
+	}else{
+		// if the checkpoint is located in the middle of a byte the remaining bits
+		// of the previous byte belong to the next block and have to be primed
+		const int bits = checkpoint->GetBits();
+		pPositionIn = checkpoint->GetPositionIn() - (bits ? 1 : 0);
+		if(!pMappedData){
+			pReader->SetPosition(pOffset + pPositionIn);
+		}
+		
+		if(bits){
+			pFillInput();
+			const int value = *zstream.next_in;
+			zstream.next_in++;
+			zstream.avail_in--;
+			
+			if(inflatePrime(&zstream, bits, value >> (8 - bits)) != Z_OK){
+				DETHROW_INFO(deeReadFile, pFilename);
+			}
+		}
+		
+		const int windowSize = checkpoint->GetWindowSize();
+		if(windowSize > 0 && inflateSetDictionary(&zstream,
+		(const Bytef*)checkpoint->GetWindow(), windowSize) != Z_OK){
+			DETHROW_INFO(deeReadFile, pFilename);
+		}
+		
+		memcpy(pWindow, checkpoint->GetWindow(), windowSize);
+		pWindowPosition = windowSize % decDeflateSeekIndex::WindowSize;
+		pWindowFill = windowSize;
+		pPosition = checkpoint->GetPositionOut();
+	}
+}
+
+void decDeflateFileReader::pFillInput(){
+	z_stream &zstream = *((z_stream*)pZStream);
+	
+	const int remaining = pCompressedLength - pPositionIn;
+	if(remaining <= 0){
+		DETHROW_INFO(deeReadFile, pFilename);
+	}
+	
+	if(pMappedData){
+		zstream.next_in = (Bytef*)(pMappedData + pPositionIn);
+		zstream.avail_in = (uInt)remaining;
+		pPositionIn = pCompressedLength;
+		
+	}else{
+		const int readSize = decMath::min(remaining, pBufferIn.GetCount());
+		pReader->Read(pBufferIn.GetArrayPointer(), readSize);
+		zstream.next_in = (Bytef*)pBufferIn.GetArrayPointer();
+		zstream.avail_in = (uInt)readSize;
+		pPositionIn += readSize;
+	}
+}
+
+void decDeflateFileReader::pInflate(uint8_t *buffer, int size){
+	z_stream &zstream = *((z_stream*)pZStream);
+	
+	while(size > 0){
+		// inflate can have buffered input bits left even if all input has been consumed
+		if(zstream.avail_in == 0 && pPositionIn < pCompressedLength){
+			pFillInput();
+		}
+		
+		// inflate into the window. the window always contains the last uncompressed data
+		// which is required to create checkpoints
+		const int chunk = decMath::min(size, decDeflateSeekIndex::WindowSize - pWindowPosition);
+		zstream.next_out = (Bytef*)(pWindow + pWindowPosition);
+		zstream.avail_out = (uInt)chunk;
+		
+		const int result = inflate(&zstream, Z_BLOCK);
+		if(result != Z_OK && result != Z_STREAM_END){
+			DETHROW_INFO(deeReadFile, pFilename);
+		}
+		
+		const int produced = chunk - (int)zstream.avail_out;
+		if(buffer){
+			memcpy(buffer, pWindow + pWindowPosition, produced);
+			buffer += produced;
+		}
+		
+		pWindowPosition = (pWindowPosition + produced) % decDeflateSeekIndex::WindowSize;
+		pWindowFill = decMath::min(pWindowFill + produced, decDeflateSeekIndex::WindowSize);
+		pPosition += produced;
+		size -= produced;
+		
+		if(result == Z_STREAM_END){
+			if(size > 0){
+				DETHROW_INFO(deeReadFile, pFilename);
+			}
+			break;
+		}
+		
+		// inflate stops at the end of each block. add checkpoint if required unless
+		// this is the last block
+		if(pSeekIndex && (zstream.data_type & 128) && !(zstream.data_type & 64)
+		&& pSeekIndex->NeedsCheckpoint(pPosition)){
+			const int positionIn = pPositionIn - (int)zstream.avail_in;
+			const int bits = zstream.data_type & 7;
+			
+			if(pWindowFill < decDeflateSeekIndex::WindowSize){
+				pSeekIndex->AddCheckpoint(pPosition, positionIn, bits,
+					pWindow, pWindowFill, nullptr, 0);
+				
+			}else{
+				pSeekIndex->AddCheckpoint(pPosition, positionIn, bits,
+					pWindow + pWindowPosition, decDeflateSeekIndex::WindowSize - pWindowPosition,
+					pWindow, pWindowPosition);
+			}
+		}
+	}
+}
@@ -0,0 +1,169 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DECDEFLATEFILEREADER_H_
+#define _DECDEFLATEFILEREADER_H_
+
+#include "decBaseFileReader.h"
+#include "decDeflateSeekIndex.h"
+#include "../collection/decTList.h"
+
+
+/**
+ * \brief Random access reader for raw deflate compressed data.
+ * \version 1.34
+ * 
+ * Reads raw deflate compressed data without zlib header like it is stored in zip
+ * archives. The compressed data is located in a range of another file reader. The
+ * uncompressed length has to be known in advance.
+ * 
+ * Without seek index seeking backwards restarts decompressing at the beginning of the
+ * data. With seek index seeking resumes decompressing at the closest checkpoint before
+ * the target position. The seek index is activated the first time the reader seeks
+ * backwards. Afterwards all readers sharing the index add checkpoints while reading.
+ * 
+ * If the source reader is a \ref decMappedFileReader compressed data is inflated
+ * straight from the mapped memory.
+ */
+class DE_DLL_EXPORT decDeflateFileReader : public decBaseFileReader{
+public:
+	/** \brief Type holding strong reference. */
+	using Ref = deTObjectReference<decDeflateFileReader>;
+	
+	
+private:
+	decBaseFileReader::Ref pReader;
+	decString pFilename;
+	TIME_SYSTEM pModificationTime;
+	int pOffset;
+	int pCompressedLength;
+	int pLength;
+	decDeflateSeekIndex::Ref pSeekIndex;
+	
+	void *pZStream;
+	const uint8_t *pMappedData;
+	decTList<uint8_t> pBufferIn;
+	int pPositionIn;
+	int pPosition;
+	
+	uint8_t pWindow[decDeflateSeekIndex::WindowSize];
+	int pWindowPosition;
+	int pWindowFill;
+	
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/**
+	 * \brief Create reader.
+	 * \param[in] reader Reader containing compressed data. Reader is exclusively used
+	 *                   by this reader. Use Duplicate() to pass a shared reader.
+	 * \param[in] filename Name of file reported by the reader.
+	 * \param[in] modificationTime Modification time reported by the reader.
+	 * \param[in] offset Offset in bytes of compressed data in \em reader.
+	 * \param[in] compressedLength Length in bytes of compressed data.
+	 * \param[in] length Length in bytes of uncompressed data.
+	 * \param[in] seekIndex Seek index to use or nullptr.
+	 * \throws deeInvalidParam \em reader or \em filename is nullptr.
+	 * \throws deeInvalidParam Compressed data is not located inside \em reader.
+	 */
+	decDeflateFileReader(decBaseFileReader *reader, const char *filename,
+		TIME_SYSTEM modificationTime, int offset, int compressedLength, int length,
+		decDeflateSeekIndex *seekIndex = nullptr);
+	
+protected:
+	/**
+	 * \brief Clean up deflate file reader.
+	 * \note Subclasses should set their destructor protected too to avoid users
+	 * accidently deleting a reference counted object through the object
+	 * pointer. Only FreeReference() is allowed to delete the object.
+	 */
+	~decDeflateFileReader() override;
+	/*@}*/
+	
+	
+	
+public:
+	/** \name Management */
+	/*@{*/
+	/** \brief Seek index or nullptr. */
+	inline const decDeflateSeekIndex::Ref &GetSeekIndex() const{ return pSeekIndex; }
+	
+	
+	
+	/** \brief Name of the file. */
+	const char *GetFilename() override;
+	
+	/** \brief Length of the file. */
+	int GetLength() override;
+	
+	/** \brief Modification time. */
+	TIME_SYSTEM GetModificationTime() override;
+	
+	/** \brief Current reading position in the file. */
+	int GetPosition() override;
+	
+	/**
+	 * \brief Set file position for the next read action.
+	 * \throws deeInvalidParam \em position is less than 0 or larger than GetLength().
+	 * \throws deeReadFile Error decompressing data.
+	 */
+	void SetPosition(int position) override;
+	
+	/**
+	 * \brief Move file position by the given offset.
+	 * \throws deeInvalidParam GetPosition() + \em offset is less than 0 or larger than GetLength().
+	 * \throws deeReadFile Error decompressing data.
+	 */
+	void MovePosition(int offset) override;
+	
+	/**
+	 * \brief Set file position to the given position measured from the end of the file.
+	 * \throws deeInvalidParam \em position is less than 0 or larger than GetLength().
+	 * \throws deeReadFile Error decompressing data.
+	 */
+	void SetPositionEnd(int position) override;
+	
+	/**
+	 * \brief Read \em size bytes into \em buffer and advances the file pointer.
+	 * \throws deeInvalidParam \em buffer is nullptr.
+	 * \throws deeInvalidParam GetPosition() + \em size is larger than GetLength().
+	 * \throws deeReadFile Error decompressing data.
+	 */
+	void Read(void *buffer, int size) override;
+	
+	/** \brief Duplicate file reader sharing seek index. */
+	decBaseFileReader::Ref Duplicate() override;
+	/*@}*/
+	
+	
+	
+private:
+	void pRestart(const decDeflateSeekIndex::cCheckpoint *checkpoint);
+	void pFillInput();
+	void pInflate(uint8_t *buffer, int size);
+};
+
+#endif
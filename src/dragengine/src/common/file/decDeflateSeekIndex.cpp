@@ -0,0 +1,125 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "decDeflateSeekIndex.h"
+#include "../exceptions.h"
+#include "../../threading/deMutexGuard.h"
+
+
+
+// Class decDeflateSeekIndex::cCheckpoint
+///////////////////////////////////////////
+
+decDeflateSeekIndex::cCheckpoint::cCheckpoint(int positionOut, int positionIn, int bits,
+const uint8_t *window1, int windowSize1, const uint8_t *window2, int windowSize2) :
+pPositionOut(positionOut),
+pPositionIn(positionIn),
+pBits(bits),
+pWindowSize(windowSize1 + windowSize2)
+{
+	DEASSERT_TRUE(positionOut >= 0)
+	DEASSERT_TRUE(positionIn >= 0)
+	DEASSERT_TRUE(bits >= 0 && bits < 8)
+	DEASSERT_TRUE(windowSize1 >= 0)
+	DEASSERT_TRUE(windowSize2 >= 0)
+	DEASSERT_TRUE(pWindowSize <= WindowSize)
+	
+	if(windowSize1 > 0){
+		memcpy(pWindow, window1, windowSize1);
+	}
+	if(windowSize2 > 0){
+		memcpy(pWindow + windowSize1, window2, windowSize2);
+	}
+}
+
+
+
+// Class decDeflateSeekIndex
+//////////////////////////////
+
+// Constructor, destructor
+////////////////////////////
+
+decDeflateSeekIndex::decDeflateSeekIndex() :
+pSpan(DefaultSpan),
+pActive(false),
+pNextPosition(DefaultSpan){
+}
+
+decDeflateSeekIndex::decDeflateSeekIndex(int span) :
+pSpan(span),
+pActive(false),
+pNextPosition(span)
+{
+	DEASSERT_TRUE(span >= WindowSize)
+}
+
+decDeflateSeekIndex::~decDeflateSeekIndex(){
+}
+
+
+
+// Management
+///////////////
+
+void decDeflateSeekIndex::Activate(){
+	pActive = true;
+}
+
+int decDeflateSeekIndex::GetCheckpointCount() const{
+	const deMutexGuard guard(pMutex);
+	return pCheckpoints.GetCount();
+}
+
+const decDeflateSeekIndex::cCheckpoint *decDeflateSeekIndex::FindCheckpoint(int position) const{
+	const deMutexGuard guard(pMutex);
+	
+	// binary search for last checkpoint with output position less than or equal to position
+	int first = 0, last = pCheckpoints.GetCount();
+	while(first < last){
+		const int middle = (first + last) / 2;
+		if(pCheckpoints.GetAt(middle)->GetPositionOut() <= position){
+			first = middle + 1;
+			
+		}else{
+			last = middle;
+		}
+	}
+	
+	return first > 0 ? pCheckpoints.GetAt(first - 1).Pointer() : nullptr;
+}
+
+void decDeflateSeekIndex::AddCheckpoint(int positionOut, int positionIn, int bits,
+const uint8_t *window1, int windowSize1, const uint8_t *window2, int windowSize2){
+	const deMutexGuard guard(pMutex);
+	if(!NeedsCheckpoint(positionOut)){
+		return;
+	}
+	
+	pCheckpoints.Add(deTUniqueReference<cCheckpoint>::New(positionOut, positionIn,
+		bits, window1, windowSize1, window2, windowSize2));
+	pNextPosition = positionOut + pSpan;
+}
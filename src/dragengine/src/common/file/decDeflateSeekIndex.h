@@ -0,0 +1,181 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DECDEFLATESEEKINDEX_H_
+#define _DECDEFLATESEEKINDEX_H_
+
+#include <atomic>
+
+#include "../collection/decTUniqueList.h"
+#include "../../deObject.h"
+#include "../../threading/deMutex.h"
+
+
+/**
+ * \brief Seek index for raw deflate compressed data.
+ * \version 1.34
+ * 
+ * Stores inflate checkpoints at deflate block boundaries roughly every span bytes of
+ * uncompressed data. Each checkpoint stores the position in the compressed and
+ * uncompressed data and a snapshot of the last 32KB of uncompressed data. Inflating
+ * can be resumed at any checkpoint. Seeking thus decompresses at most one span of data.
+ * 
+ * The index is shared by all \ref decDeflateFileReader reading the same compressed data.
+ * Readers add checkpoints while decompressing once the index is activated. Indices are
+ * activated by readers the first time they seek backwards. This way memory is only
+ * spent on data actually requiring random access.
+ * 
+ * Checkpoints are never removed. Checkpoints returned by the index stay valid for the
+ * lifetime of the index. Index is thread safe.
+ */
+class DE_DLL_EXPORT decDeflateSeekIndex : public deObject{
+public:
+	/** \brief Type holding strong reference. */
+	using Ref = deTObjectReference<decDeflateSeekIndex>;
+	
+	/** \brief Size in bytes of inflate window. */
+	static const int WindowSize = 32768;
+	
+	/** \brief Default span in bytes between checkpoints. */
+	static const int DefaultSpan = 262144;
+	
+	/** \brief Inflate checkpoint. */
+	class DE_DLL_EXPORT cCheckpoint{
+	private:
+		int pPositionOut;
+		int pPositionIn;
+		int pBits;
+		int pWindowSize;
+		uint8_t pWindow[WindowSize];
+		
+	public:
+		/**
+		 * \brief Create checkpoint.
+		 * 
+		 * Window is made up of two parts to support circular buffers. Combined size
+		 * of the parts is at most \ref WindowSize.
+		 */
+		cCheckpoint(int positionOut, int positionIn, int bits, const uint8_t *window1,
+			int windowSize1, const uint8_t *window2, int windowSize2);
+		
+		/** \brief Position in uncompressed data. */
+		inline int GetPositionOut() const{ return pPositionOut; }
+		
+		/**
+		 * \brief Position in compressed data.
+		 * 
+		 * If \ref GetBits is not 0 the byte before this position contains the
+		 * first bits of the next deflate block.
+		 */
+		inline int GetPositionIn() const{ return pPositionIn; }
+		
+		/** \brief Count of bits of byte before compressed position belonging to next block. */
+		inline int GetBits() const{ return pBits; }
+		
+		/** \brief Size of window in bytes. */
+		inline int GetWindowSize() const{ return pWindowSize; }
+		
+		/** \brief Window with last uncompressed data before checkpoint. */
+		inline const uint8_t *GetWindow() const{ return pWindow; }
+	};
+	
+	
+	
+private:
+	const int pSpan;
+	std::atomic<bool> pActive;
+	decTUniqueList<cCheckpoint> pCheckpoints;
+	std::atomic<int> pNextPosition;
+	mutable deMutex pMutex;
+	
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/** \brief Create seek index with default span. */
+	decDeflateSeekIndex();
+	
+	/**
+	 * \brief Create seek index.
+	 * \throws deeInvalidParam \em span is less than \ref WindowSize.
+	 */
+	explicit decDeflateSeekIndex(int span);
+	
+protected:
+	/**
+	 * \brief Clean up seek index.
+	 * \note Subclasses should set their destructor protected too to avoid users
+	 * accidently deleting a reference counted object through the object
+	 * pointer. Only FreeReference() is allowed to delete the object.
+	 */
+	~decDeflateSeekIndex() override;
+	/*@}*/
+	
+	
+	
+public:
+	/** \name Management */
+	/*@{*/
+	/** \brief Span in bytes between checkpoints. */
+	inline int GetSpan() const{ return pSpan; }
+	
+	/** \brief Index is active and readers add checkpoints. */
+	inline bool GetActive() const{ return pActive; }
+	
+	/** \brief Activate index. */
+	void Activate();
+	
+	/** \brief Count of checkpoints. */
+	int GetCheckpointCount() const;
+	
+	/**
+	 * \brief Last checkpoint located at or before uncompressed position or nullptr.
+	 * 
+	 * If nullptr is returned inflating has to start at the beginning of the data.
+	 */
+	const cCheckpoint *FindCheckpoint(int position) const;
+	
+	/**
+	 * \brief Checkpoint is required at uncompressed position.
+	 * 
+	 * True if the index is active and \em position is at least one span past the
+	 * last checkpoint.
+	 */
+	inline bool NeedsCheckpoint(int position) const{
+		return pActive && position >= pNextPosition;
+	}
+	
+	/**
+	 * \brief Add checkpoint if required.
+	 * 
+	 * Checkpoint is ignored if \ref NeedsCheckpoint returns false for the position.
+	 * This can happen if multiple readers add the same checkpoint concurrently.
+	 */
+	void AddCheckpoint(int positionOut, int positionIn, int bits, const uint8_t *window1,
+		int windowSize1, const uint8_t *window2, int windowSize2);
+	/*@}*/
+};
+
+#endif
@@ -127,6 +127,10 @@ void decDiskFileWriter::Write(const void *buffer, int size){
 	}
 }
 
+void decDiskFileWriter::Flush(){
+	fflush(pFile);
+}
+
 decBaseFileWriter::Ref decDiskFileWriter::Duplicate(){
 	const decDiskFileWriter::Ref writer(decDiskFileWriter::Ref::New(pFilename, true));
 	if(fseek(writer->pFile, ftell(pFile), SEEK_SET)){
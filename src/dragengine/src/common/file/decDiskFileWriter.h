@@ -98,6 +98,12 @@ public:
 	 */
 	void Write(const void *buffer, int size) override;
 	
+	/**
+	 * \brief Flush buffered data to the file.
+	 * \version 1.34
+	 */
+	void Flush() override;
+	
 	/** \brief Duplicate file writer. */
 	decBaseFileWriter::Ref Duplicate() override;
 	/*@}*/
@@ -0,0 +1,255 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "decLZ4Codec.h"
+#include "../exceptions.h"
+
+
+// Definitions
+////////////////
+
+#define HASH_BITS 12
+#define HASH_SIZE (1 << HASH_BITS)
+#define MIN_MATCH 4
+#define LAST_LITERALS 5
+#define MF_LIMIT 12
+#define MAX_OFFSET 65535
+#define RUN_MASK 15
+
+
+static inline uint32_t vRead32(const uint8_t *data){
+	uint32_t value;
+	memcpy(&value, data, 4);
+	return value;
+}
+
+static inline int vHash(uint32_t value){
+	return (int)((value * 2654435761u) >> (32 - HASH_BITS));
+}
+
+static uint8_t *vWriteLength(uint8_t *output, int length){
+	while(length >= 255){
+		*(output++) = 255;
+		length -= 255;
+	}
+	*(output++) = (uint8_t)length;
+	return output;
+}
+
+static uint8_t *vWriteLiterals(uint8_t *output, const uint8_t *literals, int count, uint8_t &token){
+	if(count >= RUN_MASK){
+		token = RUN_MASK << 4;
+		output = vWriteLength(output, count - RUN_MASK);
+		
+	}else{
+		token = (uint8_t)(count << 4);
+	}
+	
+	memcpy(output, literals, count);
+	return output + count;
+}
+
+static int vReadLength(const uint8_t *&input, const uint8_t *inputEnd, int length){
+	while(true){
+		if(input == inputEnd || length > decLZ4Codec::MaxBlockSize){
+			DETHROW(deeInvalidFormat);
+		}
+		
+		const int value = *(input++);
+		length += value;
+		if(value != 255){
+			return length;
+		}
+	}
+}
+
+
+
+// Class decLZ4Codec
+//////////////////////
+
+// Management
+///////////////
+
+int decLZ4Codec::CompressBound(int size){
+	DEASSERT_TRUE(size >= 0 && size <= MaxBlockSize)
+	return size + size / 255 + 16;
+}
+
+int decLZ4Codec::Compress(const void *source, int sourceSize, void *destination, int destinationSize){
+	DEASSERT_TRUE(destinationSize >= CompressBound(sourceSize))
+	DEASSERT_TRUE(sourceSize == 0 || source)
+	DEASSERT_NOTNULL(destination)
+	
+	const uint8_t * const input = (const uint8_t*)source;
+	uint8_t * const output = (uint8_t*)destination;
+	uint8_t *next = output;
+	int anchor = 0;
+	
+	if(sourceSize > MF_LIMIT){
+		// matches have to start at least MF_LIMIT bytes before the end and have to end
+		// at least LAST_LITERALS bytes before the end. the match finder stores the last
+		// position a 4 byte sequence hashed to. positions moving farther away from the
+		// last match are skipped faster to quickly pass over incompressible data
+		const int matchStartLimit = sourceSize - MF_LIMIT;
+		const int matchEndLimit = sourceSize - LAST_LITERALS;
+		int table[HASH_SIZE];
+		int position = 0;
+		
+		memset(table, 0xff, sizeof(table));
+		
+		while(position <= matchStartLimit){
+			const uint32_t sequence = vRead32(input + position);
+			const int hash = vHash(sequence);
+			int reference = table[hash];
+			table[hash] = position;
+			
+			if(reference == -1 || position - reference > MAX_OFFSET
+			|| vRead32(input + reference) != sequence){
+				position += 1 + ((position - anchor) >> 6);
+				continue;
+			}
+			
+			while(position > anchor && reference > 0 && input[position - 1] == input[reference - 1]){
+				position--;
+				reference--;
+			}
+			
+			int length = MIN_MATCH;
+			while(position + length < matchEndLimit && input[reference + length] == input[position + length]){
+				length++;
+			}
+			
+			// write sequence
+			uint8_t * const token = next++;
+			next = vWriteLiterals(next, input + anchor, position - anchor, *token);
+			
+			const int offset = position - reference;
+			*(next++) = (uint8_t)(offset & 0xff);
+			*(next++) = (uint8_t)(offset >> 8);
+			
+			const int matchCode = length - MIN_MATCH;
+			if(matchCode >= RUN_MASK){
+				*token |= RUN_MASK;
+				next = vWriteLength(next, matchCode - RUN_MASK);
+				
+			}else{
+				*token |= (uint8_t)matchCode;
+			}
+			
+			position += length;
+			anchor = position;
+			
+			// hash a position inside the match to improve finding the next match
+			if(position <= matchStartLimit){
+				table[vHash(vRead32(input + position - 2))] = position - 2;
+			}
+		}
+	}
+	
+	// last sequence contains only literals
+	uint8_t * const token = next++;
+	next = vWriteLiterals(next, input + anchor, sourceSize - anchor, *token);
+	
+	return (int)(next - output);
+}
+
+void decLZ4Codec::Decompress(const void *source, int sourceSize, void *destination, int destinationSize){
+	DEASSERT_TRUE(sourceSize >= 0)
+	DEASSERT_TRUE(destinationSize >= 0)
+	DEASSERT_TRUE(sourceSize == 0 || source)
+	DEASSERT_TRUE(destinationSize == 0 || destination)
+	
+	const uint8_t *input = (const uint8_t*)source;
+	const uint8_t * const inputEnd = input + sourceSize;
+	uint8_t * const output = (uint8_t*)destination;
+	uint8_t * const outputEnd = output + destinationSize;
+	uint8_t *next = output;
+	
+	while(true){
+		if(input == inputEnd){
+			DETHROW(deeInvalidFormat);
+		}
+		
+		const int token = *(input++);
+		
+		// literals
+		int count = token >> 4;
+		if(count == RUN_MASK){
+			count = vReadLength(input, inputEnd, count);
+		}
+		
+		if(count > inputEnd - input || count > outputEnd - next){
+			DETHROW(deeInvalidFormat);
+		}
+		
+		memcpy(next, input, count);
+		input += count;
+		next += count;
+		
+		if(input == inputEnd){
+			break; // last sequence
+		}
+		
+		// match
+		if(inputEnd - input < 2){
+			DETHROW(deeInvalidFormat);
+		}
+		
+		const int offset = input[0] | (input[1] << 8);
+		input += 2;
+		
+		if(offset == 0 || offset > next - output){
+			DETHROW(deeInvalidFormat);
+		}
+		
+		count = token & RUN_MASK;
+		if(count == RUN_MASK){
+			count = vReadLength(input, inputEnd, count);
+		}
+		count += MIN_MATCH;
+		
+		if(count > outputEnd - next){
+			DETHROW(deeInvalidFormat);
+		}
+		
+		const uint8_t *match = next - offset;
+		if(offset >= count){
+			memcpy(next, match, count);
+			next += count;
+			
+		}else{
+			// overlapping match repeats the last offset bytes
+			while(count-- > 0){
+				*(next++) = *(match++);
+			}
+		}
+	}
+	
+	if(next != outputEnd){
+		DETHROW(deeInvalidFormat);
+	}
+}
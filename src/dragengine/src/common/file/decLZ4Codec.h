@@ -0,0 +1,86 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DECLZ4CODEC_H_
+#define _DECLZ4CODEC_H_
+
+#include <stdint.h>
+
+#include "../../dragengine_export.h"
+
+
+/**
+ * \brief Fast block compression using the LZ4 block format.
+ * \version 1.34
+ * 
+ * Compresses and decompresses single memory blocks. Compression uses a greedy single
+ * pass matcher with a small hash table trading compression ratio for speed. Decompression is
+ * a simple copy loop running at memory bandwidth speed. Output is compatible with the
+ * LZ4 block format (not the LZ4 frame format). Block headers storing the block sizes
+ * have to be handled by the user.
+ * 
+ * Intended for data read often and decompressed under time pressure like caches.
+ * Use zlib for data where compression ratio matters more than speed.
+ */
+class DE_DLL_EXPORT decLZ4Codec{
+public:
+	/** \brief Maximum size of blocks in bytes. */
+	static const int MaxBlockSize = 0x7e000000;
+	
+	
+	
+	/** \name Management */
+	/*@{*/
+	/**
+	 * \brief Maximum size in bytes of compressed data for block of size.
+	 * \throws deeInvalidParam \em size is less than 0 or larger than \ref MaxBlockSize.
+	 */
+	static int CompressBound(int size);
+	
+	/**
+	 * \brief Compress block.
+	 * \param[in] source Data to compress.
+	 * \param[in] sourceSize Size in bytes of data to compress.
+	 * \param[out] destination Buffer to write compressed data to.
+	 * \param[in] destinationSize Size in bytes of destination. Has to be at least
+	 *                            CompressBound(sourceSize) bytes.
+	 * \returns Size in bytes of compressed data.
+	 * \throws deeInvalidParam \em destinationSize is less than CompressBound(sourceSize).
+	 */
+	static int Compress(const void *source, int sourceSize, void *destination, int destinationSize);
+	
+	/**
+	 * \brief Decompress block.
+	 * \param[in] source Compressed data.
+	 * \param[in] sourceSize Size in bytes of compressed data.
+	 * \param[out] destination Buffer to write decompressed data to.
+	 * \param[in] destinationSize Size in bytes of decompressed data.
+	 * \throws deeInvalidFormat Compressed data is corrupt or does not decompress to
+	 *                          exactly \em destinationSize bytes.
+	 */
+	static void Decompress(const void *source, int sourceSize, void *destination, int destinationSize);
+	/*@}*/
+};
+
+#endif
@@ -0,0 +1,164 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "decMappedFile.h"
+#include "../exceptions.h"
+
+#ifdef OS_W32
+#include "../../app/deOSWindows.h"
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+
+
+// Class decMappedFile
+////////////////////////
+
+// Constructor, Destructor
+////////////////////////////
+
+decMappedFile::decMappedFile(const char *filename) :
+pData(nullptr),
+pLength(0),
+pModificationTime(0)
+#ifdef OS_W32
+,pHandleMapping(nullptr)
+#endif
+{
+	DEASSERT_NOTNULL(filename)
+	
+	pFilename = filename;
+	
+#ifdef OS_W32
+	wchar_t widePath[MAX_PATH];
+	deOSWindows::Utf8ToWide(filename, widePath, MAX_PATH);
+	
+	const HANDLE handleFile = CreateFileW(widePath, GENERIC_READ, FILE_SHARE_READ,
+		NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if(handleFile == INVALID_HANDLE_VALUE){
+		DETHROW_INFO(deeFileNotFound, filename);
+	}
+	
+	try{
+		LARGE_INTEGER size;
+		FILETIME writeTime;
+		if(!GetFileSizeEx(handleFile, &size) || !GetFileTime(handleFile, NULL, NULL, &writeTime)){
+			DETHROW_INFO(deeReadFile, filename);
+		}
+		pLength = (uint64_t)size.QuadPart;
+		
+		SYSTEMTIME stime;
+		if(!FileTimeToSystemTime(&writeTime, &stime)){
+			DETHROW_INFO(deeReadFile, filename);
+		}
+		
+		decDateTime modTime;
+		modTime.SetYear(stime.wYear);
+		modTime.SetMonth(stime.wMonth - 1);
+		modTime.SetDay(stime.wDay - 1);
+		modTime.SetHour(stime.wHour);
+		modTime.SetMinute(stime.wMinute);
+		modTime.SetSecond(stime.wSecond);
+		pModificationTime = modTime.ToSystemTime();
+		
+		if(pLength > 0){
+			pHandleMapping = CreateFileMappingW(handleFile, NULL, PAGE_READONLY, 0, 0, NULL);
+			if(!pHandleMapping){
+				DETHROW_INFO(deeReadFile, filename);
+			}
+			
+			pData = (const uint8_t*)MapViewOfFile(pHandleMapping, FILE_MAP_READ, 0, 0, 0);
+			if(!pData){
+				DETHROW_INFO(deeReadFile, filename);
+			}
+		}
+		
+		CloseHandle(handleFile);
+		
+	}catch(const deException &){
+		CloseHandle(handleFile);
+		pCleanUp();
+		throw;
+	}
+	
+#else
+	const int fd = open(filename, O_RDONLY);
+	if(fd == -1){
+		DETHROW_INFO(deeFileNotFound, filename);
+	}
+	
+	struct stat st;
+	if(fstat(fd, &st) != 0){
+		close(fd);
+		DETHROW_INFO(deeReadFile, filename);
+	}
+	
+	pLength = (uint64_t)st.st_size;
+	pModificationTime = (TIME_SYSTEM)st.st_mtime;
+	
+	if(pLength > 0){
+		void * const data = mmap(nullptr, (size_t)pLength, PROT_READ, MAP_PRIVATE, fd, 0);
+		if(data == MAP_FAILED){
+			close(fd);
+			DETHROW_INFO(deeReadFile, filename);
+		}
+		pData = (const uint8_t*)data;
+	}
+	
+	// the mapping stays valid after closing the file descriptor
+	close(fd);
+#endif
+}
+
+decMappedFile::~decMappedFile(){
+	pCleanUp();
+}
+
+
+
+// Private Functions
+//////////////////////
+
+void decMappedFile::pCleanUp(){
+#ifdef OS_W32
+	if(pData){
+		UnmapViewOfFile(pData);
+		pData = nullptr;
+	}
+	if(pHandleMapping){
+		CloseHandle(pHandleMapping);
+		pHandleMapping = nullptr;
+	}
+	
+#else
+	if(pData){
+		munmap((void*)pData, (size_t)pLength);
+		pData = nullptr;
+	}
+#endif
+}
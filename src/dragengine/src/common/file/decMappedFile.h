@@ -0,0 +1,108 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DECMAPPEDFILE_H_
+#define _DECMAPPEDFILE_H_
+
+#include <stdint.h>
+
+#include "../string/decString.h"
+#include "../utils/decDateTime.h"
+#include "../../deObject.h"
+#include "../../dragengine_configuration.h"
+
+
+/**
+ * \brief Read-only memory mapped disk file.
+ * \version 1.34
+ * 
+ * Maps the entire content of a disk file into memory. The mapping stays valid as long
+ * as the object exists. Use \ref decMappedFileReader to read from the mapped file
+ * without copying the data into an intermediate buffer.
+ */
+class DE_DLL_EXPORT decMappedFile : public deObject{
+public:
+	/** \brief Type holding strong reference. */
+	using Ref = deTObjectReference<decMappedFile>;
+	
+	
+private:
+	decString pFilename;
+	const uint8_t *pData;
+	uint64_t pLength;
+	TIME_SYSTEM pModificationTime;
+	
+#ifdef OS_W32
+	void *pHandleMapping;
+#endif
+	
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/**
+	 * \brief Map disk file.
+	 * \param[in] filename Native path of file to map.
+	 * \throws deeInvalidParam \em filename is nullptr.
+	 * \throws deeFileNotFound File does not exist.
+	 * \throws deeReadFile File can not be mapped.
+	 */
+	decMappedFile(const char *filename);
+	
+protected:
+	/**
+	 * \brief Unmap disk file.
+	 * \note Subclasses should set their destructor protected too to avoid users
+	 * accidently deleting a reference counted object through the object
+	 * pointer. Only FreeReference() is allowed to delete the object.
+	 */
+	~decMappedFile() override;
+	/*@}*/
+	
+	
+	
+public:
+	/** \name Management */
+	/*@{*/
+	/** \brief Native path of mapped file. */
+	inline const decString &GetFilename() const{ return pFilename; }
+	
+	/** \brief Pointer to mapped data or nullptr if file is empty. */
+	inline const uint8_t *GetPointer() const{ return pData; }
+	
+	/** \brief Length of mapped data in bytes. */
+	inline uint64_t GetLength() const{ return pLength; }
+	
+	/** \brief Modification time. */
+	inline TIME_SYSTEM GetModificationTime() const{ return pModificationTime; }
+	/*@}*/
+	
+	
+	
+private:
+	void pCleanUp();
+};
+
+#endif
@@ -0,0 +1,149 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "decMappedFileReader.h"
+#include "../exceptions.h"
+
+
+
+// Class decMappedFileReader
+//////////////////////////////
+
+// Constructor, Destructor
+////////////////////////////
+
+decMappedFileReader::decMappedFileReader(decMappedFile *file) :
+pFile(file),
+pModificationTime(0),
+pData(nullptr),
+pLength(0),
+pPosition(0)
+{
+	DEASSERT_NOTNULL(file)
+	DEASSERT_TRUE(file->GetLength() <= 0x7fffffff)
+	
+	pFilename = file->GetFilename();
+	pModificationTime = file->GetModificationTime();
+	pData = file->GetPointer();
+	pLength = (int)file->GetLength();
+}
+
+decMappedFileReader::decMappedFileReader(decMappedFile *file, const char *filename,
+TIME_SYSTEM modificationTime, uint64_t offset, int length) :
+pFile(file),
+pModificationTime(modificationTime),
+pData(nullptr),
+pLength(length),
+pPosition(0)
+{
+	DEASSERT_NOTNULL(file)
+	DEASSERT_NOTNULL(filename)
+	DEASSERT_TRUE(length >= 0)
+	DEASSERT_TRUE(offset <= file->GetLength())
+	DEASSERT_TRUE((uint64_t)length <= file->GetLength() - offset)
+	
+	pFilename = filename;
+	if(file->GetPointer()){
+		pData = file->GetPointer() + offset;
+	}
+}
+
+decMappedFileReader::decMappedFileReader(const decMappedFileReader &reader) :
+pFile(reader.pFile),
+pFilename(reader.pFilename),
+pModificationTime(reader.pModificationTime),
+pData(reader.pData),
+pLength(reader.pLength),
+pPosition(reader.pPosition){
+}
+
+decMappedFileReader::~decMappedFileReader(){
+}
+
+
+
+// Management
+///////////////
+
+const char *decMappedFileReader::GetFilename(){
+	return pFilename;
+}
+
+int decMappedFileReader::GetLength(){
+	return pLength;
+}
+
+TIME_SYSTEM decMappedFileReader::GetModificationTime(){
+	return pModificationTime;
+}
+
+
+
+// Seeking
+////////////
+
+int decMappedFileReader::GetPosition(){
+	return pPosition;
+}
+
+void decMappedFileReader::SetPosition(int position){
+	if(position < 0 || position > pLength){
+		DETHROW(deeOutOfBoundary);
+	}
+	pPosition = position;
+}
+
+void decMappedFileReader::MovePosition(int offset){
+	SetPosition(pPosition + offset);
+}
+
+void decMappedFileReader::SetPositionEnd(int position){
+	if(position < 0 || position > pLength){
+		DETHROW(deeOutOfBoundary);
+	}
+	pPosition = pLength - position;
+}
+
+
+
+// Reading
+////////////
+
+void decMappedFileReader::Read(void *buffer, int size){
+	DEASSERT_NOTNULL(buffer)
+	if(size < 0 || size > pLength - pPosition){
+		DETHROW(deeInvalidParam);
+	}
+	
+	if(size > 0){
+		memcpy(buffer, pData + pPosition, size);
+		pPosition += size;
+	}
+}
+
+decBaseFileReader::Ref decMappedFileReader::Duplicate(){
+	return decMappedFileReader::Ref::New(*this);
+}
@@ -0,0 +1,156 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DECMAPPEDFILEREADER_H_
+#define _DECMAPPEDFILEREADER_H_
+
+#include "decBaseFileReader.h"
+#include "decMappedFile.h"
+
+
+/**
+ * \brief Zero-copy reader for a range of a memory mapped file.
+ * \version 1.34
+ * 
+ * Reads data straight from the mapped memory. The mapped file is held by the reader
+ * keeping the mapping valid while the reader exists. Users able to process data in
+ * place, for example image and video decoders, can use \ref GetData to access the
+ * data without copying it.
+ */
+class DE_DLL_EXPORT decMappedFileReader : public decBaseFileReader{
+public:
+	/** \brief Type holding strong reference. */
+	using Ref = deTObjectReference<decMappedFileReader>;
+	
+	
+private:
+	decMappedFile::Ref pFile;
+	decString pFilename;
+	TIME_SYSTEM pModificationTime;
+	const uint8_t *pData;
+	int pLength;
+	int pPosition;
+	
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/**
+	 * \brief Create reader for entire mapped file.
+	 * \throws deeInvalidParam \em file is nullptr.
+	 * \throws deeInvalidParam Mapped file is too large to be read.
+	 */
+	decMappedFileReader(decMappedFile *file);
+	
+	/**
+	 * \brief Create reader for range of mapped file.
+	 * \param[in] file Mapped file.
+	 * \param[in] filename Name of file reported by the reader.
+	 * \param[in] modificationTime Modification time reported by the reader.
+	 * \param[in] offset Offset in bytes of the range in the mapped file.
+	 * \param[in] length Length in bytes of the range.
+	 * \throws deeInvalidParam \em file or \em filename is nullptr.
+	 * \throws deeInvalidParam Range is not located inside the mapped file.
+	 */
+	decMappedFileReader(decMappedFile *file, const char *filename,
+		TIME_SYSTEM modificationTime, uint64_t offset, int length);
+	
+	/** \brief Create reader with same mapped file range and position. */
+	decMappedFileReader(const decMappedFileReader &reader);
+	
+protected:
+	/**
+	 * \brief Clean up mapped file reader.
+	 * \note Subclasses should set their destructor protected too to avoid users
+	 * accidently deleting a reference counted object through the object
+	 * pointer. Only FreeReference() is allowed to delete the object.
+	 */
+	~decMappedFileReader() override;
+	/*@}*/
+	
+	
+	
+public:
+	/** \name Management */
+	/*@{*/
+	/** \brief Mapped file. */
+	inline const decMappedFile::Ref &GetMappedFile() const{ return pFile; }
+	
+	/**
+	 * \brief Pointer to the first byte of the file data.
+	 * 
+	 * The pointer stays valid as long as the reader or the mapped file exists.
+	 * The data is read-only.
+	 */
+	inline const uint8_t *GetData() const{ return pData; }
+	
+	/** \brief Pointer to the file data at the current reading position. */
+	inline const uint8_t *GetDataAtPosition() const{ return pData + pPosition; }
+	
+	
+	
+	/** \brief Name of the file. */
+	const char *GetFilename() override;
+	
+	/** \brief Length of the file. */
+	int GetLength() override;
+	
+	/** \brief Modification time. */
+	TIME_SYSTEM GetModificationTime() override;
+	
+	/** \brief Current reading position in the file. */
+	int GetPosition() override;
+	
+	/**
+	 * \brief Set file position for the next read action.
+	 * \throws deeOutOfBoundary \em position is less than 0 or larger than GetLength().
+	 */
+	void SetPosition(int position) override;
+	
+	/**
+	 * \brief Move file position by the given offset.
+	 * \throws deeOutOfBoundary GetPosition() + \em offset is less than 0 or larger than GetLength().
+	 */
+	void MovePosition(int offset) override;
+	
+	/**
+	 * \brief Set file position to the given position measured from the end of the file.
+	 * \throws deeOutOfBoundary \em position is less than 0 or larger than GetLength().
+	 */
+	void SetPositionEnd(int position) override;
+	
+	/**
+	 * \brief Read \em size bytes into \em buffer and advances the file pointer.
+	 * \throws deeInvalidParam \em buffer is nullptr.
+	 * \throws deeInvalidParam GetPosition() + \em size is larger than GetLength().
+	 */
+	void Read(void *buffer, int size) override;
+	
+	/** \brief Duplicate file reader. */
+	decBaseFileReader::Ref Duplicate() override;
+	/*@}*/
+};
+
+#endif
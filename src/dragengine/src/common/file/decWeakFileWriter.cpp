@@ -84,6 +84,10 @@ void decWeakFileWriter::Write(const void *buffer, int size){
 	pWriter->Write(buffer, size);
 }
 
+void decWeakFileWriter::Flush(){
+	pWriter->Flush();
+}
+
 decBaseFileWriter::Ref decWeakFileWriter::Duplicate(){
 	return decWeakFileWriter::Ref::New(pWriter);
 }
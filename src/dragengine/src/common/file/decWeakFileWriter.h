@@ -109,6 +109,12 @@ public:
 	 */
 	void Write(const void *buffer, int size) override;
 	
+	/**
+	 * \brief Flush buffered data to the underlying file.
+	 * \version 1.34
+	 */
+	void Flush() override;
+	
 	/** \brief Duplicate file writer. */
 	decBaseFileWriter::Ref Duplicate() override;
 	/*@}*/
@@ -0,0 +1,595 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "decMath.h"
+#include "decMathBatch.h"
+#include "../exceptions.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define DEC_MATH_BATCH_SIMD
+	#define DEC_MATH_BATCH_SSE2
+	#include <emmintrin.h>
+	
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	#define DEC_MATH_BATCH_SIMD
+	#define DEC_MATH_BATCH_NEON
+	#include <arm_neon.h>
+#endif
+
+static_assert(sizeof(decVector) == sizeof(float) * 3, "decVector layout");
+static_assert(sizeof(decQuaternion) == sizeof(float) * 4, "decQuaternion layout");
+static_assert(sizeof(decMatrix) == sizeof(float) * 16, "decMatrix layout");
+
+
+
+// Slerp approximation
+////////////////////////
+
+#ifdef DEC_MATH_BATCH_SIMD
+
+// Polynomial slerp approximation based on D. Eberly, "A Fast and Accurate Algorithm for
+// Computing SLERP". Uses only multiplications and additions and is thus well suited for
+// SIMD. The series is truncated after 12 terms. The last term is scaled by a correction
+// factor minimizing the approximation error to below 1e-6 for factors in the range 0 to 1.
+#define SLERP_TERM_COUNT 12
+
+static const float vSlerpCorrection = 1.89372f;
+
+static const float vSlerpU[SLERP_TERM_COUNT] = {
+	1.0f / (1.0f * 3.0f), 1.0f / (2.0f * 5.0f), 1.0f / (3.0f * 7.0f), 1.0f / (4.0f * 9.0f),
+	1.0f / (5.0f * 11.0f), 1.0f / (6.0f * 13.0f), 1.0f / (7.0f * 15.0f), 1.0f / (8.0f * 17.0f),
+	1.0f / (9.0f * 19.0f), 1.0f / (10.0f * 21.0f), 1.0f / (11.0f * 23.0f),
+	vSlerpCorrection / (12.0f * 25.0f)};
+
+static const float vSlerpV[SLERP_TERM_COUNT] = {
+	1.0f / 3.0f, 2.0f / 5.0f, 3.0f / 7.0f, 4.0f / 9.0f,
+	5.0f / 11.0f, 6.0f / 13.0f, 7.0f / 15.0f, 8.0f / 17.0f,
+	9.0f / 19.0f, 10.0f / 21.0f, 11.0f / 23.0f,
+	vSlerpCorrection * 12.0f / 25.0f};
+
+static inline void slerpApprox(const decQuaternion &from, const decQuaternion &to,
+float factor, decQuaternion &result){
+	float x = from.x * to.x + from.y * to.y + from.z * to.z + from.w * to.w;
+	float sign = 1.0f;
+	if(x < 0.0f){
+		x = -x;
+		sign = -1.0f;
+	}
+	
+	const float xm1 = x - 1.0f;
+	const float d = 1.0f - factor;
+	const float sqrT = factor * factor;
+	const float sqrD = d * d;
+	float cT = 1.0f, cD = 1.0f;
+	int i;
+	
+	for(i=SLERP_TERM_COUNT-1; i>=0; i--){
+		cT = 1.0f + (vSlerpU[i] * sqrT - vSlerpV[i]) * xm1 * cT;
+		cD = 1.0f + (vSlerpU[i] * sqrD - vSlerpV[i]) * xm1 * cD;
+	}
+	
+	cT *= sign * factor;
+	cD *= d;
+	
+	result.x = from.x * cD + to.x * cT;
+	result.y = from.y * cD + to.y * cT;
+	result.z = from.z * cD + to.z * cT;
+	result.w = from.w * cD + to.w * cT;
+}
+
+#endif
+
+
+
+// SIMD primitives
+////////////////////
+
+#ifdef DEC_MATH_BATCH_SSE2
+
+typedef __m128 simdVec;
+
+static inline simdVec simdLoad(const float *p){ return _mm_loadu_ps(p); }
+static inline void simdStore(float *p, simdVec v){ _mm_storeu_ps(p, v); }
+static inline simdVec simdSplat(float v){ return _mm_set1_ps(v); }
+static inline simdVec simdSet(float x, float y, float z, float w){ return _mm_setr_ps(x, y, z, w); }
+static inline simdVec simdAdd(simdVec a, simdVec b){ return _mm_add_ps(a, b); }
+static inline simdVec simdSub(simdVec a, simdVec b){ return _mm_sub_ps(a, b); }
+static inline simdVec simdMul(simdVec a, simdVec b){ return _mm_mul_ps(a, b); }
+static inline simdVec simdDiv(simdVec a, simdVec b){ return _mm_div_ps(a, b); }
+static inline simdVec simdSqrt(simdVec v){ return _mm_sqrt_ps(v); }
+static inline simdVec simdSignBits(simdVec v){ return _mm_and_ps(v, _mm_set1_ps(-0.0f)); }
+static inline simdVec simdXor(simdVec a, simdVec b){ return _mm_xor_ps(a, b); }
+
+static inline bool simdAnyZero(simdVec v){
+	return _mm_movemask_ps(_mm_cmpeq_ps(v, _mm_setzero_ps())) != 0;
+}
+
+/** Load 4 interleaved xyzw elements as xxxx, yyyy, zzzz and wwww. */
+static inline void simdLoad4x4(const float *p, simdVec &x, simdVec &y, simdVec &z, simdVec &w){
+	x = _mm_loadu_ps(p);
+	y = _mm_loadu_ps(p + 4);
+	z = _mm_loadu_ps(p + 8);
+	w = _mm_loadu_ps(p + 12);
+	_MM_TRANSPOSE4_PS(x, y, z, w);
+}
+
+/** Store xxxx, yyyy, zzzz and wwww as 4 interleaved xyzw elements. */
+static inline void simdStore4x4(float *p, simdVec x, simdVec y, simdVec z, simdVec w){
+	_MM_TRANSPOSE4_PS(x, y, z, w);
+	_mm_storeu_ps(p, x);
+	_mm_storeu_ps(p + 4, y);
+	_mm_storeu_ps(p + 8, z);
+	_mm_storeu_ps(p + 12, w);
+}
+
+/** Load 4 interleaved xyz elements as xxxx, yyyy and zzzz. */
+static inline void simdLoad3x4(const float *p, simdVec &x, simdVec &y, simdVec &z){
+	const __m128 a = _mm_loadu_ps(p); // x0 y0 z0 x1
+	const __m128 b = _mm_loadu_ps(p + 4); // y1 z1 x2 y2
+	const __m128 c = _mm_loadu_ps(p + 8); // z2 x3 y3 z3
+	
+	x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+	y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)),
+		_mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+	z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), c, _MM_SHUFFLE(3, 0, 2, 0));
+}
+
+/** Store xxxx, yyyy and zzzz as 4 interleaved xyz elements. */
+static inline void simdStore3x4(float *p, simdVec x, simdVec y, simdVec z){
+	_mm_storeu_ps(p, _mm_shuffle_ps(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)),
+		_mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)));
+	_mm_storeu_ps(p + 4, _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)),
+		_mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0)));
+	_mm_storeu_ps(p + 8, _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)),
+		_mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+}
+
+#elif defined(DEC_MATH_BATCH_NEON)
+
+typedef float32x4_t simdVec;
+
+static inline simdVec simdLoad(const float *p){ return vld1q_f32(p); }
+static inline void simdStore(float *p, simdVec v){ vst1q_f32(p, v); }
+static inline simdVec simdSplat(float v){ return vdupq_n_f32(v); }
+static inline simdVec simdAdd(simdVec a, simdVec b){ return vaddq_f32(a, b); }
+static inline simdVec simdSub(simdVec a, simdVec b){ return vsubq_f32(a, b); }
+static inline simdVec simdMul(simdVec a, simdVec b){ return vmulq_f32(a, b); }
+static inline simdVec simdDiv(simdVec a, simdVec b){ return vdivq_f32(a, b); }
+static inline simdVec simdSqrt(simdVec v){ return vsqrtq_f32(v); }
+
+static inline simdVec simdSet(float x, float y, float z, float w){
+	const float values[4] = {x, y, z, w};
+	return vld1q_f32(values);
+}
+
+static inline simdVec simdSignBits(simdVec v){
+	return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(v), vdupq_n_u32(0x80000000)));
+}
+
+static inline simdVec simdXor(simdVec a, simdVec b){
+	return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b)));
+}
+
+static inline bool simdAnyZero(simdVec v){
+	return vmaxvq_u32(vceqq_f32(v, vdupq_n_f32(0.0f))) != 0;
+}
+
+static inline void simdLoad4x4(const float *p, simdVec &x, simdVec &y, simdVec &z, simdVec &w){
+	const float32x4x4_t v = vld4q_f32(p);
+	x = v.val[0];
+	y = v.val[1];
+	z = v.val[2];
+	w = v.val[3];
+}
+
+static inline void simdStore4x4(float *p, simdVec x, simdVec y, simdVec z, simdVec w){
+	float32x4x4_t v;
+	v.val[0] = x;
+	v.val[1] = y;
+	v.val[2] = z;
+	v.val[3] = w;
+	vst4q_f32(p, v);
+}
+
+static inline void simdLoad3x4(const float *p, simdVec &x, simdVec &y, simdVec &z){
+	const float32x4x3_t v = vld3q_f32(p);
+	x = v.val[0];
+	y = v.val[1];
+	z = v.val[2];
+}
+
+static inline void simdStore3x4(float *p, simdVec x, simdVec y, simdVec z){
+	float32x4x3_t v;
+	v.val[0] = x;
+	v.val[1] = y;
+	v.val[2] = z;
+	vst3q_f32(p, v);
+}
+
+#endif
+
+#ifdef DEC_MATH_BATCH_SIMD
+
+/** Linear combination of matrix rows a1 to a4 using the factors from row. */
+static inline simdVec simdCombineRows(const float *row,
+simdVec a1, simdVec a2, simdVec a3, simdVec a4){
+	return simdAdd(simdAdd(simdAdd(
+		simdMul(simdSplat(row[0]), a1),
+		simdMul(simdSplat(row[1]), a2)),
+		simdMul(simdSplat(row[2]), a3)),
+		simdMul(simdSplat(row[3]), a4));
+}
+
+/** Linear combination of affine matrix rows a1 to a3 using the factors from row. */
+static inline simdVec simdCombineRowsAffine(const float *row, simdVec a1, simdVec a2, simdVec a3){
+	return simdAdd(simdAdd(simdAdd(
+		simdMul(simdSplat(row[0]), a1),
+		simdMul(simdSplat(row[1]), a2)),
+		simdMul(simdSplat(row[2]), a3)),
+		simdSet(0.0f, 0.0f, 0.0f, row[3]));
+}
+
+static void simdSlerp(const decQuaternion *from, const decQuaternion *to,
+const float *factors, int factorStride, decQuaternion *result, int count){
+	const simdVec one = simdSplat(1.0f);
+	int i, j;
+	
+	for(i=0; i+4<=count; i+=4){
+		simdVec fx, fy, fz, fw, tx, ty, tz, tw;
+		simdLoad4x4(&from[i].x, fx, fy, fz, fw);
+		simdLoad4x4(&to[i].x, tx, ty, tz, tw);
+		
+		const simdVec factor = factorStride == 0 ? simdSplat(factors[0]) : simdLoad(factors + i);
+		
+		const simdVec dot = simdAdd(simdAdd(simdAdd(simdMul(fx, tx), simdMul(fy, ty)),
+			simdMul(fz, tz)), simdMul(fw, tw));
+		const simdVec sign = simdSignBits(dot);
+		const simdVec xm1 = simdSub(simdXor(dot, sign), one);
+		const simdVec d = simdSub(one, factor);
+		const simdVec sqrT = simdMul(factor, factor);
+		const simdVec sqrD = simdMul(d, d);
+		simdVec cT = one, cD = one;
+		
+		for(j=SLERP_TERM_COUNT-1; j>=0; j--){
+			const simdVec u = simdSplat(vSlerpU[j]);
+			const simdVec v = simdSplat(vSlerpV[j]);
+			cT = simdAdd(one, simdMul(simdMul(simdSub(simdMul(u, sqrT), v), xm1), cT));
+			cD = simdAdd(one, simdMul(simdMul(simdSub(simdMul(u, sqrD), v), xm1), cD));
+		}
+		
+		cT = simdXor(simdMul(cT, factor), sign);
+		cD = simdMul(cD, d);
+		
+		simdStore4x4(&result[i].x,
+			simdAdd(simdMul(fx, cD), simdMul(tx, cT)),
+			simdAdd(simdMul(fy, cD), simdMul(ty, cT)),
+			simdAdd(simdMul(fz, cD), simdMul(tz, cT)),
+			simdAdd(simdMul(fw, cD), simdMul(tw, cT)));
+	}
+	
+	for(; i<count; i++){
+		slerpApprox(from[i], to[i], factors[i * factorStride], result[i]);
+	}
+}
+
+#endif
+
+
+
+// Class decMathBatch::Scalar
+///////////////////////////////
+
+void decMathBatch::Scalar::Multiply(const decMatrix *a, const decMatrix *b, decMatrix *result, int count){
+	int i;
+	for(i=0; i<count; i++){
+		result[i] = a[i] * b[i];
+	}
+}
+
+void decMathBatch::Scalar::QuickMultiply(const decMatrix *a, const decMatrix *b, decMatrix *result, int count){
+	int i;
+	for(i=0; i<count; i++){
+		result[i] = a[i].QuickMultiply(b[i]);
+	}
+}
+
+void decMathBatch::Scalar::QuickMultiply(const decMatrix *a, const decMatrix &b, decMatrix *result, int count){
+	int i;
+	for(i=0; i<count; i++){
+		result[i] = a[i].QuickMultiply(b);
+	}
+}
+
+void decMathBatch::Scalar::Transform(const decMatrix &matrix, const decVector *points, decVector *result, int count){
+	int i;
+	for(i=0; i<count; i++){
+		result[i] = matrix * points[i];
+	}
+}
+
+void decMathBatch::Scalar::TransformNormal(const decMatrix &matrix, const decVector *normals, decVector *result, int count){
+	int i;
+	for(i=0; i<count; i++){
+		result[i] = matrix.TransformNormal(normals[i]);
+	}
+}
+
+void decMathBatch::Scalar::Normalize(decQuaternion *quaternions, int count){
+	int i;
+	for(i=0; i<count; i++){
+		quaternions[i].Normalize();
+	}
+}
+
+void decMathBatch::Scalar::Slerp(const decQuaternion *from, const decQuaternion *to,
+float factor, decQuaternion *result, int count){
+	int i;
+	for(i=0; i<count; i++){
+		result[i] = from[i].Slerp(to[i], factor);
+	}
+}
+
+void decMathBatch::Scalar::Slerp(const decQuaternion *from, const decQuaternion *to,
+const float *factors, decQuaternion *result, int count){
+	int i;
+	for(i=0; i<count; i++){
+		result[i] = from[i].Slerp(to[i], factors[i]);
+	}
+}
+
+
+
+// Class decMathBatch
+///////////////////////
+
+// Information
+////////////////
+
+decMathBatch::eImplementations decMathBatch::GetImplementation(){
+#ifdef DEC_MATH_BATCH_SSE2
+	return eiSSE2;
+#elif defined(DEC_MATH_BATCH_NEON)
+	return eiNEON;
+#else
+	return eiScalar;
+#endif
+}
+
+const char *decMathBatch::GetImplementationName(){
+	switch(GetImplementation()){
+	case eiSSE2:
+		return "SSE2";
+		
+	case eiNEON:
+		return "NEON";
+		
+	default:
+		return "Scalar";
+	}
+}
+
+
+
+// Matrices
+/////////////
+
+void decMathBatch::Multiply(const decMatrix *a, const decMatrix *b, decMatrix *result, int count){
+#ifdef DEC_MATH_BATCH_SIMD
+	int i;
+	for(i=0; i<count; i++){
+		const float * const fa = &a[i].a11;
+		const float * const fb = &b[i].a11;
+		float * const fr = &result[i].a11;
+		
+		const simdVec a1 = simdLoad(fa);
+		const simdVec a2 = simdLoad(fa + 4);
+		const simdVec a3 = simdLoad(fa + 8);
+		const simdVec a4 = simdLoad(fa + 12);
+		
+		const simdVec r1 = simdCombineRows(fb, a1, a2, a3, a4);
+		const simdVec r2 = simdCombineRows(fb + 4, a1, a2, a3, a4);
+		const simdVec r3 = simdCombineRows(fb + 8, a1, a2, a3, a4);
+		const simdVec r4 = simdCombineRows(fb + 12, a1, a2, a3, a4);
+		
+		simdStore(fr, r1);
+		simdStore(fr + 4, r2);
+		simdStore(fr + 8, r3);
+		simdStore(fr + 12, r4);
+	}
+	
+#else
+	Scalar::Multiply(a, b, result, count);
+#endif
+}
+
+void decMathBatch::QuickMultiply(const decMatrix *a, const decMatrix *b, decMatrix *result, int count){
+#ifdef DEC_MATH_BATCH_SIMD
+	const simdVec r4 = simdSet(0.0f, 0.0f, 0.0f, 1.0f);
+	int i;
+	
+	for(i=0; i<count; i++){
+		const float * const fa = &a[i].a11;
+		const float * const fb = &b[i].a11;
+		float * const fr = &result[i].a11;
+		
+		const simdVec a1 = simdLoad(fa);
+		const simdVec a2 = simdLoad(fa + 4);
+		const simdVec a3 = simdLoad(fa + 8);
+		
+		const simdVec r1 = simdCombineRowsAffine(fb, a1, a2, a3);
+		const simdVec r2 = simdCombineRowsAffine(fb + 4, a1, a2, a3);
+		const simdVec r3 = simdCombineRowsAffine(fb + 8, a1, a2, a3);
+		
+		simdStore(fr, r1);
+		simdStore(fr + 4, r2);
+		simdStore(fr + 8, r3);
+		simdStore(fr + 12, r4);
+	}
+	
+#else
+	Scalar::QuickMultiply(a, b, result, count);
+#endif
+}
+
+void decMathBatch::QuickMultiply(const decMatrix *a, const decMatrix &b, decMatrix *result, int count){
+#ifdef DEC_MATH_BATCH_SIMD
+	const simdVec b11 = simdSplat(b.a11), b12 = simdSplat(b.a12), b13 = simdSplat(b.a13);
+	const simdVec b21 = simdSplat(b.a21), b22 = simdSplat(b.a22), b23 = simdSplat(b.a23);
+	const simdVec b31 = simdSplat(b.a31), b32 = simdSplat(b.a32), b33 = simdSplat(b.a33);
+	const simdVec t1 = simdSet(0.0f, 0.0f, 0.0f, b.a14);
+	const simdVec t2 = simdSet(0.0f, 0.0f, 0.0f, b.a24);
+	const simdVec t3 = simdSet(0.0f, 0.0f, 0.0f, b.a34);
+	const simdVec r4 = simdSet(0.0f, 0.0f, 0.0f, 1.0f);
+	int i;
+	
+	for(i=0; i<count; i++){
+		const float * const fa = &a[i].a11;
+		float * const fr = &result[i].a11;
+		
+		const simdVec a1 = simdLoad(fa);
+		const simdVec a2 = simdLoad(fa + 4);
+		const simdVec a3 = simdLoad(fa + 8);
+		
+		simdStore(fr, simdAdd(simdAdd(simdAdd(simdMul(b11, a1), simdMul(b12, a2)), simdMul(b13, a3)), t1));
+		simdStore(fr + 4, simdAdd(simdAdd(simdAdd(simdMul(b21, a1), simdMul(b22, a2)), simdMul(b23, a3)), t2));
+		simdStore(fr + 8, simdAdd(simdAdd(simdAdd(simdMul(b31, a1), simdMul(b32, a2)), simdMul(b33, a3)), t3));
+		simdStore(fr + 12, r4);
+	}
+	
+#else
+	Scalar::QuickMultiply(a, b, result, count);
+#endif
+}
+
+
+
+// Vectors
+////////////
+
+void decMathBatch::Transform(const decMatrix &matrix, const decVector *points, decVector *result, int count){
+#ifdef DEC_MATH_BATCH_SIMD
+	const simdVec m11 = simdSplat(matrix.a11), m12 = simdSplat(matrix.a12);
+	const simdVec m13 = simdSplat(matrix.a13), m14 = simdSplat(matrix.a14);
+	const simdVec m21 = simdSplat(matrix.a21), m22 = simdSplat(matrix.a22);
+	const simdVec m23 = simdSplat(matrix.a23), m24 = simdSplat(matrix.a24);
+	const simdVec m31 = simdSplat(matrix.a31), m32 = simdSplat(matrix.a32);
+	const simdVec m33 = simdSplat(matrix.a33), m34 = simdSplat(matrix.a34);
+	int i;
+	
+	for(i=0; i+4<=count; i+=4){
+		simdVec x, y, z;
+		simdLoad3x4(&points[i].x, x, y, z);
+		
+		simdStore3x4(&result[i].x,
+			simdAdd(simdAdd(simdAdd(simdMul(m11, x), simdMul(m12, y)), simdMul(m13, z)), m14),
+			simdAdd(simdAdd(simdAdd(simdMul(m21, x), simdMul(m22, y)), simdMul(m23, z)), m24),
+			simdAdd(simdAdd(simdAdd(simdMul(m31, x), simdMul(m32, y)), simdMul(m33, z)), m34));
+	}
+	
+	for(; i<count; i++){
+		result[i] = matrix * points[i];
+	}
+	
+#else
+	Scalar::Transform(matrix, points, result, count);
+#endif
+}
+
+void decMathBatch::TransformNormal(const decMatrix &matrix, const decVector *normals, decVector *result, int count){
+#ifdef DEC_MATH_BATCH_SIMD
+	const simdVec m11 = simdSplat(matrix.a11), m12 = simdSplat(matrix.a12), m13 = simdSplat(matrix.a13);
+	const simdVec m21 = simdSplat(matrix.a21), m22 = simdSplat(matrix.a22), m23 = simdSplat(matrix.a23);
+	const simdVec m31 = simdSplat(matrix.a31), m32 = simdSplat(matrix.a32), m33 = simdSplat(matrix.a33);
+	int i;
+	
+	for(i=0; i+4<=count; i+=4){
+		simdVec x, y, z;
+		simdLoad3x4(&normals[i].x, x, y, z);
+		
+		simdStore3x4(&result[i].x,
+			simdAdd(simdAdd(simdMul(m11, x), simdMul(m12, y)), simdMul(m13, z)),
+			simdAdd(simdAdd(simdMul(m21, x), simdMul(m22, y)), simdMul(m23, z)),
+			simdAdd(simdAdd(simdMul(m31, x), simdMul(m32, y)), simdMul(m33, z)));
+	}
+	
+	for(; i<count; i++){
+		result[i] = matrix.TransformNormal(normals[i]);
+	}
+	
+#else
+	Scalar::TransformNormal(matrix, normals, result, count);
+#endif
+}
+
+
+
+// Quaternions
+////////////////
+
+void decMathBatch::Normalize(decQuaternion *quaternions, int count){
+#ifdef DEC_MATH_BATCH_SIMD
+	const simdVec one = simdSplat(1.0f);
+	int i;
+	
+	for(i=0; i+4<=count; i+=4){
+		simdVec x, y, z, w;
+		simdLoad4x4(&quaternions[i].x, x, y, z, w);
+		
+		const simdVec squaredLength = simdAdd(simdAdd(simdAdd(
+			simdMul(x, x), simdMul(y, y)), simdMul(z, z)), simdMul(w, w));
+		if(simdAnyZero(squaredLength)){
+			DETHROW(deeDivisionByZero);
+		}
+		
+		const simdVec invLength = simdDiv(one, simdSqrt(squaredLength));
+		simdStore4x4(&quaternions[i].x, simdMul(x, invLength),
+			simdMul(y, invLength), simdMul(z, invLength), simdMul(w, invLength));
+	}
+	
+	for(; i<count; i++){
+		quaternions[i].Normalize();
+	}
+	
+#else
+	Scalar::Normalize(quaternions, count);
+#endif
+}
+
+void decMathBatch::Slerp(const decQuaternion *from, const decQuaternion *to,
+float factor, decQuaternion *result, int count){
+#ifdef DEC_MATH_BATCH_SIMD
+	simdSlerp(from, to, &factor, 0, result, count);
+#else
+	Scalar::Slerp(from, to, factor, result, count);
+#endif
+}
+
+void decMathBatch::Slerp(const decQuaternion *from, const decQuaternion *to,
+const float *factors, decQuaternion *result, int count){
+#ifdef DEC_MATH_BATCH_SIMD
+	simdSlerp(from, to, factors, 1, result, count);
+#else
+	Scalar::Slerp(from, to, factors, result, count);
+#endif
+}
@@ -0,0 +1,174 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DECMATHBATCH_H_
+#define _DECMATHBATCH_H_
+
+#include "../../dragengine_export.h"
+
+class decVector;
+class decMatrix;
+class decQuaternion;
+
+
+/**
+ * \brief Batch math operations on arrays of matrices, vectors and quaternions.
+ * 
+ * Uses SIMD instructions if supported by the build target. SSE2 is used on x86-64 and
+ * NEON on 64-bit ARM. All other targets use the scalar implementation. The implementation
+ * is chosen at build time. The scalar implementation is always available as reference
+ * using the nested Scalar class.
+ * 
+ * Results match the matching decMatrix and decQuaternion operations up to floating point
+ * rounding. Slerp() is the exception. The SIMD implementation uses a polynomial
+ * approximation with an error below 1e-6 per component. decQuaternion::Slerp() uses linear
+ * interpolation for nearly identical quaternions. Results can differ by up to 1e-4 there.
+ * 
+ * Result arrays can be the same as source arrays. Partially overlapping arrays are
+ * not supported.
+ * 
+ * \version 1.34
+ */
+class DE_DLL_EXPORT decMathBatch{
+public:
+	/** \brief Implementation. */
+	enum eImplementations{
+		/** \brief Scalar implementation. */
+		eiScalar,
+		
+		/** \brief SSE2 implementation. */
+		eiSSE2,
+		
+		/** \brief NEON implementation. */
+		eiNEON
+	};
+	
+	
+	
+	/**
+	 * \brief Scalar reference implementation.
+	 * 
+	 * Same functions as decMathBatch but always using the scalar implementation.
+	 */
+	class DE_DLL_EXPORT Scalar{
+	public:
+		static void Multiply(const decMatrix *a, const decMatrix *b, decMatrix *result, int count);
+		static void QuickMultiply(const decMatrix *a, const decMatrix *b, decMatrix *result, int count);
+		static void QuickMultiply(const decMatrix *a, const decMatrix &b, decMatrix *result, int count);
+		static void Transform(const decMatrix &matrix, const decVector *points, decVector *result, int count);
+		static void TransformNormal(const decMatrix &matrix, const decVector *normals, decVector *result, int count);
+		static void Normalize(decQuaternion *quaternions, int count);
+		static void Slerp(const decQuaternion *from, const decQuaternion *to,
+			float factor, decQuaternion *result, int count);
+		static void Slerp(const decQuaternion *from, const decQuaternion *to,
+			const float *factors, decQuaternion *result, int count);
+	};
+	
+	
+	
+	/** \name Information */
+	/*@{*/
+	/** \brief Implementation used by this build. */
+	static eImplementations GetImplementation();
+	
+	/** \brief Name of implementation used by this build. */
+	static const char *GetImplementationName();
+	/*@}*/
+	
+	
+	
+	/** \name Matrices */
+	/*@{*/
+	/**
+	 * \brief Multiply matrices.
+	 * 
+	 * Sets result[i] to a[i] * b[i]. Same as decMatrix::operator*(const decMatrix&).
+	 */
+	static void Multiply(const decMatrix *a, const decMatrix *b, decMatrix *result, int count);
+	
+	/**
+	 * \brief Multiply affine matrices.
+	 * 
+	 * Sets result[i] to a[i].QuickMultiply(b[i]).
+	 */
+	static void QuickMultiply(const decMatrix *a, const decMatrix *b, decMatrix *result, int count);
+	
+	/**
+	 * \brief Multiply affine matrices with the same matrix.
+	 * 
+	 * Sets result[i] to a[i].QuickMultiply(b).
+	 */
+	static void QuickMultiply(const decMatrix *a, const decMatrix &b, decMatrix *result, int count);
+	/*@}*/
+	
+	
+	
+	/** \name Vectors */
+	/*@{*/
+	/**
+	 * \brief Transform points.
+	 * 
+	 * Sets result[i] to matrix * points[i].
+	 */
+	static void Transform(const decMatrix &matrix, const decVector *points, decVector *result, int count);
+	
+	/**
+	 * \brief Transform normals.
+	 * 
+	 * Sets result[i] to matrix.TransformNormal(normals[i]).
+	 */
+	static void TransformNormal(const decMatrix &matrix, const decVector *normals, decVector *result, int count);
+	/*@}*/
+	
+	
+	
+	/** \name Quaternions */
+	/*@{*/
+	/**
+	 * \brief Normalize quaternions in place.
+	 * \throws deeDivisionByZero A quaternion has zero length.
+	 */
+	static void Normalize(decQuaternion *quaternions, int count);
+	
+	/**
+	 * \brief Spherical linear interpolation of quaternions using the same factor.
+	 * 
+	 * Sets result[i] to from[i].Slerp(to[i], factor). Factor has to be in the range from
+	 * 0 to 1 and quaternions have to be normalized.
+	 */
+	static void Slerp(const decQuaternion *from, const decQuaternion *to,
+		float factor, decQuaternion *result, int count);
+	
+	/**
+	 * \brief Spherical linear interpolation of quaternions using individual factors.
+	 * 
+	 * Sets result[i] to from[i].Slerp(to[i], factors[i]). Factors have to be in the range
+	 * from 0 to 1 and quaternions have to be normalized.
+	 */
+	static void Slerp(const decQuaternion *from, const decQuaternion *to,
+		const float *factors, decQuaternion *result, int count);
+	/*@}*/
+};
+
+#endif
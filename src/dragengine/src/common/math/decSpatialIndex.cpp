@@ -0,0 +1,1205 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <math.h>
+#include <algorithm>
+
+#include "decSpatialIndex.h"
+#include "../exceptions.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define DEC_SPATIAL_INDEX_SSE2
+	#include <emmintrin.h>
+	
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	#define DEC_SPATIAL_INDEX_NEON
+	#include <arm_neon.h>
+#endif
+
+
+// Node tests
+///////////////
+
+// the fourth lane of the node boxes contains the child indices. these lanes are ignored
+// by all tests. inverse direction components of rays parallel to an axis are clamped to
+// a large value instead of infinity. this avoids NaN results and keeps the tests exact
+
+namespace{
+
+static const float cRayParallelThreshold = 1e-20f;
+static const float cRayParallelInverse = 1e20f;
+
+inline float fRayInverse(float direction){
+	if(direction > cRayParallelThreshold || direction < -cRayParallelThreshold){
+		return 1.0f / direction;
+	}
+	return direction < 0.0f ? -cRayParallelInverse : cRayParallelInverse;
+}
+
+inline float fToFloatDown(double value){
+	float result = (float)value;
+	if((double)result > value){
+		result = nextafterf(result, -HUGE_VALF);
+	}
+	return result;
+}
+
+inline float fToFloatUp(double value){
+	float result = (float)value;
+	if((double)result < value){
+		result = nextafterf(result, HUGE_VALF);
+	}
+	return result;
+}
+
+inline decVector fToVectorDown(const decDVector &vector){
+	return decVector(fToFloatDown(vector.x), fToFloatDown(vector.y), fToFloatDown(vector.z));
+}
+
+inline decVector fToVectorUp(const decDVector &vector){
+	return decVector(fToFloatUp(vector.x), fToFloatUp(vector.y), fToFloatUp(vector.z));
+}
+
+inline bool fBoxOverlaps(const decVector &minExtend1, const decVector &maxExtend1,
+const decVector &minExtend2, const decVector &maxExtend2){
+	return maxExtend1 >= minExtend2 && minExtend1 <= maxExtend2;
+}
+
+inline bool fRayHitsBox(const decVector &origin, const decVector &invDirection,
+const decVector &minExtend, const decVector &maxExtend){
+	const float x1 = (minExtend.x - origin.x) * invDirection.x;
+	const float x2 = (maxExtend.x - origin.x) * invDirection.x;
+	const float y1 = (minExtend.y - origin.y) * invDirection.y;
+	const float y2 = (maxExtend.y - origin.y) * invDirection.y;
+	const float z1 = (minExtend.z - origin.z) * invDirection.z;
+	const float z2 = (maxExtend.z - origin.z) * invDirection.z;
+	const float enter = decMath::max(decMath::max(0.0f, decMath::min(x1, x2)),
+		decMath::min(y1, y2), decMath::min(z1, z2));
+	const float leave = decMath::min(decMath::min(1.0f, decMath::max(x1, x2)),
+		decMath::max(y1, y2), decMath::max(z1, z2));
+	return enter <= leave;
+}
+
+inline bool fBoxOutsidePlanes(const decVector4 *planes, int planeCount,
+const decVector &minExtend, const decVector &maxExtend){
+	int i;
+	for(i=0; i<planeCount; i++){
+		const decVector4 &p = planes[i];
+		if(decMath::max(p.x * minExtend.x, p.x * maxExtend.x)
+		+ decMath::max(p.y * minExtend.y, p.y * maxExtend.y)
+		+ decMath::max(p.z * minExtend.z, p.z * maxExtend.z) + p.w < 0.0f){
+			return true;
+		}
+	}
+	return false;
+}
+
+enum eClassify{
+	ecOutside,
+	ecIntersect,
+	ecInside
+};
+
+
+#ifdef DEC_SPATIAL_INDEX_SSE2
+
+inline bool fAllXYZ(__m128 mask){
+	return (_mm_movemask_ps(mask) & 7) == 7;
+}
+
+inline float fHorizontalMax(__m128 v){
+	const __m128 m = _mm_max_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2)));
+	return _mm_cvtss_f32(_mm_max_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1))));
+}
+
+inline float fHorizontalMin(__m128 v){
+	const __m128 m = _mm_min_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2)));
+	return _mm_cvtss_f32(_mm_min_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1))));
+}
+
+class cBoxTest{
+private:
+	const __m128 pMinExtend, pMaxExtend;
+	
+public:
+	cBoxTest(const decVector &minExtend, const decVector &maxExtend) :
+	pMinExtend(_mm_setr_ps(minExtend.x, minExtend.y, minExtend.z, 0.0f)),
+	pMaxExtend(_mm_setr_ps(maxExtend.x, maxExtend.y, maxExtend.z, 0.0f)){
+	}
+	
+	inline bool Overlaps(const decSpatialIndex::sNode &node) const{
+		return fAllXYZ(_mm_and_ps(_mm_cmpge_ps(_mm_load_ps(node.maxExtend), pMinExtend),
+			_mm_cmple_ps(_mm_load_ps(node.minExtend), pMaxExtend)));
+	}
+	
+	inline bool Contains(const decSpatialIndex::sNode &node) const{
+		return fAllXYZ(_mm_and_ps(_mm_cmpge_ps(_mm_load_ps(node.minExtend), pMinExtend),
+			_mm_cmple_ps(_mm_load_ps(node.maxExtend), pMaxExtend)));
+	}
+};
+
+class cRayTest{
+private:
+	const __m128 pOrigin, pInvDirection, pMaskXYZ, pLeaveW;
+	
+public:
+	cRayTest(const decVector &origin, const decVector &invDirection) :
+	pOrigin(_mm_setr_ps(origin.x, origin.y, origin.z, 0.0f)),
+	pInvDirection(_mm_setr_ps(invDirection.x, invDirection.y, invDirection.z, 0.0f)),
+	pMaskXYZ(_mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0))),
+	pLeaveW(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f)){
+	}
+	
+	inline bool Hits(const decSpatialIndex::sNode &node) const{
+		const __m128 t1 = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(node.minExtend), pOrigin), pInvDirection);
+		const __m128 t2 = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(node.maxExtend), pOrigin), pInvDirection);
+		
+		// lane w clamps the ray to the range from 0 to 1
+		const __m128 enter = _mm_and_ps(_mm_min_ps(t1, t2), pMaskXYZ);
+		const __m128 leave = _mm_or_ps(_mm_and_ps(_mm_max_ps(t1, t2), pMaskXYZ), pLeaveW);
+		return fHorizontalMax(enter) <= fHorizontalMin(leave);
+	}
+};
+
+class cPlanesTest{
+private:
+	struct sGroup{
+		__m128 x, y, z, w;
+	};
+	
+	sGroup pGroups[decSpatialIndex::MaxPlanes / 4];
+	int pGroupCount;
+	
+public:
+	cPlanesTest(const decVector4 *planes, int planeCount) :
+	pGroupCount((planeCount + 3) / 4){
+		int i, j;
+		for(i=0; i<pGroupCount; i++){
+			// missing planes are filled up with planes containing everything
+			float x[4] = {0.0f, 0.0f, 0.0f, 0.0f}, y[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+			float z[4] = {0.0f, 0.0f, 0.0f, 0.0f}, w[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+			for(j=0; j<4 && i * 4 + j < planeCount; j++){
+				const decVector4 &plane = planes[i * 4 + j];
+				x[j] = plane.x;
+				y[j] = plane.y;
+				z[j] = plane.z;
+				w[j] = plane.w;
+			}
+			pGroups[i].x = _mm_loadu_ps(x);
+			pGroups[i].y = _mm_loadu_ps(y);
+			pGroups[i].z = _mm_loadu_ps(z);
+			pGroups[i].w = _mm_loadu_ps(w);
+		}
+	}
+	
+	inline eClassify Classify(const decSpatialIndex::sNode &node) const{
+		const __m128 minX = _mm_set1_ps(node.minExtend[0]);
+		const __m128 minY = _mm_set1_ps(node.minExtend[1]);
+		const __m128 minZ = _mm_set1_ps(node.minExtend[2]);
+		const __m128 maxX = _mm_set1_ps(node.maxExtend[0]);
+		const __m128 maxY = _mm_set1_ps(node.maxExtend[1]);
+		const __m128 maxZ = _mm_set1_ps(node.maxExtend[2]);
+		const __m128 zero = _mm_setzero_ps();
+		int outside = 0, intersect = 0;
+		int i;
+		
+		for(i=0; i<pGroupCount; i++){
+			const sGroup &g = pGroups[i];
+			const __m128 x1 = _mm_mul_ps(g.x, minX), x2 = _mm_mul_ps(g.x, maxX);
+			const __m128 y1 = _mm_mul_ps(g.y, minY), y2 = _mm_mul_ps(g.y, maxY);
+			const __m128 z1 = _mm_mul_ps(g.z, minZ), z2 = _mm_mul_ps(g.z, maxZ);
+			
+			// distance of box corner farthest along the plane normal and nearest
+			const __m128 farthest = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_max_ps(x1, x2),
+				_mm_max_ps(y1, y2)), _mm_max_ps(z1, z2)), g.w);
+			const __m128 nearest = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_min_ps(x1, x2),
+				_mm_min_ps(y1, y2)), _mm_min_ps(z1, z2)), g.w);
+			
+			outside |= _mm_movemask_ps(_mm_cmplt_ps(farthest, zero));
+			intersect |= _mm_movemask_ps(_mm_cmplt_ps(nearest, zero));
+		}
+		
+		return outside ? ecOutside : (intersect ? ecIntersect : ecInside);
+	}
+};
+
+#elif defined(DEC_SPATIAL_INDEX_NEON)
+
+inline bool fAllXYZ(uint32x4_t mask){
+	return vminvq_u32(vsetq_lane_u32(0xffffffff, mask, 3)) != 0;
+}
+
+class cBoxTest{
+private:
+	float32x4_t pMinExtend, pMaxExtend;
+	
+public:
+	cBoxTest(const decVector &minExtend, const decVector &maxExtend){
+		const float minValues[4] = {minExtend.x, minExtend.y, minExtend.z, 0.0f};
+		const float maxValues[4] = {maxExtend.x, maxExtend.y, maxExtend.z, 0.0f};
+		pMinExtend = vld1q_f32(minValues);
+		pMaxExtend = vld1q_f32(maxValues);
+	}
+	
+	inline bool Overlaps(const decSpatialIndex::sNode &node) const{
+		return fAllXYZ(vandq_u32(vcgeq_f32(vld1q_f32(node.maxExtend), pMinExtend),
+			vcleq_f32(vld1q_f32(node.minExtend), pMaxExtend)));
+	}
+	
+	inline bool Contains(const decSpatialIndex::sNode &node) const{
+		return fAllXYZ(vandq_u32(vcgeq_f32(vld1q_f32(node.minExtend), pMinExtend),
+			vcleq_f32(vld1q_f32(node.maxExtend), pMaxExtend)));
+	}
+};
+
+class cRayTest{
+private:
+	float32x4_t pOrigin, pInvDirection;
+	
+public:
+	cRayTest(const decVector &origin, const decVector &invDirection){
+		const float originValues[4] = {origin.x, origin.y, origin.z, 0.0f};
+		const float invDirectionValues[4] = {invDirection.x, invDirection.y, invDirection.z, 0.0f};
+		pOrigin = vld1q_f32(originValues);
+		pInvDirection = vld1q_f32(invDirectionValues);
+	}
+	
+	inline bool Hits(const decSpatialIndex::sNode &node) const{
+		const float32x4_t t1 = vmulq_f32(vsubq_f32(vld1q_f32(node.minExtend), pOrigin), pInvDirection);
+		const float32x4_t t2 = vmulq_f32(vsubq_f32(vld1q_f32(node.maxExtend), pOrigin), pInvDirection);
+		
+		// lane w clamps the ray to the range from 0 to 1
+		const float32x4_t enter = vsetq_lane_f32(0.0f, vminq_f32(t1, t2), 3);
+		const float32x4_t leave = vsetq_lane_f32(1.0f, vmaxq_f32(t1, t2), 3);
+		return vmaxvq_f32(enter) <= vminvq_f32(leave);
+	}
+};
+
+class cPlanesTest{
+private:
+	struct sGroup{
+		float32x4_t x, y, z, w;
+	};
+	
+	sGroup pGroups[decSpatialIndex::MaxPlanes / 4];
+	int pGroupCount;
+	
+public:
+	cPlanesTest(const decVector4 *planes, int planeCount) :
+	pGroupCount((planeCount + 3) / 4){
+		int i, j;
+		for(i=0; i<pGroupCount; i++){
+			// missing planes are filled up with planes containing everything
+			float x[4] = {0.0f, 0.0f, 0.0f, 0.0f}, y[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+			float z[4] = {0.0f, 0.0f, 0.0f, 0.0f}, w[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+			for(j=0; j<4 && i * 4 + j < planeCount; j++){
+				const decVector4 &plane = planes[i * 4 + j];
+				x[j] = plane.x;
+				y[j] = plane.y;
+				z[j] = plane.z;
+				w[j] = plane.w;
+			}
+			pGroups[i].x = vld1q_f32(x);
+			pGroups[i].y = vld1q_f32(y);
+			pGroups[i].z = vld1q_f32(z);
+			pGroups[i].w = vld1q_f32(w);
+		}
+	}
+	
+	inline eClassify Classify(const decSpatialIndex::sNode &node) const{
+		const float32x4_t minX = vdupq_n_f32(node.minExtend[0]);
+		const float32x4_t minY = vdupq_n_f32(node.minExtend[1]);
+		const float32x4_t minZ = vdupq_n_f32(node.minExtend[2]);
+		const float32x4_t maxX = vdupq_n_f32(node.maxExtend[0]);
+		const float32x4_t maxY = vdupq_n_f32(node.maxExtend[1]);
+		const float32x4_t maxZ = vdupq_n_f32(node.maxExtend[2]);
+		const float32x4_t zero = vdupq_n_f32(0.0f);
+		uint32x4_t outside = vdupq_n_u32(0), intersect = vdupq_n_u32(0);
+		int i;
+		
+		for(i=0; i<pGroupCount; i++){
+			const sGroup &g = pGroups[i];
+			const float32x4_t x1 = vmulq_f32(g.x, minX), x2 = vmulq_f32(g.x, maxX);
+			const float32x4_t y1 = vmulq_f32(g.y, minY), y2 = vmulq_f32(g.y, maxY);
+			const float32x4_t z1 = vmulq_f32(g.z, minZ), z2 = vmulq_f32(g.z, maxZ);
+			
+			// distance of box corner farthest along the plane normal and nearest
+			const float32x4_t farthest = vaddq_f32(vaddq_f32(vaddq_f32(vmaxq_f32(x1, x2),
+				vmaxq_f32(y1, y2)), vmaxq_f32(z1, z2)), g.w);
+			const float32x4_t nearest = vaddq_f32(vaddq_f32(vaddq_f32(vminq_f32(x1, x2),
+				vminq_f32(y1, y2)), vminq_f32(z1, z2)), g.w);
+			
+			outside = vorrq_u32(outside, vcltq_f32(farthest, zero));
+			intersect = vorrq_u32(intersect, vcltq_f32(nearest, zero));
+		}
+		
+		return vmaxvq_u32(outside) ? ecOutside : (vmaxvq_u32(intersect) ? ecIntersect : ecInside);
+	}
+};
+
+#else
+
+class cBoxTest{
+private:
+	const decVector pMinExtend, pMaxExtend;
+	
+public:
+	cBoxTest(const decVector &minExtend, const decVector &maxExtend) :
+	pMinExtend(minExtend), pMaxExtend(maxExtend){
+	}
+	
+	inline bool Overlaps(const decSpatialIndex::sNode &node) const{
+		return node.maxExtend[0] >= pMinExtend.x && node.maxExtend[1] >= pMinExtend.y
+			&& node.maxExtend[2] >= pMinExtend.z && node.minExtend[0] <= pMaxExtend.x
+			&& node.minExtend[1] <= pMaxExtend.y && node.minExtend[2] <= pMaxExtend.z;
+	}
+	
+	inline bool Contains(const decSpatialIndex::sNode &node) const{
+		return node.minExtend[0] >= pMinExtend.x && node.minExtend[1] >= pMinExtend.y
+			&& node.minExtend[2] >= pMinExtend.z && node.maxExtend[0] <= pMaxExtend.x
+			&& node.maxExtend[1] <= pMaxExtend.y && node.maxExtend[2] <= pMaxExtend.z;
+	}
+};
+
+class cRayTest{
+private:
+	const decVector pOrigin, pInvDirection;
+	
+public:
+	cRayTest(const decVector &origin, const decVector &invDirection) :
+	pOrigin(origin), pInvDirection(invDirection){
+	}
+	
+	inline bool Hits(const decSpatialIndex::sNode &node) const{
+		return fRayHitsBox(pOrigin, pInvDirection,
+			decVector(node.minExtend[0], node.minExtend[1], node.minExtend[2]),
+			decVector(node.maxExtend[0], node.maxExtend[1], node.maxExtend[2]));
+	}
+};
+
+class cPlanesTest{
+private:
+	const decVector4 * const pPlanes;
+	const int pPlaneCount;
+	
+public:
+	cPlanesTest(const decVector4 *planes, int planeCount) :
+	pPlanes(planes), pPlaneCount(planeCount){
+	}
+	
+	inline eClassify Classify(const decSpatialIndex::sNode &node) const{
+		bool intersect = false;
+		int i;
+		
+		for(i=0; i<pPlaneCount; i++){
+			const decVector4 &p = pPlanes[i];
+			const float x1 = p.x * node.minExtend[0], x2 = p.x * node.maxExtend[0];
+			const float y1 = p.y * node.minExtend[1], y2 = p.y * node.maxExtend[1];
+			const float z1 = p.z * node.minExtend[2], z2 = p.z * node.maxExtend[2];
+			
+			if(decMath::max(x1, x2) + decMath::max(y1, y2) + decMath::max(z1, z2) + p.w < 0.0f){
+				return ecOutside;
+			}
+			if(decMath::min(x1, x2) + decMath::min(y1, y2) + decMath::min(z1, z2) + p.w < 0.0f){
+				intersect = true;
+			}
+		}
+		
+		return intersect ? ecIntersect : ecInside;
+	}
+};
+
+#endif
+
+}
+
+
+
+// Class decSpatialIndex
+//////////////////////////
+
+// Constructor, destructor
+////////////////////////////
+
+decSpatialIndex::decSpatialIndex() :
+pMargin(DefaultMargin),
+pRoot(-1){
+}
+
+decSpatialIndex::decSpatialIndex(float margin) :
+pMargin(DefaultMargin),
+pRoot(-1)
+{
+	SetMargin(margin);
+}
+
+decSpatialIndex::~decSpatialIndex(){
+}
+
+
+
+// Management
+///////////////
+
+void decSpatialIndex::SetMargin(float margin){
+	DEASSERT_TRUE(margin >= 0.0f)
+	pMargin = margin;
+}
+
+bool decSpatialIndex::HasElement(int element) const{
+	return element >= 0 && element < pElements.GetCount() && pElements[element].leaf != -1;
+}
+
+const decVector &decSpatialIndex::GetElementMinExtend(int element) const{
+	pRequireElement(element);
+	return pElements[element].minExtend;
+}
+
+const decVector &decSpatialIndex::GetElementMaxExtend(int element) const{
+	pRequireElement(element);
+	return pElements[element].maxExtend;
+}
+
+
+
+int decSpatialIndex::Insert(const decVector &minExtend, const decVector &maxExtend){
+	const int element = pAllocateElement();
+	const int leaf = pAllocateNode();
+	
+	sElement &e = pElements[element];
+	e.minExtend = minExtend;
+	e.maxExtend = maxExtend;
+	e.leaf = leaf;
+	
+	pSetLeafBox(leaf, element);
+	pInsertLeaf(leaf);
+	return element;
+}
+
+int decSpatialIndex::Insert(const decDVector &minExtend, const decDVector &maxExtend){
+	return Insert(fToVectorDown(minExtend), fToVectorUp(maxExtend));
+}
+
+void decSpatialIndex::Insert(const decVector *minExtends, const decVector *maxExtends,
+int count, decTList<int> &elements){
+	DEASSERT_TRUE(count >= 0)
+	if(count == 0){
+		return;
+	}
+	
+	DEASSERT_NOTNULL(minExtends)
+	DEASSERT_NOTNULL(maxExtends)
+	
+	int i;
+	if(count < GetElementCount()){
+		for(i=0; i<count; i++){
+			elements.Add(Insert(minExtends[i], maxExtends[i]));
+		}
+		return;
+	}
+	
+	// the leaf is assigned by Rebuild(). until then it only marks the element used
+	pElements.EnlargeCapacity(pElements.GetCount() + count);
+	
+	for(i=0; i<count; i++){
+		const int element = pAllocateElement();
+		sElement &e = pElements[element];
+		e.minExtend = minExtends[i];
+		e.maxExtend = maxExtends[i];
+		e.leaf = 0;
+		elements.Add(element);
+	}
+	
+	Rebuild();
+}
+
+void decSpatialIndex::Remove(int element){
+	pRequireElement(element);
+	
+	const int leaf = pElements[element].leaf;
+	pRemoveLeaf(leaf);
+	pFreeNode(leaf);
+	
+	pElements[element].leaf = -1;
+	pFreeElements.Add(element);
+	
+	if(GetElementCount() == 0){
+		RemoveAll();
+	}
+}
+
+void decSpatialIndex::Remove(const int *elements, int count){
+	DEASSERT_TRUE(count >= 0)
+	if(count == 0){
+		return;
+	}
+	
+	DEASSERT_NOTNULL(elements)
+	
+	int i;
+	if(count * 2 <= GetElementCount()){
+		for(i=0; i<count; i++){
+			Remove(elements[i]);
+		}
+		return;
+	}
+	
+	for(i=0; i<count; i++){
+		pRequireElement(elements[i]);
+		pElements[elements[i]].leaf = -1;
+		pFreeElements.Add(elements[i]);
+	}
+	
+	if(GetElementCount() == 0){
+		RemoveAll();
+		
+	}else{
+		Rebuild();
+	}
+}
+
+void decSpatialIndex::RemoveAll(){
+	pNodes.SetCountDiscard(0);
+	pParents.SetCountDiscard(0);
+	pHeights.SetCountDiscard(0);
+	pFreeNodes.SetCountDiscard(0);
+	pRoot = -1;
+	
+	pElements.SetCountDiscard(0);
+	pFreeElements.SetCountDiscard(0);
+}
+
+bool decSpatialIndex::Move(int element, const decVector &minExtend, const decVector &maxExtend){
+	pRequireElement(element);
+	
+	sElement &e = pElements[element];
+	e.minExtend = minExtend;
+	e.maxExtend = maxExtend;
+	
+	const sNode &leaf = pNodes[e.leaf];
+	if(minExtend.x >= leaf.minExtend[0] && minExtend.y >= leaf.minExtend[1]
+	&& minExtend.z >= leaf.minExtend[2] && maxExtend.x <= leaf.maxExtend[0]
+	&& maxExtend.y <= leaf.maxExtend[1] && maxExtend.z <= leaf.maxExtend[2]){
+		return false;
+	}
+	
+	pRemoveLeaf(e.leaf);
+	pSetLeafBox(e.leaf, element);
+	pInsertLeaf(e.leaf);
+	return true;
+}
+
+bool decSpatialIndex::Move(int element, const decDVector &minExtend, const decDVector &maxExtend){
+	return Move(element, fToVectorDown(minExtend), fToVectorUp(maxExtend));
+}
+
+int decSpatialIndex::Move(const int *elements, const decVector *minExtends,
+const decVector *maxExtends, int count){
+	DEASSERT_TRUE(count >= 0)
+	if(count == 0){
+		return 0;
+	}
+	
+	DEASSERT_NOTNULL(elements)
+	DEASSERT_NOTNULL(minExtends)
+	DEASSERT_NOTNULL(maxExtends)
+	
+	// update element boxes and count the elements leaving their leaf box
+	const sNode * const nodes = pNodes.GetArrayPointer();
+	int i, escapeCount = 0;
+	
+	for(i=0; i<count; i++){
+		pRequireElement(elements[i]);
+		
+		sElement &e = pElements[elements[i]];
+		e.minExtend = minExtends[i];
+		e.maxExtend = maxExtends[i];
+		
+		const sNode &leaf = nodes[e.leaf];
+		if(!(e.minExtend.x >= leaf.minExtend[0] && e.minExtend.y >= leaf.minExtend[1]
+		&& e.minExtend.z >= leaf.minExtend[2] && e.maxExtend.x <= leaf.maxExtend[0]
+		&& e.maxExtend.y <= leaf.maxExtend[1] && e.maxExtend.z <= leaf.maxExtend[2])){
+			escapeCount++;
+		}
+	}
+	
+	if(escapeCount == 0){
+		return 0;
+	}
+	
+	if(escapeCount * 4 > GetElementCount()){
+		Rebuild();
+		return escapeCount;
+	}
+	
+	// reinsert elements leaving their leaf box. Move() does not reinsert elements present
+	// multiple times in the list more than once since the leaf box is updated
+	int reinsertCount = 0;
+	for(i=0; i<count; i++){
+		const sElement &e = pElements[elements[i]];
+		if(Move(elements[i], decVector(e.minExtend), decVector(e.maxExtend))){
+			reinsertCount++;
+		}
+	}
+	return reinsertCount;
+}
+
+void decSpatialIndex::Rebuild(){
+	pNodes.SetCountDiscard(0);
+	pParents.SetCountDiscard(0);
+	pHeights.SetCountDiscard(0);
+	pFreeNodes.SetCountDiscard(0);
+	pRoot = -1;
+	
+	const int elementCount = pElements.GetCount();
+	const int count = GetElementCount();
+	if(count == 0){
+		return;
+	}
+	
+	pNodes.EnlargeCapacity(count * 2 - 1);
+	pParents.EnlargeCapacity(count * 2 - 1);
+	pHeights.EnlargeCapacity(count * 2 - 1);
+	
+	decTList<int> leaves;
+	leaves.EnlargeCapacity(count);
+	
+	int i;
+	for(i=0; i<elementCount; i++){
+		if(pElements[i].leaf == -1){
+			continue;
+		}
+		
+		const int leaf = pAllocateNode();
+		pElements[i].leaf = leaf;
+		pSetLeafBox(leaf, i);
+		leaves.Add(leaf);
+	}
+	
+	pRoot = pBuildRange(leaves.GetArrayPointer(), count);
+	pParents[pRoot] = -1;
+}
+
+
+
+void decSpatialIndex::QueryBox(const decVector &minExtend, const decVector &maxExtend,
+decTList<int> &elements) const{
+	if(pRoot == -1){
+		return;
+	}
+	
+	const sNode * const nodes = pNodes.GetArrayPointer();
+	const sElement * const items = pElements.GetArrayPointer();
+	const cBoxTest test(minExtend, maxExtend);
+	
+	int stack[TraverseStackSize];
+	int stackSize = 1;
+	stack[0] = pRoot;
+	
+	while(stackSize > 0){
+		const int index = stack[--stackSize];
+		const sNode &node = nodes[index];
+		if(!test.Overlaps(node)){
+			continue;
+		}
+		
+		if(node.child1 == -1){
+			const sElement &e = items[node.child2];
+			if(fBoxOverlaps(e.minExtend, e.maxExtend, minExtend, maxExtend)){
+				elements.Add(node.child2);
+			}
+			
+		}else if(test.Contains(node)){
+			pAddSubTree(index, elements);
+			
+		}else{
+			DEASSERT_TRUE(stackSize + 2 <= TraverseStackSize)
+			stack[stackSize++] = node.child2;
+			stack[stackSize++] = node.child1;
+		}
+	}
+}
+
+void decSpatialIndex::QueryBox(const decDVector &minExtend, const decDVector &maxExtend,
+decTList<int> &elements) const{
+	QueryBox(fToVectorDown(minExtend), fToVectorUp(maxExtend), elements);
+}
+
+void decSpatialIndex::QueryRay(const decVector &origin, const decVector &direction,
+decTList<int> &elements) const{
+	if(pRoot == -1){
+		return;
+	}
+	
+	const sNode * const nodes = pNodes.GetArrayPointer();
+	const sElement * const items = pElements.GetArrayPointer();
+	const decVector invDirection(fRayInverse(direction.x),
+		fRayInverse(direction.y), fRayInverse(direction.z));
+	const cRayTest test(origin, invDirection);
+	
+	int stack[TraverseStackSize];
+	int stackSize = 1;
+	stack[0] = pRoot;
+	
+	while(stackSize > 0){
+		const sNode &node = nodes[stack[--stackSize]];
+		if(!test.Hits(node)){
+			continue;
+		}
+		
+		if(node.child1 == -1){
+			const sElement &e = items[node.child2];
+			if(fRayHitsBox(origin, invDirection, e.minExtend, e.maxExtend)){
+				elements.Add(node.child2);
+			}
+			
+		}else{
+			DEASSERT_TRUE(stackSize + 2 <= TraverseStackSize)
+			stack[stackSize++] = node.child2;
+			stack[stackSize++] = node.child1;
+		}
+	}
+}
+
+void decSpatialIndex::QueryPlanes(const decVector4 *planes, int planeCount,
+decTList<int> &elements) const{
+	DEASSERT_TRUE(planeCount >= 0)
+	DEASSERT_TRUE(planeCount <= MaxPlanes)
+	
+	if(pRoot == -1){
+		return;
+	}
+	
+	if(planeCount == 0){
+		pAddSubTree(pRoot, elements);
+		return;
+	}
+	
+	DEASSERT_NOTNULL(planes)
+	
+	const sNode * const nodes = pNodes.GetArrayPointer();
+	const sElement * const items = pElements.GetArrayPointer();
+	const cPlanesTest test(planes, planeCount);
+	
+	int stack[TraverseStackSize];
+	int stackSize = 1;
+	stack[0] = pRoot;
+	
+	while(stackSize > 0){
+		const int index = stack[--stackSize];
+		const sNode &node = nodes[index];
+		
+		switch(test.Classify(node)){
+		case ecOutside:
+			break;
+			
+		case ecInside:
+			pAddSubTree(index, elements);
+			break;
+			
+		case ecIntersect:
+			if(node.child1 == -1){
+				const sElement &e = items[node.child2];
+				if(!fBoxOutsidePlanes(planes, planeCount, e.minExtend, e.maxExtend)){
+					elements.Add(node.child2);
+				}
+				
+			}else{
+				DEASSERT_TRUE(stackSize + 2 <= TraverseStackSize)
+				stack[stackSize++] = node.child2;
+				stack[stackSize++] = node.child1;
+			}
+			break;
+		}
+	}
+}
+
+float decSpatialIndex::BoxDistanceSquared(const decVector &point,
+const decVector &minExtend, const decVector &maxExtend){
+	const float dx = decMath::max(minExtend.x - point.x, 0.0f, point.x - maxExtend.x);
+	const float dy = decMath::max(minExtend.y - point.y, 0.0f, point.y - maxExtend.y);
+	const float dz = decMath::max(minExtend.z - point.z, 0.0f, point.z - maxExtend.z);
+	return dx * dx + dy * dy + dz * dz;
+}
+
+
+
+// Private Functions
+//////////////////////
+
+int decSpatialIndex::pAllocateElement(){
+	if(pFreeElements.IsNotEmpty()){
+		const int element = pFreeElements.Last();
+		pFreeElements.RemoveLast();
+		return element;
+	}
+	
+	pElements.Add({});
+	return pElements.GetCount() - 1;
+}
+
+int decSpatialIndex::pAllocateNode(){
+	int node;
+	
+	if(pFreeNodes.IsNotEmpty()){
+		node = pFreeNodes.Last();
+		pFreeNodes.RemoveLast();
+		
+	}else{
+		node = pNodes.GetCount();
+		pNodes.Add({});
+		pParents.Add(-1);
+		pHeights.Add(0);
+	}
+	
+	pParents[node] = -1;
+	pHeights[node] = 0;
+	return node;
+}
+
+void decSpatialIndex::pFreeNode(int node){
+	pFreeNodes.Add(node);
+}
+
+void decSpatialIndex::pSetLeafBox(int leaf, int element){
+	const sElement &e = pElements[element];
+	sNode &node = pNodes[leaf];
+	
+	node.minExtend[0] = e.minExtend.x - pMargin;
+	node.minExtend[1] = e.minExtend.y - pMargin;
+	node.minExtend[2] = e.minExtend.z - pMargin;
+	node.child1 = -1;
+	node.maxExtend[0] = e.maxExtend.x + pMargin;
+	node.maxExtend[1] = e.maxExtend.y + pMargin;
+	node.maxExtend[2] = e.maxExtend.z + pMargin;
+	node.child2 = element;
+	
+	pHeights[leaf] = 0;
+}
+
+static float fSurfaceArea(const float *minExtend, const float *maxExtend){
+	const float x = maxExtend[0] - minExtend[0];
+	const float y = maxExtend[1] - minExtend[1];
+	const float z = maxExtend[2] - minExtend[2];
+	return x * y + y * z + z * x;
+}
+
+static float fSurfaceArea(const decSpatialIndex::sNode &node1, const decSpatialIndex::sNode &node2){
+	const float minExtend[3] = {
+		decMath::min(node1.minExtend[0], node2.minExtend[0]),
+		decMath::min(node1.minExtend[1], node2.minExtend[1]),
+		decMath::min(node1.minExtend[2], node2.minExtend[2])};
+	const float maxExtend[3] = {
+		decMath::max(node1.maxExtend[0], node2.maxExtend[0]),
+		decMath::max(node1.maxExtend[1], node2.maxExtend[1]),
+		decMath::max(node1.maxExtend[2], node2.maxExtend[2])};
+	return fSurfaceArea(minExtend, maxExtend);
+}
+
+void decSpatialIndex::pInsertLeaf(int leaf){
+	if(pRoot == -1){
+		pRoot = leaf;
+		pParents[leaf] = -1;
+		return;
+	}
+	
+	// find best sibling. descends into the child with the lower cost which is the increase
+	// in surface area of all nodes up to the sibling. stops if creating a new parent node
+	// at the current node costs less than descending
+	int sibling = pRoot;
+	{
+	const sNode * const nodes = pNodes.GetArrayPointer();
+	const sNode &leafNode = nodes[leaf];
+	
+	while(nodes[sibling].child1 != -1){
+		const sNode &node = nodes[sibling];
+		const float area = fSurfaceArea(node.minExtend, node.maxExtend);
+		const float combinedArea = fSurfaceArea(node, leafNode);
+		const float cost = 2.0f * combinedArea;
+		const float inheritanceCost = 2.0f * (combinedArea - area);
+		
+		const sNode &child1 = nodes[node.child1];
+		float cost1 = fSurfaceArea(child1, leafNode) + inheritanceCost;
+		if(child1.child1 != -1){
+			cost1 -= fSurfaceArea(child1.minExtend, child1.maxExtend);
+		}
+		
+		const sNode &child2 = nodes[node.child2];
+		float cost2 = fSurfaceArea(child2, leafNode) + inheritanceCost;
+		if(child2.child1 != -1){
+			cost2 -= fSurfaceArea(child2.minExtend, child2.maxExtend);
+		}
+		
+		if(cost < cost1 && cost < cost2){
+			break;
+		}
+		
+		sibling = cost1 < cost2 ? node.child1 : node.child2;
+	}
+	}
+	
+	// create new parent replacing the sibling
+	const int oldParent = pParents[sibling];
+	const int newParent = pAllocateNode();
+	
+	pParents[newParent] = oldParent;
+	pNodes[newParent].child1 = sibling;
+	pNodes[newParent].child2 = leaf;
+	pParents[sibling] = newParent;
+	pParents[leaf] = newParent;
+	
+	if(oldParent != -1){
+		if(pNodes[oldParent].child1 == sibling){
+			pNodes[oldParent].child1 = newParent;
+			
+		}else{
+			pNodes[oldParent].child2 = newParent;
+		}
+		
+	}else{
+		pRoot = newParent;
+	}
+	
+	// refit and balance nodes up to the root
+	int index = newParent;
+	while(index != -1){
+		index = pBalance(index);
+		pFitNode(index);
+		index = pParents[index];
+	}
+}
+
+void decSpatialIndex::pRemoveLeaf(int leaf){
+	if(leaf == pRoot){
+		pRoot = -1;
+		return;
+	}
+	
+	const int parent = pParents[leaf];
+	const int grandParent = pParents[parent];
+	const int sibling = pNodes[parent].child1 == leaf ? pNodes[parent].child2 : pNodes[parent].child1;
+	
+	pFreeNode(parent);
+	
+	if(grandParent == -1){
+		pRoot = sibling;
+		pParents[sibling] = -1;
+		return;
+	}
+	
+	if(pNodes[grandParent].child1 == parent){
+		pNodes[grandParent].child1 = sibling;
+		
+	}else{
+		pNodes[grandParent].child2 = sibling;
+	}
+	pParents[sibling] = grandParent;
+	
+	int index = grandParent;
+	while(index != -1){
+		index = pBalance(index);
+		pFitNode(index);
+		index = pParents[index];
+	}
+}
+
+int decSpatialIndex::pBalance(int a){
+	sNode * const nodes = pNodes.GetArrayPointer();
+	int * const parents = pParents.GetArrayPointer();
+	int * const heights = pHeights.GetArrayPointer();
+	
+	if(nodes[a].child1 == -1 || heights[a] < 2){
+		return a;
+	}
+	
+	const int b = nodes[a].child1;
+	const int c = nodes[a].child2;
+	const int balance = heights[c] - heights[b];
+	
+	// rotate the higher child up replacing the node. the higher grand child stays with
+	// the rotated child while the lower grand child moves to the node
+	if(balance > 1){
+		const int f = nodes[c].child1;
+		const int g = nodes[c].child2;
+		
+		nodes[c].child1 = a;
+		parents[c] = parents[a];
+		parents[a] = c;
+		
+		if(parents[c] != -1){
+			if(nodes[parents[c]].child1 == a){
+				nodes[parents[c]].child1 = c;
+				
+			}else{
+				nodes[parents[c]].child2 = c;
+			}
+			
+		}else{
+			pRoot = c;
+		}
+		
+		if(heights[f] > heights[g]){
+			nodes[c].child2 = f;
+			nodes[a].child2 = g;
+			parents[g] = a;
+			
+		}else{
+			nodes[c].child2 = g;
+			nodes[a].child2 = f;
+			parents[f] = a;
+		}
+		
+		pFitNode(a);
+		pFitNode(c);
+		return c;
+	}
+	
+	if(balance < -1){
+		const int d = nodes[b].child1;
+		const int e = nodes[b].child2;
+		
+		nodes[b].child1 = a;
+		parents[b] = parents[a];
+		parents[a] = b;
+		
+		if(parents[b] != -1){
+			if(nodes[parents[b]].child1 == a){
+				nodes[parents[b]].child1 = b;
+				
+			}else{
+				nodes[parents[b]].child2 = b;
+			}
+			
+		}else{
+			pRoot = b;
+		}
+		
+		if(heights[d] > heights[e]){
+			nodes[b].child2 = d;
+			nodes[a].child1 = e;
+			parents[e] = a;
+			
+		}else{
+			nodes[b].child2 = e;
+			nodes[a].child1 = d;
+			parents[d] = a;
+		}
+		
+		pFitNode(a);
+		pFitNode(b);
+		return b;
+	}
+	
+	return a;
+}
+
+void decSpatialIndex::pFitNode(int node){
+	sNode * const nodes = pNodes.GetArrayPointer();
+	sNode &n = nodes[node];
+	const sNode &child1 = nodes[n.child1];
+	const sNode &child2 = nodes[n.child2];
+	
+	n.minExtend[0] = decMath::min(child1.minExtend[0], child2.minExtend[0]);
+	n.minExtend[1] = decMath::min(child1.minExtend[1], child2.minExtend[1]);
+	n.minExtend[2] = decMath::min(child1.minExtend[2], child2.minExtend[2]);
+	n.maxExtend[0] = decMath::max(child1.maxExtend[0], child2.maxExtend[0]);
+	n.maxExtend[1] = decMath::max(child1.maxExtend[1], child2.maxExtend[1]);
+	n.maxExtend[2] = decMath::max(child1.maxExtend[2], child2.maxExtend[2]);
+	
+	pHeights[node] = 1 + decMath::max(pHeights[n.child1], pHeights[n.child2]);
+}
+
+int decSpatialIndex::pBuildRange(int *leaves, int count){
+	if(count == 1){
+		return leaves[0];
+	}
+	
+	// split along the longest axis of the leaf centers. centers are kept doubled
+	const sNode * const nodes = pNodes.GetArrayPointer();
+	float minCenter[3], maxCenter[3];
+	int i, j;
+	
+	for(j=0; j<3; j++){
+		minCenter[j] = maxCenter[j] = nodes[leaves[0]].minExtend[j] + nodes[leaves[0]].maxExtend[j];
+	}
+	for(i=1; i<count; i++){
+		const sNode &node = nodes[leaves[i]];
+		for(j=0; j<3; j++){
+			const float center = node.minExtend[j] + node.maxExtend[j];
+			minCenter[j] = decMath::min(minCenter[j], center);
+			maxCenter[j] = decMath::max(maxCenter[j], center);
+		}
+	}
+	
+	int axis = 0;
+	if(maxCenter[1] - minCenter[1] > maxCenter[axis] - minCenter[axis]){
+		axis = 1;
+	}
+	if(maxCenter[2] - minCenter[2] > maxCenter[axis] - minCenter[axis]){
+		axis = 2;
+	}
+	
+	const int half = count / 2;
+	std::nth_element(leaves, leaves + half, leaves + count, [&](int a, int b){
+		const float ca = nodes[a].minExtend[axis] + nodes[a].maxExtend[axis];
+		const float cb = nodes[b].minExtend[axis] + nodes[b].maxExtend[axis];
+		return ca < cb || (ca == cb && a < b);
+	});
+	
+	const int child1 = pBuildRange(leaves, half);
+	const int child2 = pBuildRange(leaves + half, count - half);
+	const int node = pAllocateNode();
+	
+	pNodes[node].child1 = child1;
+	pNodes[node].child2 = child2;
+	pParents[child1] = node;
+	pParents[child2] = node;
+	pFitNode(node);
+	return node;
+}
+
+void decSpatialIndex::pAddSubTree(int node, decTList<int> &elements) const{
+	const sNode * const nodes = pNodes.GetArrayPointer();
+	
+	int stack[TraverseStackSize];
+	int stackSize = 1;
+	stack[0] = node;
+	
+	while(stackSize > 0){
+		const sNode &n = nodes[stack[--stackSize]];
+		
+		if(n.child1 == -1){
+			elements.Add(n.child2);
+			
+		}else{
+			DEASSERT_TRUE(stackSize + 2 <= TraverseStackSize)
+			stack[stackSize++] = n.child2;
+			stack[stackSize++] = n.child1;
+		}
+	}
+}
+
+void decSpatialIndex::pRequireElement(int element) const{
+	DEASSERT_TRUE(HasElement(element))
+}
@@ -0,0 +1,380 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DECSPATIALINDEX_H_
+#define _DECSPATIALINDEX_H_
+
+#include "decMath.h"
+#include "../collection/decTList.h"
+#include "../exceptions_reduced.h"
+#include "../../dragengine_export.h"
+
+
+/**
+ * \brief Dynamic bounding volume hierarchy over axis aligned boxes.
+ * 
+ * Spatial index for elements which are added, moved and removed while the index is in
+ * use. Elements are represented by an axis aligned box and identified by an element
+ * index returned by Insert(). Element indices stay valid until the element is removed.
+ * Indices of removed elements are reused by later insertions. Inserting elements into
+ * an empty index assigns consecutive indices starting at 0 in insertion order.
+ * 
+ * Each element is stored in a leaf node using a loose box enlarged by the margin. Moving
+ * an element inside the loose box only updates the element box. Only if the element box
+ * leaves the loose box the element is reinserted. Inner nodes are kept balanced using
+ * tree rotations. Batch functions rebuild the entire tree if a large number of elements
+ * change at once. Rebuilding splits elements at the median of the longest axis.
+ * 
+ * Nodes are stored in a flat array aligned to 32 bytes. Node boxes are laid out to be
+ * loaded directly into SIMD registers. Queries test boxes against the query volume using
+ * SSE2 or NEON if supported by the platform. Queries do not use callbacks but append the
+ * found element indices to a list. FindNearest() is the exception calling an evaluator to
+ * compute the distance to elements. Queries do not modify the index and can be run from
+ * multiple threads at the same time as long as no thread modifies the index.
+ * 
+ * Double precision boxes are converted to single precision rounding outwards. Elements
+ * are thus never missed but can be reported by queries if they are located very close
+ * to the query volume. Far away from the origin single precision can not resolve small
+ * boxes. Users indexing large worlds store boxes relative to a nearby reference position.
+ * 
+ * \version 1.34
+ */
+class DE_DLL_EXPORT decSpatialIndex{
+public:
+	/** \brief Tree node. */
+	struct alignas(32) sNode{
+		/** \brief Minimum extend. */
+		float minExtend[3];
+		
+		/** \brief First child node or -1 for leaf nodes. */
+		int child1;
+		
+		/** \brief Maximum extend. */
+		float maxExtend[3];
+		
+		/** \brief Second child node for inner nodes or element for leaf nodes. */
+		int child2;
+	};
+	
+	/** \brief Default margin. */
+	static constexpr float DefaultMargin = 0.1f;
+	
+	/** \brief Maximum count of planes supported by QueryPlanes(). */
+	static const int MaxPlanes = 32;
+	
+	
+	
+private:
+	struct sElement{
+		decVector minExtend;
+		decVector maxExtend;
+		int leaf;
+	};
+	
+	struct sTraverse{
+		int node;
+		float distSquared;
+	};
+	
+	static const int TraverseStackSize = 256;
+	
+	float pMargin;
+	
+	decTList<sNode> pNodes;
+	decTList<int> pParents;
+	decTList<int> pHeights;
+	decTList<int> pFreeNodes;
+	int pRoot;
+	
+	decTList<sElement> pElements;
+	decTList<int> pFreeElements;
+	
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/** \brief Create empty spatial index using default margin. */
+	decSpatialIndex();
+	
+	/**
+	 * \brief Create empty spatial index.
+	 * \throws deeInvalidParam \em margin is less than 0.
+	 */
+	explicit decSpatialIndex(float margin);
+	
+	/** \brief Clean up spatial index. */
+	~decSpatialIndex();
+	/*@}*/
+	
+	
+	
+	/** \name Management */
+	/*@{*/
+	/** \brief Margin added to element boxes to obtain the loose leaf boxes. */
+	inline float GetMargin() const{ return pMargin; }
+	
+	/**
+	 * \brief Set margin added to element boxes to obtain the loose leaf boxes.
+	 * 
+	 * Affects only elements inserted or reinserted after the change. Call Rebuild() to
+	 * apply the margin to all elements.
+	 * 
+	 * \throws deeInvalidParam \em margin is less than 0.
+	 */
+	void SetMargin(float margin);
+	
+	/** \brief Count of elements. */
+	inline int GetElementCount() const{ return pElements.GetCount() - pFreeElements.GetCount(); }
+	
+	/** \brief Count of used nodes. */
+	inline int GetNodeCount() const{ return pNodes.GetCount() - pFreeNodes.GetCount(); }
+	
+	/** \brief Height of tree. Empty tree has height 0 and a single leaf height 1. */
+	inline int GetHeight() const{ return pRoot != -1 ? pHeights[pRoot] + 1 : 0; }
+	
+	/**
+	 * \brief Nodes.
+	 * 
+	 * Contains unused nodes. Use GetRootNode() and the node children to walk the tree.
+	 */
+	inline const decTList<sNode> &GetNodes() const{ return pNodes; }
+	
+	/** \brief Root node or -1 if empty. */
+	inline int GetRootNode() const{ return pRoot; }
+	
+	/** \brief Element is present. */
+	bool HasElement(int element) const;
+	
+	/**
+	 * \brief Element minimum extend.
+	 * \throws deeInvalidParam \em element is absent.
+	 */
+	const decVector &GetElementMinExtend(int element) const;
+	
+	/**
+	 * \brief Element maximum extend.
+	 * \throws deeInvalidParam \em element is absent.
+	 */
+	const decVector &GetElementMaxExtend(int element) const;
+	
+	
+	
+	/** \brief Insert element returning the element index. */
+	int Insert(const decVector &minExtend, const decVector &maxExtend);
+	int Insert(const decDVector &minExtend, const decDVector &maxExtend);
+	
+	/**
+	 * \brief Insert elements.
+	 * 
+	 * Appends the element indices to \em elements in the same order as the boxes. If the
+	 * count of elements to insert is at least the count of elements already present the
+	 * tree is rebuilt instead of inserting elements one by one.
+	 */
+	void Insert(const decVector *minExtends, const decVector *maxExtends, int count,
+		decTList<int> &elements);
+	
+	/**
+	 * \brief Remove element.
+	 * \throws deeInvalidParam \em element is absent.
+	 */
+	void Remove(int element);
+	
+	/**
+	 * \brief Remove elements.
+	 * 
+	 * If more than half of the elements are removed the tree is rebuilt instead of removing
+	 * elements one by one.
+	 * 
+	 * \throws deeInvalidParam An element is absent.
+	 */
+	void Remove(const int *elements, int count);
+	
+	/** \brief Remove all elements. */
+	void RemoveAll();
+	
+	/**
+	 * \brief Move element.
+	 * 
+	 * If the element box stays inside the loose leaf box only the element box is updated.
+	 * Otherwise the element is reinserted into the tree.
+	 * 
+	 * \returns true if the element has been reinserted.
+	 * \throws deeInvalidParam \em element is absent.
+	 */
+	bool Move(int element, const decVector &minExtend, const decVector &maxExtend);
+	bool Move(int element, const decDVector &minExtend, const decDVector &maxExtend);
+	
+	/**
+	 * \brief Move elements.
+	 * 
+	 * Elements leaving their loose leaf box are reinserted. If more than a quarter of all
+	 * elements has to be reinserted the tree is rebuilt instead.
+	 * 
+	 * \returns Count of elements reinserted.
+	 * \throws deeInvalidParam An element is absent.
+	 */
+	int Move(const int *elements, const decVector *minExtends, const decVector *maxExtends,
+		int count);
+	
+	/** \brief Rebuild tree from all elements. */
+	void Rebuild();
+	
+	
+	
+	/**
+	 * \brief Find elements with box overlapping box.
+	 * 
+	 * Appends found element indices to \em elements. The list is not cleared.
+	 */
+	void QueryBox(const decVector &minExtend, const decVector &maxExtend,
+		decTList<int> &elements) const;
+	
+	void QueryBox(const decDVector &minExtend, const decDVector &maxExtend,
+		decTList<int> &elements) const;
+	
+	/**
+	 * \brief Find elements with box hit by ray.
+	 * 
+	 * Ray starts at \em origin and ends at \em origin + \em direction. Appends found
+	 * element indices to \em elements. The list is not cleared.
+	 */
+	void QueryRay(const decVector &origin, const decVector &direction,
+		decTList<int> &elements) const;
+	
+	/**
+	 * \brief Find elements with box inside or intersecting convex volume.
+	 * 
+	 * Volume is defined by planes with the normal in x, y and z and the distance in w.
+	 * Points are inside a plane if normal * point + distance is larger or equal to 0.
+	 * Elements are considered inside if their box is not fully outside any plane. Some
+	 * elements close to the corners of the volume can be reported although they are
+	 * outside. Appends found element indices to \em elements. The list is not cleared.
+	 * 
+	 * \throws deeInvalidParam \em planeCount is less than 0 or larger than MaxPlanes.
+	 */
+	void QueryPlanes(const decVector4 *planes, int planeCount, decTList<int> &elements) const;
+	
+	/** \brief Squared distance from point to box or 0 if point is inside box. */
+	static float BoxDistanceSquared(const decVector &point, const decVector &minExtend,
+		const decVector &maxExtend);
+	
+	/**
+	 * \brief Find element nearest to point.
+	 * 
+	 * Nodes and elements are visited nearest first. Nodes farther away than the best
+	 * element found so far are skipped. The evaluator is called with the element index and
+	 * has to return true if the element is accepted storing the squared distance to the
+	 * element in the second parameter. The distance to an element can not be less than
+	 * the distance to the element box otherwise elements can be missed. For elements at
+	 * the same distance the element with the lowest index is returned.
+	 * 
+	 * \param[in] point Point to find nearest element for.
+	 * \param[in] maxDistSquared Squared maximum distance. Elements farther away are ignored.
+	 * \param[out] distSquared Squared distance to nearest element if found.
+	 * \param[in] evaluator Callable with signature bool(int, float&).
+	 * \returns Index of nearest element or -1 if not found.
+	 */
+	template<typename Evaluator>
+	int FindNearest(const decVector &point, float maxDistSquared, float &distSquared,
+	Evaluator &&evaluator) const{
+		if(pRoot == -1){
+			return -1;
+		}
+		
+		const sNode * const nodes = pNodes.GetArrayPointer();
+		float bestDistSquared = maxDistSquared;
+		int bestElement = -1;
+		
+		sTraverse stack[TraverseStackSize];
+		int stackSize = 1;
+		stack[0].node = pRoot;
+		stack[0].distSquared = pNodeDistanceSquared(point, nodes[pRoot]);
+		
+		while(stackSize > 0){
+			const sTraverse traverse(stack[--stackSize]);
+			if(traverse.distSquared > bestDistSquared){
+				continue;
+			}
+			
+			const sNode &node = nodes[traverse.node];
+			
+			if(node.child1 == -1){
+				const int element = node.child2;
+				float elementDistSquared;
+				
+				if(evaluator(element, elementDistSquared) && (elementDistSquared < bestDistSquared
+				|| (elementDistSquared == bestDistSquared && (bestElement == -1 || element < bestElement)))){
+					bestDistSquared = elementDistSquared;
+					bestElement = element;
+				}
+				
+			}else{
+				const float distSquared1 = pNodeDistanceSquared(point, nodes[node.child1]);
+				const float distSquared2 = pNodeDistanceSquared(point, nodes[node.child2]);
+				
+				// push the farther child first so the nearer child is visited first
+				DEASSERT_TRUE(stackSize + 2 <= TraverseStackSize)
+				
+				if(distSquared1 <= distSquared2){
+					stack[stackSize++] = {node.child2, distSquared2};
+					stack[stackSize++] = {node.child1, distSquared1};
+					
+				}else{
+					stack[stackSize++] = {node.child1, distSquared1};
+					stack[stackSize++] = {node.child2, distSquared2};
+				}
+			}
+		}
+		
+		if(bestElement != -1){
+			distSquared = bestDistSquared;
+		}
+		return bestElement;
+	}
+	/*@}*/
+	
+	
+	
+private:
+	static inline float pNodeDistanceSquared(const decVector &point, const sNode &node){
+		return BoxDistanceSquared(point,
+			decVector(node.minExtend[0], node.minExtend[1], node.minExtend[2]),
+			decVector(node.maxExtend[0], node.maxExtend[1], node.maxExtend[2]));
+	}
+	
+	int pAllocateElement();
+	int pAllocateNode();
+	void pFreeNode(int node);
+	void pSetLeafBox(int leaf, int element);
+	void pInsertLeaf(int leaf);
+	void pRemoveLeaf(int leaf);
+	int pBalance(int node);
+	void pFitNode(int node);
+	int pBuildRange(int *leaves, int count);
+	void pAddSubTree(int node, decTList<int> &elements) const;
+	void pRequireElement(int element) const;
+};
+
+#endif
@@ -0,0 +1,366 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "decXmlBinaryDocument.h"
+#include "decXmlDocument.h"
+#include "decXmlElementTag.h"
+#include "decXmlAttValue.h"
+#include "decXmlCharacterData.h"
+#include "decXmlCDSect.h"
+#include "decXmlComment.h"
+#include "decXmlPI.h"
+#include "decXmlEntityReference.h"
+#include "decXmlCharReference.h"
+#include "decXmlNamespace.h"
+#include "../collection/decTDictionary.h"
+#include "../file/decBaseFileReader.h"
+#include "../file/decBaseFileWriter.h"
+#include "../exceptions.h"
+
+
+// Definitions
+////////////////
+
+namespace{
+
+struct sHeader{
+	char signature[4];
+	int32_t version;
+	int32_t size;
+	int32_t elementCount;
+	int32_t stringTable;
+	int32_t flags;
+	int32_t encoding;
+	int32_t systemLiteral;
+	int32_t publicLiteral;
+};
+
+struct sBuildElement{
+	decXmlElement *element;
+	int type;
+	int lineNumber;
+	int positionNumber;
+	int name;
+	int value;
+	int elementCount;
+	int elements;
+};
+
+}
+
+static const char * const vSignature = "DEXB";
+
+static const int vFlagStandalone = 0x1;
+
+static_assert(sizeof(sHeader) % 4 == 0, "header size has to be multiple of 4");
+static_assert(sizeof(decXmlBinaryElement) == 28, "unexpected element size");
+
+
+
+// Class decXmlBinaryDocument
+///////////////////////////////
+
+// Constructor, destructor
+////////////////////////////
+
+decXmlBinaryDocument::decXmlBinaryDocument(decXmlDocument &document) :
+pSize(0){
+	pCompile(document);
+}
+
+decXmlBinaryDocument::decXmlBinaryDocument(decBaseFileReader &reader) :
+pSize(0){
+	const int size = reader.GetLength() - reader.GetPosition();
+	if(size < (int)sizeof(sHeader) || size % 4 != 0){
+		DETHROW_INFO(deeInvalidFormat, "invalid binary xml document size");
+	}
+	
+	pData.SetCountDiscard(size / 4);
+	reader.Read(pData.GetArrayPointer(), size);
+	pSize = size;
+	
+	pValidate();
+}
+
+decXmlBinaryDocument::~decXmlBinaryDocument(){
+}
+
+
+
+// Management
+///////////////
+
+void decXmlBinaryDocument::Save(decBaseFileWriter &writer) const{
+	writer.Write(pData.GetArrayPointer(), pSize);
+}
+
+decXmlBinaryElement::cString decXmlBinaryDocument::GetEncoding() const{
+	const char * const data = (const char *)pData.GetArrayPointer();
+	return decXmlBinaryElement::cString(data + ((const sHeader *)data)->encoding);
+}
+
+decXmlBinaryElement::cString decXmlBinaryDocument::GetSystemLiteral() const{
+	const char * const data = (const char *)pData.GetArrayPointer();
+	return decXmlBinaryElement::cString(data + ((const sHeader *)data)->systemLiteral);
+}
+
+decXmlBinaryElement::cString decXmlBinaryDocument::GetPublicLiteral() const{
+	const char * const data = (const char *)pData.GetArrayPointer();
+	return decXmlBinaryElement::cString(data + ((const sHeader *)data)->publicLiteral);
+}
+
+bool decXmlBinaryDocument::GetStandalone() const{
+	return (((const sHeader *)pData.GetArrayPointer())->flags & vFlagStandalone) != 0;
+}
+
+const decXmlBinaryElement &decXmlBinaryDocument::GetDocument() const{
+	return *(const decXmlBinaryElement *)((const char *)pData.GetArrayPointer() + sizeof(sHeader));
+}
+
+const decXmlBinaryElement *decXmlBinaryDocument::GetRoot() const{
+	const decXmlBinaryElement &document = GetDocument();
+	const int count = document.GetElementCount();
+	int i;
+	
+	for(i=0; i<count; i++){
+		const decXmlBinaryElement * const element = document.GetElementAt(i);
+		if(element->CanCastToElementTag()){
+			return element;
+		}
+	}
+	
+	return nullptr;
+}
+
+
+
+// Private Functions
+//////////////////////
+
+void decXmlBinaryDocument::pCompile(decXmlDocument &document){
+	decTStringDictionary<int> stringOffsets;
+	decTList<char> strings;
+	
+	const auto intern = [&](const char *string){
+		const int *offset;
+		if(stringOffsets.GetAt(string, offset)){
+			return *offset;
+		}
+		
+		const int newOffset = strings.GetCount();
+		const int length = (int)strlen(string);
+		if(newOffset + length + 1 > strings.GetCapacity()){
+			strings.EnlargeCapacity((newOffset + length + 1) * 3 / 2);
+		}
+		strings.SetCount(newOffset + length + 1, 0);
+		memcpy(strings.GetArrayPointer() + newOffset, string, length);
+		stringOffsets.SetAt(string, newOffset);
+		return newOffset;
+	};
+	
+	const int emptyString = intern("");
+	
+	// collect elements breadth first storing the children of each element consecutively
+	decTList<sBuildElement> elements;
+	
+	sBuildElement build{};
+	build.element = &document;
+	build.type = decXmlBinaryElement::eetDocument;
+	build.lineNumber = document.GetLineNumber();
+	build.positionNumber = document.GetPositionNumber();
+	build.name = intern(document.GetDocType());
+	build.value = emptyString;
+	elements.Add(build);
+	
+	int i, j;
+	for(i=0; i<elements.GetCount(); i++){
+		if(!elements[i].element->CanCastToContainer()){
+			continue;
+		}
+		
+		decXmlContainer &container = *elements[i].element->CastToContainer();
+		const int count = container.GetElementCount();
+		
+		elements[i].elementCount = count;
+		elements[i].elements = elements.GetCount();
+		
+		for(j=0; j<count; j++){
+			decXmlElement * const element = container.GetElementAt(j);
+			
+			build.element = element;
+			build.lineNumber = element->GetLineNumber();
+			build.positionNumber = element->GetPositionNumber();
+			build.name = emptyString;
+			build.value = emptyString;
+			
+			if(element->CanCastToElementTag()){
+				build.type = decXmlBinaryElement::eetElementTag;
+				build.name = intern(element->CastToElementTag()->GetName());
+				
+			}else if(element->CanCastToAttValue()){
+				decXmlAttValue &value = *element->CastToAttValue();
+				build.type = decXmlBinaryElement::eetAttValue;
+				build.name = intern(value.GetName());
+				build.value = intern(value.GetValue());
+				
+			}else if(element->CanCastToCDSect()){
+				build.type = decXmlBinaryElement::eetCDSect;
+				build.value = intern(element->CastToCDSect()->GetData());
+				
+			}else if(element->CanCastToCharacterData()){
+				build.type = decXmlBinaryElement::eetCharacterData;
+				build.value = intern(element->CastToCharacterData()->GetData());
+				
+			}else if(element->CanCastToComment()){
+				build.type = decXmlBinaryElement::eetComment;
+				build.value = intern(element->CastToComment()->GetComment());
+				
+			}else if(element->CanCastToPI()){
+				decXmlPI &pi = *element->CastToPI();
+				build.type = decXmlBinaryElement::eetPI;
+				build.name = intern(pi.GetTarget());
+				build.value = intern(pi.GetCommand());
+				
+			}else if(element->CanCastToEntityReference()){
+				build.type = decXmlBinaryElement::eetEntityReference;
+				build.name = intern(element->CastToEntityReference()->GetName());
+				
+			}else if(element->CanCastToCharReference()){
+				build.type = decXmlBinaryElement::eetCharReference;
+				build.value = intern(element->CastToCharReference()->GetData());
+				
+			}else if(element->CanCastToNamespace()){
+				decXmlNamespace &ns = *element->CastToNamespace();
+				build.type = decXmlBinaryElement::eetNamespace;
+				build.name = intern(ns.GetName());
+				build.value = intern(ns.GetURL());
+				
+			}else{
+				DETHROW_INFO(deeInvalidParam, "unsupported xml element");
+			}
+			
+			elements.Add(build);
+		}
+	}
+	
+	const int encoding = intern(document.GetEncoding());
+	const int systemLiteral = intern(document.GetSystemLiteral());
+	const int publicLiteral = intern(document.GetPublicLiteral());
+	
+	// write data. the string table is padded with 0 to a multiple of 4 bytes
+	const int elementCount = elements.GetCount();
+	const int elementSize = (int)sizeof(decXmlBinaryElement);
+	const int stringTable = (int)sizeof(sHeader) + elementSize * elementCount;
+	const int size = (stringTable + strings.GetCount() + 3) & ~3;
+	
+	pData.SetAll(size / 4, 0);
+	pSize = size;
+	
+	char * const data = (char *)pData.GetArrayPointer();
+	
+	sHeader &header = *(sHeader *)data;
+	memcpy(header.signature, vSignature, 4);
+	header.version = FormatVersion;
+	header.size = size;
+	header.elementCount = elementCount;
+	header.stringTable = stringTable;
+	header.flags = document.GetStandalone() ? vFlagStandalone : 0;
+	header.encoding = stringTable + encoding;
+	header.systemLiteral = stringTable + systemLiteral;
+	header.publicLiteral = stringTable + publicLiteral;
+	
+	for(i=0; i<elementCount; i++){
+		const sBuildElement &source = elements[i];
+		const int offset = (int)sizeof(sHeader) + elementSize * i;
+		decXmlBinaryElement &element = *(decXmlBinaryElement *)(data + offset);
+		
+		element.pType = source.type;
+		element.pLineNumber = source.lineNumber;
+		element.pPositionNumber = source.positionNumber;
+		element.pName = stringTable + source.name - offset;
+		element.pValue = stringTable + source.value - offset;
+		element.pElementCount = source.elementCount;
+		element.pElements = (int)sizeof(sHeader) + elementSize * source.elements - offset;
+	}
+	
+	memcpy(data + stringTable, strings.GetArrayPointer(), strings.GetCount());
+}
+
+void decXmlBinaryDocument::pValidate() const{
+	const char * const data = (const char *)pData.GetArrayPointer();
+	const sHeader &header = *(const sHeader *)data;
+	
+	if(memcmp(header.signature, vSignature, 4) != 0 || header.version != FormatVersion
+	|| header.size != pSize || data[pSize - 1] != 0){
+		DETHROW_INFO(deeInvalidFormat, "invalid binary xml document header");
+	}
+	
+	const int elementSize = (int)sizeof(decXmlBinaryElement);
+	if(header.elementCount < 1 || header.elementCount > (pSize - (int)sizeof(sHeader)) / elementSize
+	|| header.stringTable != (int)sizeof(sHeader) + elementSize * header.elementCount
+	|| header.stringTable >= pSize){
+		DETHROW_INFO(deeInvalidFormat, "invalid binary xml document header");
+	}
+	
+	// strings are 0 terminated since the last byte is 0
+	const int stringTable = header.stringTable;
+	const auto validString = [&](int64_t offset){
+		return offset >= stringTable && offset < pSize;
+	};
+	
+	if(!validString(header.encoding) || !validString(header.systemLiteral)
+	|| !validString(header.publicLiteral)){
+		DETHROW_INFO(deeInvalidFormat, "invalid binary xml document string");
+	}
+	
+	// children have to be located after the parent element. this prevents cycles
+	int i;
+	for(i=0; i<header.elementCount; i++){
+		const int offset = (int)sizeof(sHeader) + elementSize * i;
+		const decXmlBinaryElement &element = *(const decXmlBinaryElement *)(data + offset);
+		
+		if(element.pType < decXmlBinaryElement::eetDocument
+		|| element.pType > decXmlBinaryElement::eetNamespace
+		|| (element.pType == decXmlBinaryElement::eetDocument) != (i == 0)){
+			DETHROW_INFO(deeInvalidFormat, "invalid binary xml element type");
+		}
+		
+		if(!validString((int64_t)offset + element.pName) || !validString((int64_t)offset + element.pValue)){
+			DETHROW_INFO(deeInvalidFormat, "invalid binary xml element string");
+		}
+		
+		if(element.pElementCount == 0){
+			continue;
+		}
+		
+		const int64_t children = (int64_t)offset + element.pElements - (int64_t)sizeof(sHeader);
+		if(element.pElementCount < 0 || children % elementSize != 0
+		|| children / elementSize <= i || children / elementSize >= header.elementCount
+		|| element.pElementCount > header.elementCount - children / elementSize){
+			DETHROW_INFO(deeInvalidFormat, "invalid binary xml element children");
+		}
+	}
+}
@@ -0,0 +1,145 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DECXMLBINARYDOCUMENT_H_
+#define _DECXMLBINARYDOCUMENT_H_
+
+#include <stdint.h>
+
+#include "decXmlBinaryElement.h"
+#include "../collection/decTList.h"
+#include "../../deObject.h"
+
+class decXmlDocument;
+class decBaseFileReader;
+class decBaseFileWriter;
+
+
+/**
+ * \brief Precompiled read-only XML document.
+ * \version 1.34
+ * 
+ * Compact binary form of a parsed \ref decXmlDocument stored in a single block of memory.
+ * Element names and strings are interned in a string table. Elements are stored in an
+ * array with the children of each element located consecutively. Elements reference
+ * their strings and children using offsets. The document can be saved and loaded with
+ * a single read without allocating memory for each element.
+ * 
+ * Elements are accessed using \ref decXmlBinaryElement providing the same functions as
+ * the decXml element classes for read-only use. The data is stored using the byte order
+ * of the host. Binary documents are thus meant for caching on the same host.
+ */
+class DE_DLL_EXPORT decXmlBinaryDocument : public deObject{
+public:
+	/** \brief Type holding strong reference. */
+	using Ref = deTObjectReference<decXmlBinaryDocument>;
+	
+	/** \brief Binary format version. */
+	static const int FormatVersion = 1;
+	
+	
+	
+private:
+	decTList<uint32_t> pData;
+	int pSize;
+	
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/** \brief Create binary document from parsed document. */
+	decXmlBinaryDocument(decXmlDocument &document);
+	
+	/**
+	 * \brief Load binary document from remaining content of file reader.
+	 * \throws deeInvalidFormat Content is not a valid binary document.
+	 */
+	decXmlBinaryDocument(decBaseFileReader &reader);
+	
+protected:
+	/**
+	 * \brief Clean up binary document.
+	 * \note Subclasses should set their destructor protected too to avoid users
+	 *       accidently deleting a reference counted object through the object
+	 *       pointer. Only FreeReference() is allowed to delete the object.
+	 */
+	~decXmlBinaryDocument() override;
+	/*@}*/
+	
+	
+	
+public:
+	/** \name Management */
+	/*@{*/
+	/** \brief Size in bytes of binary data. */
+	inline int GetDataSize() const{ return pSize; }
+	
+	/** \brief Binary data. */
+	inline const void *GetData() const{ return pData.GetArrayPointer(); }
+	
+	/** \brief Save binary data to file writer. */
+	void Save(decBaseFileWriter &writer) const;
+	
+	/** \brief Encoding. */
+	decXmlBinaryElement::cString GetEncoding() const;
+	
+	/** \brief Document type. */
+	inline decXmlBinaryElement::cString GetDocType() const{ return GetDocument().GetName(); }
+	
+	/** \brief System literal. */
+	decXmlBinaryElement::cString GetSystemLiteral() const;
+	
+	/** \brief Public literal. */
+	decXmlBinaryElement::cString GetPublicLiteral() const;
+	
+	/** \brief Standalone. */
+	bool GetStandalone() const;
+	
+	/** \brief Document element containing the top level elements. */
+	const decXmlBinaryElement &GetDocument() const;
+	
+	/** \brief Count of top level elements. */
+	inline int GetElementCount() const{ return GetDocument().GetElementCount(); }
+	
+	/**
+	 * \brief Top level element at index.
+	 * \throws deeInvalidParam \em index is less than 0 or larger than GetElementCount()-1.
+	 */
+	inline const decXmlBinaryElement *GetElementAt(int index) const{
+		return GetDocument().GetElementAt(index);
+	}
+	
+	/** \brief First top level element tag or nullptr. */
+	const decXmlBinaryElement *GetRoot() const;
+	/*@}*/
+	
+	
+	
+private:
+	void pCompile(decXmlDocument &document);
+	void pValidate() const;
+};
+
+#endif
@@ -0,0 +1,139 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "decXmlBinaryElement.h"
+#include "../exceptions.h"
+
+
+
+// Class decXmlBinaryElement
+//////////////////////////////
+
+// Management
+///////////////
+
+const decXmlBinaryElement *decXmlBinaryElement::GetElementAt(int index) const{
+	DEASSERT_TRUE(index >= 0)
+	DEASSERT_TRUE(index < pElementCount)
+	
+	return (const decXmlBinaryElement *)((const char *)this + pElements) + index;
+}
+
+
+
+// Helper Functions
+/////////////////////
+
+const decXmlBinaryElement *decXmlBinaryElement::GetFirstData() const{
+	const decXmlBinaryElement * const elements = (const decXmlBinaryElement *)((const char *)this + pElements);
+	int i;
+	
+	for(i=0; i<pElementCount; i++){
+		if(elements[i].CanCastToCharacterData()){
+			return elements + i;
+		}
+	}
+	
+	return nullptr;
+}
+
+const decXmlBinaryElement *decXmlBinaryElement::GetElementIfTag(int index) const{
+	const decXmlBinaryElement * const element = GetElementAt(index);
+	return element->CanCastToElementTag() ? element : nullptr;
+}
+
+const decXmlBinaryElement *decXmlBinaryElement::FindAttribute(const char *name) const{
+	const decXmlBinaryElement * const elements = (const decXmlBinaryElement *)((const char *)this + pElements);
+	int i;
+	
+	for(i=0; i<pElementCount; i++){
+		if(elements[i].CanCastToAttValue() && strcmp(elements[i].GetName(), name) == 0){
+			return elements + i;
+		}
+	}
+	
+	return nullptr;
+}
+
+
+
+// Casting
+////////////
+
+const decXmlBinaryElement *decXmlBinaryElement::CastToContainer() const{
+	DEASSERT_TRUE(CanCastToContainer())
+	return this;
+}
+
+const decXmlBinaryElement *decXmlBinaryElement::CastToDocument() const{
+	DEASSERT_TRUE(CanCastToDocument())
+	return this;
+}
+
+const decXmlBinaryElement *decXmlBinaryElement::CastToElementTag() const{
+	DEASSERT_TRUE(CanCastToElementTag())
+	return this;
+}
+
+const decXmlBinaryElement *decXmlBinaryElement::CastToAttValue() const{
+	DEASSERT_TRUE(CanCastToAttValue())
+	return this;
+}
+
+const decXmlBinaryElement *decXmlBinaryElement::CastToCharacterData() const{
+	DEASSERT_TRUE(CanCastToCharacterData())
+	return this;
+}
+
+const decXmlBinaryElement *decXmlBinaryElement::CastToCDSect() const{
+	DEASSERT_TRUE(CanCastToCDSect())
+	return this;
+}
+
+const decXmlBinaryElement *decXmlBinaryElement::CastToComment() const{
+	DEASSERT_TRUE(CanCastToComment())
+	return this;
+}
+
+const decXmlBinaryElement *decXmlBinaryElement::CastToPI() const{
+	DEASSERT_TRUE(CanCastToPI())
+	return this;
+}
+
+const decXmlBinaryElement *decXmlBinaryElement::CastToEntityReference() const{
+	DEASSERT_TRUE(CanCastToEntityReference())
+	return this;
+}
+
+const decXmlBinaryElement *decXmlBinaryElement::CastToCharReference() const{
+	DEASSERT_TRUE(CanCastToCharReference())
+	return this;
+}
+
+const decXmlBinaryElement *decXmlBinaryElement::CastToNamespace() const{
+	DEASSERT_TRUE(CanCastToNamespace())
+	return this;
+}
@@ -0,0 +1,253 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DECXMLBINARYELEMENT_H_
+#define _DECXMLBINARYELEMENT_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../string/decString.h"
+#include "../../dragengine_export.h"
+
+
+/**
+ * \brief Read-only view of element in a precompiled XML document.
+ * \version 1.34
+ * 
+ * Elements are stored inside the data of \ref decXmlBinaryDocument and are valid as long
+ * as the document exists. Elements are never created directly. Each element provides the
+ * functions of the matching decXml element classes. Casting returns the same element.
+ * Strings are returned as \ref cString pointing into the document data.
+ * 
+ * The children of an element are stored consecutively. Names, values and children are
+ * located using offsets relative to the element. Accessing elements therefore requires
+ * no memory allocation.
+ */
+class DE_DLL_EXPORT decXmlBinaryElement{
+public:
+	/** \brief Element types. */
+	enum eElementTypes{
+		/** \brief Document. */
+		eetDocument,
+		
+		/** \brief Element tag. */
+		eetElementTag,
+		
+		/** \brief Attribute value. */
+		eetAttValue,
+		
+		/** \brief Character data. */
+		eetCharacterData,
+		
+		/** \brief CDATA section. */
+		eetCDSect,
+		
+		/** \brief Comment. */
+		eetComment,
+		
+		/** \brief Processing instruction. */
+		eetPI,
+		
+		/** \brief Entity reference. */
+		eetEntityReference,
+		
+		/** \brief Character reference. */
+		eetCharReference,
+		
+		/** \brief Namespace. */
+		eetNamespace
+	};
+	
+	/**
+	 * \brief String stored in document data.
+	 * 
+	 * Provides the read-only functions of decString used with XML element strings
+	 * without copying the string.
+	 */
+	class DE_DLL_EXPORT cString{
+	private:
+		const char *pString;
+		
+	public:
+		/** \brief Create string. */
+		explicit inline cString(const char *string) : pString(string){}
+		
+		/** \brief Pointer to string. */
+		inline const char *GetString() const{ return pString; }
+		
+		/** \brief Length of string. */
+		inline int GetLength() const{ return (int)strlen(pString); }
+		
+		/** \brief String is empty. */
+		inline bool IsEmpty() const{ return !*pString; }
+		
+		/** \brief Integer value. */
+		inline int ToInt() const{ return (int)strtoll(pString, nullptr, 10); }
+		
+		/** \brief Float value. */
+		inline float ToFloat() const{ return strtof(pString, nullptr); }
+		
+		/** \brief Double value. */
+		inline double ToDouble() const{ return strtod(pString, nullptr); }
+		
+		/** \brief String equals another string case sensitive. */
+		inline bool operator==(const char *string) const{ return strcmp(pString, string) == 0; }
+		inline bool operator==(const decString &string) const{ return string == pString; }
+		
+		/** \brief String does not equal another string case sensitive. */
+		inline bool operator!=(const char *string) const{ return strcmp(pString, string) != 0; }
+		inline bool operator!=(const decString &string) const{ return string != pString; }
+		
+		/** \brief Pointer to string. */
+		inline operator const char*() const{ return pString; }
+	};
+	
+	
+	
+private:
+	int32_t pType;
+	int32_t pLineNumber;
+	int32_t pPositionNumber;
+	int32_t pName;
+	int32_t pValue;
+	int32_t pElementCount;
+	int32_t pElements;
+	
+	friend class decXmlBinaryDocument;
+	
+	
+	
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/** \brief Elements exist only inside document data. */
+	decXmlBinaryElement() = delete;
+	decXmlBinaryElement(const decXmlBinaryElement &element) = delete;
+	decXmlBinaryElement &operator=(const decXmlBinaryElement &element) = delete;
+	/*@}*/
+	
+	
+	
+public:
+	/** \name Management */
+	/*@{*/
+	/** \brief Element type. */
+	inline eElementTypes GetType() const{ return (eElementTypes)pType; }
+	
+	/** \brief Line number. */
+	inline int GetLineNumber() const{ return pLineNumber; }
+	
+	/** \brief Position number. */
+	inline int GetPositionNumber() const{ return pPositionNumber; }
+	
+	/**
+	 * \brief Name.
+	 * 
+	 * Tag name, attribute name, processing instruction target, entity reference name,
+	 * namespace name or document type. Empty string for other types.
+	 */
+	inline cString GetName() const{ return cString((const char *)this + pName); }
+	
+	/**
+	 * \brief Value.
+	 * 
+	 * Attribute value, character data, comment, processing instruction command or
+	 * namespace URL. Empty string for other types.
+	 */
+	inline cString GetValue() const{ return cString((const char *)this + pValue); }
+	
+	/** \brief Character data. Same as GetValue(). */
+	inline cString GetData() const{ return GetValue(); }
+	
+	/** \brief Comment. Same as GetValue(). */
+	inline cString GetComment() const{ return GetValue(); }
+	
+	/** \brief Processing instruction target. Same as GetName(). */
+	inline cString GetTarget() const{ return GetName(); }
+	
+	/** \brief Processing instruction command. Same as GetValue(). */
+	inline cString GetCommand() const{ return GetValue(); }
+	
+	/** \brief Namespace URL. Same as GetValue(). */
+	inline cString GetURL() const{ return GetValue(); }
+	
+	/** \brief Count of child elements. */
+	inline int GetElementCount() const{ return pElementCount; }
+	
+	/**
+	 * \brief Child element at index.
+	 * \throws deeInvalidParam \em index is less than 0 or larger than GetElementCount()-1.
+	 */
+	const decXmlBinaryElement *GetElementAt(int index) const;
+	/*@}*/
+	
+	
+	
+	/** \name Helper Functions */
+	/*@{*/
+	/** \brief First child element being character data or CDATA section or nullptr. */
+	const decXmlBinaryElement *GetFirstData() const;
+	
+	/** \brief Child element at index if it is an element tag or nullptr otherwise. */
+	const decXmlBinaryElement *GetElementIfTag(int index) const;
+	
+	/** \brief Child attribute value with name or nullptr. */
+	const decXmlBinaryElement *FindAttribute(const char *name) const;
+	/*@}*/
+	
+	
+	
+	/**
+	 * \name Casting
+	 * Casting throws deeInvalidParam if the element type does not match.
+	 */
+	/*@{*/
+	inline bool CanCastToContainer() const{ return pType == eetDocument || pType == eetElementTag; }
+	inline bool CanCastToDocument() const{ return pType == eetDocument; }
+	inline bool CanCastToElementTag() const{ return pType == eetElementTag; }
+	inline bool CanCastToAttValue() const{ return pType == eetAttValue; }
+	inline bool CanCastToCharacterData() const{ return pType == eetCharacterData || pType == eetCDSect; }
+	inline bool CanCastToCDSect() const{ return pType == eetCDSect; }
+	inline bool CanCastToComment() const{ return pType == eetComment; }
+	inline bool CanCastToPI() const{ return pType == eetPI; }
+	inline bool CanCastToEntityReference() const{ return pType == eetEntityReference; }
+	inline bool CanCastToCharReference() const{ return pType == eetCharReference; }
+	inline bool CanCastToNamespace() const{ return pType == eetNamespace; }
+	
+	const decXmlBinaryElement *CastToContainer() const;
+	const decXmlBinaryElement *CastToDocument() const;
+	const decXmlBinaryElement *CastToElementTag() const;
+	const decXmlBinaryElement *CastToAttValue() const;
+	const decXmlBinaryElement *CastToCharacterData() const;
+	const decXmlBinaryElement *CastToCDSect() const;
+	const decXmlBinaryElement *CastToComment() const;
+	const decXmlBinaryElement *CastToPI() const;
+	const decXmlBinaryElement *CastToEntityReference() const;
+	const decXmlBinaryElement *CastToCharReference() const;
+	const decXmlBinaryElement *CastToNamespace() const;
+	/*@}*/
+};
+
+#endif
@@ -65,7 +65,9 @@ void decXmlContainer::AddElement(decXmlElement *element){
 	DEASSERT_NOTNULL(element)
 	DEASSERT_NULL(element->GetParent())
 	
-	pElements.AddOrThrow(element);
+	// elements without parent are not part of any container. checking for duplicates
+	// is not required which would be slow for large documents
+	pElements.Add(element);
 	element->SetParent(this);
 }
 
@@ -73,13 +75,15 @@ void decXmlContainer::InsertElement(decXmlElement *element, int beforeIndex){
 	DEASSERT_NOTNULL(element)
 	DEASSERT_NULL(element->GetParent())
 	
-	pElements.InsertOrThrow(element, beforeIndex);
+	pElements.Insert(element, beforeIndex);
 	element->SetParent(this);
 }
 
 void decXmlContainer::RemoveElement(decXmlElement *element){
 	const decXmlElement::Ref guard(element);
-	pElements.RemoveOrThrow(element);
+	const int index = pElements.IndexOf(element);
+	DEASSERT_TRUE(index != -1)
+	pElements.RemoveFrom(index);
 	element->SetParent(nullptr);
 }
 
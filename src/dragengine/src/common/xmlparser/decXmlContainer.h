@@ -26,7 +26,7 @@
 #define _DECXMLCONTAINER_H_
 
 #include "decXmlElement.h"
-#include "../collection/decTOrderedSet.h"
+#include "../collection/decTList.h"
 
 
 /**
@@ -41,7 +41,7 @@ public:
 	
 	
 private:
-	decTObjectOrderedSet<decXmlElement> pElements;
+	decTObjectList<decXmlElement> pElements;
 	
 	
 	
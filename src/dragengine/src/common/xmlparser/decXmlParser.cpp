@@ -43,9 +43,88 @@
 #include "decXmlVisitor.h"
 #include "../exceptions.h"
 #include "../file/decBaseFileReader.h"
+#include "../file/decMappedFileReader.h"
 #include "../../logger/deLogger.h"
 #include "../../dragengine_configuration.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define DEC_XML_PARSER_SSE2
+	#include <emmintrin.h>
+	#ifdef _MSC_VER
+		#include <intrin.h>
+	#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	#define DEC_XML_PARSER_NEON
+	#include <arm_neon.h>
+#endif
+
+
+// Scanning
+/////////////
+
+#ifdef DEC_XML_PARSER_SSE2
+static inline int vCountTrailingZeros(int mask){
+	#ifdef _MSC_VER
+		unsigned long index;
+		_BitScanForward(&index, (unsigned long)mask);
+		return (int)index;
+	#else
+		return __builtin_ctz((unsigned int)mask);
+	#endif
+}
+#endif
+
+/**
+ * Index of first character in data matching one of the characters or -1 if not found.
+ * Single characters are searched using memchr. Otherwise blocks of 16 characters are
+ * compared at once using SIMD instructions if available.
+ */
+static int vFindChar(const char *data, int length, int character1, int character2, int character3){
+	if(character1 == character2 && character1 == character3){
+		const char * const found = (const char*)memchr(data, character1, length);
+		return found ? (int)(found - data) : -1;
+	}
+	
+	int i = 0;
+	
+	#ifdef DEC_XML_PARSER_SSE2
+	const __m128i match1 = _mm_set1_epi8((char)character1);
+	const __m128i match2 = _mm_set1_epi8((char)character2);
+	const __m128i match3 = _mm_set1_epi8((char)character3);
+	
+	for(; i+16<=length; i+=16){
+		const __m128i block = _mm_loadu_si128((const __m128i*)(data + i));
+		const int mask = _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(
+			_mm_cmpeq_epi8(block, match1), _mm_cmpeq_epi8(block, match2)),
+			_mm_cmpeq_epi8(block, match3)));
+		if(mask){
+			return i + vCountTrailingZeros(mask);
+		}
+	}
+	
+	#elif defined(DEC_XML_PARSER_NEON)
+	const uint8x16_t match1 = vdupq_n_u8((uint8_t)character1);
+	const uint8x16_t match2 = vdupq_n_u8((uint8_t)character2);
+	const uint8x16_t match3 = vdupq_n_u8((uint8_t)character3);
+	
+	for(; i+16<=length; i+=16){
+		const uint8x16_t block = vld1q_u8((const uint8_t*)(data + i));
+		if(vmaxvq_u8(vorrq_u8(vorrq_u8(vceqq_u8(block, match1),
+		vceqq_u8(block, match2)), vceqq_u8(block, match3)))){
+			break; // exact index found below
+		}
+	}
+	#endif
+	
+	for(; i<length; i++){
+		const int character = data[i];
+		if(character == character1 || character == character2 || character == character3){
+			return i;
+		}
+	}
+	return -1;
+}
+
 
 
 // Class decXmlParser
@@ -58,12 +137,16 @@ decXmlParser::decXmlParser(deLogger *logger){
 	if(!logger) DETHROW(deeInvalidParam);
 	
 	pLogger = logger;
-	pLine = 1;
-	pPos = 1;
+	pTokenStart = 0;
 	pTokenLen = 0;
 	pTokenLine = 1;
 	pTokenPos = 1;
 	pCleanStringSize = 0;
+	pFilePos = 0;
+	pFileLen = 0;
+	pReadData = nullptr;
+	pReadPos = 0;
+	pReadLen = 0;
 	pFile = nullptr;
 	pCurChar = DEXP_EOF;
 	pHasFatalError = false;
@@ -119,9 +202,20 @@ void decXmlParser::PrepareParse(decBaseFileReader *file){
 	pFile = file;
 	pFilePos = file->GetPosition();
 	pFileLen = file->GetLength();
+	pReadData = nullptr;
+	pReadPos = 0;
+	pReadLen = 0;
+	
+	// memory mapped files are parsed directly without copying
+	decMappedFileReader * const mappedFile = dynamic_cast<decMappedFileReader*>(file);
+	if(mappedFile && pFilePos < pFileLen){
+		pReadData = (const char *)mappedFile->GetDataAtPosition();
+		pReadLen = pFileLen - pFilePos;
+		pFilePos = pFileLen;
+		mappedFile->SetPosition(pFileLen);
+	}
+	
 	ClearToken();
-	pLine = 1;
-	pPos = 1;
 	pTokenLine = 1;
 	pTokenPos = 1;
 	pCurChar = DEXP_EOF;
@@ -206,7 +300,7 @@ void decXmlParser::ParseDocTypeDecl(decXmlDocument *doc){
 }
 
 void decXmlParser::ParseSystemLiteral(decXmlDocument *doc){
-	int nextChar, count = 0;
+	int count;
 	const char *delimiter;
 	// SystemLiteral ::= ('"' [^"]* '"') | ("'" [^']* "'")
 	if(ParseToken("'")){
@@ -217,12 +311,8 @@ void decXmlParser::ParseSystemLiteral(decXmlDocument *doc){
 		RaiseFatalError();
 		return;
 	}
-	while(true){
-		nextChar = GetTokenAt(count);
-		if(nextChar == DEXP_EOF) RaiseFatalError();
-		if(nextChar == *delimiter) break;
-		count++;
-	}
+	count = FindTokenChar(0, *delimiter, *delimiter, *delimiter);
+	if(count == -1) RaiseFatalError();
 	SetCleanString(count);
 	doc->SetSystemLiteral(pCleanString.GetArrayPointer());
 	RemoveFromToken(count);
@@ -258,7 +348,7 @@ void decXmlParser::ParsePublicLiteral(decXmlDocument *doc){
 bool decXmlParser::ParseElementTag(decXmlContainer *container, const char *requiredName){
 	decXmlElementTag::Ref tag;
 	decXmlCharacterData::Ref charData;
-	int nextChar, count = 0;
+	int count = 0;
 	int lineNumber = pTokenLine;
 	int posNumber = pTokenPos;
 	
@@ -286,15 +376,8 @@ bool decXmlParser::ParseElementTag(decXmlContainer *container, const char *requi
 					// CharData ::= [^<&]* - ([^<&]* ']]>' [^<&]*)
 					lineNumber = pTokenLine;
 					posNumber = pTokenPos;
-					count = 0;
-					while(true){
-						nextChar = GetTokenAt(count);
-						if(nextChar == DEXP_EOF) RaiseFatalError();
-						if(nextChar == '<' || nextChar == '&'){
-							break;
-						}
-						count++;
-					}
+					count = FindTokenChar(0, '<', '&', '&');
+					if(count == -1) RaiseFatalError();
 					if(count > 0){
 						SetCleanString(count);
 						pAddCharacterData(tag, pCleanString.GetArrayPointer(), lineNumber, posNumber);
@@ -453,7 +536,7 @@ bool decXmlParser::ParseReference(decXmlContainer *container){
 
 bool decXmlParser::ParseCDSect(decXmlContainer *container){
 	decXmlCDSect::Ref cdsect;
-	int nextChar, count = 0;
+	int count = 0;
 	int lineNumber = pTokenLine;
 	int posNumber = pTokenPos;
 	// CDSect ::= CDStart CData CDEnd
@@ -462,8 +545,8 @@ bool decXmlParser::ParseCDSect(decXmlContainer *container){
 	// CDEnd ::= ']]>'
 	if(!ParseToken("<![CDATA[")) return false;
 	while(true){
-		nextChar = GetTokenAt(count);
-		if(nextChar == DEXP_EOF) RaiseFatalError();
+		count = FindTokenChar(count, ']', ']', ']');
+		if(count == -1) RaiseFatalError();
 		if(TestToken(count, "]]>")) break;
 		count++;
 	}
@@ -519,8 +602,9 @@ void decXmlParser::ParseAttValue(decXmlAttValue *value){
 		return;
 	}
 	while(true){
+		count = FindTokenChar(count, delimiter, '<', '&');
+		if(count == -1) RaiseFatalError();
 		nextChar = GetTokenAt(count);
-		if(nextChar == DEXP_EOF) RaiseFatalError();
 		if(nextChar == '<') RaiseFatalError();
 		if(nextChar == delimiter) break;
 		if(nextChar == '&'){
@@ -561,36 +645,39 @@ void decXmlParser::ParseAttValue(decXmlAttValue *value){
 					}
 				}
 				if(GetTokenAt(count) != ';') RaiseFatalError();
-				pTokenLen = safeguard;
 				if(character){
-					AddCharToToken(character);
+					pReplaceInToken(safeguard, count + 1 - safeguard, character);
+					count = safeguard + 1;
+					
+				}else{
+					pReplaceInToken(safeguard, count + 1 - safeguard, -1);
+					count = safeguard;
 				}
-				count = pTokenLen;
 			}else{
 				safeguard = count;
 				count = ParseName(count + 1, false);
 				if(GetTokenAt(count) != ';') RaiseFatalError();
 				
-				const char * const name = pToken.GetArrayPointer() + safeguard + 1;
+				const char * const name = pToken.GetArrayPointer() + pTokenStart + safeguard + 1;
+				character = 0;
 				if(strncmp(name, "lt", 2) == 0){
-					pToken[safeguard] = '<';
-					count = pTokenLen = safeguard + 1;
+					character = '<';
 					
 				}else if(strncmp(name, "gt", 2) == 0){
-					pToken[safeguard] = '>';
-					count = pTokenLen = safeguard + 1;
+					character = '>';
 					
 				}else if(strncmp(name, "amp", 3) == 0){
-					pToken[safeguard] = '&';
-					count = pTokenLen = safeguard + 1;
+					character = '&';
 					
 				}else if(strncmp(name, "quot", 4) == 0){
-					pToken[safeguard] = '"';
-					count = pTokenLen = safeguard + 1;
+					character = '"';
 					
 				}else if(strncmp(name, "apos", 4) == 0){
-					pToken[safeguard] = '\'';
-					count = pTokenLen = safeguard + 1;
+					character = '\'';
+				}
+				if(character){
+					pReplaceInToken(safeguard, count + 1 - safeguard, character);
+					count = safeguard + 1;
 				}
 			}
 		}
@@ -615,11 +702,11 @@ int decXmlParser::ParseSpaces(){
 	int nextChar, count = 0;
 	// S ::= (#x20 | #x9 | #xD | #xA)+
 	while(true){
-		nextChar = GetTokenAt(0);
+		nextChar = GetTokenAt(count);
 		if(nextChar == DEXP_EOF || !IsSpace(nextChar)) break;
-		RemoveFromToken(1);
 		count++;
 	}
+	RemoveFromToken(count);
 	return count;
 }
 
@@ -672,22 +759,16 @@ bool decXmlParser::ParseComment(decXmlContainer *container){
 	decXmlComment::Ref comment;
 	if(!ParseToken("<!--")) return false;
 	while(true){
-		nextChar = GetTokenAt(count);
+		count = FindTokenChar(count, '-', '-', '-');
+		if(count == -1) RaiseFatalError();
+		nextChar = GetTokenAt(count + 1);
 		if(nextChar == DEXP_EOF) RaiseFatalError();
 		if(nextChar == '-'){
-			nextChar = GetTokenAt(count + 1);
-			if(nextChar == DEXP_EOF) RaiseFatalError();
-			if(nextChar == '-'){
-				nextChar = GetTokenAt(count + 2);
-				if(nextChar != '>') RaiseFatalError();
-				break;
-			}
-// 			if( ! IsChar( nextChar ) ) RaiseFatalError();
-			count++;
-		}else{
-// 			if( ! IsChar( nextChar ) ) RaiseFatalError();
+			nextChar = GetTokenAt(count + 2);
+			if(nextChar != '>') RaiseFatalError();
+			break;
 		}
-		count++;
+		count += 2;
 	}
 	// add comment
 	SetCleanString(count);
@@ -720,18 +801,12 @@ bool decXmlParser::ParsePI(decXmlContainer *container){
 	pi->SetPositionNumber(posNumber);
 	if(ParseSpaces() > 0){
 		while(true){
-			nextChar = GetTokenAt(count);
+			count = FindTokenChar(count, '?', '?', '?');
+			if(count == -1) RaiseFatalError();
+			nextChar = GetTokenAt(count + 1);
 			if(nextChar == DEXP_EOF) RaiseFatalError();
-			if(nextChar == '?'){
-				nextChar = GetTokenAt(count + 1);
-				if(nextChar == DEXP_EOF) RaiseFatalError();
-				if(nextChar == '>') break;
-// 					if( ! IsChar( nextChar ) ) RaiseFatalError();
-				count++;
-			}else{
-// 					if( ! IsChar( nextChar ) ) RaiseFatalError();
-			}
-			count++;
+			if(nextChar == '>') break;
+			count += 2;
 		}
 		SetCleanString(count);
 		pi->SetCommand(pCleanString.GetArrayPointer());
@@ -912,54 +987,77 @@ int decXmlParser::GetTokenAt(int index){
 		pGetNextCharAndAdd();
 		if(pCurChar == DEXP_EOF) return DEXP_EOF;
 	}
-	return pToken[index];
+	return pToken.GetArrayPointer()[pTokenStart + index];
 }
 
 void decXmlParser::ClearToken(){
-	int i;
-	for(i=0; i<pTokenLen; i++){
-		if(pToken[i] == '\n'){
-			pTokenLine++;
-			pTokenPos = 0;
-		}
-		pTokenPos++;
-	}
-	pToken[0] = '\0';
+	pAdvanceTokenPosition(pTokenLen);
+	pTokenStart = 0;
 	pTokenLen = 0;
+	pToken[0] = '\0';
 }
 
 void decXmlParser::AddCharToToken(int aChar){
-	if(pTokenLen == pTokenSize) pGrowToken();
-	pToken[pTokenLen] = (char)aChar;
-	pToken[pTokenLen + 1] = '\0';
+	if(pTokenStart + pTokenLen == pTokenSize) pGrowToken(1);
+	char * const token = pToken.GetArrayPointer() + pTokenStart;
+	token[pTokenLen] = (char)aChar;
+	token[pTokenLen + 1] = '\0';
 	pTokenLen++;
 }
 
 void decXmlParser::RemoveFromToken(int length){
 	if(length == 0) return;
 	if(length > pTokenLen) DETHROW(deeInvalidParam);
-	int i, copyLen = pTokenLen - length;
-	for(i=0; i<length; i++){
-		if(pToken[i] == '\n'){
-			pTokenLine++;
-			pTokenPos = 0;
+	pAdvanceTokenPosition(length);
+	pTokenLen -= length;
+	if(pTokenLen > 0){
+		pTokenStart += length;
+		
+	}else{
+		pTokenStart = 0;
+		pToken[0] = '\0';
+	}
+}
+
+int decXmlParser::FindTokenChar(int offset, int character1, int character2, int character3){
+	if(offset < 0) DETHROW(deeInvalidParam);
+	if(offset > pTokenLen && GetTokenAt(offset - 1) == DEXP_EOF) return -1;
+	
+	if(offset < pTokenLen){
+		const int found = vFindChar(pToken.GetArrayPointer() + pTokenStart + offset,
+			pTokenLen - offset, character1, character2, character3);
+		if(found != -1){
+			return offset + found;
 		}
-		pTokenPos++;
 	}
-	for(i=0; i<copyLen; i++){
-		pToken[i] = pToken[i + length];
+	
+	while(pReadPos < pReadLen || pFillReadBuffer()){
+		const char * const data = pReadData + pReadPos;
+		const int length = pReadLen - pReadPos;
+		const int found = vFindChar(data, length, character1, character2, character3);
+		const int tokenLen = pTokenLen;
+		
+		if(found != -1){
+			pAppendToken(data, found + 1);
+			pReadPos += found + 1;
+			return tokenLen + found;
+		}
+		
+		pAppendToken(data, length);
+		pReadPos += length;
 	}
-	pToken[copyLen] = '\0';
-	pTokenLen = copyLen;
+	
+	pCurChar = DEXP_EOF;
+	return -1;
 }
 
 bool decXmlParser::IsEOF(){
-	return pFilePos >= pFileLen;
+	return pReadPos >= pReadLen && pFilePos >= pFileLen;
 }
 
 void decXmlParser::RaiseFatalError(){
 	if(pTokenLen){
-		UnexpectedToken(pTokenLine, pTokenPos, pToken.GetArrayPointer());
+		UnexpectedToken(pTokenLine, pTokenPos, pToken.GetArrayPointer() + pTokenStart);
 	}else{
 		UnexpectedEOF(pTokenLine, pTokenPos);
 	}
@@ -974,9 +1072,9 @@ void decXmlParser::SetCleanString(int length){
 		pCleanStringSize = length;
 	}
 	#ifdef OS_W32_VS
-		strncpy_s(pCleanString.GetArrayPointer(), length + 1, pToken.GetArrayPointer(), length);
+		strncpy_s(pCleanString.GetArrayPointer(), length + 1, pToken.GetArrayPointer() + pTokenStart, length);
 	#else
-		strncpy(pCleanString.GetArrayPointer(), pToken.GetArrayPointer(), length);
+		strncpy(pCleanString.GetArrayPointer(), pToken.GetArrayPointer() + pTokenStart, length);
 	#endif
 	pCleanString[length] = '\0';
 }
@@ -986,42 +1084,100 @@ void decXmlParser::SetCleanString(int length){
 // Private Functions
 //////////////////////
 
-void decXmlParser::pGetNextChar(){
-	if(IsEOF()){
+void decXmlParser::pGetNextCharAndAdd(){
+	if(pReadPos == pReadLen && !pFillReadBuffer()){
 		pCurChar = DEXP_EOF;
+		
 	}else{
-		if(pCurChar == '\n'){
-			pLine++;
-			pPos = 0;
-		}
-		pCurChar = pFile->ReadChar();
-		pFilePos++;
-		pPos++;
+		pCurChar = pReadData[pReadPos++];
+		AddCharToToken(pCurChar);
 	}
 }
 
-void decXmlParser::pGetNextCharAndAdd(){
-	if(IsEOF()){
-		pCurChar = DEXP_EOF;
-	}else{
-		if(pCurChar == '\n'){
-			pLine++;
-			pPos = 0;
-		}
-		pCurChar = pFile->ReadChar();
-		AddCharToToken(pCurChar);
-		pFilePos++;
-		pPos++;
+bool decXmlParser::pFillReadBuffer(){
+	if(pFilePos >= pFileLen){
+		return false;
+	}
+	
+	if(pReadBuffer.GetCount() < ReadBufferSize){
+		pReadBuffer.SetCountDiscard(ReadBufferSize);
 	}
+	
+	const int length = pFileLen - pFilePos < ReadBufferSize ? pFileLen - pFilePos : ReadBufferSize;
+	pFile->Read(pReadBuffer.GetArrayPointer(), length);
+	pFilePos += length;
+	
+	pReadData = pReadBuffer.GetArrayPointer();
+	pReadPos = 0;
+	pReadLen = length;
+	return true;
 }
 
-void decXmlParser::pGrowToken(){
+void decXmlParser::pAppendToken(const char *data, int length){
+	if(pTokenStart + pTokenLen + length > pTokenSize) pGrowToken(length);
+	char * const token = pToken.GetArrayPointer() + pTokenStart;
+	memcpy(token + pTokenLen, data, length);
+	pTokenLen += length;
+	token[pTokenLen] = '\0';
+}
+
+void decXmlParser::pReplaceInToken(int offset, int length, int character){
+	char * const token = pToken.GetArrayPointer() + pTokenStart;
+	const int replaceLength = character != -1 ? 1 : 0;
+	const int moveLength = pTokenLen - offset - length;
+	
+	if(character != -1){
+		token[offset] = (char)character;
+	}
+	memmove(token + offset + replaceLength, token + offset + length, moveLength + 1);
+	pTokenLen -= length - replaceLength;
+}
+
+void decXmlParser::pGrowToken(int length){
+	// move token to the start of the buffer first. this is done only if the token is
+	// not longer than the free space at the start to avoid moving long tokens repeatedly
+	if(pTokenStart > 0 && pTokenStart >= pTokenLen){
+		char * const token = pToken.GetArrayPointer();
+		memmove(token, token + pTokenStart, pTokenLen + 1);
+		pTokenStart = 0;
+	}
+	
+	if(pTokenStart + pTokenLen + length <= pTokenSize){
+		return;
+	}
+	
 	int newSize = pTokenSize * 3 / 2 + 1;
+	if(newSize < pTokenStart + pTokenLen + length){
+		newSize = pTokenStart + pTokenLen + length;
+	}
 	pToken.SetCount(newSize + 1, 0);
-	pToken[pTokenLen] = '\0';
+	pToken[pTokenStart + pTokenLen] = '\0';
 	pTokenSize = newSize;
 }
 
+void decXmlParser::pAdvanceTokenPosition(int length){
+	const char * const token = pToken.GetArrayPointer() + pTokenStart;
+	const char * const end = token + length;
+	const char *lastNewline = nullptr;
+	const char *next = token;
+	
+	while(next < end){
+		next = (const char *)memchr(next, '\n', end - next);
+		if(!next){
+			break;
+		}
+		lastNewline = next++;
+		pTokenLine++;
+	}
+	
+	if(lastNewline){
+		pTokenPos = (int)(end - lastNewline);
+		
+	}else{
+		pTokenPos += length;
+	}
+}
+
 void decXmlParser::pAddCharacterData(decXmlContainer *container, const char *text, int line, int pos){
 	int count = container->GetElementCount();
 	
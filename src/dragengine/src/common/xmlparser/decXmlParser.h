@@ -46,6 +46,11 @@ class deLogger;
  * The XML Paser processes an XML file provided by a file reader object. The content of
  * the file is parsed and syntax checked but not validated. The resulting XML tree is
  * then available in the document. One parser can not parse two XML files at the same time.
+ * 
+ * The file is read in blocks of \ref ReadBufferSize bytes. Memory mapped files are parsed
+ * directly from the mapped memory. Character data, attribute values, comments, CDATA
+ * sections and processing instructions are scanned for their delimiters using SIMD
+ * instructions where available. After parsing the file position is undefined.
  *
  * A typical scenario looks like this:
  * \code decXMLParser parser;
@@ -58,12 +63,20 @@ class deLogger;
  * \endcode
  */
 class DE_DLL_EXPORT decXmlParser{
+public:
+	/**
+	 * \brief Size in bytes of blocks read from the file.
+	 * \version 1.34
+	 */
+	static const int ReadBufferSize = 65536;
+	
+	
+	
 private:
 	decBaseFileReader *pFile;
-	int pLine;
-	int pPos;
 	int pCurChar;
 	decTList<char> pToken;
+	int pTokenStart;
 	int pTokenLen;
 	int pTokenSize;
 	int pTokenLine;
@@ -72,6 +85,10 @@ private:
 	int pCleanStringSize;
 	int pFilePos;
 	int pFileLen;
+	decTList<char> pReadBuffer;
+	const char *pReadData;
+	int pReadPos;
+	int pReadLen;
 	
 	deLogger *pLogger;
 	bool pHasFatalError;
@@ -277,6 +294,18 @@ public:
 	/** \brief Add character to the token buffer. */
 	void AddCharToToken(int aChar);
 	
+	/**
+	 * \brief Index of first character matching one of the given characters.
+	 * \version 1.34
+	 * 
+	 * Searches starting offset characters ahead of the current position. All characters
+	 * up to and including the found character are read into the token buffer. To search
+	 * for less than three characters repeat characters.
+	 * 
+	 * \returns Index ahead of current position or -1 if the end of the file is reached.
+	 */
+	int FindTokenChar(int offset, int character1, int character2, int character3);
+	
 	/** \brief Current position is at the end of the xml file. */
 	bool IsEOF();
 	
@@ -298,9 +327,12 @@ public:
 	
 	
 private:
-	void pGetNextChar();
 	void pGetNextCharAndAdd();
-	void pGrowToken();
+	bool pFillReadBuffer();
+	void pAppendToken(const char *data, int length);
+	void pReplaceInToken(int offset, int length, int character);
+	void pGrowToken(int length);
+	void pAdvanceTokenPosition(int length);
 	void pAddCharacterData(decXmlContainer *container, const char *text, int line, int pos);
 	void pAddCharacterData(decXmlContainer *container, char character, int line, int pos);
 };
@@ -1291,6 +1291,12 @@ void deEngine::pCleanUp(){
 		delete pResLoader;
 	}
 	
+	if(pVFS && pVFS->GetLookupCacheEnabled()){
+		pLogger->LogInfoFormat(LOGGING_NAME, "VFS lookup cache: %llu hits, %llu misses, %llu container probes saved",
+			(unsigned long long)pVFS->GetLookupCacheHits(), (unsigned long long)pVFS->GetLookupCacheMisses(),
+			(unsigned long long)pVFS->GetLookupCacheProbesSaved());
+	}
+	
 	// remove all containers from the virtual file system. this prevents archive containers
 	// to be reported as leaking. it is normal for them to be still held by the virtual file
 	// system. from here on nobody has to access the virtual file system anymore
@@ -0,0 +1,839 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>
+#include <zlib.h>
+
+#include "deCachePack.h"
+#include "deCachePackWriter.h"
+#include "deCollectFileSearchVisitor.h"
+
+#include "../common/file/decLZ4Codec.h"
+#include "../common/file/decMemoryFileReader.h"
+#include "../common/exceptions.h"
+#include "../logger/deLogger.h"
+#include "../threading/deMutexGuard.h"
+
+
+// Definitions
+////////////////
+
+#define INDEX_VERSION 1
+
+static const char * const vIndexSignature = "DECP";
+
+
+static char vCompressionCode(deCachePack::eCompressionMethods compression){
+	switch(compression){
+	case deCachePack::ecmZCompression:
+		return 'z';
+		
+	case deCachePack::ecmFastCompression:
+		return 'f';
+		
+	default:
+		return '-';
+	}
+}
+
+static deCachePack::eCompressionMethods vCompressionMethod(int code){
+	switch(code){
+	case '-':
+		return deCachePack::ecmNoCompression;
+		
+	case 'z':
+		return deCachePack::ecmZCompression;
+		
+	case 'f':
+		return deCachePack::ecmFastCompression;
+		
+	default:
+		DETHROW(deeInvalidFormat);
+	}
+}
+
+static inline int vRecordSize(int idLength, int storedSize){
+	// string16 id, compression byte, size, stored size
+	return 2 + idLength + 1 + 4 + 4 + storedSize;
+}
+
+
+
+// Class deCachePack
+//////////////////////
+
+// Constructor, destructor
+////////////////////////////
+
+deCachePack::deCachePack(deVirtualFileSystem *vfs, const decPath &cachePath) :
+pCachePath(cachePath),
+pCompressionMethod(ecmZCompression),
+pSegmentSize(DefaultSegmentSize),
+pMaxSize(DefaultMaxSize),
+pPendingSegment(0),
+pNextSegment(0),
+pOpenReaderCount(0),
+pAccessCounter(0),
+pUsedSize(0),
+pDiskSize(0),
+pIndexChanged(false)
+{
+	DEASSERT_NOTNULL(vfs)
+	
+	pVFS = vfs;
+	pLoad();
+	
+	pPendingSegment = pNextSegment++;
+	pResetPending();
+}
+
+deCachePack::~deCachePack(){
+	try{
+		Flush();
+		
+	}catch(const deException &){
+		// entries are already written. the index is restored the next time
+	}
+}
+
+
+
+// Management
+///////////////
+
+void deCachePack::SetCompressionMethod(eCompressionMethods compressionMethod){
+	const deMutexGuard guard(pMutex);
+	pCompressionMethod = compressionMethod;
+}
+
+void deCachePack::SetSegmentSize(int size){
+	DEASSERT_TRUE(size > 0)
+	
+	const deMutexGuard guard(pMutex);
+	pSegmentSize = size;
+}
+
+void deCachePack::SetMaxSize(uint64_t size){
+	const deMutexGuard guard(pMutex);
+	pMaxSize = size;
+	pEnforceMaxSize();
+}
+
+int deCachePack::GetEntryCount(){
+	const deMutexGuard guard(pMutex);
+	return pEntries.GetCount();
+}
+
+uint64_t deCachePack::GetUsedSize(){
+	const deMutexGuard guard(pMutex);
+	return pUsedSize;
+}
+
+uint64_t deCachePack::GetDiskSize(){
+	const deMutexGuard guard(pMutex);
+	return pDiskSize;
+}
+
+int deCachePack::GetSegmentCount(){
+	const deMutexGuard guard(pMutex);
+	return pSegments.GetCount();
+}
+
+
+
+decBaseFileReader::Ref deCachePack::Read(const char *id){
+	DEASSERT_NOTNULL(id)
+	
+	decMemoryFile::Ref stored;
+	sEntry entry;
+	
+	{
+	const deMutexGuard guard(pMutex);
+	const sEntry *found;
+	if(!pEntries.GetAt(id, found)){
+		return {};
+	}
+	
+	found->access = ++pAccessCounter;
+	pIndexChanged = true;
+	entry = *found;
+	
+	stored = decMemoryFile::Ref::New(id);
+	stored->Resize(entry.storedSize);
+	
+	try{
+		pReadStored(entry, stored->GetPointer());
+		
+	}catch(const deException &){
+		pRemoveEntry(id, entry);
+		return {};
+	}
+	}
+	
+	if(entry.compression == ecmNoCompression){
+		return decMemoryFileReader::Ref::New(stored);
+	}
+	
+	// decompress outside the lock so multiple threads can read at the same time
+	const decMemoryFile::Ref data(decMemoryFile::Ref::New(id));
+	data->Resize(entry.size);
+	
+	try{
+		switch(entry.compression){
+		case ecmZCompression:{
+			uLongf size = (uLongf)entry.size;
+			if(uncompress((Bytef*)data->GetPointer(), &size, (const Bytef*)stored->GetPointer(),
+			(uLong)entry.storedSize) != Z_OK || size != (uLongf)entry.size){
+				DETHROW(deeInvalidFormat);
+			}
+			}break;
+			
+		case ecmFastCompression:
+			decLZ4Codec::Decompress(stored->GetPointer(), entry.storedSize,
+				data->GetPointer(), entry.size);
+			break;
+			
+		default:
+			DETHROW(deeInvalidFormat);
+		}
+		
+	}catch(const deException &){
+		const deMutexGuard guard(pMutex);
+		const sEntry *found;
+		if(pEntries.GetAt(id, found) && found->segment == entry.segment && found->offset == entry.offset){
+			pRemoveEntry(id, *found);
+		}
+		return {};
+	}
+	
+	return decMemoryFileReader::Ref::New(data);
+}
+
+decBaseFileWriter::Ref deCachePack::Write(const char *id){
+	DEASSERT_NOTNULL(id)
+	
+	{
+	const deMutexGuard guard(pMutex);
+	const sEntry *found;
+	if(pEntries.GetAt(id, found)){
+		pRemoveEntry(id, *found);
+	}
+	}
+	
+	return deCachePackWriter::Ref::New(*this, id);
+}
+
+void deCachePack::Write(const char *id, const void *data, int size){
+	DEASSERT_NOTNULL(id)
+	DEASSERT_TRUE(size >= 0)
+	DEASSERT_TRUE(size == 0 || data)
+	
+	eCompressionMethods compression;
+	{
+	const deMutexGuard guard(pMutex);
+	compression = pCompressionMethod;
+	}
+	
+	// compress outside the lock. compression is only used if it reduces the size
+	decTList<uint8_t> compressed;
+	const void *stored = data;
+	int storedSize = size;
+	
+	if(size > 0){
+		switch(compression){
+		case ecmZCompression:{
+			uLongf compressedSize = compressBound((uLong)size);
+			compressed.SetCountDiscard((int)compressedSize);
+			if(compress2((Bytef*)compressed.GetArrayPointer(), &compressedSize,
+			(const Bytef*)data, (uLong)size, Z_DEFAULT_COMPRESSION) != Z_OK){
+				DETHROW(deeInvalidAction);
+			}
+			storedSize = (int)compressedSize;
+			}break;
+			
+		case ecmFastCompression:{
+			const int bound = decLZ4Codec::CompressBound(size);
+			compressed.SetCountDiscard(bound);
+			storedSize = decLZ4Codec::Compress(data, size, compressed.GetArrayPointer(), bound);
+			}break;
+			
+		default:
+			break;
+		}
+		
+		if(storedSize < size){
+			stored = compressed.GetArrayPointer();
+			
+		}else{
+			compression = ecmNoCompression;
+			storedSize = size;
+		}
+		
+	}else{
+		compression = ecmNoCompression;
+	}
+	
+	const deMutexGuard guard(pMutex);
+	const sEntry *found;
+	if(pEntries.GetAt(id, found)){
+		pRemoveEntry(id, *found);
+	}
+	
+	pAppendEntry(id, compression, size, stored, storedSize);
+	pEnforceMaxSize();
+}
+
+void deCachePack::Delete(const char *id){
+	DEASSERT_NOTNULL(id)
+	
+	const deMutexGuard guard(pMutex);
+	const sEntry *found;
+	if(pEntries.GetAt(id, found)){
+		pRemoveEntry(id, *found);
+	}
+}
+
+void deCachePack::DeleteAll(){
+	const deMutexGuard guard(pMutex);
+	
+	pEntries.RemoveAll();
+	pSegments.GetKeys().Visit([&](int segment){
+		pRemoveSegment(segment);
+	});
+	pResetPending();
+	
+	pUsedSize = 0;
+	pDiskSize = 0;
+	pIndexChanged = true;
+	
+	const decPath path(pIndexPath());
+	if(pVFS->ExistsFile(path)){
+		pVFS->DeleteFile(path);
+	}
+}
+
+void deCachePack::Flush(){
+	const deMutexGuard guard(pMutex);
+	
+	pFlushPending();
+	
+	if(pIndexChanged){
+		pSaveIndex();
+	}
+}
+
+void deCachePack::DebugPrint(deLogger &logger, const char *loggingSource){
+	const deMutexGuard guard(pMutex);
+	
+	logger.LogInfoFormat(loggingSource, "Cache Pack '%s': %d entries, %d segments, %llu bytes used, %llu bytes on disk",
+		pCachePath.GetPathUnix().GetString(), pEntries.GetCount(), pSegments.GetCount(),
+		(unsigned long long)pUsedSize, (unsigned long long)pDiskSize);
+	
+	pEntries.Visit([&](const decString &id, const sEntry &entry){
+		logger.LogInfoFormat(loggingSource, "- '%s' => s%d:%d (%d of %d bytes, %c)", id.GetString(),
+			entry.segment, entry.offset, entry.storedSize, entry.size, vCompressionCode(entry.compression));
+	});
+}
+
+
+
+// Private Functions
+//////////////////////
+
+decPath deCachePack::pSegmentPath(int segment) const{
+	decString title;
+	title.Format("s%d", segment);
+	
+	decPath path(pCachePath);
+	path.AddComponent(title);
+	return path;
+}
+
+decPath deCachePack::pIndexPath() const{
+	decPath path(pCachePath);
+	path.AddComponent("index");
+	return path;
+}
+
+void deCachePack::pLoad(){
+	// find all segment files
+	deCollectFileSearchVisitor collect("s*");
+	pVFS->SearchFiles(pCachePath, collect);
+	
+	decTDictionary<int, int> segmentFiles;
+	collect.GetFiles().Visit([&](const decPath &file){
+		const decString title(file.GetLastComponent());
+		const int length = title.GetLength();
+		int i;
+		
+		if(length < 2){
+			return;
+		}
+		for(i=1; i<length; i++){
+			if(title[i] < '0' || title[i] > '9'){
+				return;
+			}
+		}
+		
+		const uint64_t size = pVFS->GetFileSize(file);
+		if(size <= (uint64_t)decLZ4Codec::MaxBlockSize){
+			segmentFiles.SetAt(title.GetMiddle(1).ToInt(), (int)size);
+		}
+	});
+	
+	// load index. if the index is missing or damaged all segments are scanned
+	try{
+		pLoadIndex(segmentFiles);
+		
+	}catch(const deException &){
+		pEntries.RemoveAll();
+		pSegments.RemoveAll();
+		pAccessCounter = 0;
+	}
+	
+	// scan segments not covered by the index. segments are scanned in the order
+	// they have been written so newer entries replace older ones
+	decTList<int> segments(segmentFiles.GetKeys());
+	segments.SortAscending();
+	
+	segments.Visit([&](int segment){
+		if(segment >= pNextSegment){
+			pNextSegment = segment + 1;
+		}
+		if(!pSegments.Has(segment)){
+			pSegments.SetAt(segment, sSegment{segmentFiles.GetAt(segment), 0, {}, 0});
+			pScanSegment(segment, segmentFiles.GetAt(segment));
+			pIndexChanged = true;
+		}
+	});
+	
+	// calculate usage and drop segments not used by any entry
+	pUsedSize = 0;
+	pEntries.Visit([&](const decString &id, const sEntry &entry){
+		const int recordSize = vRecordSize(id.GetLength(), entry.storedSize);
+		pSegments.GetAt(entry.segment).usedSize += recordSize;
+		pUsedSize += recordSize;
+	});
+	
+	pDiskSize = 0;
+	pSegments.Visit([&](int, const sSegment &segment){
+		pDiskSize += (uint64_t)segment.size;
+	});
+	
+	pSegments.GetKeys().Visit([&](int segment){
+		if(pSegments.GetAt(segment).usedSize == 0){
+			try{
+				pRemoveSegment(segment);
+				
+			}catch(const deException &){
+			}
+		}
+	});
+}
+
+void deCachePack::pLoadIndex(const decTDictionary<int, int> &segmentFiles){
+	const decPath path(pIndexPath());
+	if(!pVFS->ExistsFile(path)){
+		return;
+	}
+	
+	const decBaseFileReader::Ref reader(pVFS->OpenFileForReading(path));
+	char signature[4];
+	
+	reader->Read(signature, 4);
+	if(memcmp(signature, vIndexSignature, 4) != 0 || reader->ReadByte() != INDEX_VERSION){
+		DETHROW(deeInvalidFormat);
+	}
+	
+	// segments are only used if they exist with the same size as while writing the index
+	const int segmentCount = reader->ReadInt();
+	int i;
+	
+	for(i=0; i<segmentCount; i++){
+		const int segment = reader->ReadInt();
+		const int size = reader->ReadInt();
+		
+		if(segmentFiles.GetAtOrDefault(segment, -1) == size){
+			pSegments.SetAt(segment, sSegment{size, 0, {}, 0});
+		}
+	}
+	
+	// entries
+	const int entryCount = reader->ReadInt();
+	decString id;
+	sEntry entry;
+	
+	for(i=0; i<entryCount; i++){
+		reader->ReadString16Into(id);
+		entry.segment = reader->ReadInt();
+		entry.offset = reader->ReadInt();
+		entry.storedSize = reader->ReadInt();
+		entry.size = reader->ReadInt();
+		entry.compression = vCompressionMethod(reader->ReadByte());
+		entry.access = reader->ReadULong();
+		
+		const sSegment *segment;
+		if(!pSegments.GetAt(entry.segment, segment) || entry.offset < 0 || entry.storedSize < 0
+		|| entry.size < 0 || entry.storedSize > segment->size - entry.offset){
+			continue;
+		}
+		
+		pEntries.SetAt(id, entry);
+		
+		if(entry.access > pAccessCounter){
+			pAccessCounter = entry.access;
+		}
+	}
+	
+	reader->Read(signature, 4);
+	if(memcmp(signature, vIndexSignature, 4) != 0){
+		DETHROW(deeInvalidFormat);
+	}
+}
+
+void deCachePack::pScanSegment(int segment, int size){
+	try{
+		const decBaseFileReader::Ref reader(pVFS->OpenFileForReading(pSegmentPath(segment)));
+		decString id;
+		sEntry entry;
+		
+		entry.segment = segment;
+		
+		while(reader->GetPosition() < size){
+			reader->ReadString16Into(id);
+			entry.compression = vCompressionMethod(reader->ReadByte());
+			entry.size = reader->ReadInt();
+			entry.storedSize = reader->ReadInt();
+			entry.offset = reader->GetPosition();
+			
+			if(entry.size < 0 || entry.storedSize < 0 || entry.storedSize > size - entry.offset){
+				break;
+			}
+			
+			// entries stored in newer segments or later in the same segment are newer
+			const sEntry *found;
+			if(!pEntries.GetAt(id, found) || found->segment <= segment){
+				entry.access = ++pAccessCounter;
+				pEntries.SetAt(id, entry);
+			}
+			
+			reader->MovePosition(entry.storedSize);
+		}
+		
+	}catch(const deException &){
+		// truncated or damaged segment. keep the entries found so far
+	}
+}
+
+void deCachePack::pSaveIndex(){
+	const decBaseFileWriter::Ref writer(pVFS->OpenFileForWriting(pIndexPath()));
+	
+	writer->Write(vIndexSignature, 4);
+	writer->WriteByte(INDEX_VERSION);
+	
+	writer->WriteInt(pSegments.GetCount());
+	pSegments.Visit([&](int segment, const sSegment &data){
+		writer->WriteInt(segment);
+		writer->WriteInt(data.size);
+	});
+	
+	writer->WriteInt(pEntries.GetCount());
+	pEntries.Visit([&](const decString &id, const sEntry &entry){
+		writer->WriteString16(id);
+		writer->WriteInt(entry.segment);
+		writer->WriteInt(entry.offset);
+		writer->WriteInt(entry.storedSize);
+		writer->WriteInt(entry.size);
+		writer->WriteByte(vCompressionCode(entry.compression));
+		writer->WriteULong(entry.access);
+	});
+	
+	writer->Write(vIndexSignature, 4);
+	
+	pIndexChanged = false;
+}
+
+void deCachePack::pAppendEntry(const char *id, eCompressionMethods compression,
+int size, const void *data, int storedSize){
+	if(!pSegments.Has(pPendingSegment)){
+		pSegments.SetAt(pPendingSegment, sSegment{0, 0, {}, 0});
+	}
+	
+	const int recordOffset = pPendingWriter->GetPosition();
+	pPendingWriter->WriteString16(id);
+	pPendingWriter->WriteByte(vCompressionCode(compression));
+	pPendingWriter->WriteInt(size);
+	pPendingWriter->WriteInt(storedSize);
+	
+	sEntry entry;
+	entry.segment = pPendingSegment;
+	entry.offset = pPendingWriter->GetPosition();
+	entry.storedSize = storedSize;
+	entry.size = size;
+	entry.compression = compression;
+	entry.access = ++pAccessCounter;
+	
+	if(storedSize > 0){
+		pPendingWriter->Write(data, storedSize);
+	}
+	
+	// append the record to the segment file right away so entries survive the
+	// application exiting without flushing. the pending data is kept in memory
+	// for reading entries without reopening the segment file while writing it
+	try{
+		if(!pPendingFile){
+			pPendingFile = pVFS->OpenFileForWriting(pSegmentPath(pPendingSegment));
+		}
+		pPendingFile->Write(pPendingData->GetPointer() + recordOffset,
+			pPendingData->GetLength() - recordOffset);
+		pPendingFile->Flush();
+		
+	}catch(const deException &){
+		// the segment file is missing the record. finish the segment with the entries
+		// written so far. scanning the segment drops a partially written record
+		pFlushPending();
+		throw;
+	}
+	
+	pEntries.SetAt(id, entry);
+	
+	sSegment &segment = pSegments.GetAt(pPendingSegment);
+	const int growth = pPendingData->GetLength() - segment.size;
+	segment.size = pPendingData->GetLength();
+	segment.usedSize += growth;
+	pUsedSize += (uint64_t)growth;
+	pDiskSize += (uint64_t)growth;
+	pIndexChanged = true;
+	
+	if(segment.size >= pSegmentSize){
+		pFlushPending();
+	}
+}
+
+void deCachePack::pFlushPending(){
+	const sSegment *segment;
+	if(!pSegments.GetAt(pPendingSegment, segment)){
+		return;
+	}
+	
+	pPendingFile = nullptr;
+	
+	if(segment->usedSize > 0){
+		pPendingSegment = pNextSegment++;
+		pSaveIndex();
+		
+	}else{
+		pRemoveSegment(pPendingSegment);
+	}
+	
+	pResetPending();
+}
+
+void deCachePack::pResetPending(){
+	pPendingData = decMemoryFile::Ref::New("pending");
+	pPendingWriter = decMemoryFileWriter::Ref::New(pPendingData, false);
+}
+
+void deCachePack::pRemoveEntry(const char *id, const sEntry &entry){
+	const int segmentIndex = entry.segment;
+	const int recordSize = vRecordSize((int)strlen(id), entry.storedSize);
+	
+	pEntries.Remove(id);
+	pUsedSize -= (uint64_t)recordSize;
+	pIndexChanged = true;
+	
+	sSegment &segment = pSegments.GetAt(segmentIndex);
+	segment.usedSize -= recordSize;
+	
+	if(segment.usedSize == 0 && segmentIndex != pPendingSegment){
+		pRemoveSegment(segmentIndex);
+	}
+}
+
+void deCachePack::pRemoveSegment(int segment){
+	const sSegment &data = pSegments.GetAt(segment);
+	if(data.reader){
+		pOpenReaderCount--;
+	}
+	pDiskSize -= (uint64_t)data.size;
+	
+	pSegments.Remove(segment);
+	pIndexChanged = true;
+	
+	if(segment == pPendingSegment){
+		pPendingFile = nullptr;
+	}
+	
+	const decPath path(pSegmentPath(segment));
+	if(pVFS->ExistsFile(path)){
+		pVFS->DeleteFile(path);
+	}
+}
+
+void deCachePack::pReadStored(const sEntry &entry, void *data){
+	if(entry.storedSize == 0){
+		return;
+	}
+	
+	if(entry.segment == pPendingSegment){
+		memcpy(data, pPendingData->GetPointer() + entry.offset, entry.storedSize);
+		return;
+	}
+	
+	sSegment &segment = pSegments.GetAt(entry.segment);
+	
+	if(!segment.reader){
+		if(pOpenReaderCount >= MaxOpenSegments){
+			int closeSegment = -1;
+			uint64_t closeAccess = 0;
+			
+			pSegments.Visit([&](int key, const sSegment &each){
+				if(each.reader && (closeSegment == -1 || each.readerAccess < closeAccess)){
+					closeSegment = key;
+					closeAccess = each.readerAccess;
+				}
+			});
+			
+			pSegments.GetAt(closeSegment).reader = nullptr;
+			pOpenReaderCount--;
+		}
+		
+		segment.reader = pVFS->OpenFileForReading(pSegmentPath(entry.segment));
+		pOpenReaderCount++;
+	}
+	
+	segment.readerAccess = pAccessCounter;
+	segment.reader->SetPosition(entry.offset);
+	segment.reader->Read(data, entry.storedSize);
+}
+
+
+
+void deCachePack::pEnforceMaxSize(){
+	if(pDiskSize <= pMaxSize){
+		return;
+	}
+	
+	// evict down to three quarters of the maximum size. this avoids evicting entries
+	// every time a new entry is added once the cache pack is full
+	const uint64_t targetSize = pMaxSize / 4 * 3;
+	if(pUsedSize > targetSize){
+		pEvictEntries(targetSize);
+	}
+	
+	pCompactSegments();
+}
+
+void deCachePack::pEvictEntries(uint64_t targetSize){
+	struct sCandidate{
+		decString id;
+		uint64_t access;
+	};
+	
+	decTList<sCandidate> candidates;
+	pEntries.Visit([&](const decString &id, const sEntry &entry){
+		candidates.Add(sCandidate{id, entry.access});
+	});
+	
+	candidates.Sort([](const sCandidate &a, const sCandidate &b){
+		return a.access < b.access ? -1 : (a.access > b.access ? 1 : 0);
+	});
+	
+	const int count = candidates.GetCount();
+	int i;
+	
+	for(i=0; i<count && pUsedSize > targetSize; i++){
+		const decString &id = candidates.GetAt(i).id;
+		const sEntry *found;
+		if(pEntries.GetAt(id, found)){
+			pRemoveEntry(id, *found);
+		}
+	}
+}
+
+void deCachePack::pCompactSegments(){
+	// write the pending segment first so it can be compacted like all other segments
+	pFlushPending();
+	
+	// segments with more than a quarter unused are compacted
+	decTList<int> segments;
+	pSegments.Visit([&](int segment, const sSegment &data){
+		if(segment != pPendingSegment && data.usedSize < data.size / 4 * 3){
+			segments.Add(segment);
+		}
+	});
+	
+	if(segments.IsEmpty()){
+		return;
+	}
+	
+	struct sMove{
+		decString id;
+		sEntry entry;
+	};
+	
+	decTList<sMove> moves;
+	pEntries.Visit([&](const decString &id, const sEntry &entry){
+		if(segments.Has(entry.segment)){
+			moves.Add(sMove{id, entry});
+		}
+	});
+	
+	// move entries into the pending segment keeping their last access. segments are
+	// not removed while moving since they still contain entries to move
+	decTList<uint8_t> data;
+	
+	moves.Visit([&](const sMove &move){
+		const sEntry &entry = move.entry;
+		const int recordSize = vRecordSize(move.id.GetLength(), entry.storedSize);
+		
+		data.SetCountDiscard(entry.storedSize);
+		try{
+			pReadStored(entry, data.GetArrayPointer());
+			
+		}catch(const deException &){
+			pEntries.Remove(move.id);
+			pSegments.GetAt(entry.segment).usedSize -= recordSize;
+			pUsedSize -= (uint64_t)recordSize;
+			return;
+		}
+		
+		pSegments.GetAt(entry.segment).usedSize -= recordSize;
+		pUsedSize -= (uint64_t)recordSize;
+		
+		pAppendEntry(move.id, entry.compression, entry.size, data.GetArrayPointer(), entry.storedSize);
+		
+		const sEntry *found;
+		if(pEntries.GetAt(move.id, found)){
+			found->access = entry.access;
+		}
+	});
+	
+	// write moved entries before deleting the compacted segments
+	pFlushPending();
+	
+	segments.Visit([&](int segment){
+		pRemoveSegment(segment);
+	});
+}
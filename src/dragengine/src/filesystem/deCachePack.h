@@ -0,0 +1,256 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DECACHEPACK_H_
+#define _DECACHEPACK_H_
+
+#include <stdint.h>
+
+#include "deVirtualFileSystem.h"
+#include "../common/collection/decTDictionary.h"
+#include "../common/file/decPath.h"
+#include "../common/file/decMemoryFile.h"
+#include "../common/file/decMemoryFileWriter.h"
+#include "../common/file/decBaseFileReader.h"
+#include "../common/file/decBaseFileWriter.h"
+#include "../threading/deMutex.h"
+
+class deLogger;
+
+
+/**
+ * \brief Packed cache storing entries in a small number of segment files.
+ * \version 1.34
+ * 
+ * Alternative to \ref deCacheHelper for caches with large numbers of entries. Entries
+ * are identified by a unique string identifier like with \ref deCacheHelper. Instead of
+ * storing each entry in an individual file entries are appended to segment files. The
+ * location of all entries is stored in an index file loaded once while creating the
+ * cache pack. Looking up entries uses a hash table and reading an entry requires a
+ * single read from an already opened segment file.
+ * 
+ * New entries are appended to the pending segment file right away. Once the pending
+ * segment is full the next segment is started. Full segments are never modified
+ * afterwards. Replacing or deleting entries only marks the data in the segment as
+ * unused. The index is written whenever a segment is full and while flushing the cache
+ * pack. If the index is missing or outdated, for example because the application
+ * exited without flushing, segment files not covered by the index are scanned to
+ * restore the entries they contain.
+ * 
+ * The total size of segment files is kept below a maximum size. If the maximum size
+ * is exceeded the least recently used entries are evicted and segments with lots of
+ * unused data are compacted by moving the remaining entries into new segments.
+ * 
+ * Entries can be stored uncompressed, compressed using zlib or compressed using fast
+ * LZ4 block compression. Fast compression decompresses considerably faster than zlib
+ * at the cost of larger files. Compression is only used if it reduces the size.
+ * 
+ * Readers returned by \ref Read hold the entry content in memory. Writers returned by
+ * \ref Write collect the entry content in memory and store the entry once the writer
+ * is released. Readers and writers can thus be used without holding any locks.
+ * Cache pack is thread safe. The cache pack has to outlive all writers.
+ */
+class DE_DLL_EXPORT deCachePack{
+public:
+	/** \brief Compression methods for new cached entries. */
+	enum eCompressionMethods{
+		/** \brief Do not compress new cached entry content. */
+		ecmNoCompression,
+		
+		/** \brief Compress new cached entry content using Zlib compression. */
+		ecmZCompression,
+		
+		/** \brief Compress new cached entry content using fast LZ4 block compression. */
+		ecmFastCompression
+	};
+	
+	/** \brief Default size in bytes of segments. */
+	static const int DefaultSegmentSize = 16777216;
+	
+	/** \brief Default maximum size in bytes of all segments. */
+	static const uint64_t DefaultMaxSize = 1073741824;
+	
+	/** \brief Maximum number of segment files kept open for reading. */
+	static const int MaxOpenSegments = 16;
+	
+	
+	
+private:
+	struct sEntry{
+		int segment;
+		int offset;
+		int storedSize;
+		int size;
+		eCompressionMethods compression;
+		
+		/** \brief Last access. Mutable to update it while looking up entries. */
+		mutable uint64_t access;
+	};
+	
+	struct sSegment{
+		int size;
+		int usedSize;
+		decBaseFileReader::Ref reader;
+		uint64_t readerAccess;
+	};
+	
+	deVirtualFileSystem::Ref pVFS;
+	decPath pCachePath;
+	
+	eCompressionMethods pCompressionMethod;
+	int pSegmentSize;
+	uint64_t pMaxSize;
+	
+	decTStringDictionary<sEntry> pEntries;
+	decTDictionary<int, sSegment> pSegments;
+	decMemoryFile::Ref pPendingData;
+	decMemoryFileWriter::Ref pPendingWriter;
+	decBaseFileWriter::Ref pPendingFile;
+	int pPendingSegment;
+	int pNextSegment;
+	int pOpenReaderCount;
+	uint64_t pAccessCounter;
+	uint64_t pUsedSize;
+	uint64_t pDiskSize;
+	bool pIndexChanged;
+	
+	deMutex pMutex;
+	
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/** \brief Create cache pack loading the index from the cache directory. */
+	deCachePack(deVirtualFileSystem *vfs, const decPath &cachePath);
+	
+	/** \brief Clean up cache pack flushing pending entries. */
+	~deCachePack();
+	/*@}*/
+	
+	
+	
+	/** \name Management */
+	/*@{*/
+	/** \brief Cache directory. */
+	inline const decPath &GetCachePath() const{ return pCachePath; }
+	
+	/** \brief Compression method to use for new cached entries. */
+	inline eCompressionMethods GetCompressionMethod() const{ return pCompressionMethod; }
+	
+	/** \brief Set compression method to use for new cached entries. */
+	void SetCompressionMethod(eCompressionMethods compressionMethod);
+	
+	/** \brief Size in bytes of segments. */
+	inline int GetSegmentSize() const{ return pSegmentSize; }
+	
+	/**
+	 * \brief Set size in bytes of segments.
+	 * \throws deeInvalidParam \em size is less than 1.
+	 */
+	void SetSegmentSize(int size);
+	
+	/** \brief Maximum size in bytes of all segments. */
+	inline uint64_t GetMaxSize() const{ return pMaxSize; }
+	
+	/**
+	 * \brief Set maximum size in bytes of all segments.
+	 * 
+	 * Evicts least recently used entries if the cache pack is larger than \em size.
+	 */
+	void SetMaxSize(uint64_t size);
+	
+	/** \brief Count of entries. */
+	int GetEntryCount();
+	
+	/** \brief Size in bytes of all entries including entry headers. */
+	uint64_t GetUsedSize();
+	
+	/** \brief Size in bytes of all segments including unused data. */
+	uint64_t GetDiskSize();
+	
+	/** \brief Count of segments including the pending segment. */
+	int GetSegmentCount();
+	
+	
+	
+	/**
+	 * \brief Open cache entry by identifier for reading if existing.
+	 * \returns nullptr if entry is absent.
+	 */
+	decBaseFileReader::Ref Read(const char *id);
+	
+	/**
+	 * \brief Open cache entry by identifier for writing.
+	 * 
+	 * Removes the existing entry. The entry is stored once the returned writer is released.
+	 */
+	decBaseFileWriter::Ref Write(const char *id);
+	
+	/** \brief Store cache entry. */
+	void Write(const char *id, const void *data, int size);
+	
+	/** \brief Delete cache entry by identifier if present. */
+	void Delete(const char *id);
+	
+	/** \brief Delete all cache entries. */
+	void DeleteAll();
+	
+	/**
+	 * \brief Finish pending segment and write index to the cache directory.
+	 * 
+	 * Entries are written to the segment files while they are stored. Flushing only
+	 * writes the index to avoid scanning the pending segment the next time.
+	 */
+	void Flush();
+	
+	/** \brief Debug print stats about the cache to a logger. */
+	void DebugPrint(deLogger &logger, const char *loggingSource);
+	/*@}*/
+	
+	
+	
+private:
+	decPath pSegmentPath(int segment) const;
+	decPath pIndexPath() const;
+	
+	void pLoad();
+	void pLoadIndex(const decTDictionary<int, int> &segmentFiles);
+	void pScanSegment(int segment, int size);
+	
+	void pSaveIndex();
+	void pAppendEntry(const char *id, eCompressionMethods compression,
+		int size, const void *data, int storedSize);
+	void pFlushPending();
+	void pResetPending();
+	void pRemoveEntry(const char *id, const sEntry &entry);
+	void pRemoveSegment(int segment);
+	void pReadStored(const sEntry &entry, void *data);
+	
+	void pEnforceMaxSize();
+	void pEvictEntries(uint64_t targetSize);
+	void pCompactSegments();
+};
+
+#endif
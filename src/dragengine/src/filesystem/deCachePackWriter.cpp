@@ -0,0 +1,55 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "deCachePack.h"
+#include "deCachePackWriter.h"
+#include "../common/exceptions.h"
+
+
+// Class deCachePackWriter
+////////////////////////////
+
+// Constructor, destructor
+////////////////////////////
+
+deCachePackWriter::deCachePackWriter(deCachePack &pack, const char *id) :
+deCachePackWriter(pack, id, decMemoryFile::Ref::New(id)){
+}
+
+deCachePackWriter::deCachePackWriter(deCachePack &pack, const char *id, decMemoryFile *data) :
+decMemoryFileWriter(data, false),
+pPack(pack),
+pId(id),
+pData(data){
+}
+
+deCachePackWriter::~deCachePackWriter(){
+	try{
+		pPack.Write(pId, pData->GetPointer(), pData->GetLength());
+		
+	}catch(const deException &){
+		// failing to store a cache entry is not an error. the entry is missing
+		// the next time it is read causing the user to create it again
+	}
+}
@@ -0,0 +1,91 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DECACHEPACKWRITER_H_
+#define _DECACHEPACKWRITER_H_
+
+#include "../common/file/decMemoryFile.h"
+#include "../common/file/decMemoryFileWriter.h"
+#include "../common/string/decString.h"
+
+class deCachePack;
+
+
+/**
+ * \brief Writer storing cache pack entry once released.
+ * \version 1.34
+ * 
+ * Collects the entry content in memory. Once the last reference to the writer is
+ * released the content is stored in the cache pack. Duplicates of the writer write
+ * into the same memory but do not store the entry.
+ */
+class DE_DLL_EXPORT deCachePackWriter : public decMemoryFileWriter{
+public:
+	/** \brief Type holding strong reference. */
+	using Ref = deTObjectReference<deCachePackWriter>;
+	
+	
+	
+private:
+	deCachePack &pPack;
+	const decString pId;
+	const decMemoryFile::Ref pData;
+	
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/** \brief Create cache pack writer. */
+	deCachePackWriter(deCachePack &pack, const char *id);
+	
+protected:
+	/**
+	 * \brief Store entry and clean up cache pack writer.
+	 * \note Subclasses should set their destructor protected too to avoid users
+	 * accidently deleting a reference counted object through the object
+	 * pointer. Only FreeReference() is allowed to delete the object.
+	 */
+	~deCachePackWriter() override;
+	/*@}*/
+	
+	
+	
+public:
+	/** \name Management */
+	/*@{*/
+	/** \brief Cache pack. */
+	inline deCachePack &GetPack() const{ return pPack; }
+	
+	/** \brief Entry identifier. */
+	inline const decString &GetId() const{ return pId; }
+	/*@}*/
+	
+	
+	
+private:
+	deCachePackWriter(deCachePack &pack, const char *id, decMemoryFile *data);
+};
+
+#endif
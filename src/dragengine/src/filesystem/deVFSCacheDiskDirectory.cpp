@@ -409,6 +409,8 @@ void deVFSCacheDiskDirectory::UpdateCache(){
 			if(pCacheSize < 0){
 				pCacheSize = 0;
 			}
+			
+			NotifyContentChanged();
 		}
 	}
 }
@@ -36,12 +36,14 @@
 
 deVFSContainer::deVFSContainer() :
 pRootPath(decPath::CreatePathUnix("/")),
-pHidden(false){
+pHidden(false),
+pContentRevision(0){
 }
 
 deVFSContainer::deVFSContainer(const decPath &rootPath) :
 pRootPath(rootPath),
-pHidden(false){
+pHidden(false),
+pContentRevision(0){
 }
 
 deVFSContainer::~deVFSContainer(){
@@ -70,14 +72,25 @@ bool deVFSContainer::HasHiddenPath(const decPath &path) const{
 
 void deVFSContainer::AddHiddenPath(const decPath &path){
 	pHiddenPath.Add(path);
+	NotifyContentChanged();
 }
 
 void deVFSContainer::RemoveHiddenPath(const decPath &path){
 	pHiddenPath.Remove(path);
+	NotifyContentChanged();
 }
 
 void deVFSContainer::RemoveAllHiddenPath(){
 	pHiddenPath.RemoveAll();
+	NotifyContentChanged();
+}
+
+uint32_t deVFSContainer::GetContentRevision(){
+	return pContentRevision.load(std::memory_order_acquire);
+}
+
+void deVFSContainer::NotifyContentChanged(){
+	pContentRevision.fetch_add(1, std::memory_order_acq_rel);
 }
 
 bool deVFSContainer::IsPathHiddenBelow(const decPath &path){
@@ -26,7 +26,7 @@
 #define _DEVFSCONTAINER_H_
 
 #include <stdint.h>
-
+#include <atomic>
 
 #include "../deObject.h"
 #include "../common/collection/decTOrderedSet.h"
@@ -84,6 +84,7 @@ private:
 	const decPath pRootPath;
 	bool pHidden;
 	decPath::List pHiddenPath;
+	std::atomic<uint32_t> pContentRevision;
 	
 	
 	
@@ -156,6 +157,25 @@ public:
 	 */
 	void RemoveAllHiddenPath();
 	
+	/**
+	 * \brief Content revision.
+	 * \version 1.34
+	 * 
+	 * Incremented each time the content of the container changes. Used by
+	 * \ref deVirtualFileSystem to invalidate the lookup cache. Subclasses forwarding
+	 * to other containers or virtual file systems add their revision.
+	 */
+	virtual uint32_t GetContentRevision();
+	
+	/**
+	 * \brief Notify content of container changed.
+	 * \version 1.34
+	 * 
+	 * Increments the content revision. Call after files have been added, removed or
+	 * modified other than through \ref deVirtualFileSystem.
+	 */
+	void NotifyContentChanged();
+	
 	
 	
 	/**
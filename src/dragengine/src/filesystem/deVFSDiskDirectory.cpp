@@ -284,7 +284,10 @@ decBaseFileWriter::Ref deVFSDiskDirectory::OpenFileForWriting(const decPath &pat
 	diskPath.RemoveLastComponent();
 	pEnsureDirectoryExists(diskPath);
 	
-	return decDiskFileWriter::Ref::New((pDiskPath + path).GetPathNative(), false);
+	const decBaseFileWriter::Ref writer(decDiskFileWriter::Ref::New(
+		(pDiskPath + path).GetPathNative(), false));
+	NotifyContentChanged();
+	return writer;
 }
 
 void deVFSDiskDirectory::DeleteFile(const decPath &path){
@@ -334,6 +337,8 @@ void deVFSDiskDirectory::DeleteFile(const decPath &path){
 		}
 	}
 #endif
+	
+	NotifyContentChanged();
 }
 
 void deVFSDiskDirectory::TouchFile(const decPath &path){
@@ -387,6 +392,7 @@ void deVFSDiskDirectory::TouchFile(const decPath &path){
 	pEnsureDirectoryExists(diskPath);
 	
 	decDiskFileWriter::Ref writer(decDiskFileWriter::Ref::New(npath, false));
+	NotifyContentChanged();
 }
 
 void deVFSDiskDirectory::SearchFiles(const decPath &directory, deContainerFileSearch &searcher){
@@ -189,6 +189,7 @@ void deVFSMemoryFiles::AddMemoryFile(decMemoryFile *memoryFile){
 	
 	pFiles.Add(memoryFile);
 	pDirtyDirectories = true;
+	NotifyContentChanged();
 }
 
 void deVFSMemoryFiles::RemoveMemoryFile(decMemoryFile *memoryFile){
@@ -199,12 +200,14 @@ void deVFSMemoryFiles::RemoveMemoryFile(decMemoryFile *memoryFile){
 	
 	pFiles.RemoveFrom(index);
 	pDirtyDirectories = true;
+	NotifyContentChanged();
 }
 
 void deVFSMemoryFiles::RemoveAllMemoryFiles(){
 	pFiles.RemoveAll();
 	pDirectories.RemoveAll();
 	pDirtyDirectories = false;
+	NotifyContentChanged();
 }
 
 
@@ -198,3 +198,12 @@ TIME_SYSTEM deVFSRedirect::GetFileModificationTime(const decPath &path){
 		return pVFS->GetFileModificationTime(pRedirectPath + path);
 	}
 }
+
+uint32_t deVFSRedirect::GetContentRevision(){
+	if(pContainer){
+		return deVFSContainer::GetContentRevision() + pContainer->GetContentRevision();
+		
+	}else{
+		return deVFSContainer::GetContentRevision() + pVFS->GetContentRevision();
+	}
+}
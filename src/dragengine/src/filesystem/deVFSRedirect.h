@@ -190,6 +190,14 @@ public:
 	 * If the file does not exist an exception is thrown.
 	 */
 	TIME_SYSTEM GetFileModificationTime(const decPath &path) override;
+	
+	/**
+	 * \brief Content revision.
+	 * \version 1.34
+	 * 
+	 * Adds the content revision of the redirected container or virtual file system.
+	 */
+	uint32_t GetContentRevision() override;
 	/*@}*/
 };
 
@@ -33,6 +33,7 @@
 #include "../common/exceptions.h"
 #include "../common/file/decPath.h"
 #include "../common/string/decStringSet.h"
+#include "../threading/deMutexGuard.h"
 
 
 
@@ -86,7 +87,13 @@ public:
 // Constructor, destructor
 ////////////////////////////
 
-deVirtualFileSystem::deVirtualFileSystem(){
+deVirtualFileSystem::deVirtualFileSystem() :
+pRevision(0),
+pLookupCacheEnabled(false),
+pLookupCacheRevision(0),
+pLookupCacheHits(0),
+pLookupCacheMisses(0),
+pLookupCacheProbesSaved(0){
 }
 
 deVirtualFileSystem::~deVirtualFileSystem(){
@@ -98,45 +105,13 @@ deVirtualFileSystem::~deVirtualFileSystem(){
 ///////////////
 
 bool deVirtualFileSystem::ExistsFile(const decPath &path) const{
-	const int count = pContainers.GetCount();
 	decPath relativePath;
-	int i;
-	
-	for(i=count-1; i>=0; i--){
-		deVFSContainer &container = pContainers.GetAt(i);
-		if(!pMatchContainer(container, path, relativePath)){
-			continue;
-		}
-		if(container.ExistsFile(relativePath)){
-			return true;
-		}
-		if(container.IsPathHiddenBelow(relativePath)){
-			break;
-		}
-	}
-	
-	return false;
+	return pFindContainer(path, relativePath, false) != nullptr;
 }
 
 bool deVirtualFileSystem::CanReadFile(const decPath &path) const{
-	const int count = pContainers.GetCount();
 	decPath relativePath;
-	int i;
-	
-	for(i=count-1; i>=0; i--){
-		deVFSContainer &container = pContainers.GetAt(i);
-		if(!pMatchContainer(container, path, relativePath)){
-			continue;
-		}
-		if(container.CanReadFile(relativePath)){
-			return true;
-		}
-		if(container.IsPathHiddenBelow(relativePath)){
-			break;
-		}
-	}
-	
-	return false;
+	return pFindContainer(path, relativePath, true) != nullptr;
 }
 
 bool deVirtualFileSystem::CanWriteFile(const decPath &path) const{
@@ -182,24 +157,12 @@ bool deVirtualFileSystem::CanDeleteFile(const decPath &path) const{
 }
 
 decBaseFileReader::Ref deVirtualFileSystem::OpenFileForReading(const decPath &path) const{
-	const int count = pContainers.GetCount();
 	decPath relativePath;
-	int i;
-	
-	for(i=count-1; i>=0; i--){
-		deVFSContainer &container = pContainers.GetAt(i);
-		if(!pMatchContainer(container, path, relativePath)){
-			continue;
-		}
-		if(container.CanReadFile(relativePath)){
-			return container.OpenFileForReading(relativePath);
-		}
-		if(container.IsPathHiddenBelow(relativePath)){
-			break;
-		}
+	deVFSContainer * const container = pFindContainer(path, relativePath, true);
+	if(!container){
+		DETHROW_INFO(deeFileNotFound, path.GetPathUnix());
 	}
-	
-	DETHROW_INFO(deeFileNotFound, path.GetPathUnix());
+	return container->OpenFileForReading(relativePath);
 }
 
 decBaseFileWriter::Ref deVirtualFileSystem::OpenFileForWriting(const decPath &path) const{
@@ -213,7 +176,9 @@ decBaseFileWriter::Ref deVirtualFileSystem::OpenFileForWriting(const decPath &pa
 			continue;
 		}
 		if(container.CanWriteFile(relativePath)){
-			return container.OpenFileForWriting(relativePath);
+			const decBaseFileWriter::Ref writer(container.OpenFileForWriting(relativePath));
+			pContentChanged();
+			return writer;
 		}
 		if(container.IsPathHiddenBelow(relativePath)){
 			break;
@@ -240,6 +205,8 @@ void deVirtualFileSystem::DeleteFile(const decPath &path) const{
 			break;
 		}
 	}
+	
+	pContentChanged();
 }
 
 void deVirtualFileSystem::TouchFile(const decPath &path) const{
@@ -259,6 +226,8 @@ void deVirtualFileSystem::TouchFile(const decPath &path) const{
 			break;
 		}
 	}
+	
+	pContentChanged();
 }
 
 // TODO change this implementation to not use decStringSet but a structure (string, eFileTypes).
@@ -383,66 +352,30 @@ void deVirtualFileSystem::SearchFiles(const decPath &directory, deFileSearchVisi
 }
 
 deVFSContainer::eFileTypes deVirtualFileSystem::GetFileType(const decPath& path) const{
-	const int count = pContainers.GetCount();
 	decPath relativePath;
-	int i;
-	
-	for(i=count-1; i>=0; i--){
-		deVFSContainer &container = pContainers.GetAt(i);
-		if(!pMatchContainer(container, path, relativePath)){
-			continue;
-		}
-		if(container.ExistsFile(relativePath)){
-			return container.GetFileType(relativePath);
-		}
-		if(container.IsPathHiddenBelow(relativePath)){
-			break;
-		}
+	deVFSContainer * const container = pFindContainer(path, relativePath, false);
+	if(!container){
+		DETHROW_INFO(deeFileNotFound, path.GetPathUnix());
 	}
-	
-	DETHROW_INFO(deeFileNotFound, path.GetPathUnix());
+	return container->GetFileType(relativePath);
 }
 
 uint64_t deVirtualFileSystem::GetFileSize(const decPath &path) const{
-	const int count = pContainers.GetCount();
 	decPath relativePath;
-	int i;
-	
-	for(i=count-1; i>=0; i--){
-		deVFSContainer &container = pContainers.GetAt(i);
-		if(!pMatchContainer(container, path, relativePath)){
-			continue;
-		}
-		if(container.ExistsFile(relativePath)){
-			return container.GetFileSize(relativePath);
-		}
-		if(container.IsPathHiddenBelow(relativePath)){
-			break;
-		}
+	deVFSContainer * const container = pFindContainer(path, relativePath, false);
+	if(!container){
+		DETHROW_INFO(deeFileNotFound, path.GetPathUnix());
 	}
-	
-	DETHROW_INFO(deeFileNotFound, path.GetPathUnix());
+	return container->GetFileSize(relativePath);
 }
 
 TIME_SYSTEM deVirtualFileSystem::GetFileModificationTime(const decPath &path) const{
-	const int count = pContainers.GetCount();
 	decPath relativePath;
-	int i;
-	
-	for(i=count-1; i>=0; i--){
-		deVFSContainer &container = pContainers.GetAt(i);
-		if(!pMatchContainer(container, path, relativePath)){
-			continue;
-		}
-		if(container.ExistsFile(relativePath)){
-			return container.GetFileModificationTime(relativePath);
-		}
-		if(container.IsPathHiddenBelow(relativePath)){
-			break;
-		}
+	deVFSContainer * const container = pFindContainer(path, relativePath, false);
+	if(!container){
+		DETHROW_INFO(deeFileNotFound, path.GetPathUnix());
 	}
-	
-	DETHROW_INFO(deeFileNotFound, path.GetPathUnix());
+	return container->GetFileModificationTime(relativePath);
 }
 
 
@@ -453,14 +386,72 @@ TIME_SYSTEM deVirtualFileSystem::GetFileModificationTime(const decPath &path) co
 void deVirtualFileSystem::AddContainer(deVFSContainer *container){
 	DEASSERT_NOTNULL(container)
 	pContainers.Add(container);
+	pContentChanged();
 }
 
 void deVirtualFileSystem::RemoveContainer(deVFSContainer *container){
+	// keep the content revision increasing by adding the revision of the removed container
+	DEASSERT_NOTNULL(container)
+	const uint32_t revision = container->GetContentRevision();
 	pContainers.Remove(container);
+	pRevision += revision;
+	pContentChanged();
 }
 
 void deVirtualFileSystem::RemoveAllContainers(){
+	pRevision += pContainers.Inject(0u, [](uint32_t revision, deVFSContainer *container){
+		return revision + container->GetContentRevision();
+	});
 	pContainers.RemoveAll();
+	pContentChanged();
+}
+
+uint32_t deVirtualFileSystem::GetContentRevision() const{
+	return pContainers.Inject(pRevision.load(), [](uint32_t revision, deVFSContainer *container){
+		return revision + container->GetContentRevision();
+	});
+}
+
+
+
+// Lookup cache
+/////////////////
+
+void deVirtualFileSystem::SetLookupCacheEnabled(bool enabled){
+	if(enabled == pLookupCacheEnabled){
+		return;
+	}
+	
+	pLookupCacheEnabled = enabled;
+	ClearLookupCache();
+}
+
+void deVirtualFileSystem::ClearLookupCache(){
+	const deMutexGuard lock(pMutexLookupCache);
+	pLookupCacheExists.RemoveAll();
+	pLookupCacheReadable.RemoveAll();
+}
+
+uint64_t deVirtualFileSystem::GetLookupCacheHits() const{
+	const deMutexGuard lock(pMutexLookupCache);
+	return pLookupCacheHits;
+}
+
+uint64_t deVirtualFileSystem::GetLookupCacheMisses() const{
+	const deMutexGuard lock(pMutexLookupCache);
+	return pLookupCacheMisses;
+}
+
+uint64_t deVirtualFileSystem::GetLookupCacheProbesSaved() const{
+	const deMutexGuard lock(pMutexLookupCache);
+	return pLookupCacheProbesSaved;
+}
+
+void deVirtualFileSystem::ResetLookupCacheCounters(){
+	const deMutexGuard lock(pMutexLookupCache);
+	pLookupCacheHits = 0;
+	pLookupCacheMisses = 0;
+	pLookupCacheProbesSaved = 0;
 }
 
 
@@ -468,6 +459,89 @@ void deVirtualFileSystem::RemoveAllContainers(){
 // Private Functions
 //////////////////////
 
+deVFSContainer *deVirtualFileSystem::pFindContainer(const decPath &path,
+decPath &relativePath, bool readable) const{
+	int probes = 0, index;
+	
+	if(!pLookupCacheEnabled){
+		index = pProbeContainers(path, relativePath, readable, probes);
+		return index != -1 ? pContainers.GetAt(index).Pointer() : nullptr;
+	}
+	
+	// containers are probed without holding the mutex since containers like
+	// deVFSRedirect can call back into this virtual file system
+	const uint32_t revision = GetContentRevision();
+	const decString key(path.GetPathUnix());
+	decTStringDictionary<sLookupResult> &cache = readable ? pLookupCacheReadable : pLookupCacheExists;
+	
+	{
+	const deMutexGuard lock(pMutexLookupCache);
+	
+	if(revision != pLookupCacheRevision){
+		pLookupCacheExists.RemoveAll();
+		pLookupCacheReadable.RemoveAll();
+		pLookupCacheRevision = revision;
+	}
+	
+	const sLookupResult *result;
+	if(cache.GetAt(key, result)){
+		pLookupCacheHits++;
+		pLookupCacheProbesSaved += result->probes;
+		
+		if(result->container == -1){
+			return nullptr;
+		}
+		
+		deVFSContainer * const container = pContainers.GetAt(result->container);
+		pMatchContainer(*container, path, relativePath);
+		return container;
+	}
+	
+	pLookupCacheMisses++;
+	}
+	
+	index = pProbeContainers(path, relativePath, readable, probes);
+	
+	{
+	const deMutexGuard lock(pMutexLookupCache);
+	if(revision == pLookupCacheRevision){
+		if(cache.GetCount() >= 65536){
+			cache.RemoveAll();
+		}
+		cache.SetAt(key, {index, probes});
+	}
+	}
+	
+	return index != -1 ? pContainers.GetAt(index).Pointer() : nullptr;
+}
+
+int deVirtualFileSystem::pProbeContainers(const decPath &path,
+decPath &relativePath, bool readable, int &probes) const{
+	const int count = pContainers.GetCount();
+	int i;
+	
+	for(i=count-1; i>=0; i--){
+		deVFSContainer &container = pContainers.GetAt(i);
+		if(!pMatchContainer(container, path, relativePath)){
+			continue;
+		}
+		
+		probes++;
+		if(readable ? container.CanReadFile(relativePath) : container.ExistsFile(relativePath)){
+			return i;
+		}
+		if(container.IsPathHiddenBelow(relativePath)){
+			break;
+		}
+	}
+	
+	return -1;
+}
+
+void deVirtualFileSystem::pContentChanged() const{
+	pRevision++;
+}
+
 bool deVirtualFileSystem::pMatchContainer(deVFSContainer &container,
 const decPath &absolutePath, decPath &relativePath) const{
 	const int absoluteComponentCount = absolutePath.GetComponentCount();
@@ -25,10 +25,14 @@
 #ifndef _DEVIRTUALFILESYSTEM_H_
 #define _DEVIRTUALFILESYSTEM_H_
 
+#include <atomic>
+
 #include "deVFSContainer.h"
 #include "../deObject.h"
+#include "../common/collection/decTDictionary.h"
 #include "../common/file/decBaseFileReader.h"
 #include "../common/file/decBaseFileWriter.h"
+#include "../threading/deMutex.h"
 
 class decPath;
 class deFileSearchVisitor;
@@ -51,6 +55,21 @@ class deFileSearchVisitor;
  * if containers are modified only before using the VFS but not while using it.
  * If you need to change the containers while using the VFS use the deVFSModular
  * container. This container is safe to be modified while in use.
+ * 
+ * \par Lookup cache
+ * 
+ * Optionally the container resolving a path can be cached. Each lookup walks all
+ * matching containers from the back probing the path. For disk containers each probe
+ * is a file system call. With the lookup cache enabled the index of the container
+ * found for a path is stored as well as if no container has been found. The lookup
+ * cache is used by ExistsFile, CanReadFile, OpenFileForReading, GetFileType,
+ * GetFileSize and GetFileModificationTime.
+ * 
+ * The cache is cleared if the content revision changes. This is the case if containers
+ * are added or removed, files are written, deleted or touched through the virtual file
+ * system or containers notify a content change using \ref deVFSContainer::NotifyContentChanged.
+ * Changes done to the underlying file system by other means are not detected. Clear the
+ * cache manually in this case using \ref ClearLookupCache.
  */
 class DE_DLL_EXPORT deVirtualFileSystem : public deObject{
 public:
@@ -59,7 +78,22 @@ public:
 	
 	
 private:
+	struct sLookupResult{
+		int container;
+		int probes;
+	};
+	
 	deVFSContainer::List pContainers;
+	mutable std::atomic<uint32_t> pRevision;
+	
+	bool pLookupCacheEnabled;
+	mutable deMutex pMutexLookupCache;
+	mutable decTStringDictionary<sLookupResult> pLookupCacheExists;
+	mutable decTStringDictionary<sLookupResult> pLookupCacheReadable;
+	mutable uint32_t pLookupCacheRevision;
+	mutable uint64_t pLookupCacheHits;
+	mutable uint64_t pLookupCacheMisses;
+	mutable uint64_t pLookupCacheProbesSaved;
 	
 	
 	
@@ -176,11 +210,77 @@ public:
 	 * \warning Breaks thread-safety if called after VFS is in use.
 	 */
 	void RemoveAllContainers();
+	
+	/**
+	 * \brief Content revision.
+	 * \version 1.34
+	 * 
+	 * Increments each time containers are added or removed, files are modified through
+	 * the virtual file system or the content revision of a container changes.
+	 */
+	uint32_t GetContentRevision() const;
+	/*@}*/
+	
+	
+	
+	/** \name Lookup cache */
+	/*@{*/
+	/**
+	 * \brief Lookup cache is enabled.
+	 * \version 1.34
+	 */
+	inline bool GetLookupCacheEnabled() const{ return pLookupCacheEnabled; }
+	
+	/**
+	 * \brief Set if lookup cache is enabled.
+	 * \version 1.34
+	 * 
+	 * Default is disabled. Clears the lookup cache.
+	 * 
+	 * \warning Breaks thread-safety if called after VFS is in use.
+	 */
+	void SetLookupCacheEnabled(bool enabled);
+	
+	/**
+	 * \brief Clear lookup cache.
+	 * \version 1.34
+	 */
+	void ClearLookupCache();
+	
+	/**
+	 * \brief Count of lookups answered by the lookup cache.
+	 * \version 1.34
+	 */
+	uint64_t GetLookupCacheHits() const;
+	
+	/**
+	 * \brief Count of lookups not answered by the lookup cache.
+	 * \version 1.34
+	 */
+	uint64_t GetLookupCacheMisses() const;
+	
+	/**
+	 * \brief Count of container probes avoided by the lookup cache.
+	 * \version 1.34
+	 * 
+	 * For disk containers each probe is a file system call.
+	 */
+	uint64_t GetLookupCacheProbesSaved() const;
+	
+	/**
+	 * \brief Reset lookup cache counters.
+	 * \version 1.34
+	 */
+	void ResetLookupCacheCounters();
 	/*@}*/
 	
 	
 	
 private:
+	deVFSContainer *pFindContainer(const decPath &path, decPath &relativePath, bool readable) const;
+	int pProbeContainers(const decPath &path, decPath &relativePath, bool readable, int &probes) const;
+	void pContentChanged() const;
+	
 	bool pMatchContainer(deVFSContainer &container,
 		const decPath &absolutePath, decPath &realtivePath) const;
 	bool pMatchContainerParent(deVFSContainer &container, const decPath &path) const;
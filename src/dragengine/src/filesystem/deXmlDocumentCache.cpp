@@ -0,0 +1,101 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "deXmlDocumentCache.h"
+#include "../common/xmlparser/decXmlParser.h"
+#include "../common/xmlparser/decXmlDocument.h"
+#include "../common/exceptions.h"
+#include "../logger/deLogger.h"
+
+
+
+// Class deXmlDocumentCache
+/////////////////////////////
+
+// Constructor, destructor
+////////////////////////////
+
+deXmlDocumentCache::deXmlDocumentCache(deVirtualFileSystem *vfs, const decPath &cachePath) :
+pCachePack(vfs, cachePath)
+{
+	pCachePack.SetCompressionMethod(deCachePack::ecmFastCompression);
+}
+
+deXmlDocumentCache::~deXmlDocumentCache(){
+}
+
+
+
+// Management
+///////////////
+
+decXmlBinaryDocument::Ref deXmlDocumentCache::Load(decBaseFileReader &reader,
+const char *path, deLogger &logger, bool cleanCharData){
+	DEASSERT_NOTNULL(path)
+	
+	const decString id(path);
+	const int64_t modificationTime = (int64_t)reader.GetModificationTime();
+	const int length = reader.GetLength();
+	
+	// use cached document if up to date
+	if(!id.IsEmpty()){
+		try{
+			const decBaseFileReader::Ref cached(pCachePack.Read(id));
+			if(cached && cached->ReadByte() == CacheVersion && cached->ReadLong() == modificationTime
+			&& cached->ReadInt() == length && (cached->ReadByte() != 0) == cleanCharData){
+				return decXmlBinaryDocument::Ref::New(cached);
+			}
+			
+		}catch(const deException &){
+			// damaged or outdated entry. parse the file and replace the entry
+		}
+	}
+	
+	// parse and cache document
+	const decXmlDocument::Ref document(decXmlDocument::Ref::New());
+	const bool parsed = decXmlParser(&logger).ParseXml(&reader, document);
+	
+	document->StripComments();
+	if(cleanCharData){
+		document->CleanCharData();
+	}
+	
+	const decXmlBinaryDocument::Ref binaryDocument(decXmlBinaryDocument::Ref::New(document));
+	
+	if(parsed && !id.IsEmpty()){
+		try{
+			const decBaseFileWriter::Ref writer(pCachePack.Write(id));
+			writer->WriteByte(CacheVersion);
+			writer->WriteLong(modificationTime);
+			writer->WriteInt(length);
+			writer->WriteByte(cleanCharData ? 1 : 0);
+			binaryDocument->Save(writer);
+			
+		}catch(const deException &){
+			// caching is optional
+		}
+	}
+	
+	return binaryDocument;
+}
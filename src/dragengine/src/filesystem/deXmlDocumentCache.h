@@ -0,0 +1,97 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DEXMLDOCUMENTCACHE_H_
+#define _DEXMLDOCUMENTCACHE_H_
+
+#include "deCachePack.h"
+#include "../common/xmlparser/decXmlBinaryDocument.h"
+
+class deLogger;
+
+
+/**
+ * \brief Cache of precompiled XML documents.
+ * \version 1.34
+ * 
+ * Stores \ref decXmlBinaryDocument of parsed XML files in a \ref deCachePack. Entries are
+ * identified by the absolute VFS path of the XML file. File readers are not used for this
+ * since readers of archive files report only the file name. The modification time and size of the file are
+ * stored with the entry. Entries are used only if both match the file. Otherwise the file
+ * is parsed and the cache entry replaced.
+ * 
+ * Documents are stored with comments stripped and character data cleaned like XML based
+ * resource loaders do after parsing XML files. Loaders keeping white space in character
+ * data can disable cleaning. Documents failing to parse are not cached.
+ * 
+ * Cache is thread safe.
+ */
+class DE_DLL_EXPORT deXmlDocumentCache{
+public:
+	/** \brief Cache entry version. */
+	static const int CacheVersion = 2;
+	
+	
+	
+private:
+	deCachePack pCachePack;
+	
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/** \brief Create xml document cache storing entries in cache directory. */
+	deXmlDocumentCache(deVirtualFileSystem *vfs, const decPath &cachePath);
+	
+	/** \brief Clean up xml document cache. */
+	~deXmlDocumentCache();
+	/*@}*/
+	
+	
+	
+	/** \name Management */
+	/*@{*/
+	/** \brief Cache pack storing the entries. */
+	inline deCachePack &GetCachePack(){ return pCachePack; }
+	
+	/**
+	 * \brief Load document from file reader.
+	 * 
+	 * Returns the cached document if present and up to date. Otherwise parses the XML
+	 * file from the current file position and caches the parsed document. If \em path
+	 * is empty the document is parsed without using the cache.
+	 * 
+	 * \param[in] reader XML file to load.
+	 * \param[in] path Absolute VFS path of XML file identifying the cache entry.
+	 * \param[in] logger Logger to report parse errors to.
+	 * \param[in] cleanCharData Clean character data after parsing. Cached entries are used
+	 *                          only if they have been stored with the same setting.
+	 */
+	decXmlBinaryDocument::Ref Load(decBaseFileReader &reader, const char *path,
+		deLogger &logger, bool cleanCharData = true);
+	/*@}*/
+};
+
+#endif
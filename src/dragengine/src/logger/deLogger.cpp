@@ -150,3 +150,6 @@ void deLogger::LogException(const char *source, const deException &exception){
 		LogError(source, output.GetAt(i));
 	}
 }
+
+void deLogger::Flush(){
+}
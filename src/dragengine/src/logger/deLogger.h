@@ -151,6 +151,15 @@ public:
 	 * empty string or "exception(file:line): message" otherwise.
 	 */
 	virtual void LogException(const char *source, const deException &exception);
+	
+	/**
+	 * \brief Flush logged messages to their final destination.
+	 * \version 1.34
+	 * 
+	 * Called by loggers deferring output like \ref deLoggerAsync after writing a batch of
+	 * messages. The default implementation does nothing.
+	 */
+	virtual void Flush();
 	/*@}*/
 };
 
@@ -0,0 +1,301 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <thread>
+
+#include "deLoggerAsync.h"
+#include "../common/exceptions.h"
+#include "../common/math/decMath.h"
+#include "../common/utils/decTimer.h"
+#include "../threading/deMutexGuard.h"
+#include "../threading/deThread.h"
+
+
+// Class deLoggerAsync::cWriterThread
+///////////////////////////////////////
+
+class deLoggerAsync::cWriterThread : public deThread{
+private:
+	deLoggerAsync &pLogger;
+	
+public:
+	explicit cWriterThread(deLoggerAsync &logger) : pLogger(logger){
+	}
+	
+	void Run() override{
+		pLogger.pWriterRun();
+	}
+};
+
+
+
+// Class deLoggerAsync
+////////////////////////
+
+// Constructor, destructor
+////////////////////////////
+
+deLoggerAsync::deLoggerAsync(deLogger *target, int capacity) :
+pTarget(target),
+pSlots(nullptr),
+pSlotMask(0),
+pEnqueuePosition(0),
+pDequeuePosition(0),
+pFlushSize(65536),
+pFlushInterval(0.1f),
+pWriterSleeping(false),
+pStopWriter(false),
+pFlushRequested(false),
+pFlushPosition(0)
+{
+	DEASSERT_NOTNULL(target)
+	DEASSERT_TRUE(capacity >= 2)
+	
+	uint32_t slotCount = 2;
+	while(slotCount < (uint32_t)capacity){
+		slotCount <<= 1;
+	}
+	
+	pSlots = new sSlot[slotCount];
+	pSlotMask = slotCount - 1;
+	
+	uint32_t i;
+	for(i=0; i<slotCount; i++){
+		pSlots[i].sequence.store(i, std::memory_order_relaxed);
+	}
+	
+	try{
+		pThread = deTUniqueReference<cWriterThread>::New(*this);
+		pThread->Start();
+		
+	}catch(const deException &){
+		pThread.Clear();
+		delete [] pSlots;
+		throw;
+	}
+}
+
+deLoggerAsync::~deLoggerAsync(){
+	pStopWriter = true;
+	pWakeWriter();
+	pThread->WaitForExit();
+	pThread.Clear();
+	
+	delete [] pSlots;
+}
+
+
+
+// Management
+///////////////
+
+void deLoggerAsync::SetFlushSize(int size){
+	pFlushSize = decMath::max(size, 0);
+}
+
+void deLoggerAsync::SetFlushInterval(float interval){
+	pFlushInterval = decMath::max(interval, 0.0f);
+}
+
+
+
+void deLoggerAsync::LogInfo(const char *source, const char *message){
+	pEnqueue(emtInfo, source, message);
+}
+
+void deLoggerAsync::LogWarn(const char *source, const char *message){
+	pEnqueue(emtWarn, source, message);
+}
+
+void deLoggerAsync::LogError(const char *source, const char *message){
+	pEnqueue(emtError, source, message);
+	Flush();
+}
+
+void deLoggerAsync::Flush(){
+	const deMutexGuard lock(pMutexFlush);
+	
+	// all positions claimed so far have to be written before the flush is done. this
+	// includes messages still being copied into their slot by other logging threads
+	pFlushPosition = pEnqueuePosition.load();
+	pFlushRequested = true;
+	pWakeWriter();
+	pSemaphoreFlushed.Wait();
+}
+
+
+
+// Private Functions
+//////////////////////
+
+void deLoggerAsync::pEnqueue(eMessageTypes type, const char *source, const char *message){
+	DEASSERT_NOTNULL(source)
+	DEASSERT_NOTNULL(message)
+	
+	// bounded multi-producer queue. each slot carries a sequence number telling producers
+	// and the writer thread if the slot is free for the position to claim or filled
+	uint32_t position = pEnqueuePosition.load(std::memory_order_relaxed);
+	sSlot *slot;
+	
+	while(true){
+		slot = pSlots + (position & pSlotMask);
+		const int32_t difference = (int32_t)(slot->sequence.load(std::memory_order_acquire) - position);
+		
+		if(difference == 0){
+			if(pEnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)){
+				break;
+			}
+			
+		}else if(difference < 0){
+			// queue is full. let the writer thread make room
+			pWakeWriter();
+			std::this_thread::yield();
+			position = pEnqueuePosition.load(std::memory_order_relaxed);
+			
+		}else{
+			position = pEnqueuePosition.load(std::memory_order_relaxed);
+		}
+	}
+	
+	slot->type = type;
+	slot->source = source;
+	slot->message = message;
+	slot->sequence.store(position + 1);
+	
+	pWakeWriter();
+}
+
+void deLoggerAsync::pWakeWriter(){
+	if(pWriterSleeping.exchange(false)){
+		pSemaphoreWake.Signal();
+	}
+}
+
+void deLoggerAsync::pWriterRun(){
+	int unflushedBytes = 0;
+	bool unflushed = false;
+	decTimer timer;
+	
+	while(true){
+		const bool stop = pStopWriter.load();
+		
+		int writtenBytes = 0;
+		if(pWriteBatch(writtenBytes) > 0){
+			unflushedBytes += writtenBytes;
+			unflushed = true;
+		}
+		
+		// a flush request is done once all messages claimed before the request have been
+		// written. the batch stops at slots claimed but not filled yet. in this case the
+		// request stays pending until the logging thread filled the slot and woke us up
+		const bool flushRequested = pIsFlushDue();
+		
+		// give logging threads a chance to add more messages before flushing a drained queue
+		bool drained = !pHasQueuedMessage();
+		if(drained && unflushed && !flushRequested && !stop){
+			std::this_thread::yield();
+			drained = !pHasQueuedMessage();
+		}
+		
+		if(unflushed && (flushRequested || drained || unflushedBytes >= pFlushSize.load()
+		|| timer.PeekElapsedTime() >= pFlushInterval.load())){
+			try{
+				pTarget->Flush();
+			}catch(const deException &){
+				// nothing we can do about it
+			}
+			
+			timer.Reset();
+			unflushedBytes = 0;
+			unflushed = false;
+		}
+		
+		if(flushRequested){
+			pFlushRequested = false;
+			pSemaphoreFlushed.Signal();
+		}
+		
+		if(!drained){
+			continue;
+		}
+		if(stop){
+			break;
+		}
+		
+		pWriterSleeping = true;
+		if(pHasQueuedMessage() || pIsFlushDue() || pStopWriter.load()){
+			pWriterSleeping = false;
+			continue;
+		}
+		
+		pSemaphoreWake.Wait();
+	}
+}
+
+int deLoggerAsync::pWriteBatch(int &writtenBytes){
+	const int maxCount = GetCapacity();
+	int count = 0;
+	
+	while(count < maxCount){
+		sSlot &slot = pSlots[pDequeuePosition & pSlotMask];
+		if(slot.sequence.load(std::memory_order_acquire) != pDequeuePosition + 1){
+			break;
+		}
+		
+		try{
+			switch(slot.type){
+			case emtInfo:
+				pTarget->LogInfo(slot.source, slot.message);
+				break;
+				
+			case emtWarn:
+				pTarget->LogWarn(slot.source, slot.message);
+				break;
+				
+			case emtError:
+				pTarget->LogError(slot.source, slot.message);
+				break;
+			}
+			
+		}catch(const deException &){
+			// nothing we can do about it
+		}
+		
+		writtenBytes += slot.source.GetLength() + slot.message.GetLength();
+		
+		slot.sequence.store(pDequeuePosition + pSlotMask + 1, std::memory_order_release);
+		pDequeuePosition++;
+		count++;
+	}
+	
+	return count;
+}
+
+bool deLoggerAsync::pHasQueuedMessage() const{
+	return pSlots[pDequeuePosition & pSlotMask].sequence.load() == pDequeuePosition + 1;
+}
+
+bool deLoggerAsync::pIsFlushDue() const{
+	return pFlushRequested.load() && (int32_t)(pDequeuePosition - pFlushPosition.load()) >= 0;
+}
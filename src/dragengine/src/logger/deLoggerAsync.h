@@ -0,0 +1,192 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DELOGGERASYNC_H_
+#define _DELOGGERASYNC_H_
+
+#include <atomic>
+#include <stdint.h>
+
+#include "deLogger.h"
+#include "../deTUniqueReference.h"
+#include "../common/string/decString.h"
+#include "../threading/deMutex.h"
+#include "../threading/deSemaphore.h"
+
+
+/**
+ * \brief Asynchronous logger.
+ * \version 1.34
+ * 
+ * Queues messages in a lock-free multi-producer ring buffer and forwards them to a target
+ * logger from a background writer thread. Logging threads only copy the message into the
+ * ring buffer. Formatting, writing and flushing happens on the writer thread. Use this
+ * logger to wrap for example a \ref deLoggerFile with auto flushing disabled or a
+ * \ref deLoggerChain.
+ * 
+ * The writer thread forwards messages in batches. The target logger is flushed using
+ * \ref deLogger::Flush if one of these conditions is met:
+ * - The ring buffer has been drained.
+ * - The amount of message bytes written since the last flush reaches the flush size.
+ * - The time since the last flush reaches the flush interval.
+ * 
+ * Error messages are flushed before LogError returns. This ensures error messages are
+ * written if the application crashes right afterwards. Pending messages are also written
+ * and flushed before the logger is destroyed.
+ * 
+ * If the ring buffer is full logging threads wait for the writer thread to make room.
+ * Messages are never dropped.
+ * 
+ * \note Asynchronous logger is thread safe. The target logger is only used by the
+ * writer thread.
+ */
+class DE_DLL_EXPORT deLoggerAsync : public deLogger{
+public:
+	/** \brief Type holding strong reference. */
+	using Ref = deTObjectReference<deLoggerAsync>;
+	
+	
+	
+private:
+	class cWriterThread;
+	
+	enum eMessageTypes{
+		emtInfo,
+		emtWarn,
+		emtError
+	};
+	
+	struct sSlot{
+		std::atomic<uint32_t> sequence;
+		eMessageTypes type;
+		decString source;
+		decString message;
+	};
+	
+	const deLogger::Ref pTarget;
+	
+	sSlot *pSlots;
+	uint32_t pSlotMask;
+	std::atomic<uint32_t> pEnqueuePosition;
+	uint32_t pDequeuePosition;
+	
+	std::atomic<int> pFlushSize;
+	std::atomic<float> pFlushInterval;
+	
+	deTUniqueReference<cWriterThread> pThread;
+	deSemaphore pSemaphoreWake;
+	std::atomic<bool> pWriterSleeping;
+	std::atomic<bool> pStopWriter;
+	
+	deMutex pMutexFlush;
+	deSemaphore pSemaphoreFlushed;
+	std::atomic<bool> pFlushRequested;
+	std::atomic<uint32_t> pFlushPosition;
+	
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/**
+	 * \brief Create asynchronous logger.
+	 * \param[in] target Logger to forward messages to.
+	 * \param[in] capacity Ring buffer capacity in messages. Rounded up to the next
+	 *                     power of two.
+	 * \throws deeInvalidParam \em target is nullptr.
+	 * \throws deeInvalidParam \em capacity is less than 2.
+	 */
+	deLoggerAsync(deLogger *target, int capacity = 4096);
+	
+protected:
+	/**
+	 * \brief Clean up asynchronous logger.
+	 * 
+	 * Writes and flushes all pending messages then stops the writer thread.
+	 * 
+	 * \note Subclasses should set their destructor protected too to avoid users
+	 * accidently deleting a reference counted object through the object
+	 * pointer. Only FreeReference() is allowed to delete the object.
+	 */
+	~deLoggerAsync() override;
+	/*@}*/
+	
+	
+	
+public:
+	/** \name Management */
+	/*@{*/
+	/** \brief Target logger. */
+	inline const deLogger::Ref &GetTarget() const{ return pTarget; }
+	
+	/** \brief Ring buffer capacity in messages. */
+	inline int GetCapacity() const{ return (int)pSlotMask + 1; }
+	
+	/** \brief Message bytes written after which the target logger is flushed. */
+	inline int GetFlushSize() const{ return pFlushSize.load(); }
+	
+	/**
+	 * \brief Set message bytes written after which the target logger is flushed.
+	 * 
+	 * Default is 65536.
+	 */
+	void SetFlushSize(int size);
+	
+	/** \brief Interval in seconds after which the target logger is flushed. */
+	inline float GetFlushInterval() const{ return pFlushInterval.load(); }
+	
+	/**
+	 * \brief Set interval in seconds after which the target logger is flushed.
+	 * 
+	 * Default is 0.1 seconds.
+	 */
+	void SetFlushInterval(float interval);
+	
+	
+	
+	/** \brief Log information message. */
+	void LogInfo(const char *source, const char *message) override;
+	
+	/** \brief Log warning message. */
+	void LogWarn(const char *source, const char *message) override;
+	
+	/** \brief Log error message and wait until it has been flushed. */
+	void LogError(const char *source, const char *message) override;
+	
+	/** \brief Write and flush all messages logged so far then return. */
+	void Flush() override;
+	/*@}*/
+	
+	
+	
+private:
+	void pEnqueue(eMessageTypes type, const char *source, const char *message);
+	void pWakeWriter();
+	void pWriterRun();
+	int pWriteBatch(int &writtenBytes);
+	bool pHasQueuedMessage() const;
+	bool pIsFlushDue() const;
+};
+
+#endif
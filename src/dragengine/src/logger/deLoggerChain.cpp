@@ -183,3 +183,22 @@ void deLoggerChain::LogError(const char *source, const char *message){
 		throw;
 	}
 }
+
+void deLoggerChain::Flush(){
+	pMutex.Lock();
+	
+	try{
+		const int count = pLoggers.GetCount();
+		int i;
+		
+		for(i=0; i<count; i++){
+			pLoggers.GetAt(i)->Flush();
+		}
+		
+		pMutex.Unlock();
+		
+	}catch(const deException &){
+		pMutex.Unlock();
+		throw;
+	}
+}
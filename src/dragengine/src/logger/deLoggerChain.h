@@ -97,6 +97,12 @@ public:
 	
 	/** \brief Log error message. */
 	void LogError(const char *source, const char *message) override;
+	
+	/**
+	 * \brief Flush all loggers in the chain.
+	 * \version 1.34
+	 */
+	void Flush() override;
 	/*@}*/
 	
 	
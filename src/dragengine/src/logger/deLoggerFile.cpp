@@ -43,7 +43,8 @@
 ////////////////////////////
 
 deLoggerFile::deLoggerFile(decBaseFileWriter *writer) :
-pWriter(writer)
+pWriter(writer),
+pAutoFlush(true)
 {
 	DEASSERT_NOTNULL(writer)
 }
@@ -56,6 +57,12 @@ deLoggerFile::~deLoggerFile(){
 // Management
 ///////////////
 
+void deLoggerFile::SetAutoFlush(bool autoFlush){
+	const deMutexGuard lock(pMutex);
+	pAutoFlush = autoFlush;
+}
+
+
 void deLoggerFile::LogInfo(const char *source, const char *message){
 	LogPrefix(source, message, "II ");
 }
@@ -68,6 +75,11 @@ void deLoggerFile::LogError(const char *source, const char *message){
 	LogPrefix(source, message, "EE ");
 }
 
+void deLoggerFile::Flush(){
+	const deMutexGuard lock(pMutex);
+	pWriter->Flush();
+}
+
 void deLoggerFile::LogPrefix(const char *source, const char *message, const char *prefix){
 	if(!source || !message || !prefix){
 		DETHROW(deeInvalidParam);
@@ -85,5 +97,7 @@ void deLoggerFile::LogPrefix(const char *source, const char *message, const char
 	const deMutexGuard lock(pMutex);
 	
 	pWriter->Write(string.GetString(), string.GetLength());
-	fflush(nullptr);
+	if(pAutoFlush){
+		pWriter->Flush();
+	}
 }
@@ -39,7 +39,9 @@
  * the file logger is freed.
  * 
  * \note Logger console is thread safe. To avoid torn logs the entire text line is
- * formated in memory and send as one write call then fflush is called.
+ * formated in memory and send as one write call then the file writer is flushed. If
+ * auto flushing is disabled the file writer is only flushed by \ref Flush. This is used
+ * by \ref deLoggerAsync to flush once per batch of messages.
  * Be careful with the use of the file writer outside the logger. deObject
  * reference counting is not thread safe.
  */
@@ -52,6 +54,7 @@ public:
 private:
 	decBaseFileWriter::Ref pWriter;
 	deMutex pMutex;
+	bool pAutoFlush;
 	
 	
 	
@@ -79,6 +82,20 @@ public:
 	/** \brief File writer. */
 	inline const decBaseFileWriter::Ref &GetWriter() const{ return pWriter; }
 	
+	/**
+	 * \brief Flush after each logged message.
+	 * \version 1.34
+	 */
+	inline bool GetAutoFlush() const{ return pAutoFlush; }
+	
+	/**
+	 * \brief Set if flushing happens after each logged message.
+	 * \version 1.34
+	 * 
+	 * Default is true. Disable if \ref Flush is called regularly.
+	 */
+	void SetAutoFlush(bool autoFlush);
+	
 	
 	
 	/** \brief Log information message. */
@@ -89,6 +106,12 @@ public:
 	
 	/** \brief Log error message. */
 	void LogError(const char *source, const char *message) override;
+	
+	/**
+	 * \brief Flush written messages.
+	 * \version 1.34
+	 */
+	void Flush() override;
 	/*@}*/
 	
 	
@@ -56,6 +56,8 @@ deParallelProcessing::deParallelProcessing(deEngine &engine) :
 pEngine(engine),
 pCoreCount(4),
 pPaused(false),
+pNextQueue(0),
+pHasCancelledBlockedTasks(false),
 pOutputDebugMessages(false)
 {
 	try{
@@ -67,6 +69,25 @@ pOutputDebugMessages(false)
 	}
 }
 
+deParallelProcessing::deParallelProcessing(deEngine &engine, int threadCount) :
+pEngine(engine),
+pCoreCount(4),
+pPaused(false),
+pNextQueue(0),
+pHasCancelledBlockedTasks(false),
+pOutputDebugMessages(false)
+{
+	DEASSERT_TRUE(threadCount > 0)
+	
+	try{
+		pDetectCoreCount();
+		pCreateThreads(threadCount);
+		
+	}catch(const deException &){
+		pCleanUp();
+	}
+}
+
 deParallelProcessing::~deParallelProcessing(){
 	pCleanUp();
 }
@@ -89,9 +110,9 @@ void deParallelProcessing::Update(){
 			break;
 		}
 		
-		const deParallelTask::Ref task(pListFinishedTasks.First());
-		pListFinishedTasks.RemoveFrom(0);
-		pTasks.Remove(task);
+		const deParallelTask::Ref task(pListFinishedTasks.GetRootOwner());
+		pListFinishedTasks.Remove(&task->GetLLState());
+		pTasks.Remove(&task->GetLLProcessing());
 		
 		if(pOutputDebugMessages){
 			const decString debugName(task->GetDebugName());
@@ -125,6 +146,7 @@ void deParallelProcessing::Update(){
 		if(!task->GetMarkFinishedAfterRun()){
 			task->SetFinished();
 			pSemaphoreNewTasks.Signal();
+			pReleaseDependingTasks(task, -1);
 		}
 	}
 }
@@ -176,7 +198,14 @@ void deParallelProcessing::Resume(){
 	
 	pPaused = false;
 	
-	if(pListPendingTasks.IsNotEmpty() || pListPendingTasksLowPriority.IsNotEmpty()){
+	bool hasPendingTasks = !pQueueLowPriority.IsEmpty();
+	const int queueCount = pQueues.GetCount();
+	int i;
+	for(i=0; !hasPendingTasks && i<queueCount; i++){
+		hasPendingTasks = !pQueues.GetAt(i)->IsEmpty();
+	}
+	
+	if(hasPendingTasks){
 		pSemaphoreNewTasks.SignalAll();
 	}
 }
@@ -308,25 +337,33 @@ void deParallelProcessing::AddTaskAsync(deParallelTask *task){
 	
 	const deMutexGuard lock(pMutexTasks);
 	
-	pTasks.AddOrThrow(task); // strong reference held until task leaves parallel task system
+	// strong reference held until task leaves parallel task system
+	DEASSERT_NULL(task->GetLLProcessing().GetList())
+	pTasks.Add(&task->GetLLProcessing(), deParallelTask::Ref(task));
 	
 	task->Reset(); // mark not cancelled and not finished. collides with SetFinished()
 	
-	if(task->GetLowPriority()){
-		pListPendingTasksLowPriority.Add(task);
-		
-	}else{
-		pListPendingTasks.Add(task);
-	}
-	
 	if(pOutputDebugMessages){
 		pLogTask("AddTask ", "  ", *task);
 	}
 	
-	if(!pPaused){
-		pSemaphoreNewTasks.Signal();
+	// tasks with unfinished dependencies are blocked until the last dependency finishes.
+	// checking and adding to the blocked list happens while holding pMutexTasks. this
+	// guarantees pReleaseDependingTasks() sees the task if a dependency finishes afterwards
+	const bool blocked = RunWithTaskDependencyMutex([&](){
+		return !task->GetDependsOn().AllMatching([](const deParallelTask *t){
+			return t->GetFinished();
+		});
+	});
+	
+	if(blocked){
+		pListBlockedTasks.Add(&task->GetLLState());
 		
 	}else{
+		pAddPendingTask(task, -1);
+	}
+	
+	if(pPaused){
 		// parallel processing is paused. we have to process the task now otherwise the caller
 		// potentially dead-locks if resuming depends on this task finishing
 		pEnsureRunTaskNow(task);
@@ -342,57 +379,18 @@ void deParallelProcessing::FinishAndRemoveTasksOwnedBy(deBaseModule *module){
 	deMutexGuard lock(pMutexTasks);
 	
 	RunWithTaskDependencyMutex([&](){
-		pListPendingTasks.Visit([&](deParallelTask *task){
-			if(task->GetOwner() == module){
-				task->UnprotectedCancel();
-			}
-		});
-		
-		pListPendingTasksLowPriority.Visit([&](deParallelTask *task){
+		pVisitPendingTasks([&](deParallelTask *task){
 			if(task->GetOwner() == module){
 				task->UnprotectedCancel();
 			}
 		});
 	});
+	pHasCancelledBlockedTasks = true;
 	
 	// make sure the tasks are finished otherwise
 	// strange problems can happen with certain tasks
 	if(pPaused){
-		int nextIndex = 0;
-		while(pListPendingTasks.GetCount() > nextIndex){
-			deParallelTask * const task = pListPendingTasks.GetAt(nextIndex);
-			
-			if(task->IsCancelled()){
-				pListPendingTasks.RemoveFrom(nextIndex);
-				
-				if(task->GetMarkFinishedAfterRun()){
-					task->SetFinished();
-				}
-				
-				pListFinishedTasks.Add(task);
-				
-			}else{
-				nextIndex++;
-			}
-		}
-		
-		nextIndex = 0;
-		while(pListPendingTasksLowPriority.GetCount() > nextIndex){
-			deParallelTask * const task = pListPendingTasksLowPriority.GetAt(nextIndex);
-			
-			if(task->IsCancelled()){
-				pListPendingTasksLowPriority.RemoveFrom(nextIndex);
-				
-				if(task->GetMarkFinishedAfterRun()){
-					task->SetFinished();
-				}
-				
-				pListFinishedTasks.Add(task);
-				
-			}else{
-				nextIndex++;
-			}
-		}
+		pFinishCancelledPendingTasks();
 		
 		while(pListFinishedTasks.IsNotEmpty()){
 			// we have to remove the finished task from the system before unlocking the mutex
@@ -400,9 +398,9 @@ void deParallelProcessing::FinishAndRemoveTasksOwnedBy(deBaseModule *module){
 			// invariants to be violated. since removing a task from the system drops the strong
 			// reference we have to guard it here. this has a small performance penalty due to
 			// mutex proteced reference counting but that is necessary
-			const deParallelTask::Ref task(pListFinishedTasks.First());
-			pListFinishedTasks.RemoveFrom(0);
-			pTasks.Remove(task);
+			const deParallelTask::Ref task(pListFinishedTasks.GetRootOwner());
+			pListFinishedTasks.Remove(&task->GetLLState());
+			pTasks.Remove(&task->GetLLProcessing());
 			
 			task->RemoveAllDependsOn();
 			
@@ -490,52 +488,15 @@ void deParallelProcessing::FinishAndRemoveAllTasks(){
 	deMutexGuard lock(pMutexTasks);
 	
 	RunWithTaskDependencyMutex([&](){
-		pListPendingTasks.Visit([](deParallelTask *task){
-			task->UnprotectedCancel();
-		});
-		
-		pListPendingTasksLowPriority.Visit([](deParallelTask *task){
+		pVisitPendingTasks([](deParallelTask *task){
 			task->UnprotectedCancel();
 		});
 	});
+	pHasCancelledBlockedTasks = true;
 	
 	// make sure the tasks are finished otherwise strange problems can happen with certain tasks
 	if(pPaused){
-		int nextIndex = 0;
-		while(pListPendingTasks.GetCount() > nextIndex){
-			deParallelTask * const task = pListPendingTasks.GetAt(nextIndex);
-			
-			if(task->IsCancelled()){
-				pListPendingTasks.RemoveFrom(nextIndex);
-				
-				if(task->GetMarkFinishedAfterRun()){
-					task->SetFinished();
-				}
-				
-				pListFinishedTasks.Add(task);
-				
-			}else{
-				nextIndex++;
-			}
-		}
-		
-		nextIndex = 0;
-		while(pListPendingTasksLowPriority.GetCount() > nextIndex){
-			deParallelTask * const task = pListPendingTasksLowPriority.GetAt(nextIndex);
-			
-			if(task->IsCancelled()){
-				pListPendingTasksLowPriority.RemoveFrom(nextIndex);
-				
-				if(task->GetMarkFinishedAfterRun()){
-					task->SetFinished();
-				}
-				
-				pListFinishedTasks.Add(task);
-				
-			}else{
-				nextIndex++;
-			}
-		}
+		pFinishCancelledPendingTasks();
 		
 		while(pListFinishedTasks.IsNotEmpty()){
 			// we have to remove the finished task from the system before unlocking the mutex
@@ -543,9 +504,9 @@ void deParallelProcessing::FinishAndRemoveAllTasks(){
 			// invariants to be violated. since removing a task from the system drops the strong
 			// reference we have to guard it here. this has a small performance penalty due to
 			// mutex proteced reference counting but that is necessary
-			const deParallelTask::Ref task(pListFinishedTasks.First());
-			pListFinishedTasks.RemoveFrom(0);
-			pTasks.Remove(task);
+			const deParallelTask::Ref task(pListFinishedTasks.GetRootOwner());
+			pListFinishedTasks.Remove(&task->GetLLState());
+			pTasks.Remove(&task->GetLLProcessing());
 			
 			task->RemoveAllDependsOn();
 			
@@ -598,116 +559,11 @@ void deParallelProcessing::FinishAndRemoveAllTasks(){
 //////////////////////////
 
 deParallelTask *deParallelProcessing::NextPendingTask(bool takeLowPriorityTasks){
-	// NOTE
-	// this method is called from worker threads and potentially the main thread.
-	// this especially means it is not allowed to modify depends-on of tasks here
-	// not adding or releasing task references
-	
-	if(pPaused){
-		return nullptr;
-	}
-	
-	int nextIndex = 0;
-	
-	deMutexGuard lock(pMutexTasks);
-	
-	while(pListPendingTasks.GetCount() > nextIndex){
-		deParallelTask * const task = pListPendingTasks.GetAt(nextIndex);
-		
-		if(task->IsCancelled()){
-			pListPendingTasks.RemoveFrom(nextIndex);
-			
-			if(task->GetMarkFinishedAfterRun()){
-				task->SetFinished();
-				pSemaphoreNewTasks.Signal();
-			}
-			
-			pListFinishedTasks.Add(task);
-			
-		}else if(task->CanRun(*this)){
-			pListPendingTasks.RemoveFrom(nextIndex);
-			
-			if(task->GetEmptyRun()){
-				// task has been marked has having no run implementation. we can optimize
-				// this case by not sending the task to the thread but instead moving it
-				// straight to the finished list
-				if(task->GetMarkFinishedAfterRun()){
-					task->SetFinished();
-					pSemaphoreNewTasks.Signal();
-				}
-				
-				pListFinishedTasks.Add(task);
-				
-			}else{
-				//pSemaphoreNewTasks.TryWait();
-				return task;
-			}
-			
-		}else{
-			nextIndex++; // this task is blocked, try the next one
-		}
-	}
-	
-	// low priority task only if the tasks accepts
-	if(!takeLowPriorityTasks){
-		// NOTE if only one thread is called and this thread happens to not take low priority
-		//      tasks but there are some then we can end up dead-locking since this thread
-		//      goes to sleep and the others able to take it are not woken up. to avoid this
-		//      problem we wake up another thread.
-		//      
-		//      right now only one thread does not take low priority tasks to keep important
-		//      threads running. in this case waking up one thread will wake up one which can
-		//      take the low priority task. if more than one thread are not taking low priority
-		//      tasks then there is the potential risk of ping-pong between two threads not
-		//      taking low priority tasks. i doubt though this can cause a problem on regular
-		//      hardware. should this though be a problem using SignalAll() instead of Signal()
-		//      can help. using SignalAll() too often can though cause the counter to sky-rocket.
-		if(pListPendingTasksLowPriority.IsNotEmpty()){
-			pSemaphoreNewTasks.Signal();
-		}
-		return nullptr;
-	}
-	
-	nextIndex = 0;
-	
-	while(pListPendingTasksLowPriority.GetCount() > nextIndex){
-		deParallelTask * const task = pListPendingTasksLowPriority.GetAt(nextIndex);
-		
-		if(task->IsCancelled()){
-			pListPendingTasksLowPriority.RemoveFrom(nextIndex);
-			
-			if(task->GetMarkFinishedAfterRun()){
-				task->SetFinished();
-				pSemaphoreNewTasks.Signal();
-			}
-			
-			pListFinishedTasks.Add(task);
-			
-		}else if(task->CanRun(*this)){
-			pListPendingTasksLowPriority.RemoveFrom(nextIndex);
-			
-			if(task->GetEmptyRun()){
-				// task has been marked has having no run implementation. we can optimize
-				// this case by not sending the task to the thread but instead moving it
-				// straight to the finished list
-				if(task->GetMarkFinishedAfterRun()){
-					task->SetFinished();
-					pSemaphoreNewTasks.Signal();
-				}
-				
-				pListFinishedTasks.Add(task);
-				
-			}else{
-				//pSemaphoreNewTasks.TryWait();  // not a good idea
-				return task;
-			}
-			
-		}else{
-			nextIndex++; // this task is blocked, try the next one
-		}
-	}
-	
-	return nullptr;
+	return pNextPendingTask(takeLowPriorityTasks, -1);
+}
+
+deParallelTask *deParallelProcessing::NextPendingTask(const deParallelThread &thread){
+	return pNextPendingTask(thread.GetTakeLowPriorityTasks(), thread.GetNumber());
 }
 
 void deParallelProcessing::WaitOnNewTasksSemaphore(){
@@ -715,28 +571,15 @@ void deParallelProcessing::WaitOnNewTasksSemaphore(){
 }
 
 void deParallelProcessing::AddFinishedTask(deParallelTask *task){
-	if(!task){
-		DETHROW(deeInvalidParam);
-	}
-	
-	deMutexGuard lock(pMutexTasks);
-	
-	if(task->GetMarkFinishedAfterRun()){
-		task->SetFinished();
-		pSemaphoreNewTasks.Signal();
-		// NOTE usually the calling thread is going to call NextPendingTask() after exiting this
-		//      call. if AddFinishedTask() is called by a WaitForTask*() call and the waiting
-		//      condition is fulfille then the WaitForTask*() call exits without calling
-		//      NextPendingTask(). in this situation it can happen tasks are still pending but
-		//      because all threads are sleeping already the remaining tasks are not processed
-		//      anymore. in certain situations this can lead to dead-locks. for this reason
-		//      the semaphore is signaled here always to avoid this situation. the worst that
-		//      can happen is a thread waking up just to find no work to do and go sleeping.
-		//      important is that processing of pending tasks never stops if there are tasks
-		//      present that could be run
-	}
-	
-	pListFinishedTasks.Add(task);
+	pAddFinishedTask(task, -1);
+}
+
+void deParallelProcessing::AddFinishedTask(const deParallelThread &thread, deParallelTask *task){
+	pAddFinishedTask(task, thread.GetNumber());
+}
+
+void deParallelProcessing::TaskCancelled(){
+	pHasCancelledBlockedTasks = true;
 }
 
 
@@ -770,12 +613,20 @@ void deParallelProcessing::LogThreadAndTasks(){
 	});
 	
 	logger.LogInfoFormat(LOGSOURCE, "Parallel Processing%s - Pending Tasks:", paused);
-	pListPendingTasks.Visit([&](const deParallelTask *task){
+	const int queueCount = pQueues.GetCount();
+	for(i=0; i<queueCount; i++){
+		pQueues.GetAt(i)->Visit([&](const deParallelTask *task){
+			pLogTask("- ", "  ", *task);
+		});
+	}
+	
+	logger.LogInfoFormat(LOGSOURCE, "Parallel Processing%s - Pending Low Priority Tasks:", paused);
+	pQueueLowPriority.Visit([&](const deParallelTask *task){
 		pLogTask("- ", "  ", *task);
 	});
 	
-	logger.LogInfoFormat(LOGSOURCE, "Parallel Processing%s - Pending Low Priority Tasks:", paused);
-	pListPendingTasksLowPriority.Visit([&](const deParallelTask *task){
+	logger.LogInfoFormat(LOGSOURCE, "Parallel Processing%s - Blocked Tasks:", paused);
+	pListBlockedTasks.Visit([&](const deParallelTask *task){
 		pLogTask("- ", "  ", *task);
 	});
 }
@@ -789,8 +640,13 @@ void deParallelProcessing::pCleanUp(){
 	pStopAllThreads();
 	pDestroyThreads();
 	
-	pListPendingTasks.RemoveAll();
-	pListPendingTasksLowPriority.RemoveAll();
+	const int queueCount = pQueues.GetCount();
+	int i;
+	for(i=0; i<queueCount; i++){
+		pQueues.GetAt(i)->RemoveAll();
+	}
+	pQueueLowPriority.RemoveAll();
+	pListBlockedTasks.RemoveAll();
 	pListFinishedTasks.RemoveAll();
 	
 	pTasks.RemoveAll(); // drops all strong references
@@ -825,6 +681,11 @@ void deParallelProcessing::pCreateThreads(int count){
 	}
 	
 	pThreads.EnlargeCapacity(count);
+	pQueues.EnlargeCapacity(count);
+	
+	while(pQueues.GetCount() < count){
+		pQueues.Add(deTUniqueReference<deParallelTaskQueue>::New());
+	}
 	
 	int threadCount = pThreads.GetCount();
 	while(threadCount < count){
@@ -920,22 +781,19 @@ void deParallelProcessing::pEnsureRunTaskNow(deParallelTask *task){
 	
 	while(!task->GetFinished()){
 		if(task->IsCancelled()){
-			if(task->GetLowPriority()){
-				pListPendingTasksLowPriority.Remove(task);
-				
-			}else{
-				pListPendingTasks.Remove(task);
+			if(pRemovePendingTask(task)){
+				pFinishNotRunTask(task, -1);
 			}
-			
-			if(task->GetMarkFinishedAfterRun()){
-				task->SetFinished();
-			}
-			
-			pListFinishedTasks.Add(task);
 			return;
 		}
 		
 		if(task->CanRun(*this)){
+			// task can be already on the finished list if it has been finished without
+			// running. in this case the task must not be run a second time
+			if(!pRemovePendingTask(task)){
+				return;
+			}
+			
 			if(pOutputDebugMessages){
 				const decString debugName(task->GetDebugName());
 				const decString debugDetails(task->GetDebugDetails());
@@ -963,17 +821,11 @@ void deParallelProcessing::pEnsureRunTaskNow(deParallelTask *task){
 						debugName.GetString(), debugDetails.GetString());
 			}
 			
-			if(task->GetLowPriority()){
-				pListPendingTasksLowPriority.Remove(task);
-				
-			}else{
-				pListPendingTasks.Remove(task);
-			}
-			
 			if(task->GetMarkFinishedAfterRun()){
 				task->SetFinished();
 			}
-			pListFinishedTasks.Add(task);
+			pListFinishedTasks.Add(&task->GetLLState());
+			pReleaseDependingTasks(task, -1);
 			return;
 		}
 		
@@ -998,6 +850,247 @@ void deParallelProcessing::pEnsureRunTaskNow(deParallelTask *task){
 
 
 
+deParallelTask *deParallelProcessing::pNextPendingTask(bool takeLowPriorityTasks, int queue){
+	// NOTE
+	// this method is called from worker threads and potentially the main thread.
+	// this especially means it is not allowed to modify depends-on of tasks here
+	// not adding or releasing task references
+	
+	if(pPaused){
+		return nullptr;
+	}
+	
+	if(pHasCancelledBlockedTasks.exchange(false)){
+		pFinishCancelledBlockedTasks();
+	}
+	
+	while(true){
+		deParallelTask *task = nullptr;
+		
+		// own queue first taking the most recently added task. these are usually tasks
+		// released by the task finished last by this thread
+		if(queue != -1){
+			task = pQueues.GetAt(queue)->PopBack();
+		}
+		
+		// steal from other threads
+		if(!task){
+			task = pStealTask(queue);
+		}
+		
+		// low priority task only if the tasks accepts
+		if(!task){
+			if(takeLowPriorityTasks){
+				task = pQueueLowPriority.Steal();
+				
+			}else if(!pQueueLowPriority.IsEmpty()){
+				// NOTE if only one thread is called and this thread happens to not take low
+				//      priority tasks but there are some then we can end up dead-locking since
+				//      this thread goes to sleep and the others able to take it are not woken
+				//      up. to avoid this problem we wake up another thread.
+				//      
+				//      right now only one thread does not take low priority tasks to keep
+				//      important threads running. in this case waking up one thread will wake
+				//      up one which can take the low priority task. if more than one thread are
+				//      not taking low priority tasks then there is the potential risk of
+				//      ping-pong between two threads not taking low priority tasks. i doubt
+				//      though this can cause a problem on regular hardware. should this though
+				//      be a problem using SignalAll() instead of Signal() can help. using
+				//      SignalAll() too often can though cause the counter to sky-rocket.
+				pSemaphoreNewTasks.Signal();
+			}
+		}
+		
+		if(!task){
+			return nullptr;
+		}
+		
+		if(!task->IsCancelled()){
+			return task;
+		}
+		
+		const deMutexGuard lock(pMutexTasks);
+		pFinishNotRunTask(task, queue);
+	}
+}
+
+deParallelTask *deParallelProcessing::pStealTask(int queue){
+	const int queueCount = pQueues.GetCount();
+	int i;
+	
+	for(i=1; i<=queueCount; i++){
+		const int index = (queue + i) % queueCount;
+		if(index == queue){
+			continue;
+		}
+		
+		deParallelTask * const task = pQueues.GetAt(index)->Steal();
+		if(task){
+			return task;
+		}
+	}
+	
+	return nullptr;
+}
+
+void deParallelProcessing::pAddFinishedTask(deParallelTask *task, int queue){
+	if(!task){
+		DETHROW(deeInvalidParam);
+	}
+	
+	const deMutexGuard lock(pMutexTasks);
+	
+	if(task->GetMarkFinishedAfterRun()){
+		task->SetFinished();
+		pSemaphoreNewTasks.Signal();
+		// NOTE usually the calling thread is going to call NextPendingTask() after exiting this
+		//      call. if AddFinishedTask() is called by a WaitForTask*() call and the waiting
+		//      condition is fulfille then the WaitForTask*() call exits without calling
+		//      NextPendingTask(). in this situation it can happen tasks are still pending but
+		//      because all threads are sleeping already the remaining tasks are not processed
+		//      anymore. in certain situations this can lead to dead-locks. for this reason
+		//      the semaphore is signaled here always to avoid this situation. the worst that
+		//      can happen is a thread waking up just to find no work to do and go sleeping.
+		//      important is that processing of pending tasks never stops if there are tasks
+		//      present that could be run
+	}
+	
+	pListFinishedTasks.Add(&task->GetLLState());
+	
+	// tasks are allowed to call SetFinished() inside Run(). tasks depending on this task
+	// are thus checked even if the task is not marked finished after run
+	pReleaseDependingTasks(task, queue);
+}
+
+void deParallelProcessing::pAddPendingTask(deParallelTask *task, int queue){
+	// caller holds pMutexTasks
+	if(task->IsCancelled()){
+		pFinishNotRunTask(task, queue);
+		return;
+	}
+	
+	if(task->GetEmptyRun()){
+		// task has been marked has having no run implementation. we can optimize this case
+		// by not sending the task to the thread but instead moving it straight to the
+		// finished list
+		pFinishNotRunTask(task, queue);
+		return;
+	}
+	
+	if(task->GetLowPriority()){
+		pQueueLowPriority.Push(task);
+		
+	}else if(pQueues.IsNotEmpty()){
+		if(queue == -1){
+			queue = pNextQueue;
+			pNextQueue = (pNextQueue + 1) % pQueues.GetCount();
+		}
+		pQueues.GetAt(queue)->Push(task);
+		
+	}else{
+		pQueueLowPriority.Push(task);
+	}
+	
+	if(!pPaused){
+		pSemaphoreNewTasks.Signal();
+	}
+}
+
+void deParallelProcessing::pFinishNotRunTask(deParallelTask *task, int queue){
+	// caller holds pMutexTasks
+	if(task->GetMarkFinishedAfterRun()){
+		task->SetFinished();
+		pSemaphoreNewTasks.Signal();
+	}
+	
+	pListFinishedTasks.Add(&task->GetLLState());
+	pReleaseDependingTasks(task, queue);
+}
+
+void deParallelProcessing::pReleaseDependingTasks(deParallelTask *task, int queue){
+	// caller holds pMutexTasks
+	deParallelTask::TaskPointerList released;
+	
+	RunWithTaskDependencyMutex([&](){
+		task->GetDependedOnBy().Visit([&](deParallelTask *t){
+			if(t->GetLLState().GetList() == &pListBlockedTasks && (t->IsCancelled()
+			|| t->GetDependsOn().AllMatching([](const deParallelTask *d){
+				return d->GetFinished();
+			}))){
+				released.Add(t);
+			}
+		});
+	});
+	
+	released.Visit([&](deParallelTask *t){
+		pListBlockedTasks.Remove(&t->GetLLState());
+		pAddPendingTask(t, queue);
+	});
+}
+
+void deParallelProcessing::pFinishCancelledBlockedTasks(){
+	const deMutexGuard lock(pMutexTasks);
+	
+	deParallelTask::TaskPointerList cancelled;
+	RunWithTaskDependencyMutex([&](){
+		pListBlockedTasks.Visit([&](deParallelTask *task){
+			if(task->IsCancelled()){
+				cancelled.Add(task);
+			}
+		});
+	});
+	
+	cancelled.Visit([&](deParallelTask *task){
+		// finishing a cancelled task can finish other cancelled blocked tasks
+		if(task->GetLLState().GetList() == &pListBlockedTasks){
+			pListBlockedTasks.Remove(&task->GetLLState());
+			pFinishNotRunTask(task, -1);
+		}
+	});
+}
+
+void deParallelProcessing::pFinishCancelledPendingTasks(){
+	// caller holds pMutexTasks
+	deParallelTask::TaskPointerList cancelled;
+	pVisitPendingTasks([&](deParallelTask *task){
+		if(task->IsCancelled()){
+			cancelled.Add(task);
+		}
+	});
+	
+	cancelled.Visit([&](deParallelTask *task){
+		if(pRemovePendingTask(task)){
+			pFinishNotRunTask(task, -1);
+		}
+	});
+	
+	pHasCancelledBlockedTasks = false;
+}
+
+bool deParallelProcessing::pRemovePendingTask(deParallelTask *task){
+	// caller holds pMutexTasks
+	if(task->GetLLState().GetList() == &pListBlockedTasks){
+		pListBlockedTasks.Remove(&task->GetLLState());
+		return true;
+	}
+	
+	if(pQueueLowPriority.Remove(task)){
+		return true;
+	}
+	
+	const int queueCount = pQueues.GetCount();
+	int i;
+	for(i=0; i<queueCount; i++){
+		if(pQueues.GetAt(i)->Remove(task)){
+			return true;
+		}
+	}
+	
+	return false;
+}
+
+
+
 void deParallelProcessing::pLogTask(const char *prefix, const char *contPrefix,
 const deParallelTask &task){
 	deLogger &logger = *pEngine.GetLogger();
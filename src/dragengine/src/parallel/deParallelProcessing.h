@@ -25,7 +25,10 @@
 #ifndef _DEPARALLELPROCESSING_H_
 #define _DEPARALLELPROCESSING_H_
 
+#include <atomic>
+
 #include "deParallelTask.h"
+#include "deParallelTaskQueue.h"
 #include "../common/string/decStringList.h"
 #include "../dragengine_export.h"
 #include "../common/collection/decTUniqueList.h"
@@ -40,6 +43,15 @@ class deBaseModule;
 
 /**
  * \brief Parallel task processing.
+ * 
+ * Tasks are scheduled using per-thread work stealing. Each thread owns a queue of tasks
+ * ready to run. Threads take tasks from the back of their own queue and steal tasks from
+ * the front of the queues of other threads if their own queue is empty. Low priority tasks
+ * are kept in a separate queue taken only by threads accepting low priority tasks.
+ * 
+ * Tasks depending on unfinished tasks are kept in a blocked list and are never scanned.
+ * Once a task finishes the tasks depending on it are checked. Tasks with all dependencies
+ * finished are moved to the ready queues.
  */
 class DE_DLL_EXPORT deParallelProcessing{
 private:
@@ -49,12 +61,15 @@ private:
 	decTUniqueList<deParallelThread> pThreads;
 	bool pPaused;
 	
-	deParallelTask::TaskList pTasks;
-	deParallelTask::TaskPointerList pListPendingTasks;
-	deParallelTask::TaskPointerList pListPendingTasksLowPriority;
-	deParallelTask::TaskPointerList pListFinishedTasks;
+	deParallelTask::TaskRefLinkedList pTasks;
+	decTUniqueList<deParallelTaskQueue> pQueues;
+	deParallelTaskQueue pQueueLowPriority;
+	deParallelTask::TaskLinkedList pListBlockedTasks;
+	deParallelTask::TaskLinkedList pListFinishedTasks;
+	int pNextQueue;
 	deMutex pMutexTasks, pMutexTaskDependency;
 	deSemaphore pSemaphoreNewTasks;
+	std::atomic<bool> pHasCancelledBlockedTasks;
 	
 	bool pOutputDebugMessages;
 	
@@ -63,9 +78,15 @@ private:
 public:
 	/** \name Constructors and Destructors */
 	/*@{*/
-	/** \brief Create parallel task processor. */
+	/** \brief Create parallel task processor with one thread per detected CPU core. */
 	deParallelProcessing(deEngine &engine);
 	
+	/**
+	 * \brief Create parallel task processor with specific count of threads.
+	 * \throws deeInvalidParam \em threadCount is less than 1.
+	 */
+	deParallelProcessing(deEngine &engine, int threadCount);
+	
 	/** \brief Clean up parallel task processor. */
 	~deParallelProcessing();
 	/*@}*/
@@ -207,10 +228,23 @@ public:
 	/*@{*/
 	/**
 	 * \brief Next pending task or NULL if there is none.
+	 * 
+	 * Used by threads not owning a task queue. Steals tasks from the thread queues.
+	 * 
 	 * \warning For use by deParallelTask only.
 	 */
 	deParallelTask *NextPendingTask(bool takeLowPriorityTasks);
 	
+	/**
+	 * \brief Next pending task or NULL if there is none.
+	 * 
+	 * Takes tasks from the queue owned by the thread first then steals tasks from
+	 * the queues of other threads.
+	 * 
+	 * \warning For use by deParallelThread only.
+	 */
+	deParallelTask *NextPendingTask(const deParallelThread &thread);
+	
 	/**
 	 * \brief Wait on the new tasks semaphore.
 	 * \warning For use by deParallelTask only.
@@ -222,6 +256,26 @@ public:
 	 * \warning For use by deParallelTask only.
 	 */
 	void AddFinishedTask(deParallelTask *task);
+	
+	/**
+	 * \brief Add task to the list of finished tasks.
+	 * 
+	 * Tasks depending on the finished task becoming ready to run are added to
+	 * the queue owned by the thread.
+	 * 
+	 * \warning For use by deParallelThread only.
+	 */
+	void AddFinishedTask(const deParallelThread &thread, deParallelTask *task);
+	
+	/**
+	 * \brief Task has been cancelled.
+	 * 
+	 * Blocked tasks cancelled are moved to the finished tasks the next time a thread
+	 * looks for pending tasks.
+	 * 
+	 * \warning For use by deParallelTask only.
+	 */
+	void TaskCancelled();
 	/*@}*/
 	
 	
@@ -247,6 +301,27 @@ private:
 	bool pProcessOneTaskDirect(bool takeLowPriorityTasks);
 	void pEnsureRunTaskNow(deParallelTask *task);
 	
+	deParallelTask *pNextPendingTask(bool takeLowPriorityTasks, int queue);
+	deParallelTask *pStealTask(int queue);
+	void pAddFinishedTask(deParallelTask *task, int queue);
+	void pAddPendingTask(deParallelTask *task, int queue);
+	void pFinishNotRunTask(deParallelTask *task, int queue);
+	void pReleaseDependingTasks(deParallelTask *task, int queue);
+	void pFinishCancelledBlockedTasks();
+	void pFinishCancelledPendingTasks();
+	bool pRemovePendingTask(deParallelTask *task);
+	
+	template<typename Visitor>
+	void pVisitPendingTasks(Visitor &&visitor){
+		const int queueCount = pQueues.GetCount();
+		int i;
+		for(i=0; i<queueCount; i++){
+			pQueues.GetAt(i)->Visit(visitor);
+		}
+		pQueueLowPriority.Visit(visitor);
+		pListBlockedTasks.Visit(visitor);
+	}
+	
 	void pLogTask(const char *prefix, const char *contPrefix, const deParallelTask &task);
 };
 
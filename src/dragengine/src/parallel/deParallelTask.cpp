@@ -45,7 +45,9 @@ pCancel(false),
 pFinished(false),
 pMarkFinishedAfterRun(true),
 pEmptyRun(false),
-pLowPriority(false){
+pLowPriority(false),
+pLLProcessing(this),
+pLLState(this){
 }
 
 deParallelTask::~deParallelTask(){
@@ -69,8 +71,11 @@ void deParallelTask::SetLowPriority(bool lowPriority){
 }
 
 void deParallelTask::Cancel(deParallelProcessing &parallel){
+	{
 	const deMutexGuard lock(parallel.GetTaskDependencyMutex());
 	UnprotectedCancel();
+	}
+	parallel.TaskCancelled();
 }
 
 void deParallelTask::SetFinished(){
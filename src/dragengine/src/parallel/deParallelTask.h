@@ -26,6 +26,7 @@
 #define _DEPARALLELTASK_H_
 
 #include "../common/collection/decTOrderedSet.h"
+#include "../common/collection/decTLinkedList.h"
 #include "../common/string/decString.h"
 #include "../threading/deThreadSafeObject.h"
 
@@ -73,6 +74,12 @@ public:
 	/** \brief List of task pointers. */
 	using TaskPointerList = decTOrderedSet<deParallelTask*>;
 	
+	/** \brief Linked list of tasks holding strong references. */
+	using TaskRefLinkedList = decTLinkedList<deParallelTask, Ref>;
+	
+	/** \brief Linked list of task pointers. */
+	using TaskLinkedList = decTLinkedList<deParallelTask>;
+	
 	
 private:
 	deBaseModule *pOwner;
@@ -86,6 +93,9 @@ private:
 	TaskList pDependsOn;
 	TaskPointerList pDependedOnBy;
 	
+	TaskRefLinkedList::Element pLLProcessing;
+	TaskLinkedList::Element pLLState;
+	
 	
 	
 public:
@@ -290,6 +300,20 @@ public:
 	/*@{*/
 	/** \brief Internal use only. */
 	void UnprotectedCancel();
+	
+	/**
+	 * \brief Parallel processing linked list element holding strong reference.
+	 * \warning For use by deParallelProcessing only.
+	 */
+	inline TaskRefLinkedList::Element &GetLLProcessing(){ return pLLProcessing; }
+	inline const TaskRefLinkedList::Element &GetLLProcessing() const{ return pLLProcessing; }
+	
+	/**
+	 * \brief Blocked or finished tasks linked list element.
+	 * \warning For use by deParallelProcessing only.
+	 */
+	inline TaskLinkedList::Element &GetLLState(){ return pLLState; }
+	inline const TaskLinkedList::Element &GetLLState() const{ return pLLState; }
 	/*@}*/
 };
 
@@ -0,0 +1,143 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "deParallelTaskQueue.h"
+#include "deParallelTask.h"
+#include "../common/exceptions.h"
+
+
+
+// Class deParallelTaskQueue
+//////////////////////////////
+
+// Constructor, destructor
+////////////////////////////
+
+deParallelTaskQueue::deParallelTaskQueue() :
+pHead(0),
+pCount(0)
+{
+	pTasks.SetCount(64, nullptr);
+}
+
+deParallelTaskQueue::~deParallelTaskQueue(){
+}
+
+
+
+// Management
+///////////////
+
+int deParallelTaskQueue::GetCount(){
+	const deMutexGuard lock(pMutex);
+	return pCount;
+}
+
+bool deParallelTaskQueue::IsEmpty(){
+	const deMutexGuard lock(pMutex);
+	return pCount == 0;
+}
+
+void deParallelTaskQueue::Push(deParallelTask *task){
+	DEASSERT_NOTNULL(task)
+	
+	const deMutexGuard lock(pMutex);
+	
+	if(pCount == pTasks.GetCount()){
+		pGrow();
+	}
+	
+	pTasks.SetAt((pHead + pCount) % pTasks.GetCount(), task);
+	pCount++;
+}
+
+deParallelTask *deParallelTaskQueue::PopBack(){
+	const deMutexGuard lock(pMutex);
+	
+	if(pCount == 0){
+		return nullptr;
+	}
+	
+	pCount--;
+	return pTasks.GetAt((pHead + pCount) % pTasks.GetCount());
+}
+
+deParallelTask *deParallelTaskQueue::Steal(){
+	const deMutexGuard lock(pMutex);
+	
+	if(pCount == 0){
+		return nullptr;
+	}
+	
+	deParallelTask * const task = pTasks.GetAt(pHead);
+	pHead = (pHead + 1) % pTasks.GetCount();
+	pCount--;
+	return task;
+}
+
+bool deParallelTaskQueue::Remove(deParallelTask *task){
+	const deMutexGuard lock(pMutex);
+	
+	const int size = pTasks.GetCount();
+	int i;
+	
+	for(i=0; i<pCount; i++){
+		if(pTasks.GetAt((pHead + i) % size) != task){
+			continue;
+		}
+		
+		for(; i<pCount-1; i++){
+			pTasks.SetAt((pHead + i) % size, pTasks.GetAt((pHead + i + 1) % size));
+		}
+		pCount--;
+		return true;
+	}
+	
+	return false;
+}
+
+void deParallelTaskQueue::RemoveAll(){
+	const deMutexGuard lock(pMutex);
+	pHead = 0;
+	pCount = 0;
+}
+
+
+
+// Private Functions
+//////////////////////
+
+void deParallelTaskQueue::pGrow(){
+	const int size = pTasks.GetCount();
+	decTList<deParallelTask*> tasks;
+	tasks.SetCount(size * 2, nullptr);
+	
+	int i;
+	for(i=0; i<pCount; i++){
+		tasks.SetAt(i, pTasks.GetAt((pHead + i) % size));
+	}
+	
+	pTasks = std::move(tasks);
+	pHead = 0;
+}
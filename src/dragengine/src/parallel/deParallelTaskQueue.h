@@ -0,0 +1,120 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DEPARALLELTASKQUEUE_H_
+#define _DEPARALLELTASKQUEUE_H_
+
+#include "../common/collection/decTList.h"
+#include "../threading/deMutex.h"
+#include "../threading/deMutexGuard.h"
+
+class deParallelTask;
+
+
+/**
+ * \brief Double ended queue of ready to run parallel tasks.
+ * 
+ * Used by deParallelProcessing for per-thread work stealing. The owning thread adds and
+ * takes tasks at the back of the queue while other threads steal tasks from the front.
+ * Each queue has an own mutex so threads only contend if they steal from the same queue.
+ * 
+ * Stores only weak references to tasks. Only deParallelProcessing is storing strong
+ * references to tasks.
+ */
+class DE_DLL_EXPORT deParallelTaskQueue{
+private:
+	deMutex pMutex;
+	decTList<deParallelTask*> pTasks;
+	int pHead;
+	int pCount;
+	
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/** \brief Create queue. */
+	deParallelTaskQueue();
+	
+	/** \brief Clean up queue. */
+	~deParallelTaskQueue();
+	/*@}*/
+	
+	
+	
+	/** \name Management */
+	/*@{*/
+	/** \brief Count of tasks. */
+	int GetCount();
+	
+	/** \brief Queue is empty. */
+	bool IsEmpty();
+	
+	/** \brief Add task to the back of the queue. */
+	void Push(deParallelTask *task);
+	
+	/** \brief Remove task from the back of the queue or nullptr if empty. */
+	deParallelTask *PopBack();
+	
+	/**
+	 * \brief Remove task from the front of the queue or nullptr if empty.
+	 * 
+	 * Used by threads stealing from this queue. Taking the oldest task leaves the
+	 * most recently added tasks to the owning thread.
+	 */
+	deParallelTask *Steal();
+	
+	/**
+	 * \brief Remove task if present.
+	 * 
+	 * Linear search. Use only while parallel processing is paused.
+	 */
+	bool Remove(deParallelTask *task);
+	
+	/** \brief Remove all tasks. */
+	void RemoveAll();
+	
+	/**
+	 * \brief Visit tasks from front to back.
+	 * 
+	 * Holds the queue mutex while visiting. Do not call queue methods from the visitor.
+	 */
+	template<typename Visitor>
+	void Visit(Visitor &&visitor){
+		const deMutexGuard lock(pMutex);
+		const int size = pTasks.GetCount();
+		int i;
+		for(i=0; i<pCount; i++){
+			visitor(pTasks.GetAt((pHead + i) % size));
+		}
+	}
+	/*@}*/
+	
+	
+	
+private:
+	void pGrow();
+};
+
+#endif
@@ -99,7 +99,7 @@ void deParallelThread::Run(){
 		//      this situation should not be possible to happen. to prevent any possibility
 		//      of a dead-lock the task is first acquired unlocked then written locked.
 		{
-		deParallelTask * const task = pParallelProcessing.NextPendingTask(pTakeLowPriorityTasks);
+		deParallelTask * const task = pParallelProcessing.NextPendingTask(*this);
 		
 		const deMutexGuard lock(pMutexTask);
 		pTask = task;
@@ -150,7 +150,7 @@ void deParallelThread::Run(){
 			task = pTask;
 			pTask = nullptr;
 			}
-			pParallelProcessing.AddFinishedTask(task);
+			pParallelProcessing.AddFinishedTask(*this, task);
 			}
 			
 		// otherwise go to sleep until new tasks become available
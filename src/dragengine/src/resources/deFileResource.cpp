@@ -50,6 +50,12 @@ pOutdated(false){
 }
 
 deFileResource::~deFileResource(){
+	// remove from resource manager while the filename is still valid. file resource
+	// lists use the filename to update their index. this marks the resource leaking
+	// so deResource does not remove it a second time
+	if(GetResourceManager()){
+		GetResourceManager()->RemoveResource(this);
+	}
 }
 
 
@@ -42,6 +42,7 @@ deFileResourceList::deFileResourceList(){
 }
 
 deFileResourceList::~deFileResourceList(){
+	RemoveAll();
 }
 
 
@@ -54,10 +55,65 @@ deResource *deFileResourceList::GetWithFilename(deVirtualFileSystem *vfs, const
 		DETHROW(deeInvalidParam);
 	}
 	
-	return GetResources().FindOrNull([&](const deResource *r){
-		const deFileResource &res = static_cast<const deFileResource&>(*r);
-		return !res.GetOutdated()
-			&& res.GetVirtualFileSystem() == vfs
-			&& res.GetFilename() == filename;
-	});
+	const decTList<deFileResource*> *resources;
+	if(!pFilenameIndex.GetAt(filename, resources)){
+		return nullptr;
+	}
+	
+	const int count = resources->GetCount();
+	int i;
+	for(i=0; i<count; i++){
+		deFileResource * const resource = resources->GetAt(i);
+		if(!resource->GetOutdated() && resource->GetVirtualFileSystem() == vfs){
+			return resource;
+		}
+	}
+	
+	return nullptr;
+}
+
+void deFileResourceList::Add(deResource *resource){
+	deResourceList::Add(resource);
+	pIndexAdd(static_cast<deFileResource*>(resource));
+}
+
+void deFileResourceList::Remove(deResource *resource){
+	deResourceList::Remove(resource);
+	pIndexRemove(static_cast<deFileResource*>(resource));
+}
+
+void deFileResourceList::RemoveIfPresent(deResource *resource){
+	if(Has(resource)){
+		Remove(resource);
+	}
+}
+
+void deFileResourceList::RemoveAll(){
+	deResourceList::RemoveAll();
+	pFilenameIndex.RemoveAll();
+}
+
+
+
+// Private Functions
+//////////////////////
+
+void deFileResourceList::pIndexAdd(deFileResource *resource){
+	if(pFilenameIndex.Has(resource->GetFilename())){
+		pFilenameIndex.GetAt(resource->GetFilename()).Add(resource);
+		
+	}else{
+		decTList<deFileResource*> resources;
+		resources.Add(resource);
+		pFilenameIndex.SetAt(resource->GetFilename(), resources);
+	}
+}
+
+void deFileResourceList::pIndexRemove(deFileResource *resource){
+	decTList<deFileResource*> &resources = pFilenameIndex.GetAt(resource->GetFilename());
+	resources.RemoveFrom(resources.IndexOf(resource));
+	
+	if(resources.IsEmpty()){
+		pFilenameIndex.Remove(resource->GetFilename());
+	}
 }
@@ -26,7 +26,11 @@
 #define _DEFILERESOURCELIST_H_
 
 #include "deResourceList.h"
+#include "../common/collection/decTDictionary.h"
+#include "../common/collection/decTList.h"
+#include "../common/string/decString.h"
 
+class deFileResource;
 class deVirtualFileSystem;
 
 
@@ -35,8 +39,18 @@ class deVirtualFileSystem;
  * 
  * Extends the resource list with a file resource specific check for the existence
  * of a file resource with a given name.
+ * 
+ * Resources are indexed by filename. Each index entry stores all resources with the
+ * same filename. Usually this is one resource unless resources are outdated or loaded
+ * from different virtual file systems. Lookups compare only the resources stored in
+ * the matching index entry.
  */
 class DE_DLL_EXPORT deFileResourceList : public deResourceList{
+private:
+	decTDictionary<decString, decTList<deFileResource*>> pFilenameIndex;
+	
+	
+	
 public:
 	/** \name Constructors and Destructors */
 	/*@{*/
@@ -51,9 +65,27 @@ public:
 	
 	/** \name Management */
 	/*@{*/
-	/** \brief Resource filename. */
+	/** \brief Not outdated resource with filename or nullptr if absent. */
 	deResource *GetWithFilename(deVirtualFileSystem *vfs, const char *filename) const;
+	
+	/** \brief Add resource. */
+	void Add(deResource *resource) override;
+	
+	/** \brief Remove resource. */
+	void Remove(deResource *resource) override;
+	
+	/** \brief Remove resource if present. */
+	void RemoveIfPresent(deResource *resource) override;
+	
+	/** \brief Remove all resources. */
+	void RemoveAll() override;
 	/*@}*/
+	
+	
+	
+private:
+	void pIndexAdd(deFileResource *resource);
+	void pIndexRemove(deFileResource *resource);
 };
 
 #endif
@@ -81,16 +81,16 @@ public:
 	bool Has(deResource *resource) const;
 	
 	/** \brief Add resource. */
-	void Add(deResource *resource);
+	virtual void Add(deResource *resource);
 	
 	/** \brief Remove resource. */
-	void Remove(deResource *resource);
+	virtual void Remove(deResource *resource);
 	
 	/** \brief Remove resource if present. */
-	void RemoveIfPresent(deResource *resource);
+	virtual void RemoveIfPresent(deResource *resource);
 	
 	/** \brief Remove all resources. */
-	void RemoveAll();
+	virtual void RemoveAll();
 	/*@}*/
 };
 
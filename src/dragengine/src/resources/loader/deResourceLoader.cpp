@@ -217,6 +217,7 @@ const char *path, eResourceType resourceType){
 				debugName.GetString(), path);
 		}
 		pPendingTasks.Add(task);
+		pIndexAddTask(task);
 		pEngine.GetParallelProcessing().AddTask(task);
 		
 	}else{
@@ -226,6 +227,7 @@ const char *path, eResourceType resourceType){
 				debugName.GetString(), path);
 		}
 		pFinishedTasks.Add(task);
+		pIndexAddTask(task);
 	}
 	return task;
 }
@@ -244,6 +246,7 @@ bool deResourceLoader::NextFinishedRequest(deResourceLoaderInfo &info){
 		if(pFinishedTasks.IsNotEmpty()){
 			task = pFinishedTasks.First();
 			pFinishedTasks.Remove(task);
+			pIndexRemoveTask(task);
 		}
 		
 		if(task){
@@ -301,6 +304,7 @@ void deResourceLoader::RemoveAllTasks(){
 	
 	pPendingTasks.RemoveAll();
 	pFinishedTasks.RemoveAll();
+	pTaskIndex.RemoveAll();
 	
 	if(resumeParallel){
 		pEngine.GetParallelProcessing().Resume();
@@ -331,20 +335,50 @@ void deResourceLoader::pCleanUp(){
 
 bool deResourceLoader::pHasTaskWith(deVirtualFileSystem *vfs,
 const char *path, eResourceType resourceType) const{
-	auto visitor = [&](const deResourceLoaderTask::Ref &task) {
-		return task->Matches(vfs, path, resourceType);
-	};
-	
-	const deResourceLoaderTask::Ref *t;
-	return pPendingTasks.Find(t, visitor) || pFinishedTasks.Find(t, visitor);
+	return pGetTaskWith(vfs, path, resourceType) != nullptr;
 }
 
 deResourceLoaderTask *deResourceLoader::pGetTaskWith(deVirtualFileSystem *vfs,
 const char *path, eResourceType resourceType) const{
-	auto visitor = [&](const deResourceLoaderTask::Ref &task) {
-		return task->Matches(vfs, path, resourceType);
-	};
+	if(!vfs || !path){
+		DETHROW(deeInvalidParam);
+	}
+	
+	// pending and finished tasks are indexed by path. only tasks with the same path
+	// have to be compared. usually this is a single task
+	const decTList<deResourceLoaderTask*> *tasks;
+	if(!pTaskIndex.GetAt(path, tasks)){
+		return nullptr;
+	}
+	
+	const int count = tasks->GetCount();
+	int i;
+	for(i=0; i<count; i++){
+		deResourceLoaderTask * const task = tasks->GetAt(i);
+		if(task->Matches(vfs, path, resourceType)){
+			return task;
+		}
+	}
+	
+	return nullptr;
+}
+
+void deResourceLoader::pIndexAddTask(deResourceLoaderTask *task){
+	if(pTaskIndex.Has(task->GetPath())){
+		pTaskIndex.GetAt(task->GetPath()).Add(task);
+		
+	}else{
+		decTList<deResourceLoaderTask*> tasks;
+		tasks.Add(task);
+		pTaskIndex.SetAt(task->GetPath(), tasks);
+	}
+}
+
+void deResourceLoader::pIndexRemoveTask(deResourceLoaderTask *task){
+	decTList<deResourceLoaderTask*> &tasks = pTaskIndex.GetAt(task->GetPath());
+	tasks.RemoveFrom(tasks.IndexOf(task));
 	
-	const deResourceLoaderTask::Ref *t;
-	return pPendingTasks.Find(t, visitor) || pFinishedTasks.Find(t, visitor) ? (*t).Pointer() : nullptr;
+	if(tasks.IsEmpty()){
+		pTaskIndex.Remove(task->GetPath());
+	}
 }
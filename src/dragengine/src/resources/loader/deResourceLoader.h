@@ -25,7 +25,10 @@
 #ifndef _DERESOURCELOADER_H_
 #define _DERESOURCELOADER_H_
 
+#include "../../common/collection/decTDictionary.h"
+#include "../../common/collection/decTList.h"
 #include "../../common/collection/decTOrderedSet.h"
+#include "../../common/string/decString.h"
 #include "../../threading/deTThreadSafeObjectReference.h"
 
 class deResourceLoaderTask;
@@ -109,6 +112,7 @@ private:
 	deEngine &pEngine;
 	
 	TaskList pPendingTasks, pFinishedTasks;
+	decTDictionary<decString, decTList<deResourceLoaderTask*>> pTaskIndex;
 	
 	bool pLoadAsynchron;
 	bool pOutputDebugMessages;
@@ -211,6 +215,9 @@ private:
 	
 	deResourceLoaderTask *pGetTaskWith(deVirtualFileSystem *vfs, const char *path,
 		eResourceType resourceType) const;
+	
+	void pIndexAddTask(deResourceLoaderTask *task);
+	void pIndexRemoveTask(deResourceLoaderTask *task);
 };
 
 #endif
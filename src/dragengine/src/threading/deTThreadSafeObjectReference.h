@@ -126,14 +126,23 @@ public:
 		}
 	}
 	
-	/** \brief Move constructor. */
-	deTThreadSafeObjectReference(deTThreadSafeObjectReference &&reference) : pObject(reference.pObject){
+	/**
+	 * \brief Move constructor.
+	 * 
+	 * Takes over the reference without touching the reference count.
+	 */
+	deTThreadSafeObjectReference(deTThreadSafeObjectReference &&reference) noexcept : pObject(reference.pObject){
 		reference.pObject = nullptr;
 	}
 	
-	/** \brief Move constructor. */
+	/**
+	 * \brief Move constructor.
+	 * 
+	 * Takes over the reference without touching the reference count.
+	 */
 	template<typename U, typename = typename std::enable_if<std::is_base_of<T, U>::value>::type>
-	explicit deTThreadSafeObjectReference(deTThreadSafeObjectReference<U> &&reference) : pObject(static_cast<T*>(reference.Pointer())){
+	explicit deTThreadSafeObjectReference(deTThreadSafeObjectReference<U> &&reference) noexcept :
+	pObject(static_cast<T*>(reference.pObject)){
 		reference.pObject = nullptr;
 	}
 	
@@ -271,8 +280,12 @@ public:
 		return operator=(static_cast<T*>(reference.Pointer()));
 	}
 	
-	/** \brief Move assignment operator. */
-	deTThreadSafeObjectReference &operator=(deTThreadSafeObjectReference &&reference){
+	/**
+	 * \brief Move assignment operator.
+	 * 
+	 * Takes over the reference without touching the reference count.
+	 */
+	deTThreadSafeObjectReference &operator=(deTThreadSafeObjectReference &&reference) noexcept{
 		if(&reference == this){
 			return *this;
 		}
@@ -287,20 +300,20 @@ public:
 		return *this;
 	}
 	
-	/** \brief Move assignment operator. */
+	/**
+	 * \brief Move assignment operator.
+	 * 
+	 * Takes over the reference without touching the reference count.
+	 */
 	template<typename U, typename = typename std::enable_if<std::is_base_of<T, U>::value>::type>
-	deTThreadSafeObjectReference &operator=(deTThreadSafeObjectReference<U> &&reference){
-		T *object = static_cast<T*>(reference.Pointer());
-		
-		if(object == pObject){
-			return *this;
-		}
-		
+	deTThreadSafeObjectReference &operator=(deTThreadSafeObjectReference<U> &&reference) noexcept{
+		// if both hold the same object the held reference is dropped and the moved
+		// reference taken over. this keeps the reference count correct
 		if(pObject){
 			pObject->FreeReference();
 		}
 		
-		pObject = object;
+		pObject = static_cast<T*>(reference.pObject);
 		reference.pObject = nullptr;
 		
 		return *this;
@@ -345,10 +358,23 @@ public:
 	
 	/** \brief Auto-cast to super class (static cast). */
 	template<typename U, typename = typename std::enable_if<std::is_base_of<U, T>::value>::type>
-	operator deTThreadSafeObjectReference<U>() const{
+	operator deTThreadSafeObjectReference<U>() const &{
 		return deTThreadSafeObjectReference<U>(static_cast<U*>(pObject));
 	}
 	
+	/**
+	 * \brief Auto-cast to super class (static cast) taking over the reference.
+	 * 
+	 * Reference count is not touched and this holder is cleared.
+	 */
+	template<typename U, typename = typename std::enable_if<std::is_base_of<U, T>::value>::type>
+	operator deTThreadSafeObjectReference<U>() &&{
+		deTThreadSafeObjectReference<U> reference;
+		reference.pObject = static_cast<U*>(pObject);
+		pObject = nullptr;
+		return reference;
+	}
+	
 	/** \brief Static cast to super class. */
 	template<typename U> deTThreadSafeObjectReference<U> StaticCast() const{
 		return deTThreadSafeObjectReference<U>(static_cast<U*>(pObject));
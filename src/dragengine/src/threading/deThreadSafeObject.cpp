@@ -26,7 +26,6 @@
 #include <stdlib.h>
 
 #include "deThreadSafeObject.h"
-#include "deMutexGuard.h"
 #include "../common/exceptions.h"
 
 
@@ -50,27 +49,27 @@ deThreadSafeObject::~deThreadSafeObject(){
 ///////////////
 
 int deThreadSafeObject::GetRefCount(){
-	const deMutexGuard lock(pMutex);
-	return pRefCount;
+	return pRefCount.load(std::memory_order_relaxed);
 }
 
 void deThreadSafeObject::AddReference(){
-	const deMutexGuard lock(pMutex);
-	pRefCount++;
+	// a new reference can only be created from an existing one. no ordering is required
+	pRefCount.fetch_add(1, std::memory_order_relaxed);
 }
 
 void deThreadSafeObject::FreeReference(){
-	deMutexGuard lock(pMutex);
-	pRefCount--;
-	if(pRefCount > 0){
+	// release makes all writes done by this thread visible to the thread deleting the object
+	const int refCount = pRefCount.fetch_sub(1, std::memory_order_release) - 1;
+	if(refCount > 0){
 		return;
 	}
 	
-	if(pRefCount < 0){
+	if(refCount < 0){
 		deeInvalidParam(__FILE__, __LINE__).PrintError();
 		return;
 	}
 	
-	lock.Unlock();
+	// acquire pairs with the release of all other threads freeing their references
+	std::atomic_thread_fence(std::memory_order_acquire);
 	delete this;
 }
@@ -25,16 +25,22 @@
 #ifndef _DETHREADSAFEOBJECT_H_
 #define _DETHREADSAFEOBJECT_H_
 
-#include "deMutex.h"
+#include <atomic>
+
+#include "../dragengine_export.h"
 #include "deTThreadSafeObjectReference.h"
 
 
 /**
  * \brief Thread safe version of deObject.
  *
- * In contrary to deObject a deMutex is used to protect reference manipulations against multi
- * threaded use. This does not imply all methods of the object are thread safe. Subclasses
- * are encouraged to use GetMutex() to provide thread safe access to methods.
+ * In contrary to deObject the reference count is an atomic counter protecting reference
+ * manipulations against multi threaded use without locking. Adding a reference uses relaxed
+ * ordering. Freeing a reference uses release ordering and the thread dropping the last
+ * reference synchronizes with all other threads before deleting the object.
+ * 
+ * This does not imply all methods of the object are thread safe. Subclasses have to
+ * protect their own state if required.
  */
 class DE_DLL_EXPORT deThreadSafeObject{
 public:
@@ -44,8 +50,7 @@ public:
 	
 
 private:
-	int pRefCount;
-	deMutex pMutex;
+	std::atomic<int> pRefCount;
 	
 	
 	
@@ -70,7 +75,12 @@ protected:
 public:
 	/** \name Management */
 	/*@{*/
-	/** \brief Reference count. */
+	/**
+	 * \brief Reference count.
+	 * 
+	 * The returned value can be outdated the moment it is returned if other threads
+	 * hold references to this object. Use only for debugging and testing.
+	 */
 	int GetRefCount();
 	
 	/** \brief Add reference increasing reference count by 1. */
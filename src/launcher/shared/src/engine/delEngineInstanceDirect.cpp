@@ -64,6 +64,7 @@
 #include <dragengine/filesystem/deVFSDiskDirectory.h>
 #include <dragengine/filesystem/deVirtualFileSystem.h>
 #include <dragengine/filesystem/deCollectFileSearchVisitor.h>
+#include <dragengine/logger/deLoggerAsync.h>
 #include <dragengine/logger/deLoggerFile.h>
 #include <dragengine/logger/deLoggerChain.h>
 #include <dragengine/logger/deLoggerConsoleColor.h>
@@ -220,8 +221,11 @@ bool delEngineInstanceDirect::StartEngine(){
 			
 			diskPath.RemoveLastComponent();
 			
-			engineLogger = deLoggerFile::Ref::New(
-				deVFSDiskDirectory::Ref::New(diskPath)->OpenFileForWriting(filePath));
+			const deLoggerFile::Ref loggerFile(deLoggerFile::Ref::New(
+				deVFSDiskDirectory::Ref::New(diskPath)->OpenFileForWriting(filePath)));
+			loggerFile->SetAutoFlush(false);
+			
+			engineLogger = deLoggerAsync::Ref::New(loggerFile);
 		}
 		
 		// create os
@@ -68,6 +68,7 @@
 #include <dragengine/filesystem/deVFSDiskDirectory.h>
 #include <dragengine/filesystem/deVirtualFileSystem.h>
 #include <dragengine/filesystem/deCollectFileSearchVisitor.h>
+#include <dragengine/logger/deLoggerAsync.h>
 #include <dragengine/logger/deLoggerFile.h>
 #include <dragengine/logger/deLoggerChain.h>
 #include <dragengine/logger/deLoggerConsoleColor.h>
@@ -1653,6 +1654,11 @@ void delEngineProcess::pCreateLogger(const char *logfile){
 	
 	diskPath.RemoveLastComponent();
 	
-	pLogger = deLoggerFile::Ref::New(deVFSDiskDirectory::Ref::New(diskPath)->
-		OpenFileForWriting(filePath));
+	// engine and game modules can log heavily from multiple threads. write the log file
+	// from a background thread in batches instead of flushing after every message
+	const deLoggerFile::Ref loggerFile(deLoggerFile::Ref::New(
+		deVFSDiskDirectory::Ref::New(diskPath)->OpenFileForWriting(filePath)));
+	loggerFile->SetAutoFlush(false);
+	
+	pLogger = deLoggerAsync::Ref::New(loggerFile);
 }
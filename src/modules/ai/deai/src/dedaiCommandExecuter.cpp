@@ -30,6 +30,8 @@
 #include "dedaiCommandExecuter.h"
 #include "deDEAIModule.h"
 #include "devmode/dedaiDeveloperMode.h"
+#include "navigation/pathfinding/dedaiPathFinderNavMeshBenchmark.h"
+#include "navigation/pathfinding/dedaiPathFinderNavMeshTest.h"
 
 #include <dragengine/deEngine.h>
 #include <dragengine/common/string/unicode/decUnicodeString.h>
@@ -67,6 +69,21 @@ void dedaiCommandExecuter::ExecuteCommand(const decUnicodeArgumentList &command,
 	}else if(command.MatchesArgumentAt(0, "help")){
 		pHelp(command, answer);
 		
+	}else if(command.MatchesArgumentAt(0, "pathFindingTest")){
+		dedaiPathFinderNavMeshTest(*pDEAI).Run(answer);
+		
+	}else if(command.MatchesArgumentAt(0, "pathFindingBenchmark")){
+		const int size = command.GetArgumentCount() > 1 ? command.GetArgumentAt(1)->ToInt() : 64;
+		const int queryCount = command.GetArgumentCount() > 2 ? command.GetArgumentAt(2)->ToInt() : 1000;
+		const int threadCount = command.GetArgumentCount() > 3 ? command.GetArgumentAt(3)->ToInt() : 4;
+		
+		if(size < 2 || size > 180 || queryCount < 1 || threadCount < 1){
+			answer.SetFromUTF8("Requires grid size from 2 to 180, at least 1 query and 1 thread.");
+			return;
+		}
+		
+		dedaiPathFinderNavMeshBenchmark(*pDEAI).Run(size, queryCount, threadCount, answer);
+		
 	}else if(!pDEAI->GetDeveloperMode().ExecuteCommand(command, answer)){
 		answer.SetFromUTF8("Unknown command '");
 		answer += *command.GetArgumentAt(0);
@@ -80,5 +97,7 @@ void dedaiCommandExecuter::ExecuteCommand(const decUnicodeArgumentList &command,
 //////////////////////
 
 void dedaiCommandExecuter::pHelp(const decUnicodeArgumentList &command, decUnicodeString &answer){
-	answer.SetFromUTF8("help => Displays this help screen.\n");
+	answer.SetFromUTF8("help => Displays this help screen.\n"
+		"pathFindingTest => Test navigation mesh path finding.\n"
+		"pathFindingBenchmark [size] [queries] [threads] => Benchmark navigation mesh path finding.\n");
 }
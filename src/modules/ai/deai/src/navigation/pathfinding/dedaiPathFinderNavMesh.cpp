@@ -36,6 +36,8 @@
 #include "../../deDEAIModule.h"
 #include "../../world/dedaiWorld.h"
 
+#include <algorithm>
+
 #include <dragengine/common/exceptions.h>
 #include <dragengine/resources/debug/deDebugDrawerShape.h>
 #include <dragengine/resources/debug/deDebugDrawerShapeFace.h>
@@ -60,8 +62,6 @@
 
 // #define DEBUG 1
 
-
-
 // Class dedaiPathFinderNavMesh
 /////////////////////////////////
 
@@ -112,8 +112,8 @@ void dedaiPathFinderNavMesh::FindPath(){
 	try{
 		pFindFacePath();
 		pFindRealPath();
-		pUpdateDDSListOpen();
-		pUpdateDDSListClosed();
+		pUpdateDDSList(pDDSListOpen, ensOpen);
+		pUpdateDDSList(pDDSListClosed, ensClosed);
 		pClearLists();
 		
 	}catch(const deException &){
@@ -172,19 +172,49 @@ void dedaiPathFinderNavMesh::SetDDSListClosed(deDebugDrawerShape *dds){
 //////////////////////
 
 void dedaiPathFinderNavMesh::pClearLists(){
-	int i, count;
+	pNodes.SetCountDiscard(0);
+	pFaceNodes.RemoveAll();
+	pListOpen.SetCountDiscard(0);
+}
+
+int dedaiPathFinderNavMesh::pAddNode(dedaiSpaceMeshFace *face, int parent, float costG,
+float costH, const decVector &entryPoint, eNodeStates state){
+	const int index = pNodes.GetCount();
+	pNodes.Add({face, parent, costG + costH, costG, costH, entryPoint, state});
+	pFaceNodes.SetAt(face, index);
+	return index;
+}
+
+void dedaiPathFinderNavMesh::pPushOpen(int node){
+	pListOpen.Add({pNodes.GetAt(node).costF, node});
 	
-	count = pListClosed.GetCount();
-	for(i=0; i<count; i++){
-		pListClosed.GetAt(i)->ClearPath();
+	sOpenEntry * const entries = pListOpen.GetArrayPointer();
+	std::push_heap(entries, entries + pListOpen.GetCount(), pOpenListOrder);
+}
+
+bool dedaiPathFinderNavMesh::pOpenListOrder(const sOpenEntry &a, const sOpenEntry &b){
+	// the node with the lowest F cost is on top of the heap. for equal F cost the node
+	// added last is preferred
+	return a.costF > b.costF || (a.costF == b.costF && a.node < b.node);
+}
+
+int dedaiPathFinderNavMesh::pPopOpen(){
+	// improving the cost of an open node pushes a new entry instead of moving the existing
+	// one. entries no longer matching their node are skipped while popping
+	while(pListOpen.IsNotEmpty()){
+		sOpenEntry * const entries = pListOpen.GetArrayPointer();
+		std::pop_heap(entries, entries + pListOpen.GetCount(), pOpenListOrder);
+		
+		const sOpenEntry entry(pListOpen.Last());
+		pListOpen.RemoveLast();
+		
+		const sNode &node = pNodes.GetAt(entry.node);
+		if(node.state == ensOpen && node.costF == entry.costF){
+			return entry.node;
+		}
 	}
-	pListClosed.RemoveAll();
 	
-	count = pListOpen.GetCount();
-	for(i=0; i<count; i++){
-		pListOpen.GetAt(i)->ClearPath();
-	}
-	pListOpen.RemoveAll();
+	return -1;
 }
 
 void dedaiPathFinderNavMesh::pFindFacePath(){
@@ -199,9 +229,10 @@ void dedaiPathFinderNavMesh::pFindFacePath(){
 	float distance = 0.0f;
 	decVector entryPoint;
 	float gcost = 0.0f;
-	int f, faceCount;
+	int endNode = -1;
 	
 	pPathFaces.RemoveAll();
+	pClearLists();
 	
 	pStartFace = pNavigator->GetLayer()->GetMeshFaceClosestTo(pStartPoint, distance);
 	
@@ -241,27 +272,25 @@ void dedaiPathFinderNavMesh::pFindFacePath(){
 		const decDVector targetEnd = pEndFace->GetMesh()->GetSpace().GetMatrix() * pEndFace->GetCenter();
 		const decDVector targetStart = pStartFace->GetMesh()->GetSpace().GetMatrix() * pStartFace->GetCenter();
 		
-		pListOpen.Add(pStartFace);
-		pStartFace->SetPathParent(nullptr);
-		pStartFace->SetPathCostG(0.0f);
-		pStartFace->SetPathCostH((float)((targetEnd - targetStart).Length()));
-		pStartFace->SetPathCostF(pStartFace->GetPathCostH());
-		pStartFace->SetPathType(dedaiSpaceMeshFace::epftOpen);
 		if(improvedSearchMode){
-			pStartFace->SetEntryPoint((pStartFace->GetMesh()->GetSpace().GetInverseMatrix() * pStartPoint).ToVector());
+			entryPoint = (pStartFace->GetMesh()->GetSpace().GetInverseMatrix() * pStartPoint).ToVector();
 		}
-#ifdef DEBUG
-		{const decDVector c2 = pStartFace->GetMesh()->GetSpace().GetMatrix() * pStartFace->GetCenter();
-		module.LogInfoFormat("   Open Add Face: nm=%p f=%i (%.3f,%.3f,%.3f)", pStartFace->GetMesh(),
-			pStartFace->GetIndex(), c2.x, c2.y, c2.z);}
-#endif
-		testFace = pStartFace;
+		pPushOpen(pAddNode(pStartFace, -1, 0.0f, (float)((targetEnd - targetStart).Length()),
+			entryPoint, ensOpen));
+		
+		int testNode = pPopOpen();
 		
-		while(testFace){
+		while(testNode != -1){
+			// node references are not stable while adding nodes. keep a copy of what is needed
+			const sNode &test = pNodes.GetAt(testNode);
+			const decVector testEntryPoint(test.entryPoint);
+			const float testCostG = test.costG;
+			testFace = test.face;
+			
 #ifdef DEBUG
 			{const decDVector c2 = testFace->GetMesh()->GetSpace().GetMatrix() * testFace->GetCenter();
-			module.LogInfoFormat("   Testing Face: nm=%p f=%i (%.3f,%.3f,%.3f)", testFace->GetMesh(),
-				testFace->GetIndex(), c2.x, c2.y, c2.z);}
+			module.LogInfoFormat("   Testing Face: nm=%p f=%i p=%i c=(%g,%g,%g) (%.3f,%.3f,%.3f)", testFace->GetMesh(),
+				testFace->GetIndex(), test.parent, test.costF, test.costG, test.costH, c2.x, c2.y, c2.z);}
 #endif
 			const dedaiSpaceMeshCorner * const corners = testFace->GetMesh()->GetCorners().GetArrayPointer();
 			const dedaiSpaceMeshEdge * const edges = testFace->GetMesh()->GetEdges().GetArrayPointer();
@@ -296,256 +325,198 @@ void dedaiPathFinderNavMesh::pFindFacePath(){
 					}
 				}
 				
-				// path can continue here if there is a next face
-				if(nextFace){
-					// calculate costs only if the face is not on the closed list
-					if(nextFace->GetPathType() != dedaiSpaceMeshFace::epftClosed){
-						pNavigator->GetCostParametersFor(nextFace->GetTypeNumber(), fixCost, costPerMeter);
-						gcost = testFace->GetPathCostG();
-						
-						// apply fix cost only if the next face has a different type number. if applied always
-						// split faces apply the fix cost multiple times falsifying the result. forcing the
-						// rule to apply the fix cost only on type number changes is the only correct way
-						if(nextFace->GetTypeNumber() != testFace->GetTypeNumber()){
-							gcost += fixCost;
-						}
+				// path can continue here if there is a next face not on the closed list
+				if(!nextFace){
+					continue;
+				}
+				
+				const int nextNode = pFaceNodes.GetAtOrDefault(nextFace, -1);
+				if(nextNode != -1 && pNodes.GetAt(nextNode).state == ensClosed){
+					continue;
+				}
+				
+				pNavigator->GetCostParametersFor(nextFace->GetTypeNumber(), fixCost, costPerMeter);
+				gcost = testCostG;
+				
+				// apply fix cost only if the next face has a different type number. if applied always
+				// split faces apply the fix cost multiple times falsifying the result. forcing the
+				// rule to apply the fix cost only on type number changes is the only correct way
+				if(nextFace->GetTypeNumber() != testFace->GetTypeNumber()){
+					gcost += fixCost;
+				}
+				
+				/*
+				// this is not correct (and a bad idea). if faces are split the movement cost increases
+				// due to crossing additional edges. this shifts the favor to non-split faces or path
+				// where larger faces without cuts in them are located. besides handling corner type
+				// assignment in 3d modeling applications is a problem too. so drop it altogether.
+				
+				if(corner.GetTypeNumber() != CORNER_NO_COST){
+					gcost += pNavigator->GetFixCostFor(corner.GetTypeNumber());
+				}
+				*/
+				
+				// apply cost per meter. applying this always works correctly with split faces. the
+				// original algorithm uses the distance between face centers. this works well if the
+				// faces all are similar in shape and size. in the geneal case though this leads to
+				// wrong results and bad initial path choice. the situation can be improved by not
+				// using the face center but a point on the entry edge along the connection line
+				// between the two face centers. correct calculation requires intersecting this line
+				// with a plane along the edge oriented towards the exit face center or comparing the
+				// angles between the this line and the edge corners. both solutions are time consuming
+				// and in the end we only need some point on the edge located around the correct point
+				// to obtain a better result. in this case a simple and fast approximation can be used.
+				// both face centers are projected onto the edge and averaged. the result is clamped
+				// to the edge. this point is good enough to obtain better results at little cost.
+				// this can even go as simple as using the center of the edge, it still works better
+				// than using the face center. the resulting point is stored in the node and used
+				// instead of the face center for future cost calculations. for the starting face the
+				// entry point is set to the start point. if the node parent changes the entry point
+				// is updated too
+				// 
+				// NOTE using the center of the edge has a nice additional affect over all other
+				//      solutions in that the entry point can be calculate across different spaces
+				//      without taking the detour over world space conversation using matrices
+				if(testFace->GetMesh() == nextFace->GetMesh()){
+					if(improvedSearchMode){
+						const decVector &edgeV1 = testFace->GetMesh()->GetVertices()[edge.GetVertex1()];
+						const decVector &edgeV2 = testFace->GetMesh()->GetVertices()[edge.GetVertex2()];
+						decVector edgeDir(edgeV2 - edgeV1);
+						const float edgeLen = edgeDir.Length();
+						edgeDir /= edgeLen;
+						//entryPoint = edgeV1 + edgeDir * decMath::clamp(
+						//	( edgeDir * ( testEntryPoint - edgeV1 )
+						//	+ edgeDir * ( nextFace->GetCenter() - edgeV1 ) ) * 0.5f, 0.0f, edgeLen );
+						entryPoint = edgeV1 + edgeDir * decMath::clamp(
+							edgeDir * ((testEntryPoint + nextFace->GetCenter()) * 0.5f), 0.0f, edgeLen);
 						
 						/*
-						// this is not correct (and a bad idea). if faces are split the movement cost increases
-						// due to crossing additional edges. this shifts the favor to non-split faces or path
-						// where larger faces without cuts in them are located. besides handling corner type
-						// assignment in 3d modeling applications is a problem too. so drop it altogether.
-						
-						if(corner.GetTypeNumber() != CORNER_NO_COST){
-							gcost += pNavigator->GetFixCostFor(corner.GetTypeNumber());
-						}
+						const decVector &edgeV1 = testFace->GetMesh()->GetVertices()[edge.GetVertex1()];
+						const decVector &edgeV2 = testFace->GetMesh()->GetVertices()[edge.GetVertex2()];
+						entryPoint = (edgeV2 - edgeV1) * 0.5f;
 						*/
 						
-						// apply cost per meter. applying this always works correctly with split faces. the
-						// original algorithm uses the distance between face centers. this works well if the
-						// faces all are similar in shape and size. in the geneal case though this leads to
-						// wrong results and bad initial path choice. the situation can be improved by not
-						// using the face center but a point on the entry edge along the connection line
-						// between the two face centers. correct calculation requires intersecting this line
-						// with a plane along the edge oriented towards the exit face center or comparing the
-						// angles between the this line and the edge corners. both solutions are time consuming
-						// and in the end we only need some point on the edge located around the correct point
-						// to obtain a better result. in this case a simple and fast approximation can be used.
-						// both face centers are projected onto the edge and averaged. the result is clamped
-						// to the edge. this point is good enough to obtain better results at little cost.
-						// this can even go as simple as using the center of the edge, it still works better
-						// than using the face center. the resulting point is stored in the face and used
-						// instead of the face center for future cost calculations. for the starting face the
-						// entry point is set to the start point. if the face parent changes the entry point
-						// is updated too
-						// 
-						// NOTE using the center of the edge has a nice additional affect over all other
-						//      solutions in that the entry point can be calculate across different spaces
-						//      without taking the detour over world space conversation using matrices
-						if(testFace->GetMesh() == nextFace->GetMesh()){
-							if(improvedSearchMode){
-								const decVector &edgeV1 = testFace->GetMesh()->GetVertices()[edge.GetVertex1()];
-								const decVector &edgeV2 = testFace->GetMesh()->GetVertices()[edge.GetVertex2()];
-								decVector edgeDir(edgeV2 - edgeV1);
-								const float edgeLen = edgeDir.Length();
-								edgeDir /= edgeLen;
-								//entryPoint = edgeV1 + edgeDir * decMath::clamp(
-								//	( edgeDir * ( testFace->GetEntryPoint() - edgeV1 )
-								//	+ edgeDir * ( nextFace->GetCenter() - edgeV1 ) ) * 0.5f, 0.0f, edgeLen );
-								entryPoint = edgeV1 + edgeDir * decMath::clamp(
-									edgeDir * ((testFace->GetEntryPoint() + nextFace->GetCenter()) * 0.5f), 0.0f, edgeLen);
-								
-								/*
-								const decVector &edgeV1 = testFace->GetMesh()->GetVertices()[edge.GetVertex1()];
-								const decVector &edgeV2 = testFace->GetMesh()->GetVertices()[edge.GetVertex2()];
-								entryPoint = (edgeV2 - edgeV1) * 0.5f;
-								*/
-								
-							}else{
-								gcost += costPerMeter * (nextFace->GetCenter() - testFace->GetCenter()).Length();
-							}
-							
-						}else{
-							if(improvedSearchMode){
-								const decDVector nextPoint(testFace->GetMesh()->GetSpace().GetInverseMatrix() *
-									(nextFace->GetMesh()->GetSpace().GetMatrix() * nextFace->GetCenter()));
-								const decVector &edgeV1 = testFace->GetMesh()->GetVertices()[edge.GetVertex1()];
-								const decVector &edgeV2 = testFace->GetMesh()->GetVertices()[edge.GetVertex2()];
-								decVector edgeDir(edgeV2 - edgeV1);
-								const float edgeLen = edgeDir.Length();
-								edgeDir /= edgeLen;
-								entryPoint = edgeV1 + edgeDir * decMath::clamp(
-									edgeDir * ((testFace->GetEntryPoint() + nextPoint) * 0.5f), 0.0f, edgeLen);
-								
-								/*
-								const dedaiSpaceMeshEdge &linkedEdge = nextFace->GetMesh()->GetEdges()[
-									nextFace->GetMesh()->GetCorners()[nextFace->GetFirstCorner() + linkedCorner].GetEdge()];
-								const decVector &edgeV1 = nextFace->GetMesh()->GetVertices()[linkedEdge.GetVertex1()];
-								const decVector &edgeV2 = nextFace->GetMesh()->GetVertices()[linkedEdge.GetVertex2()];
-								entryPoint = (edgeV2 - edgeV1) * 0.5f;
-								*/
-								
-							}else{
-								const decDVector testFaceCenter = testFace->GetMesh()->GetSpace().GetMatrix() * testFace->GetCenter();
-								const decDVector nextFaceCenter = nextFace->GetMesh()->GetSpace().GetMatrix() * nextFace->GetCenter();
-								gcost += costPerMeter * (float)((nextFaceCenter - testFaceCenter).Length());
-							}
-						}
+					}else{
+						gcost += costPerMeter * (nextFace->GetCenter() - testFace->GetCenter()).Length();
 					}
 					
-					// add it to the list if not on one already
-					if(nextFace->GetPathType() == dedaiSpaceMeshFace::epftFree){
-						nextFace->SetPathParent(testFace);
-						nextFace->SetPathCostG(gcost);
-						if(improvedSearchMode){
-							nextFace->SetEntryPoint(entryPoint);
-							const decDVector testFaceCenter = testFace->GetMesh()->GetSpace().GetMatrix() * entryPoint;
-							nextFace->SetPathCostH((float)((targetEnd - testFaceCenter).Length()));
-						}else{
-							const decDVector testFaceCenter = testFace->GetMesh()->GetSpace().GetMatrix() * testFace->GetCenter();
-							nextFace->SetPathCostH((float)((targetEnd - testFaceCenter).Length()));
-						}
-						nextFace->SetPathCostF(gcost + nextFace->GetPathCostH());
+				}else{
+					if(improvedSearchMode){
+						const decDVector nextPoint(testFace->GetMesh()->GetSpace().GetInverseMatrix() *
+							(nextFace->GetMesh()->GetSpace().GetMatrix() * nextFace->GetCenter()));
+						const decVector &edgeV1 = testFace->GetMesh()->GetVertices()[edge.GetVertex1()];
+						const decVector &edgeV2 = testFace->GetMesh()->GetVertices()[edge.GetVertex2()];
+						decVector edgeDir(edgeV2 - edgeV1);
+						const float edgeLen = edgeDir.Length();
+						edgeDir /= edgeLen;
+						entryPoint = edgeV1 + edgeDir * decMath::clamp(
+							edgeDir * ((testEntryPoint + nextPoint) * 0.5f), 0.0f, edgeLen);
 						
-						// add to open list if the cost is not larger than the blocking cost
-						if(nextFace->GetPathCostF() < blockingCost){
-							pListOpen.Add(nextFace);
-							nextFace->SetPathType(dedaiSpaceMeshFace::epftOpen);
+						/*
+						const dedaiSpaceMeshEdge &linkedEdge = nextFace->GetMesh()->GetEdges()[
+							nextFace->GetMesh()->GetCorners()[nextFace->GetFirstCorner() + linkedCorner].GetEdge()];
+						const decVector &edgeV1 = nextFace->GetMesh()->GetVertices()[linkedEdge.GetVertex1()];
+						const decVector &edgeV2 = nextFace->GetMesh()->GetVertices()[linkedEdge.GetVertex2()];
+						entryPoint = (edgeV2 - edgeV1) * 0.5f;
+						*/
+						
+					}else{
+						const decDVector testFaceCenter = testFace->GetMesh()->GetSpace().GetMatrix() * testFace->GetCenter();
+						const decDVector nextFaceCenter = nextFace->GetMesh()->GetSpace().GetMatrix() * nextFace->GetCenter();
+						gcost += costPerMeter * (float)((nextFaceCenter - testFaceCenter).Length());
+					}
+				}
+				
+				// add it to the list if not on one already
+				if(nextNode == -1){
+					float hcost;
+					if(improvedSearchMode){
+						const decDVector testFaceCenter = testFace->GetMesh()->GetSpace().GetMatrix() * entryPoint;
+						hcost = (float)((targetEnd - testFaceCenter).Length());
+					}else{
+						const decDVector testFaceCenter = testFace->GetMesh()->GetSpace().GetMatrix() * testFace->GetCenter();
+						hcost = (float)((targetEnd - testFaceCenter).Length());
+					}
+					
+					// add to open list if the cost is not larger than the blocking cost. if the cost is
+					// larger than the blocking cost this face can not be crossed. in this case add it
+					// to the closed list so it is not tested anymore in the future
+					if(gcost + hcost < blockingCost){
+						pPushOpen(pAddNode(nextFace, testNode, gcost, hcost, entryPoint, ensOpen));
 #ifdef DEBUG
-							{const decDVector c2 = nextFace->GetMesh()->GetSpace().GetMatrix() * nextFace->GetCenter();
-							module.LogInfoFormat("   Open Add Face: %p:%i (p=%p:%i c=(%g,%g,%g) t=%i) (%.3f,%.3f,%.3f)",
-								nextFace->GetMesh(), nextFace->GetIndex(), testFace->GetMesh(), testFace->GetIndex(),
-								nextFace->GetPathCostF(), nextFace->GetPathCostG(), nextFace->GetPathCostH(),
-								nextFace->GetTypeNumber(), c2.x, c2.y, c2.z);}
+						{const decDVector c2 = nextFace->GetMesh()->GetSpace().GetMatrix() * nextFace->GetCenter();
+						module.LogInfoFormat("   Open Add Face: %p:%i (p=%p:%i c=(%g,%g,%g) t=%i) (%.3f,%.3f,%.3f)",
+							nextFace->GetMesh(), nextFace->GetIndex(), testFace->GetMesh(), testFace->GetIndex(),
+							gcost + hcost, gcost, hcost, nextFace->GetTypeNumber(), c2.x, c2.y, c2.z);}
 #endif
-						// if the cost is larger than the blocking cost this face can not be crossed. in this case
-						// add it to the closed list so it is not tested anymore in the future
-						}else{
-							pListClosed.Add(nextFace);
-							nextFace->SetPathType(dedaiSpaceMeshFace::epftClosed);
+						
+					}else{
+						pAddNode(nextFace, testNode, gcost, hcost, entryPoint, ensClosed);
 #ifdef DEBUG
-							{const decDVector c2 = nextFace->GetMesh()->GetSpace().GetMatrix() * nextFace->GetCenter();
-							module.LogInfoFormat("   Blocking: Closed Add Face: %p:%i (p=%p:%i c=(%g,%g,%g) t=%i) (%.3f,%.3f,%.3f)",
-								nextFace->GetMesh(), nextFace->GetIndex(), testFace->GetMesh(), testFace->GetIndex(),
-								nextFace->GetPathCostF(), nextFace->GetPathCostG(), nextFace->GetPathCostH(),
-								nextFace->GetTypeNumber(), c2.x, c2.y, c2.z);}
+						{const decDVector c2 = nextFace->GetMesh()->GetSpace().GetMatrix() * nextFace->GetCenter();
+						module.LogInfoFormat("   Blocking: Closed Add Face: %p:%i (p=%p:%i c=(%g,%g,%g) t=%i) (%.3f,%.3f,%.3f)",
+							nextFace->GetMesh(), nextFace->GetIndex(), testFace->GetMesh(), testFace->GetIndex(),
+							gcost + hcost, gcost, hcost, nextFace->GetTypeNumber(), c2.x, c2.y, c2.z);}
 #endif
+					}
+					
+				}else{
+					sNode &next = pNodes.GetAt(nextNode);
+					if(gcost < next.costG){
+						next.parent = testNode;
+						next.costG = gcost;
+						next.costF = gcost + next.costH;
+						if(improvedSearchMode){
+							next.entryPoint = entryPoint;
 						}
-						
-					}else if(nextFace->GetPathType() == dedaiSpaceMeshFace::epftOpen){
-						if(gcost < nextFace->GetPathCostG()){
-							nextFace->SetPathParent(testFace);
-							nextFace->SetPathCostG(gcost);
-							nextFace->SetPathCostF(gcost + nextFace->GetPathCostH());
-							if(improvedSearchMode){
-								nextFace->SetEntryPoint(entryPoint);
-							}
+						pPushOpen(nextNode);
 #ifdef DEBUG
-							{const decDVector c2 = nextFace->GetMesh()->GetSpace().GetMatrix() * nextFace->GetCenter();
-							module.LogInfoFormat("   Improve Parent Path: %p:%i (p=%p:%i c=(%g,%g,%g) t=%i) (%.3f,%.3f,%.3f)",
-								nextFace->GetMesh(), nextFace->GetIndex(), testFace->GetMesh(), testFace->GetIndex(),
-								nextFace->GetPathCostF(), nextFace->GetPathCostG(), nextFace->GetPathCostH(),
-								nextFace->GetTypeNumber(), c2.x, c2.y, c2.z);}
+						{const decDVector c2 = nextFace->GetMesh()->GetSpace().GetMatrix() * nextFace->GetCenter();
+						module.LogInfoFormat("   Improve Parent Path: %p:%i (p=%p:%i c=(%g,%g,%g) t=%i) (%.3f,%.3f,%.3f)",
+							nextFace->GetMesh(), nextFace->GetIndex(), testFace->GetMesh(), testFace->GetIndex(),
+							next.costF, next.costG, next.costH, nextFace->GetTypeNumber(), c2.x, c2.y, c2.z);}
 #endif
-						}
 					}
 				}
 			}
 			
-			pListOpen.RemoveFrom(pListOpen.IndexOf(testFace));
-#ifdef DEBUG
-			{const decDVector c2 = testFace->GetMesh()->GetSpace().GetMatrix() * testFace->GetCenter();
-			module.LogInfoFormat("   Open Remove Face: %p:%i (p=%p:%i c=(%g,%g,%g)) (%.3f,%.3f,%.3f)",
-				testFace->GetMesh(), testFace->GetIndex(), testFace->GetPathParent()?testFace->GetPathParent()->GetMesh():NULL,
-			  testFace->GetPathParent()?testFace->GetPathParent()->GetIndex():-1, testFace->GetPathCostF(),
-			  testFace->GetPathCostG(), testFace->GetPathCostH(), c2.x, c2.y, c2.z);}
-#endif
-			pListClosed.Add(testFace);
-#ifdef DEBUG
-			{const decDVector c2 = testFace->GetMesh()->GetSpace().GetMatrix() * testFace->GetCenter();
-			module.LogInfoFormat("   Closed Add Face: %p:%i (p=%p:%i c=(%g,%g,%g)) (%.3f,%.3f,%.3f)",
-				testFace->GetMesh(), testFace->GetIndex(), testFace->GetPathParent()?testFace->GetPathParent()->GetMesh():NULL,
-			  testFace->GetPathParent()?testFace->GetPathParent()->GetIndex():-1, testFace->GetPathCostF(),
-			  testFace->GetPathCostG(), testFace->GetPathCostH(), c2.x, c2.y, c2.z);}
-#endif
+			pNodes.GetAt(testNode).state = ensClosed;
 			
 			if(testFace == pEndFace){
+				endNode = testNode;
 				break;
 			}
 			
-			faceCount = pListOpen.GetCount();
-			if(faceCount == 0){
-				testFace = nullptr;
-				
-			}else{
-				testFace = pListOpen.GetAt(faceCount - 1);
-				for(f=faceCount-2; f>=0; f--){
-					nextFace = pListOpen.GetAt(f);
-					
-					if(nextFace->GetPathCostF() < testFace->GetPathCostF()){
-						testFace = nextFace;
-					}
-				}
-			}
+			testNode = pPopOpen();
 		}
-		
-#ifdef DEBUG
-		module.LogInfo("   Debug:");
-		module.LogInfo("      Open List:");
-		for(c=0; c<pListOpen.GetCount(); c++){
-			testFace = pListOpen.GetAt(c);
-			const decDVector c2 = testFace->GetMesh()->GetSpace().GetMatrix() * testFace->GetCenter();
-			module.LogInfoFormat("         Face: %p:%i p=%p:%i c=(%g,%g,%g) (%.3f,%.3f,%.3f)",
-				testFace->GetMesh(), testFace->GetIndex(), testFace->GetPathParent()?testFace->GetPathParent()->GetMesh():NULL,
-				testFace->GetPathParent()?testFace->GetPathParent()->GetIndex():-1, testFace->GetPathCostF(),
-				testFace->GetPathCostG(), testFace->GetPathCostH(), c2.x, c2.y, c2.z);
-		}
-		module.LogInfo("      Closed List:");
-		for(c=0; c<pListClosed.GetCount(); c++){
-			testFace = pListClosed.GetAt(c);
-			const decDVector c2 = testFace->GetMesh()->GetSpace().GetMatrix() * testFace->GetCenter();
-			module.LogInfoFormat("         Face: %p:%i p=%p:%i c=(%g,%g,%g) (%.3f,%.3f,%.3f)",
-				testFace->GetMesh(), testFace->GetIndex(), testFace->GetPathParent()?testFace->GetPathParent()->GetMesh():NULL,
-				testFace->GetPathParent()?testFace->GetPathParent()->GetIndex():-1, testFace->GetPathCostF(),
-				testFace->GetPathCostG(), testFace->GetPathCostH(), c2.x, c2.y, c2.z);
-		}
-#endif
 	}
 	
-	if(pListClosed.GetCount() > 0){
-		testFace = pListClosed.GetAt(pListClosed.GetCount() - 1);
+	// if the end face has not been reached there is no path to get to the end face using the
+	// current configuration. in this case the face with the smallest f-cost value could be
+	// used as the end face. this at last yields a path which gets us the closest to the face
+	if(endNode != -1){
+		int node = endNode, faceCount = 0;
+		while(node != -1){
+			faceCount++;
+			node = pNodes.GetAt(node).parent;
+		}
 		
-		// if the last face in the closed list is not the end face then there is no path to get
-		// to the end face using the current configuration. in this case look for the face with
-		// the smallest f-cost value and use this as the end face. this at last yields a path
-		// which gets us the closest to the face
-		//if( testFace != pEndFace ){
-		//}
+		pPathFaces.AddRange(faceCount, nullptr);
 		
-		if(testFace == pEndFace){
-			faceCount = 0;
-			nextFace = testFace;
-			while(nextFace){
-				faceCount++;
-				nextFace = nextFace->GetPathParent();
-				pPathFaces.Add(nullptr);
-			}
-			
-			for(faceCount--; faceCount>=0; faceCount--){
-				pPathFaces.SetAt(faceCount, testFace);
-				testFace = testFace->GetPathParent();
-			}
+		for(node=endNode, faceCount--; faceCount>=0; faceCount--){
+			const sNode &pathNode = pNodes.GetAt(node);
+			pPathFaces.SetAt(faceCount, pathNode.face);
+			node = pathNode.parent;
 		}
 	}
+	
 #ifdef DEBUG
 	module.LogInfo("      Path Faces:");
-	for(f=0; f<pPathFaces.GetCount(); f++){
-		testFace = pPathFaces.GetAt(f);
+	for(c=0; c<pPathFaces.GetCount(); c++){
+		testFace = pPathFaces.GetAt(c);
 		const decDVector c2 = testFace->GetMesh()->GetSpace().GetMatrix() * testFace->GetCenter();
-		module.LogInfoFormat("         Face: %p:%i p=(%p:%i) c=(%g,%g,%g) (%.3f,%.3f,%.3f)",
-			testFace->GetMesh(), testFace->GetIndex(), testFace->GetPathParent()?testFace->GetPathParent()->GetMesh():NULL,
-			testFace->GetPathParent()?testFace->GetPathParent()->GetIndex():-1, testFace->GetPathCostF(),
-			testFace->GetPathCostG(), testFace->GetPathCostH(), c2.x, c2.y, c2.z);
+		module.LogInfoFormat("         Face: %p:%i (%.3f,%.3f,%.3f)",
+			testFace->GetMesh(), testFace->GetIndex(), c2.x, c2.y, c2.z);
 	}
 #endif
 }
@@ -1051,80 +1022,49 @@ int dedaiPathFinderNavMesh::pFindEdgeLeadingToFace(const dedaiSpaceMeshFace &fac
 	return -1;
 }
 
-void dedaiPathFinderNavMesh::pUpdateDDSListOpen(){
-	if(!pDDSListOpen){
+void dedaiPathFinderNavMesh::pUpdateDDSList(deDebugDrawerShape *dds, eNodeStates state){
+	if(!dds){
 		return;
 	}
 	
-	pDDSListOpen->RemoveAllFaces();
-	pDDSListOpen->GetShapeList().RemoveAll();
+	dds->RemoveAllFaces();
+	dds->GetShapeList().RemoveAll();
 	
-	if(pListOpen.GetCount() > 0){
-		dedaiSpace &space = pListOpen.GetAt(0)->GetMesh()->GetSpace();
-		const decDMatrix &invMatrix = space.GetInverseMatrix();
-		const int count = pListOpen.GetCount();
-		int i;
-		
-		pDDSListOpen->SetPosition(space.GetMatrix().GetPosition());
-		pDDSListOpen->SetOrientation(space.GetMatrix().ToQuaternion());
-		
-		for(i=0; i<count; i++){
-			const dedaiSpaceMeshFace &face = *pListOpen.GetAt(i);
-			const unsigned short cornerCount = face.GetCornerCount();
-			
-			if(cornerCount > 2){
-				const decMatrix transform = (face.GetMesh()->GetSpace().GetMatrix() * invMatrix).ToMatrix();
-				const dedaiSpaceMeshCorner * const corners = face.GetMesh()->GetCorners().GetArrayPointer();
-				const decVector * const vertices = face.GetMesh()->GetVertices().GetArrayPointer();
-				const int firstCorner = face.GetFirstCorner();
-				
-				auto ddsFace = deDebugDrawerShapeFace::Ref::New();
-				int j;
-				for(j=0; j<cornerCount; j++){
-					ddsFace->AddVertex(transform * vertices[corners[firstCorner + j].GetVertex()]);
-				}
-				ddsFace->SetNormal(face.GetNormal());
-				pDDSListOpen->AddFace(std::move(ddsFace));
-			}
-		}
-	}
-}
-
-void dedaiPathFinderNavMesh::pUpdateDDSListClosed(){
-	if(!pDDSListClosed){
+	const sNode *first = nullptr;
+	if(!pNodes.Find(first, [&](const sNode &node){
+		return node.state == state;
+	})){
 		return;
 	}
 	
-	pDDSListClosed->RemoveAllFaces();
-	pDDSListClosed->GetShapeList().RemoveAll();
+	dedaiSpace &space = first->face->GetMesh()->GetSpace();
+	const decDMatrix &invMatrix = space.GetInverseMatrix();
+	
+	dds->SetPosition(space.GetMatrix().GetPosition());
+	dds->SetOrientation(space.GetMatrix().ToQuaternion());
 	
-	if(pListClosed.GetCount() > 0){
-		dedaiSpace &navspace = pListClosed.GetAt(0)->GetMesh()->GetSpace();
-		const decDMatrix &invMatrix = navspace.GetInverseMatrix();
-		const int count = pListClosed.GetCount();
-		int i;
+	pNodes.Visit([&](const sNode &node){
+		if(node.state != state){
+			return;
+		}
 		
-		pDDSListClosed->SetPosition(navspace.GetMatrix().GetPosition());
-		pDDSListClosed->SetOrientation(navspace.GetMatrix().ToQuaternion());
+		const dedaiSpaceMeshFace &face = *node.face;
+		const unsigned short cornerCount = face.GetCornerCount();
+		if(cornerCount < 3){
+			return;
+		}
 		
-		for(i=0; i<count; i++){
-			const dedaiSpaceMeshFace &face = *pListClosed.GetAt(i);
-			const unsigned short cornerCount = face.GetCornerCount();
-			
-			if(cornerCount > 2){
-				const decMatrix transform = (face.GetMesh()->GetSpace().GetMatrix() * invMatrix).ToMatrix();
-				const dedaiSpaceMeshCorner * const corners = face.GetMesh()->GetCorners().GetArrayPointer();
-				const decVector * const vertices = face.GetMesh()->GetVertices().GetArrayPointer();
-				const int firstCorner = face.GetFirstCorner();
-				
-				auto ddsFace = deDebugDrawerShapeFace::Ref::New();
-				int j;
-				for(j=0; j<cornerCount; j++){
-					ddsFace->AddVertex(transform * vertices[corners[firstCorner + j].GetVertex()]);
-				}
-				ddsFace->SetNormal(face.GetNormal());
-				pDDSListClosed->AddFace(std::move(ddsFace));
-			}
+		const decMatrix transform = (face.GetMesh()->GetSpace().GetMatrix() * invMatrix).ToMatrix();
+		const dedaiSpaceMeshCorner * const corners = face.GetMesh()->GetCorners().GetArrayPointer();
+		const decVector * const vertices = face.GetMesh()->GetVertices().GetArrayPointer();
+		const int firstCorner = face.GetFirstCorner();
+		
+		auto ddsFace = deDebugDrawerShapeFace::Ref::New();
+		int j;
+		for(j=0; j<cornerCount; j++){
+			ddsFace->AddVertex(transform * vertices[corners[firstCorner + j].GetVertex()]);
 		}
-	}
+		ddsFace->SetNormal(face.GetNormal());
+		dds->AddFace(std::move(ddsFace));
+	});
 }
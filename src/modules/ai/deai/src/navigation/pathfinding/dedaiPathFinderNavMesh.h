@@ -27,6 +27,7 @@
 
 #include <dragengine/common/math/decMath.h>
 #include <dragengine/common/collection/decTList.h>
+#include <dragengine/common/collection/decTDictionary.h>
 
 class deDebugDrawerShape;
 class dedaiSpaceMeshFace;
@@ -37,9 +38,39 @@ class dedaiWorld;
 
 /**
  * @brief Path Finder for Navigation Meshes.
+ * 
+ * The search state is stored per path finder in a node arena indexed by face. Navigation
+ * mesh faces are only read while searching. Multiple path finders can thus search the same
+ * prepared navigation spaces at the same time.
  */
 class dedaiPathFinderNavMesh{
 private:
+	/** \brief Search node state. */
+	enum eNodeStates{
+		/** \brief Node is in the open list. */
+		ensOpen,
+		
+		/** \brief Node is in the closed list. */
+		ensClosed
+	};
+	
+	/** \brief Search node. */
+	struct sNode{
+		dedaiSpaceMeshFace *face;
+		int parent;
+		float costF;
+		float costG;
+		float costH;
+		decVector entryPoint;
+		eNodeStates state;
+	};
+	
+	/** \brief Open list heap entry. */
+	struct sOpenEntry{
+		float costF;
+		int node;
+	};
+	
 	dedaiWorld *pWorld;
 	dedaiNavigator *pNavigator;
 	decDVector pStartPoint;
@@ -48,8 +79,9 @@ private:
 	dedaiSpaceMeshFace *pStartFace;
 	dedaiSpaceMeshFace *pEndFace;
 	
-	decTList<dedaiSpaceMeshFace*> pListClosed;
-	decTList<dedaiSpaceMeshFace*> pListOpen;
+	decTList<sNode> pNodes;
+	decTDictionary<const dedaiSpaceMeshFace*, int> pFaceNodes;
+	decTList<sOpenEntry> pListOpen;
 	decTList<dedaiSpaceMeshFace*> pPathFaces;
 	
 	decTList<decDVector> pPathPoints;
@@ -88,12 +120,6 @@ public:
 	/** Find path. */
 	void FindPath();
 	
-	/** Retrieves the open list. */
-	inline decTList<dedaiSpaceMeshFace*> &GetListOpen(){ return pListOpen; }
-	inline const decTList<dedaiSpaceMeshFace*> &GetListOpen() const{ return pListOpen; }
-	/** Retrieves the closed list. */
-	inline decTList<dedaiSpaceMeshFace*> &GetListClosed(){ return pListClosed; }
-	inline const decTList<dedaiSpaceMeshFace*> &GetListClosed() const{ return pListClosed; }
 	/** Retrieves the faces path. */
 	inline decTList<dedaiSpaceMeshFace*> &GetPathFaces(){ return pPathFaces; }
 	inline const decTList<dedaiSpaceMeshFace*> &GetPathFaces() const{ return pPathFaces; }
@@ -113,11 +139,15 @@ public:
 	
 private:
 	void pClearLists();
+	int pAddNode(dedaiSpaceMeshFace *face, int parent, float costG, float costH,
+		const decVector &entryPoint, eNodeStates state);
+	void pPushOpen(int node);
+	static bool pOpenListOrder(const sOpenEntry &a, const sOpenEntry &b);
+	int pPopOpen();
 	void pFindFacePath();
 	void pFindRealPath();
 	int pFindEdgeLeadingToFace(const dedaiSpaceMeshFace &face, const dedaiSpaceMeshFace &targetFace) const;
-	void pUpdateDDSListOpen();
-	void pUpdateDDSListClosed();
+	void pUpdateDDSList(deDebugDrawerShape *dds, eNodeStates state);
 };
 
 #endif
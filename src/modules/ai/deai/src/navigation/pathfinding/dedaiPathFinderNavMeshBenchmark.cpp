@@ -0,0 +1,202 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdint.h>
+
+#include "dedaiPathFinderNavMeshBenchmark.h"
+#include "dedaiPathFinderNavMeshTest.h"
+#include "dedaiPathFinderNavMesh.h"
+#include "../dedaiNavigator.h"
+#include "../layer/dedaiLayer.h"
+#include "../../deDEAIModule.h"
+
+#include <dragengine/common/collection/decTList.h>
+#include <dragengine/common/collection/decTUniqueList.h>
+#include <dragengine/common/exceptions.h>
+#include <dragengine/common/string/decString.h>
+#include <dragengine/common/string/unicode/decUnicodeString.h>
+#include <dragengine/common/utils/decTimer.h>
+#include <dragengine/threading/deThread.h>
+
+
+// Definitions
+////////////////
+
+#define BENCHMARK_HOLE_PERCENTAGE 20
+
+
+// Deterministic pseudo random numbers
+static int dedaiPFBRandom(uint32_t &seed, int range){
+	seed = seed * 1664525u + 1013904223u;
+	return (int)((seed >> 8) % (uint32_t)range);
+}
+
+// Run a range of queries using an own path finder
+class dedaiPFBQueryThread : public deThread{
+private:
+	dedaiNavigator &pNavigator;
+	const decTList<decDVector> &pQueries;
+	const int pFirst;
+	const int pCount;
+	int pPathCount;
+	int pPointCount;
+	
+public:
+	dedaiPFBQueryThread(dedaiNavigator &navigator, const decTList<decDVector> &queries,
+		int first, int count) :
+	pNavigator(navigator), pQueries(queries), pFirst(first), pCount(count),
+	pPathCount(0), pPointCount(0){
+	}
+	
+	inline int GetPathCount() const{ return pPathCount; }
+	inline int GetPointCount() const{ return pPointCount; }
+	
+	void Run() override{
+		dedaiPathFinderNavMesh pathfinder;
+		pathfinder.SetWorld(pNavigator.GetParentWorld());
+		pathfinder.SetNavigator(&pNavigator);
+		
+		int i;
+		for(i=pFirst; i<pFirst+pCount; i++){
+			pathfinder.SetStartPoint(pQueries[i * 2]);
+			pathfinder.SetEndPoint(pQueries[i * 2 + 1]);
+			pathfinder.FindPath();
+			
+			if(pathfinder.GetPathPoints().IsNotEmpty()){
+				pPathCount++;
+				pPointCount += pathfinder.GetPathPoints().GetCount();
+			}
+		}
+	}
+};
+
+
+
+// Class dedaiPathFinderNavMeshBenchmark
+//////////////////////////////////////////
+
+// Constructor, destructor
+////////////////////////////
+
+dedaiPathFinderNavMeshBenchmark::dedaiPathFinderNavMeshBenchmark(deDEAIModule &deai) :
+pDEAI(deai){
+}
+
+dedaiPathFinderNavMeshBenchmark::~dedaiPathFinderNavMeshBenchmark(){
+}
+
+
+
+// Management
+///////////////
+
+void dedaiPathFinderNavMeshBenchmark::Run(int size, int queryCount, int threadCount,
+decUnicodeString &answer){
+	DEASSERT_TRUE(size > 1)
+	DEASSERT_TRUE(queryCount > 0)
+	DEASSERT_TRUE(threadCount > 0)
+	
+	// create grid with random holes
+	decTList<char> holes;
+	uint32_t seed = 4242;
+	int i, faceCount = 0;
+	
+	for(i=0; i<size*size; i++){
+		const bool hole = dedaiPFBRandom(seed, 100) < BENCHMARK_HOLE_PERCENTAGE;
+		holes.Add(hole ? 1 : 0);
+		if(!hole){
+			faceCount++;
+		}
+	}
+	
+	decTimer timer;
+	deNavigator::Ref navigator;
+	const deWorld::Ref world(dedaiPathFinderNavMeshTest::CreateGridWorld(pDEAI, size, holes, navigator));
+	
+	dedaiNavigator &peer = *((dedaiNavigator*)navigator->GetPeerAI());
+	peer.GetLayer()->Prepare();
+	peer.Prepare();
+	const float elapsedPrepare = timer.GetElapsedTime();
+	
+	// queries between random cells spread across the grid
+	decTList<decDVector> queries;
+	for(i=0; i<queryCount*2; i++){
+		queries.Add(decDVector((double)dedaiPFBRandom(seed, size) + 0.5,
+			0.0, (double)dedaiPFBRandom(seed, size) + 0.5));
+	}
+	
+	// serial run
+	dedaiPFBQueryThread serial(peer, queries, 0, queryCount);
+	timer.Reset();
+	serial.Run();
+	const float elapsedSerial = timer.GetElapsedTime();
+	
+	// concurrent run
+	decTUniqueList<dedaiPFBQueryThread> threads;
+	const int queriesPerThread = (queryCount + threadCount - 1) / threadCount;
+	for(i=0; i<threadCount; i++){
+		const int first = decMath::min(i * queriesPerThread, queryCount);
+		threads.Add(deTUniqueReference<dedaiPFBQueryThread>::New(peer, queries,
+			first, decMath::min(queriesPerThread, queryCount - first)));
+	}
+	
+	timer.Reset();
+	threads.Visit([](dedaiPFBQueryThread *thread){
+		thread->Start();
+	});
+	threads.Visit([](dedaiPFBQueryThread *thread){
+		thread->WaitForExit();
+	});
+	const float elapsedConcurrent = timer.GetElapsedTime();
+	
+	int concurrentPathCount = 0;
+	threads.Visit([&](const dedaiPFBQueryThread *thread){
+		concurrentPathCount += thread->GetPathCount();
+	});
+	
+	decString text;
+	text.Format("Path finding benchmark: %dx%d grid, %d faces, %d queries, %d paths found\n",
+		size, size, faceCount,
+		queryCount, serial.GetPathCount());
+	
+	decString line;
+	line.Format("- prepare: %.1f ms\n", elapsedPrepare * 1e3f);
+	text += line;
+	
+	line.Format("- serial: %.1f us per query (%.1f ms total, %.1f points per path)\n",
+		elapsedSerial * 1e6f / (float)queryCount, elapsedSerial * 1e3f,
+		serial.GetPathCount() > 0 ? (float)serial.GetPointCount() / (float)serial.GetPathCount() : 0.0f);
+	text += line;
+	
+	line.Format("- %d threads: %.1f us per query (%.1f ms total, speedup %.2f)\n",
+		threadCount, elapsedConcurrent * 1e6f / (float)queryCount, elapsedConcurrent * 1e3f,
+		elapsedConcurrent > 0.0f ? elapsedSerial / elapsedConcurrent : 0.0f);
+	text += line;
+	
+	if(concurrentPathCount != serial.GetPathCount()){
+		text += "WARNING: results differ between serial and concurrent run\n";
+	}
+	
+	answer.SetFromUTF8(text);
+}
@@ -0,0 +1,71 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DEDAIPATHFINDERNAVMESHBENCHMARK_H_
+#define _DEDAIPATHFINDERNAVMESHBENCHMARK_H_
+
+class deDEAIModule;
+class decUnicodeString;
+
+
+
+/**
+ * \brief Navigation mesh path finder benchmark.
+ * 
+ * Measures path queries across a large grid shaped navigation mesh with random holes.
+ * Queries run first one after the other then spread across multiple threads each using
+ * an own path finder. Run using the module command "pathFindingBenchmark".
+ */
+class dedaiPathFinderNavMeshBenchmark{
+private:
+	deDEAIModule &pDEAI;
+	
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/** \brief Create benchmark. */
+	explicit dedaiPathFinderNavMeshBenchmark(deDEAIModule &deai);
+	
+	/** \brief Clean up benchmark. */
+	~dedaiPathFinderNavMeshBenchmark();
+	/*@}*/
+	
+	
+	
+	/** \name Management */
+	/*@{*/
+	/**
+	 * \brief Run benchmark.
+	 * \param[in] size Grid size in cells along each axis.
+	 * \param[in] queryCount Count of path queries.
+	 * \param[in] threadCount Count of threads for the concurrent run.
+	 * \param[out] answer Results.
+	 */
+	void Run(int size, int queryCount, int threadCount, decUnicodeString &answer);
+	/*@}*/
+};
+
+#endif
@@ -0,0 +1,457 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <math.h>
+#include <stdint.h>
+
+#include "dedaiPathFinderNavMeshTest.h"
+#include "dedaiPathFinderNavMesh.h"
+#include "../dedaiNavigator.h"
+#include "../layer/dedaiLayer.h"
+#include "../spaces/mesh/dedaiSpaceMeshFace.h"
+#include "../../deDEAIModule.h"
+
+#include <dragengine/deEngine.h>
+#include <dragengine/common/collection/decTUniqueList.h>
+#include <dragengine/common/exceptions.h>
+#include <dragengine/common/string/decString.h>
+#include <dragengine/common/string/unicode/decUnicodeString.h>
+#include <dragengine/resources/navigation/navigator/deNavigatorManager.h>
+#include <dragengine/resources/navigation/navigator/deNavigatorPath.h>
+#include <dragengine/resources/navigation/space/deNavigationSpace.h>
+#include <dragengine/resources/navigation/space/deNavigationSpaceCorner.h>
+#include <dragengine/resources/navigation/space/deNavigationSpaceFace.h>
+#include <dragengine/resources/navigation/space/deNavigationSpaceManager.h>
+#include <dragengine/resources/world/deWorldManager.h>
+#include <dragengine/threading/deThread.h>
+
+
+// Definitions
+////////////////
+
+#define CONCURRENT_GRID_SIZE 32
+#define CONCURRENT_QUERY_COUNT 64
+#define CONCURRENT_THREAD_COUNT 4
+
+
+// Deterministic pseudo random numbers
+static int dedaiPFTRandom(uint32_t &seed, int range){
+	seed = seed * 1664525u + 1013904223u;
+	return (int)((seed >> 8) % (uint32_t)range);
+}
+
+// Path starting at start point stays on the grid cells which are not holes. Segments are
+// sampled in small steps. Points on cell borders belong to all touching cells
+static bool dedaiPFTPathOnGrid(const decDVector &start, const decTList<decDVector> &points,
+int size, const decTList<char> &holes){
+	const double step = 0.05, border = 1e-4;
+	decDVector last(start);
+	
+	return points.AllMatching([&](const decDVector &point){
+		const int sampleCount = (int)ceil((point - last).Length() / step) + 1;
+		int i;
+		
+		for(i=0; i<=sampleCount; i++){
+			const decDVector sample(last + (point - last) * ((double)i / (double)sampleCount));
+			const int x1 = (int)floor(sample.x - border), x2 = (int)floor(sample.x + border);
+			const int z1 = (int)floor(sample.z - border), z2 = (int)floor(sample.z + border);
+			const int cells[4][2] = {{x1, z1}, {x2, z1}, {x1, z2}, {x2, z2}};
+			bool onGrid = false;
+			int j;
+			
+			for(j=0; j<4; j++){
+				const int x = cells[j][0], z = cells[j][1];
+				if(x >= 0 && x < size && z >= 0 && z < size && !holes[z * size + x]){
+					onGrid = true;
+					break;
+				}
+			}
+			
+			if(!onGrid){
+				return false;
+			}
+		}
+		
+		last = point;
+		return true;
+	});
+}
+
+// Run queries using an own path finder storing the found path points
+class dedaiPFTQueryThread : public deThread{
+private:
+	dedaiNavigator &pNavigator;
+	const decTList<decDVector> &pQueries;
+	decTList<decTList<decDVector>> pResults;
+	
+public:
+	dedaiPFTQueryThread(dedaiNavigator &navigator, const decTList<decDVector> &queries) :
+	pNavigator(navigator), pQueries(queries){
+	}
+	
+	inline const decTList<decTList<decDVector>> &GetResults() const{ return pResults; }
+	
+	void Run() override{
+		const int count = pQueries.GetCount() / 2;
+		int i;
+		
+		for(i=0; i<count; i++){
+			dedaiPathFinderNavMesh pathfinder;
+			pathfinder.SetWorld(pNavigator.GetParentWorld());
+			pathfinder.SetNavigator(&pNavigator);
+			pathfinder.SetStartPoint(pQueries[i * 2]);
+			pathfinder.SetEndPoint(pQueries[i * 2 + 1]);
+			pathfinder.FindPath();
+			pResults.Add(pathfinder.GetPathPoints());
+		}
+	}
+};
+
+
+
+// Class dedaiPathFinderNavMeshTest
+/////////////////////////////////////
+
+// Constructor, destructor
+////////////////////////////
+
+dedaiPathFinderNavMeshTest::dedaiPathFinderNavMeshTest(deDEAIModule &deai) :
+pDEAI(deai),
+pFailedCount(0){
+}
+
+dedaiPathFinderNavMeshTest::~dedaiPathFinderNavMeshTest(){
+}
+
+
+
+// Management
+///////////////
+
+bool dedaiPathFinderNavMeshTest::Run(decUnicodeString &answer){
+	decString text("Path finding test:\n");
+	pFailedCount = 0;
+	
+	pTestOpenGrid(text);
+	pTestWallWithGap(text);
+	pTestNoPath(text);
+	pTestOptimalFacePath(text);
+	pTestConcurrent(text);
+	
+	if(pFailedCount > 0){
+		decString line;
+		line.Format("FAILED: %d checks failed\n", pFailedCount);
+		text += line;
+		
+	}else{
+		text += "PASSED\n";
+	}
+	
+	answer.SetFromUTF8(text);
+	return pFailedCount == 0;
+}
+
+deWorld::Ref dedaiPathFinderNavMeshTest::CreateGridWorld(deDEAIModule &deai, int size,
+const decTList<char> &holes, deNavigator::Ref &navigator){
+	DEASSERT_TRUE(size > 0 && (size + 1) * (size + 1) <= 65535)
+	DEASSERT_TRUE(holes.GetCount() == size * size)
+	
+	deEngine &engine = *deai.GetGameEngine();
+	const deNavigationSpace::Ref navspace(engine.GetNavigationSpaceManager()->CreateNavigationSpace());
+	navspace->SetType(deNavigationSpace::estMesh);
+	
+	int x, z;
+	for(z=0; z<=size; z++){
+		for(x=0; x<=size; x++){
+			navspace->GetVertices().Add(decVector((float)x, 0.0f, (float)z));
+		}
+	}
+	
+	for(z=0; z<size; z++){
+		for(x=0; x<size; x++){
+			if(holes[z * size + x]){
+				continue;
+			}
+			
+			const int vertices[4] = {z * (size + 1) + x, z * (size + 1) + x + 1,
+				(z + 1) * (size + 1) + x + 1, (z + 1) * (size + 1) + x};
+			int i;
+			for(i=0; i<4; i++){
+				deNavigationSpaceCorner corner;
+				corner.SetVertex((unsigned short)vertices[i]);
+				navspace->GetCorners().Add(corner);
+			}
+			
+			deNavigationSpaceFace face;
+			face.SetCornerCount(4);
+			navspace->GetFaces().Add(face);
+		}
+	}
+	
+	navspace->NotifyLayoutChanged();
+	
+	const deWorld::Ref world(engine.GetWorldManager()->CreateWorld());
+	world->AddNavigationSpace(navspace);
+	
+	navigator = engine.GetNavigatorManager()->CreateNavigator();
+	navigator->SetSpaceType(deNavigationSpace::estMesh);
+	navigator->SetBlockingCost(1e6f);
+	world->AddNavigator(navigator);
+	
+	return world;
+}
+
+
+
+// Private Functions
+//////////////////////
+
+void dedaiPathFinderNavMeshTest::pTestOpenGrid(decString &text){
+	// without obstacles the path leads to the goal without leaving the mesh
+	const int size = 16;
+	decTList<char> holes;
+	holes.AddRange(size * size, 0);
+	
+	deNavigator::Ref navigator;
+	const deWorld::Ref world(CreateGridWorld(pDEAI, size, holes, navigator));
+	
+	const decDVector start(0.5, 0.0, 0.5), goal(15.5, 0.0, 12.2);
+	const deNavigatorPath::Ref path(deNavigatorPath::Ref::New());
+	navigator->FindPath(*path, start, goal);
+	
+	decTList<decDVector> points;
+	int i;
+	for(i=0; i<path->GetCount(); i++){
+		points.Add(path->GetAt(i));
+	}
+	
+	pCheck(points.IsNotEmpty() && points.Last().IsEqualTo(goal, 1e-3), "open grid reaches goal", text);
+	pCheck(dedaiPFTPathOnGrid(start, points, size, holes), "open grid path stays on mesh", text);
+}
+
+void dedaiPathFinderNavMeshTest::pTestWallWithGap(decString &text){
+	// wall along column 8 with a gap in row 12. the path has to pass through the gap
+	const int size = 16;
+	decTList<char> holes;
+	holes.AddRange(size * size, 0);
+	
+	int z;
+	for(z=0; z<size; z++){
+		if(z != 12){
+			holes[z * size + 8] = 1;
+		}
+	}
+	
+	deNavigator::Ref navigator;
+	const deWorld::Ref world(CreateGridWorld(pDEAI, size, holes, navigator));
+	
+	const decDVector start(2.5, 0.0, 2.5), goal(14.5, 0.0, 2.5);
+	const deNavigatorPath::Ref path(deNavigatorPath::Ref::New());
+	navigator->FindPath(*path, start, goal);
+	
+	decTList<decDVector> points;
+	int i;
+	for(i=0; i<path->GetCount(); i++){
+		points.Add(path->GetAt(i));
+	}
+	
+	pCheck(points.IsNotEmpty() && points.Last().IsEqualTo(goal, 1e-3), "wall gap reaches goal", text);
+	pCheck(dedaiPFTPathOnGrid(start, points, size, holes), "wall gap path passes gap", text);
+}
+
+void dedaiPathFinderNavMeshTest::pTestNoPath(decString &text){
+	// wall along column 8 without gap separates start and goal
+	const int size = 16;
+	decTList<char> holes;
+	holes.AddRange(size * size, 0);
+	
+	int z;
+	for(z=0; z<size; z++){
+		holes[z * size + 8] = 1;
+	}
+	
+	deNavigator::Ref navigator;
+	const deWorld::Ref world(CreateGridWorld(pDEAI, size, holes, navigator));
+	
+	const deNavigatorPath::Ref path(deNavigatorPath::Ref::New());
+	path->Add(decDVector(1.0, 0.0, 1.0));
+	navigator->FindPath(*path, decDVector(2.5, 0.0, 2.5), decDVector(14.5, 0.0, 2.5));
+	
+	pCheck(path->GetCount() == 0, "separated goal yields empty path", text);
+}
+
+void dedaiPathFinderNavMeshTest::pTestOptimalFacePath(decString &text){
+	// random holes. the count of faces along the found path has to match the shortest
+	// path found using a breadth first search across the grid cells
+	const int size = 24;
+	decTList<char> holes;
+	uint32_t seed = 4711;
+	int i;
+	
+	for(i=0; i<size*size; i++){
+		holes.Add(dedaiPFTRandom(seed, 100) < 25 ? 1 : 0);
+	}
+	holes[0] = 0;
+	
+	deNavigator::Ref navigator;
+	const deWorld::Ref world(CreateGridWorld(pDEAI, size, holes, navigator));
+	
+	dedaiNavigator &peer = *((dedaiNavigator*)navigator->GetPeerAI());
+	peer.GetLayer()->Prepare();
+	peer.Prepare();
+	
+	// breadth first search distances from cell 0
+	decTList<int> distances, queue;
+	distances.AddRange(size * size, -1);
+	distances[0] = 0;
+	queue.Add(0);
+	
+	for(i=0; i<queue.GetCount(); i++){
+		const int cell = queue[i];
+		const int x = cell % size, z = cell / size;
+		const int neighbors[4] = {
+			x > 0 ? cell - 1 : -1,
+			x < size - 1 ? cell + 1 : -1,
+			z > 0 ? cell - size : -1,
+			z < size - 1 ? cell + size : -1};
+		
+		int j;
+		for(j=0; j<4; j++){
+			if(neighbors[j] != -1 && !holes[neighbors[j]] && distances[neighbors[j]] == -1){
+				distances[neighbors[j]] = distances[cell] + 1;
+				queue.Add(neighbors[j]);
+			}
+		}
+	}
+	
+	int checkedCount = 0, mismatchCount = 0;
+	for(i=1; i<size*size; i++){
+		if(holes[i]){
+			continue;
+		}
+		
+		dedaiPathFinderNavMesh pathfinder;
+		pathfinder.SetWorld(peer.GetParentWorld());
+		pathfinder.SetNavigator(&peer);
+		pathfinder.SetStartPoint(decDVector(0.5, 0.0, 0.5));
+		pathfinder.SetEndPoint(decDVector((double)(i % size) + 0.5, 0.0, (double)(i / size) + 0.5));
+		pathfinder.FindPath();
+		
+		const int faceCount = pathfinder.GetPathFaces().GetCount();
+		if(distances[i] == -1){
+			if(faceCount != 0 || pathfinder.GetPathPoints().IsNotEmpty()){
+				mismatchCount++;
+			}
+			
+		}else if(faceCount != distances[i] + 1){
+			mismatchCount++;
+		}
+		checkedCount++;
+	}
+	
+	decString name;
+	name.Format("face path length matches shortest path (%d goals, %d mismatches)",
+		checkedCount, mismatchCount);
+	pCheck(mismatchCount == 0, name, text);
+}
+
+void dedaiPathFinderNavMeshTest::pTestConcurrent(decString &text){
+	// path finders searching concurrently have to find the same paths as searching serially
+	decTList<char> holes;
+	uint32_t seed = 1234;
+	int i;
+	
+	for(i=0; i<CONCURRENT_GRID_SIZE*CONCURRENT_GRID_SIZE; i++){
+		holes.Add(dedaiPFTRandom(seed, 100) < 20 ? 1 : 0);
+	}
+	
+	deNavigator::Ref navigator;
+	const deWorld::Ref world(CreateGridWorld(pDEAI, CONCURRENT_GRID_SIZE, holes, navigator));
+	
+	dedaiNavigator &peer = *((dedaiNavigator*)navigator->GetPeerAI());
+	peer.GetLayer()->Prepare();
+	peer.Prepare();
+	
+	decTList<decDVector> queries;
+	for(i=0; i<CONCURRENT_QUERY_COUNT*2; i++){
+		queries.Add(decDVector(
+			(double)dedaiPFTRandom(seed, CONCURRENT_GRID_SIZE) + 0.5, 0.0,
+			(double)dedaiPFTRandom(seed, CONCURRENT_GRID_SIZE) + 0.5));
+	}
+	
+	dedaiPFTQueryThread serial(peer, queries);
+	serial.Run();
+	
+	decTUniqueList<dedaiPFTQueryThread> threads;
+	for(i=0; i<CONCURRENT_THREAD_COUNT; i++){
+		threads.Add(deTUniqueReference<dedaiPFTQueryThread>::New(peer, queries));
+	}
+	threads.Visit([](dedaiPFTQueryThread *thread){
+		thread->Start();
+	});
+	threads.Visit([](dedaiPFTQueryThread *thread){
+		thread->WaitForExit();
+	});
+	
+	int mismatchCount = 0, pathCount = 0;
+	threads.Visit([&](const dedaiPFTQueryThread *thread){
+		for(i=0; i<CONCURRENT_QUERY_COUNT; i++){
+			const decTList<decDVector> &expected = serial.GetResults()[i];
+			const decTList<decDVector> &found = thread->GetResults()[i];
+			if(found.GetCount() != expected.GetCount()){
+				mismatchCount++;
+				continue;
+			}
+			
+			int j;
+			for(j=0; j<found.GetCount(); j++){
+				if(!found[j].IsEqualTo(expected[j], 1e-9)){
+					mismatchCount++;
+					break;
+				}
+			}
+		}
+	});
+	
+	serial.GetResults().Visit([&](const decTList<decDVector> &points){
+		if(points.IsNotEmpty()){
+			pathCount++;
+		}
+	});
+	
+	decString name;
+	name.Format("concurrent path finders match serial results (%d threads, %d queries, %d paths)",
+		CONCURRENT_THREAD_COUNT, CONCURRENT_QUERY_COUNT, pathCount);
+	pCheck(mismatchCount == 0, name, text);
+}
+
+void dedaiPathFinderNavMeshTest::pCheck(bool condition, const char *name, decString &text){
+	decString line;
+	line.Format("- %s: %s\n", name, condition ? "ok" : "failed");
+	text += line;
+	
+	if(!condition){
+		pFailedCount++;
+	}
+}
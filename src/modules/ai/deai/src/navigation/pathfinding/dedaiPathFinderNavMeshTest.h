@@ -0,0 +1,94 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DEDAIPATHFINDERNAVMESHTEST_H_
+#define _DEDAIPATHFINDERNAVMESHTEST_H_
+
+#include <dragengine/common/collection/decTList.h>
+#include <dragengine/resources/navigation/navigator/deNavigator.h>
+#include <dragengine/resources/world/deWorld.h>
+
+class deDEAIModule;
+class decUnicodeString;
+class decString;
+
+
+
+/**
+ * \brief Navigation mesh path finder test.
+ * 
+ * Builds grid shaped navigation meshes with holes and verifies the found paths. Also runs
+ * the same queries from multiple threads at the same time comparing the results against
+ * running them one after the other. Run using the module command "pathFindingTest".
+ */
+class dedaiPathFinderNavMeshTest{
+private:
+	deDEAIModule &pDEAI;
+	int pFailedCount;
+	
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/** \brief Create test. */
+	explicit dedaiPathFinderNavMeshTest(deDEAIModule &deai);
+	
+	/** \brief Clean up test. */
+	~dedaiPathFinderNavMeshTest();
+	/*@}*/
+	
+	
+	
+	/** \name Management */
+	/*@{*/
+	/**
+	 * \brief Run test.
+	 * \param[out] answer Results.
+	 * \returns true if all checks passed.
+	 */
+	bool Run(decUnicodeString &answer);
+	
+	/**
+	 * \brief Create world with a grid shaped navigation mesh.
+	 * 
+	 * Grid cells are 1m squares in the XZ plane starting at the origin. Cells with a
+	 * non-zero value in \em holes are left out. The navigator navigates the mesh.
+	 */
+	static deWorld::Ref CreateGridWorld(deDEAIModule &deai, int size,
+		const decTList<char> &holes, deNavigator::Ref &navigator);
+	/*@}*/
+	
+	
+	
+private:
+	void pTestOpenGrid(decString &text);
+	void pTestWallWithGap(decString &text);
+	void pTestNoPath(decString &text);
+	void pTestOptimalFacePath(decString &text);
+	void pTestConcurrent(decString &text);
+	void pCheck(bool condition, const char *name, decString &text);
+};
+
+#endif
@@ -34,6 +34,8 @@
 #include "../../../deDEAIModule.h"
 #include "../../../world/dedaiWorld.h"
 
+#include <limits>
+
 #include <dragengine/common/exceptions.h>
 #include <dragengine/common/math/decConvexVolume.h>
 #include <dragengine/common/math/decConvexVolumeFace.h>
@@ -67,7 +69,11 @@ struct sLink{
 /////////////////////////////////
 
 dedaiSpaceGrid::dedaiSpaceGrid(dedaiSpace &space) :
-pSpace(space){
+pSpace(space),
+
+// vertices and edges do not move. loose boxes are not required
+pVertexTree(0.0f),
+pEdgeTree(0.0f){
 }
 
 dedaiSpaceGrid::~dedaiSpaceGrid(){
@@ -90,30 +96,26 @@ void dedaiSpaceGrid::AddVertex(const decVector &position){
 }
 
 dedaiSpaceGridVertex *dedaiSpaceGrid::GetVertexClosestTo(const decVector &position, float &distance) const{
-	// for the time being brute force
-	dedaiSpaceGridVertex *bestVertex = nullptr;
+	const dedaiSpaceGridVertex * const vertices = pVertices.GetArrayPointer();
 	float bestDistSquared = 0.0f;
-	decVector testDirection;
-	float testDistSquared;
 	
-	pVertices.Visit([&](dedaiSpaceGridVertex &v){
-		if(!v.GetEnabled()){
-			return;
-		}
-		
-		testDirection = v.GetPosition() - position;
-		testDistSquared = testDirection * testDirection;
-		
-		if(!bestVertex || testDistSquared < bestDistSquared){
-			bestVertex = &v;
-			bestDistSquared = testDistSquared;
-		}
-	});
+	const int index = pVertexTree.FindNearest(position, std::numeric_limits<float>::max(),
+		bestDistSquared, [&](int item, float &distSquared){
+			const dedaiSpaceGridVertex &v = vertices[item];
+			if(!v.GetEnabled()){
+				return false;
+			}
+			
+			distSquared = (v.GetPosition() - position).LengthSquared();
+			return true;
+		});
 	
-	if(bestVertex){
-		distance = sqrtf(bestDistSquared);
+	if(index == -1){
+		return nullptr;
 	}
-	return bestVertex;
+	
+	distance = sqrtf(bestDistSquared);
+	return const_cast<dedaiSpaceGridVertex*>(vertices + index);
 }
 
 
@@ -158,39 +160,42 @@ void dedaiSpaceGrid::RemoveAllLinks(){
 
 dedaiSpaceGridEdge *dedaiSpaceGrid::NearestPoint(const decVector &point, float radius,
 decVector &nearestPosition, float &nearestDistSquared, float &nearestLambda) const{
+	const dedaiSpaceGridVertex * const vertices = pVertices.GetArrayPointer();
+	const dedaiSpaceGridEdge * const edges = pEdges.GetArrayPointer();
 	const float radiusSquared = radius * radius;
-	dedaiSpaceGridEdge *nearestEdge = nullptr;
 	nearestDistSquared = radiusSquared;
 	
-	pEdges.Visit([&](dedaiSpaceGridEdge &edge){
-		const dedaiSpaceGridVertex &v1 = pVertices[edge.GetVertex1()];
-		const dedaiSpaceGridVertex &v2 = pVertices[edge.GetVertex2()];
-		
-// 		if( ! edge.GetEnabled() ){
-// 			return;
-// 		}
-		if(!v1.GetEnabled() || !v2.GetEnabled()){
-			return;
-		}
-		
-		const decVector edgeDirection(v2.GetPosition() - v1.GetPosition());
-		const decVector testDirection(point - v1.GetPosition());
-		const float edgeLambda = decMath::clamp(
-			edgeDirection * testDirection / edgeDirection.LengthSquared(), 0.0f, 1.0f);
-		const decVector edgeClosest(v1.GetPosition() + edgeDirection * edgeLambda);
-		const float edgeDistanceSquared = (edgeClosest - point).LengthSquared();
-		
-		if(edgeDistanceSquared > nearestDistSquared){
-			return;
-		}
-		
-		nearestEdge = &edge;
-		nearestDistSquared = edgeDistanceSquared;
-		nearestPosition = edgeClosest;
-		nearestLambda = edgeLambda;
-	});
+	const int index = pEdgeTree.FindNearest(point, radiusSquared, nearestDistSquared,
+		[&](int item, float &distSquared){
+			const dedaiSpaceGridEdge &edge = edges[item];
+			const dedaiSpaceGridVertex &v1 = vertices[edge.GetVertex1()];
+			const dedaiSpaceGridVertex &v2 = vertices[edge.GetVertex2()];
+			
+// 			if( ! edge.GetEnabled() ){
+// 				return false;
+// 			}
+			if(!v1.GetEnabled() || !v2.GetEnabled()){
+				return false;
+			}
+			
+			const decVector edgeDirection(v2.GetPosition() - v1.GetPosition());
+			const decVector testDirection(point - v1.GetPosition());
+			const float edgeLambda = decMath::clamp(
+				edgeDirection * testDirection / edgeDirection.LengthSquared(), 0.0f, 1.0f);
+			distSquared = (v1.GetPosition() + edgeDirection * edgeLambda - point).LengthSquared();
+			return true;
+		});
 	
-	return nearestEdge;
+	if(index == -1){
+		return nullptr;
+	}
+	
+	const dedaiSpaceGridEdge &edge = edges[index];
+	const decVector &v1 = vertices[edge.GetVertex1()].GetPosition();
+	const decVector edgeDirection(vertices[edge.GetVertex2()].GetPosition() - v1);
+	nearestLambda = decMath::clamp(edgeDirection * (point - v1) / edgeDirection.LengthSquared(), 0.0f, 1.0f);
+	nearestPosition = v1 + edgeDirection * nearestLambda;
+	return const_cast<dedaiSpaceGridEdge*>(edges + index);
 }
 
 
@@ -202,6 +207,8 @@ void dedaiSpaceGrid::InitFromSpace(){
 	}else if(pSpace.GetOwnerHTNavSpace()){
 		pInitFromHTNavSpace();
 	}
+	
+	pBuildTrees();
 }
 
 void dedaiSpaceGrid::LinkToOtherGrids(){
@@ -312,6 +319,9 @@ void dedaiSpaceGrid::LinkToOtherGrids(){
 }
 
 void dedaiSpaceGrid::UpdateBlocking(){
+	// blocking only changes the enabled state of vertices. the trees stay valid and
+	// disabled vertices are skipped while searching
+	
 	// enable all vertices
 	pVertices.Visit([&](dedaiSpaceGridVertex &v){
 		v.SetEnabled(true);
@@ -332,6 +342,8 @@ void dedaiSpaceGrid::UpdateBlocking(){
 }
 
 void dedaiSpaceGrid::Clear(){
+	pVertexTree.RemoveAll();
+	pEdgeTree.RemoveAll();
 	pLinks.SetCountDiscard(0);
 	pEdges.SetCountDiscard(0);
 	pVertices.SetCountDiscard(0);
@@ -532,3 +544,32 @@ void dedaiSpaceGrid::pDisableVertices(const decConvexVolumeList &list){
 		}
 	});
 }
+
+void dedaiSpaceGrid::pBuildTrees(){
+	// inserting into an empty index assigns element indices matching the vertex and
+	// edge order
+	decTList<decVector> minExtends(pVertices.GetCount()), maxExtends(pVertices.GetCount());
+	decTList<int> elements(pVertices.GetCount());
+	
+	pVertices.Visit([&](const dedaiSpaceGridVertex &v){
+		minExtends.Add(v.GetPosition());
+	});
+	
+	pVertexTree.RemoveAll();
+	pVertexTree.Insert(minExtends.GetArrayPointer(), minExtends.GetArrayPointer(),
+		minExtends.GetCount(), elements);
+	
+	minExtends.SetCountDiscard(0);
+	elements.SetCountDiscard(0);
+	
+	pEdges.Visit([&](const dedaiSpaceGridEdge &edge){
+		const decVector &p1 = pVertices[edge.GetVertex1()].GetPosition();
+		const decVector &p2 = pVertices[edge.GetVertex2()].GetPosition();
+		minExtends.Add(p1.Smallest(p2));
+		maxExtends.Add(p1.Largest(p2));
+	});
+	
+	pEdgeTree.RemoveAll();
+	pEdgeTree.Insert(minExtends.GetArrayPointer(), maxExtends.GetArrayPointer(),
+		minExtends.GetCount(), elements);
+}
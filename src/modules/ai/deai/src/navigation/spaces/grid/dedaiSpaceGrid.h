@@ -27,6 +27,7 @@
 
 #include <dragengine/common/collection/decTList.h>
 #include <dragengine/common/math/decMath.h>
+#include <dragengine/common/math/decSpatialIndex.h>
 
 class dedaiSpace;
 class dedaiSpaceGridEdge;
@@ -48,6 +49,9 @@ private:
 	decTList<dedaiSpaceGridEdge> pEdges;
 	decTList<dedaiSpaceGridVertex*> pLinks;
 	
+	decSpatialIndex pVertexTree;
+	decSpatialIndex pEdgeTree;
+	
 	
 	
 public:
@@ -80,7 +84,10 @@ public:
 	/** \brief Add vertex. */
 	void AddVertex(const decVector &position);
 	
-	/** Vertex closest to a position or -1 if not found. */
+	/**
+	 * Vertex closest to a position or -1 if not found.
+	 * \details Uses the vertex tree. Disabled vertices are skipped.
+	 */
 	dedaiSpaceGridVertex *GetVertexClosestTo(const decVector &position, float &distance) const;
 	
 	/**
@@ -133,6 +140,7 @@ private:
 	void pInitFromHTNavSpace();
 	
 	void pDisableVertices(const decConvexVolumeList &list);
+	void pBuildTrees();
 };
 
 #endif
@@ -41,6 +41,8 @@
 #include "../../../utils/dedaiConvexFace.h"
 #include "../../../utils/dedaiConvexFaceList.h"
 
+#include <limits>
+
 #include <dragengine/common/exceptions.h>
 #include <dragengine/common/math/decConvexVolume.h>
 #include <dragengine/common/math/decConvexVolumeList.h>
@@ -85,7 +87,11 @@ pStaticCornerCount(0),
 pBlockerBaseCorner(0),
 
 pStaticFaceCount(0),
-pBlockerBaseFace(0){
+pBlockerBaseFace(0),
+
+// faces do not move. loose boxes are not required
+pFaceTree(0.0f),
+pBlockerFaceTree(0.0f){
 }
 
 dedaiSpaceMesh::~dedaiSpaceMesh(){
@@ -136,107 +142,68 @@ void dedaiSpaceMesh::AddFace(){
 }
 
 dedaiSpaceMeshFace *dedaiSpaceMesh::GetFaceClosestTo(const decVector &position, float &distance) const{
-	// for the time being brute force
-	dedaiSpaceMeshFace *bestFace = nullptr;
-	float bestDistSquared = 0.0f;
+	decVector nearestPosition;
+	float nearestDistSquared;
+	dedaiSpaceMeshFace * const face = pNearestFace(position,
+		std::numeric_limits<float>::max(), nearestPosition, nearestDistSquared);
 	
-	pFaces.Visit([&](dedaiSpaceMeshFace &face){
-		if(!face.GetEnabled()){
-			return;
-		}
-// 		if(!(face.GetMaximumExtend() >= testMinExtend && face.GetMinimumExtend() <= testMaxExtend)){
-// 			return;
-// 		}
-		
-		const decVector &faceNormal = face.GetNormal();
-		const dedaiSpaceMeshCorner * const corners = pCorners.GetArrayPointer() + face.GetFirstCorner();
-		const int cornerCount = face.GetCornerCount();
-		
-		decVector testPos(position + faceNormal * (face.GetDistance() - position * faceNormal));
-		
-		int c;
-		for(c=0; c<cornerCount; c++){
-			const decVector &ev1 = pVertices[corners[c].GetVertex()];
-			const decVector &ev2 = pVertices[corners[(c + 1) % cornerCount].GetVertex()];
-			const decVector edgeVector(faceNormal % (ev2 - ev1));
-			if(edgeVector.IsZero()){
-				continue;
-			}
-			
-			const decVector edgeNormal(edgeVector.Normalized());
-			const float lambda = edgeNormal * (testPos - ev1);
-			
-			if(lambda < 0.0f){
-				testPos -= edgeNormal * lambda;
-			}
+	if(face){
+		distance = sqrtf(nearestDistSquared);
+	}
+	return face;
+}
+
+decVector dedaiSpaceMesh::ClosestPointOnFace(const dedaiSpaceMeshFace &face, const decVector &position) const{
+	const decVector &faceNormal = face.GetNormal();
+	const dedaiSpaceMeshCorner * const corners = pCorners.GetArrayPointer() + face.GetFirstCorner();
+	const int cornerCount = face.GetCornerCount();
+	
+	// project position onto face plane. if the projected position is inside all edges
+	// it is the closest point
+	const decVector testPos(position + faceNormal * (face.GetDistance() - position * faceNormal));
+	
+	int c;
+	for(c=0; c<cornerCount; c++){
+		const decVector &ev1 = pVertices[corners[c].GetVertex()];
+		const decVector &ev2 = pVertices[corners[(c + 1) % cornerCount].GetVertex()];
+		if((faceNormal % (ev2 - ev1)) * (testPos - ev1) < 0.0f){
+			break;
 		}
+	}
+	
+	if(c == cornerCount){
+		return testPos;
+	}
+	
+	// otherwise the closest point is located on the closest edge. clamping against one
+	// edge after the other is not enough since this can move the point outside the face
+	decVector bestPos;
+	float bestDistSquared = 0.0f;
+	
+	for(c=0; c<cornerCount; c++){
+		const decVector &ev1 = pVertices[corners[c].GetVertex()];
+		const decVector edge(pVertices[corners[(c + 1) % cornerCount].GetVertex()] - ev1);
+		const float edgeLenSquared = edge.LengthSquared();
+		const float lambda = edgeLenSquared > FLOAT_SAFE_EPSILON
+			? decMath::clamp(edge * (testPos - ev1) / edgeLenSquared, 0.0f, 1.0f) : 0.0f;
+		const decVector edgePos(ev1 + edge * lambda);
+		const float distSquared = (edgePos - testPos).LengthSquared();
 		
-		const float testDistSquared = (testPos - position).LengthSquared();
-		
-		if(!bestFace || testDistSquared < bestDistSquared){
-			bestFace = &face;
-			bestDistSquared = testDistSquared;
+		if(c == 0 || distSquared < bestDistSquared){
+			bestPos = edgePos;
+			bestDistSquared = distSquared;
 		}
-	});
-	
-	if(bestFace){
-		distance = sqrtf(bestDistSquared);
 	}
-	return bestFace;
+	
+	return bestPos;
 }
 
 
 
 dedaiSpaceMeshFace *dedaiSpaceMesh::NearestPoint(const decVector &point, float radius,
 decVector &nearestPosition, float &nearestDistSquared) const{
-	const decVector testMinExtend(point - decVector(radius, radius, radius));
-	const decVector testMaxExtend(point + decVector(radius, radius, radius));
-	const float radiusSquared = radius * radius;
-	dedaiSpaceMeshFace *nearestFace = nullptr;
-	
 	nearestDistSquared = 0.0f;
-	
-	pFaces.Visit([&](dedaiSpaceMeshFace &face){
-		if(!face.GetEnabled()){
-			return;
-		}
-		if(!(face.GetMaximumExtend() >= testMinExtend && face.GetMinimumExtend() <= testMaxExtend)){
-			return;
-		}
-		
-		const decVector &faceNormal = face.GetNormal();
-		const dedaiSpaceMeshCorner * const corners = pCorners.GetArrayPointer() + face.GetFirstCorner();
-		const int cornerCount = face.GetCornerCount();
-		
-		decVector testPos(point + faceNormal * (face.GetDistance() - point * faceNormal));
-		
-		int c;
-		for(c=0; c<cornerCount; c++){
-			const decVector &ev1 = pVertices[corners[c].GetVertex()];
-			const decVector &ev2 = pVertices[corners[(c + 1) % cornerCount].GetVertex()];
-			const decVector edgeVector(faceNormal % (ev2 - ev1));
-			if(edgeVector.IsZero()){
-				continue;
-			}
-			
-			const decVector edgeNormal(edgeVector.Normalized());
-			const float lambda = edgeNormal * (testPos - ev1);
-			
-			if(lambda < 0.0f){
-				testPos -= edgeNormal * lambda;
-			}
-		}
-		
-		const float testDistSquared = (testPos - point).LengthSquared();
-		
-		if(testDistSquared <= radiusSquared && (!nearestFace || testDistSquared < nearestDistSquared)){
-			nearestFace = &face;
-			nearestDistSquared = testDistSquared;
-			nearestPosition = testPos;
-		}
-	});
-	
-	return nearestFace;
+	return pNearestFace(point, radius * radius, nearestPosition, nearestDistSquared);
 }
 
 
@@ -321,6 +288,9 @@ void dedaiSpaceMesh::InitFromSpace(){
 		pInitFromHTNavSpace();
 	}
 	
+	pBuildFaceTree(pFaceTree, 0, pBlockerBaseFace);
+	pBlockerFaceTree.RemoveAll();
+	
 // 	pVerifyInvariants();
 }
 
@@ -386,6 +356,7 @@ void dedaiSpaceMesh::UpdateBlocking(){
 	pCorners.SetCountDiscard(pBlockerBaseCorner);
 	pEdges.SetCountDiscard(pBlockerBaseEdge);
 	pVertices.SetCountDiscard(pBlockerBaseVertex);
+	pBlockerFaceTree.RemoveAll();
 	
 	// process overlapping blockers
 	if(!pSpace.GetParentWorld()){
@@ -441,10 +412,16 @@ void dedaiSpaceMesh::UpdateBlocking(){
 		pAddConvexFaces(convexFaceList, face);
 		// after this call face reference is potentially invalid due to memory move
 	}
+	
+	// disabled static faces stay in the static face tree and are skipped while searching.
+	// only the blocker faces need a new tree
+	pBuildFaceTree(pBlockerFaceTree, pBlockerBaseFace, pFaces.GetCount() - pBlockerBaseFace);
 }
 
 void dedaiSpaceMesh::Clear(){
 	RemoveAllLinks();
+	pFaceTree.RemoveAll();
+	pBlockerFaceTree.RemoveAll();
 	pFaces.SetCountDiscard(0);
 	pCorners.SetCountDiscard(0);
 	pEdges.SetCountDiscard(0);
@@ -1611,6 +1588,62 @@ void dedaiSpaceMesh::pSplitEdge(int edgeIndex, const decVector &splitVertex){
 
 
 
+void dedaiSpaceMesh::pBuildFaceTree(decSpatialIndex &tree, int firstFace, int faceCount){
+	tree.RemoveAll();
+	
+	// inserting into an empty index assigns element indices matching the face order
+	const dedaiSpaceMeshFace * const faces = pFaces.GetArrayPointer() + firstFace;
+	decTList<decVector> minExtends(faceCount), maxExtends(faceCount);
+	int i;
+	for(i=0; i<faceCount; i++){
+		minExtends.Add(faces[i].GetMinimumExtend());
+		maxExtends.Add(faces[i].GetMaximumExtend());
+	}
+	
+	decTList<int> elements(faceCount);
+	tree.Insert(minExtends.GetArrayPointer(), maxExtends.GetArrayPointer(), faceCount, elements);
+}
+
+dedaiSpaceMeshFace *dedaiSpaceMesh::pNearestFace(const decVector &point, float maxDistSquared,
+decVector &nearestPosition, float &nearestDistSquared) const{
+	const dedaiSpaceMeshFace * const faces = pFaces.GetArrayPointer();
+	
+	const auto testFace = [&](int index, float &distSquared){
+		const dedaiSpaceMeshFace &face = faces[index];
+		if(!face.GetEnabled()){
+			return false;
+		}
+		
+		distSquared = (ClosestPointOnFace(face, point) - point).LengthSquared();
+		return true;
+	};
+	
+	// static faces have lower indices than blocker faces. for faces at the same distance
+	// the static face wins
+	float distSquared = 0.0f;
+	int index = pFaceTree.FindNearest(point, maxDistSquared, distSquared, testFace);
+	
+	float blockerDistSquared = 0.0f;
+	const int blockerIndex = pBlockerFaceTree.FindNearest(point, maxDistSquared, blockerDistSquared,
+		[&](int item, float &itemDistSquared){
+			return testFace(pBlockerBaseFace + item, itemDistSquared);
+		});
+	
+	if(blockerIndex != -1 && (index == -1 || blockerDistSquared < distSquared)){
+		index = pBlockerBaseFace + blockerIndex;
+		distSquared = blockerDistSquared;
+	}
+	
+	if(index == -1){
+		return nullptr;
+	}
+	
+	dedaiSpaceMeshFace * const face = const_cast<dedaiSpaceMeshFace*>(faces + index);
+	nearestPosition = ClosestPointOnFace(*face, point);
+	nearestDistSquared = distSquared;
+	return face;
+}
+
 void dedaiSpaceMesh::pVerifyInvariants() const{
 	int f, f2, c, c2, l, e, e2, v, v2;
 	
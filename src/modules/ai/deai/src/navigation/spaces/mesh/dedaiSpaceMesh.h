@@ -27,6 +27,7 @@
 
 #include <dragengine/common/collection/decTList.h>
 #include <dragengine/common/math/decMath.h>
+#include <dragengine/common/math/decSpatialIndex.h>
 
 class dedaiSpace;
 class dedaiSpaceMeshEdge;
@@ -64,6 +65,9 @@ private:
 	
 	decTList<dedaiSpaceMeshLink> pLinks;
 	
+	decSpatialIndex pFaceTree;
+	decSpatialIndex pBlockerFaceTree;
+	
 	
 	
 public:
@@ -131,9 +135,15 @@ public:
 	/** Number of static faces. */
 	inline int GetStaticFaceCount() const{ return pStaticFaceCount; }
 	
-	/** Face closest to a position or -1 if not found. */
+	/**
+	 * Face closest to a position or -1 if not found.
+	 * \details Uses the face trees. Disabled faces are skipped.
+	 */
 	dedaiSpaceMeshFace *GetFaceClosestTo(const decVector &position, float &distance) const;
 	
+	/** Closest point on face to position. */
+	decVector ClosestPointOnFace(const dedaiSpaceMeshFace &face, const decVector &position) const;
+	
 	
 	
 	/**
@@ -199,6 +209,10 @@ private:
 	void pLinkToMesh(dedaiSpaceMesh *mesh, float snapDistance, float snapAngle);
 	void pSplitEdge(int edgeIndex, const decVector &splitVertex);
 	
+	void pBuildFaceTree(decSpatialIndex &tree, int firstFace, int faceCount);
+	dedaiSpaceMeshFace *pNearestFace(const decVector &point, float maxDistSquared,
+		decVector &nearestPosition, float &nearestDistSquared) const;
+	
 	void pVerifyInvariants() const;
 	void pDebugPrint() const;
 };
@@ -44,13 +44,7 @@ pCornerCount(0),
 pIndex(0),
 pTypeNumber(0),
 pDistance(0.0f),
-pEnabled(true),
-
-pPathParent(nullptr),
-pPathCostF(0.0f),
-pPathCostG(0.0f),
-pPathCostH(0.0f),
-pPathType(epftFree){
+pEnabled(true){
 }
 
 dedaiSpaceMeshFace::~dedaiSpaceMeshFace(){
@@ -132,42 +126,9 @@ void dedaiSpaceMeshFace::SetExtends(const decVector &minExtend, const decVector
 	pMaxExtend = maxExtend;
 }
 
-void dedaiSpaceMeshFace::SetEntryPoint(const decVector &entryPoint){
-	pEntryPoint = entryPoint;
-}
-
 
 
 void dedaiSpaceMeshFace::SetEnabled(bool enabled){
 	pEnabled = enabled;
 }
 
-
-
-void dedaiSpaceMeshFace::SetPathParent(dedaiSpaceMeshFace *face){
-	pPathParent = face;
-}
-
-void dedaiSpaceMeshFace::SetPathCostF(float cost){
-	pPathCostF = cost;
-}
-
-void dedaiSpaceMeshFace::SetPathCostG(float cost){
-	pPathCostG = cost;
-}
-
-void dedaiSpaceMeshFace::SetPathCostH(float cost){
-	pPathCostH = cost;
-}
-
-void dedaiSpaceMeshFace::SetPathType(ePathFindingTypes type){
-	pPathType = type;
-}
-
-void dedaiSpaceMeshFace::ClearPath(){
-	pPathParent = nullptr;
-	pPathCostF = 0.0f;
-	pPathCostG = 0.0f;
-	pPathCostH = 0.0f;
-	pPathType = epftFree;
-}
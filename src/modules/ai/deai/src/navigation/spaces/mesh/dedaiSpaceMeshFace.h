@@ -35,21 +35,6 @@ class dedaiSpaceMesh;
  * \brief Space mesh face.
  */
 class dedaiSpaceMeshFace{
-public:
-	/** \brief Path finding type. */
-	enum ePathFindingTypes{
-		/** \brief Face is in no list. */
-		epftFree,
-		
-		/** \brief Face is in the open list. */
-		epftOpen,
-		
-		/** \brief Face is in the closed list. */
-		epftClosed
-	};
-	
-	
-	
 private:
 	dedaiSpaceMesh *pMesh;
 	int pFirstCorner;
@@ -62,16 +47,9 @@ private:
 	float pDistance;
 	decVector pMinExtend;
 	decVector pMaxExtend;
-	decVector pEntryPoint;
 	
 	bool pEnabled;
 	
-	dedaiSpaceMeshFace *pPathParent;
-	float pPathCostF;
-	float pPathCostG;
-	float pPathCostH;
-	ePathFindingTypes pPathType;
-	
 	
 	
 public:
@@ -146,12 +124,6 @@ public:
 	/** \brief Set plane distance. */
 	void SetDistance(float distance);
 	
-	/** \brief Entry point. */
-	inline const decVector &GetEntryPoint() const{ return pEntryPoint; }
-	
-	/** \brief Set entry point. */
-	void SetEntryPoint(const decVector &entryPoint);
-	
 	
 	
 	/** \brief Minimum extend. */
@@ -170,41 +142,6 @@ public:
 	
 	/** \brief Set if face is enabled for path finding. */
 	void SetEnabled(bool enabled);
-	
-	
-	
-	/** \brief Path parent face or \em NULL. */
-	inline dedaiSpaceMeshFace *GetPathParent() const{ return pPathParent; }
-	
-	/** \brief Set path parent face or \em NULL. */
-	void SetPathParent(dedaiSpaceMeshFace *face);
-	
-	/** \brief F path cost. */
-	inline float GetPathCostF() const{ return pPathCostF; }
-	
-	/** \brief Set F path cost. */
-	void SetPathCostF(float cost);
-	
-	/** \brief G path cost. */
-	inline float GetPathCostG() const{ return pPathCostG; }
-	
-	/** \brief Set G path cost. */
-	void SetPathCostG(float cost);
-	
-	/** \brief H path cost. */
-	inline float GetPathCostH() const{ return pPathCostH; }
-	
-	/** \brief Set H path cost. */
-	void SetPathCostH(float cost);
-	
-	/** \brief Path type. */
-	inline ePathFindingTypes GetPathType() const{ return pPathType; }
-	
-	/** \brief Set path type. */
-	void SetPathType(ePathFindingTypes type);
-	
-	/** \brief Clear path information. */
-	void ClearPath();
 	/*@}*/
 };
 
@@ -93,6 +93,7 @@ void dearAnimation::pCreateMoves(){
 	
 	int i;
 	for(i=0; i<count; i++){
-		pMoves.Add(dearAnimationMove::Ref::New(pAnimation->GetMove(i)));
+		pMoves.Add(dearAnimationMove::Ref::New(
+			pAnimation->GetMove(i), pModule->GetCompressAnimations()));
 	}
 }
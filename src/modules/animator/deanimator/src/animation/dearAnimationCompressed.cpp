@@ -0,0 +1,340 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <math.h>
+
+#include "dearAnimationCompressed.h"
+#include "dearAnimationKeyframe.h"
+#include "dearAnimationKeyframeList.h"
+
+#include <dragengine/common/exceptions.h>
+#include <dragengine/common/collection/decTUniqueList.h>
+#include <dragengine/resources/animation/deAnimationMove.h>
+
+
+// Definitions
+////////////////
+
+// smallest three quaternion components are in the range [-1/sqrt(2), 1/sqrt(2)]
+#define ROTATION_RANGE 0.70710678f
+#define ROTATION_BITS_MAX 32767.0f
+#define VECTOR_BITS_MAX 65535.0f
+
+#define THRESHOLD_CONSTANT_VECTOR 1e-5f
+#define THRESHOLD_CONSTANT_ROTATION 1e-7f
+
+
+
+// Class dearAnimationCompressed
+//////////////////////////////////
+
+// Constructors and Destructors
+/////////////////////////////////
+
+dearAnimationCompressed::dearAnimationCompressed(const deAnimationMove &move) :
+pFrameCount(1),
+pFrameSize(0),
+pFrameRate(0.0f)
+{
+	pCompress(move);
+}
+
+dearAnimationCompressed::~dearAnimationCompressed(){
+}
+
+
+
+// Management
+///////////////
+
+int dearAnimationCompressed::GetMemoryConsumption() const{
+	return sizeof(sBone) * pBones.GetCount() + sizeof(uint16_t) * pFrames.GetCount();
+}
+
+bool dearAnimationCompressed::Sample(int bone, float time, decVector &position,
+decQuaternion &rotation, decVector &scaling) const{
+	const sBone &b = pBones[bone];
+	if((b.flags & ebfKeyframes) == 0){
+		return false;
+	}
+	
+	const float frame = decMath::clamp(time * pFrameRate, 0.0f, (float)(pFrameCount - 1));
+	const int frame1 = (int)frame;
+	const int frame2 = decMath::min(frame1 + 1, pFrameCount - 1);
+	const float blend = frame - (float)frame1;
+	
+	const uint16_t * const values1 = pFrames.GetArrayPointer() + frame1 * pFrameSize;
+	const uint16_t * const values2 = pFrames.GetArrayPointer() + frame2 * pFrameSize;
+	
+	if(b.flags & ebfPosition){
+		const decVector p1(pDecodeVector(values1 + b.offsetPosition, b.position, b.positionRange));
+		const decVector p2(pDecodeVector(values2 + b.offsetPosition, b.position, b.positionRange));
+		position = p1 + (p2 - p1) * blend;
+		
+	}else{
+		position = b.position;
+	}
+	
+	if(b.flags & ebfRotation){
+		const decQuaternion r1(pDecodeRotation(values1 + b.offsetRotation));
+		decQuaternion r2(pDecodeRotation(values2 + b.offsetRotation));
+		
+		// decoded rotations have no defined sign. interpolate along the short way
+		if(r1.Dot(r2) < 0.0f){
+			r2 = -r2;
+		}
+		rotation = r1 + (r2 - r1) * blend;
+		
+	}else{
+		rotation = b.rotation;
+	}
+	
+	if(b.flags & ebfScaling){
+		const decVector s1(pDecodeVector(values1 + b.offsetScaling, b.scaling, b.scalingRange));
+		const decVector s2(pDecodeVector(values2 + b.offsetScaling, b.scaling, b.scalingRange));
+		scaling = s1 + (s2 - s1) * blend;
+		
+	}else{
+		scaling = b.scaling;
+	}
+	
+	return true;
+}
+
+
+
+// Private Functions
+//////////////////////
+
+void dearAnimationCompressed::pCompress(const deAnimationMove &move){
+	const int boneCount = move.GetKeyframeListCount();
+	if(boneCount == 0){
+		return;
+	}
+	
+	// decode keyframes to sample them
+	decTUniqueList<dearAnimationKeyframeList> lists;
+	int i, j, maxKeyframeCount = 0;
+	
+	for(i=0; i<boneCount; i++){
+		lists.Add(deTUniqueReference<dearAnimationKeyframeList>::New(move.GetKeyframeList(i)));
+		maxKeyframeCount = decMath::max(maxKeyframeCount, lists.GetAt(i)->GetKeyframes().GetCount());
+	}
+	
+	// frames are spread evenly across the play time. use at least the frame rate of the
+	// move and not less frames than the bone with the most keyframes
+	const float playtime = move.GetPlaytime();
+	if(playtime > FLOAT_SAFE_EPSILON){
+		pFrameCount = decMath::max((int)ceilf(playtime * move.GetFPS() - 0.01f) + 1, maxKeyframeCount, 2);
+		pFrameRate = (float)(pFrameCount - 1) / playtime;
+	}
+	
+	// sample bones and find constant channels
+	decTList<decVector> positions(pFrameCount), scalings(pFrameCount);
+	decTList<decQuaternion> rotations(pFrameCount);
+	decTList<int> samplesOffset;
+	decTList<decVector> samplesPosition, samplesScaling;
+	decTList<decQuaternion> samplesRotation;
+	
+	pBones.AddRange(boneCount, {});
+	
+	for(i=0; i<boneCount; i++){
+		const dearAnimationKeyframeList &list = *lists.GetAt(i);
+		sBone &bone = pBones[i];
+		
+		if(list.GetKeyframes().IsEmpty()){
+			continue;
+		}
+		bone.flags = ebfKeyframes;
+		
+		int cursor = 0;
+		for(j=0; j<pFrameCount; j++){
+			const float time = pFrameRate > 0.0f ? (float)j / pFrameRate : 0.0f;
+			const dearAnimationKeyframe &keyframe = *list.GetWithTime(time, cursor);
+			const float keyframeTime = time - keyframe.GetTime();
+			
+			decQuaternion rotation(keyframe.InterpolateRotation(keyframeTime));
+			if(rotation.Length() > FLOAT_SAFE_EPSILON){
+				rotation.Normalize();
+				
+			}else{
+				rotation.Set(0.0f, 0.0f, 0.0f, 1.0f);
+			}
+			
+			positions.Add(keyframe.InterpolatePosition(keyframeTime));
+			rotations.Add(rotation);
+			scalings.Add(keyframe.InterpolateScaling(keyframeTime));
+		}
+		
+		decVector minPosition(positions.First()), maxPosition(minPosition);
+		decVector minScaling(scalings.First()), maxScaling(minScaling);
+		bool constantRotation = true;
+		
+		for(j=1; j<pFrameCount; j++){
+			minPosition.SetSmallest(positions[j]);
+			maxPosition.SetLargest(positions[j]);
+			minScaling.SetSmallest(scalings[j]);
+			maxScaling.SetLargest(scalings[j]);
+			
+			if(constantRotation && 1.0f - fabsf(rotations.First().Dot(rotations[j])) > THRESHOLD_CONSTANT_ROTATION){
+				constantRotation = false;
+			}
+		}
+		
+		bone.position = minPosition;
+		bone.positionRange = maxPosition - minPosition;
+		if(!bone.positionRange.IsZero(THRESHOLD_CONSTANT_VECTOR)){
+			bone.flags |= ebfPosition;
+			bone.offsetPosition = pFrameSize;
+			pFrameSize += 3;
+		}
+		
+		bone.rotation = rotations.First();
+		if(!constantRotation){
+			bone.flags |= ebfRotation;
+			bone.offsetRotation = pFrameSize;
+			pFrameSize += 3;
+		}
+		
+		bone.scaling = minScaling;
+		bone.scalingRange = maxScaling - minScaling;
+		if(!bone.scalingRange.IsZero(THRESHOLD_CONSTANT_VECTOR)){
+			bone.flags |= ebfScaling;
+			bone.offsetScaling = pFrameSize;
+			pFrameSize += 3;
+		}
+		
+		// keep samples of animated bones until all frame offsets are known
+		if(bone.flags != ebfKeyframes){
+			samplesOffset.Add(i);
+			samplesPosition += positions;
+			samplesRotation += rotations;
+			samplesScaling += scalings;
+		}
+		
+		positions.RemoveAll();
+		rotations.RemoveAll();
+		scalings.RemoveAll();
+	}
+	
+	// quantize samples frame by frame
+	if(pFrameSize == 0){
+		return;
+	}
+	
+	pFrames.AddRange(pFrameCount * pFrameSize, 0);
+	uint16_t * const frames = pFrames.GetArrayPointer();
+	
+	const int sampledCount = samplesOffset.GetCount();
+	for(i=0; i<sampledCount; i++){
+		const sBone &bone = pBones[samplesOffset[i]];
+		const int first = i * pFrameCount;
+		
+		for(j=0; j<pFrameCount; j++){
+			uint16_t * const values = frames + j * pFrameSize;
+			
+			if(bone.flags & ebfPosition){
+				pEncodeVector(samplesPosition[first + j], bone.position,
+					bone.positionRange, values + bone.offsetPosition);
+			}
+			if(bone.flags & ebfRotation){
+				pEncodeRotation(samplesRotation[first + j], values + bone.offsetRotation);
+			}
+			if(bone.flags & ebfScaling){
+				pEncodeVector(samplesScaling[first + j], bone.scaling,
+					bone.scalingRange, values + bone.offsetScaling);
+			}
+		}
+	}
+}
+
+
+
+void dearAnimationCompressed::pEncodeRotation(const decQuaternion &rotation, uint16_t *values){
+	// store the three smallest components. the largest component is made positive
+	// and is calculated from the other three while decoding
+	const float components[4] = {rotation.x, rotation.y, rotation.z, rotation.w};
+	int i, largest = 0;
+	for(i=1; i<4; i++){
+		if(fabsf(components[i]) > fabsf(components[largest])){
+			largest = i;
+		}
+	}
+	
+	const float sign = components[largest] < 0.0f ? -1.0f : 1.0f;
+	int j = 0;
+	for(i=0; i<4; i++){
+		if(i == largest){
+			continue;
+		}
+		
+		const float value = decMath::clamp(components[i] * sign, -ROTATION_RANGE, ROTATION_RANGE);
+		values[j++] = (uint16_t)((value / ROTATION_RANGE * 0.5f + 0.5f) * ROTATION_BITS_MAX + 0.5f);
+	}
+	
+	// index of the largest component is stored in the highest bit of the first two values
+	values[0] |= (uint16_t)((largest & 1) << 15);
+	values[1] |= (uint16_t)((largest & 2) << 14);
+}
+
+decQuaternion dearAnimationCompressed::pDecodeRotation(const uint16_t *values){
+	const int largest = (values[0] >> 15) | ((values[1] >> 14) & 2);
+	float components[4];
+	float squareSum = 0.0f;
+	int i, j = 0;
+	
+	for(i=0; i<4; i++){
+		if(i == largest){
+			continue;
+		}
+		
+		const float value = ((float)(values[j++] & 0x7fff) / ROTATION_BITS_MAX * 2.0f - 1.0f) * ROTATION_RANGE;
+		components[i] = value;
+		squareSum += value * value;
+	}
+	
+	components[largest] = sqrtf(decMath::max(1.0f - squareSum, 0.0f));
+	return decQuaternion(components[0], components[1], components[2], components[3]);
+}
+
+void dearAnimationCompressed::pEncodeVector(const decVector &vector, const decVector &minimum,
+const decVector &range, uint16_t *values){
+	const float components[3] = {vector.x - minimum.x, vector.y - minimum.y, vector.z - minimum.z};
+	const float ranges[3] = {range.x, range.y, range.z};
+	int i;
+	
+	for(i=0; i<3; i++){
+		values[i] = ranges[i] > FLOAT_SAFE_EPSILON ? (uint16_t)(decMath::clamp(
+			components[i] / ranges[i], 0.0f, 1.0f) * VECTOR_BITS_MAX + 0.5f) : 0;
+	}
+}
+
+decVector dearAnimationCompressed::pDecodeVector(const uint16_t *values,
+const decVector &minimum, const decVector &range){
+	const float factor = 1.0f / VECTOR_BITS_MAX;
+	return decVector(
+		minimum.x + range.x * ((float)values[0] * factor),
+		minimum.y + range.y * ((float)values[1] * factor),
+		minimum.z + range.z * ((float)values[2] * factor));
+}
@@ -0,0 +1,141 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DEARANIMATIONCOMPRESSED_H_
+#define _DEARANIMATIONCOMPRESSED_H_
+
+#include <stdint.h>
+
+#include <dragengine/common/math/decMath.h>
+#include <dragengine/common/collection/decTList.h>
+
+class deAnimationMove;
+class dearAnimationKeyframeList;
+
+
+/**
+ * Compressed animation move bone data.
+ * 
+ * Bone keyframes are resampled at a fixed frame rate. Rotations are quantized using
+ * the smallest three components (15 bits each). Positions and scalings are quantized
+ * to 16 bits per component relative to the value range of the bone. Constant channels
+ * are stored once per bone and take no space in the frames.
+ * 
+ * Frames are stored frame by frame. All animated channels of all bones for one frame
+ * are located next to each other. Sampling all bones at the same time walks the memory
+ * of two consecutive frames in order.
+ */
+class dearAnimationCompressed{
+private:
+	/** Bone channel flags. */
+	enum eBoneFlags{
+		/** Bone has keyframes. */
+		ebfKeyframes = 0x1,
+		
+		/** Position is animated. */
+		ebfPosition = 0x2,
+		
+		/** Rotation is animated. */
+		ebfRotation = 0x4,
+		
+		/** Scaling is animated. */
+		ebfScaling = 0x8
+	};
+	
+	/** Bone. */
+	struct sBone{
+		int flags;
+		int offsetPosition;
+		int offsetRotation;
+		int offsetScaling;
+		decVector position;
+		decVector positionRange;
+		decQuaternion rotation;
+		decVector scaling;
+		decVector scalingRange;
+		
+		sBone() : flags(0), offsetPosition(0), offsetRotation(0), offsetScaling(0),
+		scaling(1.0f, 1.0f, 1.0f){
+		}
+	};
+	
+	decTList<sBone> pBones;
+	decTList<uint16_t> pFrames;
+	int pFrameCount;
+	int pFrameSize;
+	float pFrameRate;
+	
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/** Create compressed data from keyframe lists of move. */
+	explicit dearAnimationCompressed(const deAnimationMove &move);
+	
+	/** Clean up compressed data. */
+	~dearAnimationCompressed();
+	/*@}*/
+	
+	
+	
+	/** \name Management */
+	/*@{*/
+	/** Count of bones. */
+	inline int GetBoneCount() const{ return pBones.GetCount(); }
+	
+	/** Count of frames. */
+	inline int GetFrameCount() const{ return pFrameCount; }
+	
+	/** Frame rate used to resample keyframes. */
+	inline float GetFrameRate() const{ return pFrameRate; }
+	
+	/** Count of quantized values per frame. */
+	inline int GetFrameSize() const{ return pFrameSize; }
+	
+	/** Memory consumption in bytes. */
+	int GetMemoryConsumption() const;
+	
+	/**
+	 * Sample bone.
+	 * \returns false if bone has no keyframes.
+	 */
+	bool Sample(int bone, float time, decVector &position,
+		decQuaternion &rotation, decVector &scaling) const;
+	/*@}*/
+	
+	
+	
+private:
+	void pCompress(const deAnimationMove &move);
+	
+	static void pEncodeRotation(const decQuaternion &rotation, uint16_t *values);
+	static decQuaternion pDecodeRotation(const uint16_t *values);
+	static void pEncodeVector(const decVector &vector, const decVector &minimum,
+		const decVector &range, uint16_t *values);
+	static decVector pDecodeVector(const uint16_t *values, const decVector &minimum,
+		const decVector &range);
+};
+
+#endif
@@ -65,18 +65,26 @@ const dearAnimationKeyframe *dearAnimationKeyframeList::GetWithTime(float time)
 		return nullptr;
 	}
 	
-	if(time <= pKeyframes.First().GetTime()){
-		return &pKeyframes.First();
+	return &pKeyframes[pIndexWithTime(time)];
+}
+
+const dearAnimationKeyframe *dearAnimationKeyframeList::GetWithTime(float time, int &cursor) const{
+	const int count = pKeyframes.GetCount();
+	if(count == 0){
+		return nullptr;
 	}
 	
-	int i;
-	for(i=1; i<pKeyframes.GetCount(); i++){
-		if(time < pKeyframes[i].GetTime()){
-			return &pKeyframes[i - 1];
+	if(cursor >= 0 && cursor < count){
+		if(pSegmentContains(cursor, time)){
+			return &pKeyframes[cursor];
+		}
+		if(cursor + 1 < count && pSegmentContains(cursor + 1, time)){
+			return &pKeyframes[++cursor];
 		}
 	}
 	
-	return &pKeyframes.Last();
+	cursor = pIndexWithTime(time);
+	return &pKeyframes[cursor];
 }
 
 
@@ -87,6 +95,30 @@ const dearAnimationKeyframe *dearAnimationKeyframeList::GetWithTime(float time)
 void dearAnimationKeyframeList::pCleanUp(){
 }
 
+int dearAnimationKeyframeList::pIndexWithTime(float time) const{
+	// index of the last keyframe with time less than or equal to time. the first
+	// keyframe is used if time is before the first keyframe
+	const dearAnimationKeyframe * const keyframes = pKeyframes.GetArrayPointer();
+	int first = 1, last = pKeyframes.GetCount();
+	
+	while(first < last){
+		const int middle = first + (last - first) / 2;
+		if(time < keyframes[middle].GetTime()){
+			last = middle;
+			
+		}else{
+			first = middle + 1;
+		}
+	}
+	
+	return first - 1;
+}
+
+bool dearAnimationKeyframeList::pSegmentContains(int index, float time) const{
+	return (index == 0 || time >= pKeyframes[index].GetTime())
+		&& (index == pKeyframes.GetCount() - 1 || time < pKeyframes[index + 1].GetTime());
+}
+
 
 
 void dearAnimationKeyframeList::pCreateKeyframes(const deAnimationKeyframe::List &list){
@@ -61,6 +61,17 @@ public:
 	
 	/** Keyframe with range containing time in seconds or nullptr if absent. */
 	const dearAnimationKeyframeVPS *GetWithTime(float time) const;
+	
+	/**
+	 * Keyframe with range containing time in seconds or nullptr if absent.
+	 * 
+	 * Uses cursor as hint where to start looking. Cursor is the index of the keyframe
+	 * found the last time. The keyframe at the cursor and the one after are checked
+	 * first. This makes playing back forward constant time. Otherwise binary search
+	 * is used. Cursor is updated with the index of the found keyframe. Initialize
+	 * cursor to 0 for the first call.
+	 */
+	const dearAnimationKeyframeVPS *GetWithTime(float time, int &cursor) const;
 	/*@}*/
 	
 	
@@ -68,6 +79,9 @@ public:
 private:
 	void pCleanUp();
 	
+	int pIndexWithTime(float time) const;
+	bool pSegmentContains(int index, float time) const;
+	
 	void pCreateKeyframes(const deAnimationKeyframeVertexPositionSet::List &list);
 };
 
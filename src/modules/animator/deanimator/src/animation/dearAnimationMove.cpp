@@ -26,6 +26,7 @@
 #include <string.h>
 
 #include "dearAnimationMove.h"
+#include "dearAnimationKeyframe.h"
 #include "dearAnimationKeyframeList.h"
 #include "dearAnimationKeyframeVPSList.h"
 
@@ -41,12 +42,17 @@
 // Constructors and Destructors
 /////////////////////////////////
 
-dearAnimationMove::dearAnimationMove(const deAnimationMove &move) :
+dearAnimationMove::dearAnimationMove(const deAnimationMove &move, bool compress) :
 pName(move.GetName()),
 pPlaytime(move.GetPlaytime())
 {
 	try{
-		pCreateKeyframeLists(move);
+		if(compress){
+			pCompressed = deTUniqueReference<dearAnimationCompressed>::New(move);
+			
+		}else{
+			pCreateKeyframeLists(move);
+		}
 		pCreateKeyframeVPSLists(move);
 		
 	}catch(const deException &){
@@ -68,6 +74,42 @@ dearAnimationKeyframeList *dearAnimationMove::GetKeyframeListAt(int index) const
 	return pKeyframeLists.GetAt(index);
 }
 
+bool dearAnimationMove::SampleBone(int index, float time, decVector &position,
+decQuaternion &orientation, decVector &scale) const{
+	if(pCompressed){
+		return pCompressed->Sample(index, time, position, orientation, scale);
+	}
+	
+	const dearAnimationKeyframe * const keyframe = pKeyframeLists.GetAt(index)->GetWithTime(time);
+	if(!keyframe){
+		return false;
+	}
+	
+	const float keyframeTime = time - keyframe->GetTime();
+	position = keyframe->InterpolatePosition(keyframeTime);
+	orientation = keyframe->InterpolateRotation(keyframeTime);
+	scale = keyframe->InterpolateScaling(keyframeTime);
+	return true;
+}
+
+bool dearAnimationMove::SampleBone(int index, float time, int &cursor, decVector &position,
+decQuaternion &orientation, decVector &scale) const{
+	if(pCompressed){
+		return pCompressed->Sample(index, time, position, orientation, scale);
+	}
+	
+	const dearAnimationKeyframe * const keyframe = pKeyframeLists.GetAt(index)->GetWithTime(time, cursor);
+	if(!keyframe){
+		return false;
+	}
+	
+	const float keyframeTime = time - keyframe->GetTime();
+	position = keyframe->InterpolatePosition(keyframeTime);
+	orientation = keyframe->InterpolateRotation(keyframeTime);
+	scale = keyframe->InterpolateScaling(keyframeTime);
+	return true;
+}
+
 dearAnimationKeyframeVPSList *dearAnimationMove::GetKeyframeVPSListAt(int index) const{
 	return pKeyframeVPSLists.GetAt(index);
 }
@@ -25,10 +25,13 @@
 #ifndef _DEARANIMATIONMOVE_H_
 #define _DEARANIMATIONMOVE_H_
 
+#include "dearAnimationCompressed.h"
+
 #include <dragengine/deObject.h>
 #include <dragengine/common/collection/decTOrderedSet.h>
 #include <dragengine/common/collection/decTUniqueList.h>
 #include <dragengine/common/string/decString.h>
+#include <dragengine/common/math/decMath.h>
 
 class deAnimationMove;
 class dearAnimationKeyframeList;
@@ -43,6 +46,7 @@ private:
 	float pPlaytime;
 	
 	decTUniqueList<dearAnimationKeyframeList> pKeyframeLists;
+	deTUniqueReference<dearAnimationCompressed> pCompressed;
 	
 	decTUniqueList<dearAnimationKeyframeVPSList> pKeyframeVPSLists;
 	
@@ -55,8 +59,14 @@ public:
 	
 	/** \name Constructors and Destructors */
 	/*@{*/
-	/** Create a new animation move. */
-	explicit dearAnimationMove(const deAnimationMove &move);
+	/**
+	 * Create a new animation move.
+	 * 
+	 * If \em compress is true bone keyframes are stored as dearAnimationCompressed
+	 * instead of keyframe lists. Use SampleBone() to sample bones independent of
+	 * the storage used.
+	 */
+	dearAnimationMove(const deAnimationMove &move, bool compress);
 	
 protected:
 	/** Clean up the animation move. */
@@ -74,12 +84,31 @@ public:
 	/** Play time in seconds. */
 	inline float GetPlaytime() const{ return pPlaytime; }
 	
-	/** Count of keyframe lists. */
+	/** Count of keyframe lists. Is 0 if move is compressed. */
 	inline int GetKeyframeListCount() const{ return pKeyframeLists.GetCount(); }
 	
 	/** Keyframe list at index. */
 	dearAnimationKeyframeList *GetKeyframeListAt(int index) const;
 	
+	/** Compressed bone keyframes or nullptr if not compressed. */
+	inline const deTUniqueReference<dearAnimationCompressed> &GetCompressed() const{ return pCompressed; }
+	
+	/**
+	 * Sample bone at time.
+	 * \returns false if bone has no keyframes. Output parameters are not modified.
+	 */
+	bool SampleBone(int index, float time, decVector &position,
+		decQuaternion &orientation, decVector &scale) const;
+	
+	/**
+	 * Sample bone at time using keyframe cursor.
+	 * 
+	 * See dearAnimationKeyframeList::GetWithTime(float,int&) for the use of \em cursor.
+	 * \returns false if bone has no keyframes. Output parameters are not modified.
+	 */
+	bool SampleBone(int index, float time, int &cursor, decVector &position,
+		decQuaternion &orientation, decVector &scale) const;
+	
 	/** Count of keyframe lists. */
 	inline int GetKeyframeVPSListCount() const{ return pKeyframeVPSLists.GetCount(); }
 	
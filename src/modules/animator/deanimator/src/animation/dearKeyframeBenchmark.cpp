@@ -0,0 +1,178 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <math.h>
+#include <stdio.h>
+
+#include "dearKeyframeBenchmark.h"
+#include "dearAnimationKeyframe.h"
+#include "dearAnimationKeyframeList.h"
+#include "../deDEAnimator.h"
+
+#include <dragengine/common/collection/decTList.h>
+#include <dragengine/common/collection/decTUniqueList.h>
+#include <dragengine/common/exceptions.h>
+#include <dragengine/common/string/decString.h>
+#include <dragengine/common/string/unicode/decUnicodeString.h>
+#include <dragengine/common/utils/decTimer.h>
+#include <dragengine/resources/animation/deAnimationKeyframe.h>
+
+
+// Definitions
+////////////////
+
+#define BENCHMARK_BONE_COUNT 64
+#define BENCHMARK_FRAME_COUNT 120
+#define BENCHMARK_FRAME_RATE 30.0f
+#define BENCHMARK_UPDATE_RATE 60.0f
+
+
+// Linear search as used before keyframe cursors have been added
+static const dearAnimationKeyframe *dearKFBLinearSearch(
+const dearAnimationKeyframeList &list, float time){
+	const decTList<dearAnimationKeyframe> &keyframes = list.GetKeyframes();
+	if(keyframes.IsEmpty()){
+		return nullptr;
+	}
+	
+	if(time <= keyframes.First().GetTime()){
+		return &keyframes.First();
+	}
+	
+	int i;
+	for(i=1; i<keyframes.GetCount(); i++){
+		if(time < keyframes[i].GetTime()){
+			return &keyframes[i - 1];
+		}
+	}
+	
+	return &keyframes.Last();
+}
+
+
+
+// Class dearKeyframeBenchmark
+////////////////////////////////
+
+// Constructor, destructor
+////////////////////////////
+
+dearKeyframeBenchmark::dearKeyframeBenchmark(deDEAnimator &module) :
+pModule(module){
+}
+
+dearKeyframeBenchmark::~dearKeyframeBenchmark(){
+}
+
+
+
+// Management
+///////////////
+
+void dearKeyframeBenchmark::Run(int instanceCount, int keyframeCount, decUnicodeString &answer){
+	DEASSERT_TRUE(instanceCount > 0)
+	DEASSERT_TRUE(keyframeCount > 1)
+	
+	// create clip
+	decTUniqueList<dearAnimationKeyframeList> lists;
+	int i, j, k, l;
+	
+	for(i=0; i<BENCHMARK_BONE_COUNT; i++){
+		deAnimationKeyframe::List keyframes;
+		for(j=0; j<keyframeCount; j++){
+			deAnimationKeyframe keyframe;
+			keyframe.SetTime((float)j / BENCHMARK_FRAME_RATE);
+			keyframe.SetPosition(decVector(sinf((float)(i + j) * 0.1f), 0.0f, (float)j * 0.01f));
+			keyframe.SetRotation(decVector(0.0f, (float)(i * j % 360) * DEG2RAD, 0.0f));
+			keyframes.Add(keyframe);
+		}
+		lists.Add(deTUniqueReference<dearAnimationKeyframeList>::New(keyframes));
+	}
+	
+	const float playtime = (float)(keyframeCount - 1) / BENCHMARK_FRAME_RATE;
+	const int evaluations = BENCHMARK_FRAME_COUNT * instanceCount * BENCHMARK_BONE_COUNT;
+	
+	// one cursor per instance and bone
+	decTList<int> cursors;
+	cursors.AddRange(instanceCount * BENCHMARK_BONE_COUNT, 0);
+	
+	const char * const modeNames[3] = {"linear", "binary", "cursor"};
+	float elapsed[3];
+	float checksums[3];
+	decTimer timer;
+	
+	for(i=0; i<3; i++){
+		float checksum = 0.0f;
+		timer.Reset();
+		
+		for(j=0; j<BENCHMARK_FRAME_COUNT; j++){
+			for(k=0; k<instanceCount; k++){
+				// instances play the clip with different offsets
+				const float time = fmodf(playtime * (float)k / (float)instanceCount
+					+ (float)j / BENCHMARK_UPDATE_RATE, playtime);
+				int * const instanceCursors = cursors.GetArrayPointer() + k * BENCHMARK_BONE_COUNT;
+				
+				for(l=0; l<BENCHMARK_BONE_COUNT; l++){
+					const dearAnimationKeyframeList &list = *lists.GetAt(l);
+					const dearAnimationKeyframe *keyframe;
+					
+					switch(i){
+					case 0:
+						keyframe = dearKFBLinearSearch(list, time);
+						break;
+						
+					case 1:
+						keyframe = list.GetWithTime(time);
+						break;
+						
+					default:
+						keyframe = list.GetWithTime(time, instanceCursors[l]);
+					}
+					
+					checksum += keyframe->InterpolatePosition(time - keyframe->GetTime()).z;
+				}
+			}
+		}
+		
+		elapsed[i] = timer.GetElapsedTime();
+		checksums[i] = checksum;
+	}
+	
+	decString text;
+	text.Format("Keyframe benchmark: %d instances, %d bones, %d keyframes, %d frames\n",
+		instanceCount, BENCHMARK_BONE_COUNT, keyframeCount, BENCHMARK_FRAME_COUNT);
+	
+	for(i=0; i<3; i++){
+		decString line;
+		line.Format("- %s: %.1f ns per bone (%.1f ms total)\n", modeNames[i],
+			elapsed[i] * 1e9f / (float)evaluations, elapsed[i] * 1e3f);
+		text += line;
+	}
+	
+	if(checksums[1] != checksums[0] || checksums[2] != checksums[0]){
+		text += "WARNING: results differ between modes\n";
+	}
+	
+	answer.SetFromUTF8(text);
+}
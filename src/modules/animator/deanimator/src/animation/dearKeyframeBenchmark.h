@@ -0,0 +1,72 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DEARKEYFRAMEBENCHMARK_H_
+#define _DEARKEYFRAMEBENCHMARK_H_
+
+class deDEAnimator;
+class decUnicodeString;
+
+
+/**
+ * Keyframe lookup benchmark.
+ * 
+ * Evaluates a synthetic clip for multiple animator instances comparing linear keyframe
+ * search, binary keyframe search and keyframe cursors. Run using the module command
+ * "keyframeBenchmark".
+ */
+class dearKeyframeBenchmark{
+private:
+	deDEAnimator &pModule;
+	
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/** Create benchmark. */
+	explicit dearKeyframeBenchmark(deDEAnimator &module);
+	
+	/** Clean up benchmark. */
+	~dearKeyframeBenchmark();
+	/*@}*/
+	
+	
+	
+	/** \name Management */
+	/*@{*/
+	/** Module. */
+	inline deDEAnimator &GetModule() const{ return pModule; }
+	
+	/**
+	 * Run benchmark.
+	 * \param[in] instanceCount Count of animator instances playing the clip.
+	 * \param[in] keyframeCount Count of keyframes per bone in the clip.
+	 * \param[out] answer Results.
+	 */
+	void Run(int instanceCount, int keyframeCount, decUnicodeString &answer);
+	/*@}*/
+};
+
+#endif
@@ -29,10 +29,14 @@
 #include "dearAnimatorInstance.h"
 #include "deDEAnimator.h"
 #include "animation/dearAnimation.h"
+#include "animation/dearKeyframeBenchmark.h"
 #include "component/dearComponent.h"
+#include "parameters/dearPCompressAnimations.h"
 
 #include <dragengine/systems/modules/deModuleParameter.h>
 #include <dragengine/common/exceptions.h>
+#include <dragengine/common/string/unicode/decUnicodeString.h>
+#include <dragengine/common/string/unicode/decUnicodeArgumentList.h>
 #include <dragengine/deEngine.h>
 
 
@@ -73,7 +77,10 @@ deBaseModule *DEAnimatorCreateModule(deLoadableModule *loadableModule){
 ////////////////////////////
 
 deDEAnimator::deDEAnimator(deLoadableModule &loadableModule) :
-deBaseAnimatorModule(loadableModule){
+deBaseAnimatorModule(loadableModule),
+pCompressAnimations(false)
+{
+	pParameters.Add(deTUniqueReference<dearPCompressAnimations>::New(*this));
 }
 
 deDEAnimator::~deDEAnimator(){
@@ -112,6 +119,66 @@ deBaseAnimatorComponent *deDEAnimator::CreateComponent(deComponent *component){
 	return new dearComponent(*this, *component);
 }
 
+void deDEAnimator::SetCompressAnimations(bool compress){
+	pCompressAnimations = compress;
+}
+
+
+
+// Parameters
+///////////////
+
+int deDEAnimator::GetParameterCount() const{
+	return pParameters.GetCount();
+}
+
+void deDEAnimator::GetParameterInfo(int index, deModuleParameter &info) const{
+	info = pParameters.GetAt(index);
+}
+
+int deDEAnimator::IndexOfParameterNamed(const char *name) const{
+	return pParameters.IndexOfNamed(name);
+}
+
+decString deDEAnimator::GetParameterValue(const char *name) const{
+	return pParameters.GetNamed(name).GetParameterValue();
+}
+
+void deDEAnimator::SetParameterValue(const char *name, const char *value){
+	pParameters.GetNamed(name).SetParameterValue(value);
+}
+
+
+
+// Debugging
+//////////////
+
+void deDEAnimator::SendCommand(const decUnicodeArgumentList &command, decUnicodeString &answer){
+	if(command.GetArgumentCount() == 0){
+		answer.SetFromUTF8("No command provided.");
+		
+	}else if(command.MatchesArgumentAt(0, "help")){
+		answer.SetFromUTF8("help => Displays this help screen.\n"
+			"keyframeBenchmark [instances] [keyframes] => Benchmark keyframe lookup.\n");
+		
+	}else if(command.MatchesArgumentAt(0, "keyframeBenchmark")){
+		const int instanceCount = command.GetArgumentCount() > 1 ? command.GetArgumentAt(1)->ToInt() : 100;
+		const int keyframeCount = command.GetArgumentCount() > 2 ? command.GetArgumentAt(2)->ToInt() : 1000;
+		
+		if(instanceCount < 1 || keyframeCount < 2){
+			answer.SetFromUTF8("Requires at least 1 instance and 2 keyframes.");
+			return;
+		}
+		
+		dearKeyframeBenchmark(*this).Run(instanceCount, keyframeCount, answer);
+		
+	}else{
+		answer.SetFromUTF8("Unknown command '");
+		answer += *command.GetArgumentAt(0);
+		answer.AppendFromUTF8("'.");
+	}
+}
+
 #ifdef WITH_INTERNAL_MODULE
 #include <dragengine/systems/modules/deInternalModule.h>
 
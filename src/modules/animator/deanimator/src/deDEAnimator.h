@@ -25,6 +25,8 @@
 #ifndef _DEDEANIMATOR_H_
 #define _DEDEANIMATOR_H_
 
+#include "parameters/dearParameter.h"
+
 #include <dragengine/systems/modules/animator/deBaseAnimatorModule.h>
 
 
@@ -33,6 +35,12 @@
  * DEAnimator animator module.
  */
 class deDEAnimator : public deBaseAnimatorModule{
+private:
+	bool pCompressAnimations;
+	dearParameter::List pParameters;
+	
+	
+	
 public:
 	/** \name Constructors and Destructors */
 	/*@{*/
@@ -69,6 +77,40 @@ public:
 	
 	/** Create peer for component. */
 	deBaseAnimatorComponent *CreateComponent(deComponent *component) override;
+	
+	/** Store animations loaded from now on compressed. */
+	inline bool GetCompressAnimations() const{ return pCompressAnimations; }
+	
+	/** Set if animations loaded from now on are stored compressed. */
+	void SetCompressAnimations(bool compress);
+	/*@}*/
+	
+	
+	
+	/** \name Parameters */
+	/*@{*/
+	/** Number of parameters. */
+	int GetParameterCount() const override;
+	
+	/** Get information about parameter. */
+	void GetParameterInfo(int index, deModuleParameter &parameter) const override;
+	
+	/** Index of named parameter or -1 if not found. */
+	int IndexOfParameterNamed(const char *name) const override;
+	
+	/** Value of named parameter. */
+	decString GetParameterValue(const char *name) const override;
+	
+	/** Set value of named parameter. */
+	void SetParameterValue(const char *name, const char *value) override;
+	/*@}*/
+	
+	
+	
+	/** \name Debugging */
+	/*@{*/
+	/** Send command. */
+	void SendCommand(const decUnicodeArgumentList &command, decUnicodeString &answer) override;
 	/*@}*/
 };
 
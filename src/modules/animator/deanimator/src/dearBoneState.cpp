@@ -181,6 +181,32 @@ void dearBoneState::UpdateMatrices(){
 	pDirty = false;
 }
 
+void dearBoneState::UpdateLocalMatrices(){
+	if(!pDirty){
+		return;
+	}
+	
+	pLocalMatrix.SetWorld(pPosition, pOrientation, pScale);
+	pInvLocalMatrix = pLocalMatrix.QuickInvert();
+}
+
+void dearBoneState::UpdateGlobalMatrices(const decMatrix &localRigMatrix){
+	if(!pDirty){
+		return;
+	}
+	
+	if(pParentState){
+		pGlobalMatrix = localRigMatrix.QuickMultiply(pParentState->GetGlobalMatrix());
+		
+	}else{
+		pGlobalMatrix = localRigMatrix;
+	}
+	
+	pInvGlobalMatrix = pGlobalMatrix.QuickInvert();
+	
+	pDirty = false;
+}
+
 void dearBoneState::UpdateFromGlobalMatrix(){
 	const decMatrix matrix = CalcLocalFromGlobal(pGlobalMatrix);
 	SetPosition(matrix.GetPosition());
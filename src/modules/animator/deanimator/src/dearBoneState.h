@@ -153,6 +153,16 @@ public:
 	void SetDirty(bool dirty);
 	/** Sets the matrices from the current state. */
 	void UpdateMatrices();
+	/**
+	 * Sets the local matrices from the current state if dirty. Used by batch updates
+	 * together with UpdateGlobalMatrices().
+	 */
+	void UpdateLocalMatrices();
+	/**
+	 * Sets the global matrices if dirty using the local matrix already multiplied with
+	 * the rig local matrix. The parent state has to be updated already. Clears the dirty flag.
+	 */
+	void UpdateGlobalMatrices(const decMatrix &localRigMatrix);
 	/**
 	 * Sets the matrices from the current state. The global matrix is not touched except
 	 * the inverse is calculated and stored.
@@ -33,6 +33,7 @@
 
 #include <dragengine/common/collection/decTList.h>
 #include <dragengine/common/exceptions.h>
+#include <dragengine/common/math/decMathBatch.h>
 #include <dragengine/resources/animation/deAnimation.h>
 #include <dragengine/resources/animator/deAnimator.h>
 #include <dragengine/resources/component/deComponent.h>
@@ -127,9 +128,29 @@ void dearBoneStateList::ResetStates(){
 
 
 void dearBoneStateList::UpdateStates(){
-	pStates.Visit([](dearBoneState &state){
-		state.UpdateMatrices();
+	const int count = pStates.GetCount();
+	if(count == 0){
+		return;
+	}
+	
+	// multiply local matrices with rig local matrices in one batch
+	pLocalMatrices.SetCountDiscard(count);
+	pRigLocalMatrices.SetCountDiscard(count);
+	
+	pStates.VisitIndexed([&](int i, dearBoneState &state){
+		state.UpdateLocalMatrices();
+		pLocalMatrices[i] = state.GetLocalMatrix();
+		pRigLocalMatrices[i] = state.GetRigLocalMatrix();
 	});
+	
+	decMathBatch::QuickMultiply(pLocalMatrices.GetArrayPointer(),
+		pRigLocalMatrices.GetArrayPointer(), pLocalMatrices.GetArrayPointer(), count);
+	
+	// global matrices require parent global matrices to be updated first
+	int i;
+	for(i=0; i<count; i++){
+		pUpdateGlobalMatrices(i);
+	}
 }
 
 void dearBoneStateList::MarkDirty(){
@@ -433,3 +454,22 @@ deAnimatorRule::eBlendModes blendMode, float blendFactor) const{
 		boneState.SetScale(scale);
 	});
 }
+
+
+
+// Private Functions
+//////////////////////
+
+void dearBoneStateList::pUpdateGlobalMatrices(int index){
+	dearBoneState &state = pStates[index];
+	if(!state.GetDirty()){
+		return;
+	}
+	
+	const dearBoneState * const parentState = state.GetParentState();
+	if(parentState && parentState->GetDirty()){
+		pUpdateGlobalMatrices(parentState->GetIndex());
+	}
+	
+	state.UpdateGlobalMatrices(pLocalMatrices[index]);
+}
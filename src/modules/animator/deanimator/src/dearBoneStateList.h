@@ -43,6 +43,8 @@ class deAnimator;
 class dearBoneStateList{
 private:
 	decTList<dearBoneState> pStates;
+	decTList<decMatrix> pLocalMatrices;
+	decTList<decMatrix> pRigLocalMatrices;
 	
 public:
 	/** \name Constructors and Destructors */
@@ -104,6 +106,9 @@ public:
 	/** Apply states to an animator module component. */
 	void ApplyToComponent(dearComponent &component, deAnimatorRule::eBlendModes blendMode, float blendFactor) const;
 	/*@}*/
+	
+private:
+	void pUpdateGlobalMatrices(int index);
 };
 
 // end of include only once
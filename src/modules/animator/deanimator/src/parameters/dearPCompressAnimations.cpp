@@ -0,0 +1,63 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "dearPCompressAnimations.h"
+#include "../deDEAnimator.h"
+
+#include <dragengine/common/exceptions.h>
+
+
+
+// class dearPCompressAnimations
+//////////////////////////////////
+
+// Constructor, destructor
+////////////////////////////
+
+dearPCompressAnimations::dearPCompressAnimations(deDEAnimator &animator) :
+dearParameterBool(animator)
+{
+	SetName("compressAnimations");
+	SetDescription("Store animations compressed in memory. Rotations, positions and scalings"
+		" are quantized and resampled at a fixed frame rate. Channels not changing over time"
+		" are stored only once. Reduces memory consumption of large animation libraries"
+		" considerably and improves sampling performance at the cost of a small loss of"
+		" precision. Applies only to animations loaded after changing the parameter.");
+	SetCategory(ecExpert);
+	SetDisplayName("Compress Animations");
+	SetDefaultValue("0");
+}
+
+
+
+// Parameter Value
+////////////////////
+
+bool dearPCompressAnimations::GetParameterBool(){
+	return pAnimator.GetCompressAnimations();
+}
+
+void dearPCompressAnimations::SetParameterBool(bool value){
+	pAnimator.SetCompressAnimations(value);
+}
@@ -1,7 +1,7 @@
 /*
  * MIT License
  *
- * Copyright (C) 2024, DragonDreams GmbH (info@dragondreams.ch)
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -22,32 +22,33 @@
  * SOFTWARE.
  */
 
-#ifndef _DEBPOCTREEVISITOR_H_
-#define _DEBPOCTREEVISITOR_H_
-
-class debpOctree;
+#ifndef _DEARPCOMPRESSANIMATIONS_H_
+#define _DEARPCOMPRESSANIMATIONS_H_
 
+#include "dearParameterBool.h"
 
 
 /**
- * @brief Generic Octree Node Visitor.
+ * Compress animations parameter.
  */
-class debpOctreeVisitor{
+class dearPCompressAnimations : public dearParameterBool{
 public:
-	/** @name Constructors and Destructors */
+	/** \name Constructors and Destructors */
 	/*@{*/
-	/** Creates a new octree node visitor. */
-	debpOctreeVisitor();
-	/** Cleans up the octree node visitor. */
-	virtual ~debpOctreeVisitor();
+	/** Create parameter. */
+	dearPCompressAnimations(deDEAnimator &animator);
 	/*@}*/
 	
-	/** @name Visiting */
+	
+	
+	/** \name Parameter Value */
 	/*@{*/
-	/** Visits an octree node. */
-	virtual void VisitNode(debpOctree *node, int intersection);
+	/** Current value. */
+	bool GetParameterBool() override;
+	
+	/** Set current value. */
+	void SetParameterBool(bool value) override;
 	/*@}*/
 };
 
-// end of include only once
 #endif
@@ -1,7 +1,7 @@
 /*
  * MIT License
  *
- * Copyright (C) 2024, DragonDreams GmbH (info@dragondreams.ch)
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -22,31 +22,20 @@
  * SOFTWARE.
  */
 
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-
-#include "debpOctreeVisitor.h"
+#include "dearParameter.h"
 
 #include <dragengine/common/exceptions.h>
 
 
-// Class debpOctreeVisitor
-///////////////////////////
+
+// class dearParameter
+////////////////////////
 
 // Constructor, destructor
 ////////////////////////////
 
-debpOctreeVisitor::debpOctreeVisitor(){
-}
-
-debpOctreeVisitor::~debpOctreeVisitor(){
+dearParameter::dearParameter(deDEAnimator &animator) : pAnimator(animator){
 }
 
-
-
-// Visiting
-/////////////
-
-void debpOctreeVisitor::VisitNode(debpOctree *node, int intersection){
+dearParameter::~dearParameter(){
 }
@@ -0,0 +1,89 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DEARPARAMETER_H_
+#define _DEARPARAMETER_H_
+
+#include <dragengine/common/collection/decTUniqueList.h>
+#include <dragengine/systems/modules/deModuleParameter.h>
+
+class deDEAnimator;
+
+
+/**
+ * Module parameter.
+ * 
+ * Base class for all animator parameters. Every parameter stores information about
+ * the parameter itself and provides methods to retrieves or alter the current value.
+ */
+class dearParameter : public deModuleParameter{
+public:
+	class List : public decTUniqueList<dearParameter>{
+	public:
+		using decTUniqueList<dearParameter>::decTUniqueList;
+		
+		dearParameter &GetNamed(const char *name) const{
+			dearParameter * const found = FindOrNull([&](const dearParameter &p){
+				return p.GetName() == name;
+			});
+			DEASSERT_NOTNULL(found)
+			return *found;
+		}
+		
+		int IndexOfNamed(const char *name) const{
+			return IndexOfMatching([&](const dearParameter &p){
+				return p.GetName() == name;
+			});
+		}
+	};
+	
+	
+protected:
+	deDEAnimator &pAnimator;
+	
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/** Create parameter. */
+	dearParameter(deDEAnimator &animator);
+	
+	/** Clean up parameter. */
+	virtual ~dearParameter();
+	/*@}*/
+	
+	
+	
+	/** \name Management */
+	/*@{*/
+	/** Current value. */
+	virtual decString GetParameterValue() = 0;
+	
+	/** Set current value. */
+	virtual void SetParameterValue(const char *value) = 0;
+	/*@}*/
+};
+
+#endif
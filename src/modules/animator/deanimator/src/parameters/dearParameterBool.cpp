@@ -0,0 +1,53 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "dearParameterBool.h"
+
+#include <dragengine/common/exceptions.h>
+
+
+
+// class dearParameterBool
+////////////////////////////
+
+// Constructor, destructor
+////////////////////////////
+
+dearParameterBool::dearParameterBool(deDEAnimator &animator) : dearParameter(animator){
+	SetType(eptBoolean);
+}
+
+
+
+// Parameter Value
+////////////////////
+
+decString dearParameterBool::GetParameterValue(){
+	return GetParameterBool() ? "1" : "0";
+}
+
+void dearParameterBool::SetParameterValue(const char *value){
+	const decString checkValue(decString(value).GetLower());
+	SetParameterBool(checkValue == "1" || checkValue == "true" || checkValue == "yes");
+}
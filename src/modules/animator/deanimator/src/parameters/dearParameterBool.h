@@ -1,7 +1,7 @@
 /*
  * MIT License
  *
- * Copyright (C) 2024, DragonDreams GmbH (info@dragondreams.ch)
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -22,33 +22,39 @@
  * SOFTWARE.
  */
 
-#ifndef _DEBPDOCTREEVISITOR_H_
-#define _DEBPDOCTREEVISITOR_H_
-
-class debpDOctree;
+#ifndef _DEARPARAMETERBOOL_H_
+#define _DEARPARAMETERBOOL_H_
 
+#include "dearParameter.h"
 
 
 /**
- * @brief Generic Octree Node Visitor.
- *
+ * Bool parameter.
  */
-class debpDOctreeVisitor{
+class dearParameterBool : public dearParameter{
 public:
-	/** @name Constructors and Destructors */
+	/** \name Constructors and Destructors */
 	/*@{*/
-	/** Creates a new octree node visitor. */
-	debpDOctreeVisitor();
-	/** Cleans up the octree node visitor. */
-	virtual ~debpDOctreeVisitor();
+	/** Create parameter. */
+	dearParameterBool(deDEAnimator &animator);
 	/*@}*/
 	
-	/** @name Visiting */
+	
+	
+	/** \name Parameter Value */
 	/*@{*/
-	/** Visits an octree node. */
-	virtual void VisitNode(debpDOctree *node, int intersection);
+	/** Current value. */
+	decString GetParameterValue() override;
+	
+	/** Set current value. */
+	void SetParameterValue(const char *value) override;
+	
+	/** Current value. */
+	virtual bool GetParameterBool() = 0;
+	
+	/** Set current value. */
+	virtual void SetParameterBool(bool value) = 0;
 	/*@}*/
 };
 
-// end of include only once
 #endif
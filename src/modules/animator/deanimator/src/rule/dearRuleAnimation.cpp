@@ -112,6 +112,13 @@ DEBUG_RESET_TIMERS;
 	const deAnimatorRule::eBlendModes blendMode = GetBlendMode();
 	const int boneCount = GetBoneMappingCount();
 	const int vpsCount = GetVPSMappingCount();
+	
+	if(pBoneKeyframeCursors.GetCount() != boneCount || pVPSKeyframeCursors.GetCount() != vpsCount){
+		pInitKeyframeCursors();
+	}
+	
+	int * const boneCursors = pBoneKeyframeCursors.GetArrayPointer();
+	int * const vpsCursors = pVPSKeyframeCursors.GetArrayPointer();
 	int i;
 	
 	const float moveTime = pMove->GetPlaytime() *
@@ -132,31 +139,15 @@ DEBUG_RESET_TIMERS;
 			boneState.BlendWithDefault(blendMode, blendFactor, pEnablePosition, pEnableOrientation, pEnableSize);
 			
 		}else{
-			// determine keyframe containing the move time
-			const dearAnimationKeyframeList &kflist = *pMove->GetKeyframeListAt(animationBone);
-			const dearAnimationKeyframe * const keyframe = kflist.GetWithTime(moveTime);
-			
-			// if there are no keyframes use the default state
-			if(!keyframe){
-				boneState.BlendWithDefault(blendMode, blendFactor, pEnablePosition, pEnableOrientation, pEnableSize);
-				continue;
-			}
-			
-			// calculate bone data
-			const float time = moveTime - keyframe->GetTime();
-			
+			// sample bone at the move time
 			decVector position;
 			decQuaternion orientation;
 			decVector scale(1.0f, 1.0f, 1.0f);
 			
-			if(pEnablePosition){
-				position = keyframe->InterpolatePosition(time);
-			}
-			if(pEnableOrientation){
-				orientation = keyframe->InterpolateRotation(time);
-			}
-			if(pEnableSize){
-				scale = keyframe->InterpolateScaling(time);
+			// if there are no keyframes use the default state
+			if(!pMove->SampleBone(animationBone, moveTime, boneCursors[i], position, orientation, scale)){
+				boneState.BlendWithDefault(blendMode, blendFactor, pEnablePosition, pEnableOrientation, pEnableSize);
+				continue;
 			}
 			
 			boneState.BlendWith(position, orientation, scale, blendMode,
@@ -181,7 +172,7 @@ DEBUG_RESET_TIMERS;
 		}else{
 			// determine keyframe containing the move time
 			const dearAnimationKeyframeVPSList &kflist = *pMove->GetKeyframeVPSListAt(animationVps);
-			const dearAnimationKeyframeVPS * const keyframe = kflist.GetWithTime(moveTime);
+			const dearAnimationKeyframeVPS * const keyframe = kflist.GetWithTime(moveTime, vpsCursors[i]);
 			
 			// if there are no keyframes use the default state
 			if(!keyframe){
@@ -205,6 +196,7 @@ void dearRuleAnimation::RuleChanged(){
 	pUpdateMove();
 	pMapAnimationBones.Init(*this);
 	pMapAnimationVPS.Init(*this);
+	pInitKeyframeCursors();
 }
 
 
@@ -220,3 +212,12 @@ void dearRuleAnimation::pUpdateMove(){
 		pMove = animation->GetMoves().FindNamed(pAnimation.GetMoveName());
 	}
 }
+
+void dearRuleAnimation::pInitKeyframeCursors(){
+	// one cursor per mapping. keeps looking up keyframes constant time while playing
+	pBoneKeyframeCursors.RemoveAll();
+	pBoneKeyframeCursors.AddRange(GetBoneMappingCount(), 0);
+	
+	pVPSKeyframeCursors.RemoveAll();
+	pVPSKeyframeCursors.AddRange(GetVPSMappingCount(), 0);
+}
@@ -46,6 +46,9 @@ private:
 	
 	dearControllerTarget pTargetMoveTime;
 	
+	decTList<int> pBoneKeyframeCursors;
+	decTList<int> pVPSKeyframeCursors;
+	
 	const bool pEnablePosition;
 	const bool pEnableOrientation;
 	const bool pEnableSize;
@@ -75,6 +78,7 @@ public:
 	
 private:
 	void pUpdateMove();
+	void pInitKeyframeCursors();
 };
 
 #endif
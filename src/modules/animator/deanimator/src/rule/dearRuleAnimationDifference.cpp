@@ -157,24 +157,21 @@ DEBUG_RESET_TIMERS;
 				continue;
 			}
 			
-			const dearAnimationKeyframeList &kfl1 = *pMove1->GetKeyframeListAt(animationBone);
-			const dearAnimationKeyframe * const kf1 = kfl1.GetWithTime(ltime);
-			if(kf1){
-				const float t = ltime - kf1->GetTime();
+			decVector position, scale;
+			decQuaternion orientation;
+			
+			if(pMove1->SampleBone(animationBone, ltime, position, orientation, scale)){
 				dearBoneState &sl = pStateListL->GetStateAt(animatorBone);
-				sl.SetPosition(kf1->InterpolatePosition(t));
-				sl.SetOrientation(kf1->InterpolateRotation(t));
-				sl.SetScale(kf1->InterpolateScaling(t));
+				sl.SetPosition(position);
+				sl.SetOrientation(orientation);
+				sl.SetScale(scale);
 			}
 			
-			const dearAnimationKeyframeList &kfl2 = *pMove2->GetKeyframeListAt(animationBone);
-			const dearAnimationKeyframe * const kf2 = kfl2.GetWithTime(rtime);
-			if(kf2){
-				const float t = rtime - kf2->GetTime();
+			if(pMove2->SampleBone(animationBone, rtime, position, orientation, scale)){
 				dearBoneState &sr = pStateListR->GetStateAt(animatorBone);
-				sr.SetPosition(kf2->InterpolatePosition(t));
-				sr.SetOrientation(kf2->InterpolateRotation(t));
-				sr.SetScale(kf2->InterpolateScaling(t));
+				sr.SetPosition(position);
+				sr.SetOrientation(orientation);
+				sr.SetScale(scale);
 			}
 		}
 		
@@ -263,46 +260,18 @@ DEBUG_RESET_TIMERS;
 			}
 			
 			// determine leading animation state
-			const dearAnimationKeyframeList &kflist1 = *pMove1->GetKeyframeListAt(animationBone);
-			const dearAnimationKeyframe * const keyframe1 = kflist1.GetWithTime(ltime);
-			
 			decVector lscale(1.0f, 1.0f, 1.0f);
 			decQuaternion lorientation;
 			decVector lposition;
 			
-			if(keyframe1){
-				const float time = ltime - keyframe1->GetTime();
-				if(pEnablePosition){
-					lposition = keyframe1->InterpolatePosition(time);
-				}
-				if(pEnableOrientation){
-					lorientation = keyframe1->InterpolateRotation(time);
-				}
-				if(pEnableSize){
-					lscale = keyframe1->InterpolateScaling(time);
-				}
-			}
+			pMove1->SampleBone(animationBone, ltime, lposition, lorientation, lscale);
 			
 			// determine reference animation state
-			const dearAnimationKeyframeList &kflist2 = *pMove2->GetKeyframeListAt(animationBone);
-			const dearAnimationKeyframe * const keyframe2 = kflist2.GetWithTime(rtime);
-			
 			decVector rscale(1.0f, 1.0f, 1.0f);
 			decQuaternion rorientation;
 			decVector rposition;
 			
-			if(keyframe2){
-				const float time = rtime - keyframe2->GetTime();
-				if(pEnablePosition){
-					rposition = keyframe2->InterpolatePosition(time);
-				}
-				if(pEnableOrientation){
-					rorientation = keyframe2->InterpolateRotation(time);
-				}
-				if(pEnableSize){
-					rscale = keyframe2->InterpolateScaling(time);
-				}
-			}
+			pMove2->SampleBone(animationBone, rtime, rposition, rorientation, rscale);
 			
 			// blend difference with current state
 			dearBoneState &boneState = stalist.GetStateAt(animatorBone);
@@ -155,31 +155,15 @@ DEBUG_RESET_TIMERS;
 			continue;
 		}
 		
-		// determine keyframe containing the move time
-		const dearAnimationKeyframeList &kflist = *move->GetKeyframeListAt(animationBone);
-		const dearAnimationKeyframe * const keyframe = kflist.GetWithTime(moveTime);
-		
-		// if there are no keyframes use the default state
-		if(!keyframe){
-			boneState.BlendWithDefault(blendMode, blendFactor, pEnablePosition, pEnableOrientation, pEnableSize);
-			continue;
-		}
-		
-		// calculate bone data
-		const float time = moveTime - keyframe->GetTime();
-		
+		// sample bone at the move time
 		decVector position;
 		decQuaternion orientation;
 		decVector scale(1.0f, 1.0f, 1.0f);
 		
-		if(pEnablePosition){
-			position = keyframe->InterpolatePosition(time);
-		}
-		if(pEnableOrientation){
-			orientation = keyframe->InterpolateRotation(time);
-		}
-		if(pEnableSize){
-			scale = keyframe->InterpolateScaling(time);
+		// if there are no keyframes use the default state
+		if(!move->SampleBone(animationBone, moveTime, position, orientation, scale)){
+			boneState.BlendWithDefault(blendMode, blendFactor, pEnablePosition, pEnableOrientation, pEnableSize);
+			continue;
 		}
 		
 		boneState.BlendWith(position, orientation, scale, blendMode,
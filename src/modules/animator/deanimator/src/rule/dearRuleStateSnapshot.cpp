@@ -295,22 +295,18 @@ void dearRuleStateSnapshot::StoreFrameInto(int identifier, const char *moveName,
 				continue;
 			}
 			
-			// determine keyframe containing the move time
-			const dearAnimationKeyframeList &kflist = *move->GetKeyframeListAt(animationBone);
-			const dearAnimationKeyframe * const keyframe = kflist.GetWithTime(moveTime);
+			// sample bone at the move time. if there are no keyframes use the default state
+			decVector position, scale;
+			decQuaternion orientation;
 			
-			// if there are no keyframes use the default state
-			if(!keyframe){
+			if(!move->SampleBone(animationBone, moveTime, position, orientation, scale)){
 				pAnimStates[i].Reset();
 				continue;
 			}
 			
-			// calculate bone data
-			const float time = moveTime - keyframe->GetTime();
-			
-			pAnimStates[i].SetPosition(keyframe->InterpolatePosition(time));
-			pAnimStates[i].SetOrientation(keyframe->InterpolateRotation(time));
-			pAnimStates[i].SetSize(keyframe->InterpolateScaling(time));
+			pAnimStates[i].SetPosition(position);
+			pAnimStates[i].SetOrientation(orientation);
+			pAnimStates[i].SetSize(scale);
 		}
 		
 		for(i=0; i<vpsCount; i++){
@@ -44,7 +44,11 @@ pFilename(filename),
 pArchivePosition(archivePosition),
 pFileSize((int)info.uncompressed_size),
 pCompressedSize((int)info.compressed_size),
-pReadBlockSize((int)pCompressedSize)
+pReadBlockSize((int)pCompressedSize),
+pStored(info.compression_method == 0 && (info.flag & 1) == 0
+	&& info.compressed_size == info.uncompressed_size),
+pDataOffset(0),
+pDataOffsetResolved(false)
 {
 	(void)pModule;
 	
@@ -56,7 +60,22 @@ pReadBlockSize((int)pCompressedSize)
 	time.SetMinute(info.tmu_date.tm_min);
 	time.SetSecond(info.tmu_date.tm_sec);
 	pModificationTime = time.ToSystemTime();
+	
+	if(info.compression_method == Z_DEFLATED && (info.flag & 1) == 0
+	&& pFileSize > decDeflateSeekIndex::DefaultSpan){
+		pSeekIndex = decDeflateSeekIndex::Ref::New();
+	}
 }
 
 deadArchiveFile::~deadArchiveFile(){
 }
+
+
+
+// Management
+///////////////
+
+void deadArchiveFile::SetDataOffset(uint64_t offset){
+	pDataOffset = offset;
+	pDataOffsetResolved = true;
+}
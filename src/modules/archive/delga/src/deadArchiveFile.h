@@ -28,6 +28,7 @@
 #include "unzip.h"
 
 #include <dragengine/deObject.h>
+#include <dragengine/common/file/decDeflateSeekIndex.h>
 #include <dragengine/common/file/decPath.h>
 #include <dragengine/common/string/decString.h>
 #include <dragengine/common/utils/decDateTime.h>
@@ -53,6 +54,10 @@ private:
 	TIME_SYSTEM pModificationTime;
 	int pCompressedSize;
 	int pReadBlockSize;
+	bool pStored;
+	uint64_t pDataOffset;
+	bool pDataOffsetResolved;
+	decDeflateSeekIndex::Ref pSeekIndex;
 	
 	
 	
@@ -89,6 +94,26 @@ public:
 	
 	/** \brief Read block size. */
 	inline int GetReadBlockSize() const{ return pReadBlockSize; }
+	
+	/** \brief File is stored without compression and encryption. */
+	inline bool GetStored() const{ return pStored; }
+	
+	/** \brief Offset of file data in archive or 0 if not known. */
+	inline uint64_t GetDataOffset() const{ return pDataOffset; }
+	
+	/** \brief Set offset of file data in archive or 0 if not known and mark it resolved. */
+	void SetDataOffset(uint64_t offset);
+	
+	/** \brief Offset of file data has been resolved. */
+	inline bool GetDataOffsetResolved() const{ return pDataOffsetResolved; }
+	
+	/**
+	 * \brief Seek index or nullptr.
+	 * 
+	 * Present for deflated files larger than the seek index span. Readers share the
+	 * index to seek inside the file without decompressing from the beginning.
+	 */
+	inline const decDeflateSeekIndex::Ref &GetSeekIndex() const{ return pSeekIndex; }
 	/*@}*/
 };
 
@@ -31,6 +31,9 @@
 #include "deadContextUnpack.h"
 
 #include <dragengine/common/exceptions.h>
+#include <dragengine/common/file/decDeflateFileReader.h>
+#include <dragengine/common/file/decDiskFileReader.h>
+#include <dragengine/common/file/decMappedFileReader.h>
 #include <dragengine/common/file/decWeakFileReader.h>
 #include <dragengine/common/file/decWeakFileWriter.h>
 #include <dragengine/resources/archive/deArchive.h>
@@ -55,6 +58,8 @@ pFilename(reader.GetFilename())
 	deadContextUnpack *context = nullptr;
 	
 	try{
+		pMapArchive(reader);
+		
 		context = AcquireContextUnpack();
 		pArchiveDirectory = context->ReadFileTable();
 		ReleaseContextUnpack(context);
@@ -131,11 +136,28 @@ bool deadContainer::CanDeleteFile(const decPath &){
 }
 
 decBaseFileReader::Ref deadContainer::OpenFileForReading(const decPath &path){
-	const deadArchiveFile * const file = pArchiveDirectory->GetFileByPath(path);
+	deadArchiveFile * const file = pArchiveDirectory->GetFileByPath(path);
 	if(!file){
 		DETHROW(deeFileNotFound);
 	}
 	
+	// the data offset is resolved on first use. resolving it while reading the file
+	// table would touch the local header of every file in the archive
+	if((file->GetStored() && pMappedFile) || file->GetSeekIndex()){
+		const uint64_t dataOffset = pGetDataOffset(*file);
+		
+		// stored files are read straight from the mapped archive without unpacking
+		if(file->GetStored() && dataOffset != 0){
+			return decMappedFileReader::Ref::New(pMappedFile, file->GetFilename(),
+				file->GetModificationTime(), dataOffset, file->GetFileSize());
+		}
+		
+		// large deflated files are inflated using the seek index of the file
+		if(file->GetSeekIndex() && dataOffset != 0){
+			return pOpenFileSeekIndex(*file, dataOffset);
+		}
+	}
+	
 	deadContextUnpack * const context = AcquireContextUnpack();
 	
 	try{
@@ -218,6 +240,71 @@ TIME_SYSTEM deadContainer::GetFileModificationTime(const decPath &path){
 // Private Functions
 //////////////////////
 
+void deadContainer::pMapArchive(decBaseFileReader &reader){
+	// only archives located on disk can be mapped. if mapping fails the archive is
+	// read using unpacking contexts only
+	if(!dynamic_cast<decDiskFileReader*>(&reader)){
+		return;
+	}
+	
+	try{
+		pMappedFile = decMappedFile::Ref::New(pFilename);
+		
+	}catch(const deException &e){
+		pModule.LogInfoFormat("Archive %s: Memory mapping failed, reading stored files unpacking",
+			pFilename.GetString());
+		pModule.LogException(e);
+	}
+}
+
+uint64_t deadContainer::pGetDataOffset(deadArchiveFile &file){
+	{
+	const deMutexGuard guard(pMutex);
+	if(file.GetDataOffsetResolved()){
+		return file.GetDataOffset();
+	}
+	}
+	
+	// two threads resolving the same file concurrently find the same offset
+	deadContextUnpack * const context = AcquireContextUnpack();
+	uint64_t dataOffset;
+	
+	try{
+		dataOffset = context->FindDataOffset(file);
+		
+	}catch(const deException &){
+		ReleaseContextUnpack(context);
+		throw;
+	}
+	
+	ReleaseContextUnpack(context);
+	
+	const deMutexGuard guard(pMutex);
+	file.SetDataOffset(dataOffset);
+	return dataOffset;
+}
+
+decBaseFileReader::Ref deadContainer::pOpenFileSeekIndex(
+const deadArchiveFile &file, uint64_t dataOffset){
+	decBaseFileReader::Ref reader;
+	int offset;
+	
+	if(pMappedFile){
+		reader = decMappedFileReader::Ref::New(pMappedFile, file.GetFilename(),
+			file.GetModificationTime(), dataOffset, file.GetCompressedSize());
+		offset = 0;
+		
+	}else{
+		const deMutexGuard guard(pMutex);
+		reader = GetReader()->Duplicate();
+		offset = (int)dataOffset;
+	}
+	
+	return decDeflateFileReader::Ref::New(reader, file.GetFilename(),
+		file.GetModificationTime(), offset, file.GetCompressedSize(),
+		file.GetFileSize(), file.GetSeekIndex());
+}
+
 void deadContainer::pCleanUp(){
 	const int count = pContextsUnpack.GetCount();
 	int i;
@@ -28,6 +28,7 @@
 #include "deadArchiveDirectory.h"
 
 #include <dragengine/common/collection/decTList.h>
+#include <dragengine/common/file/decMappedFile.h>
 #include <dragengine/common/string/decString.h>
 #include <dragengine/systems/modules/archive/deBaseArchiveContainer.h>
 #include <dragengine/threading/deMutex.h>
@@ -35,6 +36,7 @@
 
 class deArchiveDelga;
 class deadContextUnpack;
+class deadArchiveFile;
 
 
 
@@ -47,6 +49,7 @@ private:
 	
 	decString pFilename;
 	deadArchiveDirectory::Ref pArchiveDirectory;
+	decMappedFile::Ref pMappedFile;
 	
 	decTList<deadContextUnpack*> pContextsUnpack;
 	decTList<deadContextUnpack*> pContextsUnpackFree;
@@ -76,6 +79,14 @@ public:
 	/** \brief Archive root directory. */
 	inline const deadArchiveDirectory::Ref &GetArchiveDirectory() const{ return pArchiveDirectory; }
 	
+	/**
+	 * \brief Memory mapped archive or nullptr if not mapped.
+	 * 
+	 * Archives are mapped if they are located on disk. Stored files are then read
+	 * directly from the mapped memory.
+	 */
+	inline const decMappedFile::Ref &GetMappedFile() const{ return pMappedFile; }
+	
 	/** \brief Acquire next free unpacking context. */
 	deadContextUnpack *AcquireContextUnpack();
 	
@@ -177,6 +188,9 @@ public:
 	
 	
 private:
+	void pMapArchive(decBaseFileReader &reader);
+	uint64_t pGetDataOffset(deadArchiveFile &file);
+	decBaseFileReader::Ref pOpenFileSeekIndex(const deadArchiveFile &file, uint64_t dataOffset);
 	void pCleanUp();
 };
 
@@ -302,7 +302,8 @@ deadArchiveDirectory::Ref deadContextUnpack::ReadFileTable(){
 				DETHROW_INFO(deeReadFile, filename);
 			}
 			
-			directory->AddFile(deadArchiveFile::Ref::New(pModule, archivePath.GetLastComponent(), info, archivePosition));
+			directory->AddFile(deadArchiveFile::Ref::New(
+				pModule, archivePath.GetLastComponent(), info, archivePosition));
 		}
 		
 		error = unzGoToNextFile(pZipFile);
@@ -313,3 +314,37 @@ deadArchiveDirectory::Ref deadContextUnpack::ReadFileTable(){
 	
 	return archiveDirectory;
 }
+
+
+uint64_t deadContextUnpack::FindDataOffset(const deadArchiveFile &file){
+	DEASSERT_FALSE(pZipFileOpen)
+	DEASSERT_NOTNULL(pContainer)
+	DEASSERT_NOTNULL(pReader)
+	
+	// opening the file reads the local header which is required to locate the data.
+	// the data position is only used if it is inside the archive
+	unz_file_pos archivePosition(file.GetArchivePosition());
+	if(unzGoToFilePos(pZipFile, &archivePosition) != UNZ_OK){
+		DETHROW_INFO(deeReadFile, file.GetFilename());
+	}
+	
+	if(unzOpenCurrentFile(pZipFile) != UNZ_OK){
+		DETHROW_INFO(deeReadFile, file.GetFilename());
+	}
+	
+	const uint64_t offset = (uint64_t)unzGetCurrentFileZStreamPos64(pZipFile);
+	unzCloseCurrentFile(pZipFile);
+	
+	const uint64_t size = (uint64_t)file.GetCompressedSize();
+	uint64_t length;
+	
+	if(pContainer->GetMappedFile()){
+		length = pContainer->GetMappedFile()->GetLength();
+		
+	}else{
+		// without mapping the archive reader is used which supports only int positions
+		length = (uint64_t)pReader->GetLength();
+	}
+	
+	return offset > 0 && offset <= length && size <= length - offset ? offset : 0;
+}
@@ -132,6 +132,14 @@ public:
 	
 	/** Read file table. */
 	deadArchiveDirectory::Ref ReadFileTable();
+	
+	/**
+	 * Find offset of file data in archive.
+	 * 
+	 * Reads the local header of the file. Returns 0 if the data is not located inside
+	 * the archive.
+	 */
+	uint64_t FindDataOffset(const deadArchiveFile &file);
 	/*@}*/
 };
 
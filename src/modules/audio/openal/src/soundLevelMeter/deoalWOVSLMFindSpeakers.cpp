@@ -28,7 +28,6 @@
 
 #include "deoalWOVSLMFindSpeakers.h"
 #include "deoalASoundLevelMeter.h"
-#include "../world/octree/deoalWorldOctree.h"
 #include "../speaker/deoalASpeaker.h"
 #include "../speaker/deoalSpeakerList.h"
 #include "../world/deoalAWorld.h"
@@ -47,10 +46,7 @@ deoalWOVSLMFindSpeakers::deoalWOVSLMFindSpeakers(
 const deoalASoundLevelMeter &soundLevelMeter, deoalSpeakerList &list) :
 pSoundLevelMeter(soundLevelMeter),
 pRangeSquared(soundLevelMeter.GetAudibleDistance() * soundLevelMeter.GetAudibleDistance()),
-pList(list)
-{
-	SetVisitAll(false);
-	SetVisitSpeakers(true);
+pList(list){
 }
 
 deoalWOVSLMFindSpeakers::~deoalWOVSLMFindSpeakers(){
@@ -65,27 +61,23 @@ void deoalWOVSLMFindSpeakers::Visit(deoalAWorld &world){
 	const double audibleDistance = pSoundLevelMeter.GetAudibleDistance();
 	const decDVector &position = pSoundLevelMeter.GetPosition();
 	const decDVector radius(audibleDistance, audibleDistance, audibleDistance);
-	world.GetOctree()->VisitNodesColliding(this, position - radius, position + radius);
+	
+	decTList<int> elements;
+	world.GetSpeakerIndex().QueryBox(position - radius, position + radius, elements);
+	elements.Visit([&](int element){
+		VisitSpeaker(world.GetIndexedSpeakerAt(element));
+	});
 }
 
 
 
-void deoalWOVSLMFindSpeakers::VisitNode(deoalDOctree *node, int){
-	const deoalWorldOctree &sonode = *((deoalWorldOctree*)node);
-	const decLayerMask &layerMask = pSoundLevelMeter.GetLayerMask();
-	const decDVector &position = pSoundLevelMeter.GetPosition();
-	const int count = sonode.GetSpeakerCount();
-	int i;
-	
-	for(i=0; i<count; i++){
-		deoalASpeaker * const speaker = sonode.GetSpeakerAt(i);
-		if(speaker->GetLayerMask().MatchesNot(layerMask)){
-			continue;
-		}
-		if((speaker->GetPosition() - position).LengthSquared() > pRangeSquared){
-			continue;
-		}
-		
-		pList.Add(speaker);
+void deoalWOVSLMFindSpeakers::VisitSpeaker(deoalASpeaker *speaker){
+	if(speaker->GetLayerMask().MatchesNot(pSoundLevelMeter.GetLayerMask())){
+		return;
 	}
+	if((speaker->GetPosition() - pSoundLevelMeter.GetPosition()).LengthSquared() > pRangeSquared){
+		return;
+	}
+	
+	pList.Add(speaker);
 }
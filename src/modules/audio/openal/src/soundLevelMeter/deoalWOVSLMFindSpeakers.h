@@ -25,20 +25,21 @@
 #ifndef _DEOALWOVSLMFINDSPEAKERS_H_
 #define _DEOALWOVSLMFINDSPEAKERS_H_
 
-#include "../world/octree/deoalWorldOctreeVisitor.h"
-
 #include <dragengine/common/math/decMath.h>
 #include <dragengine/common/utils/decLayerMask.h>
 
 class deoalAWorld;
 class deoalSpeakerList;
 class deoalASoundLevelMeter;
+class deoalASpeaker;
 
 
 /**
- * \brief World octree visitor finding speakers for sound level meters.
+ * \brief World visitor finding speakers for sound level meters.
+ * 
+ * Speakers are found using the world speaker index.
  */
-class deoalWOVSLMFindSpeakers : public deoalWorldOctreeVisitor{
+class deoalWOVSLMFindSpeakers{
 private:
 	const deoalASoundLevelMeter &pSoundLevelMeter;
 	double pRangeSquared;
@@ -53,7 +54,7 @@ public:
 	deoalWOVSLMFindSpeakers(const deoalASoundLevelMeter &soundLevelMeter, deoalSpeakerList &list);
 	
 	/** \brief Clean up visitor. */
-	~deoalWOVSLMFindSpeakers() override;
+	~deoalWOVSLMFindSpeakers();
 	/*@}*/
 	
 	
@@ -65,8 +66,8 @@ public:
 	
 	
 	
-	/** \brief Visits components affecting sound hit by ray. */
-	void VisitNode(deoalDOctree *node, int intersection) override;
+	/** \brief Visit speaker. */
+	void VisitSpeaker(deoalASpeaker *speaker);
 	/*@}*/
 };
 
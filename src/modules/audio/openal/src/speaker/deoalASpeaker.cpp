@@ -51,7 +51,6 @@
 #include "../video/deoalAVideoPlayer.h"
 #include "../video/deoalVideoPlayer.h"
 #include "../world/deoalAWorld.h"
-#include "../world/octree/deoalWorldOctree.h"
 
 #include <dragengine/deEngine.h>
 #include <dragengine/common/exceptions.h>
@@ -80,7 +79,7 @@ pBackLink(nullptr),
 
 pParentWorld(nullptr),
 pParentMicrophone(nullptr),
-pOctreeNode(nullptr),
+pSpeakerIndexElement(-1),
 pSourceUpdateTracker(0),
 pSpeakerType(deSpeaker::estPoint),
 pPositionless(true),
@@ -517,7 +516,7 @@ void deoalASpeaker::PrepareQuickDispose(){
 	
 	pParentMicrophone = nullptr;
 	pParentWorld = nullptr;
-	pOctreeNode = nullptr;
+	pSpeakerIndexElement = -1;
 }
 
 
@@ -532,7 +531,7 @@ void deoalASpeaker::SetEnabled(bool enabled){
 	
 	pDirtyPlayState = true;
 	
-	UpdateOctreeNode();
+	UpdateSpeakerIndex();
 }
 
 void deoalASpeaker::SetPositionless(bool positionless){
@@ -549,7 +548,7 @@ void deoalASpeaker::SetPositionless(bool positionless){
 		pDirtyGain = true;
 	}
 	
-	UpdateOctreeNode();
+	UpdateSpeakerIndex();
 	pEnsureEnvironment();
 }
 
@@ -566,8 +565,8 @@ void deoalASpeaker::SetParentWorld(deoalAWorld *world){
 	
 	DEASSERT_NULL_IF(world, pParentMicrophone)
 	
-	if(pOctreeNode){
-		pOctreeNode->RemoveSpeaker(this);
+	if(pParentWorld){
+		pParentWorld->RemoveSpeakerFromIndex(*this);
 	}
 	pRemoveFromSoundLevelMeters();
 	
@@ -597,24 +596,24 @@ void deoalASpeaker::SetParentMicrophone(deoalAMicrophone *microphone){
 	pRestart = true;
 }
 
-void deoalASpeaker::SetOctreeNode(deoalWorldOctree *node){
-	pOctreeNode = node;
+void deoalASpeaker::SetSpeakerIndexElement(int element){
+	pSpeakerIndexElement = element;
 }
 
-void deoalASpeaker::UpdateOctreeNode(){
+void deoalASpeaker::UpdateSpeakerIndex(){
 	// NOTE
 	// - enabled: set by microphone for all speakers that can affect a microphone.
 	//            for SLM this is incorrect since it operates on speakers independently
 	// - source: available only if speaker is enabled in a microphone and not muted for
 	//           performance or other reasons. also something we can not use for SLM
 	
-// 	pAudioThread.GetLogger().LogInfoFormat( "UpdateOctreeNode: %p %p %d %p %d", this, pParentWorld, pEnabled, pSource, GetPlaying() );
+// 	pAudioThread.GetLogger().LogInfoFormat( "UpdateSpeakerIndex: %p %p %d %p %d", this, pParentWorld, pEnabled, pSource, GetPlaying() );
 // 	if( pParentWorld && pEnabled && pSource && ! pPositionless && ! pMuted && GetPlaying() ){
 	if(pParentWorld && !pPositionless && !pMuted && GetPlaying()){
-		pParentWorld->GetOctree()->InsertSpeakerIntoTree(this, 8);
+		pParentWorld->UpdateSpeakerIndex(*this);
 		
-	}else if(pOctreeNode){
-		pOctreeNode->RemoveSpeaker(this);
+	}else if(pParentWorld){
+		pParentWorld->RemoveSpeakerFromIndex(*this);
 	}
 }
 
@@ -43,7 +43,6 @@ class deoalAudioThread;
 class deoalAMicrophone;
 class deoalSource;
 class deoalAWorld;
-class deoalWorldOctree;
 class deoalEnvironment;
 class deoalSpeaker;
 class deoalSharedEffectSlot;
@@ -61,7 +60,7 @@ private:
 	
 	deoalAWorld *pParentWorld;
 	deoalAMicrophone *pParentMicrophone;
-	deoalWorldOctree *pOctreeNode;
+	int pSpeakerIndexElement;
 	
 	deoalASound::Ref pSound;
 	deoalASynthesizerInstance::Ref pSynthesizer;
@@ -333,14 +332,14 @@ public:
 	/** Set parent microphone or \em NULL. */
 	void SetParentMicrophone(deoalAMicrophone *microphone);
 	
-	/** World octree node or NULL. */
-	inline deoalWorldOctree *GetOctreeNode() const{ return pOctreeNode; }
+	/** Element in parent world speaker index or -1. */
+	inline int GetSpeakerIndexElement() const{ return pSpeakerIndexElement; }
 	
-	/** Set world octree node or NULL. */
-	void SetOctreeNode(deoalWorldOctree *node);
+	/** Set element in parent world speaker index or -1. */
+	void SetSpeakerIndexElement(int element);
 	
-	/** Update octree node. */
-	void UpdateOctreeNode();
+	/** Update parent world speaker index. */
+	void UpdateSpeakerIndex();
 	
 	
 	
@@ -71,7 +71,7 @@ pSynthesizerUpdateTracker(0),
 
 pDirtySpeaker(true),
 pDirtyGeometry(true),
-pDirtyOctreeNode(true),
+pDirtySpeakerIndex(true),
 pDirtySource(true),
 pDirtySoundDecoder(true),
 pDirtyVelocity(true),
@@ -113,7 +113,7 @@ void deoalSpeaker::SetParentWorld(deoalWorld *world){
 	
 	pParentWorld = world;
 	
-	pDirtyOctreeNode = true;
+	pDirtySpeakerIndex = true;
 }
 
 void deoalSpeaker::SetParentMicrophone(deoalMicrophone *microphone){
@@ -248,9 +248,9 @@ void deoalSpeaker::Synchronize(){
 		pDirtyLayerMask = false;
 	}
 	
-	if(pDirtyOctreeNode){
-		pASpeaker->UpdateOctreeNode();
-		pDirtyOctreeNode = false;
+	if(pDirtySpeakerIndex){
+		pASpeaker->UpdateSpeakerIndex();
+		pDirtySpeakerIndex = false;
 	}
 	
 	// force synchronization the next time if playing non-looping. this is required since
@@ -297,21 +297,21 @@ void deoalSpeaker::SourceChanged(){
 	pDirtySource = true;
 	pDirtyPlayRange = true;
 	pDirtySoundDecoder = true;
-	pDirtyOctreeNode = true;
+	pDirtySpeakerIndex = true;
 	
 	pRequiresSync();
 }
 
 void deoalSpeaker::PositionChanged(){
 	pDirtyGeometry = true;
-	pDirtyOctreeNode = true;
+	pDirtySpeakerIndex = true;
 	
 	pRequiresSync();
 }
 
 void deoalSpeaker::OrientationChanged(){
 	pDirtyGeometry = true;
-	pDirtyOctreeNode = true;
+	pDirtySpeakerIndex = true;
 	
 	pRequiresSync();
 }
@@ -354,7 +354,7 @@ void deoalSpeaker::VolumeChanged(){
 
 void deoalSpeaker::RangeChanged(){
 	pDirtyAttenuation = true;
-	pDirtyOctreeNode = true;
+	pDirtySpeakerIndex = true;
 	pDirtyRange = true;
 	
 	pRequiresSync();
@@ -380,7 +380,7 @@ void deoalSpeaker::LayerMaskChanged(){
 
 void deoalSpeaker::PlayStateChanged(){
 	pDirtySpeaker = true;
-	pDirtyOctreeNode = true;
+	pDirtySpeakerIndex = true;
 	
 	pRequiresSync();
 }
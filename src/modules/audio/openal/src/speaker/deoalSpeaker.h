@@ -61,7 +61,7 @@ private:
 	
 	bool pDirtySpeaker;
 	bool pDirtyGeometry;
-	bool pDirtyOctreeNode;
+	bool pDirtySpeakerIndex;
 	bool pDirtySource;
 	bool pDirtySoundDecoder;
 	bool pDirtyVelocity;
@@ -258,6 +258,48 @@ void deoalAWorld::RemoveRemovalMarkedSpeakers(){
 	});
 }
 
+void deoalAWorld::UpdateSpeakerIndex(deoalASpeaker &speaker){
+	// WARNING Called during synchronization time from main thread.
+	
+	const double range = speaker.GetRange();
+	const decDVector &position = speaker.GetPosition();
+	const decDVector halfExtends(range, range, range);
+	
+	if(speaker.GetSpeakerIndexElement() != -1){
+		pSpeakerIndex.Move(speaker.GetSpeakerIndexElement(), position - halfExtends, position + halfExtends);
+		return;
+	}
+	
+	const int element = pSpeakerIndex.Insert(position - halfExtends, position + halfExtends);
+	if(element == pIndexedSpeakers.GetCount()){
+		pIndexedSpeakers.Add(&speaker);
+		
+	}else{
+		pIndexedSpeakers.SetAt(element, &speaker);
+	}
+	speaker.SetSpeakerIndexElement(element);
+}
+
+void deoalAWorld::RemoveSpeakerFromIndex(deoalASpeaker &speaker){
+	// WARNING Called during synchronization time from main thread.
+	
+	const int element = speaker.GetSpeakerIndexElement();
+	if(element == -1){
+		return;
+	}
+	
+	pSpeakerIndex.Remove(element);
+	speaker.SetSpeakerIndexElement(-1);
+	
+	// removing the last element restarts element numbering
+	if(pSpeakerIndex.GetElementCount() == 0){
+		pIndexedSpeakers.RemoveAll();
+		
+	}else{
+		pIndexedSpeakers.SetAt(element, nullptr);
+	}
+}
+
 
 
 // Microphones
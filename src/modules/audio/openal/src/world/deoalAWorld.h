@@ -27,7 +27,9 @@
 
 #include <dragengine/deObject.h>
 #include <dragengine/common/collection/decTLinkedList.h>
+#include <dragengine/common/collection/decTList.h>
 #include <dragengine/common/math/decMath.h>
+#include <dragengine/common/math/decSpatialIndex.h>
 #include <dragengine/common/utils/decLayerMask.h>
 
 class deoalAudioThread;
@@ -52,6 +54,8 @@ private:
 	decTObjectLinkedList<deoalASoundLevelMeter> pSoundLevelMeters;
 	
 	deoalWorldOctree *pOctree;
+	decSpatialIndex pSpeakerIndex;
+	decTList<deoalASpeaker*> pIndexedSpeakers;
 	decLayerMask pAllMicLayerMask;
 	float pSpeakerGain;
 	
@@ -190,6 +194,29 @@ public:
 	 * \warning Called during synchronization time from main thread.
 	 */
 	void RemoveRemovalMarkedSpeakers();
+	
+	/**
+	 * Speaker spatial index.
+	 * 
+	 * Elements are boxes enclosing the speaker range. Use GetIndexedSpeakerAt() to obtain
+	 * the speaker for found elements.
+	 */
+	inline const decSpatialIndex &GetSpeakerIndex() const{ return pSpeakerIndex; }
+	
+	/** Speaker for speaker index element. */
+	inline deoalASpeaker *GetIndexedSpeakerAt(int element) const{ return pIndexedSpeakers.GetAt(element); }
+	
+	/**
+	 * Add speaker to speaker index or update it if present.
+	 * \warning Called during synchronization time from main thread.
+	 */
+	void UpdateSpeakerIndex(deoalASpeaker &speaker);
+	
+	/**
+	 * Remove speaker from speaker index if present.
+	 * \warning Called during synchronization time from main thread.
+	 */
+	void RemoveSpeakerFromIndex(deoalASpeaker &speaker);
 	/*@}*/
 	
 	
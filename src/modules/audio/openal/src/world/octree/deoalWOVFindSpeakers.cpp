@@ -26,7 +26,6 @@
 #include <stdlib.h>
 #include <string.h>
 
-#include "deoalWorldOctree.h"
 #include "deoalWOVFindSpeakers.h"
 #include "../deoalAWorld.h"
 #include "../../speaker/deoalASpeaker.h"
@@ -45,10 +44,7 @@ deoalWOVFindSpeakers::deoalWOVFindSpeakers(const decDVector &position,
 	const decLayerMask &layerMask, deoalSpeakerList &speakerList) :
 pPosition(position),
 pLayerMask(layerMask),
-pSpeakerList(speakerList)
-{
-	SetVisitAll(false);
-	SetVisitSpeakers(true);
+pSpeakerList(speakerList){
 }
 
 deoalWOVFindSpeakers::~deoalWOVFindSpeakers(){
@@ -68,7 +64,11 @@ const decLayerMask &layerMask, deoalSpeakerList &speakerList){
 	const decDVector visitBoxMin(position - visitRangeVector);
 	const decDVector visitBoxMax(position + visitRangeVector);
 	
-	world.GetOctree()->VisitNodesColliding(&visitor, visitBoxMin, visitBoxMax);
+	decTList<int> elements;
+	world.GetSpeakerIndex().QueryBox(visitBoxMin, visitBoxMax, elements);
+	elements.Visit([&](int element){
+		visitor.VisitSpeaker(world.GetIndexedSpeakerAt(element));
+	});
 }
 
 
@@ -27,21 +27,21 @@
 
 #include <dragengine/common/math/decMath.h>
 
-#include "deoalWorldOctreeVisitor.h"
 #include "../../speaker/deoalSpeakerList.h"
 
 
 class deoalSpeakerList;
 class decLayerMask;
 class deoalAWorld;
+class deoalASpeaker;
 
 
 /**
- * \brief World octree visitor searching for speakers.
+ * \brief World visitor searching for speakers.
  * 
- * Found speakers are added to speaker list.
+ * Speakers are found using the world speaker index. Found speakers are added to speaker list.
  */
-class deoalWOVFindSpeakers : public deoalWorldOctreeVisitor{
+class deoalWOVFindSpeakers{
 private:
 	const decDVector &pPosition;
 	const decLayerMask &pLayerMask;
@@ -57,7 +57,7 @@ public:
 		deoalSpeakerList &speakerList);
 	
 	/** \brief Clean up visitor. */
-	~deoalWOVFindSpeakers() override;
+	~deoalWOVFindSpeakers();
 	/*@}*/
 	
 	
@@ -82,7 +82,7 @@ public:
 	
 	
 	/** \brief Visit speaker. */
-	void VisitSpeaker(deoalASpeaker *speaker) override;
+	void VisitSpeaker(deoalASpeaker *speaker);
 	/*@}*/
 };
 
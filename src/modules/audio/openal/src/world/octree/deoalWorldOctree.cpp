@@ -32,7 +32,6 @@
 #include "../../component/deoalAComponent.h"
 #include "../../environment/deoalEnvProbe.h"
 #include "../../microphone/deoalAMicrophone.h"
-#include "../../speaker/deoalASpeaker.h"
 #include "../../soundLevelMeter/deoalASoundLevelMeter.h"
 #include "../../utils/collision/deoalDCollisionBox.h"
 #include "../../utils/collision/deoalDCollisionVolume.h"
@@ -101,7 +100,6 @@ void deoalWorldOctree::ClearNodeContent(){
 	RemoveAllSoundLevelMeters();
 	RemoveAllMicrophones();
 	RemoveAllComponents();
-	RemoveAllSpeakers();
 	RemoveAllEnvProbes();
 }
 
@@ -129,18 +127,6 @@ void deoalWorldOctree::ClearMicrophones(){
 	}
 }
 
-void deoalWorldOctree::ClearSpeakers(){
-	RemoveAllSpeakers();
-	
-	int i;
-	for(i=0; i<8; i++){
-		deoalDOctree * const node = GetNodeAt(i);
-		if(node){
-			((deoalWorldOctree*)node)->ClearSpeakers();
-		}
-	}
-}
-
 void deoalWorldOctree::ClearEnvProbes(){
 	RemoveAllEnvProbes();
 	
@@ -167,7 +153,6 @@ void deoalWorldOctree::ClearSoundLevelMeters(){
 
 void deoalWorldOctree::ClearAll(){
 	ClearComponents();
-	ClearSpeakers();
 	ClearMicrophones();
 	ClearEnvProbes();
 	ClearSoundLevelMeters();
@@ -229,34 +214,6 @@ void deoalWorldOctree::InsertMicrophoneIntoTree(deoalAMicrophone *microphone, in
 	}
 }
 
-void deoalWorldOctree::InsertSpeakerIntoTree(deoalASpeaker *speaker, int maxDepth){
-	if(!speaker || maxDepth < 0){
-		DETHROW(deeInvalidParam);
-	}
-	
-	const double range = speaker->GetRange();
-	const decDVector &position = speaker->GetPosition();
-	const decDVector halfExtends(range, range, range);
-	
-	deoalWorldOctree *currentNode = speaker->GetOctreeNode();
-	
-	// if speaker is already in the octree relocate it if required
-	if(currentNode){
-		// if speaker is not in the same node as before relocate it
-		if(!currentNode->ContainsBox(position, halfExtends)){
-			// remove from the current node
-			currentNode->RemoveSpeaker(speaker);
-			currentNode = nullptr;
-		}
-	}
-	
-	// add speaker if not in tree
-	if(!currentNode){
-		currentNode = pGetNodeFor(position, halfExtends, maxDepth);
-		currentNode->AddSpeaker(speaker);
-	}
-}
-
 void deoalWorldOctree::InsertEnvProbeIntoTree(deoalEnvProbe *envProbe, int maxDepth){
 	if(!envProbe || maxDepth < 0){
 		DETHROW(deeInvalidParam);
@@ -395,46 +352,6 @@ void deoalWorldOctree::RemoveAllMicrophones(){
 
 
 
-// Speakers
-/////////////
-
-int deoalWorldOctree::GetSpeakerCount() const{
-	return pSpeakers.GetCount();
-}
-
-deoalASpeaker *deoalWorldOctree::GetSpeakerAt(int index) const{
-	return pSpeakers.GetAt(index);
-}
-
-int deoalWorldOctree::IndexOfSpeaker(deoalASpeaker *speaker) const{
-	return pSpeakers.IndexOf(speaker);
-}
-
-void deoalWorldOctree::AddSpeaker(deoalASpeaker *speaker){
-	if(!speaker || speaker->GetOctreeNode()){
-		DETHROW(deeInvalidParam);
-	}
-	
-	pSpeakers.Add(speaker);
-	speaker->SetOctreeNode(this);
-}
-
-void deoalWorldOctree::RemoveSpeaker(deoalASpeaker *speaker){
-	pSpeakers.RemoveFrom(pSpeakers.IndexOf(speaker));
-	speaker->SetOctreeNode(nullptr);
-}
-
-void deoalWorldOctree::RemoveAllSpeakers(){
-	int count = pSpeakers.GetCount();
-	while(count > 0){
-		count--;
-		pSpeakers.GetAt(count)->SetOctreeNode(nullptr);
-	}
-	pSpeakers.RemoveAll();
-}
-
-
-
 // EnvProbes
 //////////////
 
@@ -29,7 +29,6 @@
 
 #include <dragengine/common/collection/decTList.h>
 
-class deoalASpeaker;
 class deoalAMicrophone;
 class deoalAComponent;
 class deoalASoundLevelMeter;
@@ -45,7 +44,6 @@ class deoalDCollisionVolume;
 class deoalWorldOctree : public deoalDOctree{
 private:
 	decTList<deoalAComponent*> pComponents;
-	decTList<deoalASpeaker*> pSpeakers;
 	decTList<deoalAMicrophone*> pMicrophones;
 	decTList<deoalEnvProbe*> pEnvProbes;
 	decTList<deoalASoundLevelMeter*> pSoundLevelMeters;
@@ -75,9 +73,6 @@ public:
 	/** \brief Clear all components from tree. */
 	void ClearComponents();
 	
-	/** \brief Clear all speakers from tree. */
-	void ClearSpeakers();
-	
 	/** \brief Clear all microphones from tree. */
 	void ClearMicrophones();
 	
@@ -93,9 +88,6 @@ public:
 	/** \brief Add component into octree. */
 	void InsertComponentIntoTree(deoalAComponent *component, int maxDepth);
 	
-	/** \brief Add speaker into octree. */
-	void InsertSpeakerIntoTree(deoalASpeaker *speaker, int maxDepth);
-	
 	/** \brief Add microphone into octree. */
 	void InsertMicrophoneIntoTree(deoalAMicrophone *microphone, int maxDepth);
 	
@@ -131,29 +123,6 @@ public:
 	
 	
 	
-	/** \name Speakers */
-	/*@{*/
-	/** \brief Number of speakers. */
-	int GetSpeakerCount() const;
-	
-	/** \brief Speaker at index. */
-	deoalASpeaker *GetSpeakerAt(int index) const;
-	
-	/** \brief Index of speaker or -1 if absent. */
-	int IndexOfSpeaker(deoalASpeaker *speaker) const;
-	
-	/** \brief Add speaker. */
-	void AddSpeaker(deoalASpeaker *speaker);
-	
-	/** \brief Remove speaker. */
-	void RemoveSpeaker(deoalASpeaker *speaker);
-	
-	/** \brief Remove all speakers. */
-	void RemoveAllSpeakers();
-	/*@}*/
-	
-	
-	
 	/** \name Microphones */
 	/*@{*/
 	/** \brief Number of microphones. */
@@ -32,7 +32,6 @@
 #include "../../component/deoalAComponent.h"
 #include "../../environment/deoalEnvProbe.h"
 #include "../../microphone/deoalAMicrophone.h"
-#include "../../speaker/deoalASpeaker.h"
 #include "../../soundLevelMeter/deoalASoundLevelMeter.h"
 #include "../../utils/collision/deoalDCollisionDetection.h"
 
@@ -49,7 +48,6 @@
 deoalWorldOctreeVisitor::deoalWorldOctreeVisitor() :
 pVisitMicrophones(true),
 pVisitComponents(true),
-pVisitSpeakers(true),
 pVisitEnvProbes(true),
 pVisitSoundLevelMeters(true){
 }
@@ -70,10 +68,6 @@ void deoalWorldOctreeVisitor::SetVisitMicrophones(bool visitMicrophones){
 	pVisitMicrophones = visitMicrophones;
 }
 
-void deoalWorldOctreeVisitor::SetVisitSpeakers(bool visitSpeakers){
-	pVisitSpeakers = visitSpeakers;
-}
-
 void deoalWorldOctreeVisitor::SetVisitEnvProbes(bool visitEnvProbes){
 	pVisitEnvProbes = visitEnvProbes;
 }
@@ -85,7 +79,6 @@ void deoalWorldOctreeVisitor::SetVisitSoundLevelMeters(bool visitSoundLevelMeter
 void deoalWorldOctreeVisitor::SetVisitAll(bool visitAll){
 	pVisitComponents = visitAll;
 	pVisitMicrophones = visitAll;
-	pVisitSpeakers = visitAll;
 	pVisitEnvProbes = visitAll;
 	pVisitSoundLevelMeters = visitAll;
 }
@@ -119,14 +112,6 @@ void deoalWorldOctreeVisitor::VisitNode(deoalDOctree *node, int){
 		}
 	}
 	
-	if(pVisitSpeakers){
-		const int count = sonode.GetSpeakerCount();
-		
-		for(i=0; i<count; i++){
-			VisitSpeaker(sonode.GetSpeakerAt(i));
-		}
-	}
-	
 	if(pVisitEnvProbes){
 		const int count = sonode.GetEnvProbeCount();
 		
@@ -150,9 +135,6 @@ void deoalWorldOctreeVisitor::VisitComponent(deoalAComponent*){
 void deoalWorldOctreeVisitor::VisitMicrophone(deoalAMicrophone*){
 }
 
-void deoalWorldOctreeVisitor::VisitSpeaker(deoalASpeaker*){
-}
-
 void deoalWorldOctreeVisitor::VisitEnvProbe(deoalEnvProbe*){
 }
 
@@ -27,7 +27,6 @@
 
 #include "../../utils/octree/deoalDOctreeVisitor.h"
 
-class deoalASpeaker;
 class deoalAComponent;
 class deoalAMicrophone;
 class deoalEnvProbe;
@@ -46,7 +45,6 @@ class deoalWorldOctreeVisitor : public deoalDOctreeVisitor{
 private:
 	bool pVisitMicrophones;
 	bool pVisitComponents;
-	bool pVisitSpeakers;
 	bool pVisitEnvProbes;
 	bool pVisitSoundLevelMeters;
 	
@@ -78,12 +76,6 @@ public:
 	/** \brief Set if components are visited. */
 	void SetVisitComponents(bool visitComponents);
 	
-	/** \brief Speakers are visited. */
-	inline bool GetVisitSpeakers() const{ return pVisitSpeakers; }
-	
-	/** \brief Set if speakers are visited. */
-	void SetVisitSpeakers(bool visitSpeakers);
-	
 	/** \brief Sound level meters are visited. */
 	inline bool GetVisitSoundLevelMeters() const{ return pVisitSoundLevelMeters; }
 	
@@ -129,9 +121,6 @@ public:
 	/** \brief Visit component. */
 	virtual void VisitComponent(deoalAComponent *component);
 	
-	/** \brief Visit speaker. */
-	virtual void VisitSpeaker(deoalASpeaker *speaker);
-	
 	/** \brief Visit environment probes. */
 	virtual void VisitEnvProbe(deoalEnvProbe *envProbe);
 	
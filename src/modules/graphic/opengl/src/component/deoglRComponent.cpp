@@ -28,6 +28,7 @@
 #include "deoglRComponent.h"
 #include "deoglRComponentTexture.h"
 #include "deoglRComponentLOD.h"
+#include "deoglRComponentLODTransformBatch.h"
 #include "deoglRComponentWCElement.h"
 #include "../capabilities/deoglCapabilities.h"
 #include "../collidelist/deoglCollideList.h"
@@ -86,6 +87,7 @@
 #include "../utils/collision/deoglDCollisionDetection.h"
 
 #include <dragengine/common/exceptions.h>
+#include <dragengine/common/math/decMathBatch.h>
 #include <dragengine/resources/component/deComponent.h>
 #include <dragengine/resources/component/deComponentBone.h>
 #include <dragengine/resources/decal/deDecal.h>
@@ -600,40 +602,44 @@ void deoglRComponent::UpdateBoneMatrices(const deComponent &component){
 	
 	pUpdateModelRigMappings(component);
 	
-	pBoneMatrices.VisitIndexed([&](int i, oglMatrix3x4 &boneMatrix){
+	// multiply inverse rig bone matrices with component bone matrices in one batch.
+	// unmapped bones use identity matrices resulting in an identity bone matrix
+	const int count = pBoneMatrices.GetCount();
+	pBoneRigMatrices.SetCountDiscard(count);
+	pBoneComponentMatrices.SetCountDiscard(count);
+	
+	int i;
+	for(i=0; i<count; i++){
 		const int bone = pModelRigMappings[i];
 		
 		if(bone == -1){
-			boneMatrix.a11 = 1.0f;
-			boneMatrix.a12 = 0.0f;
-			boneMatrix.a13 = 0.0f;
-			boneMatrix.a14 = 0.0f;
-			boneMatrix.a21 = 0.0f;
-			boneMatrix.a22 = 1.0f;
-			boneMatrix.a23 = 0.0f;
-			boneMatrix.a24 = 0.0f;
-			boneMatrix.a31 = 0.0f;
-			boneMatrix.a32 = 0.0f;
-			boneMatrix.a33 = 1.0f;
-			boneMatrix.a34 = 0.0f;
+			pBoneRigMatrices[i].SetIdentity();
+			pBoneComponentMatrices[i].SetIdentity();
 			
 		}else{
-			const decMatrix matrix(rig->GetBoneAt(bone)->GetInverseMatrix()
-				.QuickMultiply(component.GetBones()[bone].GetMatrix()));
-			
-			boneMatrix.a11 = matrix.a11;
-			boneMatrix.a12 = matrix.a12;
-			boneMatrix.a13 = matrix.a13;
-			boneMatrix.a14 = matrix.a14;
-			boneMatrix.a21 = matrix.a21;
-			boneMatrix.a22 = matrix.a22;
-			boneMatrix.a23 = matrix.a23;
-			boneMatrix.a24 = matrix.a24;
-			boneMatrix.a31 = matrix.a31;
-			boneMatrix.a32 = matrix.a32;
-			boneMatrix.a33 = matrix.a33;
-			boneMatrix.a34 = matrix.a34;
+			pBoneRigMatrices[i] = rig->GetBoneAt(bone)->GetInverseMatrix();
+			pBoneComponentMatrices[i] = component.GetBones()[bone].GetMatrix();
 		}
+	}
+	
+	decMathBatch::QuickMultiply(pBoneRigMatrices.GetArrayPointer(),
+		pBoneComponentMatrices.GetArrayPointer(), pBoneRigMatrices.GetArrayPointer(), count);
+	
+	pBoneMatrices.VisitIndexed([&](int j, oglMatrix3x4 &boneMatrix){
+		const decMatrix &matrix = pBoneRigMatrices[j];
+		
+		boneMatrix.a11 = matrix.a11;
+		boneMatrix.a12 = matrix.a12;
+		boneMatrix.a13 = matrix.a13;
+		boneMatrix.a14 = matrix.a14;
+		boneMatrix.a21 = matrix.a21;
+		boneMatrix.a22 = matrix.a22;
+		boneMatrix.a23 = matrix.a23;
+		boneMatrix.a24 = matrix.a24;
+		boneMatrix.a31 = matrix.a31;
+		boneMatrix.a32 = matrix.a32;
+		boneMatrix.a33 = matrix.a33;
+		boneMatrix.a34 = matrix.a34;
 	});
 }
 
@@ -1231,6 +1237,21 @@ void deoglRComponent::DirtyLODVBOs(){
 	pRequiresPrepareForRender();
 }
 
+void deoglRComponent::AddDirtyLODTransforms(deoglRComponentLODTransformBatch &batch){
+	if(!pDirtyLODVBOs || pRenderMode != ermDynamic){
+		return;
+	}
+	
+	// same stages as required by deoglRComponentLOD::UpdateVBO()
+	const deoglRComponentLOD::eTransformStages lastStage =
+		pRenderThread.GetChoices().GetGPUTransformVertices() == deoglRTChoices::egputvNone
+			? deoglRComponentLOD::etsNormalsTangents : deoglRComponentLOD::etsWeights;
+	
+	pLODs.Visit([&](deoglRComponentLOD *lod){
+		batch.Add(*lod, lastStage);
+	});
+}
+
 void deoglRComponent::DirtyLODRenderTaskConfigs(){
 	pDirtyLODRenderTaskConfigs = true;
 	pRequiresPrepareForRender();
@@ -53,6 +53,7 @@ class deoglRComponentListener;
 class deoglDynamicOcclusionMesh;
 class deoglRCamera;
 class deoglRComponentLOD;
+class deoglRComponentLODTransformBatch;
 class deoglRComponentTexture;
 class deoglRDecal;
 class deoglRLight;
@@ -131,6 +132,8 @@ private:
 	
 	// dynamic model data
 	decTList<oglMatrix3x4> pBoneMatrices;
+	decTList<decMatrix> pBoneRigMatrices;
+	decTList<decMatrix> pBoneComponentMatrices;
 	
 	// for world
 	bool pLit;
@@ -572,6 +575,14 @@ public:
 	/** Mark LOD VBOs dirty requiring preparing. */
 	void DirtyLODVBOs();
 	
+	/**
+	 * Add LODs with dirty VBOs to vertex transform batch.
+	 * 
+	 * Called by deoglRWorld before preparing components for rendering. Allows transforming
+	 * vertices of all components in parallel instead of one component after the other.
+	 */
+	void AddDirtyLODTransforms(deoglRComponentLODTransformBatch &batch);
+	
 	/** Mark LOD render task configurations dirty requiring preparing. */
 	void DirtyLODRenderTaskConfigs();
 	
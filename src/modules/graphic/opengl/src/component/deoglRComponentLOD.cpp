@@ -24,6 +24,7 @@
 
 #include "deoglRComponent.h"
 #include "deoglRComponentLOD.h"
+#include "deoglRComponentLODTransformBatch.h"
 #include "deoglRComponentTexture.h"
 #include "../capabilities/deoglCapabilities.h"
 #include "../configuration/deoglConfiguration.h"
@@ -57,6 +58,7 @@
 #include "../texture/texunitsconfig/deoglTexUnitsConfig.h"
 #include "../texture/texunitsconfig/deoglTexUnitsConfigList.h"
 #include "../tbo/deoglDynamicTBOFloat32.h"
+#include "../utils/deoglVertexTransformKernels.h"
 #include "../vao/deoglVAO.h"
 #include "../vbo/deoglSharedVBOBlock.h"
 #include "../vbo/deoglSharedVBO.h"
@@ -525,118 +527,202 @@ deoglModelLOD &deoglRComponentLOD::GetModelLODRef() const{
 }
 
 void deoglRComponentLOD::PrepareWeights(){
-	if(pDirtyModelWeights){
-		pWeights.RemoveAll();
-		
-		if(pComponent.GetModel() && pLODIndex >= 0 && pLODIndex < pComponent.GetModel()->GetLODCount()){
-			pWeights.AddRange(pComponent.GetModel()->GetLODAt(pLODIndex).GetWeightsCounts().GetCount(), {});
-			// NOTE weights count can be 0 if a higher level LOD has all weightless vertices.
-			//      this case can be optimized to using static rendering
-		}
-		
-		pDirtyModelWeights = false;
+	if(!pDirtyModelWeights && !pDirtyDataWeights){
+		return;
 	}
 	
-	if(pDirtyDataWeights){
-		if(pWeights.IsNotEmpty() && pComponent.GetModel() && pLODIndex >= 0 && pLODIndex < pComponent.GetModel()->GetLODCount()){
-			deoglModelLOD &modelLOD = pComponent.GetModel()->GetLODAt(pLODIndex);
-			
-			#ifdef SPECIAL_DEBUG_ON
-			specialTimer.Reset();
-			#endif
-			pCalculateWeights(modelLOD);
-			#ifdef SPECIAL_DEBUG_ON
-			extDebugCompCalculateWeights += specialTimer.GetElapsedTime();
-			#endif
-			#ifdef DO_TIMING
-			elapsedCompWeights += timer.GetElapsedTime();
-			#endif
-		}
-		
-		pDirtyDataWeights = false;
-	}
+	#ifdef SPECIAL_DEBUG_ON
+	specialTimer.Reset();
+	#endif
+	deoglRComponentLODTransformBatch batch(pComponent.GetRenderThread());
+	batch.Add(*this, etsWeights);
+	batch.Run();
+	#ifdef SPECIAL_DEBUG_ON
+	extDebugCompCalculateWeights += specialTimer.GetElapsedTime();
+	#endif
+	#ifdef DO_TIMING
+	elapsedCompWeights += timer.GetElapsedTime();
+	#endif
 }
 
 void deoglRComponentLOD::PreparePositions(){
-	PrepareWeights();
+	if(!pDirtyModelWeights && !pDirtyDataWeights && !pDirtyModelPositions && !pDirtyDataPositions){
+		return;
+	}
 	
-	if(pDirtyModelPositions){
-		pPositions.RemoveAll();
+	#ifdef SPECIAL_DEBUG_ON
+	specialTimer.Reset();
+	#endif
+	deoglRComponentLODTransformBatch batch(pComponent.GetRenderThread());
+	batch.Add(*this, etsPositions);
+	batch.Run();
+	#ifdef SPECIAL_DEBUG_ON
+	extDebugCompTransformVertices += specialTimer.GetElapsedTime();
+	#endif
+	#ifdef DO_TIMING
+	elapsedCompTVert += timer.GetElapsedTime();
+	#endif
+}
+
+void deoglRComponentLOD::PrepareNormalsTangents(){
+	if(!pDirtyModelWeights && !pDirtyDataWeights && !pDirtyModelPositions && !pDirtyDataPositions
+	&& !pDirtyModelNorTan && !pDirtyDataNorTan){
+		return;
+	}
+	
+	#ifdef SPECIAL_DEBUG_ON
+	specialTimer.Reset();
+	#endif
+	deoglRComponentLODTransformBatch batch(pComponent.GetRenderThread());
+	batch.Add(*this, etsNormalsTangents);
+	batch.Run();
+	#ifdef SPECIAL_DEBUG_ON
+	extDebugCompCalculateNormalsAndTangents += specialTimer.GetElapsedTime();
+	#endif
+	#ifdef DO_TIMING
+	elapsedCompNorTan += timer.GetElapsedTime();
+	#endif
+}
+
+int deoglRComponentLOD::BeginTransformStage(eTransformStages stage){
+	switch(stage){
+	case etsWeights:
+		if(pDirtyModelWeights){
+			pWeights.RemoveAll();
+			pWeightsFirstEntry.RemoveAll();
+			
+			if(pHasValidModelLOD()){
+				const decTList<int> &weightsCounts = GetModelLODRef().GetWeightsCounts();
+				pWeights.AddRange(weightsCounts.GetCount(), {});
+				// NOTE weights count can be 0 if a higher level LOD has all weightless vertices.
+				//      this case can be optimized to using static rendering
+				
+				// index of first weight entry of each weights set. required to process
+				// weights sets in ranges
+				int firstEntry = 0;
+				pWeightsFirstEntry.EnlargeCapacity(weightsCounts.GetCount());
+				weightsCounts.Visit([&](int entryCount){
+					pWeightsFirstEntry.Add(firstEntry);
+					firstEntry += entryCount;
+				});
+			}
+			
+			pDirtyModelWeights = false;
+		}
 		
-		if(pComponent.GetModel() && pLODIndex >= 0 && pLODIndex < pComponent.GetModel()->GetLODCount()){
-			pPositions.AddRange(pComponent.GetModel()->GetLODAt(pLODIndex).GetPositions().GetCount(), {});
+		if(pDirtyDataWeights && pWeights.IsNotEmpty() && pHasValidModelLOD()){
+			return pWeights.GetCount();
 		}
+		return 0;
 		
-		pDirtyModelPositions = false;
-	}
-	
-	if(pDirtyDataPositions){
-		// pWeights can not be checked to be non-NULL since higher level LODs can contain
+	case etsPositions:
+		if(pDirtyModelPositions){
+			pPositions.RemoveAll();
+			
+			if(pHasValidModelLOD()){
+				pPositions.AddRange(GetModelLODRef().GetPositions().GetCount(), {});
+			}
+			
+			pDirtyModelPositions = false;
+		}
+		
+		// pWeights can not be checked to be non-empty since higher level LODs can contain
 		// all weightless vertices although lower level LODs have weighted vertices. in this
 		// situation all vertices are copied non-transformed
-		if(pPositions.IsNotEmpty() && pComponent.GetModel() && pLODIndex >= 0 && pLODIndex < pComponent.GetModel()->GetLODCount()){
-			deoglModelLOD &modelLOD = pComponent.GetModel()->GetLODAt(pLODIndex);
+		if(pDirtyDataPositions && pPositions.IsNotEmpty() && pHasValidModelLOD()){
+			return pPositions.GetCount();
+		}
+		return 0;
+		
+	case etsFaces:
+		if(pDirtyModelNorTan){
+			pRealNormals.RemoveAll();
+			pNormals.RemoveAll();
+			pTangents.RemoveAll();
+			pFaceNormals.RemoveAll();
+			pFaceTangents.RemoveAll();
 			
-			#ifdef SPECIAL_DEBUG_ON
-			specialTimer.Reset();
-			#endif
-			pTransformVertices(modelLOD);
-			#ifdef SPECIAL_DEBUG_ON
-			extDebugCompTransformVertices += specialTimer.GetElapsedTime();
-			#endif
-			#ifdef DO_TIMING
-			elapsedCompTVert += timer.GetElapsedTime();
-			#endif
+			if(pHasValidModelLOD()){
+				const deoglModelLOD &modelLOD = GetModelLODRef();
+				
+				pRealNormals.AddRange(modelLOD.GetPositions().GetCount(), {});
+				pNormals.AddRange(modelLOD.GetNormals().GetCount(), {});
+				pTangents.AddRange(modelLOD.GetTangents().GetCount(), {});
+				pFaceNormals.AddRange(modelLOD.GetFaces().GetCount(), {});
+				pFaceTangents.AddRange(modelLOD.GetFaces().GetCount(), {});
+			}
+			
+			pDirtyModelNorTan = false;
 		}
 		
-		pDirtyDataPositions = false;
+		return pCanCalculateNormalsTangents() ? pFaceNormals.GetCount() : 0;
+		
+	case etsNormalsTangents:
+		return pCanCalculateNormalsTangents() ? pFaceNormals.GetCount() : 0;
+		
+	default:
+		DETHROW(deeInvalidParam);
 	}
 }
 
-void deoglRComponentLOD::PrepareNormalsTangents(){
-	PreparePositions();
-	
-	if(pDirtyModelNorTan){
-		pRealNormals.RemoveAll();
-		pNormals.RemoveAll();
-		pTangents.RemoveAll();
-		pFaceNormals.RemoveAll();
+void deoglRComponentLOD::TransformStageRange(eTransformStages stage, int first, int count){
+	const deoglModelLOD &modelLOD = GetModelLODRef();
+	
+	switch(stage){
+	case etsWeights:
+		//pComponent.UpdateBoneMatrices(); // done already by deoglComponent during synching
+		deoglVertexTransformKernels::BlendWeights(pComponent.GetBoneMatrices().GetArrayPointer(),
+			modelLOD.GetWeightsEntries().GetArrayPointer() + pWeightsFirstEntry[first],
+			modelLOD.GetWeightsCounts().GetArrayPointer() + first,
+			pWeights.GetArrayPointer() + first, count);
+		break;
 		
-		if(pComponent.GetModel() && pLODIndex >= 0 && pLODIndex < pComponent.GetModel()->GetLODCount()){
-			deoglModelLOD &modelLOD = pComponent.GetModel()->GetLODAt(pLODIndex);
-			
-			pRealNormals.AddRange(modelLOD.GetPositions().GetCount(), {});
-			pNormals.AddRange(modelLOD.GetNormals().GetCount(), {});
-			pTangents.AddRange(modelLOD.GetTangents().GetCount(), {});
-			pFaceNormals.AddRange(modelLOD.GetFaces().GetCount(), {});
-		}
+	case etsPositions:
+		// weights are empty if higher LOD has only weightless vertices while lower LOD has
+		// weighted vertices. in this case all positions are copied
+		deoglVertexTransformKernels::TransformPositions(
+			pWeights.IsNotEmpty() ? pWeights.GetArrayPointer() : nullptr,
+			modelLOD.GetPositions().GetArrayPointer() + first,
+			pPositions.GetArrayPointer() + first, count);
+		break;
+		
+	case etsFaces:
+		deoglVertexTransformKernels::FaceNormalsTangents(pPositions.GetArrayPointer(),
+			modelLOD.GetVertices().GetArrayPointer(), modelLOD.GetTextureCoordinates().GetArrayPointer(),
+			modelLOD.GetFaces().GetArrayPointer() + first, pFaceNormals.GetArrayPointer() + first,
+			pFaceTangents.GetArrayPointer() + first, count);
+		break;
 		
-		pDirtyModelNorTan = false;
+	case etsNormalsTangents:
+		DEASSERT_TRUE(first == 0 && count == pFaceNormals.GetCount())
+		pAccumulateNormalsTangents(modelLOD);
+		break;
 	}
-	
-	if(pDirtyDataNorTan){
-		if(pWeights.IsNotEmpty() && pPositions.IsNotEmpty() && pRealNormals.IsNotEmpty()
-		&& pNormals.IsNotEmpty() && pTangents.IsNotEmpty() && pFaceNormals.IsNotEmpty()
-		&& pComponent.GetModel() && pLODIndex >= 0
-		&& pLODIndex < pComponent.GetModel()->GetLODCount()){
-			const deoglModelLOD &modelLOD = pComponent.GetModel()->GetLODAt(pLODIndex);
-			
-			#ifdef SPECIAL_DEBUG_ON
-			specialTimer.Reset();
-			#endif
-			pCalculateNormalsAndTangents(modelLOD);
-			#ifdef SPECIAL_DEBUG_ON
-			extDebugCompCalculateNormalsAndTangents += specialTimer.GetElapsedTime();
-			#endif
-			#ifdef DO_TIMING
-			elapsedCompNorTan += timer.GetElapsedTime();
-			#endif
-		}
+}
+
+void deoglRComponentLOD::EndTransformStage(eTransformStages stage){
+	switch(stage){
+	case etsWeights:
+		pDirtyDataWeights = false;
+		break;
 		
+	case etsPositions:
+		pDirtyDataPositions = false;
+		break;
+		
+	case etsFaces:
+		break;
+		
+	case etsNormalsTangents:
 		pDirtyDataNorTan = false;
+		break;
 	}
 }
 
+bool deoglRComponentLOD::CanSplitTransformStage(eTransformStages stage){
+	return stage != etsNormalsTangents;
+}
+
 
 
 // Private Functions
@@ -774,341 +860,60 @@ void deoglRComponentLOD::pUpdateVAO(deoglModelLOD &modelLOD){
 
 
 
-void deoglRComponentLOD::pCalculateWeights(const deoglModelLOD &modelLOD){
-	const oglModelWeight * weightsEntries = modelLOD.GetWeightsEntries().GetArrayPointer();
-	const int * const weightsCounts = modelLOD.GetWeightsCounts().GetArrayPointer();
-	const int weightsCount = modelLOD.GetWeightsCounts().GetCount();
-	int w, e, entryCount;
-	float factor;
-	
-	//pComponent.UpdateBoneMatrices(); // done already by deoglComponent during synching
-	
-	const oglMatrix3x4 * const boneMatrices = pComponent.GetBoneMatrices().GetArrayPointer();
-	
-	for(w=0; w<weightsCount; w++){
-		oglMatrix3x4 &weightsMatrix = pWeights[w];
-		entryCount = weightsCounts[w];
-		
-		if(entryCount == 0){
-			weightsMatrix.a11 = 1.0f;
-			weightsMatrix.a12 = 0.0f;
-			weightsMatrix.a13 = 0.0f;
-			weightsMatrix.a14 = 0.0f;
-			weightsMatrix.a21 = 0.0f;
-			weightsMatrix.a22 = 1.0f;
-			weightsMatrix.a23 = 0.0f;
-			weightsMatrix.a24 = 0.0f;
-			weightsMatrix.a31 = 0.0f;
-			weightsMatrix.a32 = 0.0f;
-			weightsMatrix.a33 = 1.0f;
-			weightsMatrix.a34 = 0.0f;
-			
-		}else if(entryCount == 1){
-			const oglMatrix3x4 &boneMatrix = boneMatrices[weightsEntries->bone];
-			
-			weightsMatrix.a11 = boneMatrix.a11;
-			weightsMatrix.a12 = boneMatrix.a12;
-			weightsMatrix.a13 = boneMatrix.a13;
-			weightsMatrix.a14 = boneMatrix.a14;
-			weightsMatrix.a21 = boneMatrix.a21;
-			weightsMatrix.a22 = boneMatrix.a22;
-			weightsMatrix.a23 = boneMatrix.a23;
-			weightsMatrix.a24 = boneMatrix.a24;
-			weightsMatrix.a31 = boneMatrix.a31;
-			weightsMatrix.a32 = boneMatrix.a32;
-			weightsMatrix.a33 = boneMatrix.a33;
-			weightsMatrix.a34 = boneMatrix.a34;
-			
-			weightsEntries++;
-			
-		}else{
-			const oglMatrix3x4 &boneMatrix = boneMatrices[weightsEntries->bone];
-			factor = weightsEntries->weight;
-			
-			weightsMatrix.a11 = boneMatrix.a11 * factor;
-			weightsMatrix.a12 = boneMatrix.a12 * factor;
-			weightsMatrix.a13 = boneMatrix.a13 * factor;
-			weightsMatrix.a14 = boneMatrix.a14 * factor;
-			weightsMatrix.a21 = boneMatrix.a21 * factor;
-			weightsMatrix.a22 = boneMatrix.a22 * factor;
-			weightsMatrix.a23 = boneMatrix.a23 * factor;
-			weightsMatrix.a24 = boneMatrix.a24 * factor;
-			weightsMatrix.a31 = boneMatrix.a31 * factor;
-			weightsMatrix.a32 = boneMatrix.a32 * factor;
-			weightsMatrix.a33 = boneMatrix.a33 * factor;
-			weightsMatrix.a34 = boneMatrix.a34 * factor;
-			
-			weightsEntries++;
-			
-			for(e=1; e<entryCount; e++){
-				const oglMatrix3x4 &boneMatrix2 = boneMatrices[weightsEntries->bone];
-				factor = weightsEntries->weight;
-				
-				weightsMatrix.a11 += boneMatrix2.a11 * factor;
-				weightsMatrix.a12 += boneMatrix2.a12 * factor;
-				weightsMatrix.a13 += boneMatrix2.a13 * factor;
-				weightsMatrix.a14 += boneMatrix2.a14 * factor;
-				weightsMatrix.a21 += boneMatrix2.a21 * factor;
-				weightsMatrix.a22 += boneMatrix2.a22 * factor;
-				weightsMatrix.a23 += boneMatrix2.a23 * factor;
-				weightsMatrix.a24 += boneMatrix2.a24 * factor;
-				weightsMatrix.a31 += boneMatrix2.a31 * factor;
-				weightsMatrix.a32 += boneMatrix2.a32 * factor;
-				weightsMatrix.a33 += boneMatrix2.a33 * factor;
-				weightsMatrix.a34 += boneMatrix2.a34 * factor;
-				
-				weightsEntries++;
-			}
-		}
-	}
-#if 0
-	if(weightsCount > 0){
-		deGraphicOpenGl &ogl = *pComponent.GetOgl();
-		
-		if(!pVBOWeightMatrices){
-			OGL_CHECK(ogl, pglGenBuffers(1, &pVBOWeightMatrices));
-			OGL_CHECK(ogl, pglBindBuffer(GL_ARRAY_BUFFER, pVBOWeightMatrices));
-			OGL_CHECK(ogl, pglBufferData(GL_ARRAY_BUFFER, sizeof(oglMatrix3x4) * weightsCount, pWeights, GL_STATIC_DRAW));
-		}
-		
-		if(!pTBOWeightMatrices){
-			deoglTextureStageManager &tsmgr = ogl.GetRenderThread().GetTexture().GetStages();
-			
-			OGL_CHECK(ogl, glGenTextures(1, &pTBOWeightMatrices));
-			if(!pTBOWeightMatrices){
-				DETHROW(deeInvalidParam);
-			}
-			tsmgr.EnableBareTBO(0, pTBOWeightMatrices);
-			OGL_CHECK(ogl, pglTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, pVBOWeightMatrices));
-			tsmgr.DisableStage(0);
-		}
-	}
-#endif
+bool deoglRComponentLOD::pHasValidModelLOD() const{
+	return pComponent.GetModel() && pLODIndex >= 0 && pLODIndex < pComponent.GetModel()->GetLODCount();
 }
 
-void deoglRComponentLOD::pTransformVertices(const deoglModelLOD &modelLOD){
-	const oglModelPosition * const positions = modelLOD.GetPositions().GetArrayPointer();
-	const int positionCount = modelLOD.GetPositions().GetCount();
-	int i;
-	
-	if(pWeights.IsEmpty()){
-		// happens if higher LOD has only weightless vertices while lower LOD has weighted
-		// vertices. this extra check avoids potential bugs if pWeights is incorrectly NULL
-		for(i=0; i<positionCount; i++){
-			const decVector &orgpos = positions[i].position;
-			oglVector3 &trpos = pPositions[i];
-			trpos.x = orgpos.x;
-			trpos.y = orgpos.y;
-			trpos.z = orgpos.z;
-		}
-		return;
-	}
-	
-	for(i=0; i<positionCount; i++){
-		const oglModelPosition &modelPosition = positions[i];
-		const decVector &orgpos = positions[i].position;
-		oglVector3 &trpos = pPositions[i];
-		
-		if(modelPosition.weights == -1){
-			trpos.x = orgpos.x;
-			trpos.y = orgpos.y;
-			trpos.z = orgpos.z;
-			
-		}else{
-			const oglMatrix3x4 &matrix = pWeights[modelPosition.weights];
-			
-			trpos.x = matrix.a11 * orgpos.x + matrix.a12 * orgpos.y + matrix.a13 * orgpos.z + matrix.a14;
-			trpos.y = matrix.a21 * orgpos.x + matrix.a22 * orgpos.y + matrix.a23 * orgpos.z + matrix.a24;
-			trpos.z = matrix.a31 * orgpos.x + matrix.a32 * orgpos.y + matrix.a33 * orgpos.z + matrix.a34;
-		}
-	}
+bool deoglRComponentLOD::pCanCalculateNormalsTangents() const{
+	return pDirtyDataNorTan && pWeights.IsNotEmpty() && pPositions.IsNotEmpty()
+		&& pRealNormals.IsNotEmpty() && pNormals.IsNotEmpty() && pTangents.IsNotEmpty()
+		&& pFaceNormals.IsNotEmpty() && pHasValidModelLOD();
+}
+
+static inline void addVector(oglVector3 &vector, const oglVector3 &add){
+	vector.x += add.x;
+	vector.y += add.y;
+	vector.z += add.z;
 }
 
-void deoglRComponentLOD::pCalculateNormalsAndTangents(const deoglModelLOD &modelLOD){
-	const decVector2 * const texcoords = modelLOD.GetTextureCoordinates().GetArrayPointer();
+void deoglRComponentLOD::pAccumulateNormalsTangents(const deoglModelLOD &modelLOD){
 	const oglModelVertex * const points = modelLOD.GetVertices().GetArrayPointer();
 	const deoglModelFace * const faces = modelLOD.GetFaces().GetArrayPointer();
-	const int positionCount = modelLOD.GetPositions().GetCount();
-	const int tangentCount = modelLOD.GetTangents().GetCount();
-	const int normalCount = modelLOD.GetNormals().GetCount();
-	const int tcsetCount = modelLOD.GetTextureCoordSetCount();
-	const int faceCount = modelLOD.GetFaces().GetCount();
-	oglVector3 edge1, edge2;
-	oglVector3 tangent;
-	decVector2 d1, d2;
-	float len, invlen;
+	const oglVector3 * const faceNormals = pFaceNormals.GetArrayPointer();
+	const oglVector3 * const faceTangents = pFaceTangents.GetArrayPointer();
+	oglVector3 * const realNormals = pRealNormals.GetArrayPointer();
+	oglVector3 * const normals = pNormals.GetArrayPointer();
+	oglVector3 * const tangents = pTangents.GetArrayPointer();
+	const int faceCount = pFaceNormals.GetCount();
 	int i;
 	
 	// reset normals and tangents
-	pRealNormals.SetRangeAt(0, positionCount, {0.0f, 0.0f, 0.0f});
-	pNormals.SetRangeAt(0, normalCount, {0.0f, 0.0f, 0.0f});
-	pTangents.SetRangeAt(0, tangentCount, {0.0f, 0.0f, 0.0f});
-	if(tcsetCount > 0){
-		pTangents2.SetRangeAt(0, tangentCount, {0.0f, 0.0f, 0.0f});
-		if(tcsetCount > 1){
-			pTangents3.SetRangeAt(0, tangentCount, {0.0f, 0.0f, 0.0f});
-		}
-	}
-	
-	// calculate normals and tangents
-	decTList<oglVector3> *tcsTangents[] = {&pTangents2, &pTangents3};
+	pRealNormals.SetRangeAt(0, pRealNormals.GetCount(), {0.0f, 0.0f, 0.0f});
+	pNormals.SetRangeAt(0, pNormals.GetCount(), {0.0f, 0.0f, 0.0f});
+	pTangents.SetRangeAt(0, pTangents.GetCount(), {0.0f, 0.0f, 0.0f});
 	
+	// add face normals and tangents to vertices. face normals and tangents have been
+	// calculated already in parallel. adding has to be done sequentially since faces
+	// share vertices
 	for(i=0; i<faceCount; i++){
 		const deoglModelFace &face = faces[i];
 		const oglModelVertex &point1 = points[face.GetVertex1()];
 		const oglModelVertex &point2 = points[face.GetVertex2()];
 		const oglModelVertex &point3 = points[face.GetVertex3()];
-		const oglVector3 &position1 = pPositions[point1.position];
-		const oglVector3 &position2 = pPositions[point2.position];
-		const oglVector3 &position3 = pPositions[point3.position];
-		const decVector2 &texcoord1 = texcoords[point1.texcoord];
-		const decVector2 &texcoord2 = texcoords[point2.texcoord];
-		const decVector2 &texcoord3 = texcoords[point3.texcoord];
-		
-		oglVector3 &faceNormal = pFaceNormals[i];
-		
-		// calculate edges
-		edge1.x = position2.x - position1.x;
-		edge1.y = position2.y - position1.y;
-		edge1.z = position2.z - position1.z;
-		edge2.x = position3.x - position1.x;
-		edge2.y = position3.y - position1.y;
-		edge2.z = position3.z - position1.z;
-		
-		// calculate normal
-		faceNormal.x = edge1.y * edge2.z - edge1.z * edge2.y;
-		faceNormal.y = edge1.z * edge2.x - edge1.x * edge2.z;
-		faceNormal.z = edge1.x * edge2.y - edge1.y * edge2.x;
-		
-		len = sqrtf(faceNormal.x * faceNormal.x + faceNormal.y * faceNormal.y + faceNormal.z * faceNormal.z);
-		if(len != 0.0f){
-			invlen = 1.0f / len;
-			faceNormal.x *= invlen;
-			faceNormal.y *= invlen;
-			faceNormal.z *= invlen;
-			
-		}else{
-			faceNormal.x = 0.0f;
-			faceNormal.y = 1.0f;
-			faceNormal.z = 0.0f;
-		}
-		
-		// add to real normals
-		oglVector3 &vrn1 = pRealNormals[point1.position];
-		vrn1.x += faceNormal.x;
-		vrn1.y += faceNormal.y;
-		vrn1.z += faceNormal.z;
-		
-		oglVector3 &vrn2 = pRealNormals[point2.position];
-		vrn2.x += faceNormal.x;
-		vrn2.y += faceNormal.y;
-		vrn2.z += faceNormal.z;
-		
-		oglVector3 &vrn3 = pRealNormals[point3.position];
-		vrn3.x += faceNormal.x;
-		vrn3.y += faceNormal.y;
-		vrn3.z += faceNormal.z;
-		
-		// add to normals
-		oglVector3 &vn1 = pNormals[point1.normal];
-		vn1.x += faceNormal.x;
-		vn1.y += faceNormal.y;
-		vn1.z += faceNormal.z;
-		
-		oglVector3 &vn2 = pNormals[point2.normal];
-		vn2.x += faceNormal.x;
-		vn2.y += faceNormal.y;
-		vn2.z += faceNormal.z;
-		
-		oglVector3 &vn3 = pNormals[point3.normal];
-		vn3.x += faceNormal.x;
-		vn3.y += faceNormal.y;
-		vn3.z += faceNormal.z;
+		const oglVector3 &faceNormal = faceNormals[i];
+		const oglVector3 &faceTangent = faceTangents[i];
 		
-		// calculate texture coordinate deltas
-		d1 = texcoord2 - texcoord1;
-		d2 = texcoord3 - texcoord1;
+		addVector(realNormals[point1.position], faceNormal);
+		addVector(realNormals[point2.position], faceNormal);
+		addVector(realNormals[point3.position], faceNormal);
 		
-		// calculate tangent
-		tangent.x = edge1.x * d2.y - edge2.x * d1.y;
-		tangent.y = edge1.y * d2.y - edge2.y * d1.y;
-		tangent.z = edge1.z * d2.y - edge2.z * d1.y;
+		addVector(normals[point1.normal], faceNormal);
+		addVector(normals[point2.normal], faceNormal);
+		addVector(normals[point3.normal], faceNormal);
 		
-		len = sqrtf(tangent.x * tangent.x + tangent.y * tangent.y + tangent.z * tangent.z);
-		if(len != 0.0f){
-			invlen = 1.0f / len;
-			tangent.x *= invlen;
-			tangent.y *= invlen;
-			tangent.z *= invlen;
-			
-		}else{
-			tangent.x = 1.0f;
-			tangent.y = 0.0f;
-			tangent.z = 0.0f;
-		}
-		
-		// add to tangents
-		oglVector3 &vt1 = pTangents[point1.tangent];
-		vt1.x += tangent.x;
-		vt1.y += tangent.y;
-		vt1.z += tangent.z;
-		
-		oglVector3 &vt2 = pTangents[point2.tangent];
-		vt2.x += tangent.x;
-		vt2.y += tangent.y;
-		vt2.z += tangent.z;
-		
-		oglVector3 &vt3 = pTangents[point3.tangent];
-		vt3.x += tangent.x;
-		vt3.y += tangent.y;
-		vt3.z += tangent.z;
-		
-		// additional tcs
-		for(i=0; i<tcsetCount; i++){
-			const auto &tcs = modelLOD.GetTextureCoordSets()[i];
-			const decVector2 &tcsTc1 = tcs.GetTextureCoordinates()[point1.texcoord];
-			const decVector2 &tcsTc2 = tcs.GetTextureCoordinates()[point2.texcoord];
-			const decVector2 &tcsTc3 = tcs.GetTextureCoordinates()[point3.texcoord];
-			
-			// calculate texture coordinate deltas
-			d1 = tcsTc2 - tcsTc1;
-			d2 = tcsTc3 - tcsTc1;
-			
-			// calculate tangent
-			tangent.x = edge1.x * d2.y - edge2.x * d1.y;
-			tangent.y = edge1.y * d2.y - edge2.y * d1.y;
-			tangent.z = edge1.z * d2.y - edge2.z * d1.y;
-			
-			len = sqrtf(tangent.x * tangent.x + tangent.y * tangent.y + tangent.z * tangent.z);
-			if(len != 0.0f){
-				invlen = 1.0f / len;
-				tangent.x *= invlen;
-				tangent.y *= invlen;
-				tangent.z *= invlen;
-				
-			}else{
-				tangent.x = 1.0f;
-				tangent.y = 0.0f;
-				tangent.z = 0.0f;
-			}
-			
-			// add to tangents
-			auto &tt = *tcsTangents[i];
-			oglVector3 &tcsVt1 = tt[point1.tangent];
-			tcsVt1.x += tangent.x;
-			tcsVt1.y += tangent.y;
-			tcsVt1.z += tangent.z;
-			
-			oglVector3 &tcsVt2 = tt[point2.tangent];
-			tcsVt2.x += tangent.x;
-			tcsVt2.y += tangent.y;
-			tcsVt2.z += tangent.z;
-			
-			oglVector3 &tcsVt3 = tt[point3.tangent];
-			tcsVt3.x += tangent.x;
-			tcsVt3.y += tangent.y;
-			tcsVt3.z += tangent.z;
-		}
+		addVector(tangents[point1.tangent], faceTangent);
+		addVector(tangents[point2.tangent], faceTangent);
+		addVector(tangents[point3.tangent], faceTangent);
 	}
 	
 	// shaders do not require normalized normals and tangents but to prevent problems due to
@@ -1136,16 +941,6 @@ void deoglRComponentLOD::pCalculateNormalsAndTangents(const deoglModelLOD &model
 			t.z = 0.0f;
 		}
 	});
-	
-	for(i=0; i<tcsetCount; i++){
-		tcsTangents[i]->Visit([&](oglVector3 &t){
-			if(t.x == 0.0f && t.y == 0.0f && t.z == 0.0f){
-				t.x = 1.0f;
-				t.y = 0.0f;
-				t.z = 0.0f;
-			}
-		});
-	}
 }
 
 
@@ -61,6 +61,21 @@ public:
 	/** \brief Type holding strong reference. */
 	using Ref = deTObjectReference<deoglRComponentLOD>;
 	
+	/** Vertex transform stages in the order they have to be run. */
+	enum eTransformStages{
+		/** Blend weight matrices. */
+		etsWeights,
+		
+		/** Transform positions. */
+		etsPositions,
+		
+		/** Calculate face normals and face tangents. */
+		etsFaces,
+		
+		/** Accumulate vertex normals and tangents. */
+		etsNormalsTangents
+	};
+	
 	
 	deoglRComponent &pComponent;
 	const int pLODIndex;
@@ -71,11 +86,13 @@ public:
 	const deoglSharedVBOBlock *pVBOBlock;
 	
 	decTList<oglMatrix3x4> pWeights;
+	decTList<int> pWeightsFirstEntry;
 	decTList<oglVector3> pPositions;
 	decTList<oglVector3> pRealNormals;
 	decTList<oglVector3> pNormals;
-	decTList<oglVector3> pTangents, pTangents2, pTangents3;
+	decTList<oglVector3> pTangents;
 	decTList<oglVector3> pFaceNormals;
+	decTList<oglVector3> pFaceTangents;
 	
 	bool pDirtyModelWeights;
 	bool pDirtyModelPositions;
@@ -165,15 +182,50 @@ public:
 	
 	
 	
-	/** Prepare dynamic weights if dirty. */
+	/**
+	 * Prepare dynamic weights if dirty.
+	 * 
+	 * To prepare multiple component LODs at once use deoglRComponentLODTransformBatch.
+	 */
 	void PrepareWeights();
 	
-	/** Prepare dynamic positions if dirty. */
+	/**
+	 * Prepare dynamic positions if dirty.
+	 * 
+	 * To prepare multiple component LODs at once use deoglRComponentLODTransformBatch.
+	 */
 	void PreparePositions();
 	
-	/** Prepare dynamic normals and tangents if dirty. */
+	/**
+	 * Prepare dynamic normals and tangents if dirty.
+	 * 
+	 * To prepare multiple component LODs at once use deoglRComponentLODTransformBatch.
+	 */
 	void PrepareNormalsTangents();
 	
+	/**
+	 * Begin vertex transform stage.
+	 * 
+	 * Prepares the buffers used by the stage. Returns the count of elements to transform
+	 * or 0 if the stage is not dirty. EndTransformStage() has to be called afterwards
+	 * in all cases. For use by deoglRComponentLODTransformBatch only.
+	 */
+	int BeginTransformStage(eTransformStages stage);
+	
+	/**
+	 * Transform range of elements of stage.
+	 * 
+	 * Safe to be called from parallel tasks for disjoint ranges. Ranges of stages not
+	 * supporting splitting have to cover all elements.
+	 */
+	void TransformStageRange(eTransformStages stage, int first, int count);
+	
+	/** End vertex transform stage. */
+	void EndTransformStage(eTransformStages stage);
+	
+	/** Stage supports transforming elements in disjoint ranges. */
+	static bool CanSplitTransformStage(eTransformStages stage);
+	
 	
 	
 	/** Point offset or 0 if not using a shared vao. */
@@ -250,9 +302,9 @@ private:
 	void pWriteVBOData(const deoglModelLOD &modelLOD);
 	void pUpdateVAO(deoglModelLOD &modelLOD);
 	
-	void pCalculateWeights(const deoglModelLOD &modelLOD);
-	void pTransformVertices(const deoglModelLOD &modelLOD);
-	void pCalculateNormalsAndTangents(const deoglModelLOD &modelLOD);
+	bool pHasValidModelLOD() const;
+	bool pCanCalculateNormalsTangents() const;
+	void pAccumulateNormalsTangents(const deoglModelLOD &modelLOD);
 	
 	void pPrepareVBOLayout(const deoglModelLOD &modelLOD);
 	
@@ -0,0 +1,145 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "deoglRComponentLODTransformBatch.h"
+#include "deoglRComponentLODTransformTask.h"
+#include "../deGraphicOpenGl.h"
+#include "../renderthread/deoglRenderThread.h"
+
+#include <dragengine/deEngine.h>
+#include <dragengine/common/exceptions.h>
+#include <dragengine/parallel/deParallelProcessing.h>
+
+
+// Class deoglRComponentLODTransformBatch
+///////////////////////////////////////////
+
+// Constructor, destructor
+////////////////////////////
+
+deoglRComponentLODTransformBatch::deoglRComponentLODTransformBatch(deoglRenderThread &renderThread) :
+pRenderThread(renderThread){
+}
+
+deoglRComponentLODTransformBatch::~deoglRComponentLODTransformBatch(){
+}
+
+
+
+// Management
+///////////////
+
+void deoglRComponentLODTransformBatch::Add(deoglRComponentLOD &lod,
+deoglRComponentLOD::eTransformStages lastStage){
+	pEntries.Add({&lod, lastStage, 0});
+}
+
+void deoglRComponentLODTransformBatch::RemoveAll(){
+	pEntries.RemoveAll();
+}
+
+void deoglRComponentLODTransformBatch::Run(){
+	pRunStage(deoglRComponentLOD::etsWeights);
+	pRunStage(deoglRComponentLOD::etsPositions);
+	pRunStage(deoglRComponentLOD::etsFaces);
+	pRunStage(deoglRComponentLOD::etsNormalsTangents);
+}
+
+
+
+// Private Functions
+//////////////////////
+
+void deoglRComponentLODTransformBatch::pRunStage(deoglRComponentLOD::eTransformStages stage){
+	int totalCount = 0;
+	pEntries.Visit([&](sEntry &entry){
+		entry.count = stage <= entry.lastStage ? entry.lod->BeginTransformStage(stage) : 0;
+		totalCount += entry.count;
+	});
+	
+	if(totalCount > 0){
+		deParallelProcessing &parallel = pRenderThread.GetOgl().GetGameEngine()->GetParallelProcessing();
+		const int threadCount = parallel.GetThreadCount();
+		
+		if(threadCount < 2 || totalCount < MinTaskElementCount * 2){
+			pEntries.Visit([&](const sEntry &entry){
+				if(entry.count > 0){
+					entry.lod->TransformStageRange(stage, 0, entry.count);
+				}
+			});
+			
+		}else{
+			// split into ranges of roughly the same size. small component LODs are packed
+			// into the same task. stages not supporting splitting use one range per LOD
+			const int taskElementCount = decMath::max(totalCount / (threadCount * 4), MinTaskElementCount);
+			const bool canSplit = deoglRComponentLOD::CanSplitTransformStage(stage);
+			decTList<deoglRComponentLODTransformTask::Ref> tasks;
+			deoglRComponentLODTransformTask::Ref task;
+			
+			pEntries.Visit([&](const sEntry &entry){
+				int first = 0;
+				while(first < entry.count){
+					if(!task){
+						task = deoglRComponentLODTransformTask::Ref::New(pRenderThread, stage);
+					}
+					
+					const int count = canSplit ? decMath::min(entry.count - first,
+						taskElementCount - task->GetElementCount()) : entry.count;
+					task->AddRange(*entry.lod, first, count);
+					first += count;
+					
+					if(task->GetElementCount() >= taskElementCount){
+						tasks.Add(task);
+						task = nullptr;
+					}
+				}
+			});
+			
+			if(task){
+				tasks.Add(task);
+			}
+			
+			tasks.Visit([&](deoglRComponentLODTransformTask *each){
+				parallel.AddTaskAsync(each);
+			});
+			
+			bool success = true;
+			tasks.Visit([&](deoglRComponentLODTransformTask *each){
+				each->GetSemaphore().Wait();
+				success &= each->GetSuccess();
+			});
+			
+			if(!success){
+				// stage stays dirty and is retried the next time
+				DETHROW_INFO(deeInvalidAction, "Transform vertices task failed");
+			}
+		}
+	}
+	
+	pEntries.Visit([&](const sEntry &entry){
+		if(stage <= entry.lastStage){
+			entry.lod->EndTransformStage(stage);
+		}
+	});
+}
@@ -0,0 +1,104 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DEOGLRCOMPONENTLODTRANSFORMBATCH_H_
+#define _DEOGLRCOMPONENTLODTRANSFORMBATCH_H_
+
+#include "deoglRComponentLOD.h"
+
+#include <dragengine/common/collection/decTList.h>
+
+class deoglRenderThread;
+
+
+/**
+ * Transform vertices of multiple component LODs on the CPU.
+ * 
+ * Runs the vertex transform stages of all added component LODs one stage after the other.
+ * Each stage is split into ranges of elements processed by parallel tasks. Small component
+ * LODs are packed together into the same task while large component LODs are split across
+ * multiple tasks. If the total work of a stage is small or only one thread is available
+ * the stage is run directly on the render thread.
+ * 
+ * Component LODs keep track of dirty stages. Preparing component LODs which are up to date
+ * does nothing. Consumers can thus call the prepare methods of component LODs at any time
+ * without redoing work prepared before by a batch.
+ */
+class deoglRComponentLODTransformBatch{
+private:
+	struct sEntry{
+		deoglRComponentLOD *lod;
+		deoglRComponentLOD::eTransformStages lastStage;
+		int count;
+	};
+	
+	deoglRenderThread &pRenderThread;
+	decTList<sEntry> pEntries;
+	
+	
+	
+public:
+	/** Minimum count of elements in a task. */
+	static const int MinTaskElementCount = 2048;
+	
+	
+	
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/** Create batch. */
+	explicit deoglRComponentLODTransformBatch(deoglRenderThread &renderThread);
+	
+	/** Clean up batch. */
+	~deoglRComponentLODTransformBatch();
+	/*@}*/
+	
+	
+	
+	/** \name Management */
+	/*@{*/
+	/** Count of component LODs. */
+	inline int GetCount() const{ return pEntries.GetCount(); }
+	
+	/**
+	 * Add component LOD.
+	 * 
+	 * All stages up to and including \em lastStage are run. Component LODs are not
+	 * allowed to be added more than once.
+	 */
+	void Add(deoglRComponentLOD &lod, deoglRComponentLOD::eTransformStages lastStage);
+	
+	/** Remove all component LODs. */
+	void RemoveAll();
+	
+	/** Run all stages and wait for them to finish. */
+	void Run();
+	/*@}*/
+	
+	
+	
+private:
+	void pRunStage(deoglRComponentLOD::eTransformStages stage);
+};
+
+#endif
@@ -0,0 +1,96 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "deoglRComponentLODTransformTask.h"
+#include "../deGraphicOpenGl.h"
+#include "../renderthread/deoglRenderThread.h"
+#include "../renderthread/deoglRTLogger.h"
+
+#include <dragengine/common/exceptions.h>
+
+
+// Class deoglRComponentLODTransformTask
+//////////////////////////////////////////
+
+// Constructor, destructor
+////////////////////////////
+
+deoglRComponentLODTransformTask::deoglRComponentLODTransformTask(
+	deoglRenderThread &renderThread, deoglRComponentLOD::eTransformStages stage) :
+deParallelTask(&renderThread.GetOgl()),
+pRenderThread(renderThread),
+pStage(stage),
+pElementCount(0),
+pSuccess(false)
+{
+	SetMarkFinishedAfterRun(true);
+}
+
+deoglRComponentLODTransformTask::~deoglRComponentLODTransformTask(){
+}
+
+
+
+// Management
+///////////////
+
+void deoglRComponentLODTransformTask::AddRange(deoglRComponentLOD &lod, int first, int count){
+	pRanges.Add({&lod, first, count});
+	pElementCount += count;
+}
+
+void deoglRComponentLODTransformTask::Run(){
+	if(IsCancelled()){
+		pSemaphore.Signal();
+		return;
+	}
+	
+	try{
+		pRanges.Visit([&](const sRange &range){
+			range.lod->TransformStageRange(pStage, range.first, range.count);
+		});
+		
+	}catch(const deException &e){
+		pRenderThread.GetLogger().LogException(e);
+		pSemaphore.Signal();
+		throw;
+	}
+	
+	pSuccess = true;
+	pSemaphore.Signal();
+}
+
+void deoglRComponentLODTransformTask::Finished(){
+	pSemaphore.Signal(); // in case cancelled before run finished
+}
+
+decString deoglRComponentLODTransformTask::GetDebugName() const{
+	return "ComponentLODTransform";
+}
+
+decString deoglRComponentLODTransformTask::GetDebugDetails() const{
+	decString details;
+	details.Format("stage=%d ranges=%d elements=%d", pStage, pRanges.GetCount(), pElementCount);
+	return details;
+}
@@ -0,0 +1,105 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DEOGLRCOMPONENTLODTRANSFORMTASK_H_
+#define _DEOGLRCOMPONENTLODTRANSFORMTASK_H_
+
+#include "deoglRComponentLOD.h"
+
+#include <dragengine/common/collection/decTList.h>
+#include <dragengine/parallel/deParallelTask.h>
+#include <dragengine/threading/deSemaphore.h>
+
+class deoglRenderThread;
+
+
+/**
+ * Parallel task running a vertex transform stage on ranges of component LODs.
+ */
+class deoglRComponentLODTransformTask : public deParallelTask{
+public:
+	/** \brief Type holding strong reference. */
+	using Ref = deTThreadSafeObjectReference<deoglRComponentLODTransformTask>;
+	
+	/** Range of elements to transform. */
+	struct sRange{
+		deoglRComponentLOD *lod;
+		int first;
+		int count;
+	};
+	
+	
+	
+private:
+	deoglRenderThread &pRenderThread;
+	const deoglRComponentLOD::eTransformStages pStage;
+	decTList<sRange> pRanges;
+	int pElementCount;
+	bool pSuccess;
+	deSemaphore pSemaphore;
+	
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/** Create task. */
+	deoglRComponentLODTransformTask(deoglRenderThread &renderThread,
+		deoglRComponentLOD::eTransformStages stage);
+	
+	/** Clean up task. */
+	~deoglRComponentLODTransformTask() override;
+	/*@}*/
+	
+	
+	
+	/** \name Management */
+	/*@{*/
+	/** Count of elements to transform in all ranges. */
+	inline int GetElementCount() const{ return pElementCount; }
+	
+	/** Add range. Call only before adding task to parallel processing. */
+	void AddRange(deoglRComponentLOD &lod, int first, int count);
+	
+	/** Ranges have been transformed successfully. */
+	inline bool GetSuccess() const{ return pSuccess; }
+	
+	/** Finished semaphore. */
+	inline deSemaphore &GetSemaphore(){ return pSemaphore; }
+	
+	/** Run task. */
+	void Run() override;
+	
+	/** Task finished. */
+	void Finished() override;
+	
+	/** Debug name. */
+	decString GetDebugName() const override;
+	
+	/** Debug details. */
+	decString GetDebugDetails() const override;
+	/*@}*/
+};
+
+#endif
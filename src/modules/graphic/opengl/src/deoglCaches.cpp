@@ -30,7 +30,8 @@
 #include "deGraphicOpenGl.h"
 
 #include <dragengine/common/exceptions.h>
-#include <dragengine/filesystem/deCacheHelper.h>
+#include <dragengine/filesystem/deCachePack.h>
+#include <dragengine/filesystem/deCollectFileSearchVisitor.h>
 #include <dragengine/filesystem/deVirtualFileSystem.h>
 #include <dragengine/deEngine.h>
 
@@ -48,17 +49,10 @@ pSkinTextures(nullptr),
 pModels(nullptr),
 pShaders(nullptr)
 {
-	(void)pOgl;
-	
 	try{
-		pSkinTextures = new deCacheHelper(&ogl.GetVFS(),
-			decPath::CreatePathUnix("/cache/local/skintextures"));
-		
-		pModels = new deCacheHelper(&ogl.GetVFS(),
-			decPath::CreatePathUnix("/cache/local/models"));
-		
-		pShaders = new deCacheHelper(&ogl.GetVFS(),
-			decPath::CreatePathUnix("/cache/global/shaders"));
+		pSkinTextures = pCreateCache("/cache/local/skintextures");
+		pModels = pCreateCache("/cache/local/models");
+		pShaders = pCreateCache("/cache/global/shaders");
 		
 	}catch(const deException &){
 		pCleanUp();
@@ -86,3 +80,19 @@ void deoglCaches::pCleanUp(){
 		delete pShaders;
 	}
 }
+
+deCachePack *deoglCaches::pCreateCache(const char *path){
+	const decPath cachePath(decPath::CreatePathUnix(path));
+	deVirtualFileSystem &vfs = pOgl.GetVFS();
+	
+	// delete files left behind by the file per entry cache used before
+	deCollectFileSearchVisitor collect("f*");
+	vfs.SearchFiles(cachePath, collect);
+	collect.GetFiles().Visit([&](const decPath &file){
+		vfs.DeleteFile(file);
+	});
+	
+	deCachePack * const cache = new deCachePack(&vfs, cachePath);
+	cache->SetCompressionMethod(deCachePack::ecmFastCompression);
+	return cache;
+}
@@ -27,7 +27,7 @@
 
 #include <dragengine/threading/deMutex.h>
 
-class deCacheHelper;
+class deCachePack;
 class deGraphicOpenGl;
 
 
@@ -40,9 +40,9 @@ private:
 	deGraphicOpenGl &pOgl;
 	deMutex pMutex;
 	
-	deCacheHelper *pSkinTextures;
-	deCacheHelper *pModels;
-	deCacheHelper *pShaders;
+	deCachePack *pSkinTextures;
+	deCachePack *pModels;
+	deCachePack *pShaders;
 	
 	
 	
@@ -64,18 +64,19 @@ public:
 	inline deMutex &GetMutex(){ return pMutex; }
 	
 	/** Skin textures cache. */
-	inline deCacheHelper &GetSkinTextures() const{ return *pSkinTextures; }
+	inline deCachePack &GetSkinTextures() const{ return *pSkinTextures; }
 	
 	/** Model cache. */
-	inline deCacheHelper &GetModels() const{ return *pModels; }
+	inline deCachePack &GetModels() const{ return *pModels; }
 	
 	/** Shaders cache. */
-	inline deCacheHelper &GetShaders() const{ return *pShaders; }
+	inline deCachePack &GetShaders() const{ return *pShaders; }
 	
 	
 	
 private:
 	void pCleanUp();
+	deCachePack *pCreateCache(const char *path);
 };
 
 #endif
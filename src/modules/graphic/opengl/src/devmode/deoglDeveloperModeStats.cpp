@@ -32,6 +32,7 @@
 #include "../capabilities/deoglCapabilities.h"
 #include "../capabilities/deoglCapsTextureFormat.h"
 #include "../extensions/deoglExtensions.h"
+#include "../gi/deoglGI.h"
 #include "../sptree/deoglSPTree.h"
 #include "../skin/deoglSkin.h"
 #include "../skin/deoglSkinTexture.h"
@@ -120,6 +121,7 @@ void deoglDeveloperModeStats::Help(decUnicodeString &answer){
 	answer.AppendFromUTF8("renderables_depth_cubemap => Displays renderable depth cubemaps stats.\n");
 	answer.AppendFromUTF8("shared_vbos => Displays shared vbo stats (large list).\n");
 	answer.AppendFromUTF8("texture_units_configuration {verbose} => Displays texture units configurations stats (large list).\n");
+	answer.AppendFromUTF8("bvh {reset} => Displays BVH build statistics. Optionally reset statistics afterwards.\n");
 }
 
 void deoglDeveloperModeStats::Stats(const decUnicodeArgumentList &command, decUnicodeString &answer){
@@ -157,6 +159,9 @@ void deoglDeveloperModeStats::Stats(const decUnicodeArgumentList &command, decUn
 		}else if(command.MatchesArgumentAt(1, "texture_units_configuration") || command.MatchesArgumentAt(1, "tuc")){
 			TextureUnitsConfigurations(command, answer);
 			
+		}else if(command.MatchesArgumentAt(1, "bvh")){
+			BVH(command, answer);
+			
 		}else{
 			Help(answer);
 		}
@@ -673,3 +678,46 @@ void deoglDeveloperModeStats::TextureUnitsConfigurations(const decUnicodeArgumen
 		i++;
 	}
 }
+
+void deoglDeveloperModeStats::BVH(const decUnicodeArgumentList &command, decUnicodeString &answer){
+	deoglGIBVHShared &bvhShared = pRenderThread.GetGI().GetBVHShared();
+	
+	pBVHStatistics("GI model BVHs", bvhShared.GetStatisticsLocal(), answer);
+	pBVHStatistics("GI instance BVHs", bvhShared.GetStatisticsInstance(), answer);
+	
+	if(command.GetArgumentCount() > 2 && command.MatchesArgumentAt(2, "reset")){
+		bvhShared.ResetStatistics();
+		answer.AppendFromUTF8("Statistics reset\n");
+	}
+}
+
+
+
+// Private Functions
+//////////////////////
+
+void deoglDeveloperModeStats::pBVHStatistics(const char *name,
+const deoglGIBVHShared::sBuildStatistics &statistics, decUnicodeString &answer){
+	decString text;
+	
+	text.Format("%s: builds=%d\n", name, statistics.buildCount);
+	answer.AppendFromUTF8(text.GetString());
+	
+	if(statistics.buildCount == 0){
+		return;
+	}
+	
+	const double factor = 1.0 / (double)statistics.buildCount;
+	text.Format("- average: time=%.3fms nodes=%.1f sah=%.2f\n", statistics.buildTime * factor * 1e3,
+		statistics.nodeCount * factor, statistics.sahCost * factor);
+	answer.AppendFromUTF8(text.GetString());
+	
+	text.Format("- maximum: time=%.3fms\n", statistics.maxBuildTime * 1e3f);
+	answer.AppendFromUTF8(text.GetString());
+	
+	const deoglBVH::sStatistics &last = statistics.last;
+	text.Format("- last: time=%.3fms nodes=%d leaves=%d depth=%d maxLeafPrimitives=%d sah=%.2f\n",
+		last.buildTime * 1e3f, last.nodeCount, last.leafCount, last.depth,
+		last.maxLeafPrimitiveCount, last.sahCost);
+	answer.AppendFromUTF8(text.GetString());
+}
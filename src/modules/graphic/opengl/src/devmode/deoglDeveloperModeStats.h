@@ -27,6 +27,8 @@
 
 #include <dragengine/common/math/decMath.h>
 
+#include "../gi/deoglGIBVHShared.h"
+
 class deoglRenderThread;
 class decUnicodeArgumentList;
 class decUnicodeString;
@@ -78,7 +80,13 @@ public:
 	void SharedVBOs(const decUnicodeArgumentList &command, decUnicodeString &answer);
 	/** Texture units configurations. */
 	void TextureUnitsConfigurations(const decUnicodeArgumentList &command, decUnicodeString &answer);
+	/** BVH build statistics. */
+	void BVH(const decUnicodeArgumentList &command, decUnicodeString &answer);
 	/*@}*/
+	
+private:
+	void pBVHStatistics(const char *name, const deoglGIBVHShared::sBuildStatistics &statistics,
+		decUnicodeString &answer);
 };
 
 #endif
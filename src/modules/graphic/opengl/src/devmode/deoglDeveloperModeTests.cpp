@@ -29,6 +29,12 @@
 #include "deoglDeveloperModeTests.h"
 #include "../shaders/paramblock/deoglSPBlockUBO.h"
 #include "../shaders/paramblock/deoglSPBParameter.h"
+#include "../deGraphicOpenGl.h"
+#include "../renderthread/deoglRenderThread.h"
+#include "../model/deoglModelLOD.h"
+#include "../model/face/deoglModelFace.h"
+#include "../utils/deoglVertexTransformKernels.h"
+#include "../utils/bvh/deoglBVHBenchmark.h"
 #include "../utils/convexhull/deoglConvexHull2D.h"
 
 #include <dragengine/deEngine.h>
@@ -37,6 +43,8 @@
 #include <dragengine/common/string/decString.h>
 #include <dragengine/common/string/unicode/decUnicodeString.h>
 #include <dragengine/common/string/unicode/decUnicodeArgumentList.h>
+#include <dragengine/common/utils/decTimer.h>
+#include <dragengine/parallel/deParallelProcessing.h>
 
 
 
@@ -83,6 +91,8 @@ void deoglDeveloperModeTests::Help(decUnicodeString &answer){
 	answer.AppendFromUTF8("where <mode> can be:\n");
 	answer.AppendFromUTF8("shaderParameterBlock => Test deoglSPBlockUBO.\n");
 	answer.AppendFromUTF8("convexHull2D => Test deoglConvexHull2D.\n");
+	answer.AppendFromUTF8("bvhBenchmark [triangles] => Benchmark deoglBVH builders and ray casting.\n");
+	answer.AppendFromUTF8("vertexTransform [vertices] => Test and time deoglVertexTransformKernels.\n");
 }
 
 void deoglDeveloperModeTests::Tests(const decUnicodeArgumentList &command, decUnicodeString &answer){
@@ -96,6 +106,26 @@ void deoglDeveloperModeTests::Tests(const decUnicodeArgumentList &command, decUn
 				AnswerTestFailedWithException(answer, e);
 			}
 			
+		}else if(command.MatchesArgumentAt(1, "bvhBenchmark")){
+			const int triangleCount = command.GetArgumentCount() > 2 ? command.GetArgumentAt(2)->ToInt() : 10000;
+			try{
+				TestBVHBenchmark(triangleCount, answer);
+				AnswerTestPassed(answer);
+				
+			}catch(const deException &e){
+				AnswerTestFailedWithException(answer, e);
+			}
+			
+		}else if(command.MatchesArgumentAt(1, "vertexTransform")){
+			const int vertexCount = command.GetArgumentCount() > 2 ? command.GetArgumentAt(2)->ToInt() : 20000;
+			try{
+				TestVertexTransformKernels(vertexCount, answer);
+				AnswerTestPassed(answer);
+				
+			}catch(const deException &e){
+				AnswerTestFailedWithException(answer, e);
+			}
+			
 		}else{
 			Help(answer);
 		}
@@ -199,6 +229,151 @@ void deoglDeveloperModeTests::TestConvexHull2D(decUnicodeString &answer){
 
 
 
+void deoglDeveloperModeTests::TestBVHBenchmark(int triangleCount, decUnicodeString &answer){
+	deGraphicOpenGl &ogl = pRenderThread.GetOgl();
+	deoglBVHBenchmark(&ogl.GetGameEngine()->GetParallelProcessing(), &ogl).Run(triangleCount, answer);
+}
+
+
+
+void deoglDeveloperModeTests::TestVertexTransformKernels(int vertexCount, decUnicodeString &answer){
+	DEASSERT_TRUE(vertexCount > 0)
+	
+	const int boneCount = 64;
+	const int weightsCount = decMath::max(vertexCount / 4, 1);
+	const int faceCount = vertexCount * 2;
+	const int runCount = 10;
+	unsigned int randomState = 1234;
+	int i, j;
+	
+	const auto random = [&](float lower, float upper){
+		randomState = randomState * 1664525u + 1013904223u;
+		return lower + (upper - lower) * ((float)(randomState >> 8) / (float)(1u << 24));
+	};
+	const auto randomIndex = [&](int count){
+		return decMath::min((int)random(0.0f, (float)count), count - 1);
+	};
+	
+	// create synthetic skinned mesh
+	decTList<oglMatrix3x4> bones(boneCount);
+	for(i=0; i<boneCount; i++){
+		const decMatrix m(decMatrix::CreateRT(decVector(random(-3.0f, 3.0f),
+			random(-3.0f, 3.0f), random(-3.0f, 3.0f)), decVector(random(-1.0f, 1.0f),
+			random(-1.0f, 1.0f), random(-1.0f, 1.0f))));
+		bones.Add({m.a11, m.a12, m.a13, m.a14, m.a21, m.a22, m.a23, m.a24, m.a31, m.a32, m.a33, m.a34});
+	}
+	
+	decTList<int> weightsCounts(weightsCount);
+	decTList<oglModelWeight> weightsEntries;
+	for(i=0; i<weightsCount; i++){
+		const int entryCount = randomIndex(5);
+		weightsCounts.Add(entryCount);
+		for(j=0; j<entryCount; j++){
+			weightsEntries.Add({randomIndex(boneCount), 1.0f / (float)entryCount});
+		}
+	}
+	
+	decTList<oglModelPosition> positions(vertexCount);
+	decTList<oglModelVertex> vertices(vertexCount);
+	decTList<decVector2> texcoords(vertexCount);
+	for(i=0; i<vertexCount; i++){
+		const decVector position(random(-1.0f, 1.0f), random(-1.0f, 1.0f), random(-1.0f, 1.0f));
+		positions.Add({position, position.Normalized(), i % 10 == 0 ? -1 : randomIndex(weightsCount)});
+		vertices.Add({i, i, 0, 0});
+		texcoords.Add(decVector2(random(0.0f, 1.0f), random(0.0f, 1.0f)));
+	}
+	
+	decTList<deoglModelFace> faces;
+	faces.AddRange(faceCount, {});
+	for(i=0; i<faceCount; i++){
+		const int vertex = randomIndex(vertexCount);
+		faces[i].SetVertex1(vertex);
+		faces[i].SetVertex2(i % 50 == 0 ? vertex : randomIndex(vertexCount)); // degenerated
+		faces[i].SetVertex3(randomIndex(vertexCount));
+	}
+	
+	// run kernels
+	decTList<oglMatrix3x4> weights[2];
+	decTList<oglVector3> transformed[2], faceNormals[2], faceTangents[2];
+	float elapsed[2][3] = {};
+	decTimer timer;
+	
+	for(i=0; i<2; i++){
+		weights[i].AddRange(weightsCount, {});
+		transformed[i].AddRange(vertexCount, {});
+		faceNormals[i].AddRange(faceCount, {});
+		faceTangents[i].AddRange(faceCount, {});
+		
+		for(j=0; j<runCount; j++){
+			timer.Reset();
+			if(i == 0){
+				deoglVertexTransformKernels::Scalar::BlendWeights(bones.GetArrayPointer(),
+					weightsEntries.GetArrayPointer(), weightsCounts.GetArrayPointer(),
+					weights[i].GetArrayPointer(), weightsCount);
+				
+			}else{
+				deoglVertexTransformKernels::BlendWeights(bones.GetArrayPointer(),
+					weightsEntries.GetArrayPointer(), weightsCounts.GetArrayPointer(),
+					weights[i].GetArrayPointer(), weightsCount);
+			}
+			elapsed[i][0] += timer.GetElapsedTime();
+			
+			timer.Reset();
+			if(i == 0){
+				deoglVertexTransformKernels::Scalar::TransformPositions(weights[i].GetArrayPointer(),
+					positions.GetArrayPointer(), transformed[i].GetArrayPointer(), vertexCount);
+				
+			}else{
+				deoglVertexTransformKernels::TransformPositions(weights[i].GetArrayPointer(),
+					positions.GetArrayPointer(), transformed[i].GetArrayPointer(), vertexCount);
+			}
+			elapsed[i][1] += timer.GetElapsedTime();
+			
+			timer.Reset();
+			if(i == 0){
+				deoglVertexTransformKernels::Scalar::FaceNormalsTangents(transformed[i].GetArrayPointer(),
+					vertices.GetArrayPointer(), texcoords.GetArrayPointer(), faces.GetArrayPointer(),
+					faceNormals[i].GetArrayPointer(), faceTangents[i].GetArrayPointer(), faceCount);
+				
+			}else{
+				deoglVertexTransformKernels::FaceNormalsTangents(transformed[i].GetArrayPointer(),
+					vertices.GetArrayPointer(), texcoords.GetArrayPointer(), faces.GetArrayPointer(),
+					faceNormals[i].GetArrayPointer(), faceTangents[i].GetArrayPointer(), faceCount);
+			}
+			elapsed[i][2] += timer.GetElapsedTime();
+		}
+	}
+	
+	// compare results
+	const auto compare = [](const float *a, const float *b, int count, const char *name){
+		int k;
+		for(k=0; k<count; k++){
+			if(fabsf(a[k] - b[k]) > 1e-4f * decMath::max(fabsf(a[k]), 1.0f)){
+				decString message;
+				message.Format("%s differ at %d: %g != %g", name, k, a[k], b[k]);
+				DETHROW_INFO(deeTestFailed, message);
+			}
+		}
+	};
+	
+	compare(&weights[0].First().a11, &weights[1].First().a11, weightsCount * 12, "weights");
+	compare(&transformed[0].First().x, &transformed[1].First().x, vertexCount * 3, "positions");
+	compare(&faceNormals[0].First().x, &faceNormals[1].First().x, faceCount * 3, "face normals");
+	compare(&faceTangents[0].First().x, &faceTangents[1].First().x, faceCount * 3, "face tangents");
+	
+	decString text;
+	text.Format("Vertex transform kernels (%s): %d weights, %d vertices, %d faces\n",
+		deoglVertexTransformKernels::GetImplementationName(), weightsCount, vertexCount, faceCount);
+	answer.AppendFromUTF8(text);
+	
+	const char * const names[3] = {"blend weights", "transform positions", "face normals/tangents"};
+	for(i=0; i<3; i++){
+		text.Format("- %s: scalar %.3fms simd %.3fms\n", names[i],
+			elapsed[0][i] * 1e3f / (float)runCount, elapsed[1][i] * 1e3f / (float)runCount);
+		answer.AppendFromUTF8(text);
+	}
+}
+
 void deoglDeveloperModeTests::AnswerTestPassed(decUnicodeString &answer){
 	answer.AppendFromUTF8("Test passed\n");
 }
@@ -61,6 +61,12 @@ public:
 	/** Test 2d convex hull class. */
 	void TestConvexHull2D(decUnicodeString &answer);
 	
+	/** Benchmark BVH builders and ray casting. */
+	void TestBVHBenchmark(int triangleCount, decUnicodeString &answer);
+	
+	/** Compare vertex transform kernels against scalar implementation and time them. */
+	void TestVertexTransformKernels(int vertexCount, decUnicodeString &answer);
+	
 	/** Answer test passed. */
 	void AnswerTestPassed(decUnicodeString &answer);
 	/** Answer test failed with exception. */
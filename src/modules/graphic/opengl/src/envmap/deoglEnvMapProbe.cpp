@@ -47,7 +47,7 @@ deoglEnvMapProbe::deoglEnvMapProbe(deGraphicOpenGl &ogl, const deEnvMapProbe &en
 pOgl(ogl),
 pEnvMapProbe(envMapProbe),
 
-pDirtyOctreeNode(true),
+pDirtyEnvMapIndex(true),
 pDirtyEnvMapProbe(true),
 pDirtyMatrix(true),
 pDirtyInfluenceShape(true),
@@ -86,9 +86,9 @@ void deoglEnvMapProbe::SyncToRender(){
 		pDirtyMatrix = false;
 	}
 	
-	if(pDirtyOctreeNode){
-		pREnvMapProbe->GetEnvironmentMap()->UpdateOctreePosition();
-		pDirtyOctreeNode = false;
+	if(pDirtyEnvMapIndex){
+		pREnvMapProbe->GetEnvironmentMap()->UpdateEnvMapIndex();
+		pDirtyEnvMapIndex = false;
 	}
 	
 	if(pDirtyInfluenceShape){
@@ -110,28 +110,28 @@ void deoglEnvMapProbe::SyncToRender(){
 
 void deoglEnvMapProbe::PositionChanged(){
 	pDirtyMatrix = true;
-	pDirtyOctreeNode = true;
+	pDirtyEnvMapIndex = true;
 	pDirtyInfluenceShape = true;
 	pDirtyReflectionShape = true;
 }
 
 void deoglEnvMapProbe::OrientationChanged(){
 	pDirtyMatrix = true;
-	pDirtyOctreeNode = true;
+	pDirtyEnvMapIndex = true;
 	pDirtyInfluenceShape = true;
 	pDirtyReflectionShape = true;
 }
 
 void deoglEnvMapProbe::ScalingChanged(){
 	pDirtyMatrix = true;
-	pDirtyOctreeNode = true;
+	pDirtyEnvMapIndex = true;
 	pDirtyInfluenceShape = true;
 	pDirtyReflectionShape = true;
 }
 
 void deoglEnvMapProbe::ShapeListInfluenceChanged(){
 	pDirtyMatrix = true;
-	pDirtyOctreeNode = true;
+	pDirtyEnvMapIndex = true;
 	pDirtyInfluenceShape = true;
 }
 
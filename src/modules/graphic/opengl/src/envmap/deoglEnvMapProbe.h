@@ -43,7 +43,7 @@ private:
 	
 	deoglREnvMapProbe::Ref pREnvMapProbe;
 	
-	bool pDirtyOctreeNode;
+	bool pDirtyEnvMapIndex;
 	bool pDirtyEnvMapProbe;
 	bool pDirtyMatrix;
 	bool pDirtyInfluenceShape;
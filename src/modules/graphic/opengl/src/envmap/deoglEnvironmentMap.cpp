@@ -63,7 +63,6 @@
 #include "../triangles/deoglTriangleSorter.h"
 #include "../visibility/visitor/deoglVisCollectOccMeshes.h"
 #include "../world/deoglRWorld.h"
-#include "../world/deoglWorldOctree.h"
 //#include "../visibility/convexhull/deoglConvexVisHullBuilder.h"
 #include "../utils/collision/deoglDCollisionBox.h"
 
@@ -96,7 +95,7 @@ deoglEnvironmentMap::deoglEnvironmentMap(deoglRenderThread &renderThread) :
 pRenderThread(renderThread)
 {
 	pWorld = nullptr;
-	pOctreeNode = nullptr;
+	pEnvMapIndexElement = -1;
 	
 	pSkyOnly = true;
 	
@@ -120,7 +119,7 @@ pRenderThread(renderThread)
 	
 	pDirty = true;
 	pDirtyInit = true;
-	pDirtyOctreeNode = true;
+	pDirtyEnvMapIndex = true;
 	pReady = false;
 	pMaterialReady = false;
 	pNextUpdateFace = 0;
@@ -163,13 +162,12 @@ void deoglEnvironmentMap::SetWorld(deoglRWorld *world){
 	
 	pRemoveFromAllRenderPlans();
 	
-	pWorld = world;
-	
-	if(pOctreeNode){
-		pOctreeNode->RemoveEnvMap(this);
-		pOctreeNode = nullptr;
+	if(pWorld){
+		pWorld->RemoveEnvMapFromIndex(*this);
 	}
-	pDirtyOctreeNode = true;
+	
+	pWorld = world;
+	pDirtyEnvMapIndex = true;
 	
 	SetDirty(true);
 }
@@ -178,7 +176,7 @@ void deoglEnvironmentMap::SetPosition(const decDVector &position){
 	if(!position.IsEqualTo(pPosition)){
 		pPosition = position;
 		
-		pDirtyOctreeNode = true;
+		pDirtyEnvMapIndex = true;
 		SetDirty(true);
 		
 		if(pWorld){
@@ -189,19 +187,24 @@ void deoglEnvironmentMap::SetPosition(const decDVector &position){
 
 
 
-void deoglEnvironmentMap::UpdateOctreePosition(){
-	if(pDirtyOctreeNode){
-		if(!pSkyOnly && pWorld){
-			pWorld->GetOctree().InsertEnvMapIntoTree(this);
+void deoglEnvironmentMap::UpdateEnvMapIndex(){
+	if(pDirtyEnvMapIndex){
+		if(pWorld){
+			if(pSkyOnly){
+				pWorld->RemoveEnvMapFromIndex(*this);
+				
+			}else{
+				pWorld->UpdateEnvMapIndex(*this);
+			}
 		}
 		
-		pDirtyOctreeNode = false;
+		pDirtyEnvMapIndex = false;
 		SetDirty(true);
 	}
 }
 
-void deoglEnvironmentMap::SetOctreeNode(deoglWorldOctree *node){
-	pOctreeNode = node;
+void deoglEnvironmentMap::SetEnvMapIndexElement(int element){
+	pEnvMapIndexElement = element;
 }
 
 
@@ -215,6 +218,7 @@ void deoglEnvironmentMap::SetSkyOnly(bool skyOnly){
 		pSkyOnly = skyOnly;
 		SetDirty(true);
 		pDirtyInit = true;
+		pDirtyEnvMapIndex = true;
 	}
 }
 
@@ -887,7 +891,7 @@ void deoglEnvironmentMap::LightChanged(deoglRLight*){
 
 void deoglEnvironmentMap::PrepareQuickDispose(){
 	pWorld = nullptr;
-	pOctreeNode = nullptr;
+	pEnvMapIndexElement = -1;
 	
 	pComponentList.RemoveAll();
 	pBillboardList.RemoveAll();
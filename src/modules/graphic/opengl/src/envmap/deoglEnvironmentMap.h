@@ -48,7 +48,6 @@ class deoglLightVolume;
 class deoglRenderThread;
 class deoglRWorld;
 class deoglTexture;
-class deoglWorldOctree;
 
 
 
@@ -74,7 +73,7 @@ private:
 	
 	deoglRWorld *pWorld;
 	decDVector pPosition;
-	deoglWorldOctree *pOctreeNode;
+	int pEnvMapIndexElement;
 	
 	bool pSkyOnly;
 	
@@ -104,7 +103,7 @@ private:
 	
 	bool pDirty;
 	bool pDirtyInit;
-	bool pDirtyOctreeNode;
+	bool pDirtyEnvMapIndex;
 	bool pReady;
 	bool pMaterialReady;
 	int pNextUpdateFace;
@@ -151,12 +150,12 @@ public:
 	/** Sets the position. */
 	void SetPosition(const decDVector &position);
 	
-	/** Updates the octree position. */
-	void UpdateOctreePosition();
-	/** Retrieves the octree node or NULL if there is none. */
-	inline deoglWorldOctree *GetOctreeNode() const{ return pOctreeNode; }
-	/** Sets the octree node or NULL if there is none. */
-	void SetOctreeNode(deoglWorldOctree *node);
+	/** Updates the world environment map index. */
+	void UpdateEnvMapIndex();
+	/** Retrieves the world environment map index element or -1 if not indexed. */
+	inline int GetEnvMapIndexElement() const{ return pEnvMapIndexElement; }
+	/** Sets the world environment map index element or -1 if not indexed. */
+	void SetEnvMapIndexElement(int element);
 	
 	/** Determines if the sky only is rendered hence the env map is positionless. */
 	inline bool GetSkyOnly() const{ return pSkyOnly; }
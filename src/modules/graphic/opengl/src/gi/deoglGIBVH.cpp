@@ -29,11 +29,13 @@
 #include "deoglGIBVHShared.h"
 #include "deoglGIInstance.h"
 #include "deoglGIInstances.h"
+#include "../deGraphicOpenGl.h"
 #include "../capabilities/deoglCapabilities.h"
 #include "../collidelist/deoglCollideList.h"
 #include "../collidelist/deoglCollideListComponent.h"
 #include "../component/deoglRComponent.h"
 #include "../component/deoglRComponentLOD.h"
+#include "../component/deoglRComponentLODTransformBatch.h"
 #include "../component/deoglRComponentTexture.h"
 #include "../model/deoglModelLOD.h"
 #include "../model/deoglRModel.h"
@@ -62,7 +64,9 @@
 #include "../utils/collision/deoglCollisionBox.h"
 #include "../world/deoglRWorld.h"
 
+#include <dragengine/deEngine.h>
 #include <dragengine/common/exceptions.h>
+#include <dragengine/parallel/deParallelProcessing.h>
 
 
 // Class deoglGIBVH
@@ -123,6 +127,8 @@ void deoglGIBVH::AddComponents(deoglRenderPlan &plan, const deoglGIInstances &in
 	const int count = instances.GetInstanceCount();
 	int i;
 	
+	pTransformDynamicComponents(instances);
+	
 	for(i=0; i<count; i++){
 		deoglGIInstance &instance = instances.GetInstanceAt(i);
 		if(instance.GetComponent()){
@@ -139,6 +145,10 @@ void deoglGIBVH::AddComponents(deoglRenderPlan &plan, const deoglGIInstances &in
 	const int count = instances.GetInstanceCount();
 	int i;
 	
+	if(dynamic){
+		pTransformDynamicComponents(instances);
+	}
+	
 	for(i=0; i<count; i++){
 		deoglGIInstance &instance = instances.GetInstanceAt(i);
 		if(instance.GetComponent() && instance.GetDynamic() == dynamic){
@@ -263,7 +273,9 @@ void deoglGIBVH::BuildBVH(){
 			.center = enclosing.GetCenter()});
 	});
 	
-	pBVH.Build(pPrimitives, pComponents.GetCount(), 12);
+	deGraphicOpenGl &ogl = pRenderThread.GetOgl();
+	pBVH.BuildSAH(pPrimitives, pComponents.GetCount(), 12, &ogl.GetGameEngine()->GetParallelProcessing(), &ogl);
+	pRenderThread.GetGI().GetBVHShared().AddStatisticsInstance(pBVH);
 	
 	// add to TBOs using primitive mapping from BVH
 	pBVH.GetPrimitives().Visit([&](int &primitive){
@@ -377,6 +389,23 @@ void deoglGIBVH::pDropBlockBVH(){
 	}
 }
 
+void deoglGIBVH::pTransformDynamicComponents(const deoglGIInstances &instances){
+	// transform vertices of all dynamic components in parallel. AddComponent() finds
+	// the transformed vertices up to date and only has to update the dynamic BVH
+	deoglRComponentLODTransformBatch batch(pRenderThread);
+	const int count = instances.GetInstanceCount();
+	int i;
+	
+	for(i=0; i<count; i++){
+		const deoglGIInstance &instance = instances.GetInstanceAt(i);
+		if(instance.GetComponent() && instance.GetDynamic() && instance.GetHasBVHNodes()){
+			batch.Add(instance.GetComponent()->GetLODAt(-1), deoglRComponentLOD::etsPositions);
+		}
+	}
+	
+	batch.Run();
+}
+
 deoglGIBVH::sComponent &deoglGIBVH::pAddComponent(const deoglGIInstance &instance,
 int indexMaterial, const decMatrix &matrix){
 	pComponents.Add({});
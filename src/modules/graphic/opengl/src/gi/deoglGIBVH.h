@@ -274,6 +274,7 @@ public:
 	
 private:
 	void pDropBlockBVH();
+	void pTransformDynamicComponents(const deoglGIInstances &instances);
 	sComponent &pAddComponent(const deoglGIInstance &instance, int indexMaterial, const decMatrix &matrix);
 	
 	void pAddMaterial(deoglGIInstance &instance, int index,
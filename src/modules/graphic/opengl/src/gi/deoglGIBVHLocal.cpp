@@ -25,6 +25,8 @@
 #include "deoglGI.h"
 #include "deoglGIBVH.h"
 #include "deoglGIBVHLocal.h"
+#include "deoglGIBVHShared.h"
+#include "../deGraphicOpenGl.h"
 #include "../model/deoglModelLOD.h"
 #include "../model/face/deoglModelFace.h"
 #include "../renderthread/deoglRenderThread.h"
@@ -36,7 +38,9 @@
 #include "../tbo/deoglDynamicTBOBlock.h"
 #include "../tbo/deoglDynamicTBOShared.h"
 
+#include <dragengine/deEngine.h>
 #include <dragengine/common/exceptions.h>
+#include <dragengine/parallel/deParallelProcessing.h>
 
 
 // Class deoglGIBVHLocal
@@ -83,7 +87,9 @@ void deoglGIBVHLocal::Clear(){
 
 void deoglGIBVHLocal::BuildBVH(const decTList<deoglBVH::sBuildPrimitive> &primitives,
 int primitiveCount, int maxDepth){
-	pBVH.Build(primitives, primitiveCount, maxDepth);
+	deGraphicOpenGl &ogl = pRenderThread.GetOgl();
+	pBVH.BuildSAH(primitives, primitiveCount, maxDepth, &ogl.GetGameEngine()->GetParallelProcessing(), &ogl);
+	pRenderThread.GetGI().GetBVHShared().AddStatisticsLocal(pBVH);
 }
 
 void deoglGIBVHLocal::UpdateBVHExtends(){
@@ -106,7 +106,8 @@ public:
 	/**
 	 * Build tree. List of build primitives has to contain the boundary information for each
 	 * primitive in the same order the primitives are indexed. The array can be deleted after
-	 * build. BVH has to be present before faces can be added.
+	 * build. BVH has to be present before faces can be added. Uses the surface area heuristic
+	 * builder building large models in parallel.
 	 */
 	void BuildBVH(const decTList<deoglBVH::sBuildPrimitive> &primitives, int primitiveCount, int maxDepth = 12);
 	
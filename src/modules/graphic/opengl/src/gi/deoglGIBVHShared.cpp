@@ -76,6 +76,19 @@ deoglGIBVHShared::~deoglGIBVHShared(){
 // Management
 ///////////////
 
+void deoglGIBVHShared::AddStatisticsLocal(const deoglBVH &bvh){
+	pAddStatistics(pStatisticsLocal, bvh);
+}
+
+void deoglGIBVHShared::AddStatisticsInstance(const deoglBVH &bvh){
+	pAddStatistics(pStatisticsInstance, bvh);
+}
+
+void deoglGIBVHShared::ResetStatistics(){
+	pStatisticsLocal = {};
+	pStatisticsInstance = {};
+}
+
 
 
 // Private Functions
@@ -83,3 +96,14 @@ deoglGIBVHShared::~deoglGIBVHShared(){
 
 void deoglGIBVHShared::pCleanUp(){
 }
+
+void deoglGIBVHShared::pAddStatistics(sBuildStatistics &statistics, const deoglBVH &bvh){
+	const deoglBVH::sStatistics &bvhStatistics = bvh.GetStatistics();
+	
+	statistics.buildCount++;
+	statistics.buildTime += (double)bvhStatistics.buildTime;
+	statistics.maxBuildTime = decMath::max(statistics.maxBuildTime, bvhStatistics.buildTime);
+	statistics.nodeCount += (double)bvhStatistics.nodeCount;
+	statistics.sahCost += (double)bvhStatistics.sahCost;
+	statistics.last = bvhStatistics;
+}
@@ -55,6 +55,30 @@ class deoglTexUnitsConfig;
  * Global illumination BVH.
  */
 class deoglGIBVHShared{
+public:
+	/** BVH build statistics. */
+	struct sBuildStatistics{
+		/** Count of builds. */
+		int buildCount = 0;
+		
+		/** Sum of build times in seconds. */
+		double buildTime = 0.0;
+		
+		/** Longest build time in seconds. */
+		float maxBuildTime = 0.0f;
+		
+		/** Sum of node counts. */
+		double nodeCount = 0.0;
+		
+		/** Sum of surface area heuristic costs. */
+		double sahCost = 0.0;
+		
+		/** Statistics of last build. */
+		deoglBVH::sStatistics last;
+	};
+	
+	
+	
 private:
 	deoglRenderThread &pRenderThread;
 	
@@ -71,6 +95,9 @@ private:
 	deoglDynamicTBOShared::Ref pSharedTBOVertex;
 	deoglDynamicTBOShared::Ref pSharedTBOMaterial;
 	
+	sBuildStatistics pStatisticsLocal;
+	sBuildStatistics pStatisticsInstance;
+	
 	
 	
 public:
@@ -116,12 +143,30 @@ public:
 	inline const deoglDynamicTBOShared::Ref &GetSharedTBOFace() const{ return pSharedTBOFace; }
 	inline const deoglDynamicTBOShared::Ref &GetSharedTBOVertex() const{ return pSharedTBOVertex; }
 	inline const deoglDynamicTBOShared::Ref &GetSharedTBOMaterial() const{ return pSharedTBOMaterial; }
+	
+	
+	
+	/** Build statistics of model and decal BVHs. */
+	inline const sBuildStatistics &GetStatisticsLocal() const{ return pStatisticsLocal; }
+	
+	/** Build statistics of instance BVHs. */
+	inline const sBuildStatistics &GetStatisticsInstance() const{ return pStatisticsInstance; }
+	
+	/** Add build statistics of model or decal BVH. */
+	void AddStatisticsLocal(const deoglBVH &bvh);
+	
+	/** Add build statistics of instance BVH. */
+	void AddStatisticsInstance(const deoglBVH &bvh);
+	
+	/** Reset build statistics. */
+	void ResetStatistics();
 	/*@}*/
 	
 	
 	
 private:
 	void pCleanUp();
+	void pAddStatistics(sBuildStatistics &statistics, const deoglBVH &bvh);
 };
 
 #endif
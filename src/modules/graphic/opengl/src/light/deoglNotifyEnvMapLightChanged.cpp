@@ -28,7 +28,7 @@
 #include "deoglRLight.h"
 #include "deoglNotifyEnvMapLightChanged.h"
 
-#include "../world/deoglWorldOctree.h"
+#include "../world/deoglRWorld.h"
 #include "../envmap/deoglEnvironmentMap.h"
 
 #include <dragengine/common/exceptions.h>
@@ -45,7 +45,6 @@ deoglNotifyEnvMapLightChanged::deoglNotifyEnvMapLightChanged(deoglRLight &light)
 pLight(light)
 {
 	pLightBox.SetFromExtends(light.GetMinimumExtend(), light.GetMaximumExtend());
-	SetVisitEnvMaps(true);
 }
 
 
@@ -53,7 +52,15 @@ pLight(light)
 // Visiting
 /////////////
 
-void deoglNotifyEnvMapLightChanged::VisitEnvMaps(deoglEnvironmentMap *envmap){
+void deoglNotifyEnvMapLightChanged::VisitWorld(const deoglRWorld &world){
+	decTList<int> elements;
+	world.QueryEnvMapIndex(pLight.GetMinimumExtend(), pLight.GetMaximumExtend(), elements);
+	elements.Visit([&](int element){
+		VisitEnvMap(world.GetIndexedEnvMapAt(element));
+	});
+}
+
+void deoglNotifyEnvMapLightChanged::VisitEnvMap(deoglEnvironmentMap *envmap){
 	if(envmap->GetSkyOnly()){
 		return;
 	}
@@ -28,15 +28,17 @@
 #include <dragengine/common/math/decMath.h>
 #include "../utils/collision/deoglDCollisionBox.h"
 
-#include "../world/deoglDefaultWorldOctreeVisitor.h"
-
 class deoglRLight;
+class deoglRWorld;
+class deoglEnvironmentMap;
 
 
 /**
  * Notify touching environment maps light changed visitor.
+ * 
+ * Environment maps are found using the world environment map index.
  */
-class deoglNotifyEnvMapLightChanged : public deoglDefaultWorldOctreeVisitor{
+class deoglNotifyEnvMapLightChanged{
 private:
 	deoglRLight &pLight;
 	deoglDCollisionBox pLightBox;
@@ -53,8 +55,11 @@ public:
 	
 	/** \name Visiting */
 	/*@{*/
-	/** Visit environment maps. */
-	void VisitEnvMaps(deoglEnvironmentMap *envmap) override;
+	/** Visit environment maps touching light. */
+	void VisitWorld(const deoglRWorld &world);
+	
+	/** Visit environment map. */
+	void VisitEnvMap(deoglEnvironmentMap *envmap);
 	/*@}*/
 };
 
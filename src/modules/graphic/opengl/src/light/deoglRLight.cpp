@@ -754,7 +754,7 @@ void deoglRLight::EnvMapNotifyLightChanged(){
 	pUpdateExtends();
 	
 	deoglNotifyEnvMapLightChanged visitor(*this);
-	pParentWorld->VisitRegion(pMinExtend, pMaxExtend, visitor);
+	visitor.VisitWorld(*pParentWorld);
 }
 
 
@@ -42,7 +42,7 @@
 #include <dragengine/common/file/decBaseFileReader.h>
 #include <dragengine/common/file/decBaseFileWriter.h>
 #include <dragengine/common/utils/decTimer.h>
-#include <dragengine/filesystem/deCacheHelper.h>
+#include <dragengine/filesystem/deCachePack.h>
 #include <dragengine/filesystem/deVirtualFileSystem.h>
 #include <dragengine/resources/model/deModel.h>
 #include <dragengine/resources/model/deModelLOD.h>
@@ -418,7 +418,7 @@ void deoglRModel::pLoadCached(int lodCount, int boneCount){
 	deGraphicOpenGl &ogl = pRenderThread.GetOgl();
 	deVirtualFileSystem &vfs = *ogl.GetGameEngine()->GetVirtualFileSystem();
 	deoglCaches &caches = ogl.GetCaches();
-	deCacheHelper &cacheModels = caches.GetModels();
+	deCachePack &cacheModels = caches.GetModels();
 	decPath path;
 	
 	path.SetFromUnix(pFilename);
@@ -520,7 +520,7 @@ void deoglRModel::pSaveCached(){
 	deGraphicOpenGl &ogl = pRenderThread.GetOgl();
 	deVirtualFileSystem &vfs = *ogl.GetGameEngine()->GetVirtualFileSystem();
 	deoglCaches &caches = ogl.GetCaches();
-	deCacheHelper &cacheModels = caches.GetModels();
+	deCachePack &cacheModels = caches.GetModels();
 	decPath path;
 	
 	path.SetFromUnix(pFilename);
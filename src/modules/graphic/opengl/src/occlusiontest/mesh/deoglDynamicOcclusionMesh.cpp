@@ -59,7 +59,8 @@
 deoglDynamicOcclusionMesh::deoglDynamicOcclusionMesh(deoglRenderThread &renderThread,
 deoglROcclusionMesh *occlusionmesh, deoglRComponent *component) :
 pRenderThread(renderThread),
-pBVH(nullptr)
+pBVH(nullptr),
+pDirtyBVH(true)
 {
 	if(!occlusionmesh || !component){
 		DETHROW(deeInvalidParam);
@@ -105,6 +106,7 @@ void deoglDynamicOcclusionMesh::InvalidateVAO(){
 void deoglDynamicOcclusionMesh::ComponentStateChanged(){
 	pDirtyVBO = true;
 	pDirtyOccMesh = true;
+	pDirtyBVH = true;
 }
 
 void deoglDynamicOcclusionMesh::UpdateBoneMappings(const deComponent &component){
@@ -129,6 +131,7 @@ void deoglDynamicOcclusionMesh::UpdateBoneMappings(const deComponent &component)
 	});
 	
 	pDirtyVBO = true;
+	pDirtyBVH = true;
 }
 
 void deoglDynamicOcclusionMesh::PrepareForRender(){
@@ -146,7 +149,7 @@ void deoglDynamicOcclusionMesh::PrepareForRender(){
 }
 
 void deoglDynamicOcclusionMesh::PrepareBVH(){
-	if(pBVH){
+	if(pBVH && !pDirtyBVH){
 		return;
 	}
 	
@@ -170,6 +173,13 @@ void deoglDynamicOcclusionMesh::PrepareBVH(){
 		});
 	}
 	
+	// faces never change only vertices. refitting is a lot faster than rebuilding
+	if(pBVH){
+		pBVH->Refit(primitives);
+		pDirtyBVH = false;
+		return;
+	}
+	
 	try{
 		pBVH = new deoglBVH;
 		pBVH->Build(primitives, faceCount, 6);
@@ -181,6 +191,8 @@ void deoglDynamicOcclusionMesh::PrepareBVH(){
 		}
 		throw;
 	}
+	
+	pDirtyBVH = false;
 }
 
 
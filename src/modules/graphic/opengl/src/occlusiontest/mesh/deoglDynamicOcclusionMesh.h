@@ -63,6 +63,7 @@ public:
 	bool pDirtyVBO;
 	
 	deoglBVH *pBVH;
+	bool pDirtyBVH;
 	
 	
 	
@@ -110,7 +111,10 @@ public:
 	/** BVH or NULL. */
 	inline deoglBVH *GetBVH() const{ return pBVH; }
 	
-	/** Build BVH if not build yet. */
+	/**
+	 * Build BVH if not build yet. If vertices changed since the BVH has been build the
+	 * BVH is refitted instead of rebuild since the faces do not change.
+	 */
 	void PrepareBVH();
 	/*@}*/
 	
@@ -50,7 +50,7 @@
 #include <dragengine/common/exceptions.h>
 #include <dragengine/common/file/decBaseFileReader.h>
 #include <dragengine/common/file/decBaseFileWriter.h>
-#include <dragengine/filesystem/deCacheHelper.h>
+#include <dragengine/filesystem/deCachePack.h>
 #include <dragengine/parallel/deParallelProcessing.h>
 #include <dragengine/threading/deMutexGuard.h>
 
@@ -266,7 +266,7 @@ void deoglShaderCompiler::cCacheShader::Run(){
 	deoglRTLogger &logger = pRenderThread.GetLogger();
 #endif
 	deoglCaches &caches = pRenderThread.GetOgl().GetCaches();
-	deCacheHelper &cacheShaders = caches.GetShaders();
+	deCachePack &cacheShaders = caches.GetShaders();
 #ifdef WITH_DEBUG
 	decTimer timerElapsed;
 #endif
@@ -789,7 +789,7 @@ void deoglShaderCompiler::pCacheLoadShader(deoglShaderProgram &program){
 	const cGuardLoadingShader guardLoading(pLanguage);
 	
 	deoglCaches &caches = renderThread.GetOgl().GetCaches();
-	deCacheHelper &cacheShaders = caches.GetShaders();
+	deCachePack &cacheShaders = caches.GetShaders();
 	deoglRTLogger &logger = renderThread.GetLogger();
 	
 	try{
@@ -51,7 +51,7 @@
 #include <dragengine/common/exceptions.h>
 #include <dragengine/common/file/decBaseFileReader.h>
 #include <dragengine/common/file/decBaseFileWriter.h>
-#include <dragengine/filesystem/deCacheHelper.h>
+#include <dragengine/filesystem/deCachePack.h>
 #include <dragengine/threading/deMutexGuard.h>
 
 
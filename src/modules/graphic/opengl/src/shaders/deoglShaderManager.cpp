@@ -46,7 +46,7 @@
 #include <dragengine/common/file/decBaseFileReader.h>
 #include <dragengine/common/file/decBaseFileWriter.h>
 #include <dragengine/common/exceptions.h>
-#include <dragengine/filesystem/deCacheHelper.h>
+#include <dragengine/filesystem/deCachePack.h>
 #include <dragengine/filesystem/deCollectFileSearchVisitor.h>
 
 #include <dragengine/filesystem/deVFSDiskDirectory.h>
@@ -153,7 +153,7 @@ deoglShaderManager::~deoglShaderManager(){
 
 void deoglShaderManager::ValidateCaches(){
 	deGraphicOpenGl &ogl = pRenderThread.GetOgl();
-	deCacheHelper &cache = ogl.GetCaches().GetShaders();
+	deCachePack &cache = ogl.GetCaches().GetShaders();
 	deoglRTLogger &logger = pRenderThread.GetLogger();
 	
 	// validation string composes of the path and modification times of all shader sources (*.glsl)
@@ -74,7 +74,7 @@
 #include <dragengine/common/file/decBaseFileWriter.h>
 #include <dragengine/common/file/decMemoryFile.h>
 #include <dragengine/common/utils/decTimer.h>
-#include <dragengine/filesystem/deCacheHelper.h>
+#include <dragengine/filesystem/deCachePack.h>
 #include <dragengine/filesystem/deVirtualFileSystem.h>
 #include <dragengine/logger/deLogger.h>
 #include <dragengine/resources/image/deImage.h>
@@ -484,7 +484,7 @@ bool deoglSkinTexture::IsChannelEnabled(deoglSkinChannel::eChannelTypes type) co
 
 void deoglSkinTexture::DropAllCaches(){
 	deoglCaches &caches = pRenderThread.GetOgl().GetCaches();
-	deCacheHelper &cacheTextures = caches.GetSkinTextures();
+	deCachePack &cacheTextures = caches.GetSkinTextures();
 	int i;
 	
 	for(i=0; i<deoglSkinChannel::CHANNEL_COUNT; i++){
@@ -966,7 +966,7 @@ void deoglSkinTexture::pPrepareChannels(deoglRSkin &skin, const deSkinTexture &t
 void deoglSkinTexture::pLoadCached(deoglRSkin &skin){
 	// try to load caches using the calculated cache ids
 	deoglCaches &caches = pRenderThread.GetOgl().GetCaches();
-	deCacheHelper &cacheTextures = caches.GetSkinTextures();
+	deCachePack &cacheTextures = caches.GetSkinTextures();
 	int i;
 	
 	const bool enableCacheLogging = ENABLE_CACHE_LOGGING;
@@ -1352,7 +1352,7 @@ void deoglSkinTexture::pCompressTextures(deoglRSkin &skin, const deSkinTexture &
 
 void deoglSkinTexture::pWriteCached(deoglRSkin &skin){
 	deoglCaches &caches = pRenderThread.GetOgl().GetCaches();
-	deCacheHelper &cacheTextures = caches.GetSkinTextures();
+	deCachePack &cacheTextures = caches.GetSkinTextures();
 	int i;
 	
 	const bool enableCacheLogging = ENABLE_CACHE_LOGGING;
@@ -24,8 +24,76 @@
 
 #include "deoglBVH.h"
 #include "deoglBVHNode.h"
+#include "deoglBVHBuildTask.h"
 
 #include <dragengine/common/exceptions.h>
+#include <dragengine/common/utils/decTimer.h>
+#include <dragengine/parallel/deParallelProcessing.h>
+
+
+// Definitions
+////////////////
+
+namespace{
+
+// count of bins per axis used to find the best split
+constexpr int vBinCount = 16;
+
+// relative cost of visiting a node and testing a primitive used by the surface area heuristic
+constexpr float vCostTraversal = 1.0f;
+constexpr float vCostIntersect = 1.0f;
+
+// leaf nodes with more primitives than this are always split if possible even if the
+// surface area heuristic considers a leaf node cheaper
+constexpr int vMaxLeafPrimitiveCount = 8;
+
+// minimum count of primitives required to build sub trees in parallel
+constexpr int vParallelMinPrimitiveCount = 2048;
+
+// minimum count of primitives a sub tree build in parallel contains
+constexpr int vParallelMinSubTreePrimitiveCount = 512;
+
+struct sBin{
+	decVector minExtend, maxExtend;
+	int count;
+};
+
+inline float fAxis(const decVector &vector, int axis){
+	return axis == 0 ? vector.x : (axis == 1 ? vector.y : vector.z);
+}
+
+inline float fHalfArea(const decVector &minExtend, const decVector &maxExtend){
+	const decVector size(maxExtend - minExtend);
+	return size.x * size.y + size.y * size.z + size.z * size.x;
+}
+
+// make sure boundaries have at least a minimum thickness or else ray casting code
+// can fail to detect the box. slightly enlarging the box is fine enough and makes
+// hitting boxes more robust
+inline void fEnsureMinThickness(decVector &minExtend, decVector &maxExtend){
+	const float margin = 1e-5f; // 0.01mm
+	const decVector enlarge(decVector().Largest(decVector(margin, margin, margin) - (maxExtend - minExtend)) * 0.5f);
+	minExtend -= enlarge;
+	maxExtend += enlarge;
+}
+
+inline void fPrimitivesExtends(const decTList<deoglBVH::sBuildPrimitive> &primitives,
+const decTList<int> &indices, int first, int count, decVector &minExtend, decVector &maxExtend){
+	const deoglBVH::sBuildPrimitive &firstPrimitive = primitives[indices[first]];
+	minExtend = firstPrimitive.minExtend;
+	maxExtend = firstPrimitive.maxExtend;
+	
+	int i;
+	for(i=1; i<count; i++){
+		const deoglBVH::sBuildPrimitive &primitive = primitives[indices[first + i]];
+		minExtend.SetSmallest(primitive.minExtend);
+		maxExtend.SetLargest(primitive.maxExtend);
+	}
+	
+	fEnsureMinThickness(minExtend, maxExtend);
+}
+
+}
 
 
 // Class deoglBVH
@@ -58,17 +126,83 @@ void deoglBVH::Build(const decTList<sBuildPrimitive> &primitives, int primitiveC
 	DEASSERT_TRUE(primitiveCount >= 0)
 	DEASSERT_TRUE(maxDepth >= 0)
 	
+	decTimer timer;
+	
 	Clear();
 	
-	if(primitiveCount == 0){
-		return;
+	if(primitiveCount > 0){
+		pInitPrimitives(primitiveCount);
+		
+		pNodes.Add({0, primitiveCount});
+		
+		pBuildNode(primitives, primitiveCount, 0, maxDepth - 1);
+	}
+	
+	pUpdateStatistics(timer.GetElapsedTime());
+}
+
+void deoglBVH::BuildSAH(const decTList<sBuildPrimitive> &primitives, int primitiveCount,
+int maxDepth, deParallelProcessing *parallel, deBaseModule *owner){
+	DEASSERT_TRUE(primitiveCount >= 0)
+	DEASSERT_TRUE(maxDepth >= 0)
+	
+	decTimer timer;
+	
+	Clear();
+	
+	if(primitiveCount > 0){
+		pInitPrimitives(primitiveCount);
+		
+		pNodes.Add({0, primitiveCount});
+		
+		if(parallel && parallel->GetThreadCount() > 1 && primitiveCount >= vParallelMinPrimitiveCount){
+			// build the top of the tree in this thread until sub trees are small enough to
+			// keep all threads busy. then build the sub trees in parallel
+			const int deferCount = decMath::max(primitiveCount / (parallel->GetThreadCount() * 4),
+				vParallelMinSubTreePrimitiveCount);
+			decTList<sSubTree> subTrees;
+			pBuildNodeSAH(primitives, pNodes, 0, maxDepth - 1, deferCount, &subTrees);
+			pBuildSubTreesParallel(primitives, subTrees, *parallel, owner);
+			
+		}else{
+			pBuildNodeSAH(primitives, pNodes, 0, maxDepth - 1, 0, nullptr);
+		}
 	}
 	
-	pInitPrimitives(primitiveCount);
+	pUpdateStatistics(timer.GetElapsedTime());
+}
+
+void deoglBVH::Refit(const decTList<sBuildPrimitive> &primitives){
+	decTimer timer;
 	
-	pNodes.Add({0, primitiveCount});
+	// child nodes are always stored after their parent node. visiting nodes in reverse
+	// order thus updates child nodes before their parent nodes
+	int i;
+	for(i=pNodes.GetCount()-1; i>=0; i--){
+		deoglBVHNode &node = pNodes[i];
+		
+		if(node.IsLeaf()){
+			decVector minExtend, maxExtend;
+			fPrimitivesExtends(primitives, pPrimitives, node.GetFirstIndex(),
+				node.GetPrimitiveCount(), minExtend, maxExtend);
+			node.SetExtends(minExtend, maxExtend);
+			
+		}else{
+			const deoglBVHNode &nodeLeft = pNodes[node.GetFirstIndex()];
+			const deoglBVHNode &nodeRight = pNodes[node.GetFirstIndex() + 1];
+			node.SetExtends(nodeLeft.GetMinExtend().Smallest(nodeRight.GetMinExtend()),
+				nodeLeft.GetMaxExtend().Largest(nodeRight.GetMaxExtend()));
+		}
+	}
 	
-	pBuildNode(primitives, primitiveCount, 0, maxDepth - 1);
+	pUpdateStatistics(timer.GetElapsedTime());
+}
+
+void deoglBVH::BuildSubTreeSAH(const decTList<sBuildPrimitive> &primitives,
+decTList<deoglBVHNode> &nodes, int maxDepth){
+	DEASSERT_TRUE(nodes.GetCount() == 1)
+	
+	pBuildNodeSAH(primitives, nodes, 0, maxDepth, 0, nullptr);
 }
 
 
@@ -204,3 +338,270 @@ void deoglBVH::pBuildNode(const decTList<sBuildPrimitive> &primitives, int primi
 	pBuildNode(primitives, primitiveCount, indexLeftNode, maxDepth);
 	pBuildNode(primitives, primitiveCount, indexLeftNode + 1, maxDepth);
 }
+
+void deoglBVH::pBuildNodeSAH(const decTList<sBuildPrimitive> &primitives, decTList<deoglBVHNode> &nodes,
+int node, int maxDepth, int deferCount, decTList<sSubTree> *subTrees){
+	const int nodePrimitiveCount = nodes[node].GetPrimitiveCount();
+	const int nodeFirstIndex = nodes[node].GetFirstIndex();
+	
+	// calculate boundaries. we need this for all cases
+	decVector minExtend, maxExtend;
+	fPrimitivesExtends(primitives, pPrimitives, nodeFirstIndex, nodePrimitiveCount, minExtend, maxExtend);
+	nodes[node].SetExtends(minExtend, maxExtend);
+	
+	const decVector nodeSize(maxExtend - minExtend);
+	
+	if(nodePrimitiveCount < 2 || maxDepth == 0
+	|| !(nodeSize > decVector(FLOAT_SAFE_EPSILON, FLOAT_SAFE_EPSILON, FLOAT_SAFE_EPSILON))){
+		return;
+	}
+	
+	// sub trees small enough are build later in parallel
+	if(subTrees && nodePrimitiveCount <= deferCount){
+		subTrees->Add({node, maxDepth});
+		return;
+	}
+	
+	decVector minCenter(primitives[pPrimitives[nodeFirstIndex]].center);
+	decVector maxCenter(minCenter);
+	int i;
+	for(i=1; i<nodePrimitiveCount; i++){
+		const decVector &center = primitives[pPrimitives[nodeFirstIndex + i]].center;
+		minCenter.SetSmallest(center);
+		maxCenter.SetLargest(center);
+	}
+	
+	// sort primitives into bins along each axis using their center
+	const decVector centerSize(maxCenter - minCenter);
+	sBin bins[3][vBinCount] = {};
+	float binScale[3];
+	int axis;
+	
+	for(axis=0; axis<3; axis++){
+		const float size = fAxis(centerSize, axis);
+		binScale[axis] = size > FLOAT_SAFE_EPSILON ? (float)vBinCount * 0.9999f / size : 0.0f;
+	}
+	
+	for(i=0; i<nodePrimitiveCount; i++){
+		const sBuildPrimitive &primitive = primitives[pPrimitives[nodeFirstIndex + i]];
+		
+		for(axis=0; axis<3; axis++){
+			if(binScale[axis] == 0.0f){
+				continue;
+			}
+			
+			const int index = decMath::clamp((int)((fAxis(primitive.center, axis)
+				- fAxis(minCenter, axis)) * binScale[axis]), 0, vBinCount - 1);
+			sBin &bin = bins[axis][index];
+			
+			if(bin.count == 0){
+				bin.minExtend = primitive.minExtend;
+				bin.maxExtend = primitive.maxExtend;
+				
+			}else{
+				bin.minExtend.SetSmallest(primitive.minExtend);
+				bin.maxExtend.SetLargest(primitive.maxExtend);
+			}
+			bin.count++;
+		}
+	}
+	
+	// find the split with the lowest cost. split index is the first bin on the right side
+	float bestCost = 0.0f;
+	int bestAxis = -1;
+	int bestSplit = 0;
+	
+	for(axis=0; axis<3; axis++){
+		if(binScale[axis] == 0.0f){
+			continue;
+		}
+		
+		const sBin * const axisBins = bins[axis];
+		float rightCost[vBinCount];
+		decVector sweepMin, sweepMax;
+		int sweepCount = 0;
+		
+		for(i=vBinCount-1; i>0; i--){
+			const sBin &bin = axisBins[i];
+			if(bin.count > 0){
+				if(sweepCount == 0){
+					sweepMin = bin.minExtend;
+					sweepMax = bin.maxExtend;
+					
+				}else{
+					sweepMin.SetSmallest(bin.minExtend);
+					sweepMax.SetLargest(bin.maxExtend);
+				}
+				sweepCount += bin.count;
+			}
+			rightCost[i] = sweepCount > 0 ? fHalfArea(sweepMin, sweepMax) * (float)sweepCount : -1.0f;
+		}
+		
+		sweepCount = 0;
+		for(i=1; i<vBinCount; i++){
+			const sBin &bin = axisBins[i - 1];
+			if(bin.count > 0){
+				if(sweepCount == 0){
+					sweepMin = bin.minExtend;
+					sweepMax = bin.maxExtend;
+					
+				}else{
+					sweepMin.SetSmallest(bin.minExtend);
+					sweepMax.SetLargest(bin.maxExtend);
+				}
+				sweepCount += bin.count;
+			}
+			
+			if(sweepCount == 0 || rightCost[i] < 0.0f){
+				continue;
+			}
+			
+			const float cost = fHalfArea(sweepMin, sweepMax) * (float)sweepCount + rightCost[i];
+			if(bestAxis == -1 || cost < bestCost){
+				bestCost = cost;
+				bestAxis = axis;
+				bestSplit = i;
+			}
+		}
+	}
+	
+	// if no split is possible stop building this branch. the same is true if keeping a
+	// small node a leaf node is cheaper than splitting it
+	if(bestAxis == -1){
+		return;
+	}
+	
+	const float splitCost = vCostTraversal + vCostIntersect * bestCost / fHalfArea(minExtend, maxExtend);
+	if(nodePrimitiveCount <= vMaxLeafPrimitiveCount && splitCost >= vCostIntersect * (float)nodePrimitiveCount){
+		return;
+	}
+	
+	// distribute primitives across children. uses the same calculation as the binning
+	// to get the same result
+	const float splitMinCenter = fAxis(minCenter, bestAxis);
+	const float splitScale = binScale[bestAxis];
+	int walkerLeft = nodeFirstIndex;
+	int walkerRight = nodeFirstIndex + nodePrimitiveCount - 1;
+	
+	while(walkerLeft <= walkerRight){
+		const int temp = pPrimitives[walkerLeft];
+		const int index = decMath::clamp((int)((fAxis(primitives[temp].center, bestAxis)
+			- splitMinCenter) * splitScale), 0, vBinCount - 1);
+		
+		if(index < bestSplit){
+			walkerLeft++;
+			
+		}else{
+			pPrimitives[walkerLeft] = pPrimitives[walkerRight];
+			pPrimitives[walkerRight--] = temp;
+		}
+	}
+	
+	const int leftCount = walkerLeft - nodeFirstIndex;
+	if(leftCount == 0 || leftCount == nodePrimitiveCount){
+		return; // safety check. can not happen since bins on both sides are not empty
+	}
+	
+	// create child nodes. adding nodes potentially moves memory hence indices are used
+	const int indexLeftNode = nodes.GetCount();
+	nodes.Add({nodeFirstIndex, leftCount});
+	nodes.Add({nodeFirstIndex + leftCount, nodePrimitiveCount - leftCount});
+	
+	nodes[node].SetFirstIndex(indexLeftNode);
+	nodes[node].SetPrimitiveCount(0);
+	
+	maxDepth--;
+	pBuildNodeSAH(primitives, nodes, indexLeftNode, maxDepth, deferCount, subTrees);
+	pBuildNodeSAH(primitives, nodes, indexLeftNode + 1, maxDepth, deferCount, subTrees);
+}
+
+void deoglBVH::pBuildSubTreesParallel(const decTList<sBuildPrimitive> &primitives,
+const decTList<sSubTree> &subTrees, deParallelProcessing &parallel, deBaseModule *owner){
+	const int count = subTrees.GetCount();
+	decTList<deoglBVHBuildTask::Ref> tasks(count);
+	int i;
+	
+	for(i=0; i<count; i++){
+		const sSubTree &subTree = subTrees[i];
+		const deoglBVHBuildTask::Ref task(deoglBVHBuildTask::Ref::New(
+			owner, *this, primitives, pNodes[subTree.node], subTree.maxDepth));
+		tasks.Add(task);
+		parallel.AddTaskAsync(task);
+	}
+	
+	// merge sub trees in the same order they have been deferred. this keeps the
+	// resulting tree the same no matter in which order the tasks finish. the sub tree
+	// root node replaces the deferred node while the rest is appended with child node
+	// indices offset. sub trees of failed tasks stay leaf nodes
+	for(i=0; i<count; i++){
+		deoglBVHBuildTask &task = *tasks[i];
+		task.GetSemaphore().Wait();
+		
+		if(!task.GetSuccess()){
+			continue;
+		}
+		
+		const decTList<deoglBVHNode> &nodes = task.GetNodes();
+		const int offset = pNodes.GetCount() - 1;
+		const int nodeCount = nodes.GetCount();
+		int j;
+		
+		pNodes.EnlargeCapacity(pNodes.GetCount() + nodeCount - 1);
+		
+		for(j=0; j<nodeCount; j++){
+			deoglBVHNode node(nodes[j]);
+			if(!node.IsLeaf()){
+				node.SetFirstIndex(node.GetFirstIndex() + offset);
+			}
+			
+			if(j == 0){
+				pNodes[subTrees[i].node] = node;
+				
+			}else{
+				pNodes.Add(node);
+			}
+		}
+	}
+}
+
+void deoglBVH::pUpdateStatistics(float buildTime){
+	pStatistics = {};
+	pStatistics.buildTime = buildTime;
+	
+	const int count = pNodes.GetCount();
+	if(count == 0){
+		return;
+	}
+	
+	// child nodes are always stored after their parent node. visiting nodes in order
+	// thus knows the depth of the parent node before the child node is visited
+	const deoglBVHNode &root = pNodes.First();
+	const float rootArea = decMath::max(fHalfArea(root.GetMinExtend(), root.GetMaxExtend()), FLOAT_SAFE_EPSILON);
+	decTList<int> depths;
+	depths.AddRange(count, 0);
+	depths[0] = 1;
+	
+	float sahCost = 0.0f;
+	int i;
+	
+	for(i=0; i<count; i++){
+		const deoglBVHNode &node = pNodes[i];
+		const float area = fHalfArea(node.GetMinExtend(), node.GetMaxExtend()) / rootArea;
+		
+		if(node.IsLeaf()){
+			pStatistics.leafCount++;
+			pStatistics.depth = decMath::max(pStatistics.depth, depths[i]);
+			pStatistics.maxLeafPrimitiveCount = decMath::max(
+				pStatistics.maxLeafPrimitiveCount, node.GetPrimitiveCount());
+			sahCost += area * vCostIntersect * (float)node.GetPrimitiveCount();
+			
+		}else{
+			depths[node.GetFirstIndex()] = depths[i] + 1;
+			depths[node.GetFirstIndex() + 1] = depths[i] + 1;
+			sahCost += area * vCostTraversal;
+		}
+	}
+	
+	pStatistics.nodeCount = count;
+	pStatistics.sahCost = sahCost;
+}
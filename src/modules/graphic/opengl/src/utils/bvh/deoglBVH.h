@@ -29,6 +29,8 @@
 #include <dragengine/common/math/decMath.h>
 
 class deoglBVHNode;
+class deBaseModule;
+class deParallelProcessing;
 
 
 /**
@@ -44,11 +46,40 @@ public:
 		decVector minExtend, maxExtend, center;
 	};
 	
+	/** Tree statistics. */
+	struct sStatistics{
+		/** Count of nodes. */
+		int nodeCount = 0;
+		
+		/** Count of leaf nodes. */
+		int leafCount = 0;
+		
+		/** Depth of the deepest leaf node. Root node has depth 1. */
+		int depth = 0;
+		
+		/** Largest count of primitives in a leaf node. */
+		int maxLeafPrimitiveCount = 0;
+		
+		/**
+		 * Surface area heuristic cost. Expected count of node visits plus primitive tests
+		 * of a ray hitting the root node. Lower cost means better tree quality.
+		 */
+		float sahCost = 0.0f;
+		
+		/** Time in seconds the last build or refit took. */
+		float buildTime = 0.0f;
+	};
+	
 	
 	
 private:
+	struct sSubTree{
+		int node, maxDepth;
+	};
+	
 	decTList<deoglBVHNode> pNodes;
 	decTList<int> pPrimitives;
+	sStatistics pStatistics;
 	
 	
 	
@@ -75,6 +106,8 @@ public:
 	/** Primitives. */
 	inline const decTList<int> &GetPrimitives() const{ return pPrimitives; }
 	
+	/** Tree statistics updated by Build(), BuildSAH() and Refit(). */
+	inline const sStatistics &GetStatistics() const{ return pStatistics; }
 	
 	
 	
@@ -90,6 +123,32 @@ public:
 	 * The array can be deleted after build.
 	 */
 	void Build(const decTList<sBuildPrimitive> &primitives, int primitiveCount, int maxDepth = 12);
+	
+	/**
+	 * Build tree using binned surface area heuristic. Produces better trees than Build()
+	 * at slightly higher build cost. List of build primitives has the same meaning as in
+	 * Build(). If parallel is not nullptr sub trees of large trees are built in parallel
+	 * tasks owned by owner. Returns after all tasks finished. Building in parallel results
+	 * in the same tree structure and primitive order as building in the calling thread
+	 * only. Only the order of nodes differs.
+	 */
+	void BuildSAH(const decTList<sBuildPrimitive> &primitives, int primitiveCount, int maxDepth = 12,
+		deParallelProcessing *parallel = nullptr, deBaseModule *owner = nullptr);
+	
+	/**
+	 * Refit node extends to changed primitive boundaries keeping the tree structure.
+	 * Suitable for deforming primitives as long as no primitives are added or removed.
+	 * The tree quality degrades the more the primitives move relative to each other.
+	 */
+	void Refit(const decTList<sBuildPrimitive> &primitives);
+	
+	/**
+	 * Build sub tree using binned surface area heuristic. First node in nodes is the root
+	 * node of the sub tree. Child node indices are relative to nodes.
+	 * \warning For use by deoglBVHBuildTask only.
+	 */
+	void BuildSubTreeSAH(const decTList<sBuildPrimitive> &primitives,
+		decTList<deoglBVHNode> &nodes, int maxDepth);
 	/*@}*/
 	
 	
@@ -97,6 +156,11 @@ public:
 protected:
 	void pInitPrimitives(int primitiveCount);
 	void pBuildNode(const decTList<sBuildPrimitive> &primitives, int primitiveCount, int node, int maxDepth);
+	void pBuildNodeSAH(const decTList<sBuildPrimitive> &primitives, decTList<deoglBVHNode> &nodes,
+		int node, int maxDepth, int deferCount, decTList<sSubTree> *subTrees);
+	void pBuildSubTreesParallel(const decTList<sBuildPrimitive> &primitives,
+		const decTList<sSubTree> &subTrees, deParallelProcessing &parallel, deBaseModule *owner);
+	void pUpdateStatistics(float buildTime);
 };
 
 #endif
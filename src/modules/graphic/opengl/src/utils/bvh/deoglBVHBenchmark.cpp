@@ -0,0 +1,431 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "deoglBVH.h"
+#include "deoglBVHNode.h"
+#include "deoglBVHRayCast.h"
+#include "deoglBVHBenchmark.h"
+
+#include <dragengine/common/exceptions.h>
+#include <dragengine/common/string/decString.h>
+#include <dragengine/common/string/unicode/decUnicodeString.h>
+#include <dragengine/common/utils/decTimer.h>
+
+
+// Definitions
+////////////////
+
+namespace{
+
+constexpr int vMaxDepth = 12;
+constexpr int vBuildRunCount = 5;
+constexpr int vRayCount = 20000;
+
+struct sTriangle{
+	decVector v1, v2, v3;
+};
+
+// deterministic random numbers so runs are comparable
+class cRandom{
+	unsigned int pState;
+	
+public:
+	explicit cRandom(unsigned int seed) : pState(seed){}
+	
+	float Next(){
+		pState = pState * 1664525u + 1013904223u;
+		return (float)(pState >> 8) / (float)(1u << 24);
+	}
+	
+	float Next(float lower, float upper){
+		return lower + (upper - lower) * Next();
+	}
+	
+	decVector NextVector(float lower, float upper){
+		const float x = Next(lower, upper);
+		const float y = Next(lower, upper);
+		return decVector(x, y, Next(lower, upper));
+	}
+};
+
+class cTriangleRayCast : public deoglBVHRayCast{
+	const decTList<sTriangle> &pTriangles;
+	int pHitPrimitive;
+	
+public:
+	explicit cTriangleRayCast(const decTList<sTriangle> &triangles) :
+	pTriangles(triangles), pHitPrimitive(-1){}
+	
+	inline int GetHitPrimitive() const{ return pHitPrimitive; }
+	
+	void Cast(deoglBVH &bvh){
+		pHitPrimitive = -1;
+		RayCast(bvh);
+	}
+	
+protected:
+	void RayCastPrimitive(int primitive) override{
+		// moeller-trumbore
+		const sTriangle &triangle = pTriangles[primitive];
+		const decVector edge1(triangle.v2 - triangle.v1);
+		const decVector edge2(triangle.v3 - triangle.v1);
+		const decVector p(pRayDirection % edge2);
+		const float det = edge1 * p;
+		if(fabsf(det) < 1e-12f){
+			return;
+		}
+		
+		const float invDet = 1.0f / det;
+		const decVector t(pRayOrigin - triangle.v1);
+		const float u = (t * p) * invDet;
+		if(u < 0.0f || u > 1.0f){
+			return;
+		}
+		
+		const decVector q(t % edge1);
+		const float v = (pRayDirection * q) * invDet;
+		if(v < 0.0f || u + v > 1.0f){
+			return;
+		}
+		
+		const float distance = (edge2 * q) * invDet;
+		if(distance >= 0.0f && distance < pHitDistance){
+			pHitDistance = distance;
+			pHitPrimitive = primitive;
+		}
+	}
+};
+
+struct sResult{
+	deoglBVH::sStatistics statistics;
+	float buildTime;
+	float rayTime;
+	double visitedNodes;
+	double testedPrimitives;
+	int hitCount;
+};
+
+void fCreatePrimitives(const decTList<sTriangle> &triangles, decTList<deoglBVH::sBuildPrimitive> &primitives){
+	primitives.SetCountDiscard(0);
+	primitives.EnlargeCapacity(triangles.GetCount());
+	
+	triangles.Visit([&](const sTriangle &triangle){
+		deoglBVH::sBuildPrimitive primitive;
+		primitive.minExtend = triangle.v1.Smallest(triangle.v2).Smallest(triangle.v3);
+		primitive.maxExtend = triangle.v1.Largest(triangle.v2).Largest(triangle.v3);
+		primitive.center = (primitive.minExtend + primitive.maxExtend) * 0.5f;
+		primitives.Add(primitive);
+	});
+}
+
+// triangles of roughly equal size scattered uniformly in a box
+void fCreateUniform(decTList<sTriangle> &triangles, int count){
+	cRandom random(1234);
+	int i;
+	
+	triangles.SetCountDiscard(0);
+	triangles.EnlargeCapacity(count);
+	
+	for(i=0; i<count; i++){
+		const decVector position(random.NextVector(-50.0f, 50.0f));
+		triangles.Add({position + random.NextVector(-0.5f, 0.5f),
+			position + random.NextVector(-0.5f, 0.5f),
+			position + random.NextVector(-0.5f, 0.5f)});
+	}
+}
+
+// dense clusters of small triangles of various size and a few large triangles. similar
+// to models with detailed parts and large flat parts
+void fCreateClustered(decTList<sTriangle> &triangles, int count){
+	cRandom random(5678);
+	decVector clusters[16];
+	float clusterSizes[16];
+	int i;
+	
+	for(i=0; i<16; i++){
+		clusters[i] = random.NextVector(-50.0f, 50.0f);
+		clusterSizes[i] = random.Next(0.5f, 8.0f);
+	}
+	
+	triangles.SetCountDiscard(0);
+	triangles.EnlargeCapacity(count);
+	
+	for(i=0; i<count; i++){
+		if(i % 200 == 0){
+			const decVector position(random.NextVector(-50.0f, 50.0f));
+			triangles.Add({position + random.NextVector(-20.0f, 20.0f),
+				position + random.NextVector(-20.0f, 20.0f),
+				position + random.NextVector(-20.0f, 20.0f)});
+			continue;
+		}
+		
+		const int cluster = (int)(random.Next() * 15.999f);
+		const float size = clusterSizes[cluster];
+		const decVector position(clusters[cluster] + random.NextVector(-size, size));
+		const float triangleSize = size * 0.05f;
+		triangles.Add({position + random.NextVector(-triangleSize, triangleSize),
+			position + random.NextVector(-triangleSize, triangleSize),
+			position + random.NextVector(-triangleSize, triangleSize)});
+	}
+}
+
+// rays starting inside the scene boundaries shooting across the entire scene
+void fCreateRays(decTList<decVector> &origins, decTList<decVector> &directions){
+	cRandom random(91011);
+	int i;
+	
+	origins.SetCountDiscard(0);
+	directions.SetCountDiscard(0);
+	
+	for(i=0; i<vRayCount; i++){
+		origins.Add(random.NextVector(-50.0f, 50.0f));
+		
+		decVector direction(random.NextVector(-1.0f, 1.0f));
+		if(direction.Length() < 0.01f){
+			direction.Set(0.0f, 0.0f, 1.0f);
+		}
+		directions.Add(direction.Normalized() * 150.0f);
+	}
+}
+
+void fVerifyTree(deoglBVH &bvh, const decTList<deoglBVH::sBuildPrimitive> &primitives){
+	// every primitive is referenced exactly once
+	const decTList<int> &indices = bvh.GetPrimitives();
+	decTList<bool> found;
+	found.AddRange(primitives.GetCount(), false);
+	
+	if(indices.GetCount() != primitives.GetCount()){
+		DETHROW_INFO(deeTestFailed, "Primitive count mismatch");
+	}
+	
+	indices.Visit([&](int index){
+		if(index < 0 || index >= primitives.GetCount() || found[index]){
+			DETHROW_INFO(deeTestFailed, "Primitive missing or duplicate");
+		}
+		found[index] = true;
+	});
+	
+	// every node contains its children and primitives. child nodes are stored after parent
+	const decTList<deoglBVHNode> &nodes = bvh.GetNodes();
+	const int nodeCount = nodes.GetCount();
+	int i, j;
+	
+	for(i=0; i<nodeCount; i++){
+		const deoglBVHNode &node = nodes[i];
+		const decVector &minExtend = node.GetMinExtend();
+		const decVector &maxExtend = node.GetMaxExtend();
+		
+		if(node.IsLeaf()){
+			for(j=0; j<node.GetPrimitiveCount(); j++){
+				const deoglBVH::sBuildPrimitive &primitive = primitives[indices[node.GetFirstIndex() + j]];
+				if(!(primitive.minExtend >= minExtend) || !(primitive.maxExtend <= maxExtend)){
+					DETHROW_INFO(deeTestFailed, "Primitive outside node");
+				}
+			}
+			
+		}else{
+			if(node.GetFirstIndex() <= i || node.GetFirstIndex() + 1 >= nodeCount){
+				DETHROW_INFO(deeTestFailed, "Invalid child node index");
+			}
+			for(j=0; j<2; j++){
+				const deoglBVHNode &child = nodes[node.GetFirstIndex() + j];
+				if(!(child.GetMinExtend() >= minExtend) || !(child.GetMaxExtend() <= maxExtend)){
+					DETHROW_INFO(deeTestFailed, "Child node outside node");
+				}
+			}
+		}
+	}
+}
+
+void fRayCast(deoglBVH &bvh, const decTList<sTriangle> &triangles, const decTList<decVector> &origins,
+const decTList<decVector> &directions, decTList<float> &hitDistances, sResult &result){
+	cTriangleRayCast rayCast(triangles);
+	decTimer timer;
+	int i;
+	
+	hitDistances.SetCountDiscard(0);
+	result.visitedNodes = 0.0;
+	result.testedPrimitives = 0.0;
+	result.hitCount = 0;
+	
+	for(i=0; i<vRayCount; i++){
+		rayCast.SetRay(origins[i], directions[i]);
+		rayCast.Cast(bvh);
+		
+		result.visitedNodes += (double)rayCast.GetVisitedNodeCount();
+		result.testedPrimitives += (double)rayCast.GetTestedPrimitiveCount();
+		if(rayCast.GetHitPrimitive() != -1){
+			result.hitCount++;
+		}
+		hitDistances.Add(rayCast.GetHitDistance());
+	}
+	
+	result.rayTime = timer.GetElapsedTime();
+	result.visitedNodes /= (double)vRayCount;
+	result.testedPrimitives /= (double)vRayCount;
+}
+
+void fVerifyHits(const decTList<float> &expected, const decTList<float> &hitDistances){
+	const int count = expected.GetCount();
+	int i;
+	for(i=0; i<count; i++){
+		if(fabsf(expected[i] - hitDistances[i]) > 1e-5f){
+			DETHROW_INFO(deeTestFailed, "Ray cast hit mismatch");
+		}
+	}
+}
+
+void fAppendResult(decUnicodeString &answer, const char *name, const sResult &result){
+	decString text;
+	text.Format("  %-13s build %8.3fms | nodes %5d leaves %5d depth %2d maxLeaf %5d sah %8.2f"
+		" | visited %7.1f tested %8.1f hits %5d rays %7.1fms\n", name, result.buildTime * 1e3f,
+		result.statistics.nodeCount, result.statistics.leafCount, result.statistics.depth,
+		result.statistics.maxLeafPrimitiveCount, result.statistics.sahCost,
+		result.visitedNodes, result.testedPrimitives, result.hitCount, result.rayTime * 1e3f);
+	answer.AppendFromUTF8(text);
+}
+
+}
+
+
+
+// Class deoglBVHBenchmark
+////////////////////////////
+
+// Constructor, destructor
+////////////////////////////
+
+deoglBVHBenchmark::deoglBVHBenchmark(deParallelProcessing *parallel, deBaseModule *owner) :
+pParallel(parallel),
+pOwner(owner){
+}
+
+deoglBVHBenchmark::~deoglBVHBenchmark(){
+}
+
+
+
+// Management
+///////////////
+
+void deoglBVHBenchmark::Run(int triangleCount, decUnicodeString &answer){
+	DEASSERT_TRUE(triangleCount > 0)
+	
+	decTList<sTriangle> triangles;
+	decTList<deoglBVH::sBuildPrimitive> primitives;
+	decTList<decVector> rayOrigins, rayDirections;
+	decTList<float> expectedHits, hitDistances;
+	decString text;
+	int scene, run;
+	
+	fCreateRays(rayOrigins, rayDirections);
+	
+	text.Format("BVH benchmark: %d triangles, max depth %d, %d rays\n", triangleCount, vMaxDepth, vRayCount);
+	answer.AppendFromUTF8(text);
+	
+	for(scene=0; scene<2; scene++){
+		if(scene == 0){
+			fCreateUniform(triangles, triangleCount);
+			answer.AppendFromUTF8("Uniform triangle soup:\n");
+			
+		}else{
+			fCreateClustered(triangles, triangleCount);
+			answer.AppendFromUTF8("Clustered triangle soup:\n");
+		}
+		
+		fCreatePrimitives(triangles, primitives);
+		
+		// midpoint builder. the first ray cast defines the expected hits
+		deoglBVH bvhMidpoint;
+		sResult result{};
+		for(run=0; run<vBuildRunCount; run++){
+			bvhMidpoint.Build(primitives, primitives.GetCount(), vMaxDepth);
+			result.buildTime += bvhMidpoint.GetStatistics().buildTime / (float)vBuildRunCount;
+		}
+		result.statistics = bvhMidpoint.GetStatistics();
+		fVerifyTree(bvhMidpoint, primitives);
+		fRayCast(bvhMidpoint, triangles, rayOrigins, rayDirections, expectedHits, result);
+		fAppendResult(answer, "midpoint", result);
+		
+		// surface area heuristic builder
+		deoglBVH bvhSAH;
+		result = {};
+		for(run=0; run<vBuildRunCount; run++){
+			bvhSAH.BuildSAH(primitives, primitives.GetCount(), vMaxDepth);
+			result.buildTime += bvhSAH.GetStatistics().buildTime / (float)vBuildRunCount;
+		}
+		result.statistics = bvhSAH.GetStatistics();
+		fVerifyTree(bvhSAH, primitives);
+		fRayCast(bvhSAH, triangles, rayOrigins, rayDirections, hitDistances, result);
+		fVerifyHits(expectedHits, hitDistances);
+		fAppendResult(answer, "sah", result);
+		
+		// parallel surface area heuristic builder has to produce the same tree
+		if(pParallel){
+			deoglBVH bvhParallel;
+			result = {};
+			for(run=0; run<vBuildRunCount; run++){
+				bvhParallel.BuildSAH(primitives, primitives.GetCount(), vMaxDepth, pParallel, pOwner);
+				result.buildTime += bvhParallel.GetStatistics().buildTime / (float)vBuildRunCount;
+			}
+			result.statistics = bvhParallel.GetStatistics();
+			fVerifyTree(bvhParallel, primitives);
+			if(bvhParallel.GetPrimitives() != bvhSAH.GetPrimitives()
+			|| bvhParallel.GetNodes().GetCount() != bvhSAH.GetNodes().GetCount()
+			|| fabsf(result.statistics.sahCost - bvhSAH.GetStatistics().sahCost) > 1e-3f * bvhSAH.GetStatistics().sahCost){
+				DETHROW_INFO(deeTestFailed, "Parallel build differs from sequential build");
+			}
+			fRayCast(bvhParallel, triangles, rayOrigins, rayDirections, hitDistances, result);
+			fVerifyHits(expectedHits, hitDistances);
+			fAppendResult(answer, "sah-parallel", result);
+		}
+		
+		// deform triangles. refit the sah tree and compare against rebuilding
+		cRandom random(1213);
+		triangles.Visit([&](sTriangle &triangle){
+			const decVector offset(random.NextVector(-2.0f, 2.0f));
+			triangle.v1 += offset;
+			triangle.v2 += offset;
+			triangle.v3 += offset;
+		});
+		fCreatePrimitives(triangles, primitives);
+		
+		result = {};
+		bvhSAH.Refit(primitives);
+		result.buildTime = bvhSAH.GetStatistics().buildTime;
+		result.statistics = bvhSAH.GetStatistics();
+		fVerifyTree(bvhSAH, primitives);
+		fRayCast(bvhSAH, triangles, rayOrigins, rayDirections, expectedHits, result);
+		fAppendResult(answer, "refit", result);
+		
+		result = {};
+		bvhSAH.BuildSAH(primitives, primitives.GetCount(), vMaxDepth, pParallel, pOwner);
+		result.buildTime = bvhSAH.GetStatistics().buildTime;
+		result.statistics = bvhSAH.GetStatistics();
+		fVerifyTree(bvhSAH, primitives);
+		fRayCast(bvhSAH, triangles, rayOrigins, rayDirections, hitDistances, result);
+		fVerifyHits(expectedHits, hitDistances);
+		fAppendResult(answer, "rebuild", result);
+	}
+}
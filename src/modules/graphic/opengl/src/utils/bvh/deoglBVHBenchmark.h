@@ -0,0 +1,77 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DEOGLBVHBENCHMARK_H_
+#define _DEOGLBVHBENCHMARK_H_
+
+class deBaseModule;
+class deParallelProcessing;
+class decUnicodeString;
+
+
+/**
+ * BVH build and ray cast benchmark.
+ * 
+ * Builds BVHs from synthetic triangle soups using the midpoint builder, the surface area
+ * heuristic builder and the parallel surface area heuristic builder. Compares build time,
+ * tree statistics and ray cast traversal cost using deoglBVHRayCast. Also compares
+ * refitting deformed triangles against rebuilding. Run using the developer mode command
+ * "dm_tests bvhBenchmark".
+ */
+class deoglBVHBenchmark{
+private:
+	deParallelProcessing *pParallel;
+	deBaseModule *pOwner;
+	
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/**
+	 * Create benchmark. If parallel is nullptr the parallel builder is not benchmarked.
+	 * Tasks are owned by owner.
+	 */
+	deoglBVHBenchmark(deParallelProcessing *parallel, deBaseModule *owner);
+	
+	/** Clean up benchmark. */
+	~deoglBVHBenchmark();
+	/*@}*/
+	
+	
+	
+	/** \name Management */
+	/*@{*/
+	/**
+	 * Run benchmark.
+	 * \param[in] triangleCount Count of triangles in each triangle soup.
+	 * \param[out] answer Results.
+	 * \throws deeInvalidParam triangleCount is less than 1.
+	 * \throws deeTestFailed Trees are not valid or ray casts find different hits.
+	 */
+	void Run(int triangleCount, decUnicodeString &answer);
+	/*@}*/
+};
+
+#endif
@@ -0,0 +1,98 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DEOGLBVHBUILDTASK_H_
+#define _DEOGLBVHBUILDTASK_H_
+
+#include "deoglBVH.h"
+#include "deoglBVHNode.h"
+
+#include <dragengine/parallel/deParallelTask.h>
+#include <dragengine/threading/deSemaphore.h>
+
+
+/**
+ * Parallel task building a sub tree of a BVH.
+ * 
+ * Builds the sub tree into a list of nodes owned by the task. The first node is the
+ * root node of the sub tree. Only the primitive indices of the root node are modified
+ * in the BVH. deoglBVH merges the nodes into the BVH after the task finished.
+ */
+class deoglBVHBuildTask : public deParallelTask{
+public:
+	/** \brief Type holding strong reference. */
+	using Ref = deTThreadSafeObjectReference<deoglBVHBuildTask>;
+	
+	
+private:
+	deoglBVH &pBVH;
+	const decTList<deoglBVH::sBuildPrimitive> &pPrimitives;
+	const int pPrimitiveCount;
+	const int pMaxDepth;
+	decTList<deoglBVHNode> pNodes;
+	bool pSuccess;
+	deSemaphore pSemaphore;
+	
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/** Create task. */
+	deoglBVHBuildTask(deBaseModule *owner, deoglBVH &bvh,
+		const decTList<deoglBVH::sBuildPrimitive> &primitives,
+		const deoglBVHNode &root, int maxDepth);
+	
+	/** Clean up task. */
+	~deoglBVHBuildTask() override;
+	/*@}*/
+	
+	
+	
+	/** \name Management */
+	/*@{*/
+	/** Nodes of sub tree. */
+	inline const decTList<deoglBVHNode> &GetNodes() const{ return pNodes; }
+	
+	/** Sub tree has been build successfully. */
+	inline bool GetSuccess() const{ return pSuccess; }
+	
+	/** Finished semaphore. */
+	inline deSemaphore &GetSemaphore(){ return pSemaphore; }
+	
+	/** Run task. */
+	void Run() override;
+	
+	/** Task finished. */
+	void Finished() override;
+	
+	/** Debug name. */
+	decString GetDebugName() const override;
+	
+	/** Debug details. */
+	decString GetDebugDetails() const override;
+	/*@}*/
+};
+
+#endif
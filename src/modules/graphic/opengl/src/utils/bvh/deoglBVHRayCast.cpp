@@ -39,7 +39,12 @@
 // Constructor, destructor
 ////////////////////////////
 
-deoglBVHRayCast::deoglBVHRayCast(){
+deoglBVHRayCast::deoglBVHRayCast() :
+pRayDirection(0.0f, 0.0f, 1.0f),
+pRayInvDirection(0.0f, 0.0f, 1.0f),
+pHitDistance(1.0f),
+pVisitedNodeCount(0),
+pTestedPrimitiveCount(0){
 }
 
 deoglBVHRayCast::~deoglBVHRayCast(){
@@ -50,7 +55,31 @@ deoglBVHRayCast::~deoglBVHRayCast(){
 // Management
 ///////////////
 
+void deoglBVHRayCast::SetRay(const decVector &origin, const decVector &direction){
+	pRayOrigin = origin;
+	pRayDirection = direction;
+	
+	// division by zero results in infinity which is handled properly by the slab test
+	pRayInvDirection.x = 1.0f / direction.x;
+	pRayInvDirection.y = 1.0f / direction.y;
+	pRayInvDirection.z = 1.0f / direction.z;
+}
+
+
+
+// Visiting
+/////////////
+
 void deoglBVHRayCast::RayCast(deoglBVH &bvh){
+	pHitDistance = 1.0f;
+	pVisitedNodeCount = 0;
+	pTestedPrimitiveCount = 0;
+	
+	deoglBVHNode * const rootNode = bvh.GetRootNode();
+	float distance;
+	if(rootNode && RayHitsNode(*rootNode, distance)){
+		RayCastNode(bvh, *rootNode);
+	}
 }
 
 
@@ -59,4 +88,57 @@ void deoglBVHRayCast::RayCast(deoglBVH &bvh){
 ////////////////////////
 
 void deoglBVHRayCast::RayCastNode(deoglBVH &bvh, deoglBVHNode &node){
+	pVisitedNodeCount++;
+	
+	if(node.IsLeaf()){
+		const int * const primitives = bvh.GetPrimitives().GetArrayPointer() + node.GetFirstIndex();
+		const int count = node.GetPrimitiveCount();
+		int i;
+		
+		for(i=0; i<count; i++){
+			RayCastPrimitive(primitives[i]);
+		}
+		pTestedPrimitiveCount += count;
+		return;
+	}
+	
+	deoglBVHNode &nodeLeft = bvh.GetNodeAt(node.GetFirstIndex());
+	deoglBVHNode &nodeRight = bvh.GetNodeAt(node.GetFirstIndex() + 1);
+	float distanceLeft, distanceRight;
+	const bool hitLeft = RayHitsNode(nodeLeft, distanceLeft);
+	const bool hitRight = RayHitsNode(nodeRight, distanceRight);
+	
+	// visit closer node first. the farther node is skipped if a closer hit is found
+	if(hitLeft && hitRight){
+		if(distanceRight < distanceLeft){
+			RayCastNode(bvh, nodeRight);
+			if(distanceLeft <= pHitDistance){
+				RayCastNode(bvh, nodeLeft);
+			}
+			
+		}else{
+			RayCastNode(bvh, nodeLeft);
+			if(distanceRight <= pHitDistance){
+				RayCastNode(bvh, nodeRight);
+			}
+		}
+		
+	}else if(hitLeft){
+		RayCastNode(bvh, nodeLeft);
+		
+	}else if(hitRight){
+		RayCastNode(bvh, nodeRight);
+	}
+}
+
+bool deoglBVHRayCast::RayHitsNode(const deoglBVHNode &node, float &distance) const{
+	const decVector t1((node.GetMinExtend() - pRayOrigin).Multiply(pRayInvDirection));
+	const decVector t2((node.GetMaxExtend() - pRayOrigin).Multiply(pRayInvDirection));
+	const decVector tmin(t1.Smallest(t2));
+	const decVector tmax(t1.Largest(t2));
+	const float enter = decMath::max(decMath::max(tmin.x, tmin.y), decMath::max(tmin.z, 0.0f));
+	const float leave = decMath::min(decMath::min(tmax.x, tmax.y), decMath::min(tmax.z, pHitDistance));
+	
+	distance = enter;
+	return enter <= leave;
 }
@@ -25,6 +25,8 @@
 #ifndef _DEOGLBVHRAYCAST_H_
 #define _DEOGLBVHRAYCAST_H_
 
+#include <dragengine/common/math/decMath.h>
+
 class deoglBVH;
 class deoglBVHNode;
 
@@ -35,8 +37,23 @@ class deoglBVHNode;
  * 
  * Subclass is responsible to to know how to resolve primitive indices. This class provides
  * basic handling of BVH traversal with the help of the subclass.
+ * 
+ * The ray is defined by an origin and a direction. The length of the direction is the
+ * length of the ray. Child nodes closer to the ray origin are visited first. Subclasses
+ * can shorten the ray while testing primitives to skip nodes farther away than the
+ * closest hit found so far.
  */
 class deoglBVHRayCast{
+protected:
+	decVector pRayOrigin;
+	decVector pRayDirection;
+	decVector pRayInvDirection;
+	float pHitDistance;
+	int pVisitedNodeCount;
+	int pTestedPrimitiveCount;
+	
+	
+	
 public:
 	/** \name Constructors and Destructors */
 	/*@{*/
@@ -49,6 +66,32 @@ public:
 	
 	
 	
+	/** \name Management */
+	/*@{*/
+	/** Ray origin. */
+	inline const decVector &GetRayOrigin() const{ return pRayOrigin; }
+	
+	/** Ray direction. */
+	inline const decVector &GetRayDirection() const{ return pRayDirection; }
+	
+	/** Set ray. */
+	void SetRay(const decVector &origin, const decVector &direction);
+	
+	/**
+	 * Distance along the ray relative to the ray length of the closest hit. 1 if no hit
+	 * has been found. Set by subclass while testing primitives.
+	 */
+	inline float GetHitDistance() const{ return pHitDistance; }
+	
+	/** Count of nodes visited during the last ray cast. */
+	inline int GetVisitedNodeCount() const{ return pVisitedNodeCount; }
+	
+	/** Count of primitives tested during the last ray cast. */
+	inline int GetTestedPrimitiveCount() const{ return pTestedPrimitiveCount; }
+	/*@}*/
+	
+	
+	
 	/** \name Visiting */
 	/*@{*/
 	/** Perform ray cast against BVH. */
@@ -59,6 +102,19 @@ public:
 protected:
 	/** Ray cast against node. */
 	void RayCastNode(deoglBVH &bvh, deoglBVHNode &node);
+	
+	/**
+	 * Ray hits node box. If hit stores the distance relative to the ray length where
+	 * the ray enters the box. Distance is 0 if the ray origin is inside the box.
+	 */
+	bool RayHitsNode(const deoglBVHNode &node, float &distance) const;
+	
+	/**
+	 * Ray cast against primitive. Primitive is the index of the primitive as used
+	 * while building the BVH. If the primitive is hit closer than GetHitDistance()
+	 * the subclass sets pHitDistance to the hit distance.
+	 */
+	virtual void RayCastPrimitive(int primitive) = 0;
 	/*@}*/
 };
 
@@ -0,0 +1,479 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <math.h>
+
+#include "deoglVertexTransformKernels.h"
+#include "../model/deoglModelLOD.h"
+#include "../model/face/deoglModelFace.h"
+
+#include <dragengine/common/math/decMath.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define OGL_VTK_SIMD
+	#define OGL_VTK_SSE2
+	#include <emmintrin.h>
+	
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	#define OGL_VTK_SIMD
+	#define OGL_VTK_NEON
+	#include <arm_neon.h>
+#endif
+
+static_assert(sizeof(oglVector3) == sizeof(float) * 3, "oglVector3 layout");
+static_assert(sizeof(oglMatrix3x4) == sizeof(float) * 12, "oglMatrix3x4 layout");
+
+
+
+// SIMD primitives
+////////////////////
+
+#ifdef OGL_VTK_SSE2
+
+typedef __m128 simdVec;
+typedef __m128 simdMask;
+
+static inline simdVec simdLoad(const float *p){ return _mm_loadu_ps(p); }
+static inline void simdStore(float *p, simdVec v){ _mm_storeu_ps(p, v); }
+static inline simdVec simdSplat(float v){ return _mm_set1_ps(v); }
+static inline simdVec simdSet(float x, float y, float z, float w){ return _mm_setr_ps(x, y, z, w); }
+static inline simdVec simdAdd(simdVec a, simdVec b){ return _mm_add_ps(a, b); }
+static inline simdVec simdSub(simdVec a, simdVec b){ return _mm_sub_ps(a, b); }
+static inline simdVec simdMul(simdVec a, simdVec b){ return _mm_mul_ps(a, b); }
+static inline simdVec simdDiv(simdVec a, simdVec b){ return _mm_div_ps(a, b); }
+static inline simdVec simdSqrt(simdVec v){ return _mm_sqrt_ps(v); }
+static inline simdMask simdNotZero(simdVec v){ return _mm_cmpneq_ps(v, _mm_setzero_ps()); }
+
+static inline simdVec simdSelect(simdMask mask, simdVec a, simdVec b){
+	return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+/** Store xyz components of v. */
+static inline void simdStore3(float *p, simdVec v){
+	_mm_storel_pi(reinterpret_cast<__m64*>(p), v);
+	_mm_store_ss(p + 2, _mm_movehl_ps(v, v));
+}
+
+/** Dot products of r1, r2 and r3 with v stored in xyz. */
+static inline simdVec simdDot3Rows(simdVec r1, simdVec r2, simdVec r3, simdVec v){
+	simdVec c1 = _mm_mul_ps(r1, v), c2 = _mm_mul_ps(r2, v);
+	simdVec c3 = _mm_mul_ps(r3, v), c4 = _mm_setzero_ps();
+	_MM_TRANSPOSE4_PS(c1, c2, c3, c4);
+	return _mm_add_ps(_mm_add_ps(_mm_add_ps(c1, c2), c3), c4);
+}
+
+/** Store xxxx, yyyy and zzzz as 4 interleaved xyz elements. */
+static inline void simdStore3x4(float *p, simdVec x, simdVec y, simdVec z){
+	_mm_storeu_ps(p, _mm_shuffle_ps(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)),
+		_mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)));
+	_mm_storeu_ps(p + 4, _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)),
+		_mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0)));
+	_mm_storeu_ps(p + 8, _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)),
+		_mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+}
+
+#elif defined(OGL_VTK_NEON)
+
+typedef float32x4_t simdVec;
+typedef uint32x4_t simdMask;
+
+static inline simdVec simdLoad(const float *p){ return vld1q_f32(p); }
+static inline void simdStore(float *p, simdVec v){ vst1q_f32(p, v); }
+static inline simdVec simdSplat(float v){ return vdupq_n_f32(v); }
+static inline simdVec simdAdd(simdVec a, simdVec b){ return vaddq_f32(a, b); }
+static inline simdVec simdSub(simdVec a, simdVec b){ return vsubq_f32(a, b); }
+static inline simdVec simdMul(simdVec a, simdVec b){ return vmulq_f32(a, b); }
+static inline simdVec simdDiv(simdVec a, simdVec b){ return vdivq_f32(a, b); }
+static inline simdVec simdSqrt(simdVec v){ return vsqrtq_f32(v); }
+static inline simdMask simdNotZero(simdVec v){ return vmvnq_u32(vceqq_f32(v, vdupq_n_f32(0.0f))); }
+static inline simdVec simdSelect(simdMask mask, simdVec a, simdVec b){ return vbslq_f32(mask, a, b); }
+
+static inline simdVec simdSet(float x, float y, float z, float w){
+	const float values[4] = {x, y, z, w};
+	return vld1q_f32(values);
+}
+
+static inline void simdStore3(float *p, simdVec v){
+	vst1_f32(p, vget_low_f32(v));
+	vst1q_lane_f32(p + 2, v, 2);
+}
+
+static inline simdVec simdDot3Rows(simdVec r1, simdVec r2, simdVec r3, simdVec v){
+	const simdVec c3 = vmulq_f32(r3, v);
+	return vpaddq_f32(vpaddq_f32(vmulq_f32(r1, v), vmulq_f32(r2, v)), vpaddq_f32(c3, c3));
+}
+
+static inline void simdStore3x4(float *p, simdVec x, simdVec y, simdVec z){
+	float32x4x3_t v;
+	v.val[0] = x;
+	v.val[1] = y;
+	v.val[2] = z;
+	vst3q_f32(p, v);
+}
+
+#endif
+
+
+
+// Class deoglVertexTransformKernels::Scalar
+//////////////////////////////////////////////
+
+void deoglVertexTransformKernels::Scalar::BlendWeights(const oglMatrix3x4 *bones,
+const oglModelWeight *entries, const int *counts, oglMatrix3x4 *weights, int count){
+	int w, e;
+	
+	for(w=0; w<count; w++){
+		oglMatrix3x4 &weightsMatrix = weights[w];
+		const int entryCount = counts[w];
+		
+		if(entryCount == 0){
+			weightsMatrix.a11 = 1.0f;
+			weightsMatrix.a12 = 0.0f;
+			weightsMatrix.a13 = 0.0f;
+			weightsMatrix.a14 = 0.0f;
+			weightsMatrix.a21 = 0.0f;
+			weightsMatrix.a22 = 1.0f;
+			weightsMatrix.a23 = 0.0f;
+			weightsMatrix.a24 = 0.0f;
+			weightsMatrix.a31 = 0.0f;
+			weightsMatrix.a32 = 0.0f;
+			weightsMatrix.a33 = 1.0f;
+			weightsMatrix.a34 = 0.0f;
+			
+		}else if(entryCount == 1){
+			weightsMatrix = bones[entries->bone];
+			entries++;
+			
+		}else{
+			const oglMatrix3x4 &boneMatrix = bones[entries->bone];
+			float factor = entries->weight;
+			
+			weightsMatrix.a11 = boneMatrix.a11 * factor;
+			weightsMatrix.a12 = boneMatrix.a12 * factor;
+			weightsMatrix.a13 = boneMatrix.a13 * factor;
+			weightsMatrix.a14 = boneMatrix.a14 * factor;
+			weightsMatrix.a21 = boneMatrix.a21 * factor;
+			weightsMatrix.a22 = boneMatrix.a22 * factor;
+			weightsMatrix.a23 = boneMatrix.a23 * factor;
+			weightsMatrix.a24 = boneMatrix.a24 * factor;
+			weightsMatrix.a31 = boneMatrix.a31 * factor;
+			weightsMatrix.a32 = boneMatrix.a32 * factor;
+			weightsMatrix.a33 = boneMatrix.a33 * factor;
+			weightsMatrix.a34 = boneMatrix.a34 * factor;
+			entries++;
+			
+			for(e=1; e<entryCount; e++){
+				const oglMatrix3x4 &boneMatrix2 = bones[entries->bone];
+				factor = entries->weight;
+				
+				weightsMatrix.a11 += boneMatrix2.a11 * factor;
+				weightsMatrix.a12 += boneMatrix2.a12 * factor;
+				weightsMatrix.a13 += boneMatrix2.a13 * factor;
+				weightsMatrix.a14 += boneMatrix2.a14 * factor;
+				weightsMatrix.a21 += boneMatrix2.a21 * factor;
+				weightsMatrix.a22 += boneMatrix2.a22 * factor;
+				weightsMatrix.a23 += boneMatrix2.a23 * factor;
+				weightsMatrix.a24 += boneMatrix2.a24 * factor;
+				weightsMatrix.a31 += boneMatrix2.a31 * factor;
+				weightsMatrix.a32 += boneMatrix2.a32 * factor;
+				weightsMatrix.a33 += boneMatrix2.a33 * factor;
+				weightsMatrix.a34 += boneMatrix2.a34 * factor;
+				entries++;
+			}
+		}
+	}
+}
+
+void deoglVertexTransformKernels::Scalar::TransformPositions(const oglMatrix3x4 *weights,
+const oglModelPosition *positions, oglVector3 *result, int count){
+	int i;
+	
+	for(i=0; i<count; i++){
+		const oglModelPosition &modelPosition = positions[i];
+		const decVector &orgpos = modelPosition.position;
+		oglVector3 &trpos = result[i];
+		
+		if(!weights || modelPosition.weights == -1){
+			trpos.x = orgpos.x;
+			trpos.y = orgpos.y;
+			trpos.z = orgpos.z;
+			
+		}else{
+			const oglMatrix3x4 &matrix = weights[modelPosition.weights];
+			
+			trpos.x = matrix.a11 * orgpos.x + matrix.a12 * orgpos.y + matrix.a13 * orgpos.z + matrix.a14;
+			trpos.y = matrix.a21 * orgpos.x + matrix.a22 * orgpos.y + matrix.a23 * orgpos.z + matrix.a24;
+			trpos.z = matrix.a31 * orgpos.x + matrix.a32 * orgpos.y + matrix.a33 * orgpos.z + matrix.a34;
+		}
+	}
+}
+
+void deoglVertexTransformKernels::Scalar::FaceNormalsTangents(const oglVector3 *positions,
+const oglModelVertex *vertices, const decVector2 *texcoords, const deoglModelFace *faces,
+oglVector3 *normals, oglVector3 *tangents, int count){
+	oglVector3 edge1, edge2;
+	float len, invlen;
+	int i;
+	
+	for(i=0; i<count; i++){
+		const deoglModelFace &face = faces[i];
+		const oglModelVertex &point1 = vertices[face.GetVertex1()];
+		const oglModelVertex &point2 = vertices[face.GetVertex2()];
+		const oglModelVertex &point3 = vertices[face.GetVertex3()];
+		const oglVector3 &position1 = positions[point1.position];
+		const oglVector3 &position2 = positions[point2.position];
+		const oglVector3 &position3 = positions[point3.position];
+		const float d1y = texcoords[point2.texcoord].y - texcoords[point1.texcoord].y;
+		const float d2y = texcoords[point3.texcoord].y - texcoords[point1.texcoord].y;
+		oglVector3 &normal = normals[i];
+		oglVector3 &tangent = tangents[i];
+		
+		// calculate edges
+		edge1.x = position2.x - position1.x;
+		edge1.y = position2.y - position1.y;
+		edge1.z = position2.z - position1.z;
+		edge2.x = position3.x - position1.x;
+		edge2.y = position3.y - position1.y;
+		edge2.z = position3.z - position1.z;
+		
+		// calculate normal
+		normal.x = edge1.y * edge2.z - edge1.z * edge2.y;
+		normal.y = edge1.z * edge2.x - edge1.x * edge2.z;
+		normal.z = edge1.x * edge2.y - edge1.y * edge2.x;
+		
+		len = sqrtf(normal.x * normal.x + normal.y * normal.y + normal.z * normal.z);
+		if(len != 0.0f){
+			invlen = 1.0f / len;
+			normal.x *= invlen;
+			normal.y *= invlen;
+			normal.z *= invlen;
+			
+		}else{
+			normal.x = 0.0f;
+			normal.y = 1.0f;
+			normal.z = 0.0f;
+		}
+		
+		// calculate tangent
+		tangent.x = edge1.x * d2y - edge2.x * d1y;
+		tangent.y = edge1.y * d2y - edge2.y * d1y;
+		tangent.z = edge1.z * d2y - edge2.z * d1y;
+		
+		len = sqrtf(tangent.x * tangent.x + tangent.y * tangent.y + tangent.z * tangent.z);
+		if(len != 0.0f){
+			invlen = 1.0f / len;
+			tangent.x *= invlen;
+			tangent.y *= invlen;
+			tangent.z *= invlen;
+			
+		}else{
+			tangent.x = 1.0f;
+			tangent.y = 0.0f;
+			tangent.z = 0.0f;
+		}
+	}
+}
+
+
+
+// Class deoglVertexTransformKernels
+//////////////////////////////////////
+
+const char *deoglVertexTransformKernels::GetImplementationName(){
+#ifdef OGL_VTK_SSE2
+	return "SSE2";
+#elif defined(OGL_VTK_NEON)
+	return "NEON";
+#else
+	return "Scalar";
+#endif
+}
+
+#ifdef OGL_VTK_SIMD
+
+void deoglVertexTransformKernels::BlendWeights(const oglMatrix3x4 *bones,
+const oglModelWeight *entries, const int *counts, oglMatrix3x4 *weights, int count){
+	int w, e;
+	
+	for(w=0; w<count; w++){
+		oglMatrix3x4 &weightsMatrix = weights[w];
+		const int entryCount = counts[w];
+		
+		if(entryCount == 0){
+			simdStore(&weightsMatrix.a11, simdSet(1.0f, 0.0f, 0.0f, 0.0f));
+			simdStore(&weightsMatrix.a21, simdSet(0.0f, 1.0f, 0.0f, 0.0f));
+			simdStore(&weightsMatrix.a31, simdSet(0.0f, 0.0f, 1.0f, 0.0f));
+			
+		}else if(entryCount == 1){
+			const oglMatrix3x4 &boneMatrix = bones[entries->bone];
+			simdStore(&weightsMatrix.a11, simdLoad(&boneMatrix.a11));
+			simdStore(&weightsMatrix.a21, simdLoad(&boneMatrix.a21));
+			simdStore(&weightsMatrix.a31, simdLoad(&boneMatrix.a31));
+			entries++;
+			
+		}else{
+			const oglMatrix3x4 &boneMatrix = bones[entries->bone];
+			simdVec factor = simdSplat(entries->weight);
+			simdVec row1 = simdMul(simdLoad(&boneMatrix.a11), factor);
+			simdVec row2 = simdMul(simdLoad(&boneMatrix.a21), factor);
+			simdVec row3 = simdMul(simdLoad(&boneMatrix.a31), factor);
+			entries++;
+			
+			for(e=1; e<entryCount; e++){
+				const oglMatrix3x4 &boneMatrix2 = bones[entries->bone];
+				factor = simdSplat(entries->weight);
+				row1 = simdAdd(row1, simdMul(simdLoad(&boneMatrix2.a11), factor));
+				row2 = simdAdd(row2, simdMul(simdLoad(&boneMatrix2.a21), factor));
+				row3 = simdAdd(row3, simdMul(simdLoad(&boneMatrix2.a31), factor));
+				entries++;
+			}
+			
+			simdStore(&weightsMatrix.a11, row1);
+			simdStore(&weightsMatrix.a21, row2);
+			simdStore(&weightsMatrix.a31, row3);
+		}
+	}
+}
+
+void deoglVertexTransformKernels::TransformPositions(const oglMatrix3x4 *weights,
+const oglModelPosition *positions, oglVector3 *result, int count){
+	if(!weights){
+		Scalar::TransformPositions(weights, positions, result, count);
+		return;
+	}
+	
+	int i;
+	for(i=0; i<count; i++){
+		const oglModelPosition &modelPosition = positions[i];
+		const decVector &orgpos = modelPosition.position;
+		
+		if(modelPosition.weights == -1){
+			oglVector3 &trpos = result[i];
+			trpos.x = orgpos.x;
+			trpos.y = orgpos.y;
+			trpos.z = orgpos.z;
+			
+		}else{
+			const oglMatrix3x4 &matrix = weights[modelPosition.weights];
+			simdStore3(&result[i].x, simdDot3Rows(simdLoad(&matrix.a11), simdLoad(&matrix.a21),
+				simdLoad(&matrix.a31), simdSet(orgpos.x, orgpos.y, orgpos.z, 1.0f)));
+		}
+	}
+}
+
+void deoglVertexTransformKernels::FaceNormalsTangents(const oglVector3 *positions,
+const oglModelVertex *vertices, const decVector2 *texcoords, const deoglModelFace *faces,
+oglVector3 *normals, oglVector3 *tangents, int count){
+	const simdVec zero = simdSplat(0.0f);
+	const simdVec one = simdSplat(1.0f);
+	float gather[12][4];
+	int i, j;
+	
+	for(i=0; i+4<=count; i+=4){
+		// gather face corners in structure of arrays layout
+		for(j=0; j<4; j++){
+			const deoglModelFace &face = faces[i + j];
+			const oglModelVertex &point1 = vertices[face.GetVertex1()];
+			const oglModelVertex &point2 = vertices[face.GetVertex2()];
+			const oglModelVertex &point3 = vertices[face.GetVertex3()];
+			const oglVector3 &position1 = positions[point1.position];
+			const oglVector3 &position2 = positions[point2.position];
+			const oglVector3 &position3 = positions[point3.position];
+			
+			gather[0][j] = position1.x;
+			gather[1][j] = position1.y;
+			gather[2][j] = position1.z;
+			gather[3][j] = position2.x;
+			gather[4][j] = position2.y;
+			gather[5][j] = position2.z;
+			gather[6][j] = position3.x;
+			gather[7][j] = position3.y;
+			gather[8][j] = position3.z;
+			gather[9][j] = texcoords[point1.texcoord].y;
+			gather[10][j] = texcoords[point2.texcoord].y;
+			gather[11][j] = texcoords[point3.texcoord].y;
+		}
+		
+		const simdVec p1x = simdLoad(gather[0]), p1y = simdLoad(gather[1]), p1z = simdLoad(gather[2]);
+		const simdVec e1x = simdSub(simdLoad(gather[3]), p1x);
+		const simdVec e1y = simdSub(simdLoad(gather[4]), p1y);
+		const simdVec e1z = simdSub(simdLoad(gather[5]), p1z);
+		const simdVec e2x = simdSub(simdLoad(gather[6]), p1x);
+		const simdVec e2y = simdSub(simdLoad(gather[7]), p1y);
+		const simdVec e2z = simdSub(simdLoad(gather[8]), p1z);
+		const simdVec d1y = simdSub(simdLoad(gather[10]), simdLoad(gather[9]));
+		const simdVec d2y = simdSub(simdLoad(gather[11]), simdLoad(gather[9]));
+		
+		// normals
+		const simdVec nx = simdSub(simdMul(e1y, e2z), simdMul(e1z, e2y));
+		const simdVec ny = simdSub(simdMul(e1z, e2x), simdMul(e1x, e2z));
+		const simdVec nz = simdSub(simdMul(e1x, e2y), simdMul(e1y, e2x));
+		const simdVec nlen = simdSqrt(simdAdd(simdAdd(simdMul(nx, nx), simdMul(ny, ny)), simdMul(nz, nz)));
+		const simdMask nvalid = simdNotZero(nlen);
+		const simdVec ninvlen = simdDiv(one, nlen);
+		
+		simdStore3x4(&normals[i].x,
+			simdSelect(nvalid, simdMul(nx, ninvlen), zero),
+			simdSelect(nvalid, simdMul(ny, ninvlen), one),
+			simdSelect(nvalid, simdMul(nz, ninvlen), zero));
+		
+		// tangents
+		const simdVec tx = simdSub(simdMul(e1x, d2y), simdMul(e2x, d1y));
+		const simdVec ty = simdSub(simdMul(e1y, d2y), simdMul(e2y, d1y));
+		const simdVec tz = simdSub(simdMul(e1z, d2y), simdMul(e2z, d1y));
+		const simdVec tlen = simdSqrt(simdAdd(simdAdd(simdMul(tx, tx), simdMul(ty, ty)), simdMul(tz, tz)));
+		const simdMask tvalid = simdNotZero(tlen);
+		const simdVec tinvlen = simdDiv(one, tlen);
+		
+		simdStore3x4(&tangents[i].x,
+			simdSelect(tvalid, simdMul(tx, tinvlen), one),
+			simdSelect(tvalid, simdMul(ty, tinvlen), zero),
+			simdSelect(tvalid, simdMul(tz, tinvlen), zero));
+	}
+	
+	if(i < count){
+		Scalar::FaceNormalsTangents(positions, vertices, texcoords,
+			faces + i, normals + i, tangents + i, count - i);
+	}
+}
+
+#else
+
+void deoglVertexTransformKernels::BlendWeights(const oglMatrix3x4 *bones,
+const oglModelWeight *entries, const int *counts, oglMatrix3x4 *weights, int count){
+	Scalar::BlendWeights(bones, entries, counts, weights, count);
+}
+
+void deoglVertexTransformKernels::TransformPositions(const oglMatrix3x4 *weights,
+const oglModelPosition *positions, oglVector3 *result, int count){
+	Scalar::TransformPositions(weights, positions, result, count);
+}
+
+void deoglVertexTransformKernels::FaceNormalsTangents(const oglVector3 *positions,
+const oglModelVertex *vertices, const decVector2 *texcoords, const deoglModelFace *faces,
+oglVector3 *normals, oglVector3 *tangents, int count){
+	Scalar::FaceNormalsTangents(positions, vertices, texcoords, faces, normals, tangents, count);
+}
+
+#endif
@@ -0,0 +1,96 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DEOGLVERTEXTRANSFORMKERNELS_H_
+#define _DEOGLVERTEXTRANSFORMKERNELS_H_
+
+#include "../deoglBasics.h"
+
+class decVector2;
+class deoglModelFace;
+struct oglModelWeight;
+struct oglModelPosition;
+struct oglModelVertex;
+
+
+/**
+ * Kernels transforming model vertices on the CPU.
+ * 
+ * Uses SIMD instructions if supported by the build target. SSE2 is used on x86-64 and
+ * NEON on 64-bit ARM. All other targets use the scalar implementation. The scalar
+ * implementation is always available as reference using the nested Scalar class.
+ * 
+ * Results match the scalar implementation up to floating point rounding. All kernels
+ * process a range of elements and write only inside this range. Different ranges of
+ * the same arrays can thus be processed in parallel.
+ */
+class deoglVertexTransformKernels{
+public:
+	/** Scalar reference implementation. */
+	class Scalar{
+	public:
+		static void BlendWeights(const oglMatrix3x4 *bones, const oglModelWeight *entries,
+			const int *counts, oglMatrix3x4 *weights, int count);
+		
+		static void TransformPositions(const oglMatrix3x4 *weights,
+			const oglModelPosition *positions, oglVector3 *result, int count);
+		
+		static void FaceNormalsTangents(const oglVector3 *positions, const oglModelVertex *vertices,
+			const decVector2 *texcoords, const deoglModelFace *faces, oglVector3 *normals,
+			oglVector3 *tangents, int count);
+	};
+	
+	
+	
+	/** Name of implementation used by this build. */
+	static const char *GetImplementationName();
+	
+	/**
+	 * Blend bone matrices into weight matrices.
+	 * 
+	 * For each weight set counts[i] entries are consumed from entries. Sets with no entries
+	 * are set to identity. \em entries points to the first entry of the first weight set.
+	 */
+	static void BlendWeights(const oglMatrix3x4 *bones, const oglModelWeight *entries,
+		const int *counts, oglMatrix3x4 *weights, int count);
+	
+	/**
+	 * Transform positions by weight matrices.
+	 * 
+	 * Positions without weights are copied. If \em weights is nullptr all positions are copied.
+	 */
+	static void TransformPositions(const oglMatrix3x4 *weights,
+		const oglModelPosition *positions, oglVector3 *result, int count);
+	
+	/**
+	 * Calculate normalized face normals and face tangents.
+	 * 
+	 * Zero length normals are replaced by (0,1,0) and zero length tangents by (1,0,0).
+	 */
+	static void FaceNormalsTangents(const oglVector3 *positions, const oglModelVertex *vertices,
+		const decVector2 *texcoords, const deoglModelFace *faces, oglVector3 *normals,
+		oglVector3 *tangents, int count);
+};
+
+#endif
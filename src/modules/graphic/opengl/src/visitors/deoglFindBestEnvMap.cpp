@@ -28,7 +28,6 @@
 #include "deoglFindBestEnvMap.h"
 
 #include "../envmap/deoglEnvironmentMap.h"
-#include "../world/deoglWorldOctree.h"
 
 #include <dragengine/common/exceptions.h>
 #include "../utils/collision/deoglDCollisionDetection.h"
@@ -65,10 +64,6 @@ void deoglFindBestEnvMap::Reset(){
 
 
 
-void deoglFindBestEnvMap::VisitNode(deoglDOctree *node, int intersection){
-	VisitList(((deoglWorldOctree*)node)->GetEnvMapList());
-}
-
 void deoglFindBestEnvMap::VisitList(const deoglEnvironmentMap::List &list){
 	list.Visit([&](deoglEnvironmentMap *envmap){
 		if(!envmap->GetSkyOnly()){
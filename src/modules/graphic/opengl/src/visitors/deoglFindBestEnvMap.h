@@ -27,20 +27,17 @@
 
 #include <dragengine/common/math/decMath.h>
 
-#include "../world/deoglWorldOctreeVisitor.h"
 #include "../envmap/deoglEnvironmentMap.h"
 
-class deoglWorldOctree;
-
 
 
 /**
- * Find best environment map world octree visitor.
+ * Find best environment map visitor.
  * Uses as input the position to search the best environment map for. The environment map with the
  * smallest distance to the target position is considered the best. After visiting the found
  * environment map with stored or NULL otherwise if no result has been found.
  */
-class deoglFindBestEnvMap : public deoglWorldOctreeVisitor{
+class deoglFindBestEnvMap{
 private:
 	decDVector pPosition;
 	deoglEnvironmentMap *pEnvMap; ///< weak reference
@@ -52,7 +49,7 @@ public:
 	/** Creates a new visitor. */
 	deoglFindBestEnvMap();
 	/** Cleans up the visitor. */
-	~deoglFindBestEnvMap() override;
+	~deoglFindBestEnvMap();
 	/*@}*/
 	
 	/** \name Management */
@@ -79,9 +76,6 @@ public:
 	
 	/** \name Visiting */
 	/*@{*/
-	/** Visits an octree node. */
-	void VisitNode(deoglDOctree *node, int intersection) override;
-	
 	/** Test all environment maps in a list of environment maps. */
 	void VisitList(const deoglEnvironmentMap::List &list);
 	/*@}*/
@@ -42,7 +42,6 @@
 deoglDefaultWorldOctreeVisitor::deoglDefaultWorldOctreeVisitor() :
 pVisitBillboards(false),
 pVisitComponents(false),
-pVisitEnvMaps(false),
 pVisitLights(false),
 pVisitParticleEmitters(false){
 }
@@ -63,10 +62,6 @@ void deoglDefaultWorldOctreeVisitor::SetVisitComponents(bool visitComponents){
 	pVisitComponents = visitComponents;
 }
 
-void deoglDefaultWorldOctreeVisitor::SetVisitEnvMaps(bool visitEnvMaps){
-	pVisitEnvMaps = visitEnvMaps;
-}
-
 void deoglDefaultWorldOctreeVisitor::SetVisitLights(bool visitLights){
 	pVisitLights = visitLights;
 }
@@ -78,7 +73,6 @@ void deoglDefaultWorldOctreeVisitor::SetVisitParticleEmitters(bool visitEmitters
 void deoglDefaultWorldOctreeVisitor::SetVisitAll(bool visitAll){
 	pVisitBillboards = visitAll;
 	pVisitComponents = visitAll;
-	pVisitEnvMaps = visitAll;
 	pVisitLights = visitAll;
 	pVisitParticleEmitters = visitAll;
 }
@@ -107,12 +101,6 @@ void deoglDefaultWorldOctreeVisitor::VisitNode(deoglDOctree *node, int intersect
 		}
 	}
 	
-	if(pVisitEnvMaps){
-		sonode.GetEnvMapList().Visit([&](deoglEnvironmentMap *envmap){
-			VisitEnvMaps(envmap);
-		});
-	}
-	
 	if(pVisitLights){
 		const int count = sonode.GetLightCount();
 		
@@ -134,9 +122,6 @@ void deoglDefaultWorldOctreeVisitor::VisitBillboard(deoglRBillboard *billboard){
 void deoglDefaultWorldOctreeVisitor::VisitComponent(deoglRComponent *component){
 }
 
-void deoglDefaultWorldOctreeVisitor::VisitEnvMaps(deoglEnvironmentMap *envmap){
-}
-
 void deoglDefaultWorldOctreeVisitor::VisitLight(deoglRLight *light){
 }
 
@@ -27,7 +27,6 @@
 
 #include "deoglWorldOctreeVisitor.h"
 
-class deoglEnvironmentMap;
 class deoglRBillboard;
 class deoglRComponent;
 class deoglRLight;
@@ -42,7 +41,6 @@ class deoglDefaultWorldOctreeVisitor : public deoglWorldOctreeVisitor{
 private:
 	bool pVisitBillboards;
 	bool pVisitComponents;
-	bool pVisitEnvMaps;
 	bool pVisitLights;
 	bool pVisitParticleEmitters;
 	
@@ -84,12 +82,6 @@ public:
 	/** Set if lights are visited. */
 	void SetVisitLights(bool visitLights);
 	
-	/** Visit environment maps. */
-	inline bool GetVisitEnvMaps() const{ return pVisitEnvMaps; }
-	
-	/** Set if environment maps are visited. */
-	void SetVisitEnvMaps(bool visitEnvMaps);
-	
 	/** Set if all elements are visited. */
 	void SetVisitAll(bool visitAll);
 	/*@}*/
@@ -112,9 +104,6 @@ public:
 	
 	/** Visit light. */
 	virtual void VisitLight(deoglRLight *light);
-	
-	/** Visit environment maps. */
-	virtual void VisitEnvMaps(deoglEnvironmentMap *envmap);
 	/*@}*/
 };
 
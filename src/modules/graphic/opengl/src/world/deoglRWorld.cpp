@@ -31,6 +31,7 @@
 #include "deoglWorldOctreeVisitor.h"
 #include "../billboard/deoglRBillboard.h"
 #include "../component/deoglRComponent.h"
+#include "../component/deoglRComponentLODTransformBatch.h"
 #include "../debug/deoglDebugTraceGroup.h"
 #include "../debugdrawer/deoglRDebugDrawer.h"
 #include "../envmap/deoglEnvironmentMap.h"
@@ -142,7 +143,7 @@ void deoglRWorld::SetSize(const decDVector &size){
 	
 	decTObjectList<deoglREnvMapProbe>(pEnvMapProbes).Visit([&](const deoglREnvMapProbe &p){
 		if(p.GetEnvironmentMap()){
-			p.GetEnvironmentMap()->UpdateOctreePosition();
+			p.GetEnvironmentMap()->UpdateEnvMapIndex();
 		}
 	});
 	
@@ -277,6 +278,17 @@ void deoglRWorld::PrepareForRender(deoglRenderPlan &plan, const deoglRenderPlanM
 	{
 		const deoglDebugTraceGroup debugTrace2(pRenderThread, "Components");
 		pListPrepareRenderComponents.RemoveAll();
+		
+		// transform vertices of all dynamic components in parallel. preparing the
+		// components afterwards finds the transformed vertices up to date
+		deoglRComponentLODTransformBatch transformBatch(pRenderThread);
+		pListPrepareForRenderComponents.Visit([&](deoglRComponent *component){
+			if(component->GetParentWorld() && component->GetVisible()){
+				component->AddDirtyLODTransforms(transformBatch);
+			}
+		});
+		transformBatch.Run();
+		
 		decTLinkedList<deoglRComponent>::Element * const tailComponent = pListPrepareForRenderComponents.GetTail();
 		while(pListPrepareForRenderComponents.GetRoot()){
 			decTLinkedList<deoglRComponent>::Element * const entry = pListPrepareForRenderComponents.GetRoot();
@@ -563,6 +575,7 @@ void deoglRWorld::SetReferencePosition(const decDVector &position){
 		this, pReferencePosition.x, pReferencePosition.y, pReferencePosition.z, position.x, position.y, position.z);
 	
 	pReferencePosition = position;
+	pEnvMapIndexReferenceChanged();
 	NotifyAllReferencePositionChanged();
 }
 
@@ -947,6 +960,50 @@ void deoglRWorld::RemoveAllEnvMaps(){
 
 
 
+void deoglRWorld::UpdateEnvMapIndex(deoglEnvironmentMap &envmap){
+	// the index stores boxes relative to the reference position to keep them precise
+	// in large worlds. the index uses single precision
+	const decDVector position(envmap.GetPosition() - pReferencePosition);
+	const decDVector halfExtends(0.01, 0.01, 0.01);
+	
+	if(envmap.GetEnvMapIndexElement() != -1){
+		pEnvMapIndex.Move(envmap.GetEnvMapIndexElement(), position - halfExtends, position + halfExtends);
+		return;
+	}
+	
+	const int element = pEnvMapIndex.Insert(position - halfExtends, position + halfExtends);
+	if(element == pIndexedEnvMaps.GetCount()){
+		pIndexedEnvMaps.Add(&envmap);
+		
+	}else{
+		pIndexedEnvMaps.SetAt(element, &envmap);
+	}
+	envmap.SetEnvMapIndexElement(element);
+}
+
+void deoglRWorld::RemoveEnvMapFromIndex(deoglEnvironmentMap &envmap){
+	const int element = envmap.GetEnvMapIndexElement();
+	if(element == -1){
+		return;
+	}
+	
+	pEnvMapIndex.Remove(element);
+	envmap.SetEnvMapIndexElement(-1);
+	
+	// removing the last element restarts element numbering
+	if(pEnvMapIndex.GetElementCount() == 0){
+		pIndexedEnvMaps.RemoveAll();
+		
+	}else{
+		pIndexedEnvMaps.SetAt(element, nullptr);
+	}
+}
+
+void deoglRWorld::QueryEnvMapIndex(const decDVector &minExtend, const decDVector &maxExtend,
+decTList<int> &elements) const{
+	pEnvMapIndex.QueryBox(minExtend - pReferencePosition, maxExtend - pReferencePosition, elements);
+}
+
 void deoglRWorld::ResetEnvMapUpdateCount(){
 	pEnvMapUpdateCount = 1;
 }
@@ -1392,6 +1449,8 @@ void deoglRWorld::pCleanUp(){
 	pFreeSkyEnvMap();
 	
 	pEnvMapList.RemoveAll();
+	pIndexedEnvMaps.RemoveAll();
+	pEnvMapIndex.RemoveAll();
 	
 	if(pOctree){
 		delete pOctree;
@@ -1443,6 +1502,32 @@ void deoglRWorld::pReorderSkies(){
 	}
 }
 
+void deoglRWorld::pEnvMapIndexReferenceChanged(){
+	const int count = pEnvMapIndex.GetElementCount();
+	if(count == 0){
+		return;
+	}
+	
+	const decDVector halfExtends(0.01, 0.01, 0.01);
+	decTList<int> elements;
+	decTList<decVector> minExtends, maxExtends;
+	elements.EnlargeCapacity(count);
+	minExtends.EnlargeCapacity(count);
+	maxExtends.EnlargeCapacity(count);
+	
+	pIndexedEnvMaps.VisitIndexed([&](int element, const deoglEnvironmentMap *envmap){
+		if(envmap){
+			const decDVector position(envmap->GetPosition() - pReferencePosition);
+			elements.Add(element);
+			minExtends.Add((position - halfExtends).ToVector());
+			maxExtends.Add((position + halfExtends).ToVector());
+		}
+	});
+	
+	pEnvMapIndex.Move(elements.GetArrayPointer(), minExtends.GetArrayPointer(),
+		maxExtends.GetArrayPointer(), elements.GetCount());
+}
+
 void deoglRWorld::pCreateSkyEnvMap(){
 	if(pSkyEnvMap){
 		return;
@@ -32,6 +32,7 @@
 
 #include <dragengine/deObject.h>
 #include <dragengine/common/math/decMath.h>
+#include <dragengine/common/math/decSpatialIndex.h>
 #include <dragengine/common/collection/decTList.h>
 #include <dragengine/common/collection/decTOrderedSet.h>
 #include <dragengine/common/collection/decTList.h>
@@ -96,6 +97,8 @@ private:
 	double pValidReferenceDistance;
 	
 	deoglEnvironmentMap::List pEnvMapList;
+	decSpatialIndex pEnvMapIndex;
+	decTList<deoglEnvironmentMap*> pIndexedEnvMaps;
 	int pEnvMapUpdateCount;
 	deoglRenderPlan *pEnvMapRenderPlan;
 	bool pDirtyEnvMapLayout;
@@ -393,6 +396,28 @@ public:
 	/** Remove all environment maps. */
 	void RemoveAllEnvMaps();
 	
+	/**
+	 * Environment map spatial index.
+	 * 
+	 * Contains all environment maps not rendering sky only. Boxes are relative to the
+	 * reference position. Use QueryEnvMapIndex() to find environment maps using world
+	 * positions and GetIndexedEnvMapAt() to obtain the environment map for found elements.
+	 */
+	inline const decSpatialIndex &GetEnvMapIndex() const{ return pEnvMapIndex; }
+	
+	/** Append environment map index elements overlapping world box to list. */
+	void QueryEnvMapIndex(const decDVector &minExtend, const decDVector &maxExtend,
+		decTList<int> &elements) const;
+	
+	/** Environment map for environment map index element. */
+	inline deoglEnvironmentMap *GetIndexedEnvMapAt(int element) const{ return pIndexedEnvMaps.GetAt(element); }
+	
+	/** Add environment map to environment map index or update it if present. */
+	void UpdateEnvMapIndex(deoglEnvironmentMap &envmap);
+	
+	/** Remove environment map from environment map index if present. */
+	void RemoveEnvMapFromIndex(deoglEnvironmentMap &envmap);
+	
 	/** Number of environment maps that can be updated this frame. */
 	inline int GetEnvMapUpdateCount() const{ return pEnvMapUpdateCount; }
 	
@@ -556,6 +581,7 @@ private:
 	decDVector pSanitizeOctreeSize(const decDVector &size) const;
 	int pCalcOctreeInsertDepth(const decDVector &size) const;
 	void pReorderSkies();
+	void pEnvMapIndexReferenceChanged();
 	void pCreateSkyEnvMap();
 	void pFreeSkyEnvMap();
 };
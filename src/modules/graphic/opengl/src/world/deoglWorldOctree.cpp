@@ -32,7 +32,6 @@
 
 #include "../billboard/deoglRBillboard.h"
 #include "../component/deoglRComponent.h"
-#include "../envmap/deoglEnvironmentMap.h"
 #include "../light/deoglRLight.h"
 #include "../particle/deoglRParticleEmitterInstance.h"
 #include "../sensor/deoglRLumimeter.h"
@@ -67,7 +66,6 @@ deoglWorldOctree::~deoglWorldOctree(){
 	//RemoveAllLights();
 	//RemoveAllComponents();
 	//RemoveAllBillboards();
-	//RemoveAllEnvMaps();
 	//RemoveAllParticleEmitters();
 }
 
@@ -112,7 +110,6 @@ void deoglWorldOctree::ClearNodeContent(){
 	RemoveAllComponents();
 	RemoveAllLumimeters();
 	RemoveAllBillboards();
-	RemoveAllEnvMaps();
 	RemoveAllParticleEmitters();
 }
 
@@ -140,18 +137,6 @@ void deoglWorldOctree::ClearComponents(){
 	}
 }
 
-void deoglWorldOctree::ClearEnvMaps(){
-	RemoveAllEnvMaps();
-	
-	int i;
-	for(i=0; i<8; i++){
-		deoglDOctree * const node = GetNodeAt(i);
-		if(node){
-			((deoglWorldOctree*)node)->ClearEnvMaps();
-		}
-	}
-}
-
 void deoglWorldOctree::ClearLights(){
 	RemoveAllLights();
 	
@@ -235,30 +220,6 @@ void deoglWorldOctree::InsertComponentIntoTree(deoglRComponent *component){
 	}
 }
 
-void deoglWorldOctree::InsertEnvMapIntoTree(deoglEnvironmentMap *envmap){
-	if(!envmap){
-		DETHROW(deeInvalidParam);
-	}
-	
-	const decDVector &boxCenter = envmap->GetPosition();
-	const decDVector boxHalfExtends = decDVector(0.01f, 0.01f, 0.01f);
-	const decDVector minExtend(boxCenter - boxHalfExtends);
-	const decDVector maxExtend(boxCenter + boxHalfExtends);
-	deoglWorldOctree *currentNode = envmap->GetOctreeNode();
-	
-	if(currentNode){
-		if(!currentNode->ContainsBox(minExtend, maxExtend)){
-			currentNode->RemoveEnvMap(envmap);
-			currentNode = nullptr;
-		}
-	}
-	
-	if(!currentNode){
-		currentNode = pGetNodeFor(minExtend, maxExtend, pInsertDepth);
-		currentNode->AddEnvMap(envmap);
-	}
-}
-
 void deoglWorldOctree::InsertLightIntoTree(deoglRLight *light){
 	if(!light){
 		DETHROW(deeInvalidParam);
@@ -634,43 +595,6 @@ void deoglWorldOctree::RemoveAllBillboards(){
 
 
 
-// Environment maps
-/////////////////////
-
-void deoglWorldOctree::AddEnvMap(deoglEnvironmentMap *envmap){
-	if(!envmap){
-		DETHROW(deeInvalidParam);
-	}
-	
-	pEnvMaps.Add(envmap);
-	
-	envmap->SetOctreeNode(this);
-}
-
-void deoglWorldOctree::RemoveEnvMap(deoglEnvironmentMap *envmap){
-	const int index = pEnvMaps.IndexOf(envmap);
-	if(index == -1){
-		DETHROW(deeInvalidParam);
-	}
-	
-	pEnvMaps.RemoveFrom(index);
-	
-	envmap->SetOctreeNode(nullptr);
-}
-
-void deoglWorldOctree::RemoveAllEnvMaps(){
-	const int count = pEnvMaps.GetCount();
-	int i;
-	
-	for(i=0; i<count; i++){
-		pEnvMaps.GetAt(i)->SetOctreeNode(nullptr);
-	}
-	
-	pEnvMaps.RemoveAll();
-}
-
-
-
 // Particle emitters
 //////////////////////
 
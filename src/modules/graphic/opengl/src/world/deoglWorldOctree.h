@@ -28,7 +28,6 @@
 #include <stdint.h>
 
 #include "../billboard/deoglRBillboard.h"
-#include "../envmap/deoglEnvironmentMap.h"
 #include "../particle/deoglRParticleEmitterInstance.h"
 #include "../utils/octree/deoglDOctree.h"
 
@@ -51,7 +50,6 @@ private:
 	int pInsertDepth;
 	
 	deoglRBillboard::List pBillboards;
-	deoglEnvironmentMap::List pEnvMaps;
 	deoglRParticleEmitterInstance::List pParticleEmitters;
 	
 	decTList<deoglRComponent*> pComponents;
@@ -92,9 +90,6 @@ public:
 	/** Clear all components from the tree. */
 	void ClearComponents();
 	
-	/** Clear all environment maps from the tree. */
-	void ClearEnvMaps();
-	
 	/** Clear all lights from the tree. */
 	void ClearLights();
 	
@@ -112,9 +107,6 @@ public:
 	/** Add component into the octree. */
 	void InsertComponentIntoTree(deoglRComponent *component);
 	
-	/** Add environment map into the octree. */
-	void InsertEnvMapIntoTree(deoglEnvironmentMap *envmap);
-	
 	/** Add light into the octree. */
 	void InsertLightIntoTree(deoglRLight *light);
 	
@@ -233,23 +225,6 @@ public:
 	
 	
 	
-	/** \name EnvMaps */
-	/*@{*/
-	/** List of environment maps. */
-	inline const deoglEnvironmentMap::List &GetEnvMapList() const{ return pEnvMaps; }
-	
-	/** Add envmap. */
-	void AddEnvMap(deoglEnvironmentMap *envmap);
-	
-	/** Remove envmap. */
-	void RemoveEnvMap(deoglEnvironmentMap *envmap);
-	
-	/** Remove all envmaps. */
-	void RemoveAllEnvMaps();
-	/*@}*/
-	
-	
-	
 	/** \name ParticleEmitters */
 	/*@{*/
 	/** List of particle emitters. */
@@ -32,11 +32,9 @@
 #include <dragengine/common/exceptions.h>
 #include <dragengine/common/file/decBaseFileReader.h>
 #include <dragengine/common/file/decBaseFileWriter.h>
-#include <dragengine/common/xmlparser/decXmlParser.h>
-#include <dragengine/common/xmlparser/decXmlDocument.h>
-#include <dragengine/common/xmlparser/decXmlElementTag.h>
-#include <dragengine/common/xmlparser/decXmlAttValue.h>
-#include <dragengine/common/xmlparser/decXmlCharacterData.h>
+#include <dragengine/common/file/decPath.h>
+#include <dragengine/common/xmlparser/decXmlBinaryDocument.h>
+#include <dragengine/common/xmlparser/decXmlBinaryElement.h>
 #include <dragengine/common/xmlparser/decXmlVisitor.h>
 #include <dragengine/common/xmlparser/decXmlWriter.h>
 #include <dragengine/resources/localization/deLanguagePack.h>
@@ -79,7 +77,8 @@ deBaseModule *DELangPackCreateModule(deLoadableModule *loadableModule){
 ////////////////////////////
 
 deLangPackModule::deLangPackModule(deLoadableModule &loadableModule) :
-deBaseLanguagePackModule(loadableModule){
+deBaseLanguagePackModule(loadableModule),
+pXmlCache(&GetVFS(), decPath::CreatePathUnix("/cache/local/xml")){
 }
 
 deLangPackModule::~deLangPackModule(){
@@ -91,14 +90,11 @@ deLangPackModule::~deLangPackModule(){
 ///////////////
 
 void deLangPackModule::LoadLanguagePack(decBaseFileReader &file, deLanguagePack &languagePack){
-	decXmlDocument::Ref xmlDoc(decXmlDocument::Ref::New());
+	// translations keep white space. character data is not cleaned
+	const decXmlBinaryDocument::Ref xmlDoc(pXmlCache.Load(
+		file, languagePack.GetFilename(), *GetGameEngine()->GetLogger(), false));
 	
-	decXmlParser(GetGameEngine()->GetLogger()).ParseXml(&file, xmlDoc);
-	
-	xmlDoc->StripComments();
-// 	xmlDoc->CleanCharData();
-	
-	decXmlElementTag * const root = xmlDoc->GetRoot();
+	const decXmlBinaryElement * const root = xmlDoc->GetRoot();
 	if(!root || strcmp(root->GetName(), "languagePack") != 0){
 		DETHROW(deeInvalidParam);
 	}
@@ -117,15 +113,15 @@ void deLangPackModule::SaveLanguagePack(decBaseFileWriter &file, const deLanguag
 // Private functions
 //////////////////////
 
-const decXmlAttValue *deLangPackModule::pFindAttribute(const decXmlElementTag &tag, const char *name){
+const decXmlBinaryElement *deLangPackModule::pFindAttribute(const decXmlBinaryElement &tag, const char *name){
 	const int elementCount = tag.GetElementCount();
 	int i;
 	
 	for(i=0; i<elementCount; i++){
-		decXmlElement &element = *tag.GetElementAt(i);
+		const decXmlBinaryElement &element = *tag.GetElementAt(i);
 		
 		if(element.CanCastToAttValue()){
-			const decXmlAttValue * const value = element.CastToAttValue();
+			const decXmlBinaryElement * const value = element.CastToAttValue();
 			
 			if(strcmp(value->GetName(), name) == 0){
 				return value;
@@ -136,8 +132,8 @@ const decXmlAttValue *deLangPackModule::pFindAttribute(const decXmlElementTag &t
 	return nullptr;
 }
 
-const char *deLangPackModule::pGetAttributeString(const decXmlElementTag &tag, const char *name){
-	const decXmlAttValue * const value = pFindAttribute(tag, name);
+const char *deLangPackModule::pGetAttributeString(const decXmlBinaryElement &tag, const char *name){
+	const decXmlBinaryElement * const value = pFindAttribute(tag, name);
 	
 	if(value){
 		return value->GetValue();
@@ -150,13 +146,13 @@ const char *deLangPackModule::pGetAttributeString(const decXmlElementTag &tag, c
 
 
 
-void deLangPackModule::pParseLangPack(const decXmlElementTag &root, deLanguagePack &languagePack){
+void deLangPackModule::pParseLangPack(const decXmlBinaryElement &root, deLanguagePack &languagePack){
 	const int elementCount = root.GetElementCount();
 	int i;
 	
 	int entryCount = 0;
 	for(i=0; i<elementCount; i++){
-		const decXmlElementTag * const tag = root.GetElementIfTag(i);
+		const decXmlBinaryElement * const tag = root.GetElementIfTag(i);
 		if(tag && strcmp(tag->GetName(), "translation") == 0){
 			entryCount++;
 		}
@@ -166,29 +162,29 @@ void deLangPackModule::pParseLangPack(const decXmlElementTag &root, deLanguagePa
 	int entryIndex = 0;
 	
 	for(i=0; i<elementCount; i++){
-		const decXmlElementTag * const tag = root.GetElementIfTag(i);
+		const decXmlBinaryElement * const tag = root.GetElementIfTag(i);
 		
 		if(tag){
 			if(tag->GetName() == "identifier"){
-				const decXmlCharacterData * const cdata = tag->GetFirstData();
+				const decXmlBinaryElement * const cdata = tag->GetFirstData();
 				if(cdata){
-					languagePack.SetIdentifier(cdata->GetData());
+					languagePack.SetIdentifier(cdata->GetData().GetString());
 				}
 				
 			}else if(strcmp(tag->GetName(), "name") == 0){
-				const decXmlCharacterData * const cdata = tag->GetFirstData();
+				const decXmlBinaryElement * const cdata = tag->GetFirstData();
 				if(cdata){
 					languagePack.SetName(decUnicodeString::NewFromUTF8(cdata->GetData()));
 				}
 				
 			}else if(strcmp(tag->GetName(), "description") == 0){
-				const decXmlCharacterData * const cdata = tag->GetFirstData();
+				const decXmlBinaryElement * const cdata = tag->GetFirstData();
 				if(cdata){
 					languagePack.SetDescription(decUnicodeString::NewFromUTF8(cdata->GetData()));
 				}
 				
 			}else if(strcmp(tag->GetName(), "missingText") == 0){
-				const decXmlCharacterData * const cdata = tag->GetFirstData();
+				const decXmlBinaryElement * const cdata = tag->GetFirstData();
 				if(cdata){
 					languagePack.SetMissingText(decUnicodeString::NewFromUTF8(cdata->GetData()));
 				}
@@ -196,7 +192,7 @@ void deLangPackModule::pParseLangPack(const decXmlElementTag &root, deLanguagePa
 			}else if(strcmp(tag->GetName(), "translation") == 0){
 				deLanguagePackEntry &entry = languagePack.GetEntryAt(entryIndex++);
 				entry.SetName(pGetAttributeString(*tag, "name"));
-				const decXmlCharacterData * const cdata = tag->GetFirstData();
+				const decXmlBinaryElement * const cdata = tag->GetFirstData();
 				if(cdata){
 					entry.SetText(decUnicodeString::NewFromUTF8(cdata->GetData()));
 				}
@@ -25,12 +25,12 @@
 #ifndef _DELANGPACKMODULE_H_
 #define _DELANGPACKMODULE_H_
 
+#include <dragengine/filesystem/deXmlDocumentCache.h>
 #include <dragengine/systems/modules/langpack/deBaseLanguagePackModule.h>
 
 class deLanguagePackEntry;
 class decXmlWriter;
-class decXmlElementTag;
-class decXmlAttValue;
+class decXmlBinaryElement;
 class deLanguagePack;
 
 
@@ -38,6 +38,11 @@ class deLanguagePack;
  * \brief Drag[en]gine Language Pack Module.
  */
 class deLangPackModule : public deBaseLanguagePackModule{
+private:
+	deXmlDocumentCache pXmlCache;
+	
+	
+	
 public:
 	/** \name Constructors and Destructors */
 	/*@{*/
@@ -59,10 +64,10 @@ public:
 	/*@}*/
 	
 private:
-	const decXmlAttValue *pFindAttribute(const decXmlElementTag &tag, const char *name);
-	const char *pGetAttributeString(const decXmlElementTag &tag, const char *name);
+	const decXmlBinaryElement *pFindAttribute(const decXmlBinaryElement &tag, const char *name);
+	const char *pGetAttributeString(const decXmlBinaryElement &tag, const char *name);
 	
-	void pParseLangPack(const decXmlElementTag &root, deLanguagePack &languagePack);
+	void pParseLangPack(const decXmlBinaryElement &root, deLanguagePack &languagePack);
 	
 	void pWriteLangPack(decXmlWriter &writer, const deLanguagePack &languagePack);
 	void pWriteLangPackEntry(decXmlWriter &writer, const deLanguagePackEntry &entry);
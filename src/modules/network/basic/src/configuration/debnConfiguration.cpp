@@ -47,7 +47,8 @@ pLogLevel(ellWarning),
 pConnectResendInterval(1.0f),
 pConnectTimeout(5.0f),
 pReliableResendInterval(0.5f),
-pReliableTimeout(3.0f){
+pReliableTimeout(3.0f),
+pIOThread(false){
 }
 
 debnConfiguration::~debnConfiguration(){
@@ -77,3 +78,7 @@ void debnConfiguration::SetReliableResendInterval(float interval){
 void debnConfiguration::SetReliableTimeout(float timeout){
 	pReliableTimeout = decMath::max(timeout, 0.01f);
 }
+
+void debnConfiguration::SetIOThread(bool ioThread){
+	pIOThread = ioThread;
+}
@@ -50,6 +50,8 @@ private:
 	float pReliableResendInterval;
 	float pReliableTimeout;
 	
+	bool pIOThread;
+	
 	
 	
 public:
@@ -85,6 +87,15 @@ public:
 	/** Reliable message timeout in seconds. */
 	inline float GetReliableTimeout() const{ return pReliableTimeout; }
 	void SetReliableTimeout(float timeout);
+	
+	/**
+	 * Use network I/O thread.
+	 * 
+	 * Datagrams are received, acknowledged and resent by a dedicated thread instead of
+	 * during ProcessNetwork(). Read only during module creation.
+	 */
+	inline bool GetIOThread() const{ return pIOThread; }
+	void SetIOThread(bool ioThread);
 	/*@}*/
 };
 
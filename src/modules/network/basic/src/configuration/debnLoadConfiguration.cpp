@@ -139,6 +139,11 @@ void debnLoadConfiguration::pLoadConfiguration(debnConfiguration &configuration,
 			}else if(name == "reliableTimeout"){
 				DEASSERT_NOTNULL(tag->GetFirstData())
 				configuration.SetReliableTimeout(strtof(tag->GetFirstData()->GetData(), nullptr));
+				
+			}else if(name == "ioThread"){
+				DEASSERT_NOTNULL(tag->GetFirstData())
+				const decString &value = tag->GetFirstData()->GetData();
+				configuration.SetIOThread(value == "true" || value == "1");
 			}
 			
 		}else{
@@ -35,6 +35,11 @@
 #include "debnSocket.h"
 #include "debnAddress.h"
 #include "debnConnection.h"
+#include "debnDatagramBatch.h"
+#include "debnIOThread.h"
+#include "debnLatencyBenchmark.h"
+#include "debnConnectionTest.h"
+#include "debnLoopbackBenchmark.h"
 #include "debnWorld.h"
 #include "deNetworkBasic.h"
 #include "configuration/debnLoadConfiguration.h"
@@ -164,9 +169,16 @@ bool deNetworkBasic::Init(){
 		}
 		#endif
 		
-		// create shared datagram
-		pDatagram = deNetworkMessage::Ref::New();
-		pDatagram->SetDataLength(1024);
+		// create receive batch
+		pReceiveBatch = deTUniqueReference<debnDatagramBatch>::New();
+		
+		// start network I/O thread if enabled
+		if(pConfiguration.GetIOThread()){
+			LogInfo("Using network I/O thread");
+			pIOThread = deTUniqueReference<debnIOThread>::New(
+				*this, pConfiguration.GetReliableResendInterval());
+			pIOThread->StartThread();
+		}
 		
 		// create receive address
 		pSharedSendDatagram = deNetworkMessage::Ref::New();
@@ -206,9 +218,8 @@ void deNetworkBasic::CleanUp(){
 		pMessagesReceive = NULL;
 	}*/
 	
-	if(pDatagram){
-		pDatagram = nullptr;
-	}
+	pIOThread.Clear();
+	pReceiveBatch.Clear();
 	
 	// ensure all linked lists are NULL
 	/*
@@ -233,6 +244,13 @@ void deNetworkBasic::ProcessNetwork(){
 DEBUG_RESET_TIMERS;
 	const float elapsedTime = GetGameEngine()->GetElapsedTime();
 	
+	// process datagrams received by the I/O thread first. acknowledgements received while
+	// the main thread has been busy have to be seen before checking for timeouts
+	if(pIOThread){
+		pProcessReceivedDatagrams();
+DEBUG_PRINT_TIMER(*this, "Process Received Datagrams");
+	}
+	
 	// process all messages destined to go out
 	pProcessConnections(elapsedTime);
 DEBUG_PRINT_TIMER(*this, "Process Connections");
@@ -249,11 +267,37 @@ DEBUG_PRINT_TIMER(*this, "Sleep");
 	// check on incoming messages
 	pReceiveDatagrams();
 DEBUG_PRINT_TIMER(*this, "Receive Datagrams");
+	
+	// send all datagrams queued during this frame
+	pFlushSendQueues();
+DEBUG_PRINT_TIMER(*this, "Send Datagrams");
 DEBUG_PRINT_TIMER_TOTAL(*this, "Process Network");
 }
 
 
 
+void deNetworkBasic::SetUseIOThread(bool useIOThread){
+	if(useIOThread == pIOThread.IsNotNull()){
+		return;
+	}
+	
+	// sockets pick up the I/O thread while binding
+	if(pHeadSocket){
+		DETHROW_INFO(deeInvalidAction, "sockets exist");
+	}
+	
+	if(useIOThread){
+		pIOThread = deTUniqueReference<debnIOThread>::New(
+			*this, pConfiguration.GetReliableResendInterval());
+		pIOThread->StartThread();
+		
+	}else{
+		pIOThread.Clear();
+	}
+}
+
+
+
 // Peer Management
 ////////////////////
 
@@ -453,107 +497,189 @@ deBaseNetworkState *deNetworkBasic::CreateState(deNetworkState *state){
 
 
 
+// Debugging
+//////////////
 
-// Private Functions
-//////////////////////
-
-debnConnection *deNetworkBasic::pFindConnection(const debnSocket *bnSocket, const debnAddress &address) const{
-	debnConnection *connection = pHeadConnection;
-	while(connection){
-		if(connection->Matches(bnSocket, address)){
-			return connection;
+void deNetworkBasic::SendCommand(const decUnicodeArgumentList &command, decUnicodeString &answer){
+	if(command.GetArgumentCount() == 0){
+		answer.SetFromUTF8("No command provided.");
+		
+	}else if(command.MatchesArgumentAt(0, "help")){
+		answer.SetFromUTF8("help => Displays this help screen.\n"
+			"loopbackBenchmark [clients] [frames] => Benchmark datagram transfer on loopback.\n"
+			"latencyBenchmark [messages] [stall] => Benchmark reliable round trip on loopback"
+				" with main thread stalled for stall milliseconds each frame.\n"
+			"connectionTest [messages] => Test reliable messages send back and forth"
+				" between connection and server on loopback.\n");
+		
+	}else if(command.MatchesArgumentAt(0, "loopbackBenchmark")){
+		const int clientCount = command.GetArgumentCount() > 1 ? command.GetArgumentAt(1)->ToInt() : 200;
+		const int frameCount = command.GetArgumentCount() > 2 ? command.GetArgumentAt(2)->ToInt() : 100;
+		
+		if(clientCount < 1 || frameCount < 1){
+			answer.SetFromUTF8("Requires at least 1 client and 1 frame.");
+			return;
 		}
-		connection = connection->GetNextConnection();
-	}
-	return nullptr;
-}
-
-debnServer *deNetworkBasic::pFindServer(const debnSocket *bnSocket) const{
-	debnServer *server = pHeadServer;
-	
-	while(server){
-		if(bnSocket == server->GetSocket()) return server;
 		
-		server = server->GetNextServer();
+		debnLoopbackBenchmark(*this).Run(clientCount, frameCount, answer);
+		
+	}else if(command.MatchesArgumentAt(0, "latencyBenchmark")){
+		const int messageCount = command.GetArgumentCount() > 1 ? command.GetArgumentAt(1)->ToInt() : 200;
+		const int stall = command.GetArgumentCount() > 2 ? command.GetArgumentAt(2)->ToInt() : 16;
+		
+		if(messageCount < 1 || stall < 0){
+			answer.SetFromUTF8("Requires at least 1 message and stall of 0 or more milliseconds.");
+			return;
+		}
+		if(HasSockets()){
+			answer.SetFromUTF8("Requires that no connections or servers exist.");
+			return;
+		}
+		
+		debnLatencyBenchmark(*this).Run(messageCount, stall, answer);
+		
+	}else if(command.MatchesArgumentAt(0, "connectionTest")){
+		const int messageCount = command.GetArgumentCount() > 1 ? command.GetArgumentAt(1)->ToInt() : 50;
+		
+		if(messageCount < 1){
+			answer.SetFromUTF8("Requires at least 1 message.");
+			return;
+		}
+		if(HasSockets()){
+			answer.SetFromUTF8("Requires that no connections or servers exist.");
+			return;
+		}
+		
+		debnConnectionTest(*this).Run(messageCount, answer);
+		
+	}else{
+		answer.SetFromUTF8("Unknown command '");
+		answer += *command.GetArgumentAt(0);
+		answer.AppendFromUTF8("'.");
 	}
-	
-	return nullptr;
 }
 
 
 
+
+// Private Functions
+//////////////////////
+
 void deNetworkBasic::pReceiveDatagrams(){
+	debnDatagramBatch &batch = pReceiveBatch;
 	debnSocket *bnSocket = pHeadSocket;
+	int i;
 	
 	while(bnSocket){
-		while(bnSocket->ReceiveDatagram(*pDatagram, pAddressReceive)){
-			deNetworkMessageReader::Ref reader(deNetworkMessageReader::Ref::New(pDatagram));
-			
-			debnConnection * const connection = pFindConnection(bnSocket, pAddressReceive);
-			const eCommandCodes command = (eCommandCodes)reader->ReadByte();
+		// sockets added to the I/O thread are received by the thread
+		if(bnSocket->GetIOThread()){
+			bnSocket = bnSocket->GetNextSocket();
+			continue;
+		}
+		
+		// processing datagrams can release the socket. keep it alive until done
+		const debnSocket::Ref guard(bnSocket);
+		
+		while(true){
+			const int count = bnSocket->ReceiveDatagrams(batch);
 			
-			if(connection){
-				switch(command){
-				case eccConnectionAck:
-					connection->ProcessConnectionAck(reader);
-					break;
-					
-				case eccConnectionClose:
-					connection->ProcessConnectionClose(reader);
-					break;
-					
-				case eccMessage:
-					connection->ProcessMessage(reader);
-					break;
-					
-				case eccReliableMessage:
-					connection->ProcessReliableMessage(reader);
-					break;
-					
-				case eccReliableLinkState:
-					connection->ProcessReliableLinkState(reader);
-					break;
-					
-				case eccReliableAck:
-					connection->ProcessReliableAck(reader);
-					break;
-					
-				case eccLinkUp:
-					connection->ProcessLinkUp(reader);
-					break;
-					
-				case eccLinkDown:
-					connection->ProcessLinkDown(reader);
-					break;
-					
-				case eccLinkUpdate:
-					connection->ProcessLinkUpdate(reader);
-					break;
-					
-				case eccReliableMessageLong:
-					connection->ProcessReliableMessageLong(reader);
-					break;
-					
-				case eccReliableLinkStateLong:
-					connection->ProcessReliableLinkStateLong(reader);
-					break;
-					
-				default:
-					break;
-				}
-				
-			}else if(command == eccConnectionRequest){
-				debnServer * const server = pFindServer(bnSocket);
-				if(server){
-					server->ProcessConnectionRequest(pAddressReceive, reader);
+			for(i=0; i<count; i++){
+				deNetworkMessage &datagram = batch.GetDatagramAt(i);
+				if(datagram.GetDataLength() > 0){
+					pProcessDatagram(*bnSocket, batch.GetAddressAt(i), datagram, false);
 				}
 			}
+			
+			if(count < debnDatagramBatch::Capacity){
+				break;
+			}
 		}
 		
 		bnSocket = bnSocket->GetNextSocket();
 	}
 }
 
+void deNetworkBasic::pProcessReceivedDatagrams(){
+	debnIOThread::sReceived received;
+	
+	while(pIOThread->NextReceived(received)){
+		// datagrams of sockets removed meanwhile are dropped
+		debnSocket * const bnSocket = pIOThread->GetSocketWith(received.socket);
+		if(bnSocket){
+			// processing datagrams can release the socket. keep it alive until done
+			const debnSocket::Ref guard(bnSocket);
+			pProcessDatagram(*bnSocket, received.address, received.datagram, received.acknowledged);
+		}
+	}
+	
+	received.datagram = nullptr;
+}
+
+void deNetworkBasic::pProcessDatagram(debnSocket &bnSocket, const debnAddress &address,
+deNetworkMessage &datagram, bool acknowledged){
+	const deNetworkMessageReader::Ref reader(deNetworkMessageReader::Ref::New(&datagram));
+	
+	debnConnection * const connection = bnSocket.GetConnectionWith(address);
+	const eCommandCodes command = (eCommandCodes)reader->ReadByte();
+	
+	if(connection){
+		switch(command){
+		case eccConnectionAck:
+			connection->ProcessConnectionAck(reader);
+			break;
+			
+		case eccConnectionClose:
+			connection->ProcessConnectionClose(reader);
+			break;
+			
+		case eccMessage:
+			connection->ProcessMessage(reader);
+			break;
+			
+		case eccReliableMessage:
+			connection->ProcessReliableMessage(reader, acknowledged);
+			break;
+			
+		case eccReliableLinkState:
+			connection->ProcessReliableLinkState(reader, acknowledged);
+			break;
+			
+		case eccReliableAck:
+			connection->ProcessReliableAck(reader);
+			break;
+			
+		case eccLinkUp:
+			connection->ProcessLinkUp(reader);
+			break;
+			
+		case eccLinkDown:
+			connection->ProcessLinkDown(reader);
+			break;
+			
+		case eccLinkUpdate:
+			connection->ProcessLinkUpdate(reader);
+			break;
+			
+		case eccReliableMessageLong:
+			connection->ProcessReliableMessageLong(reader, acknowledged);
+			break;
+			
+		case eccReliableLinkStateLong:
+			connection->ProcessReliableLinkStateLong(reader, acknowledged);
+			break;
+			
+		default:
+			break;
+		}
+		
+	}else if(command == eccConnectionRequest){
+		debnServer * const server = bnSocket.GetServer();
+		if(server){
+			server->ProcessConnectionRequest(address, reader);
+		}
+	}
+}
+
 void deNetworkBasic::pProcessConnections(float elapsedTime){
 	debnConnection *connection = pHeadConnection;
 	
@@ -564,6 +690,15 @@ void deNetworkBasic::pProcessConnections(float elapsedTime){
 	}
 }
 
+void deNetworkBasic::pFlushSendQueues(){
+	debnSocket *bnSocket = pHeadSocket;
+	
+	while(bnSocket){
+		bnSocket->FlushSendQueue();
+		bnSocket = bnSocket->GetNextSocket();
+	}
+}
+
 #ifdef WITH_INTERNAL_MODULE
 #include <dragengine/systems/modules/deInternalModule.h>
 
@@ -29,6 +29,7 @@
 #include "configuration/debnConfiguration.h"
 #include "parameters/debnParameter.h"
 
+#include <dragengine/deTUniqueReference.h>
 #include <dragengine/common/file/decBaseFileWriter.h>
 #include <dragengine/common/string/decStringList.h>
 #include <dragengine/resources/network/deNetworkMessage.h>
@@ -37,6 +38,8 @@
 class debnSocket;
 class debnServer;
 class debnConnection;
+class debnDatagramBatch;
+class debnIOThread;
 
 /*
 
@@ -174,8 +177,8 @@ private:
 	debnSocket *pTailSocket;
 	
 	// sending and receiving
-	deNetworkMessage::Ref pDatagram;
-	debnAddress pAddressReceive;
+	deTUniqueReference<debnDatagramBatch> pReceiveBatch;
+	deTUniqueReference<debnIOThread> pIOThread;
 	deNetworkMessage::Ref pSharedSendDatagram;
 	decBaseFileWriter::Ref pSharedSendDatagramWriter;
 	
@@ -218,6 +221,18 @@ public:
 	inline debnConfiguration &GetConfiguration(){ return pConfiguration; }
 	inline const debnConfiguration &GetConfiguration() const{ return pConfiguration; }
 	
+	/** Network I/O thread or nullptr if not used. */
+	inline debnIOThread *GetIOThread() const{ return pIOThread; }
+	
+	/**
+	 * Start or stop network I/O thread overriding the configuration.
+	 * \throws deeInvalidAction Sockets exist.
+	 */
+	void SetUseIOThread(bool useIOThread);
+	
+	/** Sockets exist. */
+	inline bool HasSockets() const{ return pHeadSocket != nullptr; }
+	
 	inline const deNetworkMessage::Ref &GetSharedSendDatagram() const{ return pSharedSendDatagram; }
 	inline decBaseFileWriter &GetSharedSendDatagramWriter() const{ return pSharedSendDatagramWriter; }
 	
@@ -254,12 +269,21 @@ public:
 	deBaseNetworkState *CreateState(deNetworkState *state) override;
 	/*@}*/
 	
-private:
-	debnConnection *pFindConnection(const debnSocket *bnSocket, const debnAddress &address) const;
-	debnServer *pFindServer(const debnSocket *bnSocket) const;
 	
+	
+	/** @name Debugging */
+	/*@{*/
+	/** Send command. */
+	void SendCommand(const decUnicodeArgumentList &command, decUnicodeString &answer) override;
+	/*@}*/
+	
+private:
 	void pReceiveDatagrams();
+	void pProcessReceivedDatagrams();
+	void pProcessDatagram(debnSocket &bnSocket, const debnAddress &address,
+		deNetworkMessage &datagram, bool acknowledged);
 	void pProcessConnections(float elapsedTime);
+	void pFlushSendQueues();
 };
 
 // end of include only once
@@ -397,6 +397,22 @@ decString debnAddress::ToString() const{
 	return s;
 }
 
+unsigned int debnAddress::Hash() const{
+	// FNV-1a over type, port and address values
+	unsigned int hash = 2166136261u;
+	int i;
+	
+	hash = (hash ^ (unsigned int)pType) * 16777619u;
+	hash = (hash ^ (unsigned int)(pPort & 0xff)) * 16777619u;
+	hash = (hash ^ (unsigned int)((pPort >> 8) & 0xff)) * 16777619u;
+	
+	for(i=0; i<pValueCount; i++){
+		hash = (hash ^ pValues[i]) * 16777619u;
+	}
+	
+	return hash;
+}
+
 
 
 // Operators
@@ -180,6 +180,9 @@ public:
 	
 	/** \brief Address in string form. */
 	decString ToString() const;
+	
+	/** \brief Hash code for use with decTDictionary. */
+	unsigned int Hash() const;
 	/*@}*/
 	
 	
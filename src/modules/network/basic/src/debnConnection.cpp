@@ -29,6 +29,7 @@
 #include "debnSocket.h"
 #include "debnAddress.h"
 #include "debnConnection.h"
+#include "debnIOThread.h"
 #include "deNetworkBasic.h"
 #include "states/debnState.h"
 #include "states/debnStateLink.h"
@@ -148,11 +149,14 @@ bool debnConnection::Matches(const debnSocket *bnSocket, const debnAddress &addr
 void debnConnection::AcceptConnection(debnSocket *bnSocket, const debnAddress &address, eProtocols protocol){
 	if(!bnSocket) DETHROW(deeInvalidParam);
 	
+	pRemoveFromSocket();
 	pSocket = bnSocket;
 	pRemoteAddress = address;
+	pSocket->AddConnection(pRemoteAddress, this);
 	pConnection->SetRemoteAddress(address.ToString());
 	
 	pConnectionState = ecsConnected;
+	pAddIOPeer();
 	pProtocol = protocol;
 	pElapsedConnectResend = 0.0f;
 	pElapsedConnectTimeout = 0.0f;
@@ -179,6 +183,7 @@ void debnConnection::ProcessConnectionAck(decBaseFileReader &reader){
 			pProtocol = (eProtocols)reader.ReadUShort();
 			
 			pConnectionState = ecsConnected;
+			pAddIOPeer();
 			pConnection->SetConnected(true);
 			
 		}else{
@@ -236,7 +241,7 @@ void debnConnection::ProcessMessage(decBaseFileReader &reader){
 	}
 }
 
-void debnConnection::ProcessReliableMessage(decBaseFileReader &reader){
+void debnConnection::ProcessReliableMessage(decBaseFileReader &reader, bool acknowledged){
 	// we process nothing if not connected
 	if(pConnectionState != ecsConnected){
 		if(pNetBasic->GetConfiguration().GetLogLevel() >= debnConfiguration::ellDebug){
@@ -264,16 +269,10 @@ void debnConnection::ProcessReliableMessage(decBaseFileReader &reader){
 		return;
 	}
 	
-	// send ack
-// 	pNetBasic->LogInfoFormat( "ProcessReliableMessage: send ack for %i", number );
-	decBaseFileWriter &sendWriter = pNetBasic->GetSharedSendDatagramWriter();
-	sendWriter.SetPosition(0);
-	pNetBasic->GetSharedSendDatagram()->Clear();
-	sendWriter.WriteByte((uint8_t)eccReliableAck);
-	sendWriter.WriteUShort((uint16_t)number);
-	sendWriter.WriteByte((uint8_t)eraSuccess);
-	
-	pSocket->SendDatagram(*pNetBasic->GetSharedSendDatagram(), pRemoteAddress);
+	// send ack unless the network I/O thread did already
+	if(!acknowledged){
+		pSendReliableAck(number);
+	}
 	
 	// prepare
 	//length = reader.GetDataLength() - reader.GetPosition();
@@ -285,7 +284,7 @@ void debnConnection::ProcessReliableMessage(decBaseFileReader &reader){
 		pProcessReliableMessage(number, reader);
 		
 		// bump up the number
-		pReliableNumberRecv = (pReliableNumberRecv + 1) % 65535;
+		pSetReliableNumberRecv((pReliableNumberRecv + 1) % 65535);
 		
 		// check if the next message happens to be already in the queue
 		pProcessQueuedMessages();
@@ -296,7 +295,7 @@ void debnConnection::ProcessReliableMessage(decBaseFileReader &reader){
 	}
 }
 
-void debnConnection::ProcessReliableLinkState(decBaseFileReader &reader){
+void debnConnection::ProcessReliableLinkState(decBaseFileReader &reader, bool acknowledged){
 	// we process nothing if not connected
 	if(pConnectionState != ecsConnected){
 		if(pNetBasic->GetConfiguration().GetLogLevel() >= debnConfiguration::ellDebug){
@@ -324,16 +323,10 @@ void debnConnection::ProcessReliableLinkState(decBaseFileReader &reader){
 		return;
 	}
 	
-	// send ack
-// 	pNetBasic->LogInfoFormat( "ProcessReliableLinkState: send ack for %i", number );
-	decBaseFileWriter &sendWriter = pNetBasic->GetSharedSendDatagramWriter();
-	sendWriter.SetPosition(0);
-	pNetBasic->GetSharedSendDatagram()->Clear();
-	sendWriter.WriteByte((uint8_t)eccReliableAck);
-	sendWriter.WriteUShort((uint16_t)number);
-	sendWriter.WriteByte((uint8_t)eraSuccess);
-	
-	pSocket->SendDatagram(*pNetBasic->GetSharedSendDatagram(), pRemoteAddress);
+	// send ack unless the network I/O thread did already
+	if(!acknowledged){
+		pSendReliableAck(number);
+	}
 	
 	// prepare
 	//length = reader.GetDataLength() - reader.GetPosition();
@@ -344,7 +337,7 @@ void debnConnection::ProcessReliableLinkState(decBaseFileReader &reader){
 		pProcessLinkState(number, reader);
 		
 		// bump up the number
-		pReliableNumberRecv = (pReliableNumberRecv + 1) % 65535;
+		pSetReliableNumberRecv((pReliableNumberRecv + 1) % 65535);
 		
 		// check if the next message happens to be already in the queue
 		pProcessQueuedMessages();
@@ -386,8 +379,8 @@ void debnConnection::ProcessReliableAck(decBaseFileReader &reader){
 		// remove all done messages up to the first pending one
 		pRemoveSendReliablesDone();
 		
-	// otherwise resend
-	}else{
+	// otherwise resend. the network I/O thread resent it already
+	}else if(!pIOPeer){
 		if(pNetBasic->GetConfiguration().GetLogLevel() >= debnConfiguration::ellDebug){
 			pNetBasic->LogInfoFormat("Reliable ACK failed, resend message %d", bnMessage->GetNumber());
 		}
@@ -509,7 +502,7 @@ void debnConnection::ProcessLinkUpdate(decBaseFileReader &reader){
 	}
 }
 
-void debnConnection::ProcessReliableMessageLong(decBaseFileReader &reader){
+void debnConnection::ProcessReliableMessageLong(decBaseFileReader &reader, bool acknowledged){
 	// we process nothing if not connected
 	if(pConnectionState != ecsConnected){
 		if(pNetBasic->GetConfiguration().GetLogLevel() >= debnConfiguration::ellDebug){
@@ -537,16 +530,10 @@ void debnConnection::ProcessReliableMessageLong(decBaseFileReader &reader){
 		return;
 	}
 	
-	// send ack
-// 	pNetBasic->LogInfoFormat( "ProcessReliableMessage: send ack for %i", number );
-	decBaseFileWriter &sendWriter = pNetBasic->GetSharedSendDatagramWriter();
-	sendWriter.SetPosition(0);
-	pNetBasic->GetSharedSendDatagram()->Clear();
-	sendWriter.WriteByte((uint8_t)eccReliableAck);
-	sendWriter.WriteUShort((uint16_t)number);
-	sendWriter.WriteByte((uint8_t)eraSuccess);
-	
-	pSocket->SendDatagram(*pNetBasic->GetSharedSendDatagram(), pRemoteAddress);
+	// send ack unless the network I/O thread did already
+	if(!acknowledged){
+		pSendReliableAck(number);
+	}
 	
 	// if the number is the next one expected send directly to the script
 	if(number == pReliableNumberRecv){
@@ -554,7 +541,7 @@ void debnConnection::ProcessReliableMessageLong(decBaseFileReader &reader){
 		pProcessReliableMessageLong(number, reader);
 		
 		// bump up the number
-		pReliableNumberRecv = (pReliableNumberRecv + 1) % 65535;
+		pSetReliableNumberRecv((pReliableNumberRecv + 1) % 65535);
 		
 		// check if the next message happens to be already in the queue
 		pProcessQueuedMessages();
@@ -565,7 +552,7 @@ void debnConnection::ProcessReliableMessageLong(decBaseFileReader &reader){
 	}
 }
 
-void debnConnection::ProcessReliableLinkStateLong(decBaseFileReader &reader){
+void debnConnection::ProcessReliableLinkStateLong(decBaseFileReader &reader, bool acknowledged){
 	// we process nothing if not connected
 	if(pConnectionState != ecsConnected){
 		if(pNetBasic->GetConfiguration().GetLogLevel() >= debnConfiguration::ellDebug){
@@ -593,15 +580,10 @@ void debnConnection::ProcessReliableLinkStateLong(decBaseFileReader &reader){
 		return;
 	}
 	
-	// send ack
-	decBaseFileWriter &sendWriter = pNetBasic->GetSharedSendDatagramWriter();
-	sendWriter.SetPosition(0);
-	pNetBasic->GetSharedSendDatagram()->Clear();
-	sendWriter.WriteByte((uint8_t)eccReliableAck);
-	sendWriter.WriteUShort((uint16_t)number);
-	sendWriter.WriteByte((uint8_t)eraSuccess);
-	
-	pSocket->SendDatagram(*pNetBasic->GetSharedSendDatagram(), pRemoteAddress);
+	// send ack unless the network I/O thread did already
+	if(!acknowledged){
+		pSendReliableAck(number);
+	}
 	
 	// if the number is the next one expected send directly to the script
 	if(number == pReliableNumberRecv){
@@ -609,7 +591,7 @@ void debnConnection::ProcessReliableLinkStateLong(decBaseFileReader &reader){
 		pProcessLinkStateLong(number, reader);
 		
 		// bump up the number
-		pReliableNumberRecv = (pReliableNumberRecv + 1) % 65535;
+		pSetReliableNumberRecv((pReliableNumberRecv + 1) % 65535);
 		
 		// check if the next message happens to be already in the queue
 		pProcessQueuedMessages();
@@ -653,6 +635,7 @@ bool debnConnection::ConnectTo(const char *address){
 	sendWriter.WriteUShort(epDENetworkProtocol);
 	
 	pRemoteAddress = remoteAddress;
+	pSocket->AddConnection(pRemoteAddress, this);
 	pConnection->SetRemoteAddress(address);
 	
 	pSocket->SendDatagram(*pNetBasic->GetSharedSendDatagram(), pRemoteAddress);
@@ -783,10 +766,7 @@ void debnConnection::SendReliableMessage(deNetworkMessage *message){
 		
 		// if the message fits into the window send it right now
 		if(pReliableMessagesSend->GetMessageCount() <= pReliableWindowSize){
-			pSocket->SendDatagram(*bnMessage->GetMessage(), pRemoteAddress);
-			
-			bnMessage->SetState(debnMessage::emsSend);
-			bnMessage->ResetElapsed();
+			pSendReliable(*bnMessage);
 		}
 		
 		// add
@@ -862,10 +842,7 @@ void debnConnection::LinkState(deNetworkMessage *message, deNetworkState *state,
 	
 	// if the message fits into the window send it right now
 	if(pReliableMessagesSend->GetMessageCount() <= pReliableWindowSize){
-		pSocket->SendDatagram(*bnMessage->GetMessage(), pRemoteAddress);
-		
-		bnMessage->SetState(debnMessage::emsSend);
-		bnMessage->ResetElapsed();
+		pSendReliable(*bnMessage);
 	}
 	
 	// add
@@ -900,6 +877,8 @@ void debnConnection::SetIsRegistered(bool isRegistered){
 void debnConnection::pCleanUp(){
 	if(pNetBasic) pNetBasic->UnregisterConnection(this);
 	
+	pRemoveFromSocket();
+	
 	if(pStateLinks){
 		delete pStateLinks;
 	}
@@ -937,6 +916,7 @@ void debnConnection::pDisconnect(){
 	
 	// free the socket
 	pConnectionState = ecsDisconnected;
+	pRemoveFromSocket();
 	pSocket = nullptr;
 	
 	// switch to disconnected state
@@ -944,6 +924,55 @@ void debnConnection::pDisconnect(){
 	pConnection->SetConnected(false);
 }
 
+void debnConnection::pRemoveFromSocket(){
+	if(pIOPeer){
+		pIOPeer->GetThread().RemovePeer(pIOPeer);
+		pIOPeer = nullptr;
+	}
+	
+	if(pSocket){
+		pSocket->RemoveConnection(pRemoteAddress, this);
+	}
+}
+
+void debnConnection::pAddIOPeer(){
+	if(pSocket->GetIOThread() && !pIOPeer){
+		pIOPeer = pSocket->GetIOThread()->AddPeer(
+			pSocket->GetIOSocket(), pRemoteAddress, pReliableWindowSize);
+		pIOPeer->SetReliableNumberRecv(pReliableNumberRecv);
+	}
+}
+
+void debnConnection::pSetReliableNumberRecv(int number){
+	pReliableNumberRecv = number;
+	
+	if(pIOPeer){
+		pIOPeer->SetReliableNumberRecv(number);
+	}
+}
+
+void debnConnection::pSendReliableAck(int number){
+	decBaseFileWriter &sendWriter = pNetBasic->GetSharedSendDatagramWriter();
+	sendWriter.SetPosition(0);
+	pNetBasic->GetSharedSendDatagram()->Clear();
+	sendWriter.WriteByte((uint8_t)eccReliableAck);
+	sendWriter.WriteUShort((uint16_t)number);
+	sendWriter.WriteByte((uint8_t)eraSuccess);
+	
+	pSocket->SendDatagram(*pNetBasic->GetSharedSendDatagram(), pRemoteAddress);
+}
+
+void debnConnection::pSendReliable(debnMessage &bnMessage){
+	pSocket->SendDatagram(*bnMessage.GetMessage(), pRemoteAddress);
+	
+	bnMessage.SetState(debnMessage::emsSend);
+	bnMessage.ResetElapsed();
+	
+	if(pIOPeer){
+		pIOPeer->GetThread().TrackReliable(pIOPeer, bnMessage.GetNumber(), *bnMessage.GetMessage());
+	}
+}
+
 void debnConnection::pUpdateStates(){
 	int linkCount = pModifiedStateLinks.GetCount();
 	if(linkCount == 0){
@@ -1025,7 +1054,8 @@ void debnConnection::pUpdateTimeouts(float elapsedTime){
 				return;
 			}
 			
-			if(bnMessage->GetResendElapsed() > resendInterval){
+			// the network I/O thread resends on its own
+			if(!pIOPeer && bnMessage->GetResendElapsed() > resendInterval){
 				if(pNetBasic->GetConfiguration().GetLogLevel() >= debnConfiguration::ellDebug){
 					pNetBasic->LogInfoFormat("Resend message %d (%f/%f)",
 						bnMessage->GetNumber(), bnMessage->GetResendElapsed(), resendInterval);
@@ -1112,7 +1142,7 @@ void debnConnection::pProcessQueuedMessages(){
 		pReliableMessagesRecv->RemoveMessageAt(index);
 		
 		// bump up the number
-		pReliableNumberRecv = (pReliableNumberRecv + 1) % 65535;
+		pSetReliableNumberRecv((pReliableNumberRecv + 1) % 65535);
 		
 		// see if the next message happens to be in the queue
 		index = pReliableMessagesRecv->IndexOfMessageWithNumber(pReliableNumberRecv);
@@ -1407,10 +1437,7 @@ void debnConnection::pSendPendingReliables(){
 		// if the message is pending send it
 		debnMessage * const bnMessage = pReliableMessagesSend->GetMessageAt(i);
 		if(bnMessage->GetState() == debnMessage::emsPending){
-			pSocket->SendDatagram(*bnMessage->GetMessage(), pRemoteAddress);
-			
-			bnMessage->SetState(debnMessage::emsSend);
-			bnMessage->ResetElapsed();
+			pSendReliable(*bnMessage);
 		}
 	}
 }
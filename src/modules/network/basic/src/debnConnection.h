@@ -27,6 +27,7 @@
 
 #include "deNetworkBasic.h"
 #include "debnAddress.h"
+#include "debnIOPeer.h"
 #include "debnSocket.h"
 #include "states/debnStateLink.h"
 
@@ -35,6 +36,7 @@
 
 class deConnection;
 class deNetworkBasic;
+class debnMessage;
 class debnMessageManager;
 class debnState;
 class debnStateLinkManager;
@@ -69,6 +71,7 @@ private:
 	
 	debnSocket::Ref pSocket;
 	debnAddress pRemoteAddress;
+	debnIOPeer::Ref pIOPeer;
 	int pConnectionState;
 	int pIdentifier;
 	float pElapsedConnectResend;
@@ -155,11 +158,17 @@ public:
 	/** \brief Process message. */
 	void ProcessMessage(decBaseFileReader &reader);
 	
-	/** \brief Process reliable message. */
-	void ProcessReliableMessage(decBaseFileReader &reader);
+	/**
+	 * \brief Process reliable message.
+	 * \param[in] acknowledged Network I/O thread sent the acknowledgement already.
+	 */
+	void ProcessReliableMessage(decBaseFileReader &reader, bool acknowledged);
 	
-	/** \brief Process reliable link state. */
-	void ProcessReliableLinkState(decBaseFileReader &reader);
+	/**
+	 * \brief Process reliable link state.
+	 * \param[in] acknowledged Network I/O thread sent the acknowledgement already.
+	 */
+	void ProcessReliableLinkState(decBaseFileReader &reader, bool acknowledged);
 	
 	/** \brief Process reliable ack. */
 	void ProcessReliableAck(decBaseFileReader &reader);
@@ -173,11 +182,17 @@ public:
 	/** \brief Process link update. */
 	void ProcessLinkUpdate(decBaseFileReader &reader);
 	
-	/** \brief Process long reliable message. */
-	void ProcessReliableMessageLong(decBaseFileReader &reader);
+	/**
+	 * \brief Process long reliable message.
+	 * \param[in] acknowledged Network I/O thread sent the acknowledgement already.
+	 */
+	void ProcessReliableMessageLong(decBaseFileReader &reader, bool acknowledged);
 	
-	/** \brief Process long reliable link state. */
-	void ProcessReliableLinkStateLong(decBaseFileReader &reader);
+	/**
+	 * \brief Process long reliable link state.
+	 * \param[in] acknowledged Network I/O thread sent the acknowledgement already.
+	 */
+	void ProcessReliableLinkStateLong(decBaseFileReader &reader, bool acknowledged);
 	
 	/** \brief Connect to connection object on host. */
 	bool ConnectTo(const char *address) override;
@@ -223,6 +238,11 @@ public:
 private:
 	void pCleanUp();
 	void pDisconnect();
+	void pRemoveFromSocket();
+	void pAddIOPeer();
+	void pSetReliableNumberRecv(int number);
+	void pSendReliableAck(int number);
+	void pSendReliable(debnMessage &bnMessage);
 	void pUpdateStates();
 	void pUpdateTimeouts(float elapsedTime);
 	void pProcessQueuedMessages();
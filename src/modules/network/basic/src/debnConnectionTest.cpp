@@ -0,0 +1,237 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>
+
+#include <chrono>
+#include <thread>
+
+#include "debnConnectionTest.h"
+#include "debnServer.h"
+#include "debnSocket.h"
+#include "debnTestConnectionScripting.h"
+#include "debnTestServerScripting.h"
+#include "deNetworkBasic.h"
+
+#include <dragengine/deEngine.h>
+#include <dragengine/common/exceptions.h>
+#include <dragengine/common/string/unicode/decUnicodeString.h>
+#include <dragengine/common/utils/decTimer.h>
+#include <dragengine/resources/network/deConnection.h>
+#include <dragengine/resources/network/deConnectionManager.h>
+#include <dragengine/resources/network/deNetworkMessage.h>
+#include <dragengine/resources/network/deServer.h>
+#include <dragengine/resources/network/deServerManager.h>
+
+
+// Definitions
+////////////////
+
+#define TEST_TIMEOUT 5.0f
+
+// message sizes sent in turn. sizes above 1357 bytes are split into long message parts
+static const int vConnectionTestSizes[] = {1, 32, 1357, 1358, 4000, 200, 20000};
+
+static const int vConnectionTestSizeCount = sizeof(vConnectionTestSizes) / sizeof(int);
+
+
+// Deterministic test content
+static void debnCTFillMessage(deNetworkMessage &message, int index){
+	const int size = vConnectionTestSizes[index % vConnectionTestSizeCount];
+	message.SetDataLength(size);
+	
+	uint8_t * const data = message.GetBuffer();
+	uint32_t seed = (uint32_t)(index + 1);
+	int i;
+	for(i=0; i<size; i++){
+		seed = seed * 1664525u + 1013904223u;
+		data[i] = (uint8_t)(seed >> 24);
+	}
+}
+
+static bool debnCTCheckMessages(const decTObjectList<deNetworkMessage> &messages,
+int messageCount, const char *side, decString &error){
+	if(messages.GetCount() != messageCount){
+		error.AppendFormat("%s received %d of %d messages\n", side, messages.GetCount(), messageCount);
+		return false;
+	}
+	
+	const deNetworkMessage::Ref expected(deNetworkMessage::Ref::New());
+	int i;
+	for(i=0; i<messageCount; i++){
+		debnCTFillMessage(expected, i);
+		const deNetworkMessage &message = messages.GetAt(i);
+		
+		if(message.GetDataLength() != expected->GetDataLength()
+		|| memcmp(message.GetBuffer(), expected->GetBuffer(), expected->GetDataLength()) != 0){
+			error.AppendFormat("%s received wrong message %d (%d bytes, expected %d)\n",
+				side, i, message.GetDataLength(), expected->GetDataLength());
+			return false;
+		}
+	}
+	
+	return true;
+}
+
+
+
+// Class debnConnectionTest
+/////////////////////////////
+
+// Constructor, destructor
+////////////////////////////
+
+debnConnectionTest::debnConnectionTest(deNetworkBasic &module) :
+pModule(module){
+}
+
+debnConnectionTest::~debnConnectionTest(){
+}
+
+
+
+// Management
+///////////////
+
+bool debnConnectionTest::Run(int messageCount, decUnicodeString &answer){
+	DEASSERT_TRUE(messageCount > 0)
+	
+	const char * const modeNames[2] = {"frame update", "I/O thread"};
+	const bool useIOThread = pModule.GetIOThread() != nullptr;
+	decString result, error;
+	bool success = true;
+	int mode;
+	
+	for(mode=0; mode<2; mode++){
+		try{
+			if(pRunMode(mode == 1, messageCount, error)){
+				result.AppendFormat("%s: %d messages echoed\n", modeNames[mode], messageCount);
+				
+			}else{
+				error.AppendFormat("%s: failed\n", modeNames[mode]);
+				success = false;
+			}
+			
+		}catch(const deException &e){
+			error.AppendFormat("%s: %s: %s\n", modeNames[mode],
+				e.GetName().GetString(), e.GetDescription().GetString());
+			success = false;
+		}
+	}
+	
+	pModule.SetUseIOThread(useIOThread);
+	
+	if(success){
+		result += "Connection test passed.";
+		
+	}else{
+		result = error + "Connection test failed.";
+	}
+	
+	answer.SetFromUTF8(result);
+	return success;
+}
+
+
+
+// Private Functions
+//////////////////////
+
+bool debnConnectionTest::pRunMode(bool useIOThread, int messageCount, decString &error){
+	pModule.SetUseIOThread(useIOThread);
+	
+	// server sending received messages back
+	debnTestServerScripting * const serverPeer = new debnTestServerScripting(true);
+	const deServer::Ref server(pModule.GetGameEngine()->GetServerManager()->CreateServer());
+	server->SetPeerScripting(serverPeer);
+	
+	if(!server->ListenOn("127.0.0.1:0")){
+		error += "listening failed\n";
+		return false;
+	}
+	
+	const decString serverAddress(((debnServer*)server->GetPeerNetwork())
+		->GetSocket()->GetAddress().ToString());
+	
+	// connect client
+	const deConnection::Ref client(pModule.GetGameEngine()->GetConnectionManager()->CreateConnection());
+	debnTestConnectionScripting * const clientPeer = new debnTestConnectionScripting(client, false);
+	client->SetPeerScripting(clientPeer);
+	
+	if(!client->ConnectTo(serverAddress)
+	|| !pProcessUntil([&](){
+		return client->GetConnected() && serverPeer->GetConnections().GetCount() == 1;
+	})){
+		error.AppendFormat("connecting to %s failed\n", serverAddress.GetString());
+		return false;
+	}
+	
+	const deConnection &serverConnection = serverPeer->GetConnections().GetAt(0);
+	const debnTestConnectionScripting &serverConnectionPeer =
+		*((const debnTestConnectionScripting*)serverConnection.GetPeerScripting());
+	
+	// send all messages at once. the reliable window limits how many are in flight
+	int i;
+	for(i=0; i<messageCount; i++){
+		const deNetworkMessage::Ref message(deNetworkMessage::Ref::New());
+		debnCTFillMessage(message, i);
+		client->SendReliableMessage(message);
+	}
+	
+	if(!pProcessUntil([&](){
+		return clientPeer->GetReceived().GetCount() >= messageCount;
+	})){
+		error += "timeout waiting for messages\n";
+	}
+	
+	bool success = debnCTCheckMessages(serverConnectionPeer.GetReceived(), messageCount, "server", error);
+	success &= debnCTCheckMessages(clientPeer->GetReceived(), messageCount, "client", error);
+	
+	// disconnect client. the server connection is closed by the remote side
+	client->Disconnect();
+	
+	if(!pProcessUntil([&](){
+		return serverConnectionPeer.GetClosed();
+	})){
+		error += "server connection not closed\n";
+		success = false;
+	}
+	
+	server->StopListening();
+	return success;
+}
+
+template<typename Condition> bool debnConnectionTest::pProcessUntil(Condition condition){
+	decTimer timer;
+	
+	while(timer.PeekElapsedTime() < TEST_TIMEOUT){
+		pModule.ProcessNetwork();
+		if(condition()){
+			return true;
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	
+	return false;
+}
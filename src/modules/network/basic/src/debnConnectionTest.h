@@ -0,0 +1,82 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DEBNCONNECTIONTEST_H_
+#define _DEBNCONNECTIONTEST_H_
+
+#include <dragengine/common/string/decString.h>
+
+class deNetworkBasic;
+class decUnicodeString;
+
+
+/**
+ * Loopback connection test.
+ * 
+ * Connects a connection to a server listening on the loopback interface and sends reliable
+ * messages of different sizes including long messages. The server sends them back and the
+ * client verifies order and content. Runs once processing datagrams during the frame update
+ * and once using a network I/O thread. Requires that no sockets exist. Run using the module
+ * command "connectionTest".
+ */
+class debnConnectionTest{
+private:
+	deNetworkBasic &pModule;
+	
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/** Create test. */
+	explicit debnConnectionTest(deNetworkBasic &module);
+	
+	/** Clean up test. */
+	~debnConnectionTest();
+	/*@}*/
+	
+	
+	
+	/** \name Management */
+	/*@{*/
+	/** Module. */
+	inline deNetworkBasic &GetModule() const{ return pModule; }
+	
+	/**
+	 * Run test.
+	 * \param[in] messageCount Count of reliable messages to send.
+	 * \param[out] answer Results.
+	 * \returns true if all messages arrived back in order.
+	 */
+	bool Run(int messageCount, decUnicodeString &answer);
+	/*@}*/
+	
+	
+	
+private:
+	bool pRunMode(bool useIOThread, int messageCount, decString &error);
+	template<typename Condition> bool pProcessUntil(Condition condition);
+};
+
+#endif
@@ -1,7 +1,7 @@
 /*
  * MIT License
  *
- * Copyright (C) 2024, DragonDreams GmbH (info@dragondreams.ch)
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -22,31 +22,39 @@
  * SOFTWARE.
  */
 
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-
-#include "debpDOctreeVisitor.h"
+#include "debnDatagramBatch.h"
 
 #include <dragengine/common/exceptions.h>
 
 
-// Class debpDOctreeVisitor
-///////////////////////////
+
+// Class debnDatagramBatch
+////////////////////////////
 
 // Constructor, destructor
 ////////////////////////////
 
-debpDOctreeVisitor::debpDOctreeVisitor(){
+debnDatagramBatch::debnDatagramBatch() :
+pCount(0)
+{
+	int i;
+	for(i=0; i<Capacity; i++){
+		pDatagrams[i] = deNetworkMessage::Ref::New();
+		pDatagrams[i]->SetDataLength(BufferSize);
+	}
 }
 
-debpDOctreeVisitor::~debpDOctreeVisitor(){
+debnDatagramBatch::~debnDatagramBatch(){
 }
 
 
 
-// Visiting
-/////////////
+// Management
+///////////////
 
-void debpDOctreeVisitor::VisitNode(debpDOctree *node, int intersection){
+void debnDatagramBatch::SetCount(int count){
+	DEASSERT_TRUE(count >= 0)
+	DEASSERT_TRUE(count <= Capacity)
+	
+	pCount = count;
 }
@@ -0,0 +1,86 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DEBNDATAGRAMBATCH_H_
+#define _DEBNDATAGRAMBATCH_H_
+
+#include "debnAddress.h"
+
+#include <dragengine/resources/network/deNetworkMessage.h>
+
+
+/**
+ * \brief Batch of received datagrams.
+ * 
+ * Holds up to Capacity datagrams received from a socket in one call together with the
+ * address each datagram has been received from. The datagram buffers are allocated
+ * once with the maximum datagram size and reused for all receive calls.
+ */
+class debnDatagramBatch{
+public:
+	/** \brief Maximum number of datagrams received in one call. */
+	static const int Capacity = 16;
+	
+	/** \brief Size of datagram buffers. */
+	static const int BufferSize = 65535;
+	
+	
+	
+private:
+	deNetworkMessage::Ref pDatagrams[Capacity];
+	debnAddress pAddresses[Capacity];
+	int pCount;
+	
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/** \brief Create datagram batch. */
+	debnDatagramBatch();
+	
+	/** \brief Clean up datagram batch. */
+	~debnDatagramBatch();
+	/*@}*/
+	
+	
+	
+	/** \name Management */
+	/*@{*/
+	/** \brief Count of received datagrams. */
+	inline int GetCount() const{ return pCount; }
+	
+	/** \brief Set count of received datagrams. */
+	void SetCount(int count);
+	
+	/** \brief Datagram at index. */
+	inline deNetworkMessage &GetDatagramAt(int index) const{ return pDatagrams[index]; }
+	
+	/** \brief Address datagram at index has been received from. */
+	inline debnAddress &GetAddressAt(int index){ return pAddresses[index]; }
+	inline const debnAddress &GetAddressAt(int index) const{ return pAddresses[index]; }
+	/*@}*/
+};
+
+#endif
@@ -0,0 +1,73 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "debnIOPeer.h"
+
+#include <dragengine/common/exceptions.h>
+
+
+// Class debnIOPeer
+/////////////////////
+
+// Constructor, destructor
+////////////////////////////
+
+debnIOPeer::debnIOPeer(debnIOThread &thread, int socket, const debnAddress &address, int windowSize) :
+pThread(thread),
+pSocket(socket),
+pAddress(address),
+pWindowSize(windowSize),
+pReliableNumberRecv(0),
+pActive(true)
+{
+	DEASSERT_TRUE(windowSize > 0)
+}
+
+debnIOPeer::~debnIOPeer(){
+}
+
+
+
+// Management
+///////////////
+
+void debnIOPeer::SetReliableNumberRecv(int number){
+	pReliableNumberRecv.store(number, std::memory_order_release);
+}
+
+bool debnIOPeer::IsInsideWindow(int number) const{
+	// same test as debnConnection does before processing a reliable datagram
+	const int first = GetReliableNumberRecv();
+	
+	if(number < first){
+		return number < (first + pWindowSize) % 65535;
+		
+	}else{
+		return number < first + pWindowSize;
+	}
+}
+
+void debnIOPeer::Deactivate(){
+	pActive.store(false, std::memory_order_release);
+}
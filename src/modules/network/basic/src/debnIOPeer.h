@@ -0,0 +1,122 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DEBNIOPEER_H_
+#define _DEBNIOPEER_H_
+
+#include <atomic>
+
+#include "debnAddress.h"
+
+#include <dragengine/common/collection/decTList.h>
+#include <dragengine/resources/network/deNetworkMessage.h>
+#include <dragengine/threading/deThreadSafeObject.h>
+
+class debnIOThread;
+
+
+/**
+ * Connected remote peer known to the network I/O thread.
+ * 
+ * Shared between the connection on the main thread and the I/O thread. The main thread
+ * publishes the next expected reliable number. The I/O thread uses it to acknowledge
+ * reliable datagrams inside the receive window the moment they arrive. Reliable datagrams
+ * waiting for an acknowledgement are tracked by the I/O thread which resends them.
+ */
+class debnIOPeer : public deThreadSafeObject{
+public:
+	/** \brief Type holding strong reference. */
+	using Ref = deTThreadSafeObjectReference<debnIOPeer>;
+	
+	/** Reliable datagram waiting for acknowledgement. */
+	struct sTracked{
+		int number;
+		double lastSend;
+		deNetworkMessage::Ref datagram;
+	};
+	
+	
+	
+private:
+	debnIOThread &pThread;
+	const int pSocket;
+	const debnAddress pAddress;
+	const int pWindowSize;
+	
+	std::atomic<int> pReliableNumberRecv;
+	std::atomic<bool> pActive;
+	
+	decTList<sTracked> pTracked;
+	
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/** Create peer. */
+	debnIOPeer(debnIOThread &thread, int socket, const debnAddress &address, int windowSize);
+	
+protected:
+	/** Clean up peer. */
+	~debnIOPeer() override;
+	/*@}*/
+	
+	
+	
+public:
+	/** \name Management */
+	/*@{*/
+	/** I/O thread. */
+	inline debnIOThread &GetThread() const{ return pThread; }
+	
+	/** Socket identifier assigned by the I/O thread. */
+	inline int GetSocket() const{ return pSocket; }
+	
+	/** Remote address. */
+	inline const debnAddress &GetAddress() const{ return pAddress; }
+	
+	/** Reliable receive window size. */
+	inline int GetWindowSize() const{ return pWindowSize; }
+	
+	/** Next expected reliable number. Thread safe. */
+	inline int GetReliableNumberRecv() const{ return pReliableNumberRecv.load(std::memory_order_acquire); }
+	
+	/** Set next expected reliable number. Call only from the main thread. */
+	void SetReliableNumberRecv(int number);
+	
+	/** Reliable number is inside the receive window. Thread safe. */
+	bool IsInsideWindow(int number) const;
+	
+	/** Peer is active. Thread safe. */
+	inline bool GetActive() const{ return pActive.load(std::memory_order_acquire); }
+	
+	/** Deactivate peer. Call only from the main thread. */
+	void Deactivate();
+	
+	/** Tracked reliable datagrams. Access only from the I/O thread. */
+	inline decTList<sTracked> &GetTracked(){ return pTracked; }
+	/*@}*/
+};
+
+#endif
@@ -0,0 +1,552 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef OS_W32
+#include <winsock2.h>
+#include <dragengine/app/include_windows.h>
+#endif
+
+#include "debnIOThread.h"
+#include "debnSocket.h"
+#include "deNetworkBasic.h"
+
+#include <dragengine/common/exceptions.h>
+#include <dragengine/common/math/decMath.h>
+
+#if defined OS_UNIX && !defined OS_MACOS && !defined OS_BEOS && !defined OS_WEBWASM
+	#define DEBN_USE_EPOLL 1
+	#include <sys/epoll.h>
+	#include <sys/eventfd.h>
+	#include <unistd.h>
+#elif defined OS_UNIX
+	#ifdef OS_WEBWASM
+		#include <poll.h>
+	#else
+		#include <sys/poll.h>
+	#endif
+#endif
+
+
+// Definitions
+////////////////
+
+// longest time in milliseconds the thread waits for sockets before checking on resends
+#define DEBN_WAIT_TIMEOUT 10
+
+// platforms without epoll wake the thread this often to process commands
+#define DEBN_POLL_TIMEOUT 1
+
+#define DEBN_EPOLL_EVENTS 16
+
+
+
+// Class debnIOThread
+///////////////////////
+
+// Constructor, destructor
+////////////////////////////
+
+debnIOThread::debnIOThread(deNetworkBasic &netBasic, float resendInterval) :
+pNetBasic(netBasic),
+pResendInterval((double)resendInterval),
+pStarted(false),
+pNextSocket(1),
+pTime(0.0),
+pNextResend(0.0),
+pExit(false),
+pEPoll(-1),
+pWakeEvent(-1)
+{
+	#ifdef DEBN_USE_EPOLL
+	try{
+		pEPoll = epoll_create1(EPOLL_CLOEXEC);
+		if(pEPoll == -1){
+			DETHROW_INFO(deeInvalidAction, "epoll_create1 failed");
+		}
+		
+		pWakeEvent = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+		if(pWakeEvent == -1){
+			DETHROW_INFO(deeInvalidAction, "eventfd failed");
+		}
+		
+		// socket identifiers start at 1. 0 marks the wake event
+		epoll_event event;
+		memset(&event, 0, sizeof(event));
+		event.events = EPOLLIN;
+		event.data.u32 = 0;
+		if(epoll_ctl(pEPoll, EPOLL_CTL_ADD, pWakeEvent, &event)){
+			DETHROW_INFO(deeInvalidAction, "epoll_ctl failed");
+		}
+		
+	}catch(const deException &){
+		pCleanUp();
+		throw;
+	}
+	#endif
+}
+
+debnIOThread::~debnIOThread(){
+	StopThread();
+	pCleanUp();
+}
+
+
+
+// Management
+///////////////
+
+void debnIOThread::StartThread(){
+	if(pStarted){
+		return;
+	}
+	
+	pStarted = true;
+	Start();
+}
+
+void debnIOThread::StopThread(){
+	if(!pStarted){
+		return;
+	}
+	
+	pPushCommand(ecExit, 0, nullptr, nullptr, 0, {}, nullptr);
+	pWake();
+	WaitForExit();
+	
+	pStarted = false;
+}
+
+int debnIOThread::AddSocket(debnSocket &bnSocket){
+	const int socket = pNextSocket++;
+	pSockets.SetAt(socket, &bnSocket);
+	
+	pPushCommand(ecAddSocket, socket, &bnSocket, nullptr, 0, {}, nullptr);
+	pWake();
+	return socket;
+}
+
+void debnIOThread::RemoveSocket(int socket){
+	pSockets.RemoveIfPresent(socket);
+	
+	if(pStarted){
+		deSemaphore processed;
+		pPushCommand(ecRemoveSocket, socket, nullptr, nullptr, 0, {}, &processed);
+		pWake();
+		processed.Wait();
+		
+	}else{
+		pPushCommand(ecRemoveSocket, socket, nullptr, nullptr, 0, {}, nullptr);
+	}
+}
+
+debnSocket *debnIOThread::GetSocketWith(int socket) const{
+	return pSockets.GetAtOrDefault(socket, nullptr);
+}
+
+debnIOPeer::Ref debnIOThread::AddPeer(int socket, const debnAddress &address, int windowSize){
+	const debnIOPeer::Ref peer(debnIOPeer::Ref::New(*this, socket, address, windowSize));
+	pPushCommand(ecAddPeer, socket, nullptr, peer, 0, {}, nullptr);
+	return peer;
+}
+
+void debnIOThread::RemovePeer(debnIOPeer &peer){
+	peer.Deactivate();
+	pPushCommand(ecRemovePeer, peer.GetSocket(), nullptr, &peer, 0, {}, nullptr);
+}
+
+void debnIOThread::TrackReliable(debnIOPeer &peer, int number, const deNetworkMessage &datagram){
+	// the reference count of network messages is not thread safe. the copy is moved into
+	// the command so no reference stays behind on this thread once the command is queued
+	const int length = datagram.GetDataLength();
+	deNetworkMessage::Ref copy(deNetworkMessage::Ref::New());
+	copy->SetDataLength(length);
+	memcpy(copy->GetBuffer(), datagram.GetBuffer(), length);
+	
+	pPushCommand(ecTrackReliable, peer.GetSocket(), nullptr, &peer, number, std::move(copy), nullptr);
+}
+
+bool debnIOThread::NextReceived(sReceived &received){
+	return pReceived.Pop(received);
+}
+
+
+
+void debnIOThread::Run(){
+	pTimer.Reset();
+	
+	while(true){
+		try{
+			pProcessCommands();
+			if(pExit){
+				break;
+			}
+			
+			pUpdateTime();
+			pResendDue();
+			pWaitReceive();
+			
+		}catch(const deException &e){
+			pNetBasic.LogException(e);
+		}
+	}
+	
+	// drop everything still known. the thread owning the queue is done with it
+	pPeers.RemoveAll();
+	pThreadSockets.RemoveAll();
+	pExit = false;
+}
+
+
+
+// Private Functions
+//////////////////////
+
+void debnIOThread::pCleanUp(){
+	#ifdef DEBN_USE_EPOLL
+	if(pWakeEvent != -1){
+		close(pWakeEvent);
+		pWakeEvent = -1;
+	}
+	if(pEPoll != -1){
+		close(pEPoll);
+		pEPoll = -1;
+	}
+	#endif
+}
+
+void debnIOThread::pPushCommand(eCommands type, int socket, debnSocket *bnSocket,
+debnIOPeer *peer, int number, deNetworkMessage::Ref &&datagram, deSemaphore *processed){
+	sCommand command;
+	command.type = type;
+	command.socket = socket;
+	command.bnSocket = bnSocket;
+	command.peer = peer;
+	command.number = number;
+	command.datagram = std::move(datagram);
+	command.processed = processed;
+	pCommands.Push(std::move(command));
+}
+
+debnIOPeer *debnIOThread::pGetPeer(int socket, const debnAddress &address) const{
+	const debnIOPeer::Ref *peer;
+	return pPeers.GetAt({socket, address}, peer) ? peer->Pointer() : nullptr;
+}
+
+void debnIOThread::pWake(){
+	#ifdef DEBN_USE_EPOLL
+	const uint64_t value = 1;
+	if(write(pWakeEvent, &value, sizeof(value)) != sizeof(value)){
+		// counter overflow only. thread is awake already
+	}
+	#endif
+}
+
+void debnIOThread::pProcessCommands(){
+	sCommand command;
+	
+	while(pCommands.Pop(command)){
+		switch(command.type){
+		case ecAddSocket:{
+			pThreadSockets.Add({command.socket, command.bnSocket});
+			
+			#ifdef DEBN_USE_EPOLL
+			epoll_event event;
+			memset(&event, 0, sizeof(event));
+			event.events = EPOLLIN;
+			event.data.u32 = (uint32_t)command.socket;
+			if(epoll_ctl(pEPoll, EPOLL_CTL_ADD, command.bnSocket->GetHandle(), &event)){
+				pNetBasic.LogErrorFormat("I/O thread: epoll_ctl failed adding socket %s",
+					command.bnSocket->GetAddress().ToString().GetString());
+			}
+			#endif
+			}break;
+			
+		case ecRemoveSocket:{
+			const int index = pThreadSockets.IndexOfMatching([&](const sSocket &sock){
+				return sock.identifier == command.socket;
+			});
+			
+			if(index != -1){
+				#ifdef DEBN_USE_EPOLL
+				epoll_ctl(pEPoll, EPOLL_CTL_DEL, pThreadSockets[index].bnSocket->GetHandle(), nullptr);
+				#endif
+				pThreadSockets.RemoveFrom(index);
+			}
+			
+			const decTList<sPeerKey> keys(pPeers.GetKeys());
+			keys.Visit([&](const sPeerKey &key){
+				if(key.socket == command.socket){
+					pPeers.Remove(key);
+				}
+			});
+			
+			if(command.processed){
+				command.processed->Signal();
+			}
+			}break;
+			
+		case ecAddPeer:
+			pPeers.SetAt({command.socket, command.peer->GetAddress()}, command.peer);
+			break;
+			
+		case ecRemovePeer:
+			if(pGetPeer(command.socket, command.peer->GetAddress()) == command.peer){
+				pPeers.Remove({command.socket, command.peer->GetAddress()});
+			}
+			break;
+			
+		case ecTrackReliable:
+			if(command.peer->GetActive()){
+				command.peer->GetTracked().Add({command.number, pTime, std::move(command.datagram)});
+				pNextResend = decMath::min(pNextResend, pTime + pResendInterval);
+			}
+			break;
+			
+		case ecExit:
+			pExit = true;
+			break;
+		}
+		
+		// release references now and not when the next command is popped
+		command.peer = nullptr;
+		command.datagram = nullptr;
+	}
+}
+
+void debnIOThread::pWaitReceive(){
+#ifdef DEBN_USE_EPOLL
+	const int timeout = (int)decMath::clamp((pNextResend - pTime) * 1000.0 + 1.0,
+		0.0, (double)DEBN_WAIT_TIMEOUT);
+	
+	epoll_event events[DEBN_EPOLL_EVENTS];
+	const int count = epoll_wait(pEPoll, events, DEBN_EPOLL_EVENTS, timeout);
+	int i;
+	
+	for(i=0; i<count; i++){
+		if(events[i].data.u32 == 0){
+			uint64_t value;
+			if(read(pWakeEvent, &value, sizeof(value)) != sizeof(value)){
+				// no wake pending anymore
+			}
+			
+		}else{
+			pReceive((int)events[i].data.u32);
+		}
+	}
+	
+#else
+	const int count = pThreadSockets.GetCount();
+	if(count == 0){
+		#ifdef OS_W32
+		Sleep(DEBN_POLL_TIMEOUT);
+		#else
+		poll(nullptr, 0, DEBN_POLL_TIMEOUT);
+		#endif
+		return;
+	}
+	
+	int i;
+	#ifdef OS_W32
+	fd_set fds;
+	FD_ZERO(&fds);
+	for(i=0; i<count; i++){
+		FD_SET(pThreadSockets[i].bnSocket->GetHandle(), &fds);
+	}
+	
+	TIMEVAL tv;
+	tv.tv_sec = 0;
+	tv.tv_usec = DEBN_POLL_TIMEOUT * 1000;
+	if(select(0, &fds, NULL, NULL, &tv) < 1){
+		return;
+	}
+	
+	#else
+	decTList<pollfd> fds;
+	for(i=0; i<count; i++){
+		fds.Add({pThreadSockets[i].bnSocket->GetHandle(), POLLIN, 0});
+	}
+	if(poll(fds.GetArrayPointer(), count, DEBN_POLL_TIMEOUT) < 1){
+		return;
+	}
+	#endif
+	
+	// receiving processes commands which can remove sockets. copy the identifiers first
+	decTList<int> sockets;
+	for(i=0; i<count; i++){
+		sockets.Add(pThreadSockets[i].identifier);
+	}
+	sockets.Visit([&](int socket){
+		pReceive(socket);
+	});
+#endif
+}
+
+void debnIOThread::pReceive(int socket){
+	// acks can arrive for reliables the main thread just asked to track. process
+	// commands first to know them. this can also remove the socket
+	pProcessCommands();
+	
+	const int index = pThreadSockets.IndexOfMatching([&](const sSocket &sock){
+		return sock.identifier == socket;
+	});
+	if(index == -1){
+		return;
+	}
+	
+	const sSocket sock(pThreadSockets[index]);
+	int i;
+	
+	while(true){
+		const int count = sock.bnSocket->ReceiveDatagrams(pBatch);
+		
+		for(i=0; i<count; i++){
+			const deNetworkMessage &datagram = pBatch.GetDatagramAt(i);
+			const int length = datagram.GetDataLength();
+			if(length == 0){
+				continue;
+			}
+			
+			const debnAddress &address = pBatch.GetAddressAt(i);
+			const bool acknowledged = pProcessDatagram(sock, address, datagram);
+			
+			// moved into the queue. the main thread becomes the only owner of the copy
+			deNetworkMessage::Ref copy(deNetworkMessage::Ref::New());
+			copy->SetDataLength(length);
+			memcpy(copy->GetBuffer(), datagram.GetBuffer(), length);
+			
+			pReceived.Push({socket, address, std::move(copy), acknowledged});
+		}
+		
+		if(count < debnDatagramBatch::Capacity){
+			break;
+		}
+	}
+}
+
+bool debnIOThread::pProcessDatagram(const sSocket &sock,
+const debnAddress &address, const deNetworkMessage &datagram){
+	if(datagram.GetDataLength() < 3){
+		return false;
+	}
+	
+	const uint8_t * const data = datagram.GetBuffer();
+	const int command = data[0];
+	const int number = (int)data[1] | ((int)data[2] << 8);
+	
+	switch(command){
+	case eccReliableMessage:
+	case eccReliableLinkState:
+	case eccReliableMessageLong:
+	case eccReliableLinkStateLong:{
+		// acknowledge only what the connection is going to accept. peers are only
+		// known while connected. everything else the main thread acknowledges itself
+		const debnIOPeer * const peer = pGetPeer(sock.identifier, address);
+		if(!peer || !peer->GetActive() || !peer->IsInsideWindow(number)){
+			return false;
+		}
+		
+		const uint8_t ack[4] = {(uint8_t)eccReliableAck,
+			(uint8_t)number, (uint8_t)(number >> 8), (uint8_t)eraSuccess};
+		sock.bnSocket->SendDatagramDirect(ack, 4, address);
+		return true;
+		}
+		
+	case eccReliableAck:{
+		if(datagram.GetDataLength() < 4){
+			return false;
+		}
+		
+		debnIOPeer * const peer = pGetPeer(sock.identifier, address);
+		if(!peer){
+			return false;
+		}
+		
+		decTList<debnIOPeer::sTracked> &tracked = peer->GetTracked();
+		const int index = tracked.IndexOfMatching([&](const debnIOPeer::sTracked &each){
+			return each.number == number;
+		});
+		if(index == -1){
+			return false;
+		}
+		
+		if(data[3] == eraSuccess){
+			tracked.RemoveFrom(index);
+			
+		}else{
+			debnIOPeer::sTracked &resend = tracked[index];
+			sock.bnSocket->SendDatagramDirect(resend.datagram->GetBuffer(),
+				resend.datagram->GetDataLength(), address);
+			resend.lastSend = pTime;
+		}
+		
+		// main thread has to see the ack to finish the message
+		return false;
+		}
+		
+	default:
+		return false;
+	}
+}
+
+void debnIOThread::pResendDue(){
+	if(pTime < pNextResend){
+		return;
+	}
+	
+	const double threshold = pTime - pResendInterval;
+	double nextResend = pTime + pResendInterval;
+	
+	pPeers.Visit([&](const sPeerKey &key, const debnIOPeer::Ref &peer){
+		const int index = pThreadSockets.IndexOfMatching([&](const sSocket &sock){
+			return sock.identifier == key.socket;
+		});
+		if(index == -1){
+			return;
+		}
+		
+		debnSocket &bnSocket = *pThreadSockets[index].bnSocket;
+		decTList<debnIOPeer::sTracked> &trackedList = peer->GetTracked();
+		const int count = trackedList.GetCount();
+		int i;
+		
+		for(i=0; i<count; i++){
+			debnIOPeer::sTracked &tracked = trackedList[i];
+			if(tracked.lastSend <= threshold){
+				bnSocket.SendDatagramDirect(tracked.datagram->GetBuffer(),
+					tracked.datagram->GetDataLength(), key.address);
+				tracked.lastSend = pTime;
+			}
+			nextResend = decMath::min(nextResend, tracked.lastSend + pResendInterval);
+		}
+	});
+	
+	pNextResend = nextResend;
+}
+
+void debnIOThread::pUpdateTime(){
+	pTime += (double)pTimer.GetElapsedTime();
+}
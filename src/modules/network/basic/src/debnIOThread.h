@@ -0,0 +1,206 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DEBNIOTHREAD_H_
+#define _DEBNIOTHREAD_H_
+
+#include "debnAddress.h"
+#include "debnDatagramBatch.h"
+#include "debnIOPeer.h"
+#include "debnTLockFreeQueue.h"
+
+#include <dragengine/common/collection/decTDictionary.h>
+#include <dragengine/common/collection/decTList.h>
+#include <dragengine/common/utils/decTimer.h>
+#include <dragengine/resources/network/deNetworkMessage.h>
+#include <dragengine/threading/deSemaphore.h>
+#include <dragengine/threading/deThread.h>
+
+class deNetworkBasic;
+class debnSocket;
+
+
+/**
+ * Network I/O thread.
+ * 
+ * Optional thread doing the socket work independent of the frame rate of the main thread.
+ * Received datagrams are handed to the main thread which processes them the next time
+ * deNetworkBasic::ProcessNetwork() is called. Reliable datagrams from connected peers
+ * are acknowledged as soon as they arrive if they are inside the receive window. Sent
+ * reliable datagrams are resent until the acknowledgement arrives. Timeouts, connection
+ * state changes and all scripting callbacks stay on the main thread.
+ * 
+ * The main thread talks to the I/O thread using a lock-free command queue. The I/O thread
+ * hands received datagrams to the main thread using a lock-free queue. Network messages
+ * are not thread safe reference counted. Datagrams are therefore copied and moved into
+ * the queues. Only the thread popping them holds a reference afterwards. Sending datagrams
+ * is still done by the main thread while the I/O thread only sends acknowledgements and
+ * resends. On Linux the thread waits on the sockets using epoll. Other platforms poll
+ * the sockets in short intervals.
+ * 
+ * All public functions have to be called from the main thread.
+ */
+class debnIOThread : public deThread{
+public:
+	/** Received datagram. */
+	struct sReceived{
+		int socket;
+		debnAddress address;
+		deNetworkMessage::Ref datagram;
+		bool acknowledged;
+	};
+	
+	
+	
+private:
+	enum eCommands{
+		ecAddSocket,
+		ecRemoveSocket,
+		ecAddPeer,
+		ecRemovePeer,
+		ecTrackReliable,
+		ecExit
+	};
+	
+	struct sCommand{
+		eCommands type;
+		int socket;
+		debnSocket *bnSocket;
+		debnIOPeer::Ref peer;
+		int number;
+		deNetworkMessage::Ref datagram;
+		deSemaphore *processed;
+	};
+	
+	struct sSocket{
+		int identifier;
+		debnSocket *bnSocket;
+	};
+	
+	struct sPeerKey{
+		int socket;
+		debnAddress address;
+		
+		inline unsigned int Hash() const{ return address.Hash() * 31u + (unsigned int)socket; }
+		inline bool operator==(const sPeerKey &key) const{ return socket == key.socket && address == key.address; }
+	};
+	
+	deNetworkBasic &pNetBasic;
+	const double pResendInterval;
+	bool pStarted;
+	
+	decTDictionary<int, debnSocket*> pSockets;
+	int pNextSocket;
+	
+	debnTLockFreeQueue<sCommand> pCommands;
+	debnTLockFreeQueue<sReceived> pReceived;
+	
+	decTList<sSocket> pThreadSockets;
+	decTDictionary<sPeerKey, debnIOPeer::Ref> pPeers;
+	debnDatagramBatch pBatch;
+	decTimer pTimer;
+	double pTime;
+	double pNextResend;
+	bool pExit;
+	
+	int pEPoll;
+	int pWakeEvent;
+	
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/** Create I/O thread. */
+	debnIOThread(deNetworkBasic &netBasic, float resendInterval);
+	
+	/** Clean up I/O thread. Stops the thread if running. */
+	~debnIOThread() override;
+	/*@}*/
+	
+	
+	
+	/** \name Management */
+	/*@{*/
+	/** Start thread. */
+	void StartThread();
+	
+	/** Stop thread and wait for it to exit. */
+	void StopThread();
+	
+	/**
+	 * Add bound socket.
+	 * \returns Identifier of socket used in received datagrams.
+	 */
+	int AddSocket(debnSocket &bnSocket);
+	
+	/**
+	 * Remove socket.
+	 * 
+	 * Waits until the thread stopped using the socket. Datagrams of the socket still
+	 * waiting to be processed are dropped.
+	 */
+	void RemoveSocket(int socket);
+	
+	/** Socket with identifier or nullptr if removed. */
+	debnSocket *GetSocketWith(int socket) const;
+	
+	/** Add connected peer. */
+	debnIOPeer::Ref AddPeer(int socket, const debnAddress &address, int windowSize);
+	
+	/** Remove peer. Reliable datagrams tracked for the peer are dropped. */
+	void RemovePeer(debnIOPeer &peer);
+	
+	/** Resend reliable datagram until acknowledged. */
+	void TrackReliable(debnIOPeer &peer, int number, const deNetworkMessage &datagram);
+	
+	/**
+	 * Pop next received datagram.
+	 * \returns true if a datagram has been popped or false if none are waiting.
+	 */
+	bool NextReceived(sReceived &received);
+	
+	
+	
+	/** Run function of the thread. */
+	void Run() override;
+	/*@}*/
+	
+	
+	
+private:
+	void pCleanUp();
+	void pPushCommand(eCommands type, int socket, debnSocket *bnSocket, debnIOPeer *peer,
+		int number, deNetworkMessage::Ref &&datagram, deSemaphore *processed);
+	debnIOPeer *pGetPeer(int socket, const debnAddress &address) const;
+	void pWake();
+	void pProcessCommands();
+	void pWaitReceive();
+	void pReceive(int socket);
+	bool pProcessDatagram(const sSocket &sock, const debnAddress &address, const deNetworkMessage &datagram);
+	void pResendDue();
+	void pUpdateTime();
+};
+
+#endif
@@ -0,0 +1,282 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "debnLatencyBenchmark.h"
+#include "debnAddress.h"
+#include "debnServer.h"
+#include "debnSocket.h"
+#include "debnTestConnectionScripting.h"
+#include "debnTestServerScripting.h"
+#include "deNetworkBasic.h"
+
+#include <dragengine/deEngine.h>
+#include <dragengine/common/collection/decTList.h>
+#include <dragengine/common/exceptions.h>
+#include <dragengine/common/math/decMath.h>
+#include <dragengine/common/string/decString.h>
+#include <dragengine/common/string/unicode/decUnicodeString.h>
+#include <dragengine/common/utils/decTimer.h>
+#include <dragengine/resources/network/deNetworkMessage.h>
+#include <dragengine/resources/network/deServer.h>
+#include <dragengine/resources/network/deServerManager.h>
+#include <dragengine/threading/deThread.h>
+
+
+// Definitions
+////////////////
+
+#define BENCHMARK_PAYLOAD_SIZE 32
+#define BENCHMARK_SEND_INTERVAL 0.002f
+#define BENCHMARK_ACK_TIMEOUT 1.0f
+#define BENCHMARK_CONNECT_RESEND 0.1f
+#define BENCHMARK_CONNECT_TIMEOUT 2.0f
+
+
+
+// Client thread
+//////////////////
+
+namespace{
+
+class cClient : public deThread{
+public:
+	debnSocket &socket;
+	const debnAddress server;
+	const int messageCount;
+	decTList<float> roundTrips;
+	int lost;
+	bool connected;
+	std::atomic<bool> finished;
+	
+	cClient(debnSocket &psocket, const debnAddress &pserver, int pmessageCount) :
+	socket(psocket), server(pserver), messageCount(pmessageCount), lost(0),
+	connected(false), finished(false){
+		roundTrips.EnlargeCapacity(pmessageCount);
+	}
+	
+	void Run() override{
+		const deNetworkMessage::Ref datagram(deNetworkMessage::Ref::New());
+		
+		connected = pConnect(datagram);
+		if(connected){
+			pSendMessages(datagram);
+		}
+		
+		finished = true;
+	}
+	
+private:
+	// connection request as send by debnConnection::ConnectTo
+	bool pConnect(deNetworkMessage &datagram){
+		const uint8_t request[5] = {(uint8_t)eccConnectionRequest, 1, 0,
+			(uint8_t)epDENetworkProtocol, (uint8_t)(epDENetworkProtocol >> 8)};
+		debnAddress address;
+		decTimer timer;
+		float elapsed = 0.0f, resend = 0.0f;
+		
+		socket.SendDatagramDirect(request, sizeof(request), server);
+		
+		while(elapsed < BENCHMARK_CONNECT_TIMEOUT){
+			if(socket.ReceiveDatagram(datagram, address)){
+				const uint8_t * const data = datagram.GetBuffer();
+				if(datagram.GetDataLength() >= 2 && data[0] == eccConnectionAck){
+					return data[1] == ecaAccepted;
+				}
+				continue;
+			}
+			
+			std::this_thread::yield();
+			
+			const float step = timer.GetElapsedTime();
+			elapsed += step;
+			resend += step;
+			if(resend >= BENCHMARK_CONNECT_RESEND){
+				socket.SendDatagramDirect(request, sizeof(request), server);
+				resend = 0.0f;
+			}
+		}
+		
+		return false;
+	}
+	
+	void pSendMessages(deNetworkMessage &datagram){
+		debnAddress address;
+		decTimer timerTotal, timer;
+		int i;
+		
+		uint8_t message[3 + BENCHMARK_PAYLOAD_SIZE];
+		memset(message, 0, sizeof(message));
+		message[0] = (uint8_t)eccReliableMessage;
+		
+		for(i=0; i<messageCount; i++){
+			// send at a steady rate like a game does
+			while(timerTotal.PeekElapsedTime() < BENCHMARK_SEND_INTERVAL * (float)i){
+				std::this_thread::yield();
+			}
+			
+			const int number = i % 65535;
+			message[1] = (uint8_t)number;
+			message[2] = (uint8_t)(number >> 8);
+			
+			timer.Reset();
+			socket.SendDatagramDirect(message, sizeof(message), server);
+			
+			bool acknowledged = false;
+			while(!acknowledged && timer.PeekElapsedTime() < BENCHMARK_ACK_TIMEOUT){
+				if(!socket.ReceiveDatagram(datagram, address)){
+					std::this_thread::yield();
+					continue;
+				}
+				
+				const uint8_t * const data = datagram.GetBuffer();
+				acknowledged = datagram.GetDataLength() == 4 && data[0] == eccReliableAck
+					&& ((int)data[1] | ((int)data[2] << 8)) == number;
+			}
+			
+			if(acknowledged){
+				roundTrips.Add(timer.PeekElapsedTime());
+				
+			}else{
+				lost++;
+			}
+		}
+	}
+};
+
+}
+
+
+
+// Class debnLatencyBenchmark
+///////////////////////////////
+
+// Constructor, destructor
+////////////////////////////
+
+debnLatencyBenchmark::debnLatencyBenchmark(deNetworkBasic &module) :
+pModule(module){
+}
+
+debnLatencyBenchmark::~debnLatencyBenchmark(){
+}
+
+
+
+// Management
+///////////////
+
+void debnLatencyBenchmark::Run(int messageCount, int stall, decUnicodeString &answer){
+	DEASSERT_TRUE(messageCount > 0)
+	DEASSERT_TRUE(stall >= 0)
+	
+	const char * const modeNames[2] = {"frame update", "I/O thread"};
+	decString text;
+	text.Format("Latency benchmark: %d reliable messages every %.0f ms, main thread stalled %d ms per frame\n",
+		messageCount, BENCHMARK_SEND_INTERVAL * 1000.0f, stall);
+	
+	const bool useIOThread = pModule.GetIOThread() != nullptr;
+	int i, mode;
+	
+	for(mode=0; mode<2; mode++){
+		pModule.SetUseIOThread(mode == 1);
+		
+		// server accepting the connection like a game does. connections and datagrams
+		// are processed by deNetworkBasic::ProcessNetwork()
+		debnTestServerScripting * const serverPeer = new debnTestServerScripting(false);
+		deServer::Ref server(pModule.GetGameEngine()->GetServerManager()->CreateServer());
+		server->SetPeerScripting(serverPeer);
+		DEASSERT_TRUE(server->ListenOn("127.0.0.1:0"))
+		
+		const debnAddress &serverAddress = ((debnServer*)server->GetPeerNetwork())->GetSocket()->GetAddress();
+		
+		// client socket bound to loopback using any free port. the socket is used only by
+		// the client thread and is neither received by the module nor the I/O thread
+		debnSocket::Ref client(debnSocket::Ref::New(pModule));
+		pModule.UnregisterSocket(client);
+		client->GetAddress().SetIPv4Loopback();
+		client->GetAddress().SetPort(0);
+		client->Bind();
+		client->SetIOThread(nullptr);
+		
+		// run client until all messages are acknowledged. each frame the main thread is
+		// first busy then processes the network
+		cClient clientThread(client, serverAddress, messageCount);
+		clientThread.Start();
+		
+		while(!clientThread.finished){
+			std::this_thread::sleep_for(std::chrono::milliseconds(stall));
+			pModule.ProcessNetwork();
+		}
+		
+		clientThread.WaitForExit();
+		
+		int processed = 0;
+		if(serverPeer->GetConnections().GetCount() == 1){
+			const deConnection * const connection = serverPeer->GetConnections().GetAt(0);
+			processed = ((const debnTestConnectionScripting*)connection->GetPeerScripting())->GetReceived().GetCount();
+		}
+		
+		// stopping the server disconnects the accepted connection. releasing the sockets
+		// allows changing the I/O thread use for the next mode
+		client = nullptr;
+		server->StopListening();
+		server = nullptr;
+		
+		// evaluate
+		decTList<float> &roundTrips = clientThread.roundTrips;
+		const int count = roundTrips.GetCount();
+		roundTrips.SortAscending();
+		
+		float sum = 0.0f;
+		for(i=0; i<count; i++){
+			sum += roundTrips[i];
+		}
+		
+		decString line;
+		if(!clientThread.connected){
+			line.Format("- %s: connection failed\n", modeNames[mode]);
+			
+		}else if(count > 0){
+			line.Format("- %s: round trip average %.3f ms, median %.3f ms, max %.3f ms"
+				" (%d acknowledged, %d lost, %d processed by main thread)\n",
+				modeNames[mode], sum * 1000.0f / (float)count, roundTrips[count / 2] * 1000.0f,
+				roundTrips[count - 1] * 1000.0f, count, clientThread.lost, processed);
+			
+		}else{
+			line.Format("- %s: no message acknowledged (%d lost)\n", modeNames[mode], clientThread.lost);
+		}
+		text += line;
+	}
+	
+	pModule.SetUseIOThread(useIOThread);
+	
+	answer.SetFromUTF8(text);
+}
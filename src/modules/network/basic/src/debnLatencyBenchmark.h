@@ -0,0 +1,75 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DEBNLATENCYBENCHMARK_H_
+#define _DEBNLATENCYBENCHMARK_H_
+
+class deNetworkBasic;
+class decUnicodeString;
+
+
+/**
+ * Loopback reliable latency benchmark.
+ * 
+ * A client thread connects to a server listening on the loopback interface and sends
+ * reliable messages measuring the time until the acknowledgement arrives. The main thread
+ * simulates a busy game frame by sleeping before calling deNetworkBasic::ProcessNetwork().
+ * Compares receiving and acknowledging during the frame update against using a network
+ * I/O thread. Requires that no sockets exist. Run using the module command
+ * "latencyBenchmark".
+ */
+class debnLatencyBenchmark{
+private:
+	deNetworkBasic &pModule;
+	
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/** Create benchmark. */
+	explicit debnLatencyBenchmark(deNetworkBasic &module);
+	
+	/** Clean up benchmark. */
+	~debnLatencyBenchmark();
+	/*@}*/
+	
+	
+	
+	/** \name Management */
+	/*@{*/
+	/** Module. */
+	inline deNetworkBasic &GetModule() const{ return pModule; }
+	
+	/**
+	 * Run benchmark.
+	 * \param[in] messageCount Count of reliable messages the client sends.
+	 * \param[in] stall Milliseconds the main thread is stalled each frame.
+	 * \param[out] answer Results.
+	 */
+	void Run(int messageCount, int stall, decUnicodeString &answer);
+	/*@}*/
+};
+
+#endif
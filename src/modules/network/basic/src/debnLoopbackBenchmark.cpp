@@ -0,0 +1,206 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "debnLoopbackBenchmark.h"
+#include "debnAddress.h"
+#include "debnDatagramBatch.h"
+#include "debnSocket.h"
+#include "deNetworkBasic.h"
+
+#include <dragengine/common/collection/decTDictionary.h>
+#include <dragengine/common/collection/decTList.h>
+#include <dragengine/common/exceptions.h>
+#include <dragengine/common/math/decMath.h>
+#include <dragengine/common/string/decString.h>
+#include <dragengine/common/string/unicode/decUnicodeString.h>
+#include <dragengine/common/utils/decTimer.h>
+#include <dragengine/resources/network/deNetworkMessage.h>
+
+
+// Definitions
+////////////////
+
+#define BENCHMARK_DATAGRAM_SIZE 64
+#define BENCHMARK_RECEIVE_TIMEOUT 0.1f
+#define BENCHMARK_WAVE_SIZE 128
+
+
+
+// Class debnLoopbackBenchmark
+////////////////////////////////
+
+// Constructor, destructor
+////////////////////////////
+
+debnLoopbackBenchmark::debnLoopbackBenchmark(deNetworkBasic &module) :
+pModule(module){
+}
+
+debnLoopbackBenchmark::~debnLoopbackBenchmark(){
+}
+
+
+
+// Management
+///////////////
+
+void debnLoopbackBenchmark::Run(int clientCount, int frameCount, decUnicodeString &answer){
+	DEASSERT_TRUE(clientCount > 0)
+	DEASSERT_TRUE(frameCount > 0)
+	
+	// create server and client sockets bound to loopback using any free port
+	const debnSocket::Ref server(debnSocket::Ref::New(pModule));
+	server->GetAddress().SetIPv4Loopback();
+	server->GetAddress().SetPort(0);
+	server->Bind();
+	
+	decTList<debnSocket::Ref> clients;
+	decTList<debnAddress> clientAddresses;
+	decTDictionary<debnAddress, int> clientIndices;
+	int i, j, k;
+	
+	for(i=0; i<clientCount; i++){
+		const debnSocket::Ref client(debnSocket::Ref::New(pModule));
+		client->GetAddress().SetIPv4Loopback();
+		client->GetAddress().SetPort(0);
+		client->Bind();
+		
+		clients.Add(client);
+		clientAddresses.Add(client->GetAddress());
+		clientIndices.SetAt(client->GetAddress(), i);
+	}
+	
+	// run frames once one datagram at a time then batched
+	const char * const modeNames[2] = {"per datagram", "batched"};
+	float elapsed[2] = {0.0f, 0.0f};
+	int received[2] = {0, 0};
+	int mismatches[2] = {0, 0};
+	
+	const deNetworkMessage::Ref datagram(deNetworkMessage::Ref::New());
+	datagram->SetDataLength(BENCHMARK_DATAGRAM_SIZE);
+	memset(datagram->GetBuffer(), 0, BENCHMARK_DATAGRAM_SIZE);
+	
+	const deNetworkMessage::Ref clientDatagram(deNetworkMessage::Ref::New());
+	debnDatagramBatch batch;
+	debnAddress address;
+	decTimer timer;
+	
+	for(i=0; i<2; i++){
+		for(j=0; j<frameCount; j++){
+			// clients send in waves to not overflow the receive buffer of the server socket
+			int first;
+			for(first=0; first<clientCount; first+=BENCHMARK_WAVE_SIZE){
+				const int last = decMath::min(first + BENCHMARK_WAVE_SIZE, clientCount);
+				
+				// clients send datagram to server
+				for(k=first; k<last; k++){
+					memcpy(datagram->GetBuffer(), &k, sizeof(k));
+					clients[k]->SendDatagram(datagram, server->GetAddress());
+					clients[k]->FlushSendQueue();
+				}
+				
+				// server receives datagrams, finds the client and replies
+				timer.Reset();
+				
+				int waveReceived = 0;
+				
+				while(waveReceived < last - first && timer.PeekElapsedTime() < BENCHMARK_RECEIVE_TIMEOUT){
+					if(i == 0){
+						while(server->ReceiveDatagram(clientDatagram, address)){
+							int index = -1, l;
+							for(l=0; l<clientCount; l++){
+								if(clientAddresses[l] == address){
+									index = l;
+									break;
+								}
+							}
+							
+							if(index == -1 || memcmp(clientDatagram->GetBuffer(), &index, sizeof(index)) != 0){
+								mismatches[i]++;
+							}
+							
+							server->SendDatagram(clientDatagram, address);
+							server->FlushSendQueue();
+							waveReceived++;
+						}
+						
+					}else{
+						while(true){
+							const int count = server->ReceiveDatagrams(batch);
+							int l;
+							
+							for(l=0; l<count; l++){
+								const int index = clientIndices.GetAtOrDefault(batch.GetAddressAt(l), -1);
+								
+								if(index == -1 || memcmp(batch.GetDatagramAt(l).GetBuffer(), &index, sizeof(index)) != 0){
+									mismatches[i]++;
+								}
+								
+								server->SendDatagram(batch.GetDatagramAt(l), batch.GetAddressAt(l));
+								waveReceived++;
+							}
+							
+							if(count < debnDatagramBatch::Capacity){
+								break;
+							}
+						}
+						
+						server->FlushSendQueue();
+					}
+				}
+				
+				elapsed[i] += timer.GetElapsedTime();
+				received[i] += waveReceived;
+				
+				// clients drain replies
+				for(k=first; k<last; k++){
+					while(clients[k]->ReceiveDatagram(clientDatagram, address));
+				}
+			}
+		}
+	}
+	
+	decString text;
+	text.Format("Loopback benchmark: %d clients, %d frames, %d byte datagrams\n",
+		clientCount, frameCount, BENCHMARK_DATAGRAM_SIZE);
+	
+	const int expected = clientCount * frameCount;
+	for(i=0; i<2; i++){
+		decString line;
+		line.Format("- %s: %.2f us per datagram (%.1f ms total, %d of %d received)\n",
+			modeNames[i], elapsed[i] * 1e6f / (float)decMath::max(received[i], 1),
+			elapsed[i] * 1e3f, received[i], expected);
+		text += line;
+		
+		if(mismatches[i] > 0){
+			line.Format("WARNING: %d datagrams matched wrong client\n", mismatches[i]);
+			text += line;
+		}
+	}
+	
+	answer.SetFromUTF8(text);
+}
@@ -0,0 +1,74 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DEBNLOOPBACKBENCHMARK_H_
+#define _DEBNLOOPBACKBENCHMARK_H_
+
+class deNetworkBasic;
+class decUnicodeString;
+
+
+/**
+ * Loopback datagram benchmark.
+ * 
+ * Simulates a server socket with multiple clients on the loopback interface. Each frame
+ * every client sends a datagram to the server. The server receives the datagrams, finds
+ * the client each datagram belongs to and sends a reply. Compares receiving, finding and
+ * sending one datagram at a time against batched receiving and sending with hashed
+ * lookup. Run using the module command "loopbackBenchmark".
+ */
+class debnLoopbackBenchmark{
+private:
+	deNetworkBasic &pModule;
+	
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/** Create benchmark. */
+	explicit debnLoopbackBenchmark(deNetworkBasic &module);
+	
+	/** Clean up benchmark. */
+	~debnLoopbackBenchmark();
+	/*@}*/
+	
+	
+	
+	/** \name Management */
+	/*@{*/
+	/** Module. */
+	inline deNetworkBasic &GetModule() const{ return pModule; }
+	
+	/**
+	 * Run benchmark.
+	 * \param[in] clientCount Count of simulated clients.
+	 * \param[in] frameCount Count of frames to simulate.
+	 * \param[out] answer Results.
+	 */
+	void Run(int clientCount, int frameCount, decUnicodeString &answer);
+	/*@}*/
+};
+
+#endif
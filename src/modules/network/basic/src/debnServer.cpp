@@ -79,7 +79,7 @@ debnServer::~debnServer(){
 // Management
 ///////////////
 
-void debnServer::ProcessConnectionRequest(debnAddress &address, decBaseFileReader &reader){
+void debnServer::ProcessConnectionRequest(const debnAddress &address, decBaseFileReader &reader){
 	// reject connection if not listening or there is no script module peer
 	deBaseScriptingServer * const scrSvr = pServer->GetPeerScripting();
 	if(!pListening || !scrSvr){
@@ -157,6 +157,7 @@ bool debnServer::ListenOn(const char *address){
 		
 		pSocket->GetAddress().SetFromString(useAddress);
 		pSocket->Bind();
+		pSocket->SetServer(this);
 		
 		pListening = true;
 		
@@ -183,7 +184,11 @@ void debnServer::StopListening(){
 		
 		pNetBasic->UnregisterServer(this);
 	}
-	pSocket = nullptr;
+	
+	if(pSocket){
+		pSocket->SetServer(nullptr);
+		pSocket = nullptr;
+	}
 	
 	pListening = false;
 }
@@ -71,7 +71,7 @@ public:
 	inline const debnSocket::Ref &GetSocket() const{ return pSocket; }
 	
 	/** \brief Process connection request. */
-	void ProcessConnectionRequest(debnAddress &address, decBaseFileReader &reader);
+	void ProcessConnectionRequest(const debnAddress &address, decBaseFileReader &reader);
 	
 	/**
 	 * \brief Start listening on address for incoming connections.
@@ -33,10 +33,13 @@
 #include "debnSocket.h"
 #include "debnServer.h"
 #include "debnAddress.h"
+#include "debnDatagramBatch.h"
+#include "debnIOThread.h"
 #include "deNetworkBasic.h"
 
 #include <dragengine/resources/network/deNetworkMessage.h>
 #include <dragengine/common/exceptions.h>
+#include <dragengine/common/math/decMath.h>
 
 #ifdef OS_UNIX
 	#include <errno.h>
@@ -64,6 +67,11 @@
 typedef int socklen_t;
 #endif
 
+#if defined OS_UNIX && !defined OS_MACOS && !defined OS_BEOS && !defined OS_WEBWASM
+	#define DEBN_USE_MMSG 1
+	#include <sys/uio.h>
+#endif
+
 
 
 // Class debnSocket
@@ -75,12 +83,30 @@ typedef int socklen_t;
 	#define DE_NULL_SOCKET -1
 #endif
 
+// Fill socket address for sending datagrams to address from socket of type
+static socklen_t debnSocketAddress(debnAddress::eAddressType type,
+const debnAddress &address, sockaddr_storage &sa){
+	memset(&sa, 0, sizeof(sa));
+	
+	if(type == debnAddress::eatIPv6){
+		address.SetSocketIPv6((sockaddr_in6&)sa);
+		return sizeof(sockaddr_in6);
+		
+	}else{
+		address.SetSocketIPv4((sockaddr_in&)sa);
+		return sizeof(sockaddr_in);
+	}
+}
+
 // Constructor, destructor
 ////////////////////////////
 
 debnSocket::debnSocket(deNetworkBasic &netBasic) :
 pNetBasic(netBasic),
 pSocket(DE_NULL_SOCKET),
+pServer(nullptr),
+pIOThread(nullptr),
+pIOSocket(0),
 pPreviousSocket(nullptr),
 pNextSocket(nullptr),
 pIsRegistered(false)
@@ -154,6 +180,8 @@ void debnSocket::Bind(){
 	}
 	
 	pNetBasic.LogInfoFormat("Bound socket to '%s'", pAddress.ToString().GetString());
+	
+	SetIOThread(pNetBasic.GetIOThread());
 }
 
 bool debnSocket::ReceiveDatagram(deNetworkMessage &stream, debnAddress &address){
@@ -225,36 +253,193 @@ bool debnSocket::ReceiveDatagram(deNetworkMessage &stream, debnAddress &address)
 	return dataLen > 0;
 }
 
-void debnSocket::SendDatagram(const deNetworkMessage &stream, const debnAddress &address){
-	DEASSERT_TRUE(stream.GetDataLength() < 65500)
+int debnSocket::ReceiveDatagrams(debnDatagramBatch &batch){
+#ifdef DEBN_USE_MMSG
+	mmsghdr headers[debnDatagramBatch::Capacity];
+	iovec vectors[debnDatagramBatch::Capacity];
+	sockaddr_storage addresses[debnDatagramBatch::Capacity];
+	int i;
 	
-	if(pAddress.GetType() == debnAddress::eatIPv6){
-		sockaddr_in6 sa;
-		memset(&sa, 0, sizeof(sa));
-		address.SetSocketIPv6(sa);
+	memset(headers, 0, sizeof(headers));
+	
+	for(i=0; i<debnDatagramBatch::Capacity; i++){
+		deNetworkMessage &datagram = batch.GetDatagramAt(i);
+		datagram.SetDataLength(debnDatagramBatch::BufferSize);
 		
-		#ifdef OS_W32
-		sendto(pSocket, reinterpret_cast<const char*>(stream.GetBuffer()), stream.GetDataLength(), 0, (sockaddr*)&sa, sizeof(sa));
-		#else
-		sendto(pSocket, stream.GetBuffer(), stream.GetDataLength(), 0, (sockaddr*)&sa, sizeof(sa));
-		#endif
+		vectors[i].iov_base = datagram.GetBuffer();
+		vectors[i].iov_len = debnDatagramBatch::BufferSize;
 		
-	}else{
-		sockaddr_in sa;
-		memset(&sa, 0, sizeof(sa));
-		address.SetSocketIPv4(sa);
+		headers[i].msg_hdr.msg_name = addresses + i;
+		headers[i].msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+		headers[i].msg_hdr.msg_iov = vectors + i;
+		headers[i].msg_hdr.msg_iovlen = 1;
+	}
+	
+	const int count = recvmmsg(pSocket, headers, debnDatagramBatch::Capacity, MSG_DONTWAIT, nullptr);
+	if(count < 1){
+		batch.SetCount(0);
+		return 0;
+	}
+	
+	for(i=0; i<count; i++){
+		batch.GetDatagramAt(i).SetDataLength((int)headers[i].msg_len);
 		
-		#ifdef OS_W32
-		sendto(pSocket, reinterpret_cast<const char*>(stream.GetBuffer()), stream.GetDataLength(), 0, (sockaddr*)&sa, sizeof(sa));
-		#else
-		sendto(pSocket, stream.GetBuffer(), stream.GetDataLength(), 0, (sockaddr*)&sa, sizeof(sa));
-		#endif
+		if(pAddress.GetType() == debnAddress::eatIPv6){
+			batch.GetAddressAt(i).SetIPv6FromSocket((const sockaddr_in6 &)addresses[i]);
+			
+		}else{
+			batch.GetAddressAt(i).SetIPv4FromSocket((const sockaddr_in &)addresses[i]);
+		}
+	}
+	
+	batch.SetCount(count);
+	return count;
+	
+#else
+	int count = 0;
+	while(count < debnDatagramBatch::Capacity
+	&& ReceiveDatagram(batch.GetDatagramAt(count), batch.GetAddressAt(count))){
+		count++;
+	}
+	
+	batch.SetCount(count);
+	return count;
+#endif
+}
+
+void debnSocket::SendDatagram(const deNetworkMessage &stream, const debnAddress &address){
+	const int length = stream.GetDataLength();
+	DEASSERT_TRUE(length < 65500)
+	
+	const int offset = pSendData.GetCount();
+	if(offset + length > pSendData.GetCapacity()){
+		pSendData.EnlargeCapacity((offset + length) * 3 / 2);
 	}
+	pSendData.SetCountDiscard(offset + length);
+	memcpy(pSendData.GetArrayPointer() + offset, stream.GetBuffer(), length);
+	
+	pSendQueue.Add({offset, length, address});
 	
 // 	pNetBasic.LogInfoFormat( "Send datagram with length %d to '%s' command code %d",
 // 		stream.GetDataLength(), address.ToString().GetString(), stream.GetBuffer()[ 0 ] );
 }
 
+void debnSocket::SendDatagramDirect(const void *data, int length, const debnAddress &address) const{
+	DEASSERT_TRUE(length < 65500)
+	
+	if(pSocket == DE_NULL_SOCKET){
+		return;
+	}
+	
+	sockaddr_storage sa;
+	const socklen_t slen = debnSocketAddress(pAddress.GetType(), address, sa);
+	
+	#ifdef OS_W32
+	sendto(pSocket, reinterpret_cast<const char*>(data), length, 0, (sockaddr*)&sa, slen);
+	#else
+	sendto(pSocket, data, length, 0, (sockaddr*)&sa, slen);
+	#endif
+}
+
+void debnSocket::FlushSendQueue(){
+	const int count = pSendQueue.GetCount();
+	if(count == 0){
+		return;
+	}
+	
+	const debnAddress::eAddressType type = pAddress.GetType();
+	uint8_t * const data = pSendData.GetArrayPointer();
+	
+	if(pSocket != DE_NULL_SOCKET){
+#ifdef DEBN_USE_MMSG
+		mmsghdr headers[SendBatchSize];
+		iovec vectors[SendBatchSize];
+		sockaddr_storage addresses[SendBatchSize];
+		int i, first = 0;
+		
+		memset(headers, 0, sizeof(headers));
+		
+		while(first < count){
+			const int batchCount = decMath::min(count - first, (int)SendBatchSize);
+			
+			for(i=0; i<batchCount; i++){
+				const sQueuedDatagram &datagram = pSendQueue[first + i];
+				
+				vectors[i].iov_base = data + datagram.offset;
+				vectors[i].iov_len = datagram.length;
+				
+				headers[i].msg_hdr.msg_name = addresses + i;
+				headers[i].msg_hdr.msg_namelen = debnSocketAddress(type, datagram.address, addresses[i]);
+				headers[i].msg_hdr.msg_iov = vectors + i;
+				headers[i].msg_hdr.msg_iovlen = 1;
+			}
+			
+			// datagrams failing to send are dropped like sendto() failures are
+			const int sent = sendmmsg(pSocket, headers, batchCount, 0);
+			first += sent > 0 ? sent : 1;
+		}
+		
+#else
+		int i;
+		for(i=0; i<count; i++){
+			const sQueuedDatagram &datagram = pSendQueue[i];
+			sockaddr_storage sa;
+			const socklen_t slen = debnSocketAddress(type, datagram.address, sa);
+			
+			#ifdef OS_W32
+			sendto(pSocket, reinterpret_cast<const char*>(data + datagram.offset),
+				datagram.length, 0, (sockaddr*)&sa, slen);
+			#else
+			sendto(pSocket, data + datagram.offset, datagram.length, 0, (sockaddr*)&sa, slen);
+			#endif
+		}
+#endif
+	}
+	
+	pSendQueue.SetCountDiscard(0);
+	pSendData.SetCountDiscard(0);
+}
+
+
+
+debnConnection *debnSocket::GetConnectionWith(const debnAddress &address) const{
+	return pConnections.GetAtOrDefault(address, nullptr);
+}
+
+void debnSocket::AddConnection(const debnAddress &address, debnConnection *connection){
+	DEASSERT_NOTNULL(connection)
+	
+	pConnections.SetAt(address, connection);
+}
+
+void debnSocket::RemoveConnection(const debnAddress &address, debnConnection *connection){
+	if(GetConnectionWith(address) == connection){
+		pConnections.Remove(address);
+	}
+}
+
+void debnSocket::SetServer(debnServer *server){
+	pServer = server;
+}
+
+void debnSocket::SetIOThread(debnIOThread *thread){
+	if(thread == pIOThread){
+		return;
+	}
+	
+	if(pIOThread){
+		pIOThread->RemoveSocket(pIOSocket);
+		pIOThread = nullptr;
+		pIOSocket = 0;
+	}
+	
+	if(thread){
+		DEASSERT_TRUE(pSocket != DE_NULL_SOCKET)
+		pIOSocket = thread->AddSocket(*this);
+		pIOThread = thread;
+	}
+}
+
 void debnSocket::ThrowSocketError(const char *message){
 	decString s;
 	
@@ -521,7 +706,12 @@ void debnSocket::SetIsRegistered(bool isRegistered){
 //////////////////////
 
 void debnSocket::pCleanUp(){
-	pNetBasic.UnregisterSocket(this);
+	if(pIsRegistered){
+		pNetBasic.UnregisterSocket(this);
+	}
+	
+	SetIOThread(nullptr);
+	FlushSendQueue();
 	
 	if(pSocket != DE_NULL_SOCKET){
 		#ifdef OS_W32
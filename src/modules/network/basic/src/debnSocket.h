@@ -36,18 +36,46 @@
 #endif
 
 #include <dragengine/deObject.h>
+#include <dragengine/common/collection/decTDictionary.h>
+#include <dragengine/common/collection/decTList.h>
 #include <dragengine/common/string/decStringList.h>
 
 class deNetworkBasic;
 class deNetworkMessage;
+class debnConnection;
+class debnDatagramBatch;
+class debnIOThread;
+class debnServer;
 
 
 
 /**
  * Socket class.
+ * 
+ * Datagrams are received in batches and sent datagrams are queued until the send queue
+ * is flushed. On Linux recvmmsg and sendmmsg are used to transfer a batch of datagrams
+ * with a single system call. Other platforms use one call per datagram.
+ * 
+ * Connections using the socket are registered with the socket by their remote address
+ * to find the connection a received datagram belongs to without visiting all connections.
+ * 
+ * If the module runs a network I/O thread bound sockets are added to it. The I/O thread
+ * then receives datagrams instead of the main thread.
  */
 class debnSocket : public deObject{
+public:
+	/** \brief Maximum number of datagrams send in one call. */
+	static const int SendBatchSize = 64;
+	
+	
+	
 private:
+	struct sQueuedDatagram{
+		int offset;
+		int length;
+		debnAddress address;
+	};
+	
 	deNetworkBasic &pNetBasic;
 	debnAddress pAddress;
 	
@@ -58,6 +86,15 @@ private:
 		int pSocket;
 	#endif
 
+	decTDictionary<debnAddress, debnConnection*> pConnections;
+	debnServer *pServer;
+	
+	debnIOThread *pIOThread;
+	int pIOSocket;
+	
+	decTList<uint8_t> pSendData;
+	decTList<sQueuedDatagram> pSendQueue;
+
 	debnSocket *pPreviousSocket;
 	debnSocket *pNextSocket;
 	bool pIsRegistered;
@@ -87,20 +124,88 @@ public:
 	inline debnAddress &GetAddress(){ return pAddress; }
 	inline const debnAddress &GetAddress() const{ return pAddress; }
 	
-	/** Bind socket to stored address. */
+	/** Bind socket to stored address. Adds socket to the module I/O thread if present. */
 	void Bind();
 	
+	/** Operating system socket handle. */
+	#ifdef OS_W32
+	inline SOCKET GetHandle() const{ return pSocket; }
+	#else
+	inline int GetHandle() const{ return pSocket; }
+	#endif
+	
 	/**
 	 * Receive datagram from socket.
 	 * \returns true if a message has been receives or false otherwise.
 	 */
 	bool ReceiveDatagram(deNetworkMessage &stream, debnAddress &address);
 	
+	/**
+	 * Receive batch of datagrams from socket.
+	 * 
+	 * Receives up to debnDatagramBatch::Capacity datagrams waiting on the socket. Received
+	 * datagrams can have 0 length. These have to be skipped.
+	 * 
+	 * \returns Count of received datagrams. If less than debnDatagramBatch::Capacity no
+	 *          more datagrams are waiting.
+	 */
+	int ReceiveDatagrams(debnDatagramBatch &batch);
+	
 	/**
 	 * Send datagram.
+	 * 
+	 * Datagram is added to the send queue. Queued datagrams are send the next time
+	 * FlushSendQueue() is called.
 	 */
 	void SendDatagram(const deNetworkMessage &stream, const debnAddress &address);
 	
+	/**
+	 * Send datagram immediately without using the send queue.
+	 * 
+	 * Thread safe. Used by the network I/O thread.
+	 */
+	void SendDatagramDirect(const void *data, int length, const debnAddress &address) const;
+	
+	/** Count of queued datagrams. */
+	inline int GetSendQueueCount() const{ return pSendQueue.GetCount(); }
+	
+	/** Send all queued datagrams. */
+	void FlushSendQueue();
+	
+	
+	
+	/** Connection with remote address or nullptr. */
+	debnConnection *GetConnectionWith(const debnAddress &address) const;
+	
+	/** Register connection with remote address. */
+	void AddConnection(const debnAddress &address, debnConnection *connection);
+	
+	/** Unregister connection with remote address if registered. */
+	void RemoveConnection(const debnAddress &address, debnConnection *connection);
+	
+	/** Server listening on socket or nullptr. */
+	inline debnServer *GetServer() const{ return pServer; }
+	
+	/** Set server listening on socket or nullptr. */
+	void SetServer(debnServer *server);
+	
+	/** I/O thread receiving datagrams or nullptr. */
+	inline debnIOThread *GetIOThread() const{ return pIOThread; }
+	
+	/** Identifier of socket assigned by I/O thread. */
+	inline int GetIOSocket() const{ return pIOSocket; }
+	
+	/**
+	 * Set I/O thread receiving datagrams or nullptr.
+	 * 
+	 * Socket has to be bound. Removing the socket from the previous I/O thread waits
+	 * until the thread stopped using the socket.
+	 */
+	void SetIOThread(debnIOThread *thread);
+	
+	
+	
+	
 	/** Throw socket error. */
 	static void ThrowSocketError(const char *message);
 	
@@ -0,0 +1,113 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DEBNTLOCKFREEQUEUE_H_
+#define _DEBNTLOCKFREEQUEUE_H_
+
+#include <atomic>
+#include <utility>
+
+
+/**
+ * Unbounded lock-free single producer single consumer queue.
+ * 
+ * Exactly one thread pushes entries and exactly one other thread pops them. Entries are
+ * stored in a linked list of nodes. The producer only touches the tail node and the
+ * consumer only touches the head node which is always a dummy node. Publishing a node
+ * happens with a release store of the next pointer, consuming it with an acquire load.
+ * Nodes are allocated by the producer and freed by the consumer.
+ */
+template<class T> class debnTLockFreeQueue{
+private:
+	struct sNode{
+		std::atomic<sNode*> next;
+		T value;
+		
+		sNode() : next(nullptr){
+		}
+		
+		explicit sNode(T &&pvalue) : next(nullptr), value(std::move(pvalue)){
+		}
+	};
+	
+	sNode *pHead;
+	sNode *pTail;
+	
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/** Create queue. */
+	debnTLockFreeQueue() : pHead(new sNode), pTail(pHead){
+	}
+	
+	/** Clean up queue. Producer and consumer have to be finished. */
+	~debnTLockFreeQueue(){
+		while(pHead){
+			sNode * const next = pHead->next.load(std::memory_order_relaxed);
+			delete pHead;
+			pHead = next;
+		}
+	}
+	
+	debnTLockFreeQueue(const debnTLockFreeQueue&) = delete;
+	debnTLockFreeQueue &operator=(const debnTLockFreeQueue&) = delete;
+	/*@}*/
+	
+	
+	
+	/** \name Management */
+	/*@{*/
+	/** Push entry. Call only from the producer thread. */
+	void Push(T &&value){
+		sNode * const node = new sNode(std::move(value));
+		pTail->next.store(node, std::memory_order_release);
+		pTail = node;
+	}
+	
+	/**
+	 * Pop entry. Call only from the consumer thread.
+	 * \returns true if an entry has been popped or false if the queue is empty.
+	 */
+	bool Pop(T &value){
+		sNode * const next = pHead->next.load(std::memory_order_acquire);
+		if(!next){
+			return false;
+		}
+		
+		value = std::move(next->value);
+		delete pHead;
+		pHead = next;
+		return true;
+	}
+	
+	/** Queue is empty. Call only from the consumer thread. */
+	bool IsEmpty() const{
+		return pHead->next.load(std::memory_order_acquire) == nullptr;
+	}
+	/*@}*/
+};
+
+#endif
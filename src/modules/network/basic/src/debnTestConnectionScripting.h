@@ -0,0 +1,82 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DEBNTESTCONNECTIONSCRIPTING_H_
+#define _DEBNTESTCONNECTIONSCRIPTING_H_
+
+#include <dragengine/common/collection/decTList.h>
+#include <dragengine/resources/network/deNetworkMessage.h>
+#include <dragengine/systems/modules/scripting/deBaseScriptingConnection.h>
+
+class deConnection;
+
+
+/**
+ * Scripting peer used by module tests and benchmarks to observe a connection without a
+ * scripting module. Stores received reliable messages and optionally sends them back.
+ */
+class debnTestConnectionScripting : public deBaseScriptingConnection{
+private:
+	deConnection &pConnection;
+	const bool pEcho;
+	decTObjectList<deNetworkMessage> pReceived;
+	bool pClosed;
+	
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/**
+	 * Create peer.
+	 * \param[in] connection Connection owning the peer.
+	 * \param[in] echo Send received messages back to the remote side as reliable messages.
+	 */
+	debnTestConnectionScripting(deConnection &connection, bool echo);
+	
+	/** Clean up peer. */
+	~debnTestConnectionScripting() override;
+	/*@}*/
+	
+	
+	
+	/** \name Management */
+	/*@{*/
+	/** Received messages in the order they have been delivered. */
+	inline const decTObjectList<deNetworkMessage> &GetReceived() const{ return pReceived; }
+	
+	/** Connection has been closed. */
+	inline bool GetClosed() const{ return pClosed; }
+	/*@}*/
+	
+	
+	
+	/** \name Notifications */
+	/*@{*/
+	void ConnectionClosed() override;
+	void MessageReceived(deNetworkMessage *message) override;
+	/*@}*/
+};
+
+#endif
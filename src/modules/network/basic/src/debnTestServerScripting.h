@@ -0,0 +1,74 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DEBNTESTSERVERSCRIPTING_H_
+#define _DEBNTESTSERVERSCRIPTING_H_
+
+#include <dragengine/common/collection/decTList.h>
+#include <dragengine/resources/network/deConnection.h>
+#include <dragengine/systems/modules/scripting/deBaseScriptingServer.h>
+
+
+/**
+ * Scripting peer used by module tests and benchmarks to accept connections without a
+ * scripting module. Keeps accepted connections alive and assigns them a
+ * debnTestConnectionScripting peer.
+ */
+class debnTestServerScripting : public deBaseScriptingServer{
+private:
+	const bool pEcho;
+	decTObjectList<deConnection> pConnections;
+	
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/**
+	 * Create peer.
+	 * \param[in] echo Accepted connections send received messages back.
+	 */
+	explicit debnTestServerScripting(bool echo);
+	
+	/** Clean up peer. */
+	~debnTestServerScripting() override;
+	/*@}*/
+	
+	
+	
+	/** \name Management */
+	/*@{*/
+	/** Accepted connections. */
+	inline const decTObjectList<deConnection> &GetConnections() const{ return pConnections; }
+	/*@}*/
+	
+	
+	
+	/** \name Notifications */
+	/*@{*/
+	void ClientConnected(deConnection *connection) override;
+	/*@}*/
+};
+
+#endif
@@ -224,227 +224,96 @@ double debpDCollisionBox::FrustumMoveHitsVolume(debpDCollisionFrustum *frustum,
 }
 
 double debpDCollisionBox::PointMoveHitsVolume(const decDVector &point, const decDVector &displacement, decDVector *normal){
-	double lambda, hp, factor;
-	double px, py, pz;
-	double fpx, fpy, fpz;
-	double dx, dy, dz;
+	decDVector localPoint, localDisplacement;
+	
 	// transform values if required
 	if(pOriented){
-		decDVector transformedPoint = WorldToLocal(point);
-		decDVector transformedDisplacement = NormalWorldToLocal(displacement);
-		px = transformedPoint.x;
-		py = transformedPoint.y;
-		pz = transformedPoint.z;
-		dx = transformedDisplacement.x;
-		dy = transformedDisplacement.y;
-		dz = transformedDisplacement.z;
+		localPoint = WorldToLocal(point);
+		localDisplacement = NormalWorldToLocal(displacement);
+		
 	}else{
-		px = point.x;
-		py = point.y;
-		pz = point.z;
-		dx = displacement.x;
-		dy = displacement.y;
-		dz = displacement.z;
+		localPoint = point - pCenter;
+		localDisplacement = displacement;
 	}
+	
 	// test if inside
-	fpx = fabs(px);
-	fpy = fabs(py);
-	fpz = fabs(pz);
+	const double fpx = fabs(localPoint.x);
+	const double fpy = fabs(localPoint.y);
+	const double fpz = fabs(localPoint.z);
+	
 	if(fpx <= pHalfSize.x && fpy <= pHalfSize.y && fpz <= pHalfSize.z){
 		if(normal){
 			if(fpx > fpy){
 				if(fpx > fpz){
-					if(px > 0.0){
-						normal->Set(1.0, 0.0, 0.0);
-					}else{
-						normal->Set(-1.0, 0.0, 0.0);
-					}
+					normal->Set(localPoint.x > 0.0 ? pAxisX : -pAxisX);
+					
 				}else{
-					if(pz > 0.0){
-						normal->Set(0.0, 0.0, 1.0);
-					}else{
-						normal->Set(0.0, 0.0, -1.0);
-					}
+					normal->Set(localPoint.z > 0.0 ? pAxisZ : -pAxisZ);
 				}
+				
 			}else{
 				if(fpy > fpz){
-					if(py > 0.0){
-						normal->Set(0.0, 1.0, 0.0);
-					}else{
-						normal->Set(0.0, -1.0, 0.0);
-					}
+					normal->Set(localPoint.y > 0.0 ? pAxisY : -pAxisY);
+					
 				}else{
-					if(pz > 0.0){
-						normal->Set(0.0, 0.0, 1.0);
-					}else{
-						normal->Set(0.0, 0.0, -1.0);
-					}
+					normal->Set(localPoint.z > 0.0 ? pAxisZ : -pAxisZ);
 				}
 			}
 		}
 		return 0.0;
 	}
-	// test x-axis
-	if(dx < -1e-10 || dx > 1e-10){
-		factor = 1.0 / dx;
-		// bf = pHalfSize.x, normal = ( 1, 0, 0 )
-		lambda = (pHalfSize.x - px) * factor;
-		if(lambda >= 0.0 && lambda < 1.0){
-			hp = py + dy * lambda;
-			if(hp >= -pHalfSize.y && hp <= pHalfSize.y){
-				hp = pz + dz * lambda;
-				if(hp >= -pHalfSize.z && hp <= pHalfSize.z){
-					if(normal) normal->Set(pAxisX);
-					return lambda;
-				}
-			}
-		}
-		// bf = -pHalfSize.x, normal = ( -1, 0, 0 )
-		lambda = -(pHalfSize.x + px) * factor;
-		if(lambda >= 0.0 && lambda < 1.0){
-			hp = py + dy * lambda;
-			if(hp >= -pHalfSize.y && hp <= pHalfSize.y){
-				hp = pz + dz * lambda;
-				if(hp >= -pHalfSize.z && hp <= pHalfSize.z){
-					if(normal) normal->Set(-pAxisX);
-					return lambda;
-				}
-			}
-		}
-	}
-	// test y-axis
-	if(dy < -1e-10 || dy > 1e-10){
-		factor = 1.0 / dy;
-		// bf = pHalfSize.y, normal = ( 1, 0, 0 )
-		lambda = (pHalfSize.y - py) * factor;
-		if(lambda >= 0.0 && lambda < 1.0){
-			hp = px + dx * lambda;
-			if(hp >= -pHalfSize.x && hp <= pHalfSize.x){
-				hp = pz + dz * lambda;
-				if(hp >= -pHalfSize.z && hp <= pHalfSize.z){
-					if(normal) normal->Set(pAxisY);
-					return lambda;
-				}
-			}
-		}
-		// bf = -pHalfSize.y, normal = ( -1, 0, 0 )
-		lambda = -(pHalfSize.y + py) * factor;
-		if(lambda >= 0.0 && lambda < 1.0){
-			hp = px + dx * lambda;
-			if(hp >= -pHalfSize.x && hp <= pHalfSize.x){
-				hp = pz + dz * lambda;
-				if(hp >= -pHalfSize.z && hp <= pHalfSize.z){
-					if(normal) normal->Set(-pAxisY);
-					return lambda;
-				}
+	
+	// slab test. the entering face is the one with the largest entering distance
+	const double points[3] = {localPoint.x, localPoint.y, localPoint.z};
+	const double directions[3] = {localDisplacement.x, localDisplacement.y, localDisplacement.z};
+	const double halfSizes[3] = {pHalfSize.x, pHalfSize.y, pHalfSize.z};
+	const decDVector * const axes[3] = {&pAxisX, &pAxisY, &pAxisZ};
+	double lambdaEnter = 0.0, lambdaExit = 1.0;
+	int enterAxis = -1;
+	bool enterPositive = false;
+	int i;
+	
+	for(i=0; i<3; i++){
+		if(fabs(directions[i]) < 1e-12){
+			if(fabs(points[i]) > halfSizes[i]){
+				return 1.0;
 			}
+			continue;
 		}
-	}
-	// test z-axis
-	if(dz < -1e-10 || dz > 1e-10){
-		factor = 1.0 / dz;
-		// bf = pHalfSize.z, normal = ( 1, 0, 0 )
-		lambda = (pHalfSize.z - pz) * factor;
-		if(lambda >= 0.0 && lambda < 1.0){
-			hp = px + dx * lambda;
-			if(hp >= -pHalfSize.x && hp <= pHalfSize.x){
-				hp = py + dy * lambda;
-				if(hp >= -pHalfSize.y && hp <= pHalfSize.y){
-					if(normal) normal->Set(pAxisZ);
-					return lambda;
-				}
-			}
+		
+		const double factor = 1.0 / directions[i];
+		double lambda1 = (-halfSizes[i] - points[i]) * factor;
+		double lambda2 = (halfSizes[i] - points[i]) * factor;
+		bool positive = false;
+		
+		if(lambda1 > lambda2){
+			const double swap = lambda1;
+			lambda1 = lambda2;
+			lambda2 = swap;
+			positive = true;
 		}
-		// bf = pCenter.z - pHalfSize.z, normal = ( -1, 0, 0 )
-		lambda = -(pHalfSize.z + pz) * factor;
-		if(lambda >= 0.0 && lambda < 1.0){
-			hp = px + dx * lambda;
-			if(hp >= -pHalfSize.x && hp <= pHalfSize.x){
-				hp = py + dy * lambda;
-				if(hp >= -pHalfSize.y && hp <= pHalfSize.y){
-					if(normal) normal->Set(-pAxisZ);
-					return lambda;
-				}
-			}
+		
+		if(lambda1 > lambdaEnter){
+			lambdaEnter = lambda1;
+			enterAxis = i;
+			enterPositive = positive;
 		}
-	}
-	// no collision
-	return 1.0;
-/*
-// TODO: returning distance travelled, not simply if hit or not
-	double lambda, hp, bf, factor;
-	// test x-axis
-	if(displacement.x < -0.00001 || displacement.x > 0.00001){
-		factor = 1.0 / displacement.x;
-		// bf = pCenter.x + pHalfSize.x, normal = ( 1, 0, 0 )
-		lambda = (pCenter.x + pHalfSize.x - point.x) * factor;
-		if(lambda >= 0){
-			hp = pCenter.y + displacement.y * lambda;
-			if(hp >= pCenter.y - pHalfSize.y && hp <= pCenter.y + pHalfSize.y){
-				hp = pCenter.z + displacement.z * lambda;
-				if(hp >= pCenter.z - pHalfSize.z && hp <= pCenter.z + pHalfSize.z){
-					return 0.0;
-				}
-			}
+		if(lambda2 < lambdaExit){
+			lambdaExit = lambda2;
 		}
-		// bf = pCenter.x - pHalfSize.x, normal = ( -1, 0, 0 )
-		lambda = (pCenter.x - pHalfSize.x - pCenter.x) * factor;
-		if(lambda >= 0){
-			hp = pCenter.y + displacement.y * lambda;
-			if(hp >= pCenter.y - pHalfSize.y && hp <= pCenter.y + pHalfSize.y){
-				hp = pCenter.z + displacement.z * lambda;
-				if(hp >= pCenter.z - pHalfSize.z && hp <= pCenter.z + pHalfSize.z) return 0.0;
-			}
+		if(lambdaEnter > lambdaExit){
+			return 1.0;
 		}
 	}
-	// test y-axis
-	if(displacement.y < -0.00001 || displacement.y > 0.00001){
-		factor = 1.0 / displacement.y;
-		// bf = pCenter.y + pHalfSize.y, normal = ( 1, 0, 0 )
-		lambda = (pCenter.y + pHalfSize.y - pCenter.y) * factor;
-		if(lambda >= 0){
-			hp = pCenter.x + displacement.x * lambda;
-			if(hp >= pCenter.x - pHalfSize.x && hp <= pCenter.x + pHalfSize.x){
-				hp = pCenter.z + displacement.z * lambda;
-				if(hp >= pCenter.z - pHalfSize.z && hp <= pCenter.z + pHalfSize.z) return 0.0;
-			}
-		}
-		// bf = pCenter.y - pHalfSize.y, normal = ( -1, 0, 0 )
-		lambda = (pCenter.y - pHalfSize.y - pCenter.y) * factor;
-		if(lambda >= 0){
-			hp = pCenter.x + displacement.x * lambda;
-			if(hp >= pCenter.x - pHalfSize.x && hp <= pCenter.x + pHalfSize.x){
-				hp = pCenter.z + displacement.z * lambda;
-				if(hp >= pCenter.z - pHalfSize.z && hp <= pCenter.z + pHalfSize.z) return 0.0;
-			}
-		}
+	
+	if(enterAxis == -1 || lambdaEnter >= 1.0){
+		return 1.0;
 	}
-	// test z-axis
-	if(displacement.z < -0.00001 || displacement.z > 0.00001){
-		factor = 1.0 / displacement.z;
-		// bf = pCenter.z + pHalfSize.z, normal = ( 1, 0, 0 )
-		lambda = (pCenter.z + pHalfSize.z - pCenter.z) * factor;
-		if(lambda >= 0){
-			hp = pCenter.x + displacement.x * lambda;
-			if(hp >= pCenter.x - pHalfSize.x && hp <= pCenter.x + pHalfSize.x){
-				hp = pCenter.y + displacement.y * lambda;
-				if(hp >= pCenter.y - pHalfSize.y && hp <= pCenter.y + pHalfSize.y) return 0.0;
-			}
-		}
-		// bf = pCenter.z - pHalfSize.z, normal = ( -1, 0, 0 )
-		lambda = (pCenter.z - pHalfSize.z - pCenter.z) * factor;
-		if(lambda >= 0){
-			hp = pCenter.x + displacement.x * lambda;
-			if(hp >= pCenter.x - pHalfSize.x && hp <= pCenter.x + pHalfSize.x){
-				hp = pCenter.y + displacement.y * lambda;
-				if(hp >= pCenter.y - pHalfSize.y && hp <= pCenter.y + pHalfSize.y) return 0.0;
-			}
-		}
+	
+	if(normal){
+		normal->Set(enterPositive ? *axes[enterAxis] : -*axes[enterAxis]);
 	}
-	// no collision
-	return 1.0;
-}
-*/
+	return lambdaEnter;
 }
 
 
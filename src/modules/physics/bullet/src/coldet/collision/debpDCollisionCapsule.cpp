@@ -147,8 +147,93 @@ double debpDCollisionCapsule::FrustumMoveHitsVolume(debpDCollisionFrustum *frust
 }
 
 double debpDCollisionCapsule::PointMoveHitsVolume(const decDVector &point, const decDVector &displacement, decDVector *normal){
-	// TODO
-	return 1.0;
+	const decDVector localPoint(WorldToLocal(point));
+	const decDVector localDisplacement(NormalWorldToLocal(displacement));
+	const decDVector topCenter(0.0, pHalfHeight, 0.0);
+	const decDVector bottomCenter(0.0, -pHalfHeight, 0.0);
+	
+	// the side is a cone frustum touching both spheres. the tangent points are rotated
+	// by the angle the spheres radii difference tilts the side
+	bool hasSide = false;
+	double sideBottom = 0.0, sideTop = 0.0, sideRadius = 0.0, sideSlope = 0.0;
+	
+	if(pHalfHeight > 1e-12){
+		const double sinAngle = (pBottomRadius - pTopRadius) / (pHalfHeight * 2.0);
+		
+		if(fabs(sinAngle) < 1.0){
+			const double cosAngle = sqrt(1.0 - sinAngle * sinAngle);
+			sideBottom = -pHalfHeight + pBottomRadius * sinAngle;
+			sideTop = pHalfHeight + pTopRadius * sinAngle;
+			sideSlope = (pTopRadius - pBottomRadius) * cosAngle / (sideTop - sideBottom);
+			sideRadius = pBottomRadius * cosAngle - sideSlope * sideBottom;
+			hasSide = true;
+		}
+	}
+	
+	// test if inside. the normal points away from the closest point on the capsule axis
+	const decDVector topDiff(localPoint - topCenter);
+	const decDVector bottomDiff(localPoint - bottomCenter);
+	bool inside = topDiff * topDiff <= pTopRadius * pTopRadius
+		|| bottomDiff * bottomDiff <= pBottomRadius * pBottomRadius;
+	
+	if(!inside && hasSide && localPoint.y >= sideBottom && localPoint.y <= sideTop){
+		const double maxRadius = sideRadius + sideSlope * localPoint.y;
+		inside = localPoint.x * localPoint.x + localPoint.z * localPoint.z <= maxRadius * maxRadius;
+	}
+	
+	if(inside){
+		if(normal){
+			const decDVector diff(localPoint - decDVector(0.0,
+				decMath::clamp(localPoint.y, -pHalfHeight, pHalfHeight), 0.0));
+			
+			if(diff.Length() > 1e-12){
+				*normal = NormalLocalToWorld(diff.Normalized());
+				
+			}else{
+				normal->Set(-displacement);
+				normal->Normalize();
+			}
+		}
+		return 0.0;
+	}
+	
+	double bestLambda = 1.0;
+	decDVector bestNormal, hitNormal;
+	double lambda;
+	
+	// spheres
+	lambda = debpDCollisionDetection::RayEntersSphere(localPoint, localDisplacement,
+		topCenter, pTopRadius, hitNormal);
+	if(lambda >= 0.0 && lambda < bestLambda){
+		bestLambda = lambda;
+		bestNormal = hitNormal;
+	}
+	
+	lambda = debpDCollisionDetection::RayEntersSphere(localPoint, localDisplacement,
+		bottomCenter, pBottomRadius, hitNormal);
+	if(lambda >= 0.0 && lambda < bestLambda){
+		bestLambda = lambda;
+		bestNormal = hitNormal;
+	}
+	
+	// side
+	if(hasSide){
+		lambda = debpDCollisionDetection::RayEntersFrustumSide(localPoint, localDisplacement,
+			sideBottom, sideTop, sideRadius, sideSlope, hitNormal);
+		if(lambda >= 0.0 && lambda < bestLambda){
+			bestLambda = lambda;
+			bestNormal = hitNormal;
+		}
+	}
+	
+	if(bestLambda >= 1.0){
+		return 1.0;
+	}
+	
+	if(normal){
+		*normal = NormalLocalToWorld(bestNormal);
+	}
+	return bestLambda;
 }
 
 
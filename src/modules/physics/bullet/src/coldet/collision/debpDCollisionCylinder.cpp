@@ -147,8 +147,77 @@ double debpDCollisionCylinder::FrustumMoveHitsVolume(debpDCollisionFrustum *frus
 }
 
 double debpDCollisionCylinder::PointMoveHitsVolume(const decDVector &point, const decDVector &displacement, decDVector *normal){
-	// TODO
-	return 1.0;
+	const decDVector localPoint(WorldToLocal(point));
+	const decDVector localDisplacement(NormalWorldToLocal(displacement));
+	const double slope = pHalfHeight > 1e-12 ? (pTopRadius - pBottomRadius) / (pHalfHeight * 2.0) : 0.0;
+	const double radius = (pTopRadius + pBottomRadius) * 0.5;
+	const double rhoSquared = localPoint.x * localPoint.x + localPoint.z * localPoint.z;
+	
+	// test if inside. the normal points to the closest surface
+	if(fabs(localPoint.y) <= pHalfHeight){
+		const double rho = sqrt(rhoSquared);
+		const double sideDistance = radius + slope * localPoint.y - rho;
+		
+		if(sideDistance >= 0.0){
+			if(normal){
+				const double capDistance = pHalfHeight - fabs(localPoint.y);
+				
+				if(sideDistance < capDistance && rho > 1e-12){
+					*normal = NormalLocalToWorld(decDVector(localPoint.x, -slope * (radius
+						+ slope * localPoint.y), localPoint.z).Normalized());
+					
+				}else{
+					*normal = localPoint.y > 0.0 ? pAxisY : -pAxisY;
+				}
+			}
+			return 0.0;
+		}
+	}
+	
+	double bestLambda = 1.0;
+	decDVector bestNormal;
+	
+	// caps
+	if(localDisplacement.y < -1e-12){
+		const double lambda = (pHalfHeight - localPoint.y) / localDisplacement.y;
+		if(lambda >= 0.0 && lambda < bestLambda){
+			const double x = localPoint.x + localDisplacement.x * lambda;
+			const double z = localPoint.z + localDisplacement.z * lambda;
+			if(x * x + z * z <= pTopRadius * pTopRadius){
+				bestLambda = lambda;
+				bestNormal.Set(0.0, 1.0, 0.0);
+			}
+		}
+		
+	}else if(localDisplacement.y > 1e-12){
+		const double lambda = (-pHalfHeight - localPoint.y) / localDisplacement.y;
+		if(lambda >= 0.0 && lambda < bestLambda){
+			const double x = localPoint.x + localDisplacement.x * lambda;
+			const double z = localPoint.z + localDisplacement.z * lambda;
+			if(x * x + z * z <= pBottomRadius * pBottomRadius){
+				bestLambda = lambda;
+				bestNormal.Set(0.0, -1.0, 0.0);
+			}
+		}
+	}
+	
+	// side
+	decDVector sideNormal;
+	const double lambda = debpDCollisionDetection::RayEntersFrustumSide(localPoint,
+		localDisplacement, -pHalfHeight, pHalfHeight, radius, slope, sideNormal);
+	if(lambda >= 0.0 && lambda < bestLambda){
+		bestLambda = lambda;
+		bestNormal = sideNormal;
+	}
+	
+	if(bestLambda >= 1.0){
+		return 1.0;
+	}
+	
+	if(normal){
+		*normal = NormalLocalToWorld(bestNormal);
+	}
+	return bestLambda;
 }
 
 
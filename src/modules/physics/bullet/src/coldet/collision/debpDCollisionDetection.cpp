@@ -926,3 +926,128 @@ const decDVector &tri1, const decDVector &tri2, const decDVector &tri3, const de
 	
 	return false;
 }
+
+
+
+double debpDCollisionDetection::RayEntersSphere(const decDVector &rayOrigin, const decDVector &rayDirection,
+const decDVector &sphereCenter, double sphereRadius, decDVector &normal){
+	const decDVector point(rayOrigin - sphereCenter);
+	const double c = point * point - sphereRadius * sphereRadius;
+	const double b = point * rayDirection;
+	
+	// origin inside or ray moving away from the sphere
+	if(c <= 0.0 || b >= 0.0){
+		return -1.0;
+	}
+	
+	const double a = rayDirection * rayDirection;
+	const double disc = b * b - a * c;
+	if(disc < 0.0){
+		return -1.0;
+	}
+	
+	const double lambda = (-b - sqrt(disc)) / a;
+	if(lambda > 1.0){
+		return -1.0;
+	}
+	
+	normal = (point + rayDirection * lambda) / sphereRadius;
+	return lambda;
+}
+
+double debpDCollisionDetection::RayEntersFrustumSide(const decDVector &rayOrigin,
+const decDVector &rayDirection, double frustumBottom, double frustumTop, double frustumRadius,
+double frustumSlope, decDVector &normal){
+	// side surface is x^2 + z^2 = (radius + slope * y)^2 . inserting the ray gives
+	// a quadratic equation a*t^2 + 2*b*t + c = 0
+	const double radius = frustumRadius + frustumSlope * rayOrigin.y;
+	const double dradius = frustumSlope * rayDirection.y;
+	const double a = rayDirection.x * rayDirection.x + rayDirection.z * rayDirection.z - dradius * dradius;
+	const double b = rayOrigin.x * rayDirection.x + rayOrigin.z * rayDirection.z - radius * dradius;
+	const double c = rayOrigin.x * rayOrigin.x + rayOrigin.z * rayOrigin.z - radius * radius;
+	double lambdas[2];
+	int i, count = 0;
+	
+	if(fabs(a) < 1e-12){
+		if(fabs(b) < 1e-12){
+			return -1.0;
+		}
+		lambdas[count++] = -c / (b * 2.0);
+		
+	}else{
+		const double disc = b * b - a * c;
+		if(disc < 0.0){
+			return -1.0;
+		}
+		
+		const double sdisc = sqrt(disc);
+		const double lambda1 = (-b - sdisc) / a;
+		const double lambda2 = (-b + sdisc) / a;
+		lambdas[count++] = decMath::min(lambda1, lambda2);
+		lambdas[count++] = decMath::max(lambda1, lambda2);
+	}
+	
+	for(i=0; i<count; i++){
+		if(lambdas[i] < 0.0 || lambdas[i] > 1.0){
+			continue;
+		}
+		
+		const decDVector hitPoint(rayOrigin + rayDirection * lambdas[i]);
+		if(hitPoint.y < frustumBottom || hitPoint.y > frustumTop){
+			continue;
+		}
+		
+		// reject the mirrored cone and hits leaving the surface
+		const double hitRadius = frustumRadius + frustumSlope * hitPoint.y;
+		if(hitRadius < 0.0){
+			continue;
+		}
+		
+		const decDVector gradient(hitPoint.x, -frustumSlope * hitRadius, hitPoint.z);
+		if(gradient * rayDirection >= 0.0){
+			continue;
+		}
+		
+		const double length = gradient.Length();
+		if(length < 1e-12){
+			continue;
+		}
+		
+		normal = gradient / length;
+		return lambdas[i];
+	}
+	
+	return -1.0;
+}
+
+double debpDCollisionDetection::RayEntersTriangle(const decDVector &rayOrigin,
+const decDVector &rayDirection, const decDVector &tri1, const decDVector &tri2, const decDVector &tri3){
+	const decDVector edge1(tri2 - tri1);
+	const decDVector edge2(tri3 - tri1);
+	const decDVector pvec(rayDirection % edge2);
+	const double det = edge1 * pvec;
+	
+	if(fabs(det) < 1e-20){
+		return -1.0;
+	}
+	
+	const double invDet = 1.0 / det;
+	const decDVector tvec(rayOrigin - tri1);
+	const double u = (tvec * pvec) * invDet;
+	if(u < 0.0 || u > 1.0){
+		return -1.0;
+	}
+	
+	const decDVector qvec(tvec % edge1);
+	const double v = (rayDirection * qvec) * invDet;
+	if(v < 0.0 || u + v > 1.0){
+		return -1.0;
+	}
+	
+	const double lambda = (edge2 * qvec) * invDet;
+	if(lambda < 0.0 || lambda > 1.0){
+		return -1.0;
+	}
+	
+	return lambda;
+}
@@ -370,6 +370,49 @@ public:
 	static bool RayHitsTriangle(const decDVector &rayOrigin, const decDVector &rayDirection,
 		const decDVector &tri1, const decDVector &tri2, const decDVector &tri3,
 		const decDVector &trinormal);
+
+
+
+	/**
+	 * Determines where a ray enters a sphere from the outside.
+	 * @param rayOrigin Origin of the ray. Has to be outside the sphere.
+	 * @param rayDirection Direction of the ray.
+	 * @param sphereCenter Center of the sphere.
+	 * @param sphereRadius Radius of the sphere.
+	 * @param normal If the ray hits this will be set to the surface normal at the hit point.
+	 * @return Distance in the range from 0 to 1 along the ray or -1 if the ray misses.
+	 */
+	static double RayEntersSphere(const decDVector &rayOrigin, const decDVector &rayDirection,
+		const decDVector &sphereCenter, double sphereRadius, decDVector &normal);
+
+	/**
+	 * Determines where a ray enters the side of a cone frustum oriented along the Y-Axis.
+	 * The frustum radius along the Y-Axis is frustumRadius + frustumSlope * y. Only hits
+	 * from the outside with y in the range from frustumBottom to frustumTop are considered.
+	 * @param rayOrigin Origin of the ray relative to the frustum.
+	 * @param rayDirection Direction of the ray.
+	 * @param frustumBottom Bottom end of the frustum side along the Y-Axis.
+	 * @param frustumTop Top end of the frustum side along the Y-Axis.
+	 * @param frustumRadius Radius of the frustum at y=0.
+	 * @param frustumSlope Change of the frustum radius along the Y-Axis.
+	 * @param normal If the ray hits this will be set to the surface normal at the hit point.
+	 * @return Distance in the range from 0 to 1 along the ray or -1 if the ray misses.
+	 */
+	static double RayEntersFrustumSide(const decDVector &rayOrigin, const decDVector &rayDirection,
+		double frustumBottom, double frustumTop, double frustumRadius, double frustumSlope,
+		decDVector &normal);
+
+	/**
+	 * Determines where a ray hits a triangle from either side.
+	 * @param rayOrigin Origin of the ray.
+	 * @param rayDirection Direction of the ray.
+	 * @param tri1 First point of the triangle.
+	 * @param tri2 Second point of the triangle.
+	 * @param tri3 Third point of the triangle.
+	 * @return Distance in the range from 0 to 1 along the ray or -1 if the ray misses.
+	 */
+	static double RayEntersTriangle(const decDVector &rayOrigin, const decDVector &rayDirection,
+		const decDVector &tri1, const decDVector &tri2, const decDVector &tri3);
 	/*@}*/
 	
 	/** @name Side Test Routines */
@@ -135,16 +135,32 @@ double debpDCollisionSphere::FrustumMoveHitsVolume(debpDCollisionFrustum *frustu
 }
 
 double debpDCollisionSphere::PointMoveHitsVolume(const decDVector &point, const decDVector &displacement, decDVector *normal){
-	double lambda = ((pCenter - point) * displacement) / (displacement * displacement);
-	if(lambda < 0 || lambda > 1){
-		return 1;
-	}else{
+	const decDVector diff(point - pCenter);
+	
+	if(diff * diff <= pRadius * pRadius){
 		if(normal){
-			*normal = point - pCenter;
-			normal->Normalize();
+			if(diff.Length() > 1e-12){
+				*normal = diff.Normalized();
+				
+			}else{
+				normal->Set(-displacement);
+				normal->Normalize();
+			}
 		}
-		return lambda;
+		return 0.0;
 	}
+	
+	decDVector hitNormal;
+	const double lambda = debpDCollisionDetection::RayEntersSphere(
+		point, displacement, pCenter, pRadius, hitNormal);
+	if(lambda < 0.0){
+		return 1.0;
+	}
+	
+	if(normal){
+		*normal = hitNormal;
+	}
+	return lambda;
 }
 
 
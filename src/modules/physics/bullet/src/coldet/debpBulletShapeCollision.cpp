@@ -26,9 +26,14 @@
 #include <stdlib.h>
 
 #include "debpBulletShapeCollision.h"
+#include "debpConvexHullShape.h"
 #include "collision/debpDCollisionBox.h"
 #include "collision/debpDCollisionSphere.h"
+#include "collision/debpDCollisionCapsule.h"
+#include "collision/debpDCollisionCylinder.h"
+#include "collision/debpDCollisionDetection.h"
 #include "../dePhysicsBullet.h"
+#include "../world/debpHeightTerrainShape.h"
 
 #include "BulletCollision/CollisionShapes/btCapsuleShape.h"
 #include "BulletCollision/CollisionShapes/btCollisionShape.h"
@@ -40,6 +45,8 @@
 #include "BulletCollision/CollisionShapes/btConvexHullShape.h"
 #include "BulletCollision/CollisionShapes/btCompoundShape.h"
 #include "BulletCollision/CollisionShapes/btPolyhedralConvexShape.h"
+#include "BulletCollision/CollisionShapes/btBvhTriangleMeshShape.h"
+#include "BulletCollision/NarrowPhaseCollision/btRaycastCallback.h"
 #include "BulletCollision/CollisionDispatch/btCollisionObjectWrapper.h"
 #include "BulletCollision/BroadphaseCollision/btDbvt.h"
 #include "BulletCollision/BroadphaseCollision/btDbvtBroadphase.h"
@@ -86,6 +93,110 @@ struct LocalInfoAdder : public btCollisionWorld::ConvexResultCallback{
 
 
 
+static inline decDVector btToDVector(const btVector3 &vector){
+	return decDVector((double)vector.getX(), (double)vector.getY(), (double)vector.getZ());
+}
+
+static inline decVector btToWorldNormal(const btTransform &transform, const decDVector &normal){
+	const btVector3 worldNormal(transform.getBasis() * btVector3(
+		(btScalar)normal.x, (btScalar)normal.y, (btScalar)normal.z));
+	return decVector((float)worldNormal.getX(), (float)worldNormal.getY(), (float)worldNormal.getZ());
+}
+
+struct RayCastChildCollector : public btDbvt::ICollide{
+	const debpBulletShapeCollision &pOwner;
+	const btCollisionObject &pColObj;
+	const btCompoundShape &pCompound;
+	const btTransform &pTransform;
+	const btVector3 &pRayFrom;
+	const btVector3 &pRayTo;
+	decTList<debpBulletShapeCollision::sRayHit> &pHits;
+	
+	RayCastChildCollector(const debpBulletShapeCollision &owner, const btCollisionObject &colObj,
+		const btCompoundShape &compound, const btTransform &transform, const btVector3 &rayFrom,
+		const btVector3 &rayTo, decTList<debpBulletShapeCollision::sRayHit> &hits) :
+	pOwner(owner), pColObj(colObj), pCompound(compound), pTransform(transform),
+	pRayFrom(rayFrom), pRayTo(rayTo), pHits(hits){
+	}
+	
+	void Process(const btDbvtNode *leaf) override{
+		const int index = leaf->dataAsInt;
+		pOwner.RayCast(pColObj, *pCompound.getChildShape(index),
+			pTransform * pCompound.getChildTransform(index), pRayFrom, pRayTo, pHits);
+	}
+};
+
+/**
+ * Two sided triangle ray test in double precision. Bullet calls processTriangle with the
+ * triangles overlapping the ray. Keeps the closest hit.
+ */
+struct RayCastTriangleCallback : public btTriangleRaycastCallback{
+	const decDVector pOrigin;
+	const decDVector pDirection;
+	double pDistance;
+	decDVector pNormal;
+	
+	RayCastTriangleCallback(const btVector3 &rayFrom, const btVector3 &rayTo) :
+	btTriangleRaycastCallback(rayFrom, rayTo),
+	pOrigin(btToDVector(rayFrom)),
+	pDirection(btToDVector(rayTo) - pOrigin),
+	pDistance(1.0){
+	}
+	
+	void processTriangle(btVector3 *triangle, int, int) override{
+		const decDVector tri1(btToDVector(triangle[0]));
+		const decDVector tri2(btToDVector(triangle[1]));
+		const decDVector tri3(btToDVector(triangle[2]));
+		
+		const double distance = debpDCollisionDetection::RayEntersTriangle(
+			pOrigin, pDirection, tri1, tri2, tri3);
+		if(distance < 0.0 || distance >= pDistance){
+			return;
+		}
+		
+		decDVector normal((tri2 - tri1) % (tri3 - tri1));
+		const double length = normal.Length();
+		if(length < 1e-20){
+			return;
+		}
+		
+		normal /= length;
+		if(normal * pDirection > 0.0){
+			normal = -normal;
+		}
+		
+		pDistance = distance;
+		pNormal = normal;
+		m_hitFraction = (btScalar)distance;
+	}
+	
+	btScalar reportHit(const btVector3&, btScalar hitFraction, int, int) override{
+		return hitFraction;
+	}
+};
+
+struct RayCastBulletCallback : public btCollisionWorld::RayResultCallback{
+	const btTransform &pTransform;
+	btVector3 pNormal;
+	
+	RayCastBulletCallback(const btTransform &transform) :
+	pTransform(transform),
+	pNormal(BT_ZERO, BT_ZERO, BT_ZERO){
+	}
+	
+	btScalar addSingleResult(btCollisionWorld::LocalRayResult &rayResult, bool normalInWorldSpace) override{
+		if(rayResult.m_hitFraction < m_closestHitFraction){
+			m_closestHitFraction = rayResult.m_hitFraction;
+			m_collisionObject = rayResult.m_collisionObject;
+			pNormal = normalInWorldSpace ? rayResult.m_hitNormalLocal
+				: pTransform.getBasis() * rayResult.m_hitNormalLocal;
+		}
+		return m_closestHitFraction;
+	}
+};
+
+
+
 // Class debpBulletShapeCollision
 ///////////////////////////////////
 
@@ -443,6 +554,57 @@ const btVector3 &position) const{
 
 
 
+void debpBulletShapeCollision::PrepareRayCast(btCollisionShape &shape) const{
+	switch(shape.getShapeType()){
+	case COMPOUND_SHAPE_PROXYTYPE:{
+		btCompoundShape &compound = (btCompoundShape &)shape;
+		const int count = compound.getNumChildShapes();
+		int i;
+		for(i=0; i<count; i++){
+			PrepareRayCast(*compound.getChildShape(i));
+		}
+		}break;
+		
+	case CONVEX_HULL_SHAPE_PROXYTYPE:{
+		debpConvexHullShape * const hull = dynamic_cast<debpConvexHullShape*>(&shape);
+		if(hull){
+			hull->UpdateRayPlanes();
+		}
+		}break;
+		
+	default:
+		break;
+	}
+}
+
+void debpBulletShapeCollision::RayCast(const btCollisionObject &colObj,
+const btVector3 &rayFrom, const btVector3 &rayTo, decTList<sRayHit> &hits) const{
+	RayCast(colObj, *colObj.getCollisionShape(), colObj.getWorldTransform(), rayFrom, rayTo, hits);
+}
+
+void debpBulletShapeCollision::RayCast(const btCollisionObject &colObj,
+const btCollisionShape &shape, const btTransform &transform, const btVector3 &rayFrom,
+const btVector3 &rayTo, decTList<sRayHit> &hits) const{
+	if(shape.isCompound()){
+		RayCastCompound(colObj, shape, transform, rayFrom, rayTo, hits);
+		
+	}else if(shape.isConvex()){
+		if(!RayCastConvex(shape, transform, rayFrom, rayTo, hits)){
+			RayCastBullet(colObj, shape, transform, rayFrom, rayTo, hits);
+		}
+		
+	}else if(shape.isConcave()){
+		if(!RayCastConcave(shape, transform, rayFrom, rayTo, hits)){
+			RayCastBullet(colObj, shape, transform, rayFrom, rayTo, hits);
+		}
+		
+	}else{
+		RayCastBullet(colObj, shape, transform, rayFrom, rayTo, hits);
+	}
+}
+
+
+
 bool debpBulletShapeCollision::HasTransformRotation(const btTransform &castFromTrans, const btTransform &castToTrans) const{
 	// check if there is a rotation present. this is the case if the rotation part of the from and
 	// to matrices are identical. correctly the quaternion orientation would have to be compared.
@@ -557,3 +719,230 @@ btCollisionWorld::ConvexResultCallback &resultCallback) const{
 		}
 	}
 }
+
+
+void debpBulletShapeCollision::RayCastCompound(const btCollisionObject &colObj,
+const btCollisionShape &shape, const btTransform &transform, const btVector3 &rayFrom,
+const btVector3 &rayTo, decTList<sRayHit> &hits) const{
+	const btCompoundShape &compound = (const btCompoundShape &)shape;
+	const btDbvt * const tree = compound.getDynamicAabbTree();
+	
+	if(tree && tree->m_root){
+		// child bounding boxes are stored relative to the compound
+		RayCastChildCollector collector(*this, colObj, compound, transform, rayFrom, rayTo, hits);
+		btDbvt::rayTest(tree->m_root, transform.invXform(rayFrom), transform.invXform(rayTo), collector);
+		
+	}else{
+		const int count = compound.getNumChildShapes();
+		int i;
+		for(i=0; i<count; i++){
+			RayCast(colObj, *compound.getChildShape(i), transform * compound.getChildTransform(i),
+				rayFrom, rayTo, hits);
+		}
+	}
+}
+
+bool debpBulletShapeCollision::RayCastConvex(const btCollisionShape &shape,
+const btTransform &transform, const btVector3 &rayFrom, const btVector3 &rayTo,
+decTList<sRayHit> &hits) const{
+	// ray tests are done in shape local space with the shape centered at the origin
+	const decDVector origin(btToDVector(transform.invXform(rayFrom)));
+	const decDVector direction(btToDVector(transform.invXform(rayTo)) - origin);
+	double distance = 1.0;
+	decDVector normal;
+	
+	switch(shape.getShapeType()){
+	case BOX_SHAPE_PROXYTYPE:{
+		debpDCollisionBox box(decDVector(), btToDVector(((const btBoxShape &)shape).getHalfExtentsWithMargin()));
+		distance = box.PointMoveHitsVolume(origin, direction, &normal);
+		}break;
+		
+	case SPHERE_SHAPE_PROXYTYPE:{
+		debpDCollisionSphere sphere(decDVector(), (double)((const btSphereShape &)shape).getRadius());
+		distance = sphere.PointMoveHitsVolume(origin, direction, &normal);
+		}break;
+		
+	case CAPSULE_SHAPE_PROXYTYPE:{
+		const btCapsuleShape &capsuleShape = (const btCapsuleShape &)shape;
+		if(capsuleShape.getUpAxis() != 1){
+			return false;
+		}
+		
+		const double radius = (double)capsuleShape.getRadius();
+		debpDCollisionCapsule capsule(decDVector(), (double)capsuleShape.getHalfHeight(), radius, radius);
+		distance = capsule.PointMoveHitsVolume(origin, direction, &normal);
+		}break;
+		
+	case CYLINDER_SHAPE_PROXYTYPE:{
+		const btCylinderShape &cylinderShape = (const btCylinderShape &)shape;
+		if(cylinderShape.getUpAxis() != 1){
+			return false;
+		}
+		
+		const btVector3 &halfExtents = cylinderShape.getHalfExtentsWithMargin();
+		const double radius = (double)halfExtents.getX();
+		debpDCollisionCylinder cylinder(decDVector(), (double)halfExtents.getY(), radius, radius);
+		distance = cylinder.PointMoveHitsVolume(origin, direction, &normal);
+		}break;
+		
+	case MULTI_SPHERE_SHAPE_PROXYTYPE:{
+		// used for ellipsoids and tapered capsules. the local scaling is removed from the
+		// ray to test against the unscaled spheres
+		const btMultiSphereShape &msphere = (const btMultiSphereShape &)shape;
+		const decDVector scaling(btToDVector(msphere.getLocalScaling()));
+		if(scaling.x < 1e-12 || scaling.y < 1e-12 || scaling.z < 1e-12){
+			return false;
+		}
+		
+		const decDVector scaledOrigin(origin.x / scaling.x, origin.y / scaling.y, origin.z / scaling.z);
+		const decDVector scaledDirection(direction.x / scaling.x,
+			direction.y / scaling.y, direction.z / scaling.z);
+		
+		if(msphere.getSphereCount() == 1){
+			debpDCollisionSphere sphere(btToDVector(msphere.getSpherePosition(0)),
+				(double)msphere.getSphereRadius(0));
+			distance = sphere.PointMoveHitsVolume(scaledOrigin, scaledDirection, &normal);
+			
+		}else if(msphere.getSphereCount() == 2){
+			const decDVector position1(btToDVector(msphere.getSpherePosition(0)));
+			const decDVector position2(btToDVector(msphere.getSpherePosition(1)));
+			if(fabs(position1.x - position2.x) > 1e-6 || fabs(position1.z - position2.z) > 1e-6){
+				return false;
+			}
+			
+			const bool firstIsTop = position1.y > position2.y;
+			debpDCollisionCapsule capsule((position1 + position2) * 0.5,
+				fabs(position1.y - position2.y) * 0.5,
+				(double)msphere.getSphereRadius(firstIsTop ? 0 : 1),
+				(double)msphere.getSphereRadius(firstIsTop ? 1 : 0));
+			distance = capsule.PointMoveHitsVolume(scaledOrigin, scaledDirection, &normal);
+			
+		}else{
+			return false;
+		}
+		
+		normal.Set(normal.x / scaling.x, normal.y / scaling.y, normal.z / scaling.z);
+		const double length = normal.Length();
+		if(length > 1e-12){
+			normal /= length;
+		}
+		}break;
+		
+	case CONVEX_HULL_SHAPE_PROXYTYPE:{
+		const debpConvexHullShape * const hull = dynamic_cast<const debpConvexHullShape*>(&shape);
+		if(!hull || !hull->GetRayPlanesValid() || hull->GetRayPlanes().IsEmpty()){
+			return false;
+		}
+		
+		// clip ray against the face planes. the ray enters at the largest entering
+		// distance unless it exits the hull before
+		const decTList<debpConvexHullShape::sPlane> &planes = hull->GetRayPlanes();
+		const double margin = (double)hull->getMargin();
+		const int count = planes.GetCount();
+		double enterDistance = 0.0, exitDistance = 1.0;
+		double insideDistance = -1e30;
+		int enterPlane = -1, insidePlane = 0;
+		int i;
+		
+		for(i=0; i<count; i++){
+			const debpConvexHullShape::sPlane &plane = planes.GetAt(i);
+			const double planeDistance = plane.normal * origin - plane.distance - margin;
+			const double dot = plane.normal * direction;
+			
+			if(planeDistance > insideDistance){
+				insideDistance = planeDistance;
+				insidePlane = i;
+			}
+			
+			if(fabs(dot) < 1e-15){
+				if(planeDistance > 0.0){
+					return true;
+				}
+				continue;
+			}
+			
+			const double lambda = -planeDistance / dot;
+			if(dot < 0.0){
+				if(lambda > enterDistance){
+					enterDistance = lambda;
+					enterPlane = i;
+				}
+				
+			}else if(lambda < exitDistance){
+				exitDistance = lambda;
+			}
+			
+			if(enterDistance > exitDistance){
+				return true;
+			}
+		}
+		
+		if(enterPlane != -1){
+			distance = enterDistance;
+			normal = planes.GetAt(enterPlane).normal;
+			
+		}else if(insideDistance <= 0.0){
+			// ray starts inside the hull
+			distance = 0.0;
+			normal = planes.GetAt(insidePlane).normal;
+		}
+		}break;
+		
+	default:
+		return false;
+	}
+	
+	if(distance < 1.0){
+		hits.Add(sRayHit{&shape, (float)distance, btToWorldNormal(transform, normal)});
+	}
+	return true;
+}
+
+bool debpBulletShapeCollision::RayCastConcave(const btCollisionShape &shape,
+const btTransform &transform, const btVector3 &rayFrom, const btVector3 &rayTo,
+decTList<sRayHit> &hits) const{
+	const btVector3 localFrom(transform.invXform(rayFrom));
+	const btVector3 localTo(transform.invXform(rayTo));
+	RayCastTriangleCallback callback(localFrom, localTo);
+	
+	// these calls are not declared const but do not modify the shapes
+	switch(shape.getShapeType()){
+	case TRIANGLE_MESH_SHAPE_PROXYTYPE:
+		const_cast<btBvhTriangleMeshShape&>((const btBvhTriangleMeshShape &)shape)
+			.performRaycast(&callback, localFrom, localTo);
+		break;
+		
+	case TERRAIN_SHAPE_PROXYTYPE:
+		const_cast<debpHeightTerrainShape&>((const debpHeightTerrainShape &)shape)
+			.processRaycastAllTriangles(&callback, localFrom, localTo);
+		break;
+		
+	default:
+		return false;
+	}
+	
+	if(callback.pDistance < 1.0){
+		hits.Add(sRayHit{&shape, (float)callback.pDistance, btToWorldNormal(transform, callback.pNormal)});
+	}
+	return true;
+}
+
+void debpBulletShapeCollision::RayCastBullet(const btCollisionObject &colObj,
+const btCollisionShape &shape, const btTransform &transform, const btVector3 &rayFrom,
+const btVector3 &rayTo, decTList<sRayHit> &hits) const{
+	btTransform rayFromTrans, rayToTrans;
+	rayFromTrans.setIdentity();
+	rayFromTrans.setOrigin(rayFrom);
+	rayToTrans.setIdentity();
+	rayToTrans.setOrigin(rayTo);
+	
+	RayCastBulletCallback callback(transform);
+	btCollisionWorld::rayTestSingle(rayFromTrans, rayToTrans,
+		const_cast<btCollisionObject*>(&colObj), &shape, transform, callback);
+	
+	if(callback.hasHit()){
+		const btVector3 normal(callback.pNormal.normalized());
+		hits.Add(sRayHit{&shape, (float)callback.m_closestHitFraction,
+			decVector((float)normal.getX(), (float)normal.getY(), (float)normal.getZ())});
+	}
+}
@@ -25,6 +25,7 @@
 #ifndef _DEBPBULLETSHAPECOLLISION_H_
 #define _DEBPBULLETSHAPECOLLISION_H_
 
+#include <dragengine/common/collection/decTList.h>
 #include <dragengine/common/math/decMath.h>
 
 #include <LinearMath/btScalar.h>
@@ -50,6 +51,21 @@ class btConvexShape;
  * possible. Also implements some bullet collision tests which are missing.
  */
 class debpBulletShapeCollision{
+public:
+	/** \brief Ray cast hit on a collision shape. */
+	struct sRayHit{
+		/** \brief Hit leaf collision shape. */
+		const btCollisionShape *shape;
+		
+		/** \brief Hit distance along the ray in the range from 0 to 1. */
+		float distance;
+		
+		/** \brief Hit normal in world space. */
+		decVector normal;
+	};
+	
+	
+	
 private:
 	dePhysicsBullet &pBullet;
 	btAlignedObjectArray<const btDbvtNode*> pRayTestStacks;
@@ -121,6 +137,31 @@ public:
 	 * the appropriate method simulating it if absent.
 	 */
 	bool IsPointInside(const btCollisionShape &shape, const btVector3 &position) const;
+	
+	
+	
+	/**
+	 * \brief Prepare collision shape for ray casting.
+	 * 
+	 * Updates data required by RayCast. Call only from the main thread before RayCast.
+	 */
+	void PrepareRayCast(btCollisionShape &shape) const;
+	
+	/**
+	 * \brief Cast ray against collision object.
+	 * 
+	 * Adds the closest hit of each hit leaf shape to \em hits. Uses exact ray tests for
+	 * the shapes created by the module and falls back to bullet ray testing otherwise.
+	 * Does not modify any state and is safe to be called from parallel tasks if
+	 * PrepareRayCast has been called.
+	 */
+	void RayCast(const btCollisionObject &colObj, const btVector3 &rayFrom,
+		const btVector3 &rayTo, decTList<sRayHit> &hits) const;
+	
+	/** \brief Cast ray against collision shape placed using world transform. */
+	void RayCast(const btCollisionObject &colObj, const btCollisionShape &shape,
+		const btTransform &transform, const btVector3 &rayFrom, const btVector3 &rayTo,
+		decTList<sRayHit> &hits) const;
 	/*@}*/
 	
 	
@@ -137,6 +178,24 @@ public:
 	void SphereVolumeFromSphereShape(debpDCollisionSphere &sphereVolume,
 		btSphereShape &sphereShape, const btTransform &shapeTransform) const;
 	
+	/** \brief Cast ray against compound shape. */
+	void RayCastCompound(const btCollisionObject &colObj, const btCollisionShape &shape,
+		const btTransform &transform, const btVector3 &rayFrom, const btVector3 &rayTo,
+		decTList<sRayHit> &hits) const;
+	
+	/** \brief Cast ray against convex shape. Returns false if not supported. */
+	bool RayCastConvex(const btCollisionShape &shape, const btTransform &transform,
+		const btVector3 &rayFrom, const btVector3 &rayTo, decTList<sRayHit> &hits) const;
+	
+	/** \brief Cast ray against concave shape. Returns false if not supported. */
+	bool RayCastConcave(const btCollisionShape &shape, const btTransform &transform,
+		const btVector3 &rayFrom, const btVector3 &rayTo, decTList<sRayHit> &hits) const;
+	
+	/** \brief Cast ray against collision shape using bullet. */
+	void RayCastBullet(const btCollisionObject &colObj, const btCollisionShape &shape,
+		const btTransform &transform, const btVector3 &rayFrom, const btVector3 &rayTo,
+		decTList<sRayHit> &hits) const;
+	
 	/** \brief Test for collision using two collision volumes. */
 	void VolumeCastVolume(debpDCollisionVolume *castVolume, debpDCollisionVolume *hitVolume,
 		const btCollisionObjectWrapper *colObjWrap, const btTransform &castFromTrans,
@@ -33,7 +33,6 @@
 #include "../collider/debpColliderVolume.h"
 #include "../component/debpComponent.h"
 #include "../component/debpModel.h"
-#include "../component/debpModelOctree.h"
 #include "../shape/debpShape.h"
 
 #include <dragengine/resources/component/deComponent.h>
@@ -108,41 +107,42 @@ void debpCDVHitModelFace::SetTestCollider(debpCollider *collider){
 // Visiting
 /////////////
 
-void debpCDVHitModelFace::VisitNode(debpDOctree *node, int intersection){
-	if(!pHasCollision){
-		const debpModelOctree &rnode = *((debpModelOctree*)node);
-		int f, faceIndex, faceCount = rnode.GetFaceCount();
+void debpCDVHitModelFace::VisitFaces(const decTList<int> &faces){
+	if(pHasCollision){
+		return;
+	}
+	
+	int f, faceIndex, faceCount = faces.GetCount();
+	
+	if(pShape){
+		for(f=0; f<faceCount; f++){
+			faceIndex = faces.GetAt(f);
+			
+			if(pColDet->ShapeHitsModelFace(*pShape, *pComponent, faceIndex)){
+				pResult.shape1 = 0;
+				pResult.face = faceIndex;
+				pHasCollision = true;
+				break;
+			}
+		}
+		
+	}else if(pColliderVolume){
+		const debpShape::List &shapes = pColliderVolume->GetShapes();
+		int s, shapeCount = shapes.GetCount();
 		
-		if(pShape){
+		for(s=0; s<shapeCount && !pHasCollision; s++){
+			debpShape &shape = *shapes.GetAt(s);
+			
 			for(f=0; f<faceCount; f++){
-				faceIndex = rnode.GetFaceAt(f);
+				faceIndex = faces.GetAt(f);
 				
-				if(pColDet->ShapeHitsModelFace(*pShape, *pComponent, faceIndex)){
-					pResult.shape1 = 0;
+				if(pColDet->ShapeHitsModelFace(shape, *pComponent, faceIndex)){
+					pResult.shape1 = s;
 					pResult.face = faceIndex;
 					pHasCollision = true;
 					break;
 				}
 			}
-			
-		}else if(pColliderVolume){
-			const debpShape::List &shapes = pColliderVolume->GetShapes();
-			int s, shapeCount = shapes.GetCount();
-			
-			for(s=0; s<shapeCount; s++){
-				debpShape &shape = *shapes.GetAt(s);
-				
-				for(f=0; f<faceCount; f++){
-					faceIndex = rnode.GetFaceAt(f);
-					
-					if(pColDet->ShapeHitsModelFace(shape, *pComponent, faceIndex)){
-						pResult.shape1 = s;
-						pResult.face = faceIndex;
-						pHasCollision = true;
-						break;
-					}
-				}
-			}
 		}
 	}
 }
@@ -28,8 +28,8 @@
 
 // includes
 #include <dragengine/common/math/decMath.h>
+#include <dragengine/common/collection/decTList.h>
 #include "debpCollisionDetection.h"
-#include "octree/debpDOctreeVisitor.h"
 
 // predefinitions
 class debpShape;
@@ -43,9 +43,9 @@ class debpColliderComponent;
 /**
  * @brief Hit Model Face Visitor.
  * Visitor for the collision detection class to test for collision of
- * one or more shapes with faces of a model.
+ * one or more shapes with faces of a model found using the model face index.
  */
-class debpCDVHitModelFace : public debpDOctreeVisitor{
+class debpCDVHitModelFace{
 private:
 	debpCollisionDetection *pColDet;
 	
@@ -64,7 +64,7 @@ public:
 	/** Creates a new CLASS. */
 	debpCDVHitModelFace(debpCollisionDetection *coldet);
 	/** Cleans up the CLASS. */
-	~debpCDVHitModelFace() override;
+	~debpCDVHitModelFace();
 	/*@}*/
 	
 	/** @name Management */
@@ -86,8 +86,8 @@ public:
 	
 	/** @name Visiting */
 	/*@{*/
-	/** Visit a node. */
-	void VisitNode(debpDOctree *node, int intersection) override;
+	/** Visit faces. */
+	void VisitFaces(const decTList<int> &faces);
 	/*@}*/
 };
 
@@ -32,7 +32,6 @@
 #include "../collider/debpCollider.h"
 #include "../component/debpComponent.h"
 #include "../component/debpModel.h"
-#include "../component/debpModelOctree.h"
 #include "../shape/debpShape.h"
 
 #include <dragengine/resources/component/deComponent.h>
@@ -94,13 +93,12 @@ void debpCDVMoveHitModelFace::SetTestCollider(debpCollider *collider, const decD
 // Visiting
 /////////////
 
-void debpCDVMoveHitModelFace::VisitNode(debpDOctree *node, int intersection){
-	const debpModelOctree &rnode = *((debpModelOctree*)node);
-	int f, faceIndex, faceCount = rnode.GetFaceCount();
+void debpCDVMoveHitModelFace::VisitFaces(const decTList<int> &faces){
+	int f, faceIndex, faceCount = faces.GetCount();
 	
 	if(pShape){
 		for(f=0; f<faceCount; f++){
-			faceIndex = rnode.GetFaceAt(f);
+			faceIndex = faces.GetAt(f);
 			
 			if(pColDet->ShapeMoveHitsModelFace(*pShape, pDirection, *pComponent, faceIndex, pResultTest)){
 				if(!pHasCollision || pResultTest.distance < pResultFinal.distance){
@@ -117,7 +115,7 @@ void debpCDVMoveHitModelFace::VisitNode(debpDOctree *node, int intersection){
 		
 	}else if(pCollider){
 		for(f=0; f<faceCount; f++){
-			faceIndex = rnode.GetFaceAt(f);
+			faceIndex = faces.GetAt(f);
 			
 			if(pColDet->ColliderMoveHitsModelFace(pCollider, pDirection, *pComponent, faceIndex, pResultTest)){
 				if(!pHasCollision || pResultTest.distance < pResultFinal.distance){
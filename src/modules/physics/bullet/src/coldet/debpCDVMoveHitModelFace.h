@@ -28,8 +28,8 @@
 
 // includes
 #include <dragengine/common/math/decMath.h>
+#include <dragengine/common/collection/decTList.h>
 #include "debpCollisionDetection.h"
-#include "octree/debpDOctreeVisitor.h"
 
 // predefinitions
 class debpShape;
@@ -45,7 +45,7 @@ class debpColliderComponent;
  * Visitor for the collision detection class to test for collision of
  * one or more moving shapes with faces of a model.
  */
-class debpCDVMoveHitModelFace : public debpDOctreeVisitor{
+class debpCDVMoveHitModelFace{
 private:
 	debpCollisionDetection *pColDet;
 	
@@ -66,7 +66,7 @@ public:
 	/** Creates a new visitor. */
 	debpCDVMoveHitModelFace(debpCollisionDetection *coldet);
 	/** Cleans up the visitor. */
-	~debpCDVMoveHitModelFace() override;
+	~debpCDVMoveHitModelFace();
 	/*@}*/
 	
 	/** @name Management */
@@ -88,8 +88,8 @@ public:
 	
 	/** @name Visiting */
 	/*@{*/
-	/** Visit a node. */
-	void VisitNode(debpDOctree *node, int intersection) override;
+	/** Visit faces. */
+	void VisitFaces(const decTList<int> &faces);
 	/*@}*/
 };
 
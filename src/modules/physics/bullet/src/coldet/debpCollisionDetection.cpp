@@ -32,12 +32,10 @@
 #include "debpConvexResultCallback.h"
 #include "debpSweepCollisionTest.h"
 #include "debpContactResultCallback.h"
-#include "debpRayResultCallback.h"
 #include "debpPointContactCallback.h"
 #include "collision/debpDCollisionBox.h"
 #include "collision/debpDCollisionDetection.h"
 #include "collision/debpDCollisionTriangle.h"
-#include "octree/debpDefaultDOctree.h"
 #include "../dePhysicsBullet.h"
 #include "../collider/debpColliderBone.h"
 #include "../collider/debpColliderBones.h"
@@ -46,7 +44,6 @@
 #include "../collider/debpColliderRig.h"
 #include "../component/debpModel.h"
 #include "../component/debpComponent.h"
-#include "../component/debpModelOctree.h"
 #include "../terrain/heightmap/debpHeightTerrain.h"
 #include "../terrain/heightmap/debpHTSector.h"
 #include "../shape/debpShape.h"
@@ -95,6 +92,7 @@ debpCollisionDetection::debpCollisionDetection(dePhysicsBullet &bullet) :
 pBullet(bullet),
 pRayHackShape(*this),
 pShapeCollision(bullet),
+pRayCastBatch(bullet),
 pPointTestShape(NULL),
 pPointTestBulletColObj(NULL),
 pSharedCollisionFiltering(nullptr),
@@ -188,31 +186,42 @@ const decCollisionFilter &collisionFilter, deBaseScriptingCollider &listener){
 
 void debpCollisionDetection::RayHits(const decDVector &origin, const decDVector &direction,
 debpWorld &world, const decCollisionFilter &collisionFilter, deBaseScriptingCollider &listener){
-#define BULLET_RAY_CAST_UNSTABLE 1
+	// listeners can cast rays while hits are reported. use a temporary batch in this case
+	if(pRayCastBatch.GetRunning()){
+		debpRayCastBatch batch(pBullet);
+		batch.AddRay(origin, direction, &collisionFilter, listener);
+		RayHits(batch, world);
+		return;
+	}
+	
+	pRayCastBatch.RemoveAllRays();
+	pRayCastBatch.AddRay(origin, direction, &collisionFilter, listener);
+	RayHits(pRayCastBatch, world);
+}
+
+void debpCollisionDetection::RayHits(debpRayCastBatch &batch, debpWorld &world){
+	world.UpdateDynWorldAABBs();
+	world.GetDynamicsWorld()->safeRayTest(batch, *pColInfo);
+}
+
+void debpCollisionDetection::RayHitsSweep(const decDVector &origin, const decDVector &direction,
+debpWorld &world, const decCollisionFilter &collisionFilter, deBaseScriptingCollider &listener){
 	world.UpdateDynWorldAABBs();
 	
 	const btVector3 btRayFrom((btScalar)origin.x, (btScalar)origin.y, (btScalar)origin.z);
 	const decDVector rayTo = origin + direction;
 	const btVector3 btRayTo((btScalar)rayTo.x, (btScalar)rayTo.y, (btScalar)rayTo.z);
 	
-	#ifdef BULLET_RAY_CAST_UNSTABLE
-		// bullet has a broken ray-box test implementation using Gjk which has a tendency
-		// to miss collisions half of the time. as a quick fix a sweep test is done with
-		// a tiny sphere which yields a comparable result but is not prone to the problem
-		const btQuaternion btQuaterion(BT_ZERO, BT_ZERO, BT_ZERO, BT_ONE);
-		const btTransform btTransformFrom(btQuaterion, btRayFrom);
-		const btTransform btTransformTo(btQuaterion, btRayTo);
-		
-		debpConvexResultCallback result(pColInfo);
-		result.SetTestRay(&collisionFilter, &listener);
-		pRayHackShape.SweepTest(*world.GetDynamicsWorld(), btTransformFrom, btTransformTo, result);
-		
-	#else
-		debpRayResultCallback result(pColInfo);
-		result.SetTestRay(origin, direction, &collisionFilter, &listener);
-		
-		world.GetDynamicsWorld()->rayTest(btRayFrom, btRayTo, result);
-	#endif
+	// bullet has a broken ray-box test implementation using Gjk which has a tendency
+	// to miss collisions half of the time. as a quick fix a sweep test is done with
+	// a tiny sphere which yields a comparable result but is not prone to the problem
+	const btQuaternion btQuaterion(BT_ZERO, BT_ZERO, BT_ZERO, BT_ONE);
+	const btTransform btTransformFrom(btQuaterion, btRayFrom);
+	const btTransform btTransformTo(btQuaterion, btRayTo);
+	
+	debpConvexResultCallback result(pColInfo);
+	result.SetTestRay(&collisionFilter, &listener);
+	pRayHackShape.SweepTest(*world.GetDynamicsWorld(), btTransformFrom, btTransformTo, result);
 }
 
 void debpCollisionDetection::ColliderHits(debpCollider *collider, debpWorld *world, deBaseScriptingCollider *listener){
@@ -1836,6 +1845,7 @@ bool debpCollisionDetection::ShapeHitsColliderComponent(debpShape &shape, debpCo
 		/*
 		debpCDVHitModelFace visitor(this);
 		debpDCollisionBox box;
+		decTList<int> faces;
 		
 		component->PrepareMesh();
 		
@@ -1844,7 +1854,9 @@ bool debpCollisionDetection::ShapeHitsColliderComponent(debpShape &shape, debpCo
 		visitor.SetTestShape(shape);
 		
 		shape->GetCollisionVolume()->GetEnclosingBox(&box);
-		((debpModel*)component->GetModel()->GetPeerPhysics())->GetOctree()->VisitNodesColliding(&visitor, &box);
+		((debpModel*)component->GetModel()->GetPeerPhysics())->GetFaceIndex().QueryBox(
+			box.GetCenter() - box.GetHalfSize(), box.GetCenter() + box.GetHalfSize(), faces);
+		visitor.VisitFaces(faces);
 		
 		if(visitor.HasCollision()){
 			result.face = visitor.GetResult().face;
@@ -2083,7 +2095,7 @@ debpColliderComponent &collider2, debpCollisionResult &result){
 			collider1.GetParentWorld(), &collider1, collider2.GetColliderComponent()->GetComponent()->GetModel()
 				? collider2.GetColliderComponent()->GetComponent()->GetModel()->GetFilename() : "-"));
 		debpCDVHitModelFace visitor(this);
-		debpDCollisionBox box;
+		decTList<int> faces;
 		
 		component.PrepareMesh();
 		
@@ -2092,8 +2104,9 @@ debpColliderComponent &collider2, debpCollisionResult &result){
 		visitor.SetComponent(&component);
 		visitor.SetTestCollider(&collider1);
 		
-		box.SetFromExtends(collider1.GetShapeMinimumExtend(), collider1.GetShapeMaximumExtend());
-		component.GetModel()->GetOctree()->VisitNodesColliding(&visitor, &box);
+		component.GetModel()->GetFaceIndex().QueryBox(collider1.GetShapeMinimumExtend(),
+			collider1.GetShapeMaximumExtend(), faces);
+		visitor.VisitFaces(faces);
 		
 		if(visitor.HasCollision()){
 			debpCollisionResult &vresult = visitor.GetResult();
@@ -2378,6 +2391,7 @@ const decDVector &displacement, debpColliderComponent &collider2, debpCollisionR
 		const decDVector localdisp = collider2.GetInverseMatrix().TransformNormal(reldisp);
 		debpCDVMoveHitModelFace visitor(this);
 		debpDCollisionBox box;
+		decTList<int> faces;
 		
 		collider1.UpdateShapesWithMatrix(collider1.GetMatrix() * collider2.GetInverseMatrix());
 		
@@ -2385,7 +2399,9 @@ const decDVector &displacement, debpColliderComponent &collider2, debpCollisionR
 		visitor.SetTestCollider(&collider1, localdisp);
 		
 		GetColliderMoveBoundingBox(collider1, localdisp, box);
-		((debpModel*)engComponent.GetModel()->GetPeerPhysics())->GetOctree()->VisitNodesColliding(&visitor, &box);
+		((debpModel*)engComponent.GetModel()->GetPeerPhysics())->GetFaceIndex().QueryBox(
+			box.GetCenter() - box.GetHalfSize(), box.GetCenter() + box.GetHalfSize(), faces);
+		visitor.VisitFaces(faces);
 		
 		if(visitor.HasCollision()){
 			const debpCollisionResult &vresult = visitor.GetResult();
@@ -2660,6 +2676,7 @@ debpColliderComponent &collider2, debpCollisionResult &result){
 					? collider2.GetColliderComponent()->GetComponent()->GetModel()->GetFilename() : "-"));
 			debpCDVMoveHitModelFace visitor(this);
 			debpDCollisionBox box;
+			decTList<int> faces;
 			
 			collider1.UpdateShapesWithMatrix(collider1.GetMatrix() * collider2.GetInverseMatrix());
 			
@@ -2667,7 +2684,9 @@ debpColliderComponent &collider2, debpCollisionResult &result){
 			visitor.SetTestCollider(&collider1, displacement);
 			
 			GetColliderMoveBoundingBox(collider1, displacement, box);
-			((debpModel*)engComponent.GetModel()->GetPeerPhysics())->GetOctree()->VisitNodesColliding(&visitor, &box);
+			((debpModel*)engComponent.GetModel()->GetPeerPhysics())->GetFaceIndex().QueryBox(
+				box.GetCenter() - box.GetHalfSize(), box.GetCenter() + box.GetHalfSize(), faces);
+			visitor.VisitFaces(faces);
 			
 			collider1.UpdateShapes();
 			
@@ -27,6 +27,7 @@
 
 #include "debpSweepCollisionTest.h"
 #include "debpBulletShapeCollision.h"
+#include "debpRayCastBatch.h"
 #include "../shape/debpShapeTransform.h"
 
 #include <dragengine/common/math/decMath.h>
@@ -106,6 +107,7 @@ private:
 	debpShapeTransform pShape2;
 	debpSweepCollisionTest pRayHackShape;
 	debpBulletShapeCollision pShapeCollision;
+	debpRayCastBatch pRayCastBatch;
 	
 	btSphereShape *pPointTestShape;
 	btCollisionObject *pPointTestBulletColObj;
@@ -159,6 +161,19 @@ public:
 	void RayHits(const decDVector &origin, const decDVector &direction, debpWorld &world,
 	const decCollisionFilter &collisionFilter, deBaseScriptingCollider &listener);
 	
+	/**
+	 * Tests a batch of rays for collisions with world elements. For each hit the listener of
+	 * the ray is invoked and the collision detection of the ray stopped if requested by the user.
+	 */
+	void RayHits(debpRayCastBatch &batch, debpWorld &world);
+	
+	/**
+	 * Tests a ray for collisions with world elements by sweeping a tiny sphere. This has been
+	 * the ray test before exact ray testing has been added. Kept for benchmarking.
+	 */
+	void RayHitsSweep(const decDVector &origin, const decDVector &direction, debpWorld &world,
+	const decCollisionFilter &collisionFilter, deBaseScriptingCollider &listener);
+	
 	/**
 	 * Tests a collider for collisions with colliders in a world. For each hit the
 	 * listener is invoked and the collision detection stopped if requested by the user.
@@ -0,0 +1,122 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "debpConvexHullShape.h"
+
+#include <LinearMath/btConvexHullComputer.h>
+
+
+// Class debpConvexHullShape
+//////////////////////////////
+
+// Constructor, destructor
+////////////////////////////
+
+debpConvexHullShape::debpConvexHullShape() :
+pRayPlanesPointCount(-1),
+pRayPlanesScaling(BT_ZERO, BT_ZERO, BT_ZERO){
+}
+
+debpConvexHullShape::~debpConvexHullShape(){
+}
+
+
+
+// Management
+///////////////
+
+bool debpConvexHullShape::GetRayPlanesValid() const{
+	return pRayPlanesPointCount == getNumPoints() && pRayPlanesScaling == getLocalScaling();
+}
+
+void debpConvexHullShape::UpdateRayPlanes(){
+	if(GetRayPlanesValid()){
+		return;
+	}
+	
+	pRayPlanes.SetCountDiscard(0);
+	pRayPlanesPointCount = getNumPoints();
+	pRayPlanesScaling = getLocalScaling();
+	
+	if(pRayPlanesPointCount < 4){
+		return;
+	}
+	
+	btAlignedObjectArray<btVector3> points;
+	points.resize(pRayPlanesPointCount);
+	
+	int i;
+	for(i=0; i<pRayPlanesPointCount; i++){
+		points[i] = getScaledPoint(i);
+	}
+	
+	btConvexHullComputer computer;
+	computer.compute(&points[0].getX(), sizeof(btVector3), pRayPlanesPointCount, BT_ZERO, BT_ZERO);
+	
+	const int vertexCount = computer.vertices.size();
+	const int faceCount = computer.faces.size();
+	if(vertexCount < 4 || faceCount < 4){
+		return;
+	}
+	
+	decDVector center;
+	for(i=0; i<vertexCount; i++){
+		const btVector3 &v = computer.vertices[i];
+		center += decDVector((double)v.getX(), (double)v.getY(), (double)v.getZ());
+	}
+	center /= (double)vertexCount;
+	
+	// face normals are calculated using newell's method which is robust for nearly
+	// degenerated faces. the orientation is verified against the hull center
+	for(i=0; i<faceCount; i++){
+		const btConvexHullComputer::Edge * const firstEdge = &computer.edges[computer.faces[i]];
+		const btConvexHullComputer::Edge *edge = firstEdge;
+		decDVector normal, faceCenter;
+		int cornerCount = 0;
+		
+		do{
+			const btVector3 &v1 = computer.vertices[edge->getSourceVertex()];
+			const btVector3 &v2 = computer.vertices[edge->getTargetVertex()];
+			normal.x += ((double)v1.getY() - (double)v2.getY()) * ((double)v1.getZ() + (double)v2.getZ());
+			normal.y += ((double)v1.getZ() - (double)v2.getZ()) * ((double)v1.getX() + (double)v2.getX());
+			normal.z += ((double)v1.getX() - (double)v2.getX()) * ((double)v1.getY() + (double)v2.getY());
+			faceCenter += decDVector((double)v1.getX(), (double)v1.getY(), (double)v1.getZ());
+			cornerCount++;
+			edge = edge->getNextEdgeOfFace();
+		}while(edge != firstEdge);
+		
+		const double length = normal.Length();
+		if(length < 1e-12){
+			continue;
+		}
+		
+		normal /= length;
+		faceCenter /= (double)cornerCount;
+		if(normal * (faceCenter - center) < 0.0){
+			normal = -normal;
+		}
+		
+		pRayPlanes.Add(sPlane{normal, normal * faceCenter});
+	}
+}
@@ -0,0 +1,88 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DEBPCONVEXHULLSHAPE_H_
+#define _DEBPCONVEXHULLSHAPE_H_
+
+#include <dragengine/common/collection/decTList.h>
+#include <dragengine/common/math/decMath.h>
+
+#include <BulletCollision/CollisionShapes/btConvexHullShape.h>
+
+
+/**
+ * \brief Convex hull shape with ray cast support.
+ * 
+ * Extends btConvexHullShape with a set of face planes used for exact ray casting.
+ * Bullet only provides face planes by initializing polyhedral features which changes
+ * how bullet calculates contacts. The planes are stored along the shape instead.
+ * 
+ * The planes are updated by UpdateRayPlanes if points or scaling changed since the
+ * last update. Call UpdateRayPlanes only from the main thread.
+ */
+ATTRIBUTE_ALIGNED16(class) debpConvexHullShape : public btConvexHullShape{
+public:
+	/** \brief Face plane. Points with normal * point <= distance are inside. */
+	struct sPlane{
+		decDVector normal;
+		double distance;
+	};
+	
+	
+	
+private:
+	decTList<sPlane> pRayPlanes;
+	int pRayPlanesPointCount;
+	btVector3 pRayPlanesScaling;
+	
+	
+	
+public:
+	BT_DECLARE_ALIGNED_ALLOCATOR();
+	
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/** \brief Create convex hull shape. */
+	debpConvexHullShape();
+	
+	/** \brief Clean up convex hull shape. */
+	~debpConvexHullShape() override;
+	/*@}*/
+	
+	
+	
+	/** \name Management */
+	/*@{*/
+	/** \brief Face planes. */
+	inline const decTList<sPlane> &GetRayPlanes() const{ return pRayPlanes; }
+	
+	/** \brief Face planes match the current points and scaling. */
+	bool GetRayPlanesValid() const;
+	
+	/** \brief Update face planes if points or scaling changed. */
+	void UpdateRayPlanes();
+	/*@}*/
+};
+
+#endif
@@ -0,0 +1,368 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "debpRayCastBatch.h"
+#include "debpRayCastTask.h"
+#include "debpCollisionDetection.h"
+#include "../dePhysicsBullet.h"
+#include "../debpCollisionObject.h"
+#include "../collider/debpCollider.h"
+#include "../terrain/heightmap/debpHTSector.h"
+#include "../terrain/heightmap/debpHeightTerrain.h"
+#include "../world/debpCollisionWorld.h"
+
+#include <BulletCollision/BroadphaseCollision/btDbvt.h>
+#include <BulletCollision/BroadphaseCollision/btDbvtBroadphase.h>
+#include <BulletCollision/CollisionDispatch/btCollisionObject.h>
+#include <BulletCollision/CollisionShapes/btCollisionShape.h>
+#include <LinearMath/btAabbUtil2.h>
+
+#include <dragengine/deEngine.h>
+#include <dragengine/common/exceptions.h>
+#include <dragengine/parallel/deParallelProcessing.h>
+#include <dragengine/resources/collider/deCollider.h>
+#include <dragengine/resources/collider/deCollisionInfo.h>
+#include <dragengine/resources/terrain/heightmap/deHeightTerrain.h>
+#include <dragengine/systems/modules/scripting/deBaseScriptingCollider.h>
+
+
+// count of candidates cast by one parallel task
+const int vCastTaskChunkSize = 256;
+
+
+// Class debpRayCastBatch
+///////////////////////////
+
+// Constructor, destructor
+////////////////////////////
+
+debpRayCastBatch::debpRayCastBatch(dePhysicsBullet &bullet) :
+pBullet(bullet),
+pRunning(false){
+}
+
+debpRayCastBatch::~debpRayCastBatch(){
+}
+
+
+
+// Management
+///////////////
+
+void debpRayCastBatch::AddRay(const decDVector &origin, const decDVector &direction,
+const decCollisionFilter *collisionFilter, deBaseScriptingCollider &listener){
+	if(pRunning){
+		DETHROW(deeInvalidAction);
+	}
+	pRays.Add(sRay{origin, direction, collisionFilter, &listener});
+}
+
+void debpRayCastBatch::RemoveAllRays(){
+	if(pRunning){
+		DETHROW(deeInvalidAction);
+	}
+	pRays.SetCountDiscard(0);
+}
+
+void debpRayCastBatch::RemoveRayListener(int index){
+	pRays.GetAt(index).listener = nullptr;
+}
+
+void debpRayCastBatch::RayTest(debpCollisionWorld &world, deCollisionInfo &colInfo){
+	if(pRunning){
+		DETHROW(deeInvalidAction);
+	}
+	if(pRays.IsEmpty()){
+		return;
+	}
+	
+	btDbvtBroadphase * const broadphase = dynamic_cast<btDbvtBroadphase*>(world.getBroadphase());
+	DEASSERT_NOTNULL(broadphase)
+	
+	pRunning = true;
+	
+	try{
+		pPrepareRays();
+		
+		// traverse the dynamic and static broadphase tree with all rays at the same time
+		const int rayCount = pRays.GetCount();
+		int i, j;
+		
+		pCandidates.SetCountDiscard(0);
+		
+		for(i=0; i<2; i++){
+			const btDbvtNode * const root = broadphase->m_sets[i].m_root;
+			if(!root){
+				continue;
+			}
+			
+			pTraverseRays.SetCountDiscard(0);
+			for(j=0; j<rayCount; j++){
+				pTraverseRays.Add(j);
+			}
+			pGatherCandidates(*root, 0, rayCount);
+		}
+		
+		pCastCandidates();
+		pReportHits(colInfo);
+		pRunning = false;
+		
+	}catch(const deException &){
+		pRunning = false;
+		throw;
+	}
+}
+
+void debpRayCastBatch::CastCandidates(int first, int count, decTList<sHit> &hits,
+decTList<debpBulletShapeCollision::sRayHit> &castHits) const{
+	const debpBulletShapeCollision &shapeCollision =
+		pBullet.GetCollisionDetection().GetBulletShapeCollision();
+	const int last = first + count;
+	int i, j;
+	
+	for(i=first; i<last; i++){
+		const sCandidate &candidate = pCandidates.GetAt(i);
+		const sRayBounds &bounds = pRayBounds.GetAt(candidate.ray);
+		
+		castHits.SetCountDiscard(0);
+		shapeCollision.RayCast(*candidate.colObj, bounds.from, bounds.to, castHits);
+		
+		const int hitCount = castHits.GetCount();
+		for(j=0; j<hitCount; j++){
+			hits.Add(sHit{i, 0, castHits.GetAt(j)});
+		}
+	}
+}
+
+
+
+// Private Functions
+//////////////////////
+
+void debpRayCastBatch::pPrepareRays(){
+	const int count = pRays.GetCount();
+	int i, j;
+	
+	pRayBounds.SetCountDiscard(0);
+	
+	for(i=0; i<count; i++){
+		const sRay &ray = pRays.GetAt(i);
+		const decDVector rayTo(ray.origin + ray.direction);
+		
+		sRayBounds bounds;
+		bounds.from.setValue((btScalar)ray.origin.x, (btScalar)ray.origin.y, (btScalar)ray.origin.z);
+		bounds.to.setValue((btScalar)rayTo.x, (btScalar)rayTo.y, (btScalar)rayTo.z);
+		
+		// bounding box tests use the full ray length in the range from 0 to 1
+		const btVector3 direction(bounds.to - bounds.from);
+		for(j=0; j<3; j++){
+			bounds.invDirection[j] = direction[j] == BT_ZERO ? (btScalar)BT_LARGE_FLOAT : BT_ONE / direction[j];
+			bounds.sign[j] = bounds.invDirection[j] < BT_ZERO;
+		}
+		
+		pRayBounds.Add(bounds);
+	}
+}
+
+void debpRayCastBatch::pGatherCandidates(const btDbvtNode &node, int first, int count){
+	// rays hitting the node bounding box are appended to the traverse list and removed
+	// again once the node is done. this keeps the list as a stack of ray lists
+	const btVector3 bounds[2] = {node.volume.Mins(), node.volume.Maxs()};
+	const int hitFirst = pTraverseRays.GetCount();
+	const int last = first + count;
+	btScalar tmin;
+	int i;
+	
+	for(i=first; i<last; i++){
+		const int index = pTraverseRays.GetAt(i);
+		const sRayBounds &ray = pRayBounds.GetAt(index);
+		if(btRayAabb2(ray.from, ray.invDirection, ray.sign, bounds, tmin, BT_ZERO, BT_ONE)){
+			pTraverseRays.Add(index);
+		}
+	}
+	
+	const int hitCount = pTraverseRays.GetCount() - hitFirst;
+	if(hitCount == 0){
+		return;
+	}
+	
+	if(node.isinternal()){
+		pGatherCandidates(*node.childs[0], hitFirst, hitCount);
+		pGatherCandidates(*node.childs[1], hitFirst, hitCount);
+		
+	}else{
+		const btBroadphaseProxy &proxy = *((const btBroadphaseProxy*)node.data);
+		btCollisionObject * const colObj = (btCollisionObject*)proxy.m_clientObject;
+		bool prepared = false;
+		
+		for(i=0; i<hitCount; i++){
+			const int index = pTraverseRays.GetAt(hitFirst + i);
+			if(!pNeedsCollision(pRays.GetAt(index), proxy)){
+				continue;
+			}
+			
+			if(!prepared){
+				pBullet.GetCollisionDetection().GetBulletShapeCollision()
+					.PrepareRayCast(*colObj->getCollisionShape());
+				prepared = true;
+			}
+			
+			pCandidates.Add(sCandidate{index, colObj});
+		}
+	}
+	
+	pTraverseRays.SetCount(hitFirst);
+}
+
+bool debpRayCastBatch::pNeedsCollision(const sRay &ray, const btBroadphaseProxy &proxy) const{
+	// listener has been removed while testing
+	if(!ray.listener){
+		return false;
+	}
+	
+	// basic bullet filtering using the default ray filter group and mask
+	if((proxy.m_collisionFilterGroup & btBroadphaseProxy::AllFilter) == 0
+	|| (btBroadphaseProxy::DefaultFilter & proxy.m_collisionFilterMask) == 0){
+		return false;
+	}
+	
+	// determine the collision partner using the custom pointer
+	const btCollisionObject &collisionObject = *((const btCollisionObject*)proxy.m_clientObject);
+	const debpCollisionObject &colObj = *((const debpCollisionObject*)collisionObject.getUserPointer());
+	
+	// test against a collider
+	if(colObj.IsOwnerCollider()){
+		deCollider * const engCollider = &colObj.GetOwnerCollider()->GetCollider();
+		
+		// check if a collision is possible according to layer mask
+		if(ray.collisionFilter && ray.collisionFilter->CollidesNot(engCollider->GetCollisionFilter())){
+			return false;
+		}
+		
+		// check if a collision is possible according to the collider listener
+		return ray.listener->CanHitCollider(nullptr, engCollider);
+		
+	// test against a height terrain sector
+	}else if(colObj.IsOwnerHTSector()){
+		return !ray.collisionFilter || !ray.collisionFilter->CollidesNot(colObj.GetOwnerHTSector()
+			->GetHeightTerrain()->GetHeightTerrain()->GetCollisionFilter());
+	}
+	
+	// all other combinations score no collision
+	return false;
+}
+
+void debpRayCastBatch::pCastCandidates(){
+	const int candidateCount = pCandidates.GetCount();
+	deParallelProcessing &parallel = pBullet.GetGameEngine()->GetParallelProcessing();
+	
+	pHits.SetCountDiscard(0);
+	
+	// exact ray tests are cheap. using tasks for small batches costs more than it gains
+	if(candidateCount < vCastTaskChunkSize * 2 || parallel.GetPaused()){
+		CastCandidates(0, candidateCount, pHits, pCastHits);
+		
+	}else{
+		decTList<debpRayCastTask::Ref> tasks;
+		int first;
+		
+		for(first=0; first<candidateCount; first+=vCastTaskChunkSize){
+			const debpRayCastTask::Ref task(debpRayCastTask::Ref::New(pBullet, *this,
+				first, decMath::min(vCastTaskChunkSize, candidateCount - first)));
+			tasks.Add(task);
+			parallel.AddTaskAsync(task);
+		}
+		
+		// merge in task order to keep the hit order independent of task scheduling
+		tasks.Visit([&](const debpRayCastTask::Ref &task){
+			parallel.WaitForTask(task);
+			pHits += task->GetHits();
+		});
+	}
+	
+	const int hitCount = pHits.GetCount();
+	int i;
+	for(i=0; i<hitCount; i++){
+		pHits.GetAt(i).order = i;
+	}
+}
+
+void debpRayCastBatch::pReportHits(deCollisionInfo &colInfo){
+	pHits.Sort([&](const sHit &a, const sHit &b){
+		const int rayA = pCandidates.GetAt(a.candidate).ray;
+		const int rayB = pCandidates.GetAt(b.candidate).ray;
+		if(rayA != rayB){
+			return rayA < rayB ? -1 : 1;
+		}
+		if(a.hit.distance != b.hit.distance){
+			return a.hit.distance < b.hit.distance ? -1 : 1;
+		}
+		return a.order < b.order ? -1 : (a.order > b.order ? 1 : 0);
+	});
+	
+	const int hitCount = pHits.GetCount();
+	int lastRay = -1;
+	bool stopped = false;
+	int i;
+	
+	for(i=0; i<hitCount; i++){
+		const sHit &hit = pHits.GetAt(i);
+		const sCandidate &candidate = pCandidates.GetAt(hit.candidate);
+		
+		if(candidate.ray != lastRay){
+			lastRay = candidate.ray;
+			colInfo.SetStopTesting(false);
+			stopped = false;
+			
+		}else if(stopped){
+			continue;
+		}
+		
+		deBaseScriptingCollider * const listener = pRays.GetAt(candidate.ray).listener;
+		if(!listener){
+			continue;
+		}
+		
+		const debpCollisionObject &colObj = *((const debpCollisionObject*)candidate.colObj->getUserPointer());
+		
+		if(colObj.IsOwnerCollider()){
+			colInfo.SetCollider(&colObj.GetOwnerCollider()->GetCollider(), colObj.GetOwnerBone(),
+				(int)(intptr_t)hit.hit.shape->getUserPointer() - 1, -1);
+			
+		}else if(colObj.IsOwnerHTSector()){
+			const debpHTSector &htsector = *colObj.GetOwnerHTSector();
+			colInfo.SetHTSector(htsector.GetHeightTerrain()->GetHeightTerrain(), htsector.GetSector());
+			
+		}else{
+			continue;
+		}
+		
+		colInfo.SetDistance(hit.hit.distance);
+		colInfo.SetNormal(hit.hit.normal);
+		
+		listener->CollisionResponse(nullptr, &colInfo);
+		
+		stopped = colInfo.GetStopTesting();
+	}
+}
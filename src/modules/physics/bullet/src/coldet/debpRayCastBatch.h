@@ -0,0 +1,178 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DEBPRAYCASTBATCH_H_
+#define _DEBPRAYCASTBATCH_H_
+
+#include "debpBulletShapeCollision.h"
+
+#include <dragengine/common/collection/decTList.h>
+#include <dragengine/common/math/decMath.h>
+
+#include <LinearMath/btVector3.h>
+
+class dePhysicsBullet;
+class debpCollisionWorld;
+class deBaseScriptingCollider;
+class deCollisionInfo;
+class decCollisionFilter;
+class btBroadphaseProxy;
+class btCollisionObject;
+struct btDbvtNode;
+
+
+/**
+ * \brief Batch of rays cast against a collision world.
+ * 
+ * Casts all rays in a single call. The broadphase is traversed once for all rays
+ * together collecting pairs of rays and collision objects. The pairs are then tested
+ * using the exact ray tests of debpBulletShapeCollision. Large batches are split into
+ * parallel tasks. Filtering and hit reporting is always done on the calling thread.
+ * 
+ * Hits are reported for each ray in the order the rays have been added. The hits of a
+ * ray are sorted by distance. The order does not depend on parallel processing.
+ */
+class debpRayCastBatch{
+public:
+	/** \brief Ray to cast. */
+	struct sRay{
+		decDVector origin;
+		decDVector direction;
+		const decCollisionFilter *collisionFilter;
+		deBaseScriptingCollider *listener;
+	};
+	
+	/** \brief Pair of ray and collision object passing the broadphase. */
+	struct sCandidate{
+		int ray;
+		const btCollisionObject *colObj;
+	};
+	
+	/** \brief Ray hit on a candidate. */
+	struct sHit{
+		int candidate;
+		int order;
+		debpBulletShapeCollision::sRayHit hit;
+	};
+	
+	
+	
+private:
+	/** \brief Ray prepared for broadphase testing. */
+	struct sRayBounds{
+		btVector3 from;
+		btVector3 to;
+		btVector3 invDirection;
+		unsigned int sign[3];
+	};
+	
+	dePhysicsBullet &pBullet;
+	
+	decTList<sRay> pRays;
+	decTList<sRayBounds> pRayBounds;
+	decTList<int> pTraverseRays;
+	decTList<sCandidate> pCandidates;
+	decTList<sHit> pHits;
+	decTList<debpBulletShapeCollision::sRayHit> pCastHits;
+	bool pRunning;
+	
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/** \brief Create ray cast batch. */
+	debpRayCastBatch(dePhysicsBullet &bullet);
+	
+	/** \brief Clean up ray cast batch. */
+	~debpRayCastBatch();
+	/*@}*/
+	
+	
+	
+	/** \name Management */
+	/*@{*/
+	/** \brief Bullet module. */
+	inline dePhysicsBullet &GetBullet() const{ return pBullet; }
+	
+	/** \brief Count of rays. */
+	inline int GetRayCount() const{ return pRays.GetCount(); }
+	
+	/** \brief Ray at index. */
+	inline const sRay &GetRayAt(int index) const{ return pRays.GetAt(index); }
+	
+	/**
+	 * \brief Add ray.
+	 * \param[in] origin Ray origin.
+	 * \param[in] direction Ray direction. Length of direction is the ray length.
+	 * \param[in] collisionFilter Collision filter or nullptr to hit everything.
+	 * \param[in] listener Listener to call for each hit of the ray.
+	 */
+	void AddRay(const decDVector &origin, const decDVector &direction,
+		const decCollisionFilter *collisionFilter, deBaseScriptingCollider &listener);
+	
+	/** \brief Remove all rays. */
+	void RemoveAllRays();
+	
+	/**
+	 * \brief Remove listener of ray.
+	 * 
+	 * The ray is kept but is ignored while testing. Can be called while rays are cast
+	 * to drop listeners deleted from inside listener calls.
+	 */
+	void RemoveRayListener(int index);
+	
+	/** \brief Rays are cast right now. */
+	inline bool GetRunning() const{ return pRunning; }
+	
+	/**
+	 * \brief Cast rays against collision world.
+	 * 
+	 * For each hit the listener of the ray is called. To stop testing the ray set
+	 * StopTesting in the provided collision information object to true.
+	 * 
+	 * \warning Not protected against modifications by listeners. Use
+	 *          debpCollisionWorld::safeRayTest instead.
+	 */
+	void RayTest(debpCollisionWorld &world, deCollisionInfo &colInfo);
+	
+	/**
+	 * \brief Cast rays of candidates adding hits.
+	 * \note Safe to be called from parallel tasks.
+	 */
+	void CastCandidates(int first, int count, decTList<sHit> &hits,
+		decTList<debpBulletShapeCollision::sRayHit> &castHits) const;
+	/*@}*/
+	
+	
+	
+private:
+	void pPrepareRays();
+	void pGatherCandidates(const btDbvtNode &node, int first, int count);
+	bool pNeedsCollision(const sRay &ray, const btBroadphaseProxy &proxy) const;
+	void pCastCandidates();
+	void pReportHits(deCollisionInfo &colInfo);
+};
+
+#endif
@@ -0,0 +1,73 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "debpRayCastTask.h"
+#include "../dePhysicsBullet.h"
+
+
+// Class debpRayCastTask
+//////////////////////////
+
+// Constructor, destructor
+////////////////////////////
+
+debpRayCastTask::debpRayCastTask(dePhysicsBullet &bullet, const debpRayCastBatch &batch,
+	int first, int count) :
+deParallelTask(&bullet),
+pBatch(batch),
+pFirst(first),
+pCount(count){
+}
+
+debpRayCastTask::~debpRayCastTask(){
+}
+
+
+
+// Management
+///////////////
+
+void debpRayCastTask::Run(){
+	if(!IsCancelled()){
+		pBatch.CastCandidates(pFirst, pCount, pHits, pCastHits);
+	}
+}
+
+void debpRayCastTask::Finished(){
+}
+
+
+
+// Debugging
+//////////////
+
+decString debpRayCastTask::GetDebugName() const{
+	return "Bullet-RayCast";
+}
+
+decString debpRayCastTask::GetDebugDetails() const{
+	decString details;
+	details.Format("first=%d count=%d", pFirst, pCount);
+	return details;
+}
@@ -0,0 +1,95 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DEBPRAYCASTTASK_H_
+#define _DEBPRAYCASTTASK_H_
+
+#include "debpRayCastBatch.h"
+
+#include <dragengine/parallel/deParallelTask.h>
+
+class dePhysicsBullet;
+
+
+/**
+ * \brief Parallel task casting a chunk of ray cast batch candidates.
+ * 
+ * Only the thread safe ray testing is done. Hits are stored in the task and have to be
+ * reported afterwards in the main thread.
+ */
+class debpRayCastTask : public deParallelTask{
+public:
+	/** \brief Type holding strong reference. */
+	using Ref = deTThreadSafeObjectReference<debpRayCastTask>;
+	
+	
+private:
+	const debpRayCastBatch &pBatch;
+	const int pFirst;
+	const int pCount;
+	
+	decTList<debpRayCastBatch::sHit> pHits;
+	decTList<debpBulletShapeCollision::sRayHit> pCastHits;
+	
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/** \brief Create task. */
+	debpRayCastTask(dePhysicsBullet &bullet, const debpRayCastBatch &batch, int first, int count);
+	
+protected:
+	/** \brief Clean up task. */
+	~debpRayCastTask() override;
+	/*@}*/
+	
+	
+	
+public:
+	/** \name Management */
+	/*@{*/
+	/** \brief Hits found by the task. */
+	inline const decTList<debpRayCastBatch::sHit> &GetHits() const{ return pHits; }
+	
+	/** \brief Parallel task implementation. */
+	void Run() override;
+	
+	/** \brief Processing of task Run() finished. */
+	void Finished() override;
+	/*@}*/
+	
+	
+	
+	/** \name Debugging */
+	/*@{*/
+	/** \brief Short task name for debugging. */
+	decString GetDebugName() const override;
+	
+	/** \brief Task details for debugging. */
+	decString GetDebugDetails() const override;
+	/*@}*/
+};
+
+#endif
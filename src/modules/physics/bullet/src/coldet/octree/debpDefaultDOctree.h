@@ -1,89 +0,0 @@
-/*
- * MIT License
- *
- * Copyright (C) 2024, DragonDreams GmbH (info@dragondreams.ch)
- *
- * Permission is hereby granted, free of charge, to any person obtaining a copy
- * of this software and associated documentation files (the "Software"), to deal
- * in the Software without restriction, including without limitation the rights
- * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
- * copies of the Software, and to permit persons to whom the Software is
- * furnished to do so, subject to the following conditions:
- *
- * The above copyright notice and this permission notice shall be included in all
- * copies or substantial portions of the Software.
- *
- * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
- * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
- * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
- * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
- * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
- * SOFTWARE.
- */
-
-#ifndef _DEBPDEFAULTDOCTREE_H_
-#define _DEBPDEFAULTDOCTREE_H_
-
-#include "debpDOctree.h"
-
-#include <dragengine/common/collection/decTList.h>
-
-#define DEBPDO_MAX_DEPTH 8
-
-
-
-/**
- * @brief Default Octree Implementation.
- * Default implementation of the octree storing a list of objects.
- */
-class debpDefaultDOctree : public debpDOctree{
-private:
-	decTList<void*> pElements;
-	
-public:
-	/** @name Constructors and Destructors */
-	/*@{*/
-	/** Creates a new generic octree object. */
-	debpDefaultDOctree(const decDVector &center, const decDVector &halfSize);
-	/** Cleans up the generic octree object. */
-	~debpDefaultDOctree() override;
-	/*@}*/
-	
-	/** @name Management */
-	/*@{*/
-	/**
-	 * Creates new octree for the specified octant. Implement this function
-	 * to create a new octree of your own type. Do not set the parent of
-	 * octree. The caller is responsible for this action if applicable.
-	 */
-	debpDOctree *CreateOctree(int octant) const override;
-	/** Clears the content of this node. */
-	void ClearNodeContent() override;
-	/**
-	 * Adds a new object to the octree. The object is placed in the node
-	 * which hosts the specified box. Returns the node where the element
-	 * has been placed into.
-	 */
-	debpDefaultDOctree *InsertIntoTree(void *element, const decDVector &boxCenter, const decDVector &boxHalfSize, int maxDepth = DEBPDO_MAX_DEPTH);
-	/*@}*/
-	
-	/** @name Elements */
-	/*@{*/
-	/** Retrieves the number of elements. */
-	inline int GetElementCount() const{ return pElements.GetCount(); }
-	/** Retrieves the element at the given index. */
-	void *GetElementAt(int index) const;
-	/** Retrieves the index of the given element or -1 if not found. */
-	int IndexOfElement(void *element) const;
-	/** Adds a element. */
-	void AddElement(void *element);
-	/** Removes a element. */
-	void RemoveElement(void *element);
-	/** Removes all elements. */
-	void RemoveAllElements();
-	/*@}*/
-};
-
-// end of include only once
-#endif
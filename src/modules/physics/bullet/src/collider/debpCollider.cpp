@@ -182,6 +182,9 @@ void debpCollider::SetParentWorld(debpWorld *parentWorld){
 	if(pParentWorld){
 		UnregisterUpdateOctree();
 		UnregisterPPCProcessing();
+		pCollisionTests.Visit([&](debpColliderCollisionTest *test){
+			pParentWorld->pPPCTRayBatchTestRemove(test);
+		});
 		UnregisterColDetFinish();
 		UnregisterColDetPrepare();
 		
@@ -396,12 +399,17 @@ void debpCollider::CheckColliderConstraintsBroke(){
 
 
 
-void debpCollider::ProcessColliderCollisionTests(){
+void debpCollider::ProcessColliderCollisionTests(debpRayCastBatch &rayBatch,
+decTList<debpColliderCollisionTest*> &batchedTests){
 	const int count = pCollisionTests.GetCount();
 	int i;
 	
 	for(i=0; i<count; i++){
-		pCollisionTests.GetAt(i)->Update();
+		debpColliderCollisionTest * const test = pCollisionTests.GetAt(i);
+		if(test->Update(rayBatch)){
+			test->SetRayBatchIndex(batchedTests.GetCount());
+			batchedTests.Add(test);
+		}
 	}
 }
 
@@ -39,6 +39,7 @@ class debpColliderConstraint;
 class debpColliderRig;
 class debpColliderVolume;
 class debpCollisionWorld;
+class debpRayCastBatch;
 class debpWorld;
 class debpTouchSensor;
 class debpCollisionTest;
@@ -229,8 +230,15 @@ public:
 	/** Check if collider constraints broke and notify the scripting module if required. */
 	void CheckColliderConstraintsBroke();
 	
-	/** Process collider collision tests. */
-	void ProcessColliderCollisionTests();
+	/**
+	 * Process collider collision tests.
+	 * 
+	 * Ray tests are added to \em rayBatch and the tests are appended to \em batchedTests.
+	 * The ray batch index of these tests is set to their index in \em batchedTests.
+	 * Once \em rayBatch has been tested SetCollisionTestResult() has to be called on them.
+	 */
+	void ProcessColliderCollisionTests(debpRayCastBatch &rayBatch,
+		decTList<debpColliderCollisionTest*> &batchedTests);
 	
 	
 	
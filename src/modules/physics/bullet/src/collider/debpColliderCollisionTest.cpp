@@ -28,6 +28,7 @@
 #include "debpColliderCollisionTest.h"
 #include "debpCollider.h"
 #include "debpColliderComponent.h"
+#include "../coldet/debpRayCastBatch.h"
 #include "../component/debpComponent.h"
 #include "../world/debpWorld.h"
 #include "../dePhysicsBullet.h"
@@ -60,10 +61,15 @@ debpColliderCollisionTest::debpColliderCollisionTest(
 debpCollider &parentCollider, deColliderCollisionTest &collisionTest) :
 pParentCollider(parentCollider),
 pCollisionTest(collisionTest),
-pSortByDistance(false){
+pSortByDistance(false),
+pRayBatchIndex(-1){
 }
 
 debpColliderCollisionTest::~debpColliderCollisionTest(){
+	// scripts can remove the test while the post physics ray batch is cast
+	if(pParentCollider.GetParentWorld()){
+		pParentCollider.GetParentWorld()->pPPCTRayBatchTestRemove(this);
+	}
 }
 
 
@@ -75,58 +81,13 @@ void debpColliderCollisionTest::CollisionTestChanged(){
 }
 
 void debpColliderCollisionTest::Update(){
-	if(!pCollisionTest.GetEnabled()){
+	decDVector position;
+	decQuaternion orientation;
+	decVector direction;
+	if(!pUpdateTestParameters(position, orientation, direction)){
 		return;
 	}
 	
-	const decDMatrix &matrix = pParentCollider.GetMatrix();
-	
-	// cast position altered by bone if existing. for the time being this is just
-	// done by preparing the matrices in the parent collider component if existing.
-	// this will be optimized later
-	decDVector position(pCollisionTest.GetOrigin());
-	decQuaternion orientation(pCollisionTest.GetOrientation());
-	decVector direction(pCollisionTest.GetDirection());
-	
-	if(!pCollisionTest.GetBone().IsEmpty()){
-		deComponent * const component = pCollisionTest.GetComponent();
-		
-		if(component){
-			deRig * const rig = component->GetRig();
-			
-			if(rig){
-				const int boneIndex = rig->IndexOfBoneNamed(pCollisionTest.GetBone());
-				
-				if(boneIndex != -1){
-					((debpComponent*)component->GetPeerPhysics())->PrepareBone(boneIndex);
-					
-					const decMatrix &boneMatrix = component->GetBoneAt(boneIndex).GetMatrix();
-					
-					position = decDVector(boneMatrix * pCollisionTest.GetOrigin());
-					
-					if(pCollisionTest.GetLocalDirection()){
-						orientation *= boneMatrix.ToQuaternion();
-						direction = boneMatrix.TransformNormal(direction);
-					}
-				}
-			}
-		}
-	}
-	
-	if(pCollisionTest.GetLocalDirection()){
-		position = matrix * position;
-		orientation *= matrix.ToQuaternion();
-		direction = pParentCollider.GetMatrixNormal().TransformNormal(direction);
-		
-	}else{
-		position += matrix.GetPosition();
-	}
-	
-	// store the used test parameters in case somebody needs them
-	pCollisionTest.SetTestOrigin(position);
-	pCollisionTest.SetTestOrientation(orientation);
-	pCollisionTest.SetTestDirection(direction);
-	
 	// test collision and store the result
 	pCollisionInfoCount = 0;
 	
@@ -149,6 +110,29 @@ void debpColliderCollisionTest::Update(){
 // 		pCollisionTest.GetTouchSensor()->GetPosition().y, pCollisionTest.GetTouchSensor()->GetPosition().z );
 }
 
+bool debpColliderCollisionTest::Update(debpRayCastBatch &rayBatch){
+	if(pCollisionTest.GetCollider() || pCollisionTest.GetTouchSensor()){
+		Update();
+		return false;
+	}
+	
+	decDVector position;
+	decQuaternion orientation;
+	decVector direction;
+	if(!pUpdateTestParameters(position, orientation, direction)){
+		return false;
+	}
+	
+	pCollisionInfoCount = 0;
+	pSortByDistance = true;
+	rayBatch.AddRay(position, direction, &pCollisionTest.GetCollisionFilter(), *this);
+	return true;
+}
+
+void debpColliderCollisionTest::SetRayBatchIndex(int index){
+	pRayBatchIndex = index;
+}
+
 void debpColliderCollisionTest::SetCollisionTestResult(){
 	pCollisionTest.RemoveAllCollisionInfo();
 	
@@ -402,3 +386,65 @@ bool debpColliderCollisionTest::CanHitCollider(deCollider *owner, deCollider *co
 	// otherwise accept the collision
 	return true;
 }
+
+
+
+// Private Functions
+//////////////////////
+
+bool debpColliderCollisionTest::pUpdateTestParameters(decDVector &position,
+decQuaternion &orientation, decVector &direction){
+	if(!pCollisionTest.GetEnabled()){
+		return false;
+	}
+	
+	const decDMatrix &matrix = pParentCollider.GetMatrix();
+	
+	// cast position altered by bone if existing. for the time being this is just
+	// done by preparing the matrices in the parent collider component if existing.
+	// this will be optimized later
+	position = pCollisionTest.GetOrigin();
+	orientation = pCollisionTest.GetOrientation();
+	direction = pCollisionTest.GetDirection();
+	
+	if(!pCollisionTest.GetBone().IsEmpty()){
+		deComponent * const component = pCollisionTest.GetComponent();
+		
+		if(component){
+			deRig * const rig = component->GetRig();
+			
+			if(rig){
+				const int boneIndex = rig->IndexOfBoneNamed(pCollisionTest.GetBone());
+				
+				if(boneIndex != -1){
+					((debpComponent*)component->GetPeerPhysics())->PrepareBone(boneIndex);
+					
+					const decMatrix &boneMatrix = component->GetBoneAt(boneIndex).GetMatrix();
+					
+					position = decDVector(boneMatrix * pCollisionTest.GetOrigin());
+					
+					if(pCollisionTest.GetLocalDirection()){
+						orientation *= boneMatrix.ToQuaternion();
+						direction = boneMatrix.TransformNormal(direction);
+					}
+				}
+			}
+		}
+	}
+	
+	if(pCollisionTest.GetLocalDirection()){
+		position = matrix * position;
+		orientation *= matrix.ToQuaternion();
+		direction = pParentCollider.GetMatrixNormal().TransformNormal(direction);
+		
+	}else{
+		position += matrix.GetPosition();
+	}
+	
+	// store the used test parameters in case somebody needs them
+	pCollisionTest.SetTestOrigin(position);
+	pCollisionTest.SetTestOrientation(orientation);
+	pCollisionTest.SetTestDirection(direction);
+	
+	return true;
+}
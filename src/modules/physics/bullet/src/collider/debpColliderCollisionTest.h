@@ -31,6 +31,7 @@
 
 class deColliderCollisionTest;
 class debpCollider;
+class debpRayCastBatch;
 
 
 
@@ -45,6 +46,7 @@ private:
 	decTObjectList<deCollisionInfo> pCollisionInfo;
 	int pCollisionInfoCount;
 	bool pSortByDistance;
+	int pRayBatchIndex;
 	
 	
 	
@@ -72,6 +74,23 @@ public:
 	/** \brief Update collision test. */
 	void Update();
 	
+	/**
+	 * \brief Update collision test using ray cast batch if possible.
+	 * 
+	 * Ray tests not using a touch sensor are added to \em rayBatch instead of being
+	 * tested immediately. Once the batch has been tested SetCollisionTestResult() has
+	 * to be called. All other tests are updated immediately.
+	 * 
+	 * \returns true if the test has been added to \em rayBatch.
+	 */
+	bool Update(debpRayCastBatch &rayBatch);
+	
+	/** \brief Index in the post physics collision test ray batch or -1. */
+	inline int GetRayBatchIndex() const{ return pRayBatchIndex; }
+	
+	/** \brief Set index in the post physics collision test ray batch or -1. */
+	void SetRayBatchIndex(int index);
+	
 	/** \brief Set collider collision test to test result. */
 	void SetCollisionTestResult();
 	
@@ -134,6 +153,11 @@ public:
 	 */
 	bool CanHitCollider(deCollider *owner, deCollider *collider) override;
 	/*@}*/
+	
+	
+	
+private:
+	bool pUpdateTestParameters(decDVector &position, decQuaternion &orientation, decVector &direction);
 };
 
 #endif
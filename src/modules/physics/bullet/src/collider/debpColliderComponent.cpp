@@ -2533,10 +2533,10 @@ void debpColliderComponent::pUpdateBones(){
 		}
 	}
 	
-	// prepare model octree if required
+	// prepare model face index if required
 	if(pTestMode == etmModelStatic || pTestMode == etmModelDynamic){
 		if(model){
-			model->PrepareOctree();
+			model->PrepareFaceIndex();
 		}
 	}
 	
@@ -24,10 +24,8 @@
 
 #include "debpBulletShapeModel.h"
 #include "debpModel.h"
-#include "debpModelOctree.h"
 #include "debpShapeGenerator.h"
 #include "../dePhysicsBullet.h"
-#include "../coldet/octree/debpDefaultDOctree.h"
 
 #include <dragengine/deEngine.h>
 #include <dragengine/common/exceptions.h>
@@ -60,7 +58,7 @@
 debpModel::debpModel(dePhysicsBullet &bullet, deModel &model) :
 pBullet(bullet),
 pModel(model),
-pOctree(NULL),
+pFaceIndex(0.0f),
 pCanDeform(false),
 pHasWeightlessExtends(false),
 pModelShapeConvexHullThreshold(0.0f),
@@ -74,9 +72,6 @@ pBoneShapesWeightThreshold(0.0f)
 }
 
 debpModel::~debpModel(){
-	if(pOctree){
-		delete pOctree;
-	}
 }
 
 
@@ -84,38 +79,38 @@ debpModel::~debpModel(){
 // Management
 ///////////////
 
-void debpModel::PrepareOctree(){
-	if(pOctree){
+void debpModel::PrepareFaceIndex(){
+	if(pFaceIndex.GetElementCount() > 0){
 		return;
 	}
 	
 	// NOTE if model data has been released RetainModelData() is required to be called first
 	
 	const deModelLOD &lod = pModel.GetLODs().First();
-	const decVector offset(0.01f, 0.01f, 0.01f);
-	const decVector minExtend(pExtends.minimum - offset);
-	const decVector maxExtend(pExtends.maximum + offset);
 	const int faceCount = lod.GetFaces().GetCount();
-	int i;
+	if(faceCount == 0){
+		return;
+	}
 	
-	pOctree = new debpModelOctree((minExtend + maxExtend) * 0.5f, (maxExtend - minExtend) * 0.5f);
+	decTList<decVector> minExtends, maxExtends;
+	minExtends.EnlargeCapacity(faceCount);
+	maxExtends.EnlargeCapacity(faceCount);
+	int i;
 	
 	for(i=0; i<faceCount; i++){
 		const deModelFace &face = lod.GetFaces()[i];
 		
-		const deModelVertex &v1 = lod.GetVertices()[face.GetVertex1()];
-		const deModelVertex &v2 = lod.GetVertices()[face.GetVertex2()];
-		const deModelVertex &v3 = lod.GetVertices()[face.GetVertex3()];
-		
-		const decVector &posV1 = v1.GetPosition();
-		const decVector &posV2 = v2.GetPosition();
-		const decVector &posV3 = v3.GetPosition();
+		const decVector &posV1 = lod.GetVertices()[face.GetVertex1()].GetPosition();
+		const decVector &posV2 = lod.GetVertices()[face.GetVertex2()].GetPosition();
+		const decVector &posV3 = lod.GetVertices()[face.GetVertex3()].GetPosition();
 		
-		const decVector faceMinExtend(posV1.Smallest(posV2).Smallest(posV3));
-		const decVector faceMaxExtend(posV1.Largest(posV2).Largest(posV3));
-		
-		pOctree->InsertFaceIntoTree(i, (faceMinExtend + faceMaxExtend) * 0.5f, (faceMaxExtend - faceMinExtend) * 0.5f);
+		minExtends.Add(posV1.Smallest(posV2).Smallest(posV3));
+		maxExtends.Add(posV1.Largest(posV2).Largest(posV3));
 	}
+	
+	// inserting into the empty index assigns element indices matching the face indices
+	decTList<int> elements;
+	pFaceIndex.Insert(minExtends.GetArrayPointer(), maxExtends.GetArrayPointer(), faceCount, elements);
 }
 
 void debpModel::PrepareNormals(){
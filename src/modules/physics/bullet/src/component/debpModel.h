@@ -29,12 +29,12 @@
 
 #include <dragengine/common/collection/decTUniqueList.h>
 #include <dragengine/common/math/decMath.h>
+#include <dragengine/common/math/decSpatialIndex.h>
 #include <dragengine/common/shape/decShape.h>
 #include <dragengine/systems/modules/physics/deBasePhysicsModel.h>
 
 class deModel;
 class deModelWeight;
-class debpModelOctree;
 class dePhysicsBullet;
 
 
@@ -42,7 +42,7 @@ class dePhysicsBullet;
  * \brief Bullet Physics Model Peer
  * 
  * The peer for model resources in the ODE Physics Module. The main
- * purpose of this class is to provide an octree of faces for quick
+ * purpose of this class is to provide a spatial index of faces for quick
  * collision detection if the model is a simple model. Complex models
  * have to be stored inside the Component Peer. Simple models are
  * much quicker as they do not change over time. A model is considered
@@ -68,7 +68,7 @@ private:
 	dePhysicsBullet &pBullet;
 	deModel &pModel;
 	
-	debpModelOctree *pOctree;
+	decSpatialIndex pFaceIndex;
 	bool pCanDeform;
 	
 	decTList<sWeightSet> pWeightSets;
@@ -110,11 +110,15 @@ public:
 	
 	
 	
-	/** \brief Octree or nullptr if not prepared. */
-	inline debpModelOctree *GetOctree() const{ return pOctree; }
+	/**
+	 * \brief Spatial index of faces of the first LOD.
+	 * 
+	 * Elements are face indices. Empty if not prepared.
+	 */
+	inline const decSpatialIndex &GetFaceIndex() const{ return pFaceIndex; }
 	
-	/** \brief Prepare octree if not ready yet. */
-	void PrepareOctree();
+	/** \brief Prepare face spatial index if not ready yet. */
+	void PrepareFaceIndex();
 	
 	
 	
@@ -59,6 +59,9 @@ pEnabled(false)
 	pDIColliderCollisionTests = debpDebugInformation::Ref::New("Collider CollisionTests:");
 	pDebugInfoList.Add(pDIColliderCollisionTests);
 	
+	pDIColliderCollisionTestRays = debpDebugInformation::Ref::New("Collider CollisionTests Rays:");
+	pDebugInfoList.Add(pDIColliderCollisionTestRays);
+	
 	pDIColliderUpdateOctree = debpDebugInformation::Ref::New("Collider UpdateOctreePosition:");
 	pDebugInfoList.Add(pDIColliderUpdateOctree);
 	
@@ -49,6 +49,7 @@ private:
 	debpDebugInformation::Ref pDIColliderUpdateFromBody;
 	debpDebugInformation::Ref pDIColliderFinishDetection;
 	debpDebugInformation::Ref pDIColliderCollisionTests;
+	debpDebugInformation::Ref pDIColliderCollisionTestRays;
 	debpDebugInformation::Ref pDIColliderUpdateOctree;
 	debpDebugInformation::Ref pDITouchSensorApplyChanges;
 	debpDebugInformation::Ref pDIWorldStepSimulation;
@@ -86,6 +87,7 @@ public:
 	inline const debpDebugInformation::Ref &GetDIColliderUpdateFromBody() const{ return pDIColliderUpdateFromBody; }
 	inline const debpDebugInformation::Ref &GetDIColliderFinishDetection() const{ return pDIColliderFinishDetection; }
 	inline const debpDebugInformation::Ref &GetDIColliderCollisionTests() const{ return pDIColliderCollisionTests; }
+	inline const debpDebugInformation::Ref &GetDIColliderCollisionTestRays() const{ return pDIColliderCollisionTestRays; }
 	inline const debpDebugInformation::Ref &GetDIColliderUpdateOctree() const{ return pDIColliderUpdateOctree; }
 	inline const debpDebugInformation::Ref &GetDITouchSensorApplyChanges() const{ return pDITouchSensorApplyChanges; }
 	inline const debpDebugInformation::Ref &GetDIWorldStepSimulation() const{ return pDIWorldStepSimulation; }
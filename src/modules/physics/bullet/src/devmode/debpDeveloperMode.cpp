@@ -27,14 +27,21 @@
 
 #include "debpDeveloperMode.h"
 #include "../dePhysicsBullet.h"
+#include "../coldet/debpCollisionDetection.h"
+#include "../coldet/debpRayCastBatch.h"
 #include "../debug/debpDebug.h"
+#include "../world/debpCollisionWorld.h"
 #include "../world/debpWorld.h"
 
 #include <dragengine/common/exceptions.h>
 #include <dragengine/common/file/decPath.h>
 #include <dragengine/common/string/unicode/decUnicodeString.h>
 #include <dragengine/common/string/unicode/decUnicodeArgumentList.h>
+#include <dragengine/common/utils/decCollisionFilter.h>
+#include <dragengine/common/utils/decTimer.h>
 #include <dragengine/resources/collider/deCollider.h>
+#include <dragengine/resources/collider/deCollisionInfo.h>
+#include <dragengine/systems/modules/scripting/deBaseScriptingCollider.h>
 
 #include "BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolver.h"
 #include "BulletDynamics/Dynamics/btDiscreteDynamicsWorld.h"
@@ -48,6 +55,24 @@
 
 
 
+// Ray cast benchmark listener recording the hit count and closest hit
+class cBenchmarkRayListener : public deBaseScriptingCollider{
+public:
+	int hitCount = 0;
+	float closestDistance = 1.0f;
+	
+	void CollisionResponse(deCollider*, deCollisionInfo *info) override{
+		hitCount++;
+		closestDistance = decMath::min(closestDistance, info->GetDistance());
+	}
+	
+	bool CanHitCollider(deCollider*, deCollider*) override{
+		return true;
+	}
+};
+
+
+
 // Class debpDeveloperMode
 ////////////////////////////
 
@@ -59,7 +84,8 @@ pBullet(bullet),
 pEnabled(false),
 pTakeSnapshot(false),
 pHighlightResponseType(-1),
-pHighlightDeactivation(false)
+pHighlightDeactivation(false),
+pBenchmarkRayCastCount(0)
 {
 	(void)pBullet; // for future use
 	
@@ -108,6 +134,10 @@ bool debpDeveloperMode::ExecuteCommand(const decUnicodeArgumentList &command, de
 	}else if(command.MatchesArgumentAt(0, "dm_debug")){
 		pCmdDebugEnable(command, answer);
 		return true;
+		
+	}else if(command.MatchesArgumentAt(0, "dm_benchmark_raycast")){
+		pCmdBenchmarkRayCast(command, answer);
+		return true;
 	}
 	
 	return false;
@@ -144,6 +174,106 @@ void debpDeveloperMode::TakeSnapshot(debpWorld *world){
 
 
 
+void debpDeveloperMode::BenchmarkRayCast(debpWorld &world){
+	if(pBenchmarkRayCastCount < 1){
+		return;
+	}
+	
+	const int rayCount = pBenchmarkRayCastCount;
+	pBenchmarkRayCastCount = 0;
+	
+	// random rays between points inside the broadphase bounds
+	debpCollisionDetection &coldet = pBullet.GetCollisionDetection();
+	world.UpdateDynWorldAABBs();
+	
+	btVector3 boundsMin, boundsMax;
+	world.GetDynamicsWorld()->getBroadphase()->getBroadphaseAabb(boundsMin, boundsMax);
+	
+	decTList<decDVector> origins(rayCount), directions(rayCount);
+	int i;
+	
+	for(i=0; i<rayCount; i++){
+		const decDVector origin(
+			decMath::random((float)boundsMin.getX(), (float)boundsMax.getX()),
+			decMath::random((float)boundsMin.getY(), (float)boundsMax.getY()),
+			decMath::random((float)boundsMin.getZ(), (float)boundsMax.getZ()));
+		const decDVector target(
+			decMath::random((float)boundsMin.getX(), (float)boundsMax.getX()),
+			decMath::random((float)boundsMin.getY(), (float)boundsMax.getY()),
+			decMath::random((float)boundsMin.getZ(), (float)boundsMax.getZ()));
+		origins.Add(origin);
+		directions.Add(target - origin);
+	}
+	
+	decLayerMask layerMask;
+	for(i=0; i<64; i++){
+		layerMask.SetBit(i);
+	}
+	const decCollisionFilter collisionFilter(layerMask);
+	
+	decTList<cBenchmarkRayListener> listenersSweep, listenersSingle, listenersBatch;
+	listenersSweep.SetCount(rayCount, cBenchmarkRayListener());
+	listenersSingle.SetCount(rayCount, cBenchmarkRayListener());
+	listenersBatch.SetCount(rayCount, cBenchmarkRayListener());
+	
+	decTimer timer;
+	
+	timer.Reset();
+	for(i=0; i<rayCount; i++){
+		coldet.RayHitsSweep(origins.GetAt(i), directions.GetAt(i), world,
+			collisionFilter, listenersSweep.GetAt(i));
+	}
+	const float timeSweep = timer.GetElapsedTime();
+	
+	timer.Reset();
+	for(i=0; i<rayCount; i++){
+		coldet.RayHits(origins.GetAt(i), directions.GetAt(i), world,
+			collisionFilter, listenersSingle.GetAt(i));
+	}
+	const float timeSingle = timer.GetElapsedTime();
+	
+	timer.Reset();
+	debpRayCastBatch batch(pBullet);
+	for(i=0; i<rayCount; i++){
+		batch.AddRay(origins.GetAt(i), directions.GetAt(i), &collisionFilter, listenersBatch.GetAt(i));
+	}
+	coldet.RayHits(batch, world);
+	const float timeBatch = timer.GetElapsedTime();
+	
+	// compare closest hits. the sweep hits earlier by the radius of the sweep sphere
+	int hitsSweep = 0, hitsSingle = 0, hitsBatch = 0;
+	int mismatchSweep = 0, mismatchBatch = 0;
+	
+	for(i=0; i<rayCount; i++){
+		const cBenchmarkRayListener &sweep = listenersSweep.GetAt(i);
+		const cBenchmarkRayListener &single = listenersSingle.GetAt(i);
+		const cBenchmarkRayListener &batched = listenersBatch.GetAt(i);
+		const double length = directions.GetAt(i).Length();
+		const float tolerance = (float)(length > 1e-6 ? 0.002 / length : 1.0) + 1e-4f;
+		
+		hitsSweep += sweep.hitCount;
+		hitsSingle += single.hitCount;
+		hitsBatch += batched.hitCount;
+		
+		if((sweep.hitCount > 0) != (single.hitCount > 0)
+		|| fabsf(sweep.closestDistance - single.closestDistance) > tolerance){
+			mismatchSweep++;
+		}
+		if(batched.hitCount != single.hitCount || batched.closestDistance != single.closestDistance){
+			mismatchBatch++;
+		}
+	}
+	
+	pBullet.LogInfoFormat("Ray cast benchmark: %d rays", rayCount);
+	pBullet.LogInfoFormat("- sweep: %.2fms (%d hits)", timeSweep * 1000.0f, hitsSweep);
+	pBullet.LogInfoFormat("- exact: %.2fms (%d hits, %d closest hits differ from sweep)",
+		timeSingle * 1000.0f, hitsSingle, mismatchSweep);
+	pBullet.LogInfoFormat("- batch: %.2fms (%d hits, %d rays differ from exact)",
+		timeBatch * 1000.0f, hitsBatch, mismatchBatch);
+}
+
+
+
 // Private functions
 //////////////////////
 
@@ -154,6 +284,7 @@ void debpDeveloperMode::pCmdHelp(const decUnicodeArgumentList &command, decUnico
 	answer.AppendFromUTF8("dm_highlight_response_type => Highlight response type if dm_show_category is used.\n");
 	answer.AppendFromUTF8("dm_highlight_deactivation {1 | 0} => Hilight deactivation state if dm_show_category is used.\n");
 	answer.AppendFromUTF8("dm_debug {enable | disable} => Enable performance debugging.\n");
+	answer.AppendFromUTF8("dm_benchmark_raycast [rays] => Benchmark ray casting during next world update (default 10000 rays).\n");
 }
 
 void debpDeveloperMode::pCmdEnable(const decUnicodeArgumentList &command, decUnicodeString &answer){
@@ -262,3 +393,14 @@ void debpDeveloperMode::pCmdDebugEnable(const decUnicodeArgumentList &command, d
 	text.Format("dm_debug = %s\n", pBullet.GetDebug().GetEnabled() ? "enabled" : "disabled");
 	answer.AppendFromUTF8(text);
 }
+
+void debpDeveloperMode::pCmdBenchmarkRayCast(const decUnicodeArgumentList &command, decUnicodeString &answer){
+	pBenchmarkRayCastCount = 10000;
+	if(command.GetArgumentCount() == 2){
+		pBenchmarkRayCastCount = decMath::max(command.GetArgumentAt(1)->ToInt(), 1);
+	}
+	
+	decString text;
+	text.Format("dm_benchmark_raycast = %d rays during next world update\n", pBenchmarkRayCastCount);
+	answer.AppendFromUTF8(text);
+}
@@ -46,6 +46,9 @@ class decUnicodeString;
  * The Take-Snapshot is intended to store a COLLADE snapshot of the next
  * collision detection run requested by the host application. After the
  * snapshot is done the flag is reset.
+ * 
+ * The ray cast benchmark compares the sphere sweep ray test against the exact ray test
+ * using the next world processing physics.
  */
 class debpDeveloperMode{
 private:
@@ -56,6 +59,7 @@ private:
 	decLayerMask pShowCategory;
 	int pHighlightResponseType;
 	bool pHighlightDeactivation;
+	int pBenchmarkRayCastCount;
 	
 	
 	
@@ -98,6 +102,15 @@ public:
 	 * case the given world is written to a file using the collada exporter provided in BULLET.
 	 */
 	void TakeSnapshot(debpWorld *world);
+	
+	/**
+	 * Benchmark ray casting if required.
+	 * 
+	 * By default this does nothing unless a benchmark has been requested beforehand in
+	 * which case random rays are cast against the world using the sphere sweep, the single
+	 * exact ray and the batched exact ray test. Timings and differences are logged.
+	 */
+	void BenchmarkRayCast(debpWorld &world);
 	/*@}*/
 	
 	
@@ -110,6 +123,7 @@ private:
 	void pCmdHighlightResponseType(const decUnicodeArgumentList &command, decUnicodeString &answer);
 	void pCmdHighlightDeactivation(const decUnicodeArgumentList &command, decUnicodeString &answer);
 	void pCmdDebugEnable(const decUnicodeArgumentList &command, decUnicodeString &answer);
+	void pCmdBenchmarkRayCast(const decUnicodeArgumentList &command, decUnicodeString &answer);
 };
 
 #endif
@@ -218,6 +218,20 @@ void debpParticleEmitterInstance::StepParticles(float elapsed){
 	CheckForLastParticle(); // StepParticles is called last so the check has to be done here not in PrepareParticles
 }
 
+void debpParticleEmitterInstance::IntegrateParticlesParallel(float elapsed, deParallelTask::TaskList &tasks){
+	pTypes.Visit([&](debpParticleEmitterInstanceType &type){
+		type.IntegrateParticlesParallel(elapsed, tasks);
+	});
+}
+
+void debpParticleEmitterInstance::CollideParticles(float elapsed){
+	pTypes.Visit([&](debpParticleEmitterInstanceType &type){
+		type.CollideParticles(elapsed);
+	});
+	
+	CheckForLastParticle(); // see StepParticles
+}
+
 void debpParticleEmitterInstance::FinishStepping(){
 	pInstance->SetReferencePosition(pInstance->GetPosition()); // particles will be relative to this positon for rendering
 	
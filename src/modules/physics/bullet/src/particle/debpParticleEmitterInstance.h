@@ -30,6 +30,7 @@
 
 #include <dragengine/common/math/decMath.h>
 #include <dragengine/common/collection/decTList.h>
+#include <dragengine/parallel/deParallelTask.h>
 #include <dragengine/resources/particle/deParticleEmitterInstance.h>
 #include <dragengine/systems/modules/physics/deBasePhysicsParticleEmitterInstance.h>
 
@@ -117,6 +118,16 @@ public:
 	
 	/** Steps the particles. */
 	void StepParticles(float elapsed);
+	
+	/**
+	 * \brief Integrate particle motion adding parallel tasks to \em tasks.
+	 * 
+	 * Call CollideParticles() after all tasks finished to complete the step.
+	 */
+	void IntegrateParticlesParallel(float elapsed, deParallelTask::TaskList &tasks);
+	
+	/** \brief Test integrated particles for collisions. */
+	void CollideParticles(float elapsed);
 	/** Finish stepping. */
 	void FinishStepping();
 	
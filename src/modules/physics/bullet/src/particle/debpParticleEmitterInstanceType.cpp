@@ -30,6 +30,7 @@
 #include "debpParticleEmitter.h"
 #include "debpParticleEmitterType.h"
 #include "debpParticleEmitterInstanceType.h"
+#include "debpParticleStepTask.h"
 #include "../debpCommon.h"
 #include "../debpCollisionObject.h"
 #include "../dePhysicsBullet.h"
@@ -50,6 +51,8 @@
 #include <dragengine/deEngine.h>
 #include <dragengine/common/exceptions.h>
 #include <dragengine/common/curve/decCurveBezierEvaluator.h>
+#include <dragengine/common/math/decMathBatch.h>
+#include <dragengine/parallel/deParallelProcessing.h>
 #include <dragengine/resources/collider/deCollider.h>
 #include <dragengine/resources/component/deComponent.h>
 #include <dragengine/resources/model/deModel.h>
@@ -73,6 +76,9 @@
 
 const btScalar vRandomFactor = 1.0f / (btScalar)RAND_MAX;
 
+// count of particles integrated by one parallel step task
+const int vStepTaskChunkSize = 1024;
+
 // Class debpParticleEmitterInstanceType
 //////////////////////////////////////////
 
@@ -83,7 +89,6 @@ debpParticleEmitterInstanceType::debpParticleEmitterInstanceType() :
 pInstance(NULL),
 pType(0),
 pComponent(NULL),
-pParticleCount(0),
 pCastIntervalMin(0.0f),
 pCastIntervalGap(1.0f),
 pNextCastTimer(1.0f),
@@ -123,14 +128,14 @@ void debpParticleEmitterInstanceType::PrepareParticles(bool casting, float elaps
 		// update the particles
 		const bool updateProgress = (engType.GetSimulationType() != deParticleEmitterType::estBeam);
 		
-		for(p=0; p<pParticleCount; p++){
-			sParticle &particle = pParticles[p];
+		for(p=0; p<pParticles.GetCount(); p++){
+			float &timeToLive = pParticles.GetTimeToLives()[p];
 			
-			particle.timeToLive -= elapsed;
-			if(particle.timeToLive > 0.0f){
+			timeToLive -= elapsed;
+			if(timeToLive > 0.0f){
 				if(updateProgress){
-					particle.lifetime = 1.0f - particle.lifetimeFactor * particle.timeToLive;
-					ParticleSetProgressParams(particle);
+					pParticles.GetLifetimes()[p] = 1.0f - pParticles.GetLifetimeFactors()[p] * timeToLive;
+					ParticleSetProgressParams(p);
 				}
 				
 			}else{
@@ -328,15 +333,30 @@ void debpParticleEmitterInstanceType::ApplyForceField(const debpForceField &forc
 	float forceFactor;
 	decMatrix flucmat;
 	
-	pParticles.Visit(0, pParticleCount, [&](sParticle &particle){
-		direction.x = (float)(particle.position.x() - ffpos.x);
-		direction.y = (float)(particle.position.y() - ffpos.y);
-		direction.z = (float)(particle.position.z() - ffpos.z);
+	flucmat.SetRotationY(ffFluctuationDirection * fluctDirection * flucAngle);
+	
+	// calculate forces first then apply fluctuation to all forces in one batch
+	const int particleCount = pParticles.GetCount();
+	const btVector3 * const positions = pParticles.GetPositions();
+	const btVector3 * const linearVelocities = pParticles.GetLinearVelocities();
+	const debpParticleStore::sProgress * const progress = pParticles.GetProgress();
+	const float * const masses = pParticles.GetMasses();
+	int index;
+	
+	pForceFieldForces.SetCountDiscard(particleCount);
+	decVector * const forces = pForceFieldForces.GetArrayPointer();
+	
+	for(index=0; index<particleCount; index++){
+		forces[index].SetZero();
+		
+		direction.x = (float)(positions[index].x() - ffpos.x);
+		direction.y = (float)(positions[index].y() - ffpos.y);
+		direction.z = (float)(positions[index].z() - ffpos.z);
 		
 		distanceSquared = direction * direction;
 		
 		if(distanceSquared >= ffRadiusSquared){
-			return;
+			continue;
 		}
 		
 		if(ffFieldType == deForceField::eftLinear){
@@ -345,7 +365,7 @@ void debpParticleEmitterInstanceType::ApplyForceField(const debpForceField &forc
 			
 		}else{
 			if(distanceSquared < 1e-6f){
-				return;
+				continue;
 			}
 			
 			distance = sqrtf(distanceSquared);
@@ -355,21 +375,21 @@ void debpParticleEmitterInstanceType::ApplyForceField(const debpForceField &forc
 		switch(ffApplyType){
 		case deForceField::eatDirect:
 			//forceFactor = 1.0f;
-			forceFactor = particle.forceFieldDirect;
+			forceFactor = progress[index].forceFieldDirect;
 			break;
 			
 		case deForceField::eatSurface:
 			//forceFactor = particle.size * particle.size * PI;
-			forceFactor = particle.forceFieldSurface;
+			forceFactor = progress[index].forceFieldSurface;
 			break;
 			
 		case deForceField::eatMass:
 			//forceFactor = particle.size * particle.size * particle.size * volumeFactor;
-			forceFactor = particle.forceFieldMass * particle.mass;
+			forceFactor = progress[index].forceFieldMass * masses[index];
 			break;
 			
 		case deForceField::eatSpeed:
-			forceFactor = particle.forceFieldSpeed * (float)particle.linearVelocity.length();
+			forceFactor = progress[index].forceFieldSpeed * (float)linearVelocities[index].length();
 			break;
 			
 		default:
@@ -391,39 +411,133 @@ void debpParticleEmitterInstanceType::ApplyForceField(const debpForceField &forc
 		}*/
 		//addvelo = force * 0.2f; // need a way to influende this parameter
 		
-		flucmat.SetRotationY(ffFluctuationDirection * fluctDirection * flucAngle);
-		
-		direction = flucmat.TransformNormal(direction) * addForce;
-		particle.force.setX(particle.force.x() + direction.x);
-		particle.force.setY(particle.force.y() + direction.y);
-		particle.force.setZ(particle.force.z() + direction.z);
+		forces[index] = direction * addForce;
 		//particle.angularVelocity += addtorque; // += direction * addtorque;
-	});
+	}
+	
+	decMathBatch::TransformNormal(flucmat, forces, forces, particleCount);
+	
+	btVector3 * const particleForces = pParticles.GetForces();
+	for(index=0; index<particleCount; index++){
+		const decVector &force = forces[index];
+		particleForces[index] += btVector3((btScalar)force.x, (btScalar)force.y, (btScalar)force.z);
+	}
 }
 
 void debpParticleEmitterInstanceType::StepParticles(float elapsed){
 	const deParticleEmitterType &engType = pInstance->GetParticleEmitter()->GetEmitter()->GetTypes().GetAt(pType);
-	int i;
 	
 	if(engType.GetSimulationType() != deParticleEmitterType::estBeam){
 		//pInstance->GetBullet()->LogInfoFormat( "StepParticles: pParticleCount=%i pParticleSize=%i elapsed=%f\n", pParticleCount, pParticleSize, elapsed );
 		
-		for(i=0; i<pParticleCount; i++){
-			sParticle &particle = pParticles[i];
-			
-			if(!ParticleSimulate(particle, elapsed)){
-				KillParticle(i);
-				i--;
-			}
+		IntegrateParticles(0, pParticles.GetCount(), elapsed);
+		CollideParticles(elapsed);
+	}
+}
+
+void debpParticleEmitterInstanceType::IntegrateParticlesParallel(float elapsed, deParallelTask::TaskList &tasks){
+	const deParticleEmitterType &engType = pInstance->GetParticleEmitter()->GetEmitter()->GetTypes().GetAt(pType);
+	if(engType.GetSimulationType() == deParticleEmitterType::estBeam){
+		return;
+	}
+	
+	const int particleCount = pParticles.GetCount();
+	dePhysicsBullet &bullet = *pInstance->GetBullet();
+	deParallelProcessing &parallel = bullet.GetGameEngine()->GetParallelProcessing();
+	
+	// integrating particles is cheap. using tasks for small emitters costs more than it gains
+	if(particleCount < vStepTaskChunkSize * 2 || parallel.GetPaused()){
+		IntegrateParticles(0, particleCount, elapsed);
+		return;
+	}
+	
+	int first;
+	for(first=0; first<particleCount; first+=vStepTaskChunkSize){
+		const debpParticleStepTask::Ref task(debpParticleStepTask::Ref::New(bullet, *this,
+			first, decMath::min(vStepTaskChunkSize, particleCount - first), elapsed));
+		tasks.Add(task);
+		parallel.AddTaskAsync(task);
+	}
+}
+
+void debpParticleEmitterInstanceType::IntegrateParticles(int first, int count, float elapsed){
+	DEASSERT_TRUE(first >= 0)
+	DEASSERT_TRUE(count >= 0)
+	DEASSERT_TRUE(first + count <= pParticles.GetCount())
+	
+	// each quantity is processed in its own loop over the particle arrays. this keeps the
+	// loops tight and free of dependencies allowing the compiler to vectorize them
+	btVector3 * const positions = pParticles.GetPositions() + first;
+	btVector3 * const linearVelocities = pParticles.GetLinearVelocities() + first;
+	const btVector3 * const forces = pParticles.GetForces() + first;
+	float * const rotations = pParticles.GetRotations() + first;
+	float * const angularVelocities = pParticles.GetAngularVelocities() + first;
+	const float * const masses = pParticles.GetMasses() + first;
+	const float * const drags = pParticles.GetDrags() + first;
+	const float * const damps = pParticles.GetDamps() + first;
+	const float twoPi = PI * 2.0f;
+	int i;
+	
+	// apply force
+	for(i=0; i<count; i++){
+		linearVelocities[i] += forces[i] * (btScalar)(elapsed / masses[i]);
+	}
+	
+	// apply air drag
+	for(i=0; i<count; i++){
+		if(drags[i] > 1e-10f){
+			const btScalar factor = (btScalar)1 - (btScalar)(drags[i] *
+				linearVelocities[i].dot(linearVelocities[i]) * elapsed / masses[i]);
+			linearVelocities[i] *= factor > (btScalar)0 ? factor : (btScalar)0;
+		}
+	}
+	
+	// damp velocities
+	for(i=0; i<count; i++){
+		if(damps[i] > 1e-5f){
+			const float factor = decMath::max(1.0f - damps[i], 0.0f);
+			linearVelocities[i] *= (btScalar)factor;
+			angularVelocities[i] *= factor;
+		}
+	}
+	
+	// apply angular rotation
+	for(i=0; i<count; i++){
+		rotations[i] = fmodf(rotations[i] + angularVelocities[i] * elapsed, twoPi);
+	}
+	
+	// step linear motion. colliding particles are moved by CollideParticles()
+	if(!pInstance->GetCanCollide()){
+		for(i=0; i<count; i++){
+			positions[i] += linearVelocities[i] * (btScalar)elapsed;
+		}
+	}
+}
+
+void debpParticleEmitterInstanceType::CollideParticles(float elapsed){
+	const deParticleEmitterType &engType = pInstance->GetParticleEmitter()->GetEmitter()->GetTypes().GetAt(pType);
+	if(engType.GetSimulationType() == deParticleEmitterType::estBeam || !pInstance->GetCanCollide()){
+		return;
+	}
+	
+	// collision tests access the collision world and can call into the scripting module.
+	// this has to be done in the main thread in particle order for deterministic results.
+	// killed particles are replaced by not yet tested particles hence testing the same index again
+	int i;
+	for(i=0; i<pParticles.GetCount(); i++){
+		if(!ParticleTestCollision(i, elapsed)){
+			KillParticle(i);
+			i--;
 		}
 	}
 }
 
 void debpParticleEmitterInstanceType::FinishStepping(){
+	const int particleCount = pParticles.GetCount();
 	int i;
 	
-	for(i=0; i<pParticleCount; i++){
-		ParticleUpdateTrailEmitter(pParticles[i]);
+	for(i=0; i<particleCount; i++){
+		ParticleUpdateTrailEmitter(i);
 	}
 	
 	UpdateGraphicParticles();
@@ -433,36 +547,44 @@ void debpParticleEmitterInstanceType::UpdateGraphicParticles(){
 	const debpParticleEmitter * const emitter = pInstance->GetParticleEmitter();
 	const decDVector &position = pInstance->GetInstance()->GetReferencePosition();
 	const float rotationFactor = 255.0f / TWO_PI;
+	const int particleCount = pParticles.GetCount();
 	int p;
 	
-	if(pParticleCount > pGraParticles.GetCount()){
-		pGraParticles.AddRange(pParticleCount - pGraParticles.GetCount(), {});
+	if(particleCount > pGraParticles.GetCount()){
+		pGraParticles.AddRange(particleCount - pGraParticles.GetCount(), {});
 	}
 	
 	if(emitter){
 		const debpParticleEmitterType &type = emitter->GetTypes()[pType];
 		const btScalar factorAngVelo = (btScalar)type.GetParamFactorAngVelo();
 		const btScalar factorLinVelo = (btScalar)type.GetParamFactorLinVelo();
+		const btVector3 * const positions = pParticles.GetPositions();
+		const btVector3 * const linearVelocities = pParticles.GetLinearVelocities();
+		const float * const rotations = pParticles.GetRotations();
+		const float * const angularVelocities = pParticles.GetAngularVelocities();
+		const float * const lifetimes = pParticles.GetLifetimes();
+		const debpParticleStore::sCast * const casts = pParticles.GetCasts();
 		
-		for(p=0; p<pParticleCount; p++){
+		for(p=0; p<particleCount; p++){
 			deParticleEmitterInstanceType::sParticle &destParticle = pGraParticles[p];
-			const sParticle &srcParticle = pParticles[p];
+			const btVector3 &linearVelocity = linearVelocities[p];
+			const debpParticleStore::sCast &cast = casts[p];
 			
-			destParticle.lifetime = srcParticle.lifetime;
-			destParticle.positionX = (float)(srcParticle.position.x() - position.x);
-			destParticle.positionY = (float)(srcParticle.position.y() - position.y);
-			destParticle.positionZ = (float)(srcParticle.position.z() - position.z);
+			destParticle.lifetime = lifetimes[p];
+			destParticle.positionX = (float)(positions[p].x() - position.x);
+			destParticle.positionY = (float)(positions[p].y() - position.y);
+			destParticle.positionZ = (float)(positions[p].z() - position.z);
 			
-			const btScalar velocity = srcParticle.linearVelocity.length();
+			const btScalar velocity = linearVelocity.length();
 			if(velocity > 1e-5){
 				destParticle.linearDirectionX = (unsigned char)decMath::clamp(
-					(int)(decMath::linearStep(srcParticle.linearVelocity.x(),
+					(int)(decMath::linearStep(linearVelocity.x(),
 						-1.0f, 1.0f, 0.0f, 255.0f)), 0, 255);
 				destParticle.linearDirectionY = (unsigned char)decMath::clamp(
-					(int)(decMath::linearStep(srcParticle.linearVelocity.y(),
+					(int)(decMath::linearStep(linearVelocity.y(),
 						-1.0f, 1.0f, 0.0f, 255.0f)), 0, 255);
 				destParticle.linearDirectionZ = (unsigned char)decMath::clamp(
-					(int)(decMath::linearStep(srcParticle.linearVelocity.z(),
+					(int)(decMath::linearStep(linearVelocity.z(),
 						-1.0f, 1.0f, 0.0f, 255.0f)), 0, 255);
 				
 			}else{ // dummy direction along z axis
@@ -471,20 +593,20 @@ void debpParticleEmitterInstanceType::UpdateGraphicParticles(){
 				destParticle.linearDirectionZ = 255;
 			}
 			destParticle.linearVelocity = velocity * factorLinVelo;
-			destParticle.angularVelocity = srcParticle.angularVelocity * factorAngVelo;
+			destParticle.angularVelocity = angularVelocities[p] * factorAngVelo;
 			destParticle.rotation = (unsigned char)decMath::clamp((unsigned int)(
-				decMath::normalize(srcParticle.rotation, 0.0f, TWO_PI) * rotationFactor), 0, 255);
+				decMath::normalize(rotations[p], 0.0f, TWO_PI) * rotationFactor), 0, 255);
 			
-			destParticle.castSize = srcParticle.castSize;
-			destParticle.castEmissivity = srcParticle.castEmissivity;
-			destParticle.castRed = srcParticle.castRed;
-			destParticle.castGreen = srcParticle.castGreen;
-			destParticle.castBlue = srcParticle.castBlue;
-			destParticle.castTransparency = srcParticle.castTransparency;
+			destParticle.castSize = cast.size;
+			destParticle.castEmissivity = cast.emissivity;
+			destParticle.castRed = cast.red;
+			destParticle.castGreen = cast.green;
+			destParticle.castBlue = cast.blue;
+			destParticle.castTransparency = cast.transparency;
 		}
 		
 		pInstance->GetInstance()->GetTypes().GetAt(pType)->SetParticleArray(
-			pGraParticles.GetArrayPointer(), pParticleCount);
+			pGraParticles.GetArrayPointer(), particleCount);
 		
 	}else{
 		pInstance->GetInstance()->GetTypes().GetAt(pType)->SetParticleArray(
@@ -572,7 +694,7 @@ void debpParticleEmitterInstanceType::OnTypeChanged(){
 void debpParticleEmitterInstanceType::CastParticle(float distance, float timeOffset){
 	const debpParticleEmitter * const emitter = pInstance->GetParticleEmitter();
 	
-	if(emitter && pParticleCount < 10000){ // currently hard-coded... not more than 10k active particles
+	if(emitter && pParticles.GetCount() < 10000){ // currently hard-coded... not more than 10k active particles
 		const deParticleEmitterType &engType = emitter->GetEmitter()->GetTypes().GetAt(pType);
 		
 		if(engType.GetSimulationType() == deParticleEmitterType::estBeam){
@@ -585,11 +707,11 @@ void debpParticleEmitterInstanceType::CastParticle(float distance, float timeOff
 }
 
 void debpParticleEmitterInstanceType::KillParticle(int index){
-	if(index < 0 || index >= pParticleCount){
+	if(index < 0 || index >= pParticles.GetCount()){
 		DETHROW(deeInvalidParam);
 	}
 	
-	const deParticleEmitterInstance::Ref &trailEmitter = pParticles[index].trailEmitter;
+	const deParticleEmitterInstance::Ref &trailEmitter = pParticles.GetCasts()[index].trailEmitter;
 	const int simtype = pInstance->GetParticleEmitter()->GetEmitter()->GetTypes().GetAt(pType)->GetSimulationType();
 	
 	//debpParticleInstance &P = pParticles[ index ];
@@ -598,44 +720,34 @@ void debpParticleEmitterInstanceType::KillParticle(int index){
 	if(trailEmitter){
 		trailEmitter->SetEnableCasting(false);
 		trailEmitter->SetRemoveAfterLastParticleDied(true);
-		pParticles[index].trailEmitter = nullptr;
 	}
 	
 	if(simtype == deParticleEmitterType::estParticle){
-		if(index < pParticleCount - 1){
-			pParticles[index] = pParticles[pParticleCount - 1];
-		}
+		pParticles.RemoveSwap(index);
 		
 	}else{ // ribbon or beam
-		if(index < pParticleCount - 1){
-			int i;
-			for(i=index; i<pParticleCount-1; i++){
-				pParticles[i] = pParticles[i + 1];
-			}
-		}
+		pParticles.RemoveShift(index);
 	}
 	
-	pParticleCount--;
-	
-	if(pParticleCount == 0){
+	if(pParticles.GetCount() == 0){
 		pInstance->RequestCheckForLastParticle();
 	}
 }
 
 void debpParticleEmitterInstanceType::KillAllParticles(){
-	if(pParticleCount == 0){
+	if(pParticles.GetCount() == 0){
 		return;
 	}
 	
-	while(pParticleCount > 0){
-		pParticleCount--;
-		
-		deParticleEmitterInstance * const trailEmitter = pParticles[pParticleCount].trailEmitter;
+	while(pParticles.GetCount() > 0){
+		deParticleEmitterInstance * const trailEmitter =
+			pParticles.GetCasts()[pParticles.GetCount() - 1].trailEmitter;
 		if(trailEmitter){
 			trailEmitter->SetEnableCasting(false);
 			trailEmitter->SetRemoveAfterLastParticleDied(true);
-			pParticles[pParticleCount].trailEmitter = nullptr;
 		}
+		
+		pParticles.RemoveLast();
 	}
 	
 	pInstance->RequestCheckForLastParticle();
@@ -644,17 +756,12 @@ void debpParticleEmitterInstanceType::KillAllParticles(){
 
 
 void debpParticleEmitterInstanceType::CastSingleParticle(float distance, float timeOffset){
-	// enlarge the particles array if required 
-	if(pParticleCount == pParticles.GetCount()){
-		pParticles.AddRange(10, {});
-	}
-	
 	// set up new particle
-	sParticle &particle = pParticles[pParticleCount++];
+	const int index = pParticles.Add();
 	
-	ParticleSetCastParams(particle, distance, timeOffset);
-	ParticleSetProgressParams(particle);
-	ParticleCreateTrailEmitter(particle);
+	ParticleSetCastParams(index, distance, timeOffset);
+	ParticleSetProgressParams(index);
+	ParticleCreateTrailEmitter(index);
 	
 	//printf( "cast: size=%g emi=%g color=(%i,%i,%i,%i)\n", particle.castSize, particle.castEmissivity, particle.castRed, particle.castGreen, particle.castBlue, particle.castTransparency );
 	//pBullet->LogInfoFormat( "cast particle: i=%i p(%.3g,%.3g,%.3g) v=(%.3g,%.3g,%.3g) s=%.1f ttl=%.1f", pParticleCount-1, P.position.x, P.position.y, P.position.z, P.velocity.x, P.velocity.y, P.velocity.z, P.size, P.timeToLive );
@@ -678,43 +785,42 @@ void debpParticleEmitterInstanceType::CastBeamParticle(float distance){
 		
 		// enlarge the particles array if required. we enlarge by the maximum particle count even
 		// if we should use less later on
-		if(pParticleCount + particleCount > pParticles.GetCount()){
-			const int newSize = pParticleCount + particleCount + 10;
-			pParticles.AddRange(newSize - pParticles.GetCount(), {});
-		}
+		pParticles.EnsureCapacity(particleCount);
 		
 		// set up new particle
-		sParticle &particleCast = pParticles[pParticleCount++];
+		const int indexCast = pParticles.Add();
 		
-		ParticleSetCastParams(particleCast, distance, 0.0f);
-		ParticleSetProgressParams(particleCast);
+		ParticleSetCastParams(indexCast, distance, 0.0f);
+		ParticleSetProgressParams(indexCast);
 		
 		// simulate the particle all the way to the end if there is more than one particle. if a kill particle
 		// is found the end of the beam is assumed
 		if(particleCount > 1){
 			const float lifetimeStep = 1.0f / (float)(particleCount - 1);
-			const float simTimeStep = particleCast.timeToLive * lifetimeStep;
+			const float simTimeStep = pParticles.GetTimeToLives()[indexCast] * lifetimeStep;
 			
 			for(i=1; i<particleCount; i++){
-				pParticles[pParticleCount] = pParticles[pParticleCount - 1];
+				const int indexProgress = pParticles.Add();
+				pParticles.Copy(indexProgress - 1, indexProgress);
 				
-				sParticle &particleProgress = pParticles[pParticleCount++];
-				particleProgress.lifetime += lifetimeStep;
+				pParticles.GetLifetimes()[indexProgress] += lifetimeStep;
 				
-				ParticleSetProgressParams(particleProgress);
+				ParticleSetProgressParams(indexProgress);
 				//ParticleCreateTrailEmitter( particleProgress ); // does this make sense? it would be possible
-				if(!ParticleSimulate(particleProgress, simTimeStep)){
+				if(!ParticleSimulate(indexProgress, simTimeStep)){
 					break;
 				}
 			}
 		}
 		
 		// adjust the particle lifetime to match the actual used particle count to obtain location along beam
-		if(pParticleCount > 1){
-			const float lifetimeStep = 1.0f / (float)(pParticleCount - 1);
+		const int castCount = pParticles.GetCount();
+		if(castCount > 1){
+			const float lifetimeStep = 1.0f / (float)(castCount - 1);
+			float * const lifetimes = pParticles.GetLifetimes();
 			
-			for(i=1; i<pParticleCount; i++){
-				pParticles[i].lifetime = lifetimeStep * (float)i;
+			for(i=1; i<castCount; i++){
+				lifetimes[i] = lifetimeStep * (float)i;
 			}
 		}
 		
@@ -722,15 +828,17 @@ void debpParticleEmitterInstanceType::CastBeamParticle(float distance){
 		// been cast since the first particle is used as blue print and copied over to all other particles
 		// then modified. if the trail emitter exists already it is multiplied across the beam which is not
 		// only looking wrong it trashes the reference count of the trail emitter.
-		ParticleCreateTrailEmitter(particleCast);
+		ParticleCreateTrailEmitter(indexCast);
 	}
 }
 
 
 
-void debpParticleEmitterInstanceType::ParticleSetCastParams(sParticle &particle, float distance, float timeOffset){
+void debpParticleEmitterInstanceType::ParticleSetCastParams(int index, float distance, float timeOffset){
+	debpParticleStore::sCast &cast = pParticles.GetCasts()[index];
+	
 	// important to avoid problems later on in bad cases
-	particle.trailEmitter = nullptr;
+	cast.trailEmitter = nullptr;
 	
 	// calculate cast matrix for the particle
 	decDMatrix castMatrix;
@@ -751,74 +859,75 @@ void debpParticleEmitterInstanceType::ParticleSetCastParams(sParticle &particle,
 	const deParticleEmitterType &engType = emitter.GetEmitter()->GetTypes().GetAt(pType);
 	decDVector view;
 	
-	particle.castSize = type.EvaluateCastParameter(instance,
+	cast.size = type.EvaluateCastParameter(instance,
 		debpParticleEmitterType::escSize, deParticleEmitterType::epSize);
-	particle.castMass = type.EvaluateCastParameter(instance,
+	cast.mass = type.EvaluateCastParameter(instance,
 		debpParticleEmitterType::escMass, deParticleEmitterType::epMass);
-	particle.castRotation = type.EvaluateCastParameter(instance,
+	cast.rotation = type.EvaluateCastParameter(instance,
 		debpParticleEmitterType::escRotation, deParticleEmitterType::epRotation) * (PI * 2.0f);
-	particle.castLinearVelocity = type.EvaluateCastParameter(instance,
+	cast.linearVelocity = type.EvaluateCastParameter(instance,
 		debpParticleEmitterType::escLinearVelocity, deParticleEmitterType::epLinearVelocity);
-	particle.castAngularVelocity = type.EvaluateCastParameter(instance,
+	cast.angularVelocity = type.EvaluateCastParameter(instance,
 		debpParticleEmitterType::escAngularVelocity, deParticleEmitterType::epAngularVelocity);
-	particle.castBrown = type.EvaluateCastParameter(instance,
+	cast.brown = type.EvaluateCastParameter(instance,
 		debpParticleEmitterType::escBrown, deParticleEmitterType::epBrownMotion);
-	particle.castDamp = type.EvaluateCastParameter(instance,
+	cast.damp = type.EvaluateCastParameter(instance,
 		debpParticleEmitterType::escDamp, deParticleEmitterType::epDamping);
-	particle.castDrag = type.EvaluateCastParameter(instance,
+	cast.drag = type.EvaluateCastParameter(instance,
 		debpParticleEmitterType::escDrag, deParticleEmitterType::epDrag);
-	particle.castGravity.setX((btScalar)type.EvaluateCastParameter(instance,
+	cast.gravity.setX((btScalar)type.EvaluateCastParameter(instance,
 		debpParticleEmitterType::escGravityX, deParticleEmitterType::epGravityX));
-	particle.castGravity.setY((btScalar)type.EvaluateCastParameter(instance,
+	cast.gravity.setY((btScalar)type.EvaluateCastParameter(instance,
 		debpParticleEmitterType::escGravityY, deParticleEmitterType::epGravityY));
-	particle.castGravity.setZ((btScalar)type.EvaluateCastParameter(instance,
+	cast.gravity.setZ((btScalar)type.EvaluateCastParameter(instance,
 		debpParticleEmitterType::escGravityZ, deParticleEmitterType::epGravityZ));
-	particle.castLocalGravity = type.EvaluateCastParameter(instance,
+	cast.localGravity = type.EvaluateCastParameter(instance,
 		debpParticleEmitterType::escLocalGravity, deParticleEmitterType::epLocalGravity);
-	particle.castForceFieldDirect = type.EvaluateCastParameter(instance,
+	cast.forceFieldDirect = type.EvaluateCastParameter(instance,
 		debpParticleEmitterType::escForceFieldDirect, deParticleEmitterType::epForceFieldDirect);
-	particle.castForceFieldSurface = type.EvaluateCastParameter(instance,
+	cast.forceFieldSurface = type.EvaluateCastParameter(instance,
 		debpParticleEmitterType::escForceFieldSurface, deParticleEmitterType::epForceFieldSurface);
-	particle.castForceFieldMass = type.EvaluateCastParameter(instance,
+	cast.forceFieldMass = type.EvaluateCastParameter(instance,
 		debpParticleEmitterType::escForceFieldVolume, deParticleEmitterType::epForceFieldMass);
-	particle.castForceFieldSpeed = type.EvaluateCastParameter(instance,
+	cast.forceFieldSpeed = type.EvaluateCastParameter(instance,
 		debpParticleEmitterType::escForceFieldSpeed, deParticleEmitterType::epForceFieldSpeed);
-	particle.castElasticity = type.EvaluateCastParameter(instance,
+	cast.elasticity = type.EvaluateCastParameter(instance,
 		debpParticleEmitterType::escElasticity, deParticleEmitterType::epElasticity);
-	particle.castRoughness = type.EvaluateCastParameter(instance,
+	cast.roughness = type.EvaluateCastParameter(instance,
 		debpParticleEmitterType::escRoughness, deParticleEmitterType::epRoughness);
 	
 	if(engType.GetCollisionEmitter()){
-		particle.castEmitDirection = type.EvaluateCastParameter(instance,
+		cast.emitDirection = type.EvaluateCastParameter(instance,
 			debpParticleEmitterType::escEmitDirection, deParticleEmitterType::epEmitDirection);
 		
 	}else{
-		particle.castEmitDirection = 0.0f;
+		cast.emitDirection = 0.0f;
 	}
 	
-	particle.castEmissivity = type.EvaluateCastParameter(instance,
+	cast.emissivity = type.EvaluateCastParameter(instance,
 		debpParticleEmitterType::escEmissivity, deParticleEmitterType::epEmissivity);
-	particle.castRed = (unsigned char)(type.EvaluateCastParameter(instance,
+	cast.red = (unsigned char)(type.EvaluateCastParameter(instance,
 		debpParticleEmitterType::escRed, deParticleEmitterType::epRed) * 255.0f);
-	particle.castGreen = (unsigned char)(type.EvaluateCastParameter(instance,
+	cast.green = (unsigned char)(type.EvaluateCastParameter(instance,
 		debpParticleEmitterType::escGreen, deParticleEmitterType::epGreen) * 255.0f);
-	particle.castBlue = (unsigned char)(type.EvaluateCastParameter(instance,
+	cast.blue = (unsigned char)(type.EvaluateCastParameter(instance,
 		debpParticleEmitterType::escBlue, deParticleEmitterType::epBlue) * 255.0f);
-	particle.castTransparency = (unsigned char)(type.EvaluateCastParameter(instance,
+	cast.transparency = (unsigned char)(type.EvaluateCastParameter(instance,
 		debpParticleEmitterType::escTransparency, deParticleEmitterType::epTransparency) * 255.0f);
 	
-	particle.timeToLive = type.EvaluateCastParameter(instance,
+	const float timeToLive = type.EvaluateCastParameter(instance,
 		debpParticleEmitterType::escTimeToLive, deParticleEmitterType::epTimeToLive);
-	particle.lifetimeFactor = 1.0f / particle.timeToLive;
-	particle.lifetime = timeOffset;
+	pParticles.GetTimeToLives()[index] = timeToLive;
+	pParticles.GetLifetimeFactors()[index] = 1.0f / timeToLive;
+	pParticles.GetLifetimes()[index] = timeOffset;
 	
-	particle.position.setValue((btScalar)castMatrix.a14, (btScalar)castMatrix.a24, (btScalar)castMatrix.a34);
-	particle.rotation = particle.castRotation;
+	pParticles.GetPositions()[index].setValue((btScalar)castMatrix.a14, (btScalar)castMatrix.a24, (btScalar)castMatrix.a34);
+	pParticles.GetRotations()[index] = cast.rotation;
 	
-	view = castMatrix.TransformView() * particle.castLinearVelocity;
-	particle.linearVelocity.setValue((btScalar)view.x, (btScalar)view.y, (btScalar)view.z);
+	view = castMatrix.TransformView() * cast.linearVelocity;
+	pParticles.GetLinearVelocities()[index].setValue((btScalar)view.x, (btScalar)view.y, (btScalar)view.z);
 	
-	particle.angularVelocity = particle.castAngularVelocity
+	pParticles.GetAngularVelocities()[index] = cast.angularVelocity
 		* type.EvaluateProgressParameter( debpParticleEmitterType::escAngularVelocity, 0.0f );
 }
 
@@ -1025,172 +1134,148 @@ void debpParticleEmitterInstanceType::ParticleCastMatrix(decDMatrix &matrix){
 	}
 }
 
-void debpParticleEmitterInstanceType::ParticleCreateTrailEmitter(sParticle &particle){
+void debpParticleEmitterInstanceType::ParticleCreateTrailEmitter(int index){
 	const deParticleEmitterType &engType = pInstance->GetParticleEmitter()->GetEmitter()->GetTypes().GetAt(pType);
 	if(!engType.GetTrailEmitter() || !pInstance->GetParentWorld()){
 		return;
 	}
 	
+	const btVector3 &position = pParticles.GetPositions()[index];
+	const btVector3 &linearVelocity = pParticles.GetLinearVelocities()[index];
+	debpParticleStore::sCast &cast = pParticles.GetCasts()[index];
 	deWorld &engWorld = pInstance->GetParentWorld()->GetWorld();
 	const deEngine &engine = *pInstance->GetBullet()->GetGameEngine();
-	const btVector3 direction = -particle.linearVelocity;
+	const btVector3 direction = -linearVelocity;
 	
 	try{
-		particle.trailEmitter = engine.GetParticleEmitterInstanceManager()->CreateInstance();
-		particle.trailEmitter->SetEmitter(engType.GetTrailEmitter());
-		particle.trailEmitter->SetCollisionFilter(pInstance->GetInstance()->GetCollisionFilter());
-		particle.trailEmitter->SetRemoveAfterLastParticleDied(false);
-		particle.trailEmitter->SetTimeScale(1.0f);
-		particle.trailEmitter->SetEnableCasting(true);
+		cast.trailEmitter = engine.GetParticleEmitterInstanceManager()->CreateInstance();
+		cast.trailEmitter->SetEmitter(engType.GetTrailEmitter());
+		cast.trailEmitter->SetCollisionFilter(pInstance->GetInstance()->GetCollisionFilter());
+		cast.trailEmitter->SetRemoveAfterLastParticleDied(false);
+		cast.trailEmitter->SetTimeScale(1.0f);
+		cast.trailEmitter->SetEnableCasting(true);
 		
-		particle.trailEmitter->SetPosition(decDVector(particle.position.getX(), particle.position.getY(), particle.position.getZ()));
-		particle.trailEmitter->SetReferencePosition(particle.trailEmitter->GetPosition());
+		cast.trailEmitter->SetPosition(decDVector(position.getX(), position.getY(), position.getZ()));
+		cast.trailEmitter->SetReferencePosition(cast.trailEmitter->GetPosition());
 		
 		if(direction.getY() > 1.0 - DVECTOR_THRESHOLD){
-			particle.trailEmitter->SetOrientation(decQuaternion(-0.707107f, 0.0f, 0.0f, 0.707107f));
+			cast.trailEmitter->SetOrientation(decQuaternion(-0.707107f, 0.0f, 0.0f, 0.707107f));
 			
 		}else if(direction.getY() < DVECTOR_THRESHOLD - 1.0){
-			particle.trailEmitter->SetOrientation(decQuaternion(0.707107f, 0.0f, 0.0f, 0.707107f));
+			cast.trailEmitter->SetOrientation(decQuaternion(0.707107f, 0.0f, 0.0f, 0.707107f));
 			
 		}else{
-			particle.trailEmitter->SetOrientation(decMatrix::CreateVU(decVector((float)direction.getX(),
+			cast.trailEmitter->SetOrientation(decMatrix::CreateVU(decVector((float)direction.getX(),
 				(float)direction.getY(), (float)direction.getZ()), decVector(0.0f, 1.0f, 0.0f)).ToQuaternion());
 		}
 		
-		engWorld.AddParticleEmitter(particle.trailEmitter);
+		engWorld.AddParticleEmitter(cast.trailEmitter);
 		
 	}catch(const deException &){
-		particle.trailEmitter = nullptr;
+		cast.trailEmitter = nullptr;
 		throw;
 	}
 }
 
-void debpParticleEmitterInstanceType::ParticleSetProgressParams(sParticle &particle){
+void debpParticleEmitterInstanceType::ParticleSetProgressParams(int index){
+	btVector3 &force = pParticles.GetForces()[index];
+	float &mass = pParticles.GetMasses()[index];
+	float &drag = pParticles.GetDrags()[index];
+	float &damp = pParticles.GetDamps()[index];
+	const float lifetime = pParticles.GetLifetimes()[index];
+	debpParticleStore::sProgress &progress = pParticles.GetProgress()[index];
+	const debpParticleStore::sCast &cast = pParticles.GetCasts()[index];
 	const debpParticleEmitter &emitter = *pInstance->GetParticleEmitter();
 	const debpParticleEmitterType &type = emitter.GetTypes()[pType];
 	const debpWorld * const world = pInstance->GetParentWorld();
 	
-	particle.size = particle.castSize *
-		type.EvaluateProgressParameter(debpParticleEmitterType::escSize, particle.lifetime);
-	particle.mass = decMath::max(1e-5f, particle.castMass *
-		type.EvaluateProgressParameter(debpParticleEmitterType::escMass, particle.lifetime));
-	
-	particle.brown = particle.castBrown *
-		type.EvaluateProgressParameter(debpParticleEmitterType::escBrown, particle.lifetime);
-	particle.damp = particle.castDamp *
-		type.EvaluateProgressParameter(debpParticleEmitterType::escDamp, particle.lifetime);
-	particle.drag = particle.castDrag *
-		type.EvaluateProgressParameter(debpParticleEmitterType::escDrag, particle.lifetime);
-	particle.elasticity = particle.castElasticity *
-		type.EvaluateProgressParameter(debpParticleEmitterType::escElasticity, particle.lifetime);
-	particle.roughness = particle.castRoughness *
-		type.EvaluateProgressParameter(debpParticleEmitterType::escRoughness, particle.lifetime);
-	
-	particle.forceFieldDirect = particle.castForceFieldDirect *
-		type.EvaluateProgressParameter(debpParticleEmitterType::escForceFieldDirect, particle.lifetime);
-	particle.forceFieldSurface = particle.castForceFieldSurface *
-		type.EvaluateProgressParameter(debpParticleEmitterType::escForceFieldSurface, particle.lifetime);
-	particle.forceFieldMass = particle.castForceFieldMass *
-		type.EvaluateProgressParameter(debpParticleEmitterType::escForceFieldVolume, particle.lifetime);
-	particle.forceFieldSpeed = particle.castForceFieldSpeed *
-		type.EvaluateProgressParameter(debpParticleEmitterType::escForceFieldSpeed, particle.lifetime);
+	progress.size = cast.size *
+		type.EvaluateProgressParameter(debpParticleEmitterType::escSize, lifetime);
+	mass = decMath::max(1e-5f, cast.mass *
+		type.EvaluateProgressParameter(debpParticleEmitterType::escMass, lifetime));
+	
+	progress.brown = cast.brown *
+		type.EvaluateProgressParameter(debpParticleEmitterType::escBrown, lifetime);
+	damp = cast.damp *
+		type.EvaluateProgressParameter(debpParticleEmitterType::escDamp, lifetime);
+	drag = cast.drag *
+		type.EvaluateProgressParameter(debpParticleEmitterType::escDrag, lifetime);
+	progress.elasticity = cast.elasticity *
+		type.EvaluateProgressParameter(debpParticleEmitterType::escElasticity, lifetime);
+	progress.roughness = cast.roughness *
+		type.EvaluateProgressParameter(debpParticleEmitterType::escRoughness, lifetime);
+	
+	progress.forceFieldDirect = cast.forceFieldDirect *
+		type.EvaluateProgressParameter(debpParticleEmitterType::escForceFieldDirect, lifetime);
+	progress.forceFieldSurface = cast.forceFieldSurface *
+		type.EvaluateProgressParameter(debpParticleEmitterType::escForceFieldSurface, lifetime);
+	progress.forceFieldMass = cast.forceFieldMass *
+		type.EvaluateProgressParameter(debpParticleEmitterType::escForceFieldVolume, lifetime);
+	progress.forceFieldSpeed = cast.forceFieldSpeed *
+		type.EvaluateProgressParameter(debpParticleEmitterType::escForceFieldSpeed, lifetime);
 	
 	// calculate gravity. it is a bit convoluted to avoid calculating not used stuff
-	const btScalar localGravity = (btScalar)(particle.castLocalGravity
-		* type.EvaluateProgressParameter( debpParticleEmitterType::escLocalGravity, particle.lifetime ) );
+	const btScalar localGravity = (btScalar)(cast.localGravity
+		* type.EvaluateProgressParameter( debpParticleEmitterType::escLocalGravity, lifetime ) );
 	
 	if(localGravity < 1e-5f){
 		if(world){
 			const decVector &worldGravity = world->GetWorld().GetGravity();
 			
-			particle.gravity.setX((btScalar)worldGravity.x);
-			particle.gravity.setY((btScalar)worldGravity.y);
-			particle.gravity.setZ((btScalar)worldGravity.z);
+			progress.gravity.setX((btScalar)worldGravity.x);
+			progress.gravity.setY((btScalar)worldGravity.y);
+			progress.gravity.setZ((btScalar)worldGravity.z);
 			
 		}else{
-			particle.gravity.setZero();
+			progress.gravity.setZero();
 		}
 		
 	}else{
-		particle.gravity.setX(particle.castGravity.getX() *
-			(btScalar)type.EvaluateProgressParameter(debpParticleEmitterType::escGravityX, particle.lifetime));
-		particle.gravity.setY(particle.castGravity.getY() *
-			(btScalar)type.EvaluateProgressParameter(debpParticleEmitterType::escGravityY, particle.lifetime));
-		particle.gravity.setZ(particle.castGravity.getZ() *
-			(btScalar)type.EvaluateProgressParameter(debpParticleEmitterType::escGravityZ, particle.lifetime));
+		progress.gravity.setX(cast.gravity.getX() *
+			(btScalar)type.EvaluateProgressParameter(debpParticleEmitterType::escGravityX, lifetime));
+		progress.gravity.setY(cast.gravity.getY() *
+			(btScalar)type.EvaluateProgressParameter(debpParticleEmitterType::escGravityY, lifetime));
+		progress.gravity.setZ(cast.gravity.getZ() *
+			(btScalar)type.EvaluateProgressParameter(debpParticleEmitterType::escGravityZ, lifetime));
 		
 		if(world){
 			if(localGravity < 0.99999){
 				const decVector &worldGravity = world->GetWorld().GetGravity();
 				const btScalar blend2 = 1.0f - localGravity;
 				
-				particle.gravity.setX(particle.gravity.getX() * localGravity + (btScalar)worldGravity.x * blend2);
-				particle.gravity.setY(particle.gravity.getY() * localGravity + (btScalar)worldGravity.y * blend2);
-				particle.gravity.setZ(particle.gravity.getZ() * localGravity + (btScalar)worldGravity.z * blend2);
+				progress.gravity.setX(progress.gravity.getX() * localGravity + (btScalar)worldGravity.x * blend2);
+				progress.gravity.setY(progress.gravity.getY() * localGravity + (btScalar)worldGravity.y * blend2);
+				progress.gravity.setZ(progress.gravity.getZ() * localGravity + (btScalar)worldGravity.z * blend2);
 			}
 			
 		}else{
 			if(localGravity < 0.99999){
-				particle.gravity *= localGravity;
+				progress.gravity *= localGravity;
 			}
 		}
 	}
 	
 	// apply gravity
-	particle.force = particle.gravity * particle.mass;
+	force = progress.gravity * mass;
 	
 	// apply brown motion
-	if(particle.brown > 1e-5f){
+	if(progress.brown > 1e-5f){
 		btVector3 brownMotion;
 		
 		brownMotion.setX((btScalar)random() * vRandomFactor * (btScalar)2 - (btScalar)1);
 		brownMotion.setY((btScalar)random() * vRandomFactor * (btScalar)2 - (btScalar)1);
 		brownMotion.setZ((btScalar)random() * vRandomFactor * (btScalar)2 - (btScalar)1);
 		
-		particle.force += brownMotion * (btScalar)(particle.brown * particle.mass);
+		force += brownMotion * (btScalar)(progress.brown * mass);
 	}
 }
 
-bool debpParticleEmitterInstanceType::ParticleSimulate(sParticle &particle, float elapsed){
-	// apply force
-	particle.linearVelocity += particle.force * (btScalar)(elapsed / particle.mass);
-	
-	// apply air drag
-	if(particle.drag > 1e-10f){
-		const btScalar factor1 = (btScalar)1 - (btScalar)(particle.drag * 
-			particle.linearVelocity.dot(particle.linearVelocity) * elapsed / particle.mass);
-		
-		if(factor1 > (btScalar)0){
-			particle.linearVelocity *= factor1;
-			
-		}else{
-			particle.linearVelocity.setZero();
-		}
-	}
-	
-	// damp velocities
-	if(particle.damp > 1e-5f){
-		const btScalar factor1 = (btScalar)1 - (btScalar)particle.damp;// * btElapsed;
-		
-		if(factor1 > (btScalar)0){
-			particle.linearVelocity *= factor1;
-			particle.angularVelocity *= factor1;
-			
-		}else{
-			particle.linearVelocity.setZero();
-			particle.angularVelocity = 0.0f;
-		}
-	}
-	
-	// apply angular rotation
-	particle.rotation = fmodf(particle.rotation + particle.angularVelocity * elapsed, PI * 2.0f);
+bool debpParticleEmitterInstanceType::ParticleSimulate(int index, float elapsed){
+	IntegrateParticles(index, 1, elapsed);
 	
 	// step linear motion
 	if(pInstance->GetCanCollide()){
-		return ParticleTestCollision(particle, elapsed);
-		
-	}else{
-		particle.position += particle.linearVelocity * (btScalar)elapsed;
+		return ParticleTestCollision(index, elapsed);
 	}
 	
 	return true;
@@ -1228,15 +1313,22 @@ public:
 	}
 };
 
-bool debpParticleEmitterInstanceType::ParticleTestCollision(sParticle &particle, float elapsed){
+bool debpParticleEmitterInstanceType::ParticleTestCollision(int index, float elapsed){
 	if(!pInstance->GetParentWorld()){
 		return true; // happens during loading while warmstarting
 	}
 	
+	btVector3 &position = pParticles.GetPositions()[index];
+	btVector3 &linearVelocity = pParticles.GetLinearVelocities()[index];
+	const float mass = pParticles.GetMasses()[index];
+	const float lifetime = pParticles.GetLifetimes()[index];
+	const debpParticleStore::sProgress &progress = pParticles.GetProgress()[index];
+	const debpParticleStore::sCast &cast = pParticles.GetCasts()[index];
+	
 	// pBullet->LogInfoFormat( "step particle %i: elapsed=%g displacement=(%g,%g,%g)", p, elapsed, displacement.getX(), displacement.getY(), displacement.getZ() );
 	const deParticleEmitterType &engType = pInstance->GetParticleEmitter()->GetEmitter()->GetTypes().GetAt(pType);
 	debpCollisionWorld &dynamicsWorld = *pInstance->GetParentWorld()->GetDynamicsWorld();
-	btVector3 displacement = particle.linearVelocity * elapsed;
+	btVector3 displacement = linearVelocity * elapsed;
 	int loop;
 	
 	// the bullet shpere-box test is quite error-prone. particles keep on falling through
@@ -1246,36 +1338,36 @@ bool debpParticleEmitterInstanceType::ParticleTestCollision(sParticle &particle,
 	
 	for(loop=0; loop<5; loop++){
 		if(displacement.length2() < 1e-8){
-			particle.linearVelocity.setZero();
+			linearVelocity.setZero();
 			break;
 		}
 		
-		const btVector3 rayToWorld = particle.position + displacement;
+		const btVector3 rayToWorld = position + displacement;
 		
 		// TODO use size of particle to do a sphere collision test instead of a ray test
 		
 		// WARNING bullet has a broken ray-box test implementation using Gjk which has a tendency
 		// to miss collisions half of the time. as a quick fix a sweep test is done with
 		// a tiny sphere which yields a comparable result but is not prone to the problem
-		//debpClosestRayResultCallback rayResult( particle.position, rayToWorld, &collisionFilter );
-		//dynamicsWorld.rayTest( particle.position, rayToWorld, rayResult );
+		//debpClosestRayResultCallback rayResult( position, rayToWorld, &collisionFilter );
+		//dynamicsWorld.rayTest( position, rayToWorld, rayResult );
 		
-		//pBullet->LogInfoFormat( "rayTest: pos=(%g,%g,%g) to(%g,%g,%g) time=%g", particle.position.getX(), particle.position.getY(),
-		//	particle.position.getZ(), rayToWorld.getX(), rayToWorld.getY(), rayToWorld.getZ(), elapsed );
+		//pBullet->LogInfoFormat( "rayTest: pos=(%g,%g,%g) to(%g,%g,%g) time=%g", position.getX(), position.getY(),
+		//	position.getZ(), rayToWorld.getX(), rayToWorld.getY(), rayToWorld.getZ(), elapsed );
 		
-		cClosestParticleCallback rayResult(particle.position, rayToWorld, *pInstance->GetInstance());
+		cClosestParticleCallback rayResult(position, rayToWorld, *pInstance->GetInstance());
 		{
 		//sphereShape.setUnscaledRadius( ... );
 		const btQuaternion btQuaterion((btScalar)0.0, (btScalar)0.0, (btScalar)0.0, (btScalar)1.0);
-		const btTransform btTransformFrom(btQuaterion, particle.position);
+		const btTransform btTransformFrom(btQuaterion, position);
 		const btTransform btTransformTo(btQuaterion, rayToWorld);
 		
 		dynamicsWorld.convexSweepTest(&sphereShape, btTransformFrom, btTransformTo, rayResult, BT_ZERO);
 		}
 		
 		if(!rayResult.hasHit()){
-			particle.position += displacement;
-			//pBullet->LogInfoFormat( "no hit: pos=(%g,%g,%g)", particle.position.getX(), particle.position.getY(), particle.position.getZ() );
+			position += displacement;
+			//pBullet->LogInfoFormat( "no hit: pos=(%g,%g,%g)", position.getX(), position.getY(), position.getZ() );
 			break;
 		}
 		
@@ -1285,10 +1377,10 @@ bool debpParticleEmitterInstanceType::ParticleTestCollision(sParticle &particle,
 		bool doEmitParticles = false;
 		
 		if(engType.GetCollisionEmitter()){
-			particleLinearVelocity = (float)particle.linearVelocity.length();
-			particleLinearVelocity *= particle.elasticity;
+			particleLinearVelocity = (float)linearVelocity.length();
+			particleLinearVelocity *= progress.elasticity;
 			
-			if(particleLinearVelocity * particle.mass > engType.GetEmitMinImpulse()){
+			if(particleLinearVelocity * mass > engType.GetEmitMinImpulse()){
 				// sanity check to avoid dead-loops due to an emitter without emit-burst set as these would live forever
 				if(engType.GetCollisionEmitter()->GetEmitBurst()){
 					doEmitParticles = true;
@@ -1300,8 +1392,8 @@ bool debpParticleEmitterInstanceType::ParticleTestCollision(sParticle &particle,
 		deParticleEmitterType::eCollisionResponses collisionResponse = engType.GetCollisionResponse();
 		
 		if(collisionResponse != deParticleEmitterType::ecrDestroy || doEmitParticles){
-			particle.position += displacement * rayResult.m_closestHitFraction;
-			particle.position += rayResult.m_hitNormalWorld * (btScalar)0.0001; // prevent falling through
+			position += displacement * rayResult.m_closestHitFraction;
+			position += rayResult.m_hitNormalWorld * (btScalar)0.0001; // prevent falling through
 			displacement *= (btScalar)1 - rayResult.m_closestHitFraction;
 		}
 		
@@ -1332,18 +1424,18 @@ bool debpParticleEmitterInstanceType::ParticleTestCollision(sParticle &particle,
 				(float)rayResult.m_hitNormalWorld.getY(),
 				(float)rayResult.m_hitNormalWorld.getZ());
 			const decDVector ciposition(
-				(double)particle.position.getX(),
-				(double)particle.position.getY(),
-				(double)particle.position.getZ());
+				(double)position.getX(),
+				(double)position.getY(),
+				(double)position.getZ());
 			const decVector civelocity(
-				(float)particle.linearVelocity.getX(),
-				(float)particle.linearVelocity.getY(),
-				(float)particle.linearVelocity.getZ());
+				(float)linearVelocity.getX(),
+				(float)linearVelocity.getY(),
+				(float)linearVelocity.getZ());
 			
 			cinfo.SetNormal(cinormal);
 			cinfo.SetDistance((float)(elapsed * ((btScalar)1.0 - rayResult.m_closestHitFraction)));
-			cinfo.SetParticleLifetime(particle.lifetime);
-			cinfo.SetParticleMass(particle.mass);
+			cinfo.SetParticleLifetime(lifetime);
+			cinfo.SetParticleMass(mass);
 			cinfo.SetParticlePosition(ciposition);
 			cinfo.SetParticleVelocity(civelocity);
 			cinfo.SetParticleResponse(deParticleEmitterType::ecrDestroy);
@@ -1356,7 +1448,7 @@ bool debpParticleEmitterInstanceType::ParticleTestCollision(sParticle &particle,
 		if(collisionResponse == deParticleEmitterType::ecrPhysical || doEmitParticles){
 			displacement -= rayResult.m_hitNormalWorld * (rayResult.m_hitNormalWorld.dot(displacement) * (btScalar)2);
 			// TODO roughness
-			displacement *= particle.elasticity;
+			displacement *= progress.elasticity;
 		}
 		
 		// create an emitter instance if one is set for this particle type and the preconditions are met
@@ -1380,8 +1472,8 @@ bool debpParticleEmitterInstanceType::ParticleTestCollision(sParticle &particle,
 			btVector3 emitNormal;
 			
 			const debpParticleEmitterType &type = pInstance->GetParticleEmitter()->GetTypes()[pType];
-			const float emitDirection = particle.castEmitDirection * type.EvaluateProgressParameter(
-				debpParticleEmitterType::escEmitDirection, particle.lifetime);
+			const float emitDirection = cast.emitDirection * type.EvaluateProgressParameter(
+				debpParticleEmitterType::escEmitDirection, lifetime);
 			
 			if(emitDirection < FLOAT_SAFE_EPSILON){
 				emitNormal = rayResult.m_hitNormalWorld;
@@ -1408,7 +1500,7 @@ bool debpParticleEmitterInstanceType::ParticleTestCollision(sParticle &particle,
 			}
 			
 			// set controller values
-			ParticleSetEmitterControllers(particle, emitInstance, particleLinearVelocity);
+			ParticleSetEmitterControllers(index, emitInstance, particleLinearVelocity);
 			
 			// add to the world. this has to come before casting just to be safe
 			pInstance->GetParentWorld()->GetWorld().AddParticleEmitter(emitInstance);
@@ -1419,7 +1511,7 @@ bool debpParticleEmitterInstanceType::ParticleTestCollision(sParticle &particle,
 		// apply collision response
 		switch(collisionResponse){
 		case deParticleEmitterType::ecrPhysical:
-			particle.linearVelocity = displacement / elapsed;
+			linearVelocity = displacement / elapsed;
 			elapsed *= 1.0f - (float)rayResult.m_closestHitFraction;
 			break;
 			
@@ -1428,8 +1520,8 @@ bool debpParticleEmitterInstanceType::ParticleTestCollision(sParticle &particle,
 			const decDVector &ciposition = cinfo.GetParticlePosition();
 			const decVector &civelocity = cinfo.GetParticleVelocity();
 			
-			particle.position.setValue((btScalar)ciposition.x, (btScalar)ciposition.y, (btScalar)ciposition.z);
-			particle.linearVelocity.setValue((btScalar)civelocity.x, (btScalar)civelocity.y, (btScalar)civelocity.z);
+			position.setValue((btScalar)ciposition.x, (btScalar)ciposition.y, (btScalar)ciposition.z);
+			linearVelocity.setValue((btScalar)civelocity.x, (btScalar)civelocity.y, (btScalar)civelocity.z);
 			elapsed *= 1.0f - (float)rayResult.m_closestHitFraction;
 			}break;
 			
@@ -1441,20 +1533,20 @@ bool debpParticleEmitterInstanceType::ParticleTestCollision(sParticle &particle,
 	return true;
 }
 
-void debpParticleEmitterInstanceType::ParticleSetEmitterControllers(const sParticle &particle,
+void debpParticleEmitterInstanceType::ParticleSetEmitterControllers(int index,
 deParticleEmitterInstance &instance, float linearVelocity){
 	const deParticleEmitterType &engType = pInstance->GetParticleEmitter()->GetEmitter()->GetTypes().GetAt(pType);
 	int controllerIndex;
 	
 	controllerIndex = engType.GetEmitController(deParticleEmitterType::eecLifetime);
 	if(controllerIndex != -1){
-		instance.GetControllers().GetAt(controllerIndex)->SetValue(particle.lifetime);
+		instance.GetControllers().GetAt(controllerIndex)->SetValue(pParticles.GetLifetimes()[index]);
 		instance.NotifyControllerChangedAt(controllerIndex);
 	}
 	
 	controllerIndex = engType.GetEmitController(deParticleEmitterType::eecMass);
 	if(controllerIndex != -1){
-		instance.GetControllers().GetAt(controllerIndex)->SetValue(particle.mass);
+		instance.GetControllers().GetAt(controllerIndex)->SetValue(pParticles.GetMasses()[index]);
 		instance.NotifyControllerChangedAt(controllerIndex);
 	}
 	
@@ -1466,55 +1558,58 @@ deParticleEmitterInstance &instance, float linearVelocity){
 	
 	controllerIndex = engType.GetEmitController(deParticleEmitterType::eecAngularVelocity);
 	if(controllerIndex != -1){
-		instance.GetControllers().GetAt(controllerIndex)->SetValue(particle.angularVelocity);
+		instance.GetControllers().GetAt(controllerIndex)->SetValue(pParticles.GetAngularVelocities()[index]);
 		instance.NotifyControllerChangedAt(controllerIndex);
 	}
 }
 
-void debpParticleEmitterInstanceType::ParticleUpdateTrailEmitter(const sParticle &particle){
-	if(!particle.trailEmitter){
+void debpParticleEmitterInstanceType::ParticleUpdateTrailEmitter(int index){
+	const debpParticleStore::sCast &cast = pParticles.GetCasts()[index];
+	if(!cast.trailEmitter){
 		return;
 	}
 	
-	btVector3 direction(-particle.linearVelocity);
+	const btVector3 &position = pParticles.GetPositions()[index];
+	const btVector3 &linearVelocity = pParticles.GetLinearVelocities()[index];
+	btVector3 direction(-linearVelocity);
 	
 	// set position and orientation
-	particle.trailEmitter->SetPosition(decDVector(particle.position.getX(), particle.position.getY(), particle.position.getZ()));
+	cast.trailEmitter->SetPosition(decDVector(position.getX(), position.getY(), position.getZ()));
 	
 	// set orientation only if the linear velocity is not zero. otherwise keep the old orientation
 	if(direction.length() > 0.001){
 		direction.normalize();
 		
 		if(direction.getY() > 0.999){
-			particle.trailEmitter->SetOrientation(decQuaternion(-0.707107f, 0.0f, 0.0f, 0.707107f));
+			cast.trailEmitter->SetOrientation(decQuaternion(-0.707107f, 0.0f, 0.0f, 0.707107f));
 			
 		}else if(direction.getY() < -0.999){
-			particle.trailEmitter->SetOrientation(decQuaternion(0.707107f, 0.0f, 0.0f, 0.707107f));
+			cast.trailEmitter->SetOrientation(decQuaternion(0.707107f, 0.0f, 0.0f, 0.707107f));
 			
 		}else{
-			particle.trailEmitter->SetOrientation(decDMatrix::CreateVU(decDVector(direction.getX(),
+			cast.trailEmitter->SetOrientation(decDMatrix::CreateVU(decDVector(direction.getX(),
 				direction.getY(), direction.getZ()), decDVector(0.0, 1.0, 0.0)).ToQuaternion());
 		}
 	}
 	
 	// set controller values
-	ParticleSetTrailEmitterControllers(particle, particle.trailEmitter, particle.linearVelocity.length());
+	ParticleSetTrailEmitterControllers(index, cast.trailEmitter, linearVelocity.length());
 }
 
-void debpParticleEmitterInstanceType::ParticleSetTrailEmitterControllers(const sParticle &particle,
+void debpParticleEmitterInstanceType::ParticleSetTrailEmitterControllers(int index,
 deParticleEmitterInstance &instance, float linearVelocity){
 	const deParticleEmitterType &engType = pInstance->GetParticleEmitter()->GetEmitter()->GetTypes().GetAt(pType);
 	int controllerIndex;
 	
 	controllerIndex = engType.GetTrailController(deParticleEmitterType::eecLifetime);
 	if(controllerIndex != -1){
-		instance.GetControllers().GetAt(controllerIndex)->SetValue(particle.lifetime);
+		instance.GetControllers().GetAt(controllerIndex)->SetValue(pParticles.GetLifetimes()[index]);
 		instance.NotifyControllerChangedAt(controllerIndex);
 	}
 	
 	controllerIndex = engType.GetTrailController(deParticleEmitterType::eecMass);
 	if(controllerIndex != -1){
-		instance.GetControllers().GetAt(controllerIndex)->SetValue(particle.mass);
+		instance.GetControllers().GetAt(controllerIndex)->SetValue(pParticles.GetMasses()[index]);
 		instance.NotifyControllerChangedAt(controllerIndex);
 	}
 	
@@ -1526,7 +1621,7 @@ deParticleEmitterInstance &instance, float linearVelocity){
 	
 	controllerIndex = engType.GetTrailController(deParticleEmitterType::eecAngularVelocity);
 	if(controllerIndex != -1){
-		instance.GetControllers().GetAt(controllerIndex)->SetValue(particle.angularVelocity);
+		instance.GetControllers().GetAt(controllerIndex)->SetValue(pParticles.GetAngularVelocities()[index]);
 		instance.NotifyControllerChangedAt(controllerIndex);
 	}
 }
@@ -25,9 +25,10 @@
 #ifndef _DEBPPROPPARTICLEEMITTERINSTANCETYPE_H_
 #define _DEBPPROPPARTICLEEMITTERINSTANCETYPE_H_
 
-#include "LinearMath/btVector3.h"
+#include "debpParticleStore.h"
 
 #include <dragengine/common/collection/decTList.h>
+#include <dragengine/parallel/deParallelTask.h>
 #include <dragengine/resources/particle/deParticleEmitterInstance.h>
 #include <dragengine/resources/particle/deParticleEmitterInstanceType.h>
 
@@ -41,65 +42,13 @@ class debpComponent;
  * @brief Particle Emitter Instance Type.
  */
 class debpParticleEmitterInstanceType{
-public:
-	struct sParticle{
-		btVector3 position = btVector3(BT_ZERO, BT_ZERO, BT_ZERO);
-		btVector3 linearVelocity = btVector3(BT_ZERO, BT_ZERO, BT_ZERO);
-		btVector3 force = btVector3(BT_ZERO, BT_ZERO, BT_ZERO);
-		float rotation = 0.0f;
-		float angularVelocity = 0.0f;
-		btVector3 gravity = btVector3(BT_ZERO, BT_ZERO, BT_ZERO);
-		float forceFieldDirect = 0.0f;
-		float forceFieldSurface = 0.0f;
-		float forceFieldMass = 0.0f;
-		float forceFieldSpeed = 0.0f;
-		float timeToLive = 0.0f;
-		float lifetimeFactor = 0.0f;
-		float lifetime = 0.0f;
-		float size = 0.0f;
-		float mass = 0.0f;
-		float brown = 0.0f;
-		float damp = 0.0f;
-		float drag = 0.0f;
-		float elasticity = 0.0f;
-		float roughness = 0.0f;
-		
-		float castSize = 0.0f;
-		float castMass = 0.0f;
-		float castRotation = 0.0f;
-		float castLinearVelocity = 0.0f;
-		float castAngularVelocity = 0.0f;
-		float castBrown = 0.0f;
-		float castDamp = 0.0f;
-		float castDrag = 0.0f;
-		btVector3 castGravity = btVector3(BT_ZERO, BT_ZERO, BT_ZERO);
-		float castLocalGravity = 0.0f;
-		float castForceFieldDirect = 0.0f;
-		float castForceFieldSurface = 0.0f;
-		float castForceFieldMass = 0.0f;
-		float castForceFieldSpeed = 0.0f;
-		float castElasticity = 0.0f;
-		float castRoughness = 0.0f;
-		float castEmitDirection = 0.0f;
-		float castEmitParticleCount = 0.0f;
-		
-		float castEmissivity = 0.0f;
-		unsigned char castRed = 0;
-		unsigned char castGreen = 0;
-		unsigned char castBlue = 0;
-		unsigned char castTransparency = 0;
-		
-		deParticleEmitterInstance::Ref trailEmitter = {};
-	};
-	
 private:
 	debpParticleEmitterInstance *pInstance;
 	int pType;
 	
 	debpComponent *pComponent;
 	
-	decTList<sParticle> pParticles;
-	int pParticleCount;
+	debpParticleStore pParticles;
 	
 	float pCastIntervalMin;
 	float pCastIntervalGap;
@@ -109,6 +58,7 @@ private:
 	int pBurstLastCurvePoint;
 	
 	decTList<deParticleEmitterInstanceType::sParticle> pGraParticles;
+	decTList<decVector> pForceFieldForces;
 	
 public:
 	/** @name Constructors and Destructors */
@@ -131,11 +81,11 @@ public:
 	void SetType(int type);
 	
 	/** Particles. */
-	inline decTList<sParticle> &GetParticles(){ return pParticles; }
-	inline const decTList<sParticle> &GetParticles() const{ return pParticles; }
+	inline debpParticleStore &GetParticles(){ return pParticles; }
+	inline const debpParticleStore &GetParticles() const{ return pParticles; }
 	
 	/** Particle count. */
-	inline int GetParticlesCount() const{ return pParticleCount; }
+	inline int GetParticlesCount() const{ return pParticles.GetCount(); }
 	
 	/** Prepare stepping. */
 	void PrepareParticles(bool casting, float elapsed, float travelledDistance);
@@ -143,6 +93,25 @@ public:
 	void ApplyForceField(const debpForceField &forceField, float elapsed);
 	/** Steps the particles. */
 	void StepParticles(float elapsed);
+	
+	/**
+	 * \brief Integrate particle motion in parallel.
+	 * 
+	 * Adds tasks to integrate chunks of particles to \em tasks. Small particle counts are
+	 * integrated directly. Call CollideParticles() after all tasks finished.
+	 */
+	void IntegrateParticlesParallel(float elapsed, deParallelTask::TaskList &tasks);
+	
+	/**
+	 * \brief Integrate motion of range of particles.
+	 * 
+	 * Safe to be called from parallel tasks on disjoint ranges of particles. Positions are
+	 * only updated if particles can not collide. Otherwise CollideParticles() updates them.
+	 */
+	void IntegrateParticles(int first, int count, float elapsed);
+	
+	/** \brief Test integrated particles for collisions killing particles if required. */
+	void CollideParticles(float elapsed);
 	/** Finish stepping. */
 	void FinishStepping();
 	/** Update graphic particles. */
@@ -169,25 +138,25 @@ public:
 	void CastBeamParticle(float distance);
 	
 	/** Set the cast values of a particle. */
-	void ParticleSetCastParams(sParticle &particle, float distance, float timeOffset);
+	void ParticleSetCastParams(int index, float distance, float timeOffset);
 	/** Calculate for a particle the cast matrix. */
 	void ParticleCastMatrix(decDMatrix &matrix);
 	/** Create trail emitter for a particle. */
-	void ParticleCreateTrailEmitter(sParticle &particle);
+	void ParticleCreateTrailEmitter(int index);
 	/** Set particle progress parameters for a point in time from cast parameters using the particle lifetime value. */
-	void ParticleSetProgressParams(sParticle &particle);
+	void ParticleSetProgressParams(int index);
 	
 	/** Simulate particle. Returns false if the particle has to be killed due to a collision or true to keep it alive. */
-	bool ParticleSimulate(sParticle &particle, float elapsed);
+	bool ParticleSimulate(int index, float elapsed);
 	/** Test for particle collision. Returns false if the particle has to be killed due to a collision or true to keep it alive. */
-	bool ParticleTestCollision(sParticle &particle, float elapsed);
+	bool ParticleTestCollision(int index, float elapsed);
 	/** Set controllers of a trail or impact emitter. */
-	void ParticleSetEmitterControllers(const sParticle &particle,
+	void ParticleSetEmitterControllers(int index,
 		deParticleEmitterInstance &instance, float linearVelocity);
 	/** Update particle trail emitter if existing. */
-	void ParticleUpdateTrailEmitter(const sParticle &particle);
+	void ParticleUpdateTrailEmitter(int index);
 	/** Set controllers of a trail or impact emitter. */
-	void ParticleSetTrailEmitterControllers(const sParticle &particle,
+	void ParticleSetTrailEmitterControllers(int index,
 		deParticleEmitterInstance &instance, float linearVelocity);
 	/*@}*/
 	
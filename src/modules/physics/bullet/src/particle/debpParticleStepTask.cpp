@@ -0,0 +1,75 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "debpParticleStepTask.h"
+#include "debpParticleEmitterInstanceType.h"
+#include "../dePhysicsBullet.h"
+
+
+// Class debpParticleStepTask
+///////////////////////////////
+
+// Constructor, destructor
+////////////////////////////
+
+debpParticleStepTask::debpParticleStepTask(dePhysicsBullet &bullet,
+	debpParticleEmitterInstanceType &type, int first, int count, float elapsed) :
+deParallelTask(&bullet),
+pType(type),
+pFirst(first),
+pCount(count),
+pElapsed(elapsed){
+}
+
+debpParticleStepTask::~debpParticleStepTask(){
+}
+
+
+
+// Management
+///////////////
+
+void debpParticleStepTask::Run(){
+	if(!IsCancelled()){
+		pType.IntegrateParticles(pFirst, pCount, pElapsed);
+	}
+}
+
+void debpParticleStepTask::Finished(){
+}
+
+
+
+// Debugging
+//////////////
+
+decString debpParticleStepTask::GetDebugName() const{
+	return "Bullet-ParticleStep";
+}
+
+decString debpParticleStepTask::GetDebugDetails() const{
+	decString details;
+	details.Format("first=%d count=%d", pFirst, pCount);
+	return details;
+}
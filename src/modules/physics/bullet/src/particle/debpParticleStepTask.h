@@ -0,0 +1,90 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DEBPPARTICLESTEPTASK_H_
+#define _DEBPPARTICLESTEPTASK_H_
+
+#include <dragengine/parallel/deParallelTask.h>
+
+class dePhysicsBullet;
+class debpParticleEmitterInstanceType;
+
+
+/**
+ * \brief Parallel task integrating a chunk of particles of an emitter instance type.
+ * 
+ * Only the thread safe part of stepping is done. Collision testing has to be done
+ * afterwards in the main thread.
+ */
+class debpParticleStepTask : public deParallelTask{
+public:
+	/** \brief Type holding strong reference. */
+	using Ref = deTThreadSafeObjectReference<debpParticleStepTask>;
+	
+	
+private:
+	debpParticleEmitterInstanceType &pType;
+	const int pFirst;
+	const int pCount;
+	const float pElapsed;
+	
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/** \brief Create task. */
+	debpParticleStepTask(dePhysicsBullet &bullet, debpParticleEmitterInstanceType &type,
+		int first, int count, float elapsed);
+	
+protected:
+	/** \brief Clean up task. */
+	~debpParticleStepTask() override;
+	/*@}*/
+	
+	
+	
+public:
+	/** \name Management */
+	/*@{*/
+	/** \brief Parallel task implementation. */
+	void Run() override;
+	
+	/** \brief Processing of task Run() finished. */
+	void Finished() override;
+	/*@}*/
+	
+	
+	
+	/** \name Debugging */
+	/*@{*/
+	/** \brief Short task name for debugging. */
+	decString GetDebugName() const override;
+	
+	/** \brief Task details for debugging. */
+	decString GetDebugDetails() const override;
+	/*@}*/
+};
+
+#endif
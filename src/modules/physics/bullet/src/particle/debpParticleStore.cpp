@@ -0,0 +1,154 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+
+#include "debpParticleStore.h"
+
+#include <dragengine/common/exceptions.h>
+#include <dragengine/common/math/decMath.h>
+
+
+// Class debpParticleStore
+////////////////////////////
+
+// Constructor, destructor
+////////////////////////////
+
+debpParticleStore::debpParticleStore() :
+pCount(0){
+}
+
+debpParticleStore::~debpParticleStore(){
+}
+
+
+
+// Management
+///////////////
+
+void debpParticleStore::EnsureCapacity(int capacity){
+	const int oldCapacity = GetCapacity();
+	if(capacity <= oldCapacity){
+		return;
+	}
+	
+	// grow geometrically to avoid reallocating all arrays for every few particles cast
+	const int growBy = decMath::max(capacity, oldCapacity * 3 / 2 + 16) - oldCapacity;
+	
+	pPositions.AddRange(growBy, btVector3(BT_ZERO, BT_ZERO, BT_ZERO));
+	pLinearVelocities.AddRange(growBy, btVector3(BT_ZERO, BT_ZERO, BT_ZERO));
+	pForces.AddRange(growBy, btVector3(BT_ZERO, BT_ZERO, BT_ZERO));
+	pRotations.AddRange(growBy, 0.0f);
+	pAngularVelocities.AddRange(growBy, 0.0f);
+	pMasses.AddRange(growBy, 0.0f);
+	pDrags.AddRange(growBy, 0.0f);
+	pDamps.AddRange(growBy, 0.0f);
+	pTimeToLives.AddRange(growBy, 0.0f);
+	pLifetimeFactors.AddRange(growBy, 0.0f);
+	pLifetimes.AddRange(growBy, 0.0f);
+	pProgress.AddRange(growBy, {});
+	pCasts.AddRange(growBy, {});
+}
+
+int debpParticleStore::Add(){
+	EnsureCapacity(pCount + 1);
+	return pCount++;
+}
+
+void debpParticleStore::Copy(int from, int to){
+	DEASSERT_TRUE(from >= 0)
+	DEASSERT_TRUE(from < pCount)
+	DEASSERT_TRUE(to >= 0)
+	DEASSERT_TRUE(to < pCount)
+	
+	pPositions[to] = pPositions[from];
+	pLinearVelocities[to] = pLinearVelocities[from];
+	pForces[to] = pForces[from];
+	pRotations[to] = pRotations[from];
+	pAngularVelocities[to] = pAngularVelocities[from];
+	pMasses[to] = pMasses[from];
+	pDrags[to] = pDrags[from];
+	pDamps[to] = pDamps[from];
+	pTimeToLives[to] = pTimeToLives[from];
+	pLifetimeFactors[to] = pLifetimeFactors[from];
+	pLifetimes[to] = pLifetimes[from];
+	pProgress[to] = pProgress[from];
+	pCasts[to] = pCasts[from];
+}
+
+void debpParticleStore::RemoveSwap(int index){
+	DEASSERT_TRUE(index >= 0)
+	DEASSERT_TRUE(index < pCount)
+	
+	const int last = pCount - 1;
+	if(index < last){
+		Copy(last, index);
+	}
+	RemoveLast();
+}
+
+void debpParticleStore::RemoveShift(int index){
+	DEASSERT_TRUE(index >= 0)
+	DEASSERT_TRUE(index < pCount)
+	
+	const int last = pCount - 1;
+	if(index < last){
+		btVector3 * const positions = pPositions.GetArrayPointer();
+		btVector3 * const linearVelocities = pLinearVelocities.GetArrayPointer();
+		btVector3 * const forces = pForces.GetArrayPointer();
+		float * const rotations = pRotations.GetArrayPointer();
+		float * const angularVelocities = pAngularVelocities.GetArrayPointer();
+		float * const masses = pMasses.GetArrayPointer();
+		float * const drags = pDrags.GetArrayPointer();
+		float * const damps = pDamps.GetArrayPointer();
+		float * const timeToLives = pTimeToLives.GetArrayPointer();
+		float * const lifetimeFactors = pLifetimeFactors.GetArrayPointer();
+		float * const lifetimes = pLifetimes.GetArrayPointer();
+		sProgress * const progress = pProgress.GetArrayPointer();
+		sCast * const casts = pCasts.GetArrayPointer();
+		
+		std::move(positions + index + 1, positions + pCount, positions + index);
+		std::move(linearVelocities + index + 1, linearVelocities + pCount, linearVelocities + index);
+		std::move(forces + index + 1, forces + pCount, forces + index);
+		std::move(rotations + index + 1, rotations + pCount, rotations + index);
+		std::move(angularVelocities + index + 1, angularVelocities + pCount, angularVelocities + index);
+		std::move(masses + index + 1, masses + pCount, masses + index);
+		std::move(drags + index + 1, drags + pCount, drags + index);
+		std::move(damps + index + 1, damps + pCount, damps + index);
+		std::move(timeToLives + index + 1, timeToLives + pCount, timeToLives + index);
+		std::move(lifetimeFactors + index + 1, lifetimeFactors + pCount, lifetimeFactors + index);
+		std::move(lifetimes + index + 1, lifetimes + pCount, lifetimes + index);
+		std::move(progress + index + 1, progress + pCount, progress + index);
+		std::move(casts + index + 1, casts + pCount, casts + index);
+	}
+	RemoveLast();
+}
+
+void debpParticleStore::RemoveLast(){
+	DEASSERT_TRUE(pCount > 0)
+	
+	pCount--;
+	pCasts[pCount].trailEmitter = nullptr;
+}
@@ -0,0 +1,215 @@
+/*
+ * MIT License
+ *
+ * Copyright (C) 2026, DragonDreams GmbH (info@dragondreams.ch)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DEBPPARTICLESTORE_H_
+#define _DEBPPARTICLESTORE_H_
+
+#include "LinearMath/btVector3.h"
+
+#include <dragengine/common/collection/decTList.h>
+#include <dragengine/resources/particle/deParticleEmitterInstance.h>
+
+
+/**
+ * \brief Particle store.
+ * 
+ * Stores particles as structure of arrays. Simulation state touched every simulation step
+ * is stored in individual arrays to allow tight loops over them. Progress parameters
+ * updated once per frame and cast parameters only read while casting or on collisions
+ * are stored in separate arrays to keep them out of the cache while stepping.
+ */
+class debpParticleStore{
+public:
+	/** \brief Progress parameters updated once per frame. */
+	struct sProgress{
+		btVector3 gravity = btVector3(BT_ZERO, BT_ZERO, BT_ZERO);
+		float size = 0.0f;
+		float brown = 0.0f;
+		float elasticity = 0.0f;
+		float roughness = 0.0f;
+		float forceFieldDirect = 0.0f;
+		float forceFieldSurface = 0.0f;
+		float forceFieldMass = 0.0f;
+		float forceFieldSpeed = 0.0f;
+	};
+	
+	/** \brief Cast parameters. */
+	struct sCast{
+		float size = 0.0f;
+		float mass = 0.0f;
+		float rotation = 0.0f;
+		float linearVelocity = 0.0f;
+		float angularVelocity = 0.0f;
+		float brown = 0.0f;
+		float damp = 0.0f;
+		float drag = 0.0f;
+		btVector3 gravity = btVector3(BT_ZERO, BT_ZERO, BT_ZERO);
+		float localGravity = 0.0f;
+		float forceFieldDirect = 0.0f;
+		float forceFieldSurface = 0.0f;
+		float forceFieldMass = 0.0f;
+		float forceFieldSpeed = 0.0f;
+		float elasticity = 0.0f;
+		float roughness = 0.0f;
+		float emitDirection = 0.0f;
+		
+		float emissivity = 0.0f;
+		unsigned char red = 0;
+		unsigned char green = 0;
+		unsigned char blue = 0;
+		unsigned char transparency = 0;
+		
+		deParticleEmitterInstance::Ref trailEmitter = {};
+	};
+	
+	
+	
+private:
+	int pCount;
+	
+	decTList<btVector3> pPositions;
+	decTList<btVector3> pLinearVelocities;
+	decTList<btVector3> pForces;
+	decTList<float> pRotations;
+	decTList<float> pAngularVelocities;
+	decTList<float> pMasses;
+	decTList<float> pDrags;
+	decTList<float> pDamps;
+	
+	decTList<float> pTimeToLives;
+	decTList<float> pLifetimeFactors;
+	decTList<float> pLifetimes;
+	
+	decTList<sProgress> pProgress;
+	decTList<sCast> pCasts;
+	
+	
+	
+public:
+	/** \name Constructors and Destructors */
+	/*@{*/
+	/** \brief Create particle store. */
+	debpParticleStore();
+	
+	/** \brief Clean up particle store. */
+	~debpParticleStore();
+	/*@}*/
+	
+	
+	
+	/** \name Management */
+	/*@{*/
+	/** \brief Count of particles. */
+	inline int GetCount() const{ return pCount; }
+	
+	/** \brief Count of particles storage is allocated for. */
+	inline int GetCapacity() const{ return pPositions.GetCount(); }
+	
+	/** \brief Ensure storage is allocated for at least capacity particles. */
+	void EnsureCapacity(int capacity);
+	
+	/**
+	 * \brief Add particle returning its index.
+	 * 
+	 * Particle values are not initialized.
+	 */
+	int Add();
+	
+	/** \brief Copy particle values from index to another index. */
+	void Copy(int from, int to);
+	
+	/**
+	 * \brief Remove particle moving the last particle into its place.
+	 * 
+	 * Trail emitter of particle is dropped.
+	 */
+	void RemoveSwap(int index);
+	
+	/**
+	 * \brief Remove particle moving all following particles down by one.
+	 * 
+	 * Trail emitter of particle is dropped. Keeps particle order intact.
+	 */
+	void RemoveShift(int index);
+	
+	/** \brief Remove last particle dropping its trail emitter. */
+	void RemoveLast();
+	
+	
+	
+	/** \brief Positions. */
+	inline btVector3 *GetPositions(){ return pPositions.GetArrayPointer(); }
+	inline const btVector3 *GetPositions() const{ return pPositions.GetArrayPointer(); }
+	
+	/** \brief Linear velocities. */
+	inline btVector3 *GetLinearVelocities(){ return pLinearVelocities.GetArrayPointer(); }
+	inline const btVector3 *GetLinearVelocities() const{ return pLinearVelocities.GetArrayPointer(); }
+	
+	/** \brief Forces. */
+	inline btVector3 *GetForces(){ return pForces.GetArrayPointer(); }
+	inline const btVector3 *GetForces() const{ return pForces.GetArrayPointer(); }
+	
+	/** \brief Rotations. */
+	inline float *GetRotations(){ return pRotations.GetArrayPointer(); }
+	inline const float *GetRotations() const{ return pRotations.GetArrayPointer(); }
+	
+	/** \brief Angular velocities. */
+	inline float *GetAngularVelocities(){ return pAngularVelocities.GetArrayPointer(); }
+	inline const float *GetAngularVelocities() const{ return pAngularVelocities.GetArrayPointer(); }
+	
+	/** \brief Masses. */
+	inline float *GetMasses(){ return pMasses.GetArrayPointer(); }
+	inline const float *GetMasses() const{ return pMasses.GetArrayPointer(); }
+	
+	/** \brief Drags. */
+	inline float *GetDrags(){ return pDrags.GetArrayPointer(); }
+	inline const float *GetDrags() const{ return pDrags.GetArrayPointer(); }
+	
+	/** \brief Dampings. */
+	inline float *GetDamps(){ return pDamps.GetArrayPointer(); }
+	inline const float *GetDamps() const{ return pDamps.GetArrayPointer(); }
+	
+	/** \brief Time to live. */
+	inline float *GetTimeToLives(){ return pTimeToLives.GetArrayPointer(); }
+	inline const float *GetTimeToLives() const{ return pTimeToLives.GetArrayPointer(); }
+	
+	/** \brief Lifetime factors. */
+	inline float *GetLifetimeFactors(){ return pLifetimeFactors.GetArrayPointer(); }
+	inline const float *GetLifetimeFactors() const{ return pLifetimeFactors.GetArrayPointer(); }
+	
+	/** \brief Lifetimes in the range from 0 to 1. */
+	inline float *GetLifetimes(){ return pLifetimes.GetArrayPointer(); }
+	inline const float *GetLifetimes() const{ return pLifetimes.GetArrayPointer(); }
+	
+	/** \brief Progress parameters. */
+	inline sProgress *GetProgress(){ return pProgress.GetArrayPointer(); }
+	inline const sProgress *GetProgress() const{ return pProgress.GetArrayPointer(); }
+	
+	/** \brief Cast parameters. */
+	inline sCast *GetCasts(){ return pCasts.GetArrayPointer(); }
+	inline const sCast *GetCasts() const{ return pCasts.GetArrayPointer(); }
+	/*@}*/
+};
+
+#endif
@@ -26,6 +26,7 @@
 #include "../debpBulletShape.h"
 #include "../debpBulletCompoundShape.h"
 #include "../dePhysicsBullet.h"
+#include "../coldet/debpConvexHullShape.h"
 
 #include <dragengine/common/exceptions.h>
 #include <dragengine/common/shape/decShapeBox.h>
@@ -273,7 +274,7 @@ void debpCreateBulletShape::VisitShapeBox(decShapeBox &box){
 #ifdef DEBUGGING
 printf("debpCreateBulletShape.VisitShapeBox: hull\n");
 #endif
-		hullShape = new btConvexHullShape;
+		hullShape = new debpConvexHullShape;
 		
 		hullShape->addPoint(btVector3((btScalar)taperedHalfExtendX, (btScalar)halfExtends.y, (btScalar)taperedHalfExtendZ));
 		hullShape->addPoint(btVector3((btScalar)-taperedHalfExtendX, (btScalar)halfExtends.y, (btScalar)taperedHalfExtendZ));
@@ -346,7 +347,7 @@ void debpCreateBulletShape::VisitShapeCylinder(decShapeCylinder &cylinder){
 	if(hasTopScaling || hasBottomScaling || fabsf(topRadius - bottomRadius) > 0.001f){
 		// create convex hull approximation for scaled cylinders
 		// with 16 points per circle and 2 circles this results in 32 hull points
-		auto hullShape = new btConvexHullShape();
+		auto hullShape = new debpConvexHullShape();
 		
 		const int pointsPerCircle = 16;
 		
@@ -450,7 +451,7 @@ void debpCreateBulletShape::VisitShapeCapsule(decShapeCapsule &capsule){
 		// with 12 segments and 16 points per segment this results in 194 hull points:
 		// - 2 pole points
 		// - 12 segments * 16 points per segment = 192 points
-		auto hullShape = new btConvexHullShape();
+		auto hullShape = new debpConvexHullShape();
 		
 		const int segments = 12;
 		const int pointsPerSegment = 16; //8
@@ -558,7 +559,7 @@ void debpCreateBulletShape::VisitShapeHull(decShapeHull &hull){
 	bool needsTransform = false;
 	int i;
 	
-	hullShape = new btConvexHullShape;
+	hullShape = new debpConvexHullShape;
 	
 	for(i=0; i<pointCount; i++){
 		const decVector &p = hull.GetPoints().GetAt(i);
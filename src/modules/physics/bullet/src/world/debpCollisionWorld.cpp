@@ -32,6 +32,7 @@
 #include "../debpCollisionObject.h"
 #include "../coldet/debpCollisionDetection.h"
 #include "../coldet/debpBulletShapeCollision.h"
+#include "../coldet/debpRayCastBatch.h"
 #include "../coldet/collision/debpDECollisionDetection.h"
 #include "../coldet/collision/debpDCollisionBox.h"
 #include "../collider/debpCollider.h"
@@ -635,6 +636,19 @@ btCollisionWorld::RayResultCallback &resultCallback) const{
 	}
 }
 
+void debpCollisionWorld::safeRayTest(debpRayCastBatch &batch, deCollisionInfo &colInfo){
+	pDelayedOperation->Lock();
+	
+	try{
+		batch.RayTest(*this, colInfo);
+		pDelayedOperation->Unlock();
+		
+	}catch(const deException &){
+		pDelayedOperation->Unlock();
+		throw;
+	}
+}
+
 void debpCollisionWorld::safeConvexSweepTest(const btConvexShape *castShape,
 const btTransform &from, const btTransform &to,
 btCollisionWorld::ConvexResultCallback &resultCallback,
@@ -31,6 +31,8 @@
 #include <dragengine/common/utils/decTimer.h>
 
 class debpDelayedOperation;
+class debpRayCastBatch;
+class deCollisionInfo;
 class debpWorld;
 class debpConstraintSolver;
 
@@ -91,6 +93,18 @@ public:
 	void safeRayTest(const btVector3 &rayFromWorld, const btVector3 &rayToWorld,
 		RayResultCallback &resultCallback) const;
 	
+	/**
+	 * \brief Script callback safe batched ray testing.
+	 * 
+	 * Casts all rays of the batch against the objects in the btCollisionWorld calling the
+	 * listeners of the rays for each hit.
+	 * 
+	 * Protects debpRayCastBatch::RayTest by locking delayed operations.
+	 * 
+	 * \note used by debpCollisionDetection.
+	 */
+	void safeRayTest(debpRayCastBatch &batch, deCollisionInfo &colInfo);
+	
 	/**
 	 * \brief Script callback safe convex sweep testing.
 	 * 
@@ -39,11 +39,13 @@
 #include "../debug/debpDebug.h"
 #include "../debug/debpDebugInformation.h"
 #include "../coldet/debpCollisionDetection.h"
+#include "../coldet/debpRayCastBatch.h"
 #include "../coldet/unstuck/debpUnstuckCollider.h"
 #include "../coldet/collision/debpDCollisionSphere.h"
 #include "../coldet/collision/debpDCollisionBox.h"
 #include "../coldet/collision/debpDCollisionTriangle.h"
 #include "../collider/debpCollider.h"
+#include "../collider/debpColliderCollisionTest.h"
 #include "../collider/debpColliderVolume.h"
 #include "../collider/debpColliderComponent.h"
 #include "../component/debpComponent.h"
@@ -131,6 +133,7 @@ pColDetPrepareColliderCount(0),
 pColDetPrepareColliderProcessCount(0),
 pColDetFinishColliderCount(0),
 pPPCTColliderCount(0),
+pPPCTRayBatch(NULL),
 pUpdateOctreeColliderCount(0),
 
 // max steps = max time (0.1s) divided by frquency (1/60) = 6
@@ -147,6 +150,7 @@ pProcessingPhysics(false)
 	try{
 		pColInfo = deCollisionInfo::Ref::New();
 		pUnstuckCollider = new debpUnstuckCollider(*this);
+		pPPCTRayBatch = new debpRayCastBatch(bullet);
 		
 		pSharedCollisionFiltering = new debpSharedCollisionFiltering;
 		
@@ -425,6 +429,18 @@ void debpWorld::pPPCTColliderRemove(debpCollider *collider){
 	collider->SetPPCProcessingIndex(-1);
 }
 
+void debpWorld::pPPCTRayBatchTestRemove(debpColliderCollisionTest *test){
+	if(test->GetRayBatchIndex() == -1){
+		return;
+	}
+	
+	// scripts called while the batch is processed can remove tests or colliders. the ray
+	// is kept to not change the indices but is ignored from now on
+	pPPCTRayBatch->RemoveRayListener(test->GetRayBatchIndex());
+	pPPCTRayBatchTests.SetAt(test->GetRayBatchIndex(), nullptr);
+	test->SetRayBatchIndex(-1);
+}
+
 
 void debpWorld::pUpdateOctreeColliderAdd(debpCollider *collider){
 	if(collider->GetUpdateOctreeIndex() != -1){
@@ -667,6 +683,8 @@ DEBUG_PRINT_TIMER_TOTAL();
 			((debpCollider*)collider->GetPeerPhysics())->UpdateDebugDrawer();
 		});
 	}
+	
+	pBullet.GetDeveloperMode().BenchmarkRayCast(*this);
 }
 
 
@@ -946,6 +964,9 @@ void debpWorld::pCleanUp(){
 	if(pUnstuckCollider){
 		delete pUnstuckCollider;
 	}
+	if(pPPCTRayBatch){
+		delete pPPCTRayBatch;
+	}
 	if(pDynWorld){
 		delete pDynWorld;
 	}
@@ -1401,15 +1422,23 @@ void debpWorld::pStepParticleEmitters(float elapsed){
 		emitterInstance.PrepareParticles(elapsed);
 	});
 	
-	// stpe particles
+	// step particles. particle motion is integrated in parallel. collision tests are done
+	// afterwards in the main thread since they access the collision world and scripting
 	const float maxStepSize = 1.0f / 30.0f;
 	while(elapsed > FLOAT_SAFE_EPSILON){
 		const float stepElapsed = decMath::min(elapsed, maxStepSize);
 		
+		pWorld.GetParticleEmitters().Visit([&](deParticleEmitterInstance *engEmitterInstance){
+			debpParticleEmitterInstance &emitterInstance = *((debpParticleEmitterInstance*)engEmitterInstance->GetPeerPhysics());
+			emitterInstance.IntegrateParticlesParallel(stepElapsed, pParticleStepTasks);
+		});
+		
+		pWaitParticleStepTasks();
+		
 		//int debugCount = 0;
 		pWorld.GetParticleEmitters().Visit([&](deParticleEmitterInstance *engEmitterInstance){
 			debpParticleEmitterInstance &emitterInstance = *((debpParticleEmitterInstance*)engEmitterInstance->GetPeerPhysics());
-			emitterInstance.StepParticles(stepElapsed);
+			emitterInstance.CollideParticles(stepElapsed);
 			//debugCount++;
 		});
 		//pBullet.LogInfoFormat( "pParticleEmittersStep: processed instances %i\n", debugCount );
@@ -1426,6 +1455,18 @@ void debpWorld::pStepParticleEmitters(float elapsed){
 //printf( "pParticleEmittersStep = %iys\n", ( int )( timer2.GetElapsedTime() * 1000000.0f ) );
 }
 
+void debpWorld::pWaitParticleStepTasks(){
+	if(pParticleStepTasks.IsEmpty()){
+		return;
+	}
+	
+	deParallelProcessing &parallel = pBullet.GetGameEngine()->GetParallelProcessing();
+	pParticleStepTasks.Visit([&](deParallelTask *task){
+		parallel.WaitForTask(task);
+	});
+	pParticleStepTasks.RemoveAll();
+}
+
 
 
 void debpWorld::pUpdateFromBody(){
@@ -1561,6 +1602,8 @@ void debpWorld::pUpdatePostPhysicsCollisionTests(){
 		pPerfTimer.Reset();
 	}
 	
+	pPPCTRayBatchClear();
+	
 	const int count = pPPCTColliderCount;
 	int next = 0;
 	pPPCTColliders.VisitIndexed(0, count, [&](int i, debpCollider *collider){
@@ -1575,7 +1618,7 @@ void debpWorld::pUpdatePostPhysicsCollisionTests(){
 		}
 		next++;
 		
-		collider->ProcessColliderCollisionTests();
+		collider->ProcessColliderCollisionTests(*pPPCTRayBatch, pPPCTRayBatchTests);
 		
 		if(debugInfo){
 			debugInfo->IncrementElapsedTime(pPerfTimer.GetElapsedTime());
@@ -1583,6 +1626,26 @@ void debpWorld::pUpdatePostPhysicsCollisionTests(){
 		}
 	});
 	
+	// ray tests are cast together with the narrow phase running in parallel tasks. the hits
+	// are delivered on this thread sorted by ray in the order the tests have been added
+	if(pPPCTRayBatchTests.IsNotEmpty()){
+		pBullet.GetCollisionDetection().RayHits(*pPPCTRayBatch, *this);
+		
+		pPPCTRayBatchTests.Visit([](debpColliderCollisionTest *test){
+			if(test){
+				test->SetCollisionTestResult();
+			}
+		});
+		
+		if(debugInfo){
+			debpDebugInformation * const debugInfoRays = pBullet.GetDebug().GetDIColliderCollisionTestRays();
+			debugInfoRays->IncrementElapsedTime(pPerfTimer.GetElapsedTime());
+			debugInfoRays->IncrementCounter(pPPCTRayBatchTests.GetCount());
+		}
+		
+		pPPCTRayBatchClear();
+	}
+	
 	pPPCTColliders.VisitIndexed(count, pPPCTColliderCount, [&](int i, debpCollider *collider){
 		if(!collider){
 			return;
@@ -1599,6 +1662,17 @@ void debpWorld::pUpdatePostPhysicsCollisionTests(){
 	pPPCTColliderCount = next;
 }
 
+void debpWorld::pPPCTRayBatchClear(){
+	pPPCTRayBatchTests.Visit([](debpColliderCollisionTest *test){
+		if(test){
+			test->SetRayBatchIndex(-1);
+		}
+	});
+	
+	pPPCTRayBatch->RemoveAllRays();
+	pPPCTRayBatchTests.SetCountDiscard(0);
+}
+
 void debpWorld::pApplyTouchSensorChanges(){
 	debpDebugInformation *debugInfo = nullptr;
 	if(pBullet.GetDebug().GetEnabled()){
@@ -29,6 +29,7 @@
 #include <dragengine/common/collection/decTOrderedSet.h>
 #include <dragengine/common/utils/decTimer.h>
 #include <dragengine/common/utils/decLayerMask.h>
+#include <dragengine/parallel/deParallelTask.h>
 #include <dragengine/resources/collider/deCollisionInfo.h>
 #include <dragengine/systems/modules/physics/deBasePhysicsWorld.h>
 
@@ -42,6 +43,8 @@ class debpPhysicsBody;
 class debpOverlapFilterCallback;
 class debpUnstuckCollider;
 class debpCollider;
+class debpColliderCollisionTest;
+class debpRayCastBatch;
 class debpSharedCollisionFiltering;
 class debpConstraintSolver;
 
@@ -92,10 +95,14 @@ private:
 	
 	decTList<debpCollider*> pPPCTColliders;
 	int pPPCTColliderCount;
+	debpRayCastBatch *pPPCTRayBatch;
+	decTList<debpColliderCollisionTest*> pPPCTRayBatchTests;
 	
 	decTList<debpCollider*> pUpdateOctreeColliders;
 	int pUpdateOctreeColliderCount;
 	
+	deParallelTask::TaskList pParticleStepTasks;
+	
 	int pSimMaxSubStep;
 	float pSimTimeStep;
 	
@@ -195,6 +202,9 @@ public:
 	/** Remove collider for post physics collision test processing. */
 	void pPPCTColliderRemove(debpCollider *collider);
 	
+	/** Remove collision test from post physics collision test ray batch. */
+	void pPPCTRayBatchTestRemove(debpColliderCollisionTest *test);
+	
 	
 	
 	/** Add collider for update octree processing. */
@@ -359,6 +369,7 @@ private:
 	
 	void pPrepareParticleEmitters(float elapsed);
 	void pStepParticleEmitters(float elapsed);
+	void pWaitParticleStepTasks();
 	
 	void pUpdateFromBody();
 	void pFinishDetection();
@@ -366,6 +377,9 @@ private:
 	/** Update collider post physics collision tests. */
 	void pUpdatePostPhysicsCollisionTests();
 	
+	/** Remove all rays and tests from post physics collision test ray batch. */
+	void pPPCTRayBatchClear();
+	
 	/**
 	 * Make touch sensors notify their peers about touch changes accumulated during collision detection.
 	 * \details This potentially modifies colliders including adding or removing them.
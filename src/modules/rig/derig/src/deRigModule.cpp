@@ -39,11 +39,9 @@
 #include <dragengine/common/shape/decShapeHull.h>
 #include <dragengine/common/file/decBaseFileReader.h>
 #include <dragengine/common/file/decBaseFileWriter.h>
-#include <dragengine/common/xmlparser/decXmlParser.h>
-#include <dragengine/common/xmlparser/decXmlDocument.h>
-#include <dragengine/common/xmlparser/decXmlElementTag.h>
-#include <dragengine/common/xmlparser/decXmlCharacterData.h>
-#include <dragengine/common/xmlparser/decXmlAttValue.h>
+#include <dragengine/common/file/decPath.h>
+#include <dragengine/common/xmlparser/decXmlBinaryDocument.h>
+#include <dragengine/common/xmlparser/decXmlBinaryElement.h>
 #include <dragengine/common/xmlparser/decXmlVisitor.h>
 #include <dragengine/common/xmlparser/decXmlWriter.h>
 #include <dragengine/resources/rig/deRig.h>
@@ -91,7 +89,8 @@ deBaseModule *DERigCreateModule(deLoadableModule *loadableModule){
 ////////////////////////////
 
 deRigModule::deRigModule(deLoadableModule &loadableModule) :
-deBaseRigModule(loadableModule){
+deBaseRigModule(loadableModule),
+pXmlCache(&GetVFS(), decPath::CreatePathUnix("/cache/local/xml")){
 }
 
 deRigModule::~deRigModule(){
@@ -103,14 +102,10 @@ deRigModule::~deRigModule(){
 ///////////////////////
 
 void deRigModule::LoadRig(decBaseFileReader &file, deRig &rig){
-	decXmlDocument::Ref xmlDoc(decXmlDocument::Ref::New());
+	const decXmlBinaryDocument::Ref xmlDoc(pXmlCache.Load(
+		file, rig.GetFilename(), *GetGameEngine()->GetLogger()));
 	
-	decXmlParser(GetGameEngine()->GetLogger()).ParseXml(&file, xmlDoc);
-	
-	xmlDoc->StripComments();
-	xmlDoc->CleanCharData();
-	
-	decXmlElementTag * const root = xmlDoc->GetRoot();
+	const decXmlBinaryElement * const root = xmlDoc->GetRoot();
 	if(!root || strcmp(root->GetName(), "rig") != 0){
 		DETHROW(deeInvalidParam);
 	}
@@ -129,8 +124,8 @@ void deRigModule::SaveRig(decBaseFileWriter &file, const deRig &rig){
 // Private functions
 //////////////////////
 
-decXmlElementTag *deRigModule::pGetTagAt(decXmlElementTag *tag, int index){
-	decXmlElement *element = tag->GetElementAt(index);
+const decXmlBinaryElement *deRigModule::pGetTagAt(const decXmlBinaryElement *tag, int index){
+	const decXmlBinaryElement *element = tag->GetElementAt(index);
 	
 	if(element->CanCastToElementTag()){
 		return element->CastToElementTag();
@@ -140,8 +135,8 @@ decXmlElementTag *deRigModule::pGetTagAt(decXmlElementTag *tag, int index){
 	}
 }
 
-decXmlElementTag *deRigModule::pGetTagAt(const decXmlElementTag &tag, int index){
-	decXmlElement * const element = tag.GetElementAt(index);
+const decXmlBinaryElement *deRigModule::pGetTagAt(const decXmlBinaryElement &tag, int index){
+	const decXmlBinaryElement * const element = tag.GetElementAt(index);
 	
 	if(element->CanCastToElementTag()){
 		return element->CastToElementTag();
@@ -151,9 +146,9 @@ decXmlElementTag *deRigModule::pGetTagAt(const decXmlElementTag &tag, int index)
 	}
 }
 
-decXmlAttValue *deRigModule::pFindAttribute(decXmlElementTag *tag, const char *name){
-	decXmlAttValue *value;
-	decXmlElement *element;
+const decXmlBinaryElement *deRigModule::pFindAttribute(const decXmlBinaryElement *tag, const char *name){
+	const decXmlBinaryElement *value;
+	const decXmlBinaryElement *element;
 	int i;
 	
 	for(i=0; i<tag->GetElementCount(); i++){
@@ -169,8 +164,8 @@ decXmlAttValue *deRigModule::pFindAttribute(decXmlElementTag *tag, const char *n
 	return nullptr;
 }
 
-const char *deRigModule::pGetAttributeString(decXmlElementTag *tag, const char *name){
-	decXmlAttValue *value = pFindAttribute(tag, name);
+const char *deRigModule::pGetAttributeString(const decXmlBinaryElement *tag, const char *name){
+	const decXmlBinaryElement *value = pFindAttribute(tag, name);
 	
 	if(value){
 		return value->GetValue();
@@ -181,8 +176,8 @@ const char *deRigModule::pGetAttributeString(decXmlElementTag *tag, const char *
 	}
 }
 
-int deRigModule::pGetAttributeInt(decXmlElementTag *tag, const char *name){
-	decXmlAttValue *value = pFindAttribute(tag, name);
+int deRigModule::pGetAttributeInt(const decXmlBinaryElement *tag, const char *name){
+	const decXmlBinaryElement *value = pFindAttribute(tag, name);
 	
 	if(value){
 		return (int)strtol(value->GetValue(), nullptr, 10);
@@ -193,8 +188,8 @@ int deRigModule::pGetAttributeInt(decXmlElementTag *tag, const char *name){
 	}
 }
 
-float deRigModule::pGetAttributeFloat(decXmlElementTag *tag, const char *name){
-	decXmlAttValue *value = pFindAttribute(tag, name);
+float deRigModule::pGetAttributeFloat(const decXmlBinaryElement *tag, const char *name){
+	const decXmlBinaryElement *value = pFindAttribute(tag, name);
 	
 	if(value){
 		return strtof(value->GetValue(), nullptr);
@@ -207,11 +202,11 @@ float deRigModule::pGetAttributeFloat(decXmlElementTag *tag, const char *name){
 
 
 
-void deRigModule::pParseRig(decXmlElementTag *root, deRig &rig){
+void deRigModule::pParseRig(const decXmlBinaryElement *root, deRig &rig){
 	const char *rootBone = nullptr;
-	decXmlCharacterData *cdata;
+	const decXmlBinaryElement *cdata;
 	dermName::List boneNameList;
-	decXmlElementTag *tag;
+	const decXmlBinaryElement *tag;
 	int c, constraintCount;
 	decVector vector;
 	int i;
@@ -313,14 +308,14 @@ void deRigModule::pParseRig(decXmlElementTag *root, deRig &rig){
 	}
 }
 
-void deRigModule::pParseBone(decXmlElementTag *root, deRig &rig, dermName::List &boneNameList){
+void deRigModule::pParseBone(const decXmlBinaryElement *root, deRig &rig, dermName::List &boneNameList){
 	decVector ikLimitsLower(TWO_PI, TWO_PI, TWO_PI);
 	decVector ikLimitsUpper(0.0f, 0.0f, 0.0f);
 	decVector ikResistance(0.0f, 0.0f, 0.0f);
 	bool ikLocked[3] = {false, false, false};
-	decXmlCharacterData *cdata;
+	const decXmlBinaryElement *cdata;
 	const char *name = nullptr;
-	decXmlElementTag *tag;
+	const decXmlBinaryElement *tag;
 	decVector vector;
 	int i;
 	
@@ -460,9 +455,9 @@ void deRigModule::pParseBone(decXmlElementTag *root, deRig &rig, dermName::List
 	}
 }
 
-void deRigModule::pParseBoneIK(decXmlElementTag *root, float &lower, float &upper, float &resistance, bool &locked){
-	decXmlCharacterData *cdata;
-	decXmlElementTag *tag;
+void deRigModule::pParseBoneIK(const decXmlBinaryElement *root, float &lower, float &upper, float &resistance, bool &locked){
+	const decXmlBinaryElement *cdata;
+	const decXmlBinaryElement *tag;
 	int i;
 	
 	for(i=0; i<root->GetElementCount(); i++){
@@ -513,8 +508,8 @@ void deRigModule::pParseBoneIK(decXmlElementTag *root, float &lower, float &uppe
 	}
 }
 
-void deRigModule::pParseSphere(decXmlElementTag *root, decShape::List &shapes, decStringList &shapeProperties){
-	decXmlElementTag *tag;
+void deRigModule::pParseSphere(const decXmlBinaryElement *root, decShape::List &shapes, decStringList &shapeProperties){
+	const decXmlBinaryElement *tag;
 	decString property;
 	decVector2 vector2;
 	decVector vector;
@@ -572,8 +567,8 @@ void deRigModule::pParseSphere(decXmlElementTag *root, decShape::List &shapes, d
 	shapes.Add(std::move(sphere));
 }
 
-void deRigModule::pParseCylinder(decXmlElementTag *root, decShape::List &shapes, decStringList &shapeProperties){
-	decXmlElementTag *tag;
+void deRigModule::pParseCylinder(const decXmlBinaryElement *root, decShape::List &shapes, decStringList &shapeProperties){
+	const decXmlBinaryElement *tag;
 	decString property;
 	decVector2 vector2;
 	decVector vector;
@@ -661,8 +656,8 @@ void deRigModule::pParseCylinder(decXmlElementTag *root, decShape::List &shapes,
 		shapes.Add(std::move(cylinder));
 }
 
-void deRigModule::pParseCapsule(decXmlElementTag *root, decShape::List &shapes, decStringList &shapeProperties){
-	decXmlElementTag *tag;
+void deRigModule::pParseCapsule(const decXmlBinaryElement *root, decShape::List &shapes, decStringList &shapeProperties){
+	const decXmlBinaryElement *tag;
 	decString property;
 	decVector2 vector2;
 	decVector vector;
@@ -750,8 +745,8 @@ void deRigModule::pParseCapsule(decXmlElementTag *root, decShape::List &shapes,
 		shapes.Add(std::move(capsule));
 }
 
-void deRigModule::pParseBox(decXmlElementTag *root, decShape::List &shapes, decStringList &shapeProperties){
-	decXmlElementTag *tag;
+void deRigModule::pParseBox(const decXmlBinaryElement *root, decShape::List &shapes, decStringList &shapeProperties){
+	const decXmlBinaryElement *tag;
 	decString property;
 	decVector2 vector2;
 	decVector vector;
@@ -799,7 +794,7 @@ void deRigModule::pParseBox(decXmlElementTag *root, decShape::List &shapes, decS
 		shapes.Add(std::move(box));
 }
 
-void deRigModule::pParseHull(decXmlElementTag *root, decShape::List &shapes, decStringList &shapeProperties){
+void deRigModule::pParseHull(const decXmlBinaryElement *root, decShape::List &shapes, decStringList &shapeProperties){
 	decString property;
 	decVector vector;
 	int i;
@@ -808,7 +803,7 @@ void deRigModule::pParseHull(decXmlElementTag *root, decShape::List &shapes, dec
 		
 		int pointCount = 0;
 		for(i=0; i<root->GetElementCount(); i++){
-			decXmlElementTag * const tag = pGetTagAt(root, i);
+			const decXmlBinaryElement * const tag = pGetTagAt(root, i);
 			if(tag && tag->GetName() == "point"){
 				pointCount++;
 			}
@@ -817,7 +812,7 @@ void deRigModule::pParseHull(decXmlElementTag *root, decShape::List &shapes, dec
 		
 		int pointIndex = 0;
 		for(i=0; i<root->GetElementCount(); i++){
-			decXmlElementTag * const tag = pGetTagAt(root, i);
+			const decXmlBinaryElement * const tag = pGetTagAt(root, i);
 			if(!tag){
 				continue;
 			}
@@ -838,7 +833,7 @@ void deRigModule::pParseHull(decXmlElementTag *root, decShape::List &shapes, dec
 				hull->SetPointAt(pointIndex++, vector);
 				
 			}else if(tag->GetName() == "property"){
-				const decXmlCharacterData * const cdata = tag->GetFirstData();
+				const decXmlBinaryElement * const cdata = tag->GetFirstData();
 				
 				if(cdata){
 					property = cdata->GetData();
@@ -853,9 +848,9 @@ void deRigModule::pParseHull(decXmlElementTag *root, decShape::List &shapes, dec
 		shapes.Add(std::move(hull));
 }
 
-void deRigModule::pParseConstraint(decXmlElementTag *root, deRig &rig, deRigBone *bone, dermName::List &boneNameList){
-	decXmlCharacterData *cdata;
-	decXmlElementTag *tag;
+void deRigModule::pParseConstraint(const decXmlBinaryElement *root, deRig &rig, deRigBone *bone, dermName::List &boneNameList){
+	const decXmlBinaryElement *cdata;
+	const decXmlBinaryElement *tag;
 	decVector vector;
 	int i;
 	
@@ -955,18 +950,18 @@ void deRigModule::pParseConstraint(decXmlElementTag *root, deRig &rig, deRigBone
 	}catch(const deException &){
 		throw;
 	}
-}void deRigModule::pParseConstraintDof(const decXmlElementTag &root,
+}void deRigModule::pParseConstraintDof(const decXmlBinaryElement &root,
 deColliderConstraintDof &dof, bool linearConstraint){
 	const int count = root.GetElementCount();
 	float value;
 	int i;
 	
 	for(i=0; i<count; i++){
-		const decXmlElementTag * const tag = pGetTagAt(root, i);
+		const decXmlBinaryElement * const tag = pGetTagAt(root, i);
 		
 		if(tag){
 			if(strcmp(tag->GetName(), "limitLower") == 0){
-				const decXmlCharacterData * const cdata = tag->GetFirstData();
+				const decXmlBinaryElement * const cdata = tag->GetFirstData();
 				
 				if(cdata){
 					value = strtof(cdata->GetData(), nullptr);
@@ -979,7 +974,7 @@ deColliderConstraintDof &dof, bool linearConstraint){
 				}
 				
 			}else if(strcmp(tag->GetName(), "limitUpper") == 0){
-				const decXmlCharacterData * const cdata = tag->GetFirstData();
+				const decXmlBinaryElement * const cdata = tag->GetFirstData();
 				
 				if(cdata){
 					value = strtof(cdata->GetData(), nullptr);
@@ -992,19 +987,19 @@ deColliderConstraintDof &dof, bool linearConstraint){
 				}
 				
 			}else if(strcmp(tag->GetName(), "staticFriction") == 0){
-				const decXmlCharacterData * const cdata = tag->GetFirstData();
+				const decXmlBinaryElement * const cdata = tag->GetFirstData();
 				if(cdata){
 					dof.SetStaticFriction(strtof(cdata->GetData(), nullptr));
 				}
 				
 			}else if(strcmp(tag->GetName(), "kinematicFriction") == 0){
-				const decXmlCharacterData * const cdata = tag->GetFirstData();
+				const decXmlBinaryElement * const cdata = tag->GetFirstData();
 				if(cdata){
 					dof.SetKinematicFriction(strtof(cdata->GetData(), nullptr));
 				}
 				
 			}else if(strcmp(tag->GetName(), "springStiffness") == 0){
-				const decXmlCharacterData * const cdata = tag->GetFirstData();
+				const decXmlBinaryElement * const cdata = tag->GetFirstData();
 				if(cdata){
 					dof.SetSpringStiffness(strtof(cdata->GetData(), nullptr));
 				}
@@ -1013,8 +1008,8 @@ deColliderConstraintDof &dof, bool linearConstraint){
 	}
 }
 
-void deRigModule::pParseConstraintLimits(decXmlElementTag *root, deRigConstraint *constraint){
-	decXmlElementTag *tag;
+void deRigModule::pParseConstraintLimits(const decXmlBinaryElement *root, deRigConstraint *constraint){
+	const decXmlBinaryElement *tag;
 	int i;
 	
 	for(i=0; i<root->GetElementCount(); i++){
@@ -1030,9 +1025,9 @@ void deRigModule::pParseConstraintLimits(decXmlElementTag *root, deRigConstraint
 	}
 }
 
-void deRigModule::pParseConstraintLimitsLinear(decXmlElementTag *root, deRigConstraint *constraint){
+void deRigModule::pParseConstraintLimitsLinear(const decXmlBinaryElement *root, deRigConstraint *constraint){
 	decVector lower, upper;
-	decXmlElementTag *tag;
+	const decXmlBinaryElement *tag;
 	int i;
 	
 	for(i=0; i<root->GetElementCount(); i++){
@@ -1056,9 +1051,9 @@ void deRigModule::pParseConstraintLimitsLinear(decXmlElementTag *root, deRigCons
 	constraint->GetDofLinearZ().SetUpperLimit(upper.z);
 }
 
-void deRigModule::pParseConstraintLimitsAngular(decXmlElementTag *root, deRigConstraint *constraint){
+void deRigModule::pParseConstraintLimitsAngular(const decXmlBinaryElement *root, deRigConstraint *constraint){
 	decVector lower, upper;
-	decXmlElementTag *tag;
+	const decXmlBinaryElement *tag;
 	int i;
 	
 	for(i=0; i<root->GetElementCount(); i++){
@@ -1082,8 +1077,8 @@ void deRigModule::pParseConstraintLimitsAngular(decXmlElementTag *root, deRigCon
 	constraint->GetDofAngularZ().SetUpperLimit(upper.z * DEG2RAD);
 }
 
-void deRigModule::pParseConstraintSpringStiffness(decXmlElementTag *root, deRigConstraint *constraint){
-	decXmlElementTag *tag;
+void deRigModule::pParseConstraintSpringStiffness(const decXmlBinaryElement *root, deRigConstraint *constraint){
+	const decXmlBinaryElement *tag;
 	decVector vector;
 	int i;
 	
@@ -1106,9 +1101,9 @@ void deRigModule::pParseConstraintSpringStiffness(decXmlElementTag *root, deRigC
 	}
 }
 
-void deRigModule::pParseConstraintDamping(decXmlElementTag *root, deRigConstraint *constraint){
-	decXmlCharacterData *cdata;
-	decXmlElementTag *tag;
+void deRigModule::pParseConstraintDamping(const decXmlBinaryElement *root, deRigConstraint *constraint){
+	const decXmlBinaryElement *cdata;
+	const decXmlBinaryElement *tag;
 	int i;
 	
 	for(i=0; i<root->GetElementCount(); i++){
@@ -1139,8 +1134,8 @@ void deRigModule::pParseConstraintDamping(decXmlElementTag *root, deRigConstrain
 	}
 }
 
-void deRigModule::pParseVector(decXmlElementTag *root, decVector &vector){
-//	decXmlElementTag *tag;
+void deRigModule::pParseVector(const decXmlBinaryElement *root, decVector &vector){
+//	const decXmlBinaryElement *tag;
 //	int i;
 	
 	if(pFindAttribute(root, "x")){
@@ -1172,7 +1167,7 @@ void deRigModule::pParseVector(decXmlElementTag *root, decVector &vector){
 	}*/
 }
 
-void deRigModule::pParseVector2(decXmlElementTag *root, decVector2 &vector){
+void deRigModule::pParseVector2(const decXmlBinaryElement *root, decVector2 &vector){
 	if(pFindAttribute(root, "x")){
 		vector.x = pGetAttributeFloat(root, "x");
 	}
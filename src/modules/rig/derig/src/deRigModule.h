@@ -31,9 +31,9 @@
 #include <dragengine/resources/collider/deColliderConstraint.h>
 #include <dragengine/systems/modules/rig/deBaseRigModule.h>
 #include <dragengine/common/shape/decShape.h>
+#include <dragengine/filesystem/deXmlDocumentCache.h>
 
-class decXmlElementTag;
-class decXmlAttValue;
+class decXmlBinaryElement;
 class deRigBone;
 class deRigConstraint;
 class decXmlWriter;
@@ -47,6 +47,11 @@ class decXmlWriter;
  * XML Rig File Format.
  */
 class deRigModule : public deBaseRigModule{
+private:
+	deXmlDocumentCache pXmlCache;
+	
+	
+	
 public:
 	/** \name Constructors and Destructors */
 	/*@{*/
@@ -69,30 +74,30 @@ public:
 	/*@}*/
 	
 private:
-	decXmlElementTag *pGetTagAt(decXmlElementTag *tag, int index);
-	decXmlElementTag *pGetTagAt(const decXmlElementTag &tag, int index);
-	decXmlAttValue *pFindAttribute(decXmlElementTag *tag, const char *name);
-	const char *pGetAttributeString(decXmlElementTag *tag, const char *name);
-	int pGetAttributeInt(decXmlElementTag *tag, const char *name);
-	float pGetAttributeFloat(decXmlElementTag *tag, const char *name);
+	const decXmlBinaryElement *pGetTagAt(const decXmlBinaryElement *tag, int index);
+	const decXmlBinaryElement *pGetTagAt(const decXmlBinaryElement &tag, int index);
+	const decXmlBinaryElement *pFindAttribute(const decXmlBinaryElement *tag, const char *name);
+	const char *pGetAttributeString(const decXmlBinaryElement *tag, const char *name);
+	int pGetAttributeInt(const decXmlBinaryElement *tag, const char *name);
+	float pGetAttributeFloat(const decXmlBinaryElement *tag, const char *name);
 	
-	void pParseRig(decXmlElementTag *root, deRig &rig);
-	void pParseBone(decXmlElementTag *root, deRig &rig, dermName::List &boneNameList);
-	void pParseBoneIK(decXmlElementTag *root, float &lower, float &upper, float &resistance, bool &locked);
-	void pParseSphere(decXmlElementTag *root, decShape::List &shapes, decStringList &shapeProperties);
-	void pParseCylinder(decXmlElementTag *root, decShape::List &shapes, decStringList &shapeProperties);
-	void pParseCapsule(decXmlElementTag *root, decShape::List &shapes, decStringList &shapeProperties);
-	void pParseBox(decXmlElementTag *root, decShape::List &shapes, decStringList &shapeProperties);
-	void pParseHull(decXmlElementTag *root, decShape::List &shapes, decStringList &shapeProperties);
-	void pParseVector(decXmlElementTag *root, decVector &vector);
-	void pParseVector2(decXmlElementTag *root, decVector2 &vector);
-	void pParseConstraint(decXmlElementTag *root, deRig &rig, deRigBone *bone, dermName::List &boneNameList);
-	void pParseConstraintDof(const decXmlElementTag &root, deColliderConstraintDof &dof, bool linearConstraint);
-	void pParseConstraintLimits(decXmlElementTag *root, deRigConstraint *constraint);
-	void pParseConstraintLimitsLinear(decXmlElementTag *root, deRigConstraint *constraint);
-	void pParseConstraintLimitsAngular(decXmlElementTag *root, deRigConstraint *constraint);
-	void pParseConstraintSpringStiffness(decXmlElementTag *root, deRigConstraint *constraint);
-	void pParseConstraintDamping(decXmlElementTag *root, deRigConstraint *constraint);
+	void pParseRig(const decXmlBinaryElement *root, deRig &rig);
+	void pParseBone(const decXmlBinaryElement *root, deRig &rig, dermName::List &boneNameList);
+	void pParseBoneIK(const decXmlBinaryElement *root, float &lower, float &upper, float &resistance, bool &locked);
+	void pParseSphere(const decXmlBinaryElement *root, decShape::List &shapes, decStringList &shapeProperties);
+	void pParseCylinder(const decXmlBinaryElement *root, decShape::List &shapes, decStringList &shapeProperties);
+	void pParseCapsule(const decXmlBinaryElement *root, decShape::List &shapes, decStringList &shapeProperties);
+	void pParseBox(const decXmlBinaryElement *root, decShape::List &shapes, decStringList &shapeProperties);
+	void pParseHull(const decXmlBinaryElement *root, decShape::List &shapes, decStringList &shapeProperties);
+	void pParseVector(const decXmlBinaryElement *root, decVector &vector);
+	void pParseVector2(const decXmlBinaryElement *root, decVector2 &vector);
+	void pParseConstraint(const decXmlBinaryElement *root, deRig &rig, deRigBone *bone, dermName::List &boneNameList);
+	void pParseConstraintDof(const decXmlBinaryElement &root, deColliderConstraintDof &dof, bool linearConstraint);
+	void pParseConstraintLimits(const decXmlBinaryElement *root, deRigConstraint *constraint);
+	void pParseConstraintLimitsLinear(const decXmlBinaryElement *root, deRigConstraint *constraint);
+	void pParseConstraintLimitsAngular(const decXmlBinaryElement *root, deRigConstraint *constraint);
+	void pParseConstraintSpringStiffness(const decXmlBinaryElement *root, deRigConstraint *constraint);
+	void pParseConstraintDamping(const decXmlBinaryElement *root, deRigConstraint *constraint);
 	
 	void pWriteRig(decXmlWriter &writer, const deRig &rig);
 	void pWriteBone(decXmlWriter &writer, const deRig &rig, const deRigBone &bone);
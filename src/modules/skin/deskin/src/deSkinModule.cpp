@@ -52,11 +52,8 @@
 #include <dragengine/common/file/decPath.h>
 #include <dragengine/common/math/decMath.h>
 #include <dragengine/common/xmlparser/decXmlWriter.h>
-#include <dragengine/common/xmlparser/decXmlParser.h>
-#include <dragengine/common/xmlparser/decXmlDocument.h>
-#include <dragengine/common/xmlparser/decXmlElementTag.h>
-#include <dragengine/common/xmlparser/decXmlAttValue.h>
-#include <dragengine/common/xmlparser/decXmlCharacterData.h>
+#include <dragengine/common/xmlparser/decXmlBinaryDocument.h>
+#include <dragengine/common/xmlparser/decXmlBinaryElement.h>
 #include <dragengine/common/xmlparser/decXmlVisitor.h>
 
 
@@ -98,7 +95,8 @@ deBaseModule *DESkinCreateModule(deLoadableModule *loadableModule){
 ////////////////////////////
 
 deSkinModule::deSkinModule(deLoadableModule &loadableModule) :
-deBaseSkinModule(loadableModule){
+deBaseSkinModule(loadableModule),
+pXmlCache(&GetVFS(), decPath::CreatePathUnix("/cache/local/xml")){
 }
 
 deSkinModule::~deSkinModule(){
@@ -110,14 +108,10 @@ deSkinModule::~deSkinModule(){
 ///////////////////////
 
 void deSkinModule::LoadSkin(decBaseFileReader &file, deSkin &skin){
-	decXmlDocument::Ref xmlDoc(decXmlDocument::Ref::New());
+	const decXmlBinaryDocument::Ref xmlDoc(pXmlCache.Load(
+		file, skin.GetFilename(), *GetGameEngine()->GetLogger()));
 	
-	decXmlParser(GetGameEngine()->GetLogger()).ParseXml(&file, xmlDoc);
-	
-	xmlDoc->StripComments();
-	xmlDoc->CleanCharData();
-	
-	decXmlElementTag * const root = xmlDoc->GetRoot();
+	const decXmlBinaryElement * const root = xmlDoc->GetRoot();
 	if(!root || strcmp(root->GetName(), "skin") != 0){
 		DETHROW(deeInvalidParam);
 	}
@@ -136,8 +130,8 @@ void deSkinModule::SaveSkin(decBaseFileWriter &file, const deSkin &skin){
 // Private functions
 //////////////////////
 
-decXmlElementTag *deSkinModule::pGetTagAt(const decXmlElementTag &tag, int index){
-	decXmlElement &element = *tag.GetElementAt(index);
+const decXmlBinaryElement *deSkinModule::pGetTagAt(const decXmlBinaryElement &tag, int index){
+	const decXmlBinaryElement &element = *tag.GetElementAt(index);
 	
 	if(element.CanCastToElementTag()){
 		return element.CastToElementTag();
@@ -147,12 +141,12 @@ decXmlElementTag *deSkinModule::pGetTagAt(const decXmlElementTag &tag, int index
 	}
 }
 
-decXmlAttValue *deSkinModule::pFindAttribute(const decXmlElementTag &tag, const char *name){
-	decXmlAttValue *value;
+const decXmlBinaryElement *deSkinModule::pFindAttribute(const decXmlBinaryElement &tag, const char *name){
+	const decXmlBinaryElement *value;
 	int i;
 	
 	for(i=0; i<tag.GetElementCount(); i++){
-		decXmlElement &element = *tag.GetElementAt(i);
+		const decXmlBinaryElement &element = *tag.GetElementAt(i);
 		
 		if(element.CanCastToAttValue()){
 			value = element.CastToAttValue();
@@ -166,8 +160,8 @@ decXmlAttValue *deSkinModule::pFindAttribute(const decXmlElementTag &tag, const
 	return nullptr;
 }
 
-const char *deSkinModule::pGetAttributeString(const decXmlElementTag &tag, const char *name){
-	const decXmlAttValue * const value = pFindAttribute(tag, name);
+const char *deSkinModule::pGetAttributeString(const decXmlBinaryElement &tag, const char *name){
+	const decXmlBinaryElement * const value = pFindAttribute(tag, name);
 	
 	if(value){
 		return value->GetValue();
@@ -178,8 +172,8 @@ const char *deSkinModule::pGetAttributeString(const decXmlElementTag &tag, const
 	}
 }
 
-int deSkinModule::pGetAttributeInt(const decXmlElementTag &tag, const char *name){
-	const decXmlAttValue * const value = pFindAttribute(tag, name);
+int deSkinModule::pGetAttributeInt(const decXmlBinaryElement &tag, const char *name){
+	const decXmlBinaryElement * const value = pFindAttribute(tag, name);
 	
 	if(value){
 		return (int)strtol(value->GetValue(), nullptr, 10);
@@ -190,8 +184,8 @@ int deSkinModule::pGetAttributeInt(const decXmlElementTag &tag, const char *name
 	}
 }
 
-float deSkinModule::pGetAttributeFloat(const decXmlElementTag &tag, const char *name){
-	const decXmlAttValue * const value = pFindAttribute(tag, name);
+float deSkinModule::pGetAttributeFloat(const decXmlBinaryElement &tag, const char *name){
+	const decXmlBinaryElement * const value = pFindAttribute(tag, name);
 	
 	if(value){
 		return strtof(value->GetValue(), nullptr);
@@ -202,8 +196,8 @@ float deSkinModule::pGetAttributeFloat(const decXmlElementTag &tag, const char *
 	}
 }
 
-bool deSkinModule::pGetAttributeBool(const decXmlElementTag &tag, const char *name){
-	const decXmlAttValue * const value = tag.FindAttribute(name);
+bool deSkinModule::pGetAttributeBool(const decXmlBinaryElement &tag, const char *name){
+	const decXmlBinaryElement * const value = tag.FindAttribute(name);
 	if(!value){
 		LogErrorFormat("Missing Attribute %s in tag %s", name, tag.GetName().GetString());
 		DETHROW(deeInvalidParam);
@@ -216,8 +210,8 @@ bool deSkinModule::pGetAttributeBool(const decXmlElementTag &tag, const char *na
 
 
 
-void deSkinModule::pParseSkin(const decXmlElementTag &root, deSkin &skin){
-	decXmlElementTag *tag;
+void deSkinModule::pParseSkin(const decXmlBinaryElement &root, deSkin &skin){
+	const decXmlBinaryElement *tag;
 	decPath basePath;
 	int i;
 	
@@ -273,12 +267,12 @@ void deSkinModule::pParseSkin(const decXmlElementTag &root, deSkin &skin){
 
 
 
-deSkinMapped::Ref deSkinModule::pParseMapped(const decXmlElementTag &root, const char *forceName){
+deSkinMapped::Ref deSkinModule::pParseMapped(const decXmlBinaryElement &root, const char *forceName){
 	const deSkinMapped::Ref mapped(deSkinMapped::Ref::New(forceName ? forceName : pGetAttributeString(root, "name")));
 	int i;
 	
 	for(i=0; i<root.GetElementCount(); i++){
-		decXmlElementTag * const tag = pGetTagAt(root, i);
+		const decXmlBinaryElement * const tag = pGetTagAt(root, i);
 		if(!tag){
 			continue;
 		}
@@ -287,12 +281,12 @@ deSkinMapped::Ref deSkinModule::pParseMapped(const decXmlElementTag &root, const
 			pParseMappedCurve(*tag, mapped->GetCurve());
 			
 		}else if(tag->GetName() == "inputType"){
-			const decXmlCharacterData * const cdata = tag->GetFirstData();
+			const decXmlBinaryElement * const cdata = tag->GetFirstData();
 			if(!cdata){
 				continue;
 			}
 			
-			const decString &type = cdata->GetData();
+			const decXmlBinaryElement::cString type(cdata->GetData());
 			
 			if(type == "time"){
 				mapped->SetInputType(deSkinMapped::eitTime);
@@ -329,55 +323,55 @@ deSkinMapped::Ref deSkinModule::pParseMapped(const decXmlElementTag &root, const
 			}
 			
 		}else if(tag->GetName() == "inputLower"){
-			const decXmlCharacterData * const cdata = tag->GetFirstData();
+			const decXmlBinaryElement * const cdata = tag->GetFirstData();
 			if(cdata){
 				mapped->SetInputLower(cdata->GetData().ToFloat());
 			}
 			
 		}else if(tag->GetName() == "inputUpper"){
-			const decXmlCharacterData * const cdata = tag->GetFirstData();
+			const decXmlBinaryElement * const cdata = tag->GetFirstData();
 			if(cdata){
 				mapped->SetInputUpper(cdata->GetData().ToFloat());
 			}
 			
 		}else if(tag->GetName() == "inputClamped"){
-			const decXmlCharacterData * const cdata = tag->GetFirstData();
+			const decXmlBinaryElement * const cdata = tag->GetFirstData();
 			if(cdata){
 				mapped->SetInputClamped(cdata->GetData() == "true"
 					|| cdata->GetData() == "yes" || cdata->GetData() == "1");
 			}
 			
 		}else if(tag->GetName() == "outputLower"){
-			const decXmlCharacterData * const cdata = tag->GetFirstData();
+			const decXmlBinaryElement * const cdata = tag->GetFirstData();
 			if(cdata){
 				mapped->SetOutputLower(cdata->GetData().ToFloat());
 			}
 			
 		}else if(tag->GetName() == "outputUpper"){
-			const decXmlCharacterData * const cdata = tag->GetFirstData();
+			const decXmlBinaryElement * const cdata = tag->GetFirstData();
 			if(cdata){
 				mapped->SetOutputUpper(cdata->GetData().ToFloat());
 			}
 			
 		}else if(tag->GetName() == "bone"){
-			const decXmlCharacterData * const cdata = tag->GetFirstData();
+			const decXmlBinaryElement * const cdata = tag->GetFirstData();
 			if(cdata){
 				mapped->SetBone(cdata->GetData());
 			}
 			
 		}else if(tag->GetName() == "renderable"){
-			const decXmlCharacterData * const cdata = tag->GetFirstData();
+			const decXmlBinaryElement * const cdata = tag->GetFirstData();
 			if(cdata){
 				mapped->SetRenderable(cdata->GetData());
 			}
 			
 		}else if(tag->GetName() == "renderableComponent"){
-			const decXmlCharacterData * const cdata = tag->GetFirstData();
+			const decXmlBinaryElement * const cdata = tag->GetFirstData();
 			if(!cdata){
 				continue;
 			}
 			
-			const decString &type = cdata->GetData();
+			const decXmlBinaryElement::cString type(cdata->GetData());
 			
 			if(type == "red"){
 				mapped->SetRenderableComponent(deSkinMapped::ercRed);
@@ -401,21 +395,21 @@ deSkinMapped::Ref deSkinModule::pParseMapped(const decXmlElementTag &root, const
 	return mapped;
 }
 
-void deSkinModule::pParseMappedCurve(const decXmlElementTag &root, decCurveBezier &curve){
+void deSkinModule::pParseMappedCurve(const decXmlBinaryElement &root, decCurveBezier &curve){
 	int i;
 	for(i=0; i<root.GetElementCount(); i++){
-		decXmlElementTag * const tag = pGetTagAt(root, i);
+		const decXmlBinaryElement * const tag = pGetTagAt(root, i);
 		if(!tag){
 			continue;
 		}
 		
 		if(tag->GetName() == "interpolation"){
-			const decXmlCharacterData * const cdata = tag->GetFirstData();
+			const decXmlBinaryElement * const cdata = tag->GetFirstData();
 			if(!cdata){
 				continue;
 			}
 			
-			const decString &type = cdata->GetData();
+			const decXmlBinaryElement::cString type(cdata->GetData());
 			
 			if(type == "constant"){
 				curve.SetInterpolationMode(decCurveBezier::eimConstant);
@@ -437,12 +431,12 @@ void deSkinModule::pParseMappedCurve(const decXmlElementTag &root, decCurveBezie
 	}
 }
 
-void deSkinModule::pParseMappedCurvePoint(const decXmlElementTag &root, decCurveBezier &curve){
+void deSkinModule::pParseMappedCurvePoint(const decXmlBinaryElement &root, decCurveBezier &curve){
 	decVector2 point, handle1, handle2;
 	int i;
 	
 	for(i=0; i<root.GetElementCount(); i++){
-		decXmlElementTag * const tag = pGetTagAt(root, i);
+		const decXmlBinaryElement * const tag = pGetTagAt(root, i);
 		if(!tag){
 			continue;
 		}
@@ -467,10 +461,10 @@ void deSkinModule::pParseMappedCurvePoint(const decXmlElementTag &root, decCurve
 
 
 
-deSkinTexture::Ref deSkinModule::pParseTexture(const decXmlElementTag &root, decPath &basePath, deSkin &skin){
+deSkinTexture::Ref deSkinModule::pParseTexture(const decXmlBinaryElement &root, decPath &basePath, deSkin &skin){
 	deSkinTexture::Ref texture;
-	decXmlCharacterData *cdata;
-	decXmlElementTag *tag;
+	const decXmlBinaryElement *cdata;
+	const decXmlBinaryElement *tag;
 	const char *name = nullptr;
 	decColor color;
 	int i;
@@ -676,13 +670,13 @@ deSkinTexture::Ref deSkinModule::pParseTexture(const decXmlElementTag &root, dec
 	return texture;
 }
 
-void deSkinModule::pParsePropertyMapped(const decXmlElementTag &root, deSkin &skin, deSkinPropertyMapped &property){
+void deSkinModule::pParsePropertyMapped(const decXmlBinaryElement &root, deSkin &skin, deSkinPropertyMapped &property){
 	deSkinMapped::Ref mapped;
 	int i, index;
 	decString name;
 	
 	for(i=0; i<root.GetElementCount(); i++){
-		decXmlElementTag * const tag = pGetTagAt(root, i);
+		const decXmlBinaryElement * const tag = pGetTagAt(root, i);
 		if(!tag){
 			continue;
 		}
@@ -728,25 +722,25 @@ void deSkinModule::pParsePropertyMapped(const decXmlElementTag &root, deSkin &sk
 			}
 			
 		}else if(tag->GetName() == "mappedRed"){
-			const decXmlCharacterData * const cdata = tag->GetFirstData();
+			const decXmlBinaryElement * const cdata = tag->GetFirstData();
 			if(cdata){
 				property.SetRed(skin.GetMapped().IndexOfNamed(cdata->GetData()));
 			}
 			
 		}else if(tag->GetName() == "mappedGreen"){
-			const decXmlCharacterData * const cdata = tag->GetFirstData();
+			const decXmlBinaryElement * const cdata = tag->GetFirstData();
 			if(cdata){
 				property.SetGreen(skin.GetMapped().IndexOfNamed(cdata->GetData()));
 			}
 			
 		}else if(tag->GetName() == "mappedBlue"){
-			const decXmlCharacterData * const cdata = tag->GetFirstData();
+			const decXmlBinaryElement * const cdata = tag->GetFirstData();
 			if(cdata){
 				property.SetBlue(skin.GetMapped().IndexOfNamed(cdata->GetData()));
 			}
 			
 		}else if(tag->GetName() == "mappedAlpha"){
-			const decXmlCharacterData * const cdata = tag->GetFirstData();
+			const decXmlBinaryElement * const cdata = tag->GetFirstData();
 			if(cdata){
 				property.SetAlpha(skin.GetMapped().IndexOfNamed(cdata->GetData()));
 			}
@@ -758,13 +752,13 @@ void deSkinModule::pParsePropertyMapped(const decXmlElementTag &root, deSkin &sk
 	}
 }
 
-void deSkinModule::pParsePropertyConstructed(const decXmlElementTag& root,
+void deSkinModule::pParsePropertyConstructed(const decXmlBinaryElement& root,
 const deSkin &skin, deSkinPropertyConstructed& property){
 	int i;
 	
 	try{
 		for(i=0; i<root.GetElementCount(); i++){
-			decXmlElementTag * const tag = pGetTagAt(root, i);
+			const decXmlBinaryElement * const tag = pGetTagAt(root, i);
 			if(!tag){
 				continue;
 			}
@@ -799,19 +793,19 @@ const deSkin &skin, deSkinPropertyConstructed& property){
 				property.GetContent()->SetSize(size);
 				
 			}else if(strcmp(tag->GetName(), "tileX") == 0){
-				const decXmlCharacterData * const cdata = tag->GetFirstData();
+				const decXmlBinaryElement * const cdata = tag->GetFirstData();
 				if(cdata){
 					property.SetTileX(strcmp(cdata->GetData(), "true") == 0 || strcmp(cdata->GetData(), "1") == 0);
 				}
 				
 			}else if(strcmp(tag->GetName(), "tileY") == 0){
-				const decXmlCharacterData * const cdata = tag->GetFirstData();
+				const decXmlBinaryElement * const cdata = tag->GetFirstData();
 				if(cdata){
 					property.SetTileY(strcmp(cdata->GetData(), "true") == 0 || strcmp(cdata->GetData(), "1") == 0);
 				}
 				
 			}else if(strcmp(tag->GetName(), "bitCount") == 0){
-				const decXmlCharacterData * const cdata = tag->GetFirstData();
+				const decXmlBinaryElement * const cdata = tag->GetFirstData();
 				if(cdata){
 					property.SetBitCount(decString(cdata->GetData()).ToInt());
 				}
@@ -834,7 +828,7 @@ const deSkin &skin, deSkinPropertyConstructed& property){
 	}
 }
 
-deSkinPropertyNode::Ref deSkinModule::pParsePropertyNode(const decXmlElementTag &tag, const deSkin &skin){
+deSkinPropertyNode::Ref deSkinModule::pParsePropertyNode(const decXmlBinaryElement &tag, const deSkin &skin){
 	try{
 		const decString tagName(tag.GetName());
 		if(tagName == "group"){
@@ -867,7 +861,7 @@ deSkinPropertyNode::Ref deSkinModule::pParsePropertyNode(const decXmlElementTag
 	}
 }
 
-bool deSkinModule::pParsePropertyNodeCommon(const decXmlElementTag &tag,
+bool deSkinModule::pParsePropertyNodeCommon(const decXmlBinaryElement &tag,
 const deSkin &skin, deSkinPropertyNode &node){
 	const decString tagName(tag.GetName());
 	
@@ -900,35 +894,35 @@ const deSkin &skin, deSkinPropertyNode &node){
 		return true;
 		
 	}else if(tagName == "rotation"){
-		decXmlCharacterData * const cdata = tag.GetFirstData();
+		const decXmlBinaryElement * const cdata = tag.GetFirstData();
 		if(cdata){
 			node.SetRotation(strtof(cdata->GetData(), nullptr) * DEG2RAD);
 		}
 		return true;
 		
 	}else if(tagName == "shear"){
-		decXmlCharacterData * const cdata = tag.GetFirstData();
+		const decXmlBinaryElement * const cdata = tag.GetFirstData();
 		if(cdata){
 			node.SetShear(strtof(cdata->GetData(), nullptr) * DEG2RAD);
 		}
 		return true;
 		
 	}else if(tagName == "brightness"){
-		decXmlCharacterData * const cdata = tag.GetFirstData();
+		const decXmlBinaryElement * const cdata = tag.GetFirstData();
 		if(cdata){
 			node.SetBrightness(strtof(cdata->GetData(), nullptr));
 		}
 		return true;
 		
 	}else if(tagName == "contrast"){
-		decXmlCharacterData * const cdata = tag.GetFirstData();
+		const decXmlBinaryElement * const cdata = tag.GetFirstData();
 		if(cdata){
 			node.SetContrast(strtof(cdata->GetData(), nullptr));
 		}
 		return true;
 		
 	}else if(tagName == "gamma"){
-		decXmlCharacterData * const cdata = tag.GetFirstData();
+		const decXmlBinaryElement * const cdata = tag.GetFirstData();
 		if(cdata){
 			node.SetGamma(strtof(cdata->GetData(), nullptr));
 		}
@@ -951,14 +945,14 @@ const deSkin &skin, deSkinPropertyNode &node){
 		return true;
 		
 	}else if(tagName == "transparency"){
-		decXmlCharacterData * const cdata = tag.GetFirstData();
+		const decXmlBinaryElement * const cdata = tag.GetFirstData();
 		if(cdata){
 			node.SetTransparency(strtof(cdata->GetData(), nullptr));
 		}
 		return true;
 		
 	}else if(tagName == "combineMode"){
-		decXmlCharacterData * const cdata = tag.GetFirstData();
+		const decXmlBinaryElement * const cdata = tag.GetFirstData();
 		if(cdata){
 			if(cdata->GetData() == "blend"){
 				node.SetCombineMode(deSkinPropertyNode::ecmBlend);
@@ -981,7 +975,7 @@ const deSkin &skin, deSkinPropertyNode &node){
 			deSkinPropertyNode::Ref nodeMask;
 			
 			for(i=0; i<count; i++){
-				const decXmlElementTag * const tagMask = pGetTagAt(tag, i);
+				const decXmlBinaryElement * const tagMask = pGetTagAt(tag, i);
 				if(!tagMask){
 					continue;
 				}
@@ -1030,7 +1024,7 @@ const deSkin &skin, deSkinPropertyNode &node){
 		return true;
 		
 	}else if(tag.GetName() == "mapped"){
-		const decXmlCharacterData * const cdata = tag.GetFirstData();
+		const decXmlBinaryElement * const cdata = tag.GetFirstData();
 		if(!cdata){
 			return true;
 		}
@@ -1095,14 +1089,14 @@ const deSkin &skin, deSkinPropertyNode &node){
 	}
 }
 
-void deSkinModule::pParsePropertyNodeGroup(const decXmlElementTag &root,
+void deSkinModule::pParsePropertyNodeGroup(const decXmlBinaryElement &root,
 const deSkin &skin, deSkinPropertyNodeGroup &group){
 	const int count = root.GetElementCount();
 	int i;
 	
 	try{
 		for(i=0; i<count; i++){
-			const decXmlElementTag * const tag = pGetTagAt(root, i);
+			const decXmlBinaryElement * const tag = pGetTagAt(root, i);
 			if(!tag){
 				continue;
 			}
@@ -1125,20 +1119,20 @@ const deSkin &skin, deSkinPropertyNodeGroup &group){
 	}
 }
 
-void deSkinModule::pParsePropertyNodeImage(const decXmlElementTag &root,
+void deSkinModule::pParsePropertyNodeImage(const decXmlBinaryElement &root,
 const deSkin &skin, deSkinPropertyNodeImage &image){
 	const int count = root.GetElementCount();
 	int i;
 	
 	for(i=0; i<count; i++){
-		const decXmlElementTag * const tag = pGetTagAt(root, i);
+		const decXmlBinaryElement * const tag = pGetTagAt(root, i);
 		if(!tag){
 			continue;
 		}
 		
 		const decString tagName(tag->GetName());
 		if(tagName == "path"){
-			decXmlCharacterData * const cdata = tag->GetFirstData();
+			const decXmlBinaryElement * const cdata = tag->GetFirstData();
 			if(cdata){
 				image.SetPath(cdata->GetData());
 			}
@@ -1163,20 +1157,20 @@ const deSkin &skin, deSkinPropertyNodeImage &image){
 	}
 }
 
-void deSkinModule::pParsePropertyNodeShape(const decXmlElementTag &root,
+void deSkinModule::pParsePropertyNodeShape(const decXmlBinaryElement &root,
 const deSkin &skin, deSkinPropertyNodeShape &shape){
 	const int count = root.GetElementCount();
 	int i;
 	
 	for(i=0; i<count; i++){
-		const decXmlElementTag * const tag = pGetTagAt(root, i);
+		const decXmlBinaryElement * const tag = pGetTagAt(root, i);
 		if(!tag){
 			continue;
 		}
 		
 		const decString tagName(tag->GetName());
 		if(tagName == "type"){
-			decXmlCharacterData * const cdata = tag->GetFirstData();
+			const decXmlBinaryElement * const cdata = tag->GetFirstData();
 			if(!cdata){
 				LogWarnFormat("shape(%i:%i): Unknown type %s, ignoring",
 					tag->GetLineNumber(), tag->GetPositionNumber(),
@@ -1235,13 +1229,13 @@ const deSkin &skin, deSkinPropertyNodeShape &shape){
 			shape.SetLineColor(color);
 			
 		}else if(tagName == "thickness"){
-			decXmlCharacterData * const cdata = tag->GetFirstData();
+			const decXmlBinaryElement * const cdata = tag->GetFirstData();
 			if(cdata){
 				shape.SetThickness(strtof(cdata->GetData(), nullptr));
 			}
 		
 		}else if(tagName == "shapeMapped"){
-			const decXmlCharacterData * const cdata = tag->GetFirstData();
+			const decXmlBinaryElement * const cdata = tag->GetFirstData();
 			if(!cdata){
 				return;
 			}
@@ -1289,32 +1283,32 @@ const deSkin &skin, deSkinPropertyNodeShape &shape){
 	}
 }
 
-void deSkinModule::pParsePropertyNodeText(const decXmlElementTag &root,
+void deSkinModule::pParsePropertyNodeText(const decXmlBinaryElement &root,
 const deSkin &skin, deSkinPropertyNodeText &text){
 	const int count = root.GetElementCount();
 	int i;
 	
 	for(i=0; i<count; i++){
-		const decXmlElementTag * const tag = pGetTagAt(root, i);
+		const decXmlBinaryElement * const tag = pGetTagAt(root, i);
 		if(!tag){
 			continue;
 		}
 		
 		const decString tagName(tag->GetName());
 		if(tagName == "path"){
-			decXmlCharacterData * const cdata = tag->GetFirstData();
+			const decXmlBinaryElement * const cdata = tag->GetFirstData();
 			if(cdata){
 				text.SetPath(cdata->GetData());
 			}
 			
 		}else if(tagName == "fontSize"){
-			decXmlCharacterData * const cdata = tag->GetFirstData();
+			const decXmlBinaryElement * const cdata = tag->GetFirstData();
 			if(cdata){
 				text.SetFontSize(strtof(cdata->GetData(), nullptr));
 			}
 			
 		}else if(tagName == "text"){
-			decXmlCharacterData * const cdata = tag->GetFirstData();
+			const decXmlBinaryElement * const cdata = tag->GetFirstData();
 			if(cdata){
 				text.SetText(cdata->GetData());
 			}
@@ -1339,7 +1333,7 @@ const deSkin &skin, deSkinPropertyNodeText &text){
 			text.SetColor(color);
 		
 		}else if(tagName == "textMapped"){
-			const decXmlCharacterData * const cdata = tag->GetFirstData();
+			const decXmlBinaryElement * const cdata = tag->GetFirstData();
 			if(!cdata){
 				return;
 			}
@@ -1372,8 +1366,8 @@ const deSkin &skin, deSkinPropertyNodeText &text){
 	}
 }
 
-decColor deSkinModule::pParseColor(const decXmlElementTag &root){
-	decXmlElementTag *tag;
+decColor deSkinModule::pParseColor(const decXmlBinaryElement &root){
+	const decXmlBinaryElement *tag;
 	decColor color;
 	int i;
 	
@@ -1408,8 +1402,8 @@ decColor deSkinModule::pParseColor(const decXmlElementTag &root){
 	return color;
 }
 
-void deSkinModule::pReadVector2(const decXmlElementTag &tag, decVector2 &vector){
-	const decXmlAttValue *value;
+void deSkinModule::pReadVector2(const decXmlBinaryElement &tag, decVector2 &vector){
+	const decXmlBinaryElement *value;
 	
 	value = tag.FindAttribute("x");
 	if(value){
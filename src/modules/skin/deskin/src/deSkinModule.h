@@ -29,10 +29,9 @@
 #include <dragengine/resources/skin/deSkinMapped.h>
 #include <dragengine/resources/skin/deSkinTexture.h>
 #include <dragengine/resources/skin/property/node/deSkinPropertyNode.h>
+#include <dragengine/filesystem/deXmlDocumentCache.h>
 #include <dragengine/systems/modules/skin/deBaseSkinModule.h>
 
-class decXmlElementTag;
-class decXmlAttValue;
 class decXmlWriter;
 class deSkinProperty;
 class deSkinPropertyConstructed;
@@ -48,6 +47,11 @@ class deSkinPropertyNodeText;
 
 // dragengine skin module
 class deSkinModule : public deBaseSkinModule{
+private:
+	deXmlDocumentCache pXmlCache;
+	
+	
+	
 public:
 	/** \name Constructors and Destructors */
 	/*@{*/
@@ -70,32 +74,32 @@ public:
 	/*@}*/
 	
 private:
-	decXmlElementTag *pGetTagAt(const decXmlElementTag &tag, int index);
-	decXmlAttValue *pFindAttribute(const decXmlElementTag &tag, const char *name);
-	const char *pGetAttributeString(const decXmlElementTag &tag, const char *name);
-	int pGetAttributeInt(const decXmlElementTag &tag, const char *name);
-	float pGetAttributeFloat(const decXmlElementTag &tag, const char *name);
-	bool pGetAttributeBool(const decXmlElementTag &tag, const char *name);
+	const decXmlBinaryElement *pGetTagAt(const decXmlBinaryElement &tag, int index);
+	const decXmlBinaryElement *pFindAttribute(const decXmlBinaryElement &tag, const char *name);
+	const char *pGetAttributeString(const decXmlBinaryElement &tag, const char *name);
+	int pGetAttributeInt(const decXmlBinaryElement &tag, const char *name);
+	float pGetAttributeFloat(const decXmlBinaryElement &tag, const char *name);
+	bool pGetAttributeBool(const decXmlBinaryElement &tag, const char *name);
 	
-	void pParseSkin(const decXmlElementTag &root, deSkin &skin);
+	void pParseSkin(const decXmlBinaryElement &root, deSkin &skin);
 	
-	deSkinMapped::Ref pParseMapped(const decXmlElementTag &root, const char *forceName = nullptr);
-	void pParseMappedCurve(const decXmlElementTag &root, decCurveBezier &curve);
-	void pParseMappedCurvePoint(const decXmlElementTag &root, decCurveBezier &curve);
+	deSkinMapped::Ref pParseMapped(const decXmlBinaryElement &root, const char *forceName = nullptr);
+	void pParseMappedCurve(const decXmlBinaryElement &root, decCurveBezier &curve);
+	void pParseMappedCurvePoint(const decXmlBinaryElement &root, decCurveBezier &curve);
 	
-	deSkinTexture::Ref pParseTexture(const decXmlElementTag &root, decPath &basePath, deSkin &skin);
-	void pParsePropertyMapped(const decXmlElementTag &root, deSkin &skin, deSkinPropertyMapped &property);
-	void pParsePropertyConstructed(const decXmlElementTag &root, const deSkin &skin, deSkinPropertyConstructed &property);
+	deSkinTexture::Ref pParseTexture(const decXmlBinaryElement &root, decPath &basePath, deSkin &skin);
+	void pParsePropertyMapped(const decXmlBinaryElement &root, deSkin &skin, deSkinPropertyMapped &property);
+	void pParsePropertyConstructed(const decXmlBinaryElement &root, const deSkin &skin, deSkinPropertyConstructed &property);
 	
-	deSkinPropertyNode::Ref pParsePropertyNode(const decXmlElementTag &tag, const deSkin &skin);
-	bool pParsePropertyNodeCommon(const decXmlElementTag &tag, const deSkin &skin, deSkinPropertyNode &node);
-	void pParsePropertyNodeGroup(const decXmlElementTag &root, const deSkin &skin, deSkinPropertyNodeGroup &group);
-	void pParsePropertyNodeImage(const decXmlElementTag &root, const deSkin &skin, deSkinPropertyNodeImage &group);
-	void pParsePropertyNodeShape(const decXmlElementTag &root, const deSkin &skin, deSkinPropertyNodeShape &group);
-	void pParsePropertyNodeText(const decXmlElementTag &root, const deSkin &skin, deSkinPropertyNodeText &group);
+	deSkinPropertyNode::Ref pParsePropertyNode(const decXmlBinaryElement &tag, const deSkin &skin);
+	bool pParsePropertyNodeCommon(const decXmlBinaryElement &tag, const deSkin &skin, deSkinPropertyNode &node);
+	void pParsePropertyNodeGroup(const decXmlBinaryElement &root, const deSkin &skin, deSkinPropertyNodeGroup &group);
+	void pParsePropertyNodeImage(const decXmlBinaryElement &root, const deSkin &skin, deSkinPropertyNodeImage &group);
+	void pParsePropertyNodeShape(const decXmlBinaryElement &root, const deSkin &skin, deSkinPropertyNodeShape &group);
+	void pParsePropertyNodeText(const decXmlBinaryElement &root, const deSkin &skin, deSkinPropertyNodeText &group);
 	
-	decColor pParseColor(const decXmlElementTag &root);
-	void pReadVector2(const decXmlElementTag &tag, decVector2 &vector);
+	decColor pParseColor(const decXmlBinaryElement &root);
+	void pReadVector2(const decXmlBinaryElement &tag, decVector2 &vector);
 	
 	void pWriteSkin(decXmlWriter &writer, const deSkin &skin);
 	void pWriteMapped(decXmlWriter &writer, const deSkinMapped &mapped);
@@ -0,0 +1,264 @@
+// includes
+#include <math.h>
+#include <stdint.h>
+
+#include "detAnimationCompressed.h"
+
+#include <dearAnimationCompressed.h>
+#include <dearAnimationKeyframe.h>
+#include <dearAnimationKeyframeList.h>
+
+#include <dragengine/common/collection/decTList.h>
+#include <dragengine/common/math/decMath.h>
+#include <dragengine/resources/animation/deAnimationKeyframe.h>
+#include <dragengine/resources/animation/deAnimationMove.h>
+
+
+// definitions
+#define TEST_FRAME_RATE 30.0f
+
+// quantization steps as used by dearAnimationCompressed
+#define STEP_ROTATION (2.0f * 0.70710678f / 32767.0f)
+#define STEP_VECTOR (1.0f / 65535.0f)
+
+// channels with a range below this threshold are stored as constant value
+#define THRESHOLD_CONSTANT 1e-5f
+
+// tolerance for float rounding during decoding
+#define ROUNDING 1e-6f
+
+
+// deterministic pseudo random numbers in the range from 0 to 1
+static float detACRandom(uint32_t &seed){
+	seed = seed * 1664525u + 1013904223u;
+	return (float)(seed >> 8) / 16777216.0f;
+}
+
+// largest component of vector
+static float detACMaxComponent(const decVector &vector){
+	return decMath::max(vector.x, vector.y, vector.z);
+}
+
+
+
+// Class detAnimationCompressed
+/////////////////////////////////
+
+// Constructors, destructor
+/////////////////////////////
+
+detAnimationCompressed::detAnimationCompressed(){
+}
+
+detAnimationCompressed::~detAnimationCompressed(){
+}
+
+
+
+// Testing
+////////////
+
+void detAnimationCompressed::Prepare(){
+}
+
+void detAnimationCompressed::Run(){
+	pTestShortClip();
+	pTestLongClip();
+	pTestTwoKeyframes();
+}
+
+void detAnimationCompressed::CleanUp(){
+}
+
+const char *detAnimationCompressed::GetTestName(){
+	return "AnimationCompressed";
+}
+
+
+
+// Tests
+//////////
+
+void detAnimationCompressed::pTestShortClip(){
+	SetSubTestNum(0);
+	pTestAccuracy(50, 200);
+}
+
+void detAnimationCompressed::pTestLongClip(){
+	SetSubTestNum(1);
+	
+	// late frames do not exactly hit the frame time in float
+	pTestAccuracy(10, 3000);
+}
+
+void detAnimationCompressed::pTestTwoKeyframes(){
+	SetSubTestNum(2);
+	pTestAccuracy(5, 2);
+}
+
+
+
+// Private Functions
+//////////////////////
+
+void detAnimationCompressed::pTestAccuracy(int boneCount, int keyframeCount){
+	// decoded frames have to match the keyframe interpolation within the quantization
+	// step of each channel: range/65535 for positions and scalings and 1.5 rotation steps
+	// for the reconstructed quaternion
+	// create clip. bones cycle through constant channels, large position ranges,
+	// rotations around different axes and animated scaling
+	deAnimationMove move;
+	move.SetFPS((int)TEST_FRAME_RATE);
+	move.SetPlaytime((float)(keyframeCount - 1) / TEST_FRAME_RATE);
+	
+	uint32_t seed = 7919;
+	int i, j;
+	
+	for(i=0; i<boneCount; i++){
+		deAnimationMove::KeyframeListRef keyframes(deAnimationMove::KeyframeListRef::New());
+		const int type = i % 5;
+		
+		for(j=0; j<keyframeCount; j++){
+			deAnimationKeyframe keyframe;
+			keyframe.SetTime((float)j / TEST_FRAME_RATE);
+			
+			switch(type){
+			case 0:
+				// constant bone
+				keyframe.SetPosition(decVector(0.5f, -1.0f, 2.0f));
+				keyframe.SetRotation(decVector(0.0f, 30.0f * DEG2RAD, 0.0f));
+				break;
+				
+			case 1:
+				// large position range
+				keyframe.SetPosition(decVector(
+					detACRandom(seed) * 2000.0f - 1000.0f,
+					detACRandom(seed) * 10.0f,
+					-500.0f + (float)j * 3.0f));
+				break;
+				
+			case 2:
+				// free rotation. the largest quaternion component varies
+				keyframe.SetRotation(decVector(
+					detACRandom(seed) * 360.0f - 180.0f,
+					detACRandom(seed) * 360.0f - 180.0f,
+					detACRandom(seed) * 360.0f - 180.0f) * DEG2RAD);
+				break;
+				
+			case 3:
+				// rotation around a single axis passing 180 degrees
+				keyframe.SetRotation(decVector(0.0f, 0.0f,
+					(float)j * 400.0f / (float)keyframeCount * DEG2RAD));
+				keyframe.SetPosition(decVector(0.0f, (float)j * 0.01f, 0.0f));
+				break;
+				
+			default:
+				// animated scaling
+				keyframe.SetScale(decVector(
+					0.5f + detACRandom(seed),
+					1.0f,
+					1.0f + detACRandom(seed) * 4.0f));
+			}
+			
+			keyframes->Add(keyframe);
+		}
+		
+		move.AddKeyframeList(std::move(keyframes));
+	}
+	
+	// compress and compare all frames against keyframe interpolation
+	const dearAnimationCompressed compressed(move);
+	const int frameCount = compressed.GetFrameCount();
+	const float frameRate = compressed.GetFrameRate();
+	
+	decTList<decVector> positions(frameCount), scalings(frameCount);
+	decTList<decQuaternion> rotations(frameCount);
+	
+	for(i=0; i<boneCount; i++){
+		const dearAnimationKeyframeList list(move.GetKeyframeList(i));
+		int cursor = 0;
+		
+		for(j=0; j<frameCount; j++){
+			const float time = frameRate > 0.0f ? (float)j / frameRate : 0.0f;
+			const dearAnimationKeyframe &keyframe = *list.GetWithTime(time, cursor);
+			const float keyframeTime = time - keyframe.GetTime();
+			
+			decQuaternion rotation(keyframe.InterpolateRotation(keyframeTime));
+			rotation.Normalize();
+			
+			positions.Add(keyframe.InterpolatePosition(keyframeTime));
+			rotations.Add(rotation);
+			scalings.Add(keyframe.InterpolateScaling(keyframeTime));
+		}
+		
+		// quantization steps of the vector channels follow from the value range
+		decVector minPosition(positions.First()), maxPosition(minPosition);
+		decVector minScaling(scalings.First()), maxScaling(minScaling);
+		for(j=1; j<frameCount; j++){
+			minPosition.SetSmallest(positions[j]);
+			maxPosition.SetLargest(positions[j]);
+			minScaling.SetSmallest(scalings[j]);
+			maxScaling.SetLargest(scalings[j]);
+		}
+		
+		const decVector rangePosition(maxPosition - minPosition);
+		const decVector rangeScaling(maxScaling - minScaling);
+		const float stepPosition = decMath::max(rangePosition.x, rangePosition.y, rangePosition.z) * STEP_VECTOR;
+		const float stepScaling = decMath::max(rangeScaling.x, rangeScaling.y, rangeScaling.z) * STEP_VECTOR;
+		
+		// stored components are within half a step. the reconstructed largest
+		// component accumulates the error of the other three
+		const float tolerancePosition = decMath::max(stepPosition, THRESHOLD_CONSTANT)
+			+ ROUNDING * decMath::max(maxPosition.Length(), minPosition.Length(), 1.0f);
+		const float toleranceScaling = decMath::max(stepScaling, THRESHOLD_CONSTANT)
+			+ ROUNDING * decMath::max(maxScaling.Length(), minScaling.Length(), 1.0f);
+		const float toleranceRotation = STEP_ROTATION * 1.5f + ROUNDING;
+		
+		for(j=0; j<frameCount; j++){
+			const float time = frameRate > 0.0f ? (float)j / frameRate : 0.0f;
+			decVector position, scaling;
+			decQuaternion rotation;
+			
+			ASSERT_TRUE(compressed.Sample(i, time, position, rotation, scaling));
+			
+			// quaternions have no defined sign
+			if(rotation.Dot(rotations[j]) < 0.0f){
+				rotation = -rotation;
+			}
+			
+			// for late frames the float time does not exactly hit the frame. the sample
+			// blends then slightly towards the neighbor frame adding to the error
+			const float frameOffset = fabsf(time * frameRate - (float)j);
+			const int neighbor1 = decMath::max(j - 1, 0);
+			const int neighbor2 = decMath::min(j + 1, frameCount - 1);
+			
+			const float blendPosition = frameOffset * decMath::max(
+				detACMaxComponent((positions[j] - positions[neighbor1]).Absolute()),
+				detACMaxComponent((positions[neighbor2] - positions[j]).Absolute()));
+			// dot products of equal rotations can exceed 1 due to rounding
+			const float blendRotation = frameOffset * sqrtf(2.0f * decMath::max(
+				1.0f - fabsf(rotations[j].Dot(rotations[neighbor1])),
+				1.0f - fabsf(rotations[neighbor2].Dot(rotations[j])), 0.0f));
+			const float blendScaling = frameOffset * decMath::max(
+				detACMaxComponent((scalings[j] - scalings[neighbor1]).Absolute()),
+				detACMaxComponent((scalings[neighbor2] - scalings[j]).Absolute()));
+			
+			const decVector errorPosition((position - positions[j]).Absolute());
+			const decVector errorScaling((scaling - scalings[j]).Absolute());
+			const decQuaternion errorRotation((rotation - rotations[j]).Absolute());
+			
+			const float ep = (detACMaxComponent(errorPosition) - blendPosition) / tolerancePosition;
+			const float er = (decMath::max(errorRotation.x, errorRotation.y, errorRotation.z, errorRotation.w)
+				- blendRotation) / toleranceRotation;
+			const float es = (detACMaxComponent(errorScaling) - blendScaling) / toleranceScaling;
+			
+			ASSERT_TRUE(ep <= 1.0f);
+			ASSERT_TRUE(er <= 1.0f);
+			ASSERT_TRUE(es <= 1.0f);
+		}
+		
+		positions.RemoveAll();
+		rotations.RemoveAll();
+		scalings.RemoveAll();
+	}
+}
@@ -0,0 +1,29 @@
+// include only once
+#ifndef _DETANIMATIONCOMPRESSED_H_
+#define _DETANIMATIONCOMPRESSED_H_
+
+// includes
+#include "../detCase.h"
+
+
+
+// class detAnimationCompressed
+class detAnimationCompressed : public detCase{
+public:
+	detAnimationCompressed();
+	~detAnimationCompressed() override;
+	void Prepare() override;
+	void Run() override;
+	void CleanUp() override;
+	const char *GetTestName() override;
+	
+private:
+	void pTestShortClip();
+	void pTestLongClip();
+	void pTestTwoKeyframes();
+	
+	void pTestAccuracy(int boneCount, int keyframeCount);
+};
+
+// end of include only once
+#endif
@@ -0,0 +1,176 @@
+// includes
+#include <stdio.h>
+#include <string.h>
+
+#include "detCachePackBenchmark.h"
+
+#include <dragengine/filesystem/deCacheHelper.h>
+#include <dragengine/filesystem/deCachePack.h>
+#include <dragengine/filesystem/deVirtualFileSystem.h>
+#include <dragengine/filesystem/deVFSDiskDirectory.h>
+#include <dragengine/common/math/decMath.h>
+#include <dragengine/common/string/decString.h>
+#include <dragengine/common/utils/decTimer.h>
+#include <dragengine/common/exceptions.h>
+
+
+// definitions
+#define DETCPB_COUNT 5000
+#define DETCPB_SIZE 8192
+
+
+// Virtual file system with the benchmark directory as root
+static deVirtualFileSystem::Ref detCPBCreateVFS(const decPath &basePath){
+	const deVirtualFileSystem::Ref vfs(deVirtualFileSystem::Ref::New());
+	vfs->AddContainer(deVFSDiskDirectory::Ref::New(basePath));
+	return vfs;
+}
+
+
+// Entry identifier similar to the identifiers used by the graphic module caches
+static decString detCPBEntryId(int index){
+	decString id;
+	id.Format("/data/models/category%d/model%d.demodel", index % 20, index);
+	return id;
+}
+
+
+
+// Class detCachePackBenchmark
+////////////////////////////////
+
+detCachePackBenchmark::detCachePackBenchmark() :
+pPrepared(false){
+}
+
+detCachePackBenchmark::~detCachePackBenchmark(){
+	CleanUp();
+}
+
+void detCachePackBenchmark::Prepare(){
+	pBasePath = decPath::CreateWorkingDirectory();
+	pBasePath.AddComponent("detests_cache_pack_benchmark");
+	pPrepared = true;
+	
+	// text like data compressing similar to typical cache content
+	pData.SetCountDiscard(DETCPB_SIZE);
+	uint8_t * const data = pData.GetArrayPointer();
+	unsigned int seed = 4711;
+	int i;
+	
+	for(i=0; i<DETCPB_SIZE; i++){
+		seed = seed * 1103515245 + 12345;
+		const int value = (seed >> 16) % 40;
+		data[i] = value < 26 ? (uint8_t)('a' + value) : (value < 34 ? ' ' : (uint8_t)(seed >> 8));
+	}
+}
+
+void detCachePackBenchmark::Run(){
+	BenchmarkWarmStartup();
+}
+
+void detCachePackBenchmark::CleanUp(){
+	if(!pPrepared){
+		return;
+	}
+	
+	const deVirtualFileSystem::Ref vfs(detCPBCreateVFS(pBasePath));
+	const char * const directories[] = {"/helper", "/packZ", "/packFast"};
+	int i;
+	
+	deCacheHelper(vfs, decPath::CreatePathUnix(directories[0])).DeleteAll();
+	for(i=1; i<3; i++){
+		deCachePack(vfs, decPath::CreatePathUnix(directories[i])).DeleteAll();
+		
+		decString path;
+		path.Format("%s/index", directories[i]);
+		if(vfs->ExistsFile(decPath::CreatePathUnix(path))){
+			vfs->DeleteFile(decPath::CreatePathUnix(path));
+		}
+	}
+	
+	const deVFSDiskDirectory::Ref base(deVFSDiskDirectory::Ref::New(pBasePath));
+	for(i=0; i<3; i++){
+		const decPath path(decPath::CreatePathUnix(directories[i]));
+		if(base->ExistsFile(path)){
+			base->DeleteFile(path);
+		}
+	}
+	
+	deVFSDiskDirectory::Ref::New(pBasePath.GetParent())->DeleteFile(
+		decPath::CreatePathUnix(pBasePath.GetLastComponent()));
+	
+	pPrepared = false;
+}
+
+const char *detCachePackBenchmark::GetTestName(){
+	return "CachePackBenchmark";
+}
+
+
+// Benchmarks
+///////////////
+
+void detCachePackBenchmark::BenchmarkWarmStartup(){
+	SetSubTestNum(0);
+	
+	const deVirtualFileSystem::Ref vfs(detCPBCreateVFS(pBasePath));
+	const decPath pathHelper(decPath::CreatePathUnix("/helper"));
+	const decPath pathPackZ(decPath::CreatePathUnix("/packZ"));
+	const decPath pathPackFast(decPath::CreatePathUnix("/packFast"));
+	uint8_t buffer[DETCPB_SIZE];
+	int i;
+	
+	// fill caches
+	{
+	deCacheHelper helper(vfs, pathHelper);
+	deCachePack packZ(vfs, pathPackZ);
+	deCachePack packFast(vfs, pathPackFast);
+	packFast.SetCompressionMethod(deCachePack::ecmFastCompression);
+	
+	for(i=0; i<DETCPB_COUNT; i++){
+		const decString id(detCPBEntryId(i));
+		helper.Write(id)->Write(pData.GetArrayPointer(), DETCPB_SIZE);
+		packZ.Write(id)->Write(pData.GetArrayPointer(), DETCPB_SIZE);
+		packFast.Write(id)->Write(pData.GetArrayPointer(), DETCPB_SIZE);
+	}
+	}
+	
+	printf("\n  Warm startup reading %d entries of %d bytes:", DETCPB_COUNT, DETCPB_SIZE);
+	
+	// warm startup: create cache and read all entries
+	decTimer timer;
+	{
+	deCacheHelper helper(vfs, pathHelper);
+	for(i=0; i<DETCPB_COUNT; i++){
+		const decBaseFileReader::Ref reader(helper.Read(detCPBEntryId(i)));
+		ASSERT_NOT_NULL(reader);
+		reader->Read(buffer, DETCPB_SIZE);
+	}
+	}
+	const float elapsedHelper = timer.GetElapsedTime();
+	
+	const decPath * const paths[] = {&pathPackZ, &pathPackFast};
+	const char * const names[] = {"zlib", "fast"};
+	
+	printf("\n   cache helper: %8.2f ms", elapsedHelper * 1000.0f);
+	
+	for(i=0; i<2; i++){
+		timer.Reset();
+		int j;
+		
+		deCachePack pack(vfs, *paths[i]);
+		for(j=0; j<DETCPB_COUNT; j++){
+			const decBaseFileReader::Ref reader(pack.Read(detCPBEntryId(j)));
+			ASSERT_NOT_NULL(reader);
+			reader->Read(buffer, DETCPB_SIZE);
+		}
+		const float elapsed = timer.GetElapsedTime();
+		
+		ASSERT_TRUE(memcmp(buffer, pData.GetArrayPointer(), DETCPB_SIZE) == 0);
+		
+		printf("\n   cache pack %s: %8.2f ms (%5.1fx), %llu bytes on disk, %d segments",
+			names[i], elapsed * 1000.0f, elapsedHelper / decMath::max(elapsed, 1e-6f),
+			(unsigned long long)pack.GetDiskSize(), pack.GetSegmentCount());
+	}
+}
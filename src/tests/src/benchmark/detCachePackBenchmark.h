@@ -0,0 +1,31 @@
+// include only once
+#ifndef _DETCACHEPACKBENCHMARK_H_
+#define _DETCACHEPACKBENCHMARK_H_
+
+// includes
+#include "../detCase.h"
+
+#include <dragengine/common/file/decPath.h>
+#include <dragengine/common/collection/decTList.h>
+
+
+// class detCachePackBenchmark
+class detCachePackBenchmark : public detCase{
+public:
+	detCachePackBenchmark();
+	~detCachePackBenchmark() override;
+	void Prepare() override;
+	void Run() override;
+	void CleanUp() override;
+	const char *GetTestName() override;
+	
+private:
+	decPath pBasePath;
+	decTList<uint8_t> pData;
+	bool pPrepared;
+	
+	void BenchmarkWarmStartup();
+};
+
+// end of include only once
+#endif
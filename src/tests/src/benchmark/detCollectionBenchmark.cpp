@@ -0,0 +1,206 @@
+// includes
+#include <stdio.h>
+
+#include "detCollectionBenchmark.h"
+
+#include <dragengine/common/collection/decTDictionary.h>
+#include <dragengine/common/collection/decTList.h>
+#include <dragengine/common/collection/decTSet.h>
+#include <dragengine/common/string/decString.h>
+#include <dragengine/common/utils/decTimer.h>
+#include <dragengine/common/exceptions.h>
+
+
+// element counts to test
+static const int vElementCounts[] = {1000, 10000, 100000, 1000000, 0};
+
+
+// scatter keys to avoid sequential keys hiding hashing problems
+static int detCBKey(int index){
+	return (int)((unsigned int)index * 2654435761u);
+}
+
+static void detCBPrint(const char *name, int count, float insert, float lookup, float miss, float erase){
+	printf("\n    %-12s %7d: insert %6.1f ns, lookup %6.1f ns, miss %6.1f ns, erase %6.1f ns",
+		name, count, insert * 1e9f / (float)count, lookup * 1e9f / (float)count,
+		miss * 1e9f / (float)count, erase * 1e9f / (float)count);
+}
+
+
+// Class detCollectionBenchmark
+/////////////////////////////////
+
+detCollectionBenchmark::detCollectionBenchmark(){
+}
+
+detCollectionBenchmark::~detCollectionBenchmark(){
+}
+
+void detCollectionBenchmark::Prepare(){
+}
+
+void detCollectionBenchmark::Run(){
+	printf("\n  Collection insert/lookup/erase (per operation):");
+	BenchmarkDictionaryInt();
+	BenchmarkDictionaryString();
+	BenchmarkSetInt();
+}
+
+void detCollectionBenchmark::CleanUp(){
+}
+
+const char *detCollectionBenchmark::GetTestName(){
+	return "CollectionBenchmark";
+}
+
+
+// Benchmarks
+///////////////
+
+void detCollectionBenchmark::BenchmarkDictionaryInt(){
+	SetSubTestNum(0);
+	
+	int i, j;
+	for(i=0; vElementCounts[i] > 0; i++){
+		const int count = vElementCounts[i];
+		decTDictionary<int, int> dict;
+		decTimer timer;
+		
+		for(j=0; j<count; j++){
+			dict.SetAt(detCBKey(j), j);
+		}
+		const float elapsedInsert = timer.GetElapsedTime();
+		ASSERT_EQUAL(dict.GetCount(), count);
+		
+		timer.Reset();
+		int found = 0;
+		for(j=0; j<count; j++){
+			const int *value;
+			if(dict.GetAt(detCBKey(j), value) && *value == j){
+				found++;
+			}
+		}
+		const float elapsedLookup = timer.GetElapsedTime();
+		ASSERT_EQUAL(found, count);
+		
+		timer.Reset();
+		found = 0;
+		for(j=0; j<count; j++){
+			if(dict.Has(detCBKey(count + j))){
+				found++;
+			}
+		}
+		const float elapsedMiss = timer.GetElapsedTime();
+		ASSERT_EQUAL(found, 0);
+		
+		timer.Reset();
+		for(j=0; j<count; j++){
+			dict.Remove(detCBKey(j));
+		}
+		const float elapsedErase = timer.GetElapsedTime();
+		ASSERT_TRUE(dict.IsEmpty());
+		
+		detCBPrint("dict<int>", count, elapsedInsert, elapsedLookup, elapsedMiss, elapsedErase);
+	}
+}
+
+void detCollectionBenchmark::BenchmarkDictionaryString(){
+	SetSubTestNum(1);
+	
+	int i, j;
+	for(i=0; vElementCounts[i] > 0; i++){
+		const int count = vElementCounts[i];
+		decTList<decString> keys(count * 2);
+		for(j=0; j<count * 2; j++){
+			decString key;
+			key.Format("/some/path/key%d", detCBKey(j));
+			keys.Add(key);
+		}
+		
+		decTStringDictionary<int> dict;
+		decTimer timer;
+		
+		for(j=0; j<count; j++){
+			dict.SetAt(keys.GetAt(j), j);
+		}
+		const float elapsedInsert = timer.GetElapsedTime();
+		ASSERT_EQUAL(dict.GetCount(), count);
+		
+		// lookup using const char* does not create temporary strings
+		timer.Reset();
+		int found = 0;
+		for(j=0; j<count; j++){
+			const int *value;
+			if(dict.GetAt(keys.GetAt(j).GetString(), value) && *value == j){
+				found++;
+			}
+		}
+		const float elapsedLookup = timer.GetElapsedTime();
+		ASSERT_EQUAL(found, count);
+		
+		timer.Reset();
+		found = 0;
+		for(j=0; j<count; j++){
+			if(dict.Has(keys.GetAt(count + j))){
+				found++;
+			}
+		}
+		const float elapsedMiss = timer.GetElapsedTime();
+		ASSERT_EQUAL(found, 0);
+		
+		timer.Reset();
+		for(j=0; j<count; j++){
+			dict.Remove(keys.GetAt(j));
+		}
+		const float elapsedErase = timer.GetElapsedTime();
+		ASSERT_TRUE(dict.IsEmpty());
+		
+		detCBPrint("dict<string>", count, elapsedInsert, elapsedLookup, elapsedMiss, elapsedErase);
+	}
+}
+
+void detCollectionBenchmark::BenchmarkSetInt(){
+	SetSubTestNum(2);
+	
+	int i, j;
+	for(i=0; vElementCounts[i] > 0; i++){
+		const int count = vElementCounts[i];
+		decTSet<int> set;
+		decTimer timer;
+		
+		for(j=0; j<count; j++){
+			set.Add(detCBKey(j));
+		}
+		const float elapsedInsert = timer.GetElapsedTime();
+		ASSERT_EQUAL(set.GetCount(), count);
+		
+		timer.Reset();
+		int found = 0;
+		for(j=0; j<count; j++){
+			if(set.Has(detCBKey(j))){
+				found++;
+			}
+		}
+		const float elapsedLookup = timer.GetElapsedTime();
+		ASSERT_EQUAL(found, count);
+		
+		timer.Reset();
+		found = 0;
+		for(j=0; j<count; j++){
+			if(set.Has(detCBKey(count + j))){
+				found++;
+			}
+		}
+		const float elapsedMiss = timer.GetElapsedTime();
+		ASSERT_EQUAL(found, 0);
+		
+		timer.Reset();
+		for(j=0; j<count; j++){
+			set.Remove(detCBKey(j));
+		}
+		const float elapsedErase = timer.GetElapsedTime();
+		ASSERT_TRUE(set.IsEmpty());
+		
+		detCBPrint("set<int>", count, elapsedInsert, elapsedLookup, elapsedMiss, elapsedErase);
+	}
+}
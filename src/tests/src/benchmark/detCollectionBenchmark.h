@@ -0,0 +1,26 @@
+// include only once
+#ifndef _DETCOLLECTIONBENCHMARK_H_
+#define _DETCOLLECTIONBENCHMARK_H_
+
+// includes
+#include "../detCase.h"
+
+
+// class detCollectionBenchmark
+class detCollectionBenchmark : public detCase{
+public:
+	detCollectionBenchmark();
+	~detCollectionBenchmark() override;
+	void Prepare() override;
+	void Run() override;
+	void CleanUp() override;
+	const char *GetTestName() override;
+	
+private:
+	void BenchmarkDictionaryInt();
+	void BenchmarkDictionaryString();
+	void BenchmarkSetInt();
+};
+
+// end of include only once
+#endif
@@ -0,0 +1,191 @@
+// includes
+#include <stdio.h>
+
+#include "detFileResourceListBenchmark.h"
+
+#include <dragengine/deEngine.h>
+#include <dragengine/app/deOSConsole.h>
+#include <dragengine/filesystem/deVirtualFileSystem.h>
+#include <dragengine/resources/deFileResource.h>
+#include <dragengine/resources/deFileResourceList.h>
+#include <dragengine/resources/deFileResourceManager.h>
+#include <dragengine/common/collection/decTList.h>
+#include <dragengine/common/math/decMath.h>
+#include <dragengine/common/string/decString.h>
+#include <dragengine/common/utils/decTimer.h>
+#include <dragengine/common/exceptions.h>
+
+
+// definitions
+#define DETFRLB_LINEAR_LOOKUPS 1000
+
+
+// Resource manager owning the benchmark resources
+class detFRLBManager : public deFileResourceManager{
+public:
+	deFileResourceList resources;
+	
+	explicit detFRLBManager(deEngine *engine) : deFileResourceManager(engine, ertSkin){
+	}
+	
+	~detFRLBManager() override{
+		resources.RemoveAll();
+	}
+	
+	void RemoveResource(deResource *resource) override{
+		resources.RemoveIfPresent(resource);
+	}
+};
+
+
+// Synthetic file resource
+class detFRLBResource : public deFileResource{
+public:
+	using Ref = deTObjectReference<detFRLBResource>;
+	
+	detFRLBResource(detFRLBManager *manager, deVirtualFileSystem *vfs, const char *filename) :
+	deFileResource(manager, vfs, filename, 0){
+	}
+	
+protected:
+	~detFRLBResource() override = default;
+};
+
+
+// Linear scan as used before the filename index has been added
+static deResource *detFRLBLinearLookup(const deFileResourceList &list,
+deVirtualFileSystem *vfs, const char *filename){
+	return list.GetResources().FindOrNull([&](const deResource *r){
+		const deFileResource &res = static_cast<const deFileResource&>(*r);
+		return !res.GetOutdated()
+			&& res.GetVirtualFileSystem() == vfs
+			&& res.GetFilename() == filename;
+	});
+}
+
+
+// resource counts to test
+static const int vResourceCounts[] = {1000, 4000, 16000, 64000, 0};
+
+
+// Class detFileResourceListBenchmark
+///////////////////////////////////////
+
+detFileResourceListBenchmark::detFileResourceListBenchmark() :
+pEngine(nullptr){
+}
+
+detFileResourceListBenchmark::~detFileResourceListBenchmark(){
+	CleanUp();
+}
+
+void detFileResourceListBenchmark::Prepare(){
+	if(!pEngine){
+		pEngine = new deEngine(new deOSConsole, nullptr);
+	}
+}
+
+void detFileResourceListBenchmark::Run(){
+	BenchmarkLookup();
+	TestOutdated();
+}
+
+void detFileResourceListBenchmark::CleanUp(){
+	if(pEngine){
+		delete pEngine;
+		pEngine = nullptr;
+	}
+}
+
+const char *detFileResourceListBenchmark::GetTestName(){
+	return "FileResourceListBenchmark";
+}
+
+
+// Benchmarks
+///////////////
+
+void detFileResourceListBenchmark::BenchmarkLookup(){
+	SetSubTestNum(0);
+	
+	const deVirtualFileSystem::Ref vfs(deVirtualFileSystem::Ref::New());
+	int i, j;
+	
+	printf("\n  Resource lookup by filename:");
+	for(i=0; vResourceCounts[i] > 0; i++){
+		const int count = vResourceCounts[i];
+		detFRLBManager manager(pEngine);
+		decTList<detFRLBResource::Ref> resources(count);
+		decTList<decString> filenames(count);
+		
+		for(j=0; j<count; j++){
+			decString filename;
+			filename.Format("/data/models/model%d/model%d.demodel", j / 50, j);
+			filenames.Add(filename);
+		}
+		
+		decTimer timer;
+		for(j=0; j<count; j++){
+			const detFRLBResource::Ref resource(detFRLBResource::Ref::New(&manager, vfs, filenames.GetAt(j)));
+			manager.resources.Add(resource);
+			resources.Add(resource);
+		}
+		const float elapsedAdd = timer.GetElapsedTime();
+		
+		timer.Reset();
+		for(j=0; j<count; j++){
+			DEASSERT_TRUE(manager.resources.GetWithFilename(vfs, filenames.GetAt(j)) == resources.GetAt(j))
+		}
+		const float elapsedIndexed = timer.GetElapsedTime();
+		
+		const int linearCount = decMath::min(count, DETFRLB_LINEAR_LOOKUPS);
+		const int linearStep = count / linearCount;
+		timer.Reset();
+		for(j=0; j<linearCount; j++){
+			const int index = j * linearStep;
+			DEASSERT_TRUE(detFRLBLinearLookup(manager.resources, vfs, filenames.GetAt(index)) == resources.GetAt(index))
+		}
+		const float elapsedLinear = timer.GetElapsedTime();
+		
+		ASSERT_NULL(manager.resources.GetWithFilename(vfs, "/data/missing.demodel"));
+		
+		printf("\n    %6d resources: add %8.2f ms, indexed %8.1f ns/lookup, linear %10.1f ns/lookup",
+			count, elapsedAdd * 1000.0f,
+			elapsedIndexed * 1e9f / (float)count,
+			elapsedLinear * 1e9f / (float)linearCount);
+		
+		manager.resources.RemoveAll();
+		ASSERT_NULL(manager.resources.GetWithFilename(vfs, filenames.GetAt(0)));
+	}
+}
+
+void detFileResourceListBenchmark::TestOutdated(){
+	SetSubTestNum(1);
+	
+	const deVirtualFileSystem::Ref vfs1(deVirtualFileSystem::Ref::New());
+	const deVirtualFileSystem::Ref vfs2(deVirtualFileSystem::Ref::New());
+	detFRLBManager manager(pEngine);
+	
+	const detFRLBResource::Ref resource1(detFRLBResource::Ref::New(&manager, vfs1, "/a.demodel"));
+	const detFRLBResource::Ref resource2(detFRLBResource::Ref::New(&manager, vfs2, "/a.demodel"));
+	manager.resources.Add(resource1);
+	manager.resources.Add(resource2);
+	ASSERT_EQUAL(manager.resources.GetWithFilename(vfs1, "/a.demodel"), resource1.Pointer());
+	ASSERT_EQUAL(manager.resources.GetWithFilename(vfs2, "/a.demodel"), resource2.Pointer());
+	
+	// outdated resources are skipped and replaced by the newly loaded resource
+	resource1->MarkOutdated();
+	ASSERT_NULL(manager.resources.GetWithFilename(vfs1, "/a.demodel"));
+	
+	const detFRLBResource::Ref resource3(detFRLBResource::Ref::New(&manager, vfs1, "/a.demodel"));
+	manager.resources.Add(resource3);
+	ASSERT_EQUAL(manager.resources.GetWithFilename(vfs1, "/a.demodel"), resource3.Pointer());
+	
+	manager.resources.Remove(resource1);
+	ASSERT_EQUAL(manager.resources.GetWithFilename(vfs1, "/a.demodel"), resource3.Pointer());
+	
+	manager.resources.RemoveIfPresent(resource3);
+	manager.resources.RemoveIfPresent(resource3);
+	ASSERT_NULL(manager.resources.GetWithFilename(vfs1, "/a.demodel"));
+	ASSERT_EQUAL(manager.resources.GetWithFilename(vfs2, "/a.demodel"), resource2.Pointer());
+}
@@ -0,0 +1,30 @@
+// include only once
+#ifndef _DETFILERESOURCELISTBENCHMARK_H_
+#define _DETFILERESOURCELISTBENCHMARK_H_
+
+// includes
+#include "../detCase.h"
+
+class deEngine;
+
+
+// class detFileResourceListBenchmark
+class detFileResourceListBenchmark : public detCase{
+private:
+	deEngine *pEngine;
+	
+public:
+	detFileResourceListBenchmark();
+	~detFileResourceListBenchmark() override;
+	void Prepare() override;
+	void Run() override;
+	void CleanUp() override;
+	const char *GetTestName() override;
+	
+private:
+	void BenchmarkLookup();
+	void TestOutdated();
+};
+
+// end of include only once
+#endif
@@ -0,0 +1,173 @@
+// includes
+#include <stdio.h>
+
+#include "detLoggerAsyncBenchmark.h"
+
+#include <dragengine/logger/deLoggerAsync.h>
+#include <dragengine/logger/deLoggerFile.h>
+#include <dragengine/threading/deSemaphore.h>
+#include <dragengine/threading/deThread.h>
+#include <dragengine/common/file/decDiskFileReader.h>
+#include <dragengine/common/file/decDiskFileWriter.h>
+#include <dragengine/common/math/decMath.h>
+#include <dragengine/common/utils/decTimer.h>
+#include <dragengine/common/exceptions.h>
+
+
+// definitions
+#define DETLAB_MESSAGES 160000
+#define DETLAB_FILENAME "detests_logger_benchmark.log"
+
+
+// Thread logging messages
+class detLABThread : public deThread{
+public:
+	deLogger &logger;
+	deSemaphore &start;
+	int index, messages;
+	
+	detLABThread(deLogger &nlogger, deSemaphore &nstart, int nindex, int nmessages) :
+	logger(nlogger), start(nstart), index(nindex), messages(nmessages){
+	}
+	
+	void Run() override{
+		start.Wait();
+		
+		int i;
+		for(i=0; i<messages; i++){
+			logger.LogInfoFormat("Benchmark", "Thread %d message %d: frame time %.3f ms", index, i, 16.667f);
+		}
+	}
+};
+
+
+// Run count threads logging messages. Stores elapsed time in seconds until all threads
+// finished logging and until all messages are flushed
+static void detLABRunThreads(deLogger &logger, int threadCount, int messages,
+float &elapsedLogging, float &elapsedFlushed){
+	detLABThread *threads[16] = {};
+	deSemaphore start;
+	int i;
+	
+	DEASSERT_TRUE(threadCount <= 16)
+	
+	for(i=0; i<threadCount; i++){
+		threads[i] = new detLABThread(logger, start, i, messages);
+		threads[i]->Start();
+	}
+	
+	decTimer timer;
+	for(i=0; i<threadCount; i++){
+		start.Signal();
+	}
+	for(i=0; i<threadCount; i++){
+		threads[i]->WaitForExit();
+	}
+	elapsedLogging = timer.PeekElapsedTime();
+	logger.Flush();
+	elapsedFlushed = timer.GetElapsedTime();
+	
+	for(i=0; i<threadCount; i++){
+		delete threads[i];
+	}
+}
+
+
+// Count lines in the log file
+static int detLABCountLines(){
+	const decDiskFileReader::Ref reader(decDiskFileReader::Ref::New(DETLAB_FILENAME));
+	const int length = reader->GetLength();
+	char buffer[4096];
+	int position = 0, lines = 0;
+	
+	while(position < length){
+		const int size = decMath::min(length - position, (int)sizeof(buffer));
+		reader->Read(buffer, size);
+		position += size;
+		
+		int i;
+		for(i=0; i<size; i++){
+			if(buffer[i] == '\n'){
+				lines++;
+			}
+		}
+	}
+	return lines;
+}
+
+
+// thread counts to test
+static const int vThreadCounts[] = {1, 2, 4, 8, 16, 0};
+
+
+static void detLABRunPrint(const char *name, deLogger &logger, int threadCount, int messages){
+	float elapsedLogging, elapsedFlushed;
+	detLABRunThreads(logger, threadCount, messages, elapsedLogging, elapsedFlushed);
+	
+	const float total = (float)(messages * threadCount);
+	printf("\n    %s: logging %8.2f ms, %10.0f msg/s | flushed %8.2f ms, %10.0f msg/s",
+		name, elapsedLogging * 1000.0f, total / decMath::max(elapsedLogging, 1e-6f),
+		elapsedFlushed * 1000.0f, total / decMath::max(elapsedFlushed, 1e-6f));
+}
+
+
+// Class detLoggerAsyncBenchmark
+//////////////////////////////////
+
+detLoggerAsyncBenchmark::detLoggerAsyncBenchmark(){
+}
+
+detLoggerAsyncBenchmark::~detLoggerAsyncBenchmark(){
+	CleanUp();
+}
+
+void detLoggerAsyncBenchmark::Prepare(){
+}
+
+void detLoggerAsyncBenchmark::Run(){
+	BenchmarkThroughput();
+}
+
+void detLoggerAsyncBenchmark::CleanUp(){
+	remove(DETLAB_FILENAME);
+}
+
+const char *detLoggerAsyncBenchmark::GetTestName(){
+	return "LoggerAsyncBenchmark";
+}
+
+
+// Benchmarks
+///////////////
+
+void detLoggerAsyncBenchmark::BenchmarkThroughput(){
+	SetSubTestNum(0);
+	
+	int i;
+	
+	printf("\n  Log messages to file (%d messages):", DETLAB_MESSAGES);
+	for(i=0; vThreadCounts[i] > 0; i++){
+		const int threadCount = vThreadCounts[i];
+		const int messages = DETLAB_MESSAGES / threadCount;
+		const int total = messages * threadCount;
+		
+		printf("\n   %2d threads:", threadCount);
+		
+		{
+		const deLoggerFile::Ref logger(deLoggerFile::Ref::New(
+			decDiskFileWriter::Ref::New(DETLAB_FILENAME, false)));
+		detLABRunPrint("file ", logger, threadCount, messages);
+		}
+		ASSERT_EQUAL(detLABCountLines(), total);
+		
+		{
+		const deLoggerFile::Ref target(deLoggerFile::Ref::New(
+			decDiskFileWriter::Ref::New(DETLAB_FILENAME, false)));
+		target->SetAutoFlush(false);
+		
+		const deLoggerAsync::Ref logger(deLoggerAsync::Ref::New(target));
+		detLABRunPrint("async", logger, threadCount, messages);
+		}
+		ASSERT_EQUAL(detLABCountLines(), total);
+	}
+}
@@ -0,0 +1,24 @@
+// include only once
+#ifndef _DETLOGGERASYNCBENCHMARK_H_
+#define _DETLOGGERASYNCBENCHMARK_H_
+
+// includes
+#include "../detCase.h"
+
+
+// class detLoggerAsyncBenchmark
+class detLoggerAsyncBenchmark : public detCase{
+public:
+	detLoggerAsyncBenchmark();
+	~detLoggerAsyncBenchmark() override;
+	void Prepare() override;
+	void Run() override;
+	void CleanUp() override;
+	const char *GetTestName() override;
+	
+private:
+	void BenchmarkThroughput();
+};
+
+// end of include only once
+#endif
@@ -0,0 +1,271 @@
+// includes
+#include <stdio.h>
+
+#include "detMathBatchBenchmark.h"
+
+#include <dragengine/common/math/decMathBatch.h>
+#include <dragengine/common/utils/decTimer.h>
+#include <dragengine/common/exceptions.h>
+
+
+// element count and repeat count of each benchmark
+static const int vElementCount = 10000;
+static const int vRepeatCount = 100;
+
+// allowed deviation of the batch implementation from the scalar one. slerp uses a
+// polynomial approximation while the scalar slerp falls back to linear interpolation
+// for nearly identical quaternions
+static const float vTolerance = 1e-5f;
+static const float vToleranceSlerp = 1e-4f;
+
+
+// Class detMathBatchBenchmark
+////////////////////////////////
+
+detMathBatchBenchmark::detMathBatchBenchmark(){
+}
+
+detMathBatchBenchmark::~detMathBatchBenchmark(){
+}
+
+void detMathBatchBenchmark::Prepare(){
+	pMatricesA = decTList<decMatrix>(vElementCount, decMatrix());
+	pMatricesB = decTList<decMatrix>(vElementCount, decMatrix());
+	pMatricesScalar = decTList<decMatrix>(vElementCount, decMatrix());
+	pMatricesSimd = decTList<decMatrix>(vElementCount, decMatrix());
+	pVectors = decTList<decVector>(vElementCount, decVector());
+	pVectorsScalar = decTList<decVector>(vElementCount, decVector());
+	pVectorsSimd = decTList<decVector>(vElementCount, decVector());
+	pQuatsA = decTList<decQuaternion>(vElementCount, decQuaternion());
+	pQuatsB = decTList<decQuaternion>(vElementCount, decQuaternion());
+	pQuatsScalar = decTList<decQuaternion>(vElementCount, decQuaternion());
+	pQuatsSimd = decTList<decQuaternion>(vElementCount, decQuaternion());
+	
+	int i;
+	for(i=0; i<vElementCount; i++){
+		const float f = (float)(i % 360) * DEG2RAD;
+		const float g = (float)(i % 17) * 0.25f;
+		
+		pMatricesA[i] = decMatrix::CreateSRT(decVector(1.0f + 0.1f * g, 1.0f, 0.5f + g),
+			decVector(f, -0.5f * f, 0.25f), decVector(g, -g, 2.0f * g));
+		pMatricesB[i] = decMatrix::CreateRT(decVector(0.3f, f, -f), decVector(-g, 0.5f, g));
+		pVectors[i].Set(g - 2.0f, 0.5f * f, 1.0f - g);
+		pQuatsA[i] = decMatrix::CreateRotation(f, 0.3f, -0.5f * f).ToQuaternion();
+		pQuatsB[i] = decMatrix::CreateRotation(-0.2f, 2.0f * f, g).ToQuaternion();
+	}
+}
+
+void detMathBatchBenchmark::Run(){
+	printf("\n  Math batch %d elements, scalar versus %s (per element):",
+		vElementCount, decMathBatch::GetImplementationName());
+	BenchmarkMultiply();
+	BenchmarkQuickMultiply();
+	BenchmarkTransform();
+	BenchmarkTransformNormal();
+	BenchmarkNormalize();
+	BenchmarkSlerp();
+}
+
+void detMathBatchBenchmark::CleanUp(){
+	pMatricesA.RemoveAll();
+	pMatricesB.RemoveAll();
+	pMatricesScalar.RemoveAll();
+	pMatricesSimd.RemoveAll();
+	pVectors.RemoveAll();
+	pVectorsScalar.RemoveAll();
+	pVectorsSimd.RemoveAll();
+	pQuatsA.RemoveAll();
+	pQuatsB.RemoveAll();
+	pQuatsScalar.RemoveAll();
+	pQuatsSimd.RemoveAll();
+}
+
+const char *detMathBatchBenchmark::GetTestName(){
+	return "MathBatchBenchmark";
+}
+
+
+// Benchmarks
+///////////////
+
+void detMathBatchBenchmark::BenchmarkMultiply(){
+	SetSubTestNum(0);
+	
+	decTimer timer;
+	int i;
+	for(i=0; i<vRepeatCount; i++){
+		decMathBatch::Scalar::Multiply(pMatricesA.GetArrayPointer(),
+			pMatricesB.GetArrayPointer(), pMatricesScalar.GetArrayPointer(), vElementCount);
+	}
+	const float elapsedScalar = timer.GetElapsedTime();
+	
+	for(i=0; i<vRepeatCount; i++){
+		decMathBatch::Multiply(pMatricesA.GetArrayPointer(),
+			pMatricesB.GetArrayPointer(), pMatricesSimd.GetArrayPointer(), vElementCount);
+	}
+	const float elapsedSimd = timer.GetElapsedTime();
+	
+	const float maxError = pMaxError(pMatricesScalar, pMatricesSimd);
+	pPrint("Multiply", elapsedScalar, elapsedSimd, maxError);
+	ASSERT_TRUE(maxError < vTolerance);
+}
+
+void detMathBatchBenchmark::BenchmarkQuickMultiply(){
+	SetSubTestNum(1);
+	
+	decTimer timer;
+	int i;
+	for(i=0; i<vRepeatCount; i++){
+		decMathBatch::Scalar::QuickMultiply(pMatricesA.GetArrayPointer(),
+			pMatricesB.GetArrayPointer(), pMatricesScalar.GetArrayPointer(), vElementCount);
+	}
+	const float elapsedScalar = timer.GetElapsedTime();
+	
+	for(i=0; i<vRepeatCount; i++){
+		decMathBatch::QuickMultiply(pMatricesA.GetArrayPointer(),
+			pMatricesB.GetArrayPointer(), pMatricesSimd.GetArrayPointer(), vElementCount);
+	}
+	const float elapsedSimd = timer.GetElapsedTime();
+	
+	const float maxError = pMaxError(pMatricesScalar, pMatricesSimd);
+	pPrint("QuickMultiply", elapsedScalar, elapsedSimd, maxError);
+	ASSERT_TRUE(maxError < vTolerance);
+}
+
+void detMathBatchBenchmark::BenchmarkTransform(){
+	SetSubTestNum(2);
+	
+	const decMatrix &matrix = pMatricesA[123];
+	decTimer timer;
+	int i;
+	for(i=0; i<vRepeatCount; i++){
+		decMathBatch::Scalar::Transform(matrix, pVectors.GetArrayPointer(),
+			pVectorsScalar.GetArrayPointer(), vElementCount);
+	}
+	const float elapsedScalar = timer.GetElapsedTime();
+	
+	for(i=0; i<vRepeatCount; i++){
+		decMathBatch::Transform(matrix, pVectors.GetArrayPointer(),
+			pVectorsSimd.GetArrayPointer(), vElementCount);
+	}
+	const float elapsedSimd = timer.GetElapsedTime();
+	
+	const float maxError = pMaxError(pVectorsScalar, pVectorsSimd);
+	pPrint("Transform", elapsedScalar, elapsedSimd, maxError);
+	ASSERT_TRUE(maxError < vTolerance);
+}
+
+void detMathBatchBenchmark::BenchmarkTransformNormal(){
+	SetSubTestNum(3);
+	
+	const decMatrix &matrix = pMatricesA[123];
+	decTimer timer;
+	int i;
+	for(i=0; i<vRepeatCount; i++){
+		decMathBatch::Scalar::TransformNormal(matrix, pVectors.GetArrayPointer(),
+			pVectorsScalar.GetArrayPointer(), vElementCount);
+	}
+	const float elapsedScalar = timer.GetElapsedTime();
+	
+	for(i=0; i<vRepeatCount; i++){
+		decMathBatch::TransformNormal(matrix, pVectors.GetArrayPointer(),
+			pVectorsSimd.GetArrayPointer(), vElementCount);
+	}
+	const float elapsedSimd = timer.GetElapsedTime();
+	
+	const float maxError = pMaxError(pVectorsScalar, pVectorsSimd);
+	pPrint("TransformNormal", elapsedScalar, elapsedSimd, maxError);
+	ASSERT_TRUE(maxError < vTolerance);
+}
+
+void detMathBatchBenchmark::BenchmarkNormalize(){
+	SetSubTestNum(4);
+	
+	float elapsedScalar = 0.0f, elapsedSimd = 0.0f;
+	decTimer timer;
+	int i, j;
+	
+	for(i=0; i<vRepeatCount; i++){
+		for(j=0; j<vElementCount; j++){
+			pQuatsScalar[j] = pQuatsA[j] * 2.5f;
+			pQuatsSimd[j] = pQuatsScalar[j];
+		}
+		
+		timer.Reset();
+		decMathBatch::Scalar::Normalize(pQuatsScalar.GetArrayPointer(), vElementCount);
+		elapsedScalar += timer.GetElapsedTime();
+		
+		decMathBatch::Normalize(pQuatsSimd.GetArrayPointer(), vElementCount);
+		elapsedSimd += timer.GetElapsedTime();
+	}
+	
+	const float maxError = pMaxError(pQuatsScalar, pQuatsSimd);
+	pPrint("Normalize", elapsedScalar, elapsedSimd, maxError);
+	ASSERT_TRUE(maxError < vTolerance);
+}
+
+void detMathBatchBenchmark::BenchmarkSlerp(){
+	SetSubTestNum(5);
+	
+	decTimer timer;
+	int i;
+	for(i=0; i<vRepeatCount; i++){
+		decMathBatch::Scalar::Slerp(pQuatsA.GetArrayPointer(), pQuatsB.GetArrayPointer(),
+			0.35f, pQuatsScalar.GetArrayPointer(), vElementCount);
+	}
+	const float elapsedScalar = timer.GetElapsedTime();
+	
+	for(i=0; i<vRepeatCount; i++){
+		decMathBatch::Slerp(pQuatsA.GetArrayPointer(), pQuatsB.GetArrayPointer(),
+			0.35f, pQuatsSimd.GetArrayPointer(), vElementCount);
+	}
+	const float elapsedSimd = timer.GetElapsedTime();
+	
+	const float maxError = pMaxError(pQuatsScalar, pQuatsSimd);
+	pPrint("Slerp", elapsedScalar, elapsedSimd, maxError);
+	ASSERT_TRUE(maxError < vToleranceSlerp);
+}
+
+
+// Private Functions
+//////////////////////
+
+void detMathBatchBenchmark::pPrint(const char *name, float elapsedScalar, float elapsedSimd, float maxError){
+	const float factor = 1e9f / (float)(vElementCount * vRepeatCount);
+	printf("\n    %-16s scalar %6.2f ns, batch %6.2f ns, speedup %5.2fx, max error %g",
+		name, elapsedScalar * factor, elapsedSimd * factor,
+		elapsedSimd > 0.0f ? elapsedScalar / elapsedSimd : 0.0f, maxError);
+}
+
+float detMathBatchBenchmark::pMaxError(const decTList<decMatrix> &a, const decTList<decMatrix> &b) const{
+	float maxError = 0.0f;
+	a.VisitIndexed([&](int i, const decMatrix &m){
+		const float * const fa = &m.a11;
+		const float * const fb = &b[i].a11;
+		int j;
+		for(j=0; j<16; j++){
+			maxError = decMath::max(maxError, fabsf(fa[j] - fb[j]));
+		}
+	});
+	return maxError;
+}
+
+float detMathBatchBenchmark::pMaxError(const decTList<decVector> &a, const decTList<decVector> &b) const{
+	float maxError = 0.0f;
+	a.VisitIndexed([&](int i, const decVector &v){
+		const decVector d((v - b[i]).Absolute());
+		maxError = decMath::max(maxError, decMath::max(decMath::max(d.x, d.y), d.z));
+	});
+	return maxError;
+}
+
+float detMathBatchBenchmark::pMaxError(const decTList<decQuaternion> &a, const decTList<decQuaternion> &b) const{
+	float maxError = 0.0f;
+	a.VisitIndexed([&](int i, const decQuaternion &q){
+		const decQuaternion &r = b[i];
+		maxError = decMath::max(maxError, decMath::max(
+			decMath::max(fabsf(q.x - r.x), fabsf(q.y - r.y)),
+			decMath::max(fabsf(q.z - r.z), fabsf(q.w - r.w))));
+	});
+	return maxError;
+}
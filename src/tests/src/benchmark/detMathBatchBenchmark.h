@@ -0,0 +1,42 @@
+// include only once
+#ifndef _DETMATHBATCHBENCHMARK_H_
+#define _DETMATHBATCHBENCHMARK_H_
+
+// includes
+#include "../detCase.h"
+
+#include <dragengine/common/collection/decTList.h>
+#include <dragengine/common/math/decMath.h>
+
+
+// class detMathBatchBenchmark
+class detMathBatchBenchmark : public detCase{
+private:
+	decTList<decMatrix> pMatricesA, pMatricesB, pMatricesScalar, pMatricesSimd;
+	decTList<decVector> pVectors, pVectorsScalar, pVectorsSimd;
+	decTList<decQuaternion> pQuatsA, pQuatsB, pQuatsScalar, pQuatsSimd;
+	
+public:
+	detMathBatchBenchmark();
+	~detMathBatchBenchmark() override;
+	void Prepare() override;
+	void Run() override;
+	void CleanUp() override;
+	const char *GetTestName() override;
+	
+private:
+	void BenchmarkMultiply();
+	void BenchmarkQuickMultiply();
+	void BenchmarkTransform();
+	void BenchmarkTransformNormal();
+	void BenchmarkNormalize();
+	void BenchmarkSlerp();
+	
+	void pPrint(const char *name, float elapsedScalar, float elapsedSimd, float maxError);
+	float pMaxError(const decTList<decMatrix> &a, const decTList<decMatrix> &b) const;
+	float pMaxError(const decTList<decVector> &a, const decTList<decVector> &b) const;
+	float pMaxError(const decTList<decQuaternion> &a, const decTList<decQuaternion> &b) const;
+};
+
+// end of include only once
+#endif
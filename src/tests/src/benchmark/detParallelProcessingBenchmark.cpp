@@ -0,0 +1,225 @@
+// includes
+#include <stdio.h>
+#include <atomic>
+
+#include "detParallelProcessingBenchmark.h"
+
+#include <dragengine/deEngine.h>
+#include <dragengine/app/deOSConsole.h>
+#include <dragengine/parallel/deParallelProcessing.h>
+#include <dragengine/parallel/deParallelTask.h>
+#include <dragengine/common/collection/decTList.h>
+#include <dragengine/common/math/decMath.h>
+#include <dragengine/common/utils/decTimer.h>
+#include <dragengine/common/exceptions.h>
+
+
+// definitions
+#define DETPPB_TASK_COUNT 20000
+#define DETPPB_CHAIN_LENGTH 16
+#define DETPPB_FANIN_WIDTH 32
+
+
+// Benchmark task
+class detPPBTask : public deParallelTask{
+public:
+	using Ref = deTThreadSafeObjectReference<detPPBTask>;
+	
+	std::atomic<int> &counter;
+	std::atomic<int> &orderErrors;
+	float value;
+	
+	detPPBTask(std::atomic<int> &ncounter, std::atomic<int> &norderErrors) :
+	deParallelTask(nullptr),
+	counter(ncounter),
+	orderErrors(norderErrors),
+	value(1.0f){
+	}
+	
+	void Run() override{
+		// verify dependencies finished before running. no lock required since
+		// dependencies are not modified while tasks are processed
+		if(!GetDependsOn().AllMatching([](const deParallelTask *t){
+			return t->GetFinished();
+		})){
+			orderErrors++;
+		}
+		
+		int i;
+		for(i=0; i<64; i++){
+			value = value * 1.0001f + 0.5f;
+		}
+		counter++;
+	}
+	
+	void Finished() override{
+	}
+	
+protected:
+	~detPPBTask() override = default;
+};
+
+
+// thread counts to test. benchmarks stop at the first count larger than the core count.
+// at least two threads are used to test work stealing on single core machines
+static const int vThreadCounts[] = {1, 2, 4, 8, 16, 32, 64, 0};
+
+
+// Class detParallelProcessingBenchmark
+/////////////////////////////////////////
+
+detParallelProcessingBenchmark::detParallelProcessingBenchmark() :
+pEngine(nullptr){
+}
+
+detParallelProcessingBenchmark::~detParallelProcessingBenchmark(){
+	CleanUp();
+}
+
+void detParallelProcessingBenchmark::Prepare(){
+	if(!pEngine){
+		pEngine = new deEngine(new deOSConsole, nullptr);
+	}
+}
+
+void detParallelProcessingBenchmark::Run(){
+	BenchmarkIndependent();
+	BenchmarkChains();
+	BenchmarkFanIn();
+}
+
+void detParallelProcessingBenchmark::CleanUp(){
+	if(pEngine){
+		delete pEngine;
+		pEngine = nullptr;
+	}
+}
+
+const char *detParallelProcessingBenchmark::GetTestName(){
+	return "ParallelProcessingBenchmark";
+}
+
+
+// Benchmarks
+///////////////
+
+void detParallelProcessingBenchmark::BenchmarkIndependent(){
+	SetSubTestNum(0);
+	
+	const int coreCount = pEngine->GetParallelProcessing().GetCoreCount();
+	int i, j;
+	
+	printf("\n  Independent tasks (%d tasks):", DETPPB_TASK_COUNT);
+	for(i=0; vThreadCounts[i] > 0 && vThreadCounts[i] <= decMath::max(coreCount, 2); i++){
+		const int threadCount = vThreadCounts[i];
+		deParallelProcessing parallel(*pEngine, threadCount);
+		std::atomic<int> counter(0), orderErrors(0);
+		decTList<detPPBTask::Ref> tasks(DETPPB_TASK_COUNT);
+		
+		for(j=0; j<DETPPB_TASK_COUNT; j++){
+			tasks.Add(detPPBTask::Ref::New(counter, orderErrors));
+		}
+		
+		decTimer timer;
+		tasks.Visit([&](detPPBTask *task){
+			parallel.AddTaskAsync(task);
+		});
+		tasks.Visit([&](detPPBTask *task){
+			parallel.WaitForTask(task);
+		});
+		const float elapsed = timer.GetElapsedTime();
+		
+		ASSERT_EQUAL(counter.load(), DETPPB_TASK_COUNT);
+		ASSERT_EQUAL(orderErrors.load(), 0);
+		
+		printf("\n    %2d threads: %8.2f ms, %10.0f tasks/s", threadCount,
+			elapsed * 1000.0f, (float)DETPPB_TASK_COUNT / decMath::max(elapsed, 1e-6f));
+	}
+}
+
+void detParallelProcessingBenchmark::BenchmarkChains(){
+	SetSubTestNum(1);
+	
+	const int coreCount = pEngine->GetParallelProcessing().GetCoreCount();
+	const int chainCount = DETPPB_TASK_COUNT / DETPPB_CHAIN_LENGTH;
+	int i, j, k;
+	
+	printf("\n  Dependency chains (%d chains of %d tasks):", chainCount, DETPPB_CHAIN_LENGTH);
+	for(i=0; vThreadCounts[i] > 0 && vThreadCounts[i] <= decMath::max(coreCount, 2); i++){
+		const int threadCount = vThreadCounts[i];
+		deParallelProcessing parallel(*pEngine, threadCount);
+		std::atomic<int> counter(0), orderErrors(0);
+		decTList<detPPBTask::Ref> tasks(DETPPB_TASK_COUNT);
+		
+		for(j=0; j<chainCount; j++){
+			for(k=0; k<DETPPB_CHAIN_LENGTH; k++){
+				const detPPBTask::Ref task(detPPBTask::Ref::New(counter, orderErrors));
+				if(k > 0){
+					task->AddDependsOn(tasks.Last());
+				}
+				tasks.Add(task);
+			}
+		}
+		
+		decTimer timer;
+		tasks.Visit([&](detPPBTask *task){
+			parallel.AddTaskAsync(task);
+		});
+		for(j=0; j<chainCount; j++){
+			parallel.WaitForTask(tasks.GetAt(j * DETPPB_CHAIN_LENGTH + DETPPB_CHAIN_LENGTH - 1));
+		}
+		const float elapsed = timer.GetElapsedTime();
+		
+		ASSERT_EQUAL(counter.load(), chainCount * DETPPB_CHAIN_LENGTH);
+		ASSERT_EQUAL(orderErrors.load(), 0);
+		
+		printf("\n    %2d threads: %8.2f ms, %10.0f tasks/s", threadCount,
+			elapsed * 1000.0f, (float)(chainCount * DETPPB_CHAIN_LENGTH) / decMath::max(elapsed, 1e-6f));
+	}
+}
+
+void detParallelProcessingBenchmark::BenchmarkFanIn(){
+	SetSubTestNum(2);
+	
+	const int coreCount = pEngine->GetParallelProcessing().GetCoreCount();
+	const int groupCount = DETPPB_TASK_COUNT / (DETPPB_FANIN_WIDTH + 1);
+	int i, j, k;
+	
+	printf("\n  Fan-in groups (%d groups of %d tasks):", groupCount, DETPPB_FANIN_WIDTH);
+	for(i=0; vThreadCounts[i] > 0 && vThreadCounts[i] <= decMath::max(coreCount, 2); i++){
+		const int threadCount = vThreadCounts[i];
+		deParallelProcessing parallel(*pEngine, threadCount);
+		std::atomic<int> counter(0), orderErrors(0);
+		decTList<detPPBTask::Ref> tasks, joins;
+		
+		for(j=0; j<groupCount; j++){
+			const detPPBTask::Ref join(detPPBTask::Ref::New(counter, orderErrors));
+			for(k=0; k<DETPPB_FANIN_WIDTH; k++){
+				const detPPBTask::Ref task(detPPBTask::Ref::New(counter, orderErrors));
+				join->AddDependsOn(task);
+				tasks.Add(task);
+			}
+			joins.Add(join);
+		}
+		
+		decTimer timer;
+		// add joins first so they are blocked before their dependencies are added
+		joins.Visit([&](detPPBTask *task){
+			parallel.AddTaskAsync(task);
+		});
+		tasks.Visit([&](detPPBTask *task){
+			parallel.AddTaskAsync(task);
+		});
+		joins.Visit([&](detPPBTask *task){
+			parallel.WaitForTask(task);
+		});
+		const float elapsed = timer.GetElapsedTime();
+		
+		const int taskCount = groupCount * (DETPPB_FANIN_WIDTH + 1);
+		ASSERT_EQUAL(counter.load(), taskCount);
+		ASSERT_EQUAL(orderErrors.load(), 0);
+		
+		printf("\n    %2d threads: %8.2f ms, %10.0f tasks/s", threadCount,
+			elapsed * 1000.0f, (float)taskCount / decMath::max(elapsed, 1e-6f));
+	}
+}
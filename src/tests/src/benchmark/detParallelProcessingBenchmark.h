@@ -0,0 +1,31 @@
+// include only once
+#ifndef _DETPARALLELPROCESSINGBENCHMARK_H_
+#define _DETPARALLELPROCESSINGBENCHMARK_H_
+
+// includes
+#include "../detCase.h"
+
+class deEngine;
+
+
+// class detParallelProcessingBenchmark
+class detParallelProcessingBenchmark : public detCase{
+private:
+	deEngine *pEngine;
+	
+public:
+	detParallelProcessingBenchmark();
+	~detParallelProcessingBenchmark() override;
+	void Prepare() override;
+	void Run() override;
+	void CleanUp() override;
+	const char *GetTestName() override;
+	
+private:
+	void BenchmarkIndependent();
+	void BenchmarkChains();
+	void BenchmarkFanIn();
+};
+
+// end of include only once
+#endif
@@ -0,0 +1,252 @@
+// includes
+#include <stdio.h>
+
+#include "detSpatialIndexBenchmark.h"
+
+#include <dragengine/common/math/decSpatialIndex.h>
+#include <dragengine/common/utils/decPRNG.h>
+#include <dragengine/common/utils/decTimer.h>
+#include <dragengine/common/exceptions.h>
+
+
+// count of simulated frames per element count and count of queries per query type.
+// elements move at up to 2m/s using 60 frames per second
+static const int vFrameCount = 10;
+static const int vQueryCount = 50;
+static const float vFrameTime = 1.0f / 60.0f;
+static const float vMaxSpeed = 2.0f;
+static const float vElementSize = 1.0f;
+
+
+// Class detSpatialIndexBenchmark
+///////////////////////////////////
+
+detSpatialIndexBenchmark::detSpatialIndexBenchmark(){
+}
+
+detSpatialIndexBenchmark::~detSpatialIndexBenchmark(){
+}
+
+void detSpatialIndexBenchmark::Prepare(){
+}
+
+void detSpatialIndexBenchmark::Run(){
+	printf("\n  Moving elements, update per frame and queries brute force versus index (per query):");
+	BenchmarkMovingElements(10000);
+	BenchmarkMovingElements(100000);
+	BenchmarkMovingElements(1000000);
+}
+
+void detSpatialIndexBenchmark::CleanUp(){
+	pPositions.RemoveAll();
+	pVelocities.RemoveAll();
+	pMinExtends.RemoveAll();
+	pMaxExtends.RemoveAll();
+}
+
+const char *detSpatialIndexBenchmark::GetTestName(){
+	return "SpatialIndexBenchmark";
+}
+
+
+// Benchmarks
+///////////////
+
+void detSpatialIndexBenchmark::BenchmarkMovingElements(int elementCount){
+	// constant density of one element per 4 square meters
+	const float worldSize = sqrtf((float)elementCount * 4.0f) * 0.5f;
+	pCreateElements(elementCount, worldSize);
+	
+	decTimer timer;
+	
+	// batch insert
+	decSpatialIndex index;
+	decTList<int> elements;
+	index.Insert(pMinExtends.GetArrayPointer(), pMaxExtends.GetArrayPointer(), elementCount, elements);
+	const float elapsedInsert = timer.GetElapsedTime();
+	
+	// simulate frames moving all elements
+	float elapsedMove = 0.0f;
+	int i, j, reinsertCount = 0;
+	for(i=0; i<vFrameCount; i++){
+		pMoveElements(vFrameTime, worldSize);
+		timer.Reset();
+		reinsertCount += index.Move(elements.GetArrayPointer(), pMinExtends.GetArrayPointer(),
+			pMaxExtends.GetArrayPointer(), elementCount);
+		elapsedMove += timer.GetElapsedTime();
+	}
+	
+	// queries
+	decPRNG prng(4711);
+	decTList<int> found, expected;
+	float elapsedBoxBruteForce = 0.0f, elapsedBoxIndex = 0.0f;
+	float elapsedRayBruteForce = 0.0f, elapsedRayIndex = 0.0f;
+	float elapsedFrustumBruteForce = 0.0f, elapsedFrustumIndex = 0.0f;
+	int foundCount = 0;
+	
+	for(i=0; i<vQueryCount; i++){
+		const decVector center(prng.RandomFloat(-worldSize, worldSize),
+			prng.RandomFloat(-2.0f, 2.0f), prng.RandomFloat(-worldSize, worldSize));
+		
+		// box of 40m size
+		const decVector minExtend(center - decVector(20.0f, 20.0f, 20.0f));
+		const decVector maxExtend(center + decVector(20.0f, 20.0f, 20.0f));
+		
+		expected.SetCountDiscard(0);
+		timer.Reset();
+		for(j=0; j<elementCount; j++){
+			if(pMaxExtends[j] >= minExtend && pMinExtends[j] <= maxExtend){
+				expected.Add(j);
+			}
+		}
+		elapsedBoxBruteForce += timer.GetElapsedTime();
+		
+		found.SetCountDiscard(0);
+		timer.Reset();
+		index.QueryBox(minExtend, maxExtend, found);
+		elapsedBoxIndex += timer.GetElapsedTime();
+		
+		pSortElements(found);
+		ASSERT_TRUE(found == expected);
+		foundCount += found.GetCount();
+		
+		// ray of 200m length
+		const float angle = prng.RandomFloat(0.0f, PI * 2.0f);
+		const decVector direction(sinf(angle) * 200.0f, prng.RandomFloat(-1.0f, 1.0f), cosf(angle) * 200.0f);
+		const decVector invDirection(1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z);
+		
+		expected.SetCountDiscard(0);
+		timer.Reset();
+		for(j=0; j<elementCount; j++){
+			const decVector t1((pMinExtends[j] - center).Multiply(invDirection));
+			const decVector t2((pMaxExtends[j] - center).Multiply(invDirection));
+			const decVector enter(t1.Smallest(t2)), leave(t1.Largest(t2));
+			if(decMath::max(0.0f, enter.x, decMath::max(enter.y, enter.z))
+			<= decMath::min(1.0f, leave.x, decMath::min(leave.y, leave.z))){
+				expected.Add(j);
+			}
+		}
+		elapsedRayBruteForce += timer.GetElapsedTime();
+		
+		found.SetCountDiscard(0);
+		timer.Reset();
+		index.QueryRay(center, direction, found);
+		elapsedRayIndex += timer.GetElapsedTime();
+		
+		pSortElements(found);
+		ASSERT_TRUE(found == expected);
+		
+		// camera frustum with 90 degrees field of view and 100m view distance
+		const sFrustum frustum(pCreateFrustum(center, angle));
+		
+		expected.SetCountDiscard(0);
+		timer.Reset();
+		for(j=0; j<elementCount; j++){
+			int k;
+			for(k=0; k<6; k++){
+				const decVector4 &p = frustum.planes[k];
+				if(decMath::max(p.x * pMinExtends[j].x, p.x * pMaxExtends[j].x)
+				+ decMath::max(p.y * pMinExtends[j].y, p.y * pMaxExtends[j].y)
+				+ decMath::max(p.z * pMinExtends[j].z, p.z * pMaxExtends[j].z) + p.w < 0.0f){
+					break;
+				}
+			}
+			if(k == 6){
+				expected.Add(j);
+			}
+		}
+		elapsedFrustumBruteForce += timer.GetElapsedTime();
+		
+		found.SetCountDiscard(0);
+		timer.Reset();
+		index.QueryPlanes(frustum.planes, 6, found);
+		elapsedFrustumIndex += timer.GetElapsedTime();
+		
+		pSortElements(found);
+		ASSERT_TRUE(found == expected);
+	}
+	
+	const float factor = 1e6f / (float)vQueryCount;
+	printf("\n    %7d elements: insert %7.2f ms, move %7.2f ms/frame (%5.1f%% reinserted), height %d",
+		elementCount, elapsedInsert * 1e3f, elapsedMove * 1e3f / (float)vFrameCount,
+		100.0f * (float)reinsertCount / (float)(elementCount * vFrameCount), index.GetHeight());
+	printf("\n      box:     brute force %9.2f us, index %7.2f us, speedup %7.1fx (%d found)",
+		elapsedBoxBruteForce * factor, elapsedBoxIndex * factor, elapsedBoxIndex > 0.0f
+			? elapsedBoxBruteForce / elapsedBoxIndex : 0.0f, foundCount / vQueryCount);
+	printf("\n      ray:     brute force %9.2f us, index %7.2f us, speedup %7.1fx",
+		elapsedRayBruteForce * factor, elapsedRayIndex * factor, elapsedRayIndex > 0.0f
+			? elapsedRayBruteForce / elapsedRayIndex : 0.0f);
+	printf("\n      frustum: brute force %9.2f us, index %7.2f us, speedup %7.1fx",
+		elapsedFrustumBruteForce * factor, elapsedFrustumIndex * factor, elapsedFrustumIndex > 0.0f
+			? elapsedFrustumBruteForce / elapsedFrustumIndex : 0.0f);
+}
+
+
+// Private Functions
+//////////////////////
+
+void detSpatialIndexBenchmark::pCreateElements(int elementCount, float worldSize){
+	decPRNG prng(4711);
+	int i;
+	
+	pPositions.SetCountDiscard(0);
+	pVelocities.SetCountDiscard(0);
+	pMinExtends.SetCountDiscard(0);
+	pMaxExtends.SetCountDiscard(0);
+	
+	for(i=0; i<elementCount; i++){
+		const decVector position(prng.RandomFloat(-worldSize, worldSize),
+			prng.RandomFloat(-2.0f, 2.0f), prng.RandomFloat(-worldSize, worldSize));
+		pPositions.Add(position);
+		pVelocities.Add(decVector(prng.RandomFloat(-vMaxSpeed, vMaxSpeed), 0.0f,
+			prng.RandomFloat(-vMaxSpeed, vMaxSpeed)));
+		pMinExtends.Add(position);
+		pMaxExtends.Add(position + decVector(vElementSize, vElementSize, vElementSize));
+	}
+}
+
+void detSpatialIndexBenchmark::pMoveElements(float elapsed, float worldSize){
+	const int count = pPositions.GetCount();
+	int i;
+	for(i=0; i<count; i++){
+		decVector &position = pPositions[i];
+		decVector &velocity = pVelocities[i];
+		
+		position += velocity * elapsed;
+		if(position.x < -worldSize || position.x > worldSize){
+			velocity.x = -velocity.x;
+		}
+		if(position.z < -worldSize || position.z > worldSize){
+			velocity.z = -velocity.z;
+		}
+		
+		pMinExtends[i] = position;
+		pMaxExtends[i] = position + decVector(vElementSize, vElementSize, vElementSize);
+	}
+}
+
+void detSpatialIndexBenchmark::pSortElements(decTList<int> &elements) const{
+	elements.Sort([](int a, int b){
+		return a < b ? -1 : (a > b ? 1 : 0);
+	});
+}
+
+detSpatialIndexBenchmark::sFrustum detSpatialIndexBenchmark::pCreateFrustum(
+const decVector &position, float yaw) const{
+	const decVector forward(sinf(yaw), 0.0f, cosf(yaw));
+	const decVector right(cosf(yaw), 0.0f, -sinf(yaw));
+	const decVector up(0.0f, 1.0f, 0.0f);
+	const decVector normals[6] = {
+		forward, -forward,
+		(forward + right).Normalized(), (forward - right).Normalized(),
+		(forward + up).Normalized(), (forward - up).Normalized()};
+	
+	sFrustum frustum;
+	int i;
+	for(i=0; i<6; i++){
+		frustum.planes[i].Set(normals[i].x, normals[i].y, normals[i].z, -(normals[i] * position));
+	}
+	frustum.planes[0].w -= 0.1f;
+	frustum.planes[1].w += 100.0f;
+	return frustum;
+}
@@ -0,0 +1,44 @@
+// include only once
+#ifndef _DETSPATIALINDEXBENCHMARK_H_
+#define _DETSPATIALINDEXBENCHMARK_H_
+
+// includes
+#include "../detCase.h"
+
+#include <dragengine/common/collection/decTList.h>
+#include <dragengine/common/math/decMath.h>
+
+class decSpatialIndex;
+
+
+// class detSpatialIndexBenchmark
+class detSpatialIndexBenchmark : public detCase{
+private:
+	struct sFrustum{
+		decVector4 planes[6];
+	};
+	
+	decTList<decVector> pPositions;
+	decTList<decVector> pVelocities;
+	decTList<decVector> pMinExtends;
+	decTList<decVector> pMaxExtends;
+	
+public:
+	detSpatialIndexBenchmark();
+	~detSpatialIndexBenchmark() override;
+	void Prepare() override;
+	void Run() override;
+	void CleanUp() override;
+	const char *GetTestName() override;
+	
+private:
+	void BenchmarkMovingElements(int elementCount);
+	
+	void pCreateElements(int elementCount, float worldSize);
+	void pMoveElements(float elapsed, float worldSize);
+	void pSortElements(decTList<int> &elements) const;
+	sFrustum pCreateFrustum(const decVector &position, float yaw) const;
+};
+
+// end of include only once
+#endif
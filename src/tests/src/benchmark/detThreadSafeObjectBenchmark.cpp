@@ -0,0 +1,244 @@
+// includes
+#include <stdio.h>
+#include <utility>
+
+#include "detThreadSafeObjectBenchmark.h"
+
+#include <dragengine/threading/deMutex.h>
+#include <dragengine/threading/deMutexGuard.h>
+#include <dragengine/threading/deSemaphore.h>
+#include <dragengine/threading/deThread.h>
+#include <dragengine/threading/deThreadSafeObject.h>
+#include <dragengine/threading/deTThreadSafeObjectReference.h>
+#include <dragengine/common/math/decMath.h>
+#include <dragengine/common/utils/decTimer.h>
+#include <dragengine/common/exceptions.h>
+
+
+// definitions
+#define DETTSOB_ITERATIONS 2000000
+
+
+// Atomic reference counted object
+class detTSOBAtomicObject : public deThreadSafeObject{
+public:
+	using Ref = deTThreadSafeObjectReference<detTSOBAtomicObject>;
+	
+	detTSOBAtomicObject() = default;
+	
+protected:
+	~detTSOBAtomicObject() override = default;
+};
+
+
+// Mutex protected reference counted object. Same as deThreadSafeObject used to be
+// implemented. Used as baseline to compare the atomic reference counting against
+class detTSOBMutexObject{
+public:
+	using Ref = deTThreadSafeObjectReference<detTSOBMutexObject>;
+	
+private:
+	int pRefCount;
+	deMutex pMutex;
+	
+public:
+	detTSOBMutexObject() : pRefCount(1){
+	}
+	
+	int GetRefCount(){
+		const deMutexGuard lock(pMutex);
+		return pRefCount;
+	}
+	
+	void AddReference(){
+		const deMutexGuard lock(pMutex);
+		pRefCount++;
+	}
+	
+	void FreeReference(){
+		deMutexGuard lock(pMutex);
+		pRefCount--;
+		if(pRefCount > 0){
+			return;
+		}
+		lock.Unlock();
+		delete this;
+	}
+	
+protected:
+	~detTSOBMutexObject() = default;
+};
+
+
+// Thread copying and releasing references
+template<class T> class detTSOBThread : public deThread{
+public:
+	const typename T::Ref object;
+	deSemaphore &start;
+	int iterations;
+	
+	detTSOBThread(const typename T::Ref &nobject, deSemaphore &nstart, int niterations) :
+	object(nobject), start(nstart), iterations(niterations){
+	}
+	
+	void Run() override{
+		start.Wait();
+		
+		int i;
+		for(i=0; i<iterations; i++){
+			const typename T::Ref copy(object);
+		}
+	}
+};
+
+
+// Run iterations on count threads returning elapsed time in seconds
+template<class T> static float detTSOBRunThreads(const typename T::Ref &object, int threadCount, int iterations){
+	detTSOBThread<T> *threads[8] = {};
+	deSemaphore start;
+	int i;
+	
+	DEASSERT_TRUE(threadCount <= 8)
+	
+	for(i=0; i<threadCount; i++){
+		threads[i] = new detTSOBThread<T>(object, start, iterations);
+		threads[i]->Start();
+	}
+	
+	decTimer timer;
+	for(i=0; i<threadCount; i++){
+		start.Signal();
+	}
+	for(i=0; i<threadCount; i++){
+		threads[i]->WaitForExit();
+	}
+	const float elapsed = timer.GetElapsedTime();
+	
+	for(i=0; i<threadCount; i++){
+		delete threads[i];
+	}
+	return elapsed;
+}
+
+
+// Receives reference by value and hands it back
+template<class T> static typename T::Ref detTSOBPass(typename T::Ref reference){
+	return reference;
+}
+
+
+// thread counts to test
+static const int vThreadCounts[] = {1, 2, 4, 8, 0};
+
+
+static void detTSOBPrint(const char *name, float elapsed, int operations){
+	printf("\n    %s: %8.2f ms, %12.0f ops/s", name, elapsed * 1000.0f,
+		(float)operations / decMath::max(elapsed, 1e-6f));
+}
+
+
+// Class detThreadSafeObjectBenchmark
+///////////////////////////////////////
+
+detThreadSafeObjectBenchmark::detThreadSafeObjectBenchmark(){
+}
+
+detThreadSafeObjectBenchmark::~detThreadSafeObjectBenchmark(){
+	CleanUp();
+}
+
+void detThreadSafeObjectBenchmark::Prepare(){
+}
+
+void detThreadSafeObjectBenchmark::Run(){
+	BenchmarkSingleThread();
+	BenchmarkContended();
+	BenchmarkHandOver();
+}
+
+void detThreadSafeObjectBenchmark::CleanUp(){
+}
+
+const char *detThreadSafeObjectBenchmark::GetTestName(){
+	return "ThreadSafeObjectBenchmark";
+}
+
+
+// Benchmarks
+///////////////
+
+void detThreadSafeObjectBenchmark::BenchmarkSingleThread(){
+	SetSubTestNum(0);
+	
+	const detTSOBAtomicObject::Ref atomicObject(detTSOBAtomicObject::Ref::New());
+	const detTSOBMutexObject::Ref mutexObject(detTSOBMutexObject::Ref::New());
+	int i;
+	
+	printf("\n  Single thread add/free reference pairs (%d pairs):", DETTSOB_ITERATIONS);
+	
+	decTimer timer;
+	for(i=0; i<DETTSOB_ITERATIONS; i++){
+		const detTSOBMutexObject::Ref copy(mutexObject);
+	}
+	detTSOBPrint("mutex ", timer.GetElapsedTime(), DETTSOB_ITERATIONS);
+	
+	timer.Reset();
+	for(i=0; i<DETTSOB_ITERATIONS; i++){
+		const detTSOBAtomicObject::Ref copy(atomicObject);
+	}
+	detTSOBPrint("atomic", timer.GetElapsedTime(), DETTSOB_ITERATIONS);
+	
+	ASSERT_EQUAL(mutexObject->GetRefCount(), 1);
+	ASSERT_EQUAL(atomicObject->GetRefCount(), 1);
+}
+
+void detThreadSafeObjectBenchmark::BenchmarkContended(){
+	SetSubTestNum(1);
+	
+	const detTSOBAtomicObject::Ref atomicObject(detTSOBAtomicObject::Ref::New());
+	const detTSOBMutexObject::Ref mutexObject(detTSOBMutexObject::Ref::New());
+	int i;
+	
+	printf("\n  Contended add/free reference pairs on shared object:");
+	for(i=0; vThreadCounts[i] > 0; i++){
+		const int threadCount = vThreadCounts[i];
+		const int iterations = DETTSOB_ITERATIONS / threadCount;
+		const int operations = iterations * threadCount;
+		
+		printf("\n   %2d threads:", threadCount);
+		detTSOBPrint("mutex ", detTSOBRunThreads<detTSOBMutexObject>(
+			mutexObject, threadCount, iterations), operations);
+		detTSOBPrint("atomic", detTSOBRunThreads<detTSOBAtomicObject>(
+			atomicObject, threadCount, iterations), operations);
+		
+		ASSERT_EQUAL(mutexObject->GetRefCount(), 1);
+		ASSERT_EQUAL(atomicObject->GetRefCount(), 1);
+	}
+}
+
+void detThreadSafeObjectBenchmark::BenchmarkHandOver(){
+	SetSubTestNum(2);
+	
+	detTSOBAtomicObject::Ref object(detTSOBAtomicObject::Ref::New());
+	detTSOBAtomicObject::Ref result;
+	int i;
+	
+	printf("\n  Hand over reference by value (%d calls):", DETTSOB_ITERATIONS);
+	
+	decTimer timer;
+	for(i=0; i<DETTSOB_ITERATIONS; i++){
+		result = detTSOBPass<detTSOBAtomicObject>(object);
+	}
+	detTSOBPrint("copy", timer.GetElapsedTime(), DETTSOB_ITERATIONS);
+	ASSERT_EQUAL(object->GetRefCount(), 2);
+	
+	result = nullptr;
+	timer.Reset();
+	for(i=0; i<DETTSOB_ITERATIONS; i++){
+		object = detTSOBPass<detTSOBAtomicObject>(std::move(object));
+	}
+	detTSOBPrint("move", timer.GetElapsedTime(), DETTSOB_ITERATIONS);
+	
+	ASSERT_TRUE(object.IsNotNull());
+	ASSERT_EQUAL(object->GetRefCount(), 1);
+}
@@ -0,0 +1,26 @@
+// include only once
+#ifndef _DETTHREADSAFEOBJECTBENCHMARK_H_
+#define _DETTHREADSAFEOBJECTBENCHMARK_H_
+
+// includes
+#include "../detCase.h"
+
+
+// class detThreadSafeObjectBenchmark
+class detThreadSafeObjectBenchmark : public detCase{
+public:
+	detThreadSafeObjectBenchmark();
+	~detThreadSafeObjectBenchmark() override;
+	void Prepare() override;
+	void Run() override;
+	void CleanUp() override;
+	const char *GetTestName() override;
+	
+private:
+	void BenchmarkSingleThread();
+	void BenchmarkContended();
+	void BenchmarkHandOver();
+};
+
+// end of include only once
+#endif
@@ -0,0 +1,216 @@
+// includes
+#include <stdio.h>
+
+#include "detVFSLookupCacheBenchmark.h"
+
+#include <dragengine/filesystem/deVirtualFileSystem.h>
+#include <dragengine/filesystem/deVFSDiskDirectory.h>
+#include <dragengine/filesystem/deVFSMemoryFiles.h>
+#include <dragengine/common/collection/decTList.h>
+#include <dragengine/common/file/decMemoryFile.h>
+#include <dragengine/common/math/decMath.h>
+#include <dragengine/common/string/decString.h>
+#include <dragengine/common/utils/decTimer.h>
+#include <dragengine/common/exceptions.h>
+
+
+// definitions
+#define DETVFSLCB_MISSING 200
+#define DETVFSLCB_ROUNDS 20
+
+
+// container counts to test
+static const int vContainerCounts[] = {1, 4, 16, 32, 0};
+
+
+// Create virtual file system with count disk containers. Each container holds one file
+static deVirtualFileSystem::Ref detVFSLCBCreateVFS(const decPath &basePath, int count){
+	const deVirtualFileSystem::Ref vfs(deVirtualFileSystem::Ref::New());
+	int i;
+	
+	for(i=0; i<count; i++){
+		decString name;
+		name.Format("container%d", i);
+		vfs->AddContainer(deVFSDiskDirectory::Ref::New(basePath + decPath::CreatePathUnix(name)));
+	}
+	return vfs;
+}
+
+
+// Paths to look up. Files present in one container followed by missing files
+static decTList<decPath> detVFSLCBQueries(int count){
+	decTList<decPath> queries;
+	decString path;
+	int i;
+	
+	for(i=0; i<count; i++){
+		path.Format("/data/file%d.txt", i);
+		queries.Add(decPath::CreatePathUnix(path));
+	}
+	for(i=0; i<DETVFSLCB_MISSING; i++){
+		path.Format("/data/missing%d.txt", i);
+		queries.Add(decPath::CreatePathUnix(path));
+	}
+	return queries;
+}
+
+
+// Run lookup rounds returning the count of found files
+static int detVFSLCBLookup(const deVirtualFileSystem &vfs, const decTList<decPath> &queries){
+	int i, found = 0;
+	for(i=0; i<DETVFSLCB_ROUNDS; i++){
+		queries.Visit([&](const decPath &path){
+			if(vfs.ExistsFile(path)){
+				found++;
+			}
+		});
+	}
+	return found;
+}
+
+
+// Class detVFSLookupCacheBenchmark
+/////////////////////////////////////
+
+detVFSLookupCacheBenchmark::detVFSLookupCacheBenchmark() :
+pContainerCount(0){
+}
+
+detVFSLookupCacheBenchmark::~detVFSLookupCacheBenchmark(){
+	CleanUp();
+}
+
+void detVFSLookupCacheBenchmark::Prepare(){
+	pBasePath = decPath::CreateWorkingDirectory();
+	pBasePath.AddComponent("detests_vfs_benchmark");
+	
+	int i;
+	for(i=0; vContainerCounts[i] > 0; i++){
+		pContainerCount = decMath::max(pContainerCount, vContainerCounts[i]);
+	}
+	
+	// each container holds the file with the matching index
+	const deVirtualFileSystem::Ref vfs(detVFSLCBCreateVFS(pBasePath, pContainerCount));
+	decString path;
+	for(i=0; i<pContainerCount; i++){
+		path.Format("/data/file%d.txt", i);
+		vfs->GetContainers().GetAt(i)->OpenFileForWriting(decPath::CreatePathUnix(path))->WriteByte(0);
+	}
+}
+
+void detVFSLookupCacheBenchmark::Run(){
+	BenchmarkLookup();
+	TestInvalidation();
+}
+
+void detVFSLookupCacheBenchmark::CleanUp(){
+	if(pContainerCount == 0){
+		return;
+	}
+	
+	const deVFSDiskDirectory::Ref base(deVFSDiskDirectory::Ref::New(pBasePath));
+	decString path;
+	int i;
+	
+	for(i=0; i<pContainerCount; i++){
+		path.Format("/container%d/data/file%d.txt", i, i);
+		base->DeleteFile(decPath::CreatePathUnix(path));
+		path.Format("/container%d/data", i);
+		base->DeleteFile(decPath::CreatePathUnix(path));
+		path.Format("/container%d", i);
+		base->DeleteFile(decPath::CreatePathUnix(path));
+	}
+	
+	deVFSDiskDirectory::Ref::New(pBasePath.GetParent())->DeleteFile(
+		decPath::CreatePathUnix(pBasePath.GetLastComponent()));
+	
+	pContainerCount = 0;
+}
+
+const char *detVFSLookupCacheBenchmark::GetTestName(){
+	return "VFSLookupCacheBenchmark";
+}
+
+
+// Benchmarks
+///////////////
+
+void detVFSLookupCacheBenchmark::BenchmarkLookup(){
+	SetSubTestNum(0);
+	
+	int i;
+	
+	printf("\n  ExistsFile on disk containers (%d missing files, %d rounds):",
+		DETVFSLCB_MISSING, DETVFSLCB_ROUNDS);
+	
+	for(i=0; vContainerCounts[i] > 0; i++){
+		const int count = vContainerCounts[i];
+		const deVirtualFileSystem::Ref vfs(detVFSLCBCreateVFS(pBasePath, count));
+		const decTList<decPath> queries(detVFSLCBQueries(count));
+		const int lookups = queries.GetCount() * DETVFSLCB_ROUNDS;
+		
+		decTimer timer;
+		const int foundUncached = detVFSLCBLookup(vfs, queries);
+		const float elapsedUncached = timer.GetElapsedTime();
+		
+		vfs->SetLookupCacheEnabled(true);
+		timer.Reset();
+		const int foundCached = detVFSLCBLookup(vfs, queries);
+		const float elapsedCached = timer.GetElapsedTime();
+		
+		printf("\n   %2d containers: uncached %8.2f ms | cached %8.2f ms (%6.1fx) |"
+			" %llu hits, %llu misses, %llu probes saved",
+			count, elapsedUncached * 1000.0f, elapsedCached * 1000.0f,
+			elapsedUncached / decMath::max(elapsedCached, 1e-6f),
+			(unsigned long long)vfs->GetLookupCacheHits(),
+			(unsigned long long)vfs->GetLookupCacheMisses(),
+			(unsigned long long)vfs->GetLookupCacheProbesSaved());
+		
+		ASSERT_EQUAL(foundUncached, count * DETVFSLCB_ROUNDS);
+		ASSERT_EQUAL(foundCached, foundUncached);
+		ASSERT_EQUAL((int)vfs->GetLookupCacheMisses(), queries.GetCount());
+		ASSERT_EQUAL((int)vfs->GetLookupCacheHits(), lookups - queries.GetCount());
+	}
+}
+
+void detVFSLookupCacheBenchmark::TestInvalidation(){
+	SetSubTestNum(1);
+	
+	const deVirtualFileSystem::Ref vfs(detVFSLCBCreateVFS(pBasePath, 2));
+	vfs->SetLookupCacheEnabled(true);
+	
+	const decPath pathMissing(decPath::CreatePathUnix("/data/missing.txt"));
+	const decPath pathFile0(decPath::CreatePathUnix("/data/file0.txt"));
+	const decPath pathFile1(decPath::CreatePathUnix("/data/file1.txt"));
+	
+	// writing through the virtual file system
+	ASSERT_FALSE(vfs->ExistsFile(pathMissing));
+	vfs->OpenFileForWriting(pathMissing)->WriteByte(0);
+	ASSERT_TRUE(vfs->ExistsFile(pathMissing));
+	vfs->DeleteFile(pathMissing);
+	ASSERT_FALSE(vfs->ExistsFile(pathMissing));
+	
+	// writing directly to a container
+	deVFSContainer &container = vfs->GetContainers().GetAt(0);
+	container.OpenFileForWriting(pathMissing)->WriteByte(0);
+	ASSERT_TRUE(vfs->ExistsFile(pathMissing));
+	container.DeleteFile(pathMissing);
+	ASSERT_FALSE(vfs->ExistsFile(pathMissing));
+	
+	// hiding path in the top container
+	ASSERT_TRUE(vfs->CanReadFile(pathFile0));
+	vfs->GetContainers().GetAt(1)->AddHiddenPath(pathFile0);
+	ASSERT_FALSE(vfs->CanReadFile(pathFile0));
+	vfs->GetContainers().GetAt(1)->RemoveAllHiddenPath();
+	ASSERT_TRUE(vfs->CanReadFile(pathFile0));
+	
+	// adding and removing containers
+	const deVFSMemoryFiles::Ref memoryFiles(deVFSMemoryFiles::Ref::New(decPath::CreatePathUnix("/")));
+	vfs->AddContainer(memoryFiles);
+	ASSERT_FALSE(vfs->ExistsFile(pathMissing));
+	memoryFiles->AddMemoryFile(decMemoryFile::Ref::New(pathMissing.GetPathUnix()));
+	ASSERT_TRUE(vfs->ExistsFile(pathMissing));
+	vfs->RemoveContainer(memoryFiles);
+	ASSERT_FALSE(vfs->ExistsFile(pathMissing));
+	ASSERT_TRUE(vfs->ExistsFile(pathFile1));
+}
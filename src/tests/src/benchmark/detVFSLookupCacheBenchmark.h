@@ -0,0 +1,30 @@
+// include only once
+#ifndef _DETVFSLOOKUPCACHEBENCHMARK_H_
+#define _DETVFSLOOKUPCACHEBENCHMARK_H_
+
+// includes
+#include "../detCase.h"
+
+#include <dragengine/common/file/decPath.h>
+
+
+// class detVFSLookupCacheBenchmark
+class detVFSLookupCacheBenchmark : public detCase{
+public:
+	detVFSLookupCacheBenchmark();
+	~detVFSLookupCacheBenchmark() override;
+	void Prepare() override;
+	void Run() override;
+	void CleanUp() override;
+	const char *GetTestName() override;
+	
+private:
+	decPath pBasePath;
+	int pContainerCount;
+	
+	void BenchmarkLookup();
+	void TestInvalidation();
+};
+
+// end of include only once
+#endif
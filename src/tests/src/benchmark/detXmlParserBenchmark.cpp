@@ -0,0 +1,232 @@
+// includes
+#include <stdio.h>
+#include <string.h>
+
+#include "detXmlParserBenchmark.h"
+
+#include <dragengine/common/xmlparser/decXmlParser.h>
+#include <dragengine/common/xmlparser/decXmlDocument.h>
+#include <dragengine/common/xmlparser/decXmlElementTag.h>
+#include <dragengine/common/xmlparser/decXmlAttValue.h>
+#include <dragengine/common/xmlparser/decXmlBinaryDocument.h>
+#include <dragengine/common/xmlparser/decXmlBinaryElement.h>
+#include <dragengine/common/file/decMemoryFileReader.h>
+#include <dragengine/common/file/decMemoryFileWriter.h>
+#include <dragengine/common/math/decMath.h>
+#include <dragengine/common/string/decString.h>
+#include <dragengine/common/utils/decTimer.h>
+#include <dragengine/common/exceptions.h>
+#include <dragengine/logger/deLoggerConsole.h>
+
+
+// definitions
+#define DETXPB_OBJECTS 40000
+#define DETXPB_ROUNDS 3
+
+
+// Append text to the corpus
+static void detXPBAppend(decMemoryFile &file, const char *text){
+	const int length = (int)strlen(text);
+	const int position = file.GetLength();
+	file.Resize(position + length, false);
+	memcpy(file.GetPointer() + position, text, length);
+}
+
+
+
+// Class detXmlParserBenchmark
+////////////////////////////////
+
+detXmlParserBenchmark::detXmlParserBenchmark() :
+pObjectCount(0),
+pLineCount(0){
+}
+
+detXmlParserBenchmark::~detXmlParserBenchmark(){
+	CleanUp();
+}
+
+void detXmlParserBenchmark::Prepare(){
+	// corpus similar to game definition files with a mix of attributes, entities,
+	// multi-line character data, comments and cdata sections
+	pCorpus = decMemoryFile::Ref::New("corpus.xml");
+	detXPBAppend(pCorpus, "<?xml version='1.0' encoding='UTF-8'?>\n<world>\n");
+	pLineCount = 2;
+	
+	decString text;
+	int i;
+	
+	for(i=0; i<DETXPB_OBJECTS; i++){
+		text.Format("\t<!-- object %d - generated -->\n"
+			"\t<object id='%d' name='object &amp; %d' class=\"Class%d\">\n"
+			"\t\t<position x='%g' y='%g' z='%g'/>\n"
+			"\t\t<description>Lorem ipsum dolor sit amet, consectetur adipiscing elit &lt;%d&gt;\n"
+			"\t\t\tsed do eiusmod tempor incididunt ut labore et dolore magna aliqua.\n"
+			"\t\t\tUt enim ad minim veniam, quis nostrud exercitation ullamco.</description>\n"
+			"\t\t<script><![CDATA[if(a < b && c > d){ run(%d); }]]></script>\n"
+			"\t</object>\n",
+			i, i, i, i % 17, 0.5 * i, 1.25 * i, -0.75 * i, i, i);
+		detXPBAppend(pCorpus, text);
+		pLineCount += 8;
+	}
+	
+	detXPBAppend(pCorpus, "</world>\n");
+	pLineCount++;
+	pObjectCount = DETXPB_OBJECTS;
+}
+
+void detXmlParserBenchmark::Run(){
+	BenchmarkParse();
+	BenchmarkBinary();
+}
+
+void detXmlParserBenchmark::CleanUp(){
+	pCorpus = nullptr;
+}
+
+const char *detXmlParserBenchmark::GetTestName(){
+	return "XmlParserBenchmark";
+}
+
+
+// Benchmarks
+///////////////
+
+void detXmlParserBenchmark::BenchmarkParse(){
+	SetSubTestNum(0);
+	
+	const deLoggerConsole::Ref logger(deLoggerConsole::Ref::New());
+	const float size = (float)pCorpus->GetLength() / (1024.0f * 1024.0f);
+	decTimer timer;
+	int i;
+	
+	printf("\n  Parse %.1f MB corpus (%d objects, %d rounds):", size, pObjectCount, DETXPB_ROUNDS);
+	
+	// reading the corpus character by character. this is the cost of the input
+	// path used by the parser before reading files in blocks
+	float elapsedRead = 0.0f;
+	for(i=0; i<DETXPB_ROUNDS; i++){
+		const decMemoryFileReader::Ref reader(decMemoryFileReader::Ref::New(pCorpus));
+		const int length = reader->GetLength();
+		int j, checksum = 0;
+		
+		timer.Reset();
+		for(j=0; j<length; j++){
+			checksum += reader->ReadChar();
+		}
+		elapsedRead += timer.GetElapsedTime();
+		ASSERT_TRUE(checksum != 0);
+	}
+	elapsedRead /= (float)DETXPB_ROUNDS;
+	
+	// parsing the corpus
+	float elapsedParse = 0.0f;
+	for(i=0; i<DETXPB_ROUNDS; i++){
+		const decMemoryFileReader::Ref reader(decMemoryFileReader::Ref::New(pCorpus));
+		const decXmlDocument::Ref document(decXmlDocument::Ref::New());
+		decXmlParser parser(logger);
+		
+		timer.Reset();
+		ASSERT_TRUE(parser.ParseXml(reader, document));
+		elapsedParse += timer.GetElapsedTime();
+		
+		decXmlElementTag * const root = document->GetRoot();
+		ASSERT_NOT_NULL(root);
+		
+		const int count = root->GetElementCount();
+		decXmlElementTag *last = nullptr;
+		int j, objectCount = 0;
+		for(j=0; j<count; j++){
+			decXmlElement * const element = root->GetElementAt(j);
+			if(element->CanCastToElementTag()){
+				last = element->CastToElementTag();
+				objectCount++;
+			}
+		}
+		ASSERT_EQUAL(objectCount, pObjectCount);
+		ASSERT_NOT_NULL(last);
+		
+		ASSERT_EQUAL(last->GetLineNumber(), pLineCount - 7);
+		ASSERT_EQUAL(last->GetPositionNumber(), 2);
+		
+		decXmlAttValue * const name = last->GetElementAt(1)->CastToAttValue();
+		decString expectedName;
+		expectedName.Format("object & %d", pObjectCount - 1);
+		ASSERT_EQUAL(name->GetValue(), expectedName);
+		ASSERT_EQUAL(name->GetPositionNumber(), 21);
+	}
+	elapsedParse /= (float)DETXPB_ROUNDS;
+	
+	printf("\n   ReadChar per character %8.2f ms (%7.1f MB/s)",
+		elapsedRead * 1000.0f, size / decMath::max(elapsedRead, 1e-6f));
+	printf("\n   ParseXml               %8.2f ms (%7.1f MB/s)",
+		elapsedParse * 1000.0f, size / decMath::max(elapsedParse, 1e-6f));
+}
+
+void detXmlParserBenchmark::BenchmarkBinary(){
+	SetSubTestNum(1);
+	
+	const deLoggerConsole::Ref logger(deLoggerConsole::Ref::New());
+	decTimer timer;
+	int i;
+	
+	printf("\n  Binary document (%d rounds):", DETXPB_ROUNDS);
+	
+	// parsing and compiling. this is the cost of a cache miss
+	float elapsedParse = 0.0f, elapsedCompile = 0.0f;
+	decXmlBinaryDocument::Ref binary;
+	for(i=0; i<DETXPB_ROUNDS; i++){
+		const decXmlDocument::Ref document(decXmlDocument::Ref::New());
+		decXmlParser parser(logger);
+		
+		timer.Reset();
+		ASSERT_TRUE(parser.ParseXml(decMemoryFileReader::Ref::New(pCorpus), document));
+		elapsedParse += timer.GetElapsedTime();
+		
+		binary = decXmlBinaryDocument::Ref::New(document);
+		elapsedCompile += timer.GetElapsedTime();
+	}
+	elapsedParse /= (float)DETXPB_ROUNDS;
+	elapsedCompile /= (float)DETXPB_ROUNDS;
+	
+	const decMemoryFile::Ref file(decMemoryFile::Ref::New("corpus.dexb"));
+	binary->Save(decMemoryFileWriter::Ref::New(file, false));
+	const float size = (float)file->GetLength() / (1024.0f * 1024.0f);
+	
+	// loading the binary document. this is the cost of a cache hit
+	float elapsedLoad = 0.0f;
+	for(i=0; i<DETXPB_ROUNDS; i++){
+		const decMemoryFileReader::Ref reader(decMemoryFileReader::Ref::New(file));
+		
+		timer.Reset();
+		const decXmlBinaryDocument::Ref loaded(decXmlBinaryDocument::Ref::New(reader));
+		elapsedLoad += timer.GetElapsedTime();
+		
+		const decXmlBinaryElement * const root = loaded->GetRoot();
+		ASSERT_NOT_NULL(root);
+		
+		const int count = root->GetElementCount();
+		const decXmlBinaryElement *last = nullptr;
+		int j, objectCount = 0;
+		for(j=0; j<count; j++){
+			const decXmlBinaryElement * const tag = root->GetElementIfTag(j);
+			if(tag){
+				last = tag;
+				objectCount++;
+			}
+		}
+		ASSERT_EQUAL(objectCount, pObjectCount);
+		ASSERT_NOT_NULL(last);
+		ASSERT_EQUAL(last->GetLineNumber(), pLineCount - 7);
+		
+		decString expectedName;
+		expectedName.Format("object & %d", pObjectCount - 1);
+		ASSERT_TRUE(last->FindAttribute("name")->GetValue() == expectedName);
+	}
+	elapsedLoad /= (float)DETXPB_ROUNDS;
+	
+	printf("\n   Parse + compile        %8.2f ms (%8.2f ms compile)",
+		elapsedParse * 1000.0f + elapsedCompile * 1000.0f, elapsedCompile * 1000.0f);
+	printf("\n   Load %5.1f MB binary    %8.2f ms (%.0fx faster)", size, elapsedLoad * 1000.0f,
+		(elapsedParse + elapsedCompile) / decMath::max(elapsedLoad, 1e-6f));
+}
@@ -0,0 +1,31 @@
+// include only once
+#ifndef _DETXMLPARSERBENCHMARK_H_
+#define _DETXMLPARSERBENCHMARK_H_
+
+// includes
+#include "../detCase.h"
+
+#include <dragengine/common/file/decMemoryFile.h>
+
+
+// class detXmlParserBenchmark
+class detXmlParserBenchmark : public detCase{
+public:
+	detXmlParserBenchmark();
+	~detXmlParserBenchmark() override;
+	void Prepare() override;
+	void Run() override;
+	void CleanUp() override;
+	const char *GetTestName() override;
+	
+private:
+	decMemoryFile::Ref pCorpus;
+	int pObjectCount;
+	int pLineCount;
+	
+	void BenchmarkParse();
+	void BenchmarkBinary();
+};
+
+// end of include only once
+#endif
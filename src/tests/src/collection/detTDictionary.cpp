@@ -45,6 +45,11 @@ void detTDictionary::Run(){
 	TestInject();
 	TestRemoveIf();
 	TestConstIterator();
+	TestGrowRehash();
+	TestRemoveMany();
+	TestHeterogeneousLookup();
+	TestPointerKeys();
+	TestSetAtSelfReference();
 }
 
 void detTDictionary::CleanUp(){
@@ -811,3 +816,242 @@ void detTDictionary::TestInject(){
 	ASSERT_TRUE(result.Find("20,") >= 0);
 	ASSERT_TRUE(result.Find("30,") >= 0);
 }
+
+
+// Tests - Hash Index
+//////////////////////
+
+void detTDictionary::TestGrowRehash(){
+	SetSubTestNum(15);
+	
+	decTStringIntDict dict;
+	decString key;
+	int i;
+	
+	// grows many times past the initial capacity
+	for(i=0; i<5000; i++){
+		key.Format("key%d", i);
+		dict.SetAt(key, i);
+		ASSERT_EQUAL(dict.GetCount(), i + 1);
+	}
+	
+	for(i=0; i<5000; i++){
+		key.Format("key%d", i);
+		ASSERT_TRUE(dict.Has(key));
+		ASSERT_EQUAL(dict.GetAt(key), i);
+	}
+	ASSERT_FALSE(dict.Has("key5000"));
+	ASSERT_FALSE(dict.Has("key-1"));
+	
+	// overwriting does not add entries
+	for(i=0; i<5000; i+=7){
+		key.Format("key%d", i);
+		dict.SetAt(key, -i);
+	}
+	ASSERT_EQUAL(dict.GetCount(), 5000);
+	ASSERT_EQUAL(dict.GetAt("key21"), -21);
+	ASSERT_EQUAL(dict.GetAt("key22"), 22);
+	
+	// initial capacity smaller than the content
+	decTStringIntDict dict2(1);
+	for(i=0; i<100; i++){
+		key.Format("%d", i);
+		dict2.SetAt(key, i);
+	}
+	ASSERT_EQUAL(dict2.GetCount(), 100);
+	ASSERT_EQUAL(dict2.GetAt("99"), 99);
+	
+	ASSERT_DOES_FAIL(decTStringIntDict(0));
+	
+	// copy and assignment of large dictionary
+	decTStringIntDict dict3(dict);
+	ASSERT_TRUE(dict3 == dict);
+	dict2 = dict;
+	ASSERT_TRUE(dict2 == dict);
+	ASSERT_EQUAL(dict2.GetAt("key4999"), 4999);
+	
+	// RemoveAll keeps dictionary usable
+	dict2.RemoveAll();
+	ASSERT_TRUE(dict2.IsEmpty());
+	ASSERT_FALSE(dict2.Has("key1"));
+	dict2.SetAt("key1", 1);
+	ASSERT_EQUAL(dict2.GetCount(), 1);
+	ASSERT_EQUAL(dict2.GetAt("key1"), 1);
+}
+
+void detTDictionary::TestRemoveMany(){
+	SetSubTestNum(16);
+	
+	decTStringIntDict dict;
+	decString key;
+	int i;
+	
+	for(i=0; i<2000; i++){
+		key.Format("k%d", i);
+		dict.SetAt(key, i);
+	}
+	
+	// remove every odd entry
+	for(i=1; i<2000; i+=2){
+		key.Format("k%d", i);
+		dict.Remove(key);
+	}
+	ASSERT_EQUAL(dict.GetCount(), 1000);
+	
+	for(i=0; i<2000; i++){
+		key.Format("k%d", i);
+		ASSERT_EQUAL(dict.Has(key), i % 2 == 0);
+	}
+	
+	ASSERT_FALSE(dict.RemoveIfPresent("k1"));
+	ASSERT_DOES_FAIL(dict.Remove("k1"));
+	
+	// iteration, keys, values and visiting see the same entries
+	int count = 0, sum = 0;
+	for(const auto &entry : dict){
+		ASSERT_EQUAL(entry.first.GetAt(0), 'k');
+		ASSERT_EQUAL(dict.GetAt(entry.first), entry.second);
+		ASSERT_EQUAL(entry.second % 2, 0);
+		sum += entry.second;
+		count++;
+	}
+	ASSERT_EQUAL(count, 1000);
+	ASSERT_EQUAL(sum, 999000);
+	ASSERT_EQUAL(dict.GetKeys().GetCount(), 1000);
+	ASSERT_EQUAL(dict.GetValues().Inject(0, [](int acc, int v){ return acc + v; }), 999000);
+	
+	// re-adding removed entries
+	for(i=1; i<2000; i+=2){
+		key.Format("k%d", i);
+		dict.SetAt(key, i);
+	}
+	ASSERT_EQUAL(dict.GetCount(), 2000);
+	ASSERT_EQUAL(dict.GetAt("k1999"), 1999);
+	
+	// remove if with many matches
+	dict.RemoveIf([](const decString &, int v){ return v % 3 != 0; });
+	ASSERT_EQUAL(dict.GetCount(), 667);
+	for(i=0; i<2000; i++){
+		key.Format("k%d", i);
+		ASSERT_EQUAL(dict.Has(key), i % 3 == 0);
+	}
+	
+	// remove everything one by one
+	for(i=0; i<2000; i+=3){
+		key.Format("k%d", i);
+		dict.Remove(key);
+	}
+	ASSERT_TRUE(dict.IsEmpty());
+	ASSERT_TRUE(dict.begin() == dict.end());
+}
+
+void detTDictionary::TestHeterogeneousLookup(){
+	SetSubTestNum(17);
+	
+	decTStringIntDict dict;
+	dict.SetAt("alpha", 1);
+	dict.SetAt("beta", 2);
+	dict.SetAt("gamma", 3);
+	
+	// lookup using const char* without creating a decString
+	const char * const alpha = "alpha";
+	ASSERT_TRUE(dict.Has(alpha));
+	ASSERT_FALSE(dict.Has((const char*)"delta"));
+	ASSERT_EQUAL(dict.GetAt(alpha), 1);
+	ASSERT_EQUAL(dict.GetAtOrDefault((const char*)"delta", 9), 9);
+	
+	const int *value = nullptr;
+	ASSERT_TRUE(dict.GetAt((const char*)"beta", value));
+	ASSERT_EQUAL(*value, 2);
+	
+	dict.GetAt(alpha) = 10;
+	ASSERT_EQUAL(dict.GetAt(decString("alpha")), 10);
+	
+	ASSERT_TRUE(dict.RemoveIfPresent((const char*)"gamma"));
+	ASSERT_FALSE(dict.RemoveIfPresent((const char*)"gamma"));
+	dict.Remove((const char*)"beta");
+	ASSERT_DOES_FAIL(dict.Remove((const char*)"beta"));
+	ASSERT_EQUAL(dict.GetCount(), 1);
+}
+
+void detTDictionary::TestPointerKeys(){
+	SetSubTestNum(18);
+	
+	// pointer keys are aligned. the hash index has to spread them nevertheless
+	int values[1000];
+	decTDictionary<int*, int> dict;
+	int i;
+	
+	for(i=0; i<1000; i++){
+		values[i] = i;
+		dict.SetAt(values + i, i);
+	}
+	ASSERT_EQUAL(dict.GetCount(), 1000);
+	
+	for(i=0; i<1000; i++){
+		ASSERT_EQUAL(dict.GetAt(values + i), i);
+	}
+	
+	for(i=0; i<1000; i+=2){
+		dict.Remove(values + i);
+	}
+	ASSERT_EQUAL(dict.GetCount(), 500);
+	
+	for(i=0; i<1000; i++){
+		ASSERT_EQUAL(dict.Has(values + i), i % 2 == 1);
+	}
+	ASSERT_FALSE(dict.Has(nullptr));
+	
+	// integer keys
+	decTDictionary<int, int> dictInt;
+	for(i=0; i<1000; i++){
+		dictInt.SetAt(i * 1024, i);
+	}
+	for(i=0; i<1000; i++){
+		ASSERT_EQUAL(dictInt.GetAt(i * 1024), i);
+	}
+	ASSERT_FALSE(dictInt.Has(1));
+}
+
+void detTDictionary::TestSetAtSelfReference(){
+	SetSubTestNum(19);
+	
+	// adding entries using keys and values referencing entries of the same dictionary
+	// has to work even if adding grows the entry storage
+	decTDictionary<decString, decString, decString, decString> dict;
+	dict.SetAt("key0", "value0");
+	
+	int i;
+	for(i=1; i<200; i++){
+		decString key;
+		key.Format("key%d", i);
+		
+		decString prevKey;
+		prevKey.Format("key%d", i - 1);
+		dict.SetAt(key, dict.GetAt(prevKey));
+	}
+	
+	ASSERT_EQUAL(dict.GetCount(), 200);
+	for(i=0; i<200; i++){
+		decString key;
+		key.Format("key%d", i);
+		ASSERT_EQUAL(dict.GetAt(key), "value0");
+	}
+	
+	// value used as key of a new entry
+	decTDictionary<decString, decString, decString, decString> dict2;
+	for(i=0; i<50; i++){
+		decString key;
+		key.Format("k%d", i);
+		decString value;
+		value.Format("v%d", i);
+		dict2.SetAt(key, value);
+	}
+	for(i=0; i<50; i++){
+		decString key;
+		key.Format("k%d", i);
+		dict2.SetAt(dict2.GetAt(key), key);
+	}
+	ASSERT_EQUAL(dict2.GetCount(), 100);
+	ASSERT_EQUAL(dict2.GetAt("v7"), "k7");
+}
@@ -30,6 +30,13 @@ private:
 	void TestInject();
 	void TestRemoveIf();
 	void TestConstIterator();
+	
+	// Test methods for hash index
+	void TestGrowRehash();
+	void TestRemoveMany();
+	void TestHeterogeneousLookup();
+	void TestPointerKeys();
+	void TestSetAtSelfReference();
 
 public:
 	detTDictionary();
@@ -57,6 +57,10 @@ void detTSet::Run(){
 	TestStringInject();
 	TestStringVisit();
 	TestStringRemoveIf();
+	// hash index
+	TestIntLarge();
+	TestStringLarge();
+	TestPointerLarge();
 }
 
 void detTSet::CleanUp(){
@@ -968,3 +972,131 @@ void detTSet::TestStringRemoveIf(){
 	ASSERT_TRUE(set.IsEmpty());
 }
 
+
+// Tests - Hash Index
+//////////////////////
+
+void detTSet::TestIntLarge(){
+	SetSubTestNum(24);
+	
+	decTSetInt set;
+	int i;
+	
+	// large enough to use the hash index
+	for(i=0; i<3000; i++){
+		ASSERT_TRUE(set.Add(i * 3));
+	}
+	ASSERT_EQUAL(set.GetCount(), 3000);
+	ASSERT_FALSE(set.Add(0));
+	ASSERT_FALSE(set.Add(8997));
+	ASSERT_DOES_FAIL(set.AddOrThrow(300));
+	
+	for(i=0; i<9000; i++){
+		ASSERT_EQUAL(set.Has(i), i % 3 == 0);
+	}
+	for(i=0; i<set.GetCount(); i++){
+		ASSERT_EQUAL(set.IndexOf(set.GetAt(i)), i);
+	}
+	
+	// remove many elements moving elements around
+	for(i=0; i<3000; i+=2){
+		ASSERT_TRUE(set.Remove(i * 3));
+	}
+	ASSERT_EQUAL(set.GetCount(), 1500);
+	for(i=0; i<3000; i++){
+		ASSERT_EQUAL(set.Has(i * 3), i % 2 == 1);
+	}
+	for(i=0; i<set.GetCount(); i++){
+		ASSERT_EQUAL(set.IndexOf(set.GetAt(i)), i);
+	}
+	
+	// remove if compacts the elements
+	set.RemoveIf([](int v){ return v % 5 == 0; });
+	for(i=0; i<3000; i++){
+		ASSERT_EQUAL(set.Has(i * 3), i % 2 == 1 && (i * 3) % 5 != 0);
+	}
+	for(i=0; i<set.GetCount(); i++){
+		ASSERT_EQUAL(set.IndexOf(set.GetAt(i)), i);
+	}
+	
+	// copy, move and operators keep lookups working
+	decTSetInt copy(set);
+	ASSERT_TRUE(copy == set);
+	
+	const decTSetInt added(set + 1);
+	ASSERT_EQUAL(added.GetCount(), set.GetCount() + 1);
+	ASSERT_TRUE(added.Has(1));
+	ASSERT_TRUE(added.Has(9));
+	
+	const decTSetInt removed(added - set);
+	ASSERT_EQUAL(removed.GetCount(), 1);
+	ASSERT_TRUE(removed.Has(1));
+	
+	decTSetInt moved(std::move(copy));
+	ASSERT_TRUE(moved == set);
+	ASSERT_FALSE(moved.Add(9));
+	
+	copy = moved;
+	copy -= set;
+	ASSERT_TRUE(copy.IsEmpty());
+	ASSERT_FALSE(copy.Has(9));
+	
+	// remove all keeps the set usable
+	set.RemoveAll();
+	ASSERT_FALSE(set.Has(9));
+	ASSERT_TRUE(set.Add(9));
+	ASSERT_TRUE(set.Has(9));
+	ASSERT_EQUAL(set.GetCount(), 1);
+}
+
+void detTSet::TestStringLarge(){
+	SetSubTestNum(25);
+	
+	decTSetString set;
+	decString value;
+	int i;
+	
+	for(i=0; i<1000; i++){
+		value.Format("item%d", i);
+		ASSERT_TRUE(set.Add(value));
+	}
+	for(i=0; i<1000; i++){
+		value.Format("item%d", i);
+		ASSERT_FALSE(set.Add(value));
+	}
+	ASSERT_EQUAL(set.GetCount(), 1000);
+	
+	for(i=0; i<1000; i+=3){
+		value.Format("item%d", i);
+		ASSERT_TRUE(set.Remove(value));
+		ASSERT_FALSE(set.Remove(value));
+	}
+	for(i=0; i<1000; i++){
+		value.Format("item%d", i);
+		ASSERT_EQUAL(set.Has(value), i % 3 != 0);
+	}
+	ASSERT_FALSE(set.Has("item1000"));
+}
+
+void detTSet::TestPointerLarge(){
+	SetSubTestNum(26);
+	
+	int values[500];
+	decTSet<int*> set;
+	int i;
+	
+	for(i=0; i<500; i++){
+		ASSERT_TRUE(set.Add(values + i));
+	}
+	ASSERT_TRUE(set.Add(nullptr));
+	ASSERT_FALSE(set.Add(nullptr));
+	ASSERT_EQUAL(set.GetCount(), 501);
+	
+	for(i=0; i<500; i+=2){
+		ASSERT_TRUE(set.Remove(values + i));
+	}
+	for(i=0; i<500; i++){
+		ASSERT_EQUAL(set.Has(values + i), i % 2 == 1);
+	}
+	ASSERT_TRUE(set.Has(nullptr));
+}
@@ -39,6 +39,11 @@ private:
 	void TestStringInject();
 	void TestStringVisit();
 	void TestStringRemoveIf();
+	
+	// Test methods for hash index
+	void TestIntLarge();
+	void TestStringLarge();
+	void TestPointerLarge();
 
 public:
 	detTSet();
@@ -22,16 +22,36 @@
 #include "math/detMath.h"
 #include "math/detColorMatrix.h"
 #include "math/detConvexVolume.h"
+#include "math/detSpatialIndex.h"
 #include "math/detTexMatrix2.h"
 #include "utils/detUniqueID.h"
 #include "utils/detPRNG.h"
 #include "utils/detUuid.h"
 #include "threading/detThreading.h"
+#include "logger/detLoggerAsync.h"
 #include "file/detZFile.h"
+#include "file/detMappedFile.h"
+#include "file/detArchiveDelga.h"
+#include "file/detDeflateFileReader.h"
+#include "file/detLZ4Codec.h"
+#include "file/detCachePack.h"
+#include "file/detDeflateChunk.h"
+#include "file/detXmlBinaryDocument.h"
+#include "animation/detAnimationCompressed.h"
 #include "detObjectReference.h"
 #include "detWeakObjectReference.h"
 #include "detThreadSafeObjectReference.h"
 #include "detUniqueReference.h"
+#include "benchmark/detParallelProcessingBenchmark.h"
+#include "benchmark/detFileResourceListBenchmark.h"
+#include "benchmark/detThreadSafeObjectBenchmark.h"
+#include "benchmark/detCollectionBenchmark.h"
+#include "benchmark/detMathBatchBenchmark.h"
+#include "benchmark/detSpatialIndexBenchmark.h"
+#include "benchmark/detLoggerAsyncBenchmark.h"
+#include "benchmark/detVFSLookupCacheBenchmark.h"
+#include "benchmark/detCachePackBenchmark.h"
+#include "benchmark/detXmlParserBenchmark.h"
 
 #include <dragengine/common/exceptions.h>
 #include <dragengine/logger/deLoggerConsoleColor.h>
@@ -162,7 +182,8 @@ public:
 // entry point
 ////////////////
 int main(int argc, char **args){
-	return detRunner().Run() ? 0 : 1;
+	const bool benchmarks = argc > 1 && strcmp(args[1], "--benchmark") == 0;
+	return detRunner(benchmarks).Run() ? 0 : 1;
 }
 
 
@@ -173,13 +194,27 @@ int main(int argc, char **args){
 void special();
 #endif
 
-detRunner::detRunner(){
+detRunner::detRunner(bool benchmarks){
 	#ifndef DETESTS_SPECIAL_OFF
 	special();
 	#endif
 	
 	pCount = 0;
 	pCases = nullptr;
+	
+	if(benchmarks){
+		pAddBenchmarks();
+	}else{
+		pAddTests();
+	}
+}
+detRunner::~detRunner(){
+	if(pCases){
+		for(int i=0; i<pCount; i++) delete pCases[i];
+		delete [] pCases;
+	}
+}
+void detRunner::pAddTests(){
 	pAddTest(new detString);
 	pAddTest(new detStringList);
 	pAddTest(new detStringSet);
@@ -195,27 +230,31 @@ detRunner::detRunner(){
 	pAddTest(new detHelperFunctions);
 	pAddTest(new detPath);
 	pAddTest(new detZFile);
+	pAddTest(new detMappedFile);
+	pAddTest(new detArchiveDelga);
+	pAddTest(new detDeflateFileReader);
+	pAddTest(new detLZ4Codec);
+	pAddTest(new detCachePack);
+	pAddTest(new detDeflateChunk);
+	pAddTest(new detXmlBinaryDocument);
+	pAddTest(new detAnimationCompressed);
 	pAddTest(new detMath);
 	pAddTest(new detCurve2D);
 	pAddTest(new detCurveBezier3D);
 	pAddTest(new detConvexVolume);
+	pAddTest(new detSpatialIndex);
 	pAddTest(new detColorMatrix);
 	pAddTest(new detTexMatrix2);
 	pAddTest(new detUniqueID);
 	pAddTest(new detPRNG);
 	pAddTest(new detUuid);
 	pAddTest(new detThreading);
+	pAddTest(new detLoggerAsync);
 	pAddTest(new detObjectReference);
 	pAddTest(new detWeakObjectReference);
 	pAddTest(new detThreadSafeObjectReference);
 	pAddTest(new detUniqueReference);
 }
-detRunner::~detRunner(){
-	if(pCases){
-		for(int i=0; i<pCount; i++) delete pCases[i];
-		delete [] pCases;
-	}
-}
 bool detRunner::Run(){
 	int i, errorCount = 0;
 	
@@ -250,6 +289,18 @@ bool detRunner::Run(){
 }
 
 // private functions
+void detRunner::pAddBenchmarks(){
+	pAddTest(new detParallelProcessingBenchmark);
+	pAddTest(new detThreadSafeObjectBenchmark);
+	pAddTest(new detFileResourceListBenchmark);
+	pAddTest(new detCollectionBenchmark);
+	pAddTest(new detMathBatchBenchmark);
+	pAddTest(new detSpatialIndexBenchmark);
+	pAddTest(new detLoggerAsyncBenchmark);
+	pAddTest(new detVFSLookupCacheBenchmark);
+	pAddTest(new detCachePackBenchmark);
+	pAddTest(new detXmlParserBenchmark);
+}
 void detRunner::pAddTest(detCase *testCase){
 	detCase **newArray = new detCase*[pCount+1];
 	int i;
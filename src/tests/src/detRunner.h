@@ -11,10 +11,12 @@ private:
 	detCase **pCases;
 	int pCount;
 public:
-	detRunner();
+	explicit detRunner(bool benchmarks = false);
 	~detRunner();
 	bool Run();
 private:
+	void pAddTests();
+	void pAddBenchmarks();
 	void pAddTest(detCase *testCase);
 };
 
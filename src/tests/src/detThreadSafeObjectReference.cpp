@@ -3,6 +3,8 @@
 
 #include "detThreadSafeObjectReference.h"
 
+#include <dragengine/threading/deThread.h>
+#include <dragengine/threading/deSemaphore.h>
 #include <dragengine/threading/deThreadSafeObject.h>
 #include <dragengine/threading/deTThreadSafeObjectReference.h>
 #include <dragengine/common/exceptions.h>
@@ -70,6 +72,37 @@ int TestTSRefDerived::constructCountDerived = 0;
 int TestTSRefDerived::destructCountDerived = 0;
 
 
+// Thread manipulating references to a shared object
+class TestTSRefThread : public deThread{
+public:
+	TestTSRefObject::Ref object;
+	deSemaphore &start;
+	int iterations;
+	bool dropLast;
+	
+	TestTSRefThread(const TestTSRefObject::Ref &nobject, deSemaphore &nstart, int niterations, bool ndropLast) :
+	object(nobject), start(nstart), iterations(niterations), dropLast(ndropLast){
+	}
+	
+	void Run() override{
+		start.Wait();
+		
+		int i;
+		for(i=0; i<iterations; i++){
+			TestTSRefObject::Ref copy(object);
+			TestTSRefObject::Ref moved(std::move(copy));
+			deTThreadSafeObjectReference<deThreadSafeObject> base(std::move(moved));
+			copy = object;
+			base = copy;
+		}
+		
+		if(dropLast){
+			object = nullptr;
+		}
+	}
+};
+
+
 // Class detThreadSafeObjectReference
 ///////////////////////////////////////
 
@@ -97,6 +130,7 @@ void detThreadSafeObjectReference::Run(){
 	TestCasting();
 	TestHash();
 	TestUpcastDowncast();
+	TestMultiThreaded();
 }
 
 void detThreadSafeObjectReference::CleanUp(){
@@ -464,3 +498,87 @@ void detThreadSafeObjectReference::TestUpcastDowncast(){
 	ASSERT_EQUAL(TestTSRefDerived::constructCountDerived, 1);
 	ASSERT_EQUAL(TestTSRefDerived::destructCountDerived, 1);
 }
+
+void detThreadSafeObjectReference::TestMultiThreaded(){
+	SetSubTestNum(10);
+	
+	const int threadCount = 8;
+	const int iterations = 100000;
+	TestTSRefThread *threads[threadCount] = {};
+	deSemaphore start;
+	int i;
+	
+	const auto startThreads = [&](){
+		for(i=0; i<threadCount; i++){
+			start.Signal();
+		}
+	};
+	
+	const auto cleanUpThreads = [&](){
+		for(i=0; i<threadCount; i++){
+			if(threads[i]){
+				threads[i]->WaitForExit();
+				delete threads[i];
+				threads[i] = nullptr;
+			}
+		}
+	};
+	
+	// Reset counters
+	TestTSRefObject::constructCount = 0;
+	TestTSRefObject::destructCount = 0;
+	
+	// Concurrent copies and moves keep the reference count balanced
+	try{
+		TestTSRefObject::Ref object = TestTSRefObject::Ref::New(5);
+		
+		for(i=0; i<threadCount; i++){
+			threads[i] = new TestTSRefThread(object, start, iterations, false);
+			threads[i]->Start();
+		}
+		ASSERT_EQUAL(object->GetRefCount(), 1 + threadCount);
+		
+		startThreads();
+		for(i=0; i<threadCount; i++){
+			threads[i]->WaitForExit();
+		}
+		ASSERT_EQUAL(object->GetRefCount(), 1 + threadCount);
+		
+		cleanUpThreads();
+		ASSERT_EQUAL(object->GetRefCount(), 1);
+		ASSERT_EQUAL(TestTSRefObject::destructCount, 0);
+		
+	}catch(const deException &){
+		startThreads();
+		cleanUpThreads();
+		throw;
+	}
+	
+	ASSERT_EQUAL(TestTSRefObject::constructCount, 1);
+	ASSERT_EQUAL(TestTSRefObject::destructCount, 1);
+	
+	// Threads racing to drop the last reference delete the object exactly once
+	TestTSRefObject::constructCount = 0;
+	TestTSRefObject::destructCount = 0;
+	
+	try{
+		TestTSRefObject::Ref object = TestTSRefObject::Ref::New(6);
+		
+		for(i=0; i<threadCount; i++){
+			threads[i] = new TestTSRefThread(object, start, iterations / 10, true);
+			threads[i]->Start();
+		}
+		object = nullptr;
+		
+		startThreads();
+		cleanUpThreads();
+		
+	}catch(const deException &){
+		startThreads();
+		cleanUpThreads();
+		throw;
+	}
+	
+	ASSERT_EQUAL(TestTSRefObject::constructCount, 1);
+	ASSERT_EQUAL(TestTSRefObject::destructCount, 1);
+}
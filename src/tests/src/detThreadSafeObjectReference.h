@@ -19,6 +19,7 @@ private:
 	void TestCasting();
 	void TestHash();
 	void TestUpcastDowncast();
+	void TestMultiThreaded();
 
 public:
 	detThreadSafeObjectReference();
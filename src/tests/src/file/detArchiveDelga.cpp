@@ -0,0 +1,299 @@
+// includes
+#include <stdio.h>
+#include <string.h>
+#include <zlib.h>
+
+#include "detArchiveDelga.h"
+
+#include <deArchiveDelga.h>
+#include <deadArchiveFile.h>
+#include <deadContainer.h>
+#include <zip.h>
+
+#include <dragengine/deEngine.h>
+#include <dragengine/app/deOSConsole.h>
+#include <dragengine/common/exceptions.h>
+#include <dragengine/common/file/decDiskFileReader.h>
+#include <dragengine/common/file/decMappedFileReader.h>
+#include <dragengine/common/file/decMemoryFile.h>
+#include <dragengine/common/file/decMemoryFileReader.h>
+#include <dragengine/common/file/decPath.h>
+#include <dragengine/common/math/decMath.h>
+#include <dragengine/systems/deModuleSystem.h>
+
+
+// definitions
+#define DETAD_FILENAME "detests_archive.delga"
+
+struct sEntry{
+	const char *path;
+	int size;
+	bool compress;
+	int chunkSize;
+	bool mapped;
+};
+
+// chunk size of 0 writes the entry using a single chunk
+static const sEntry vEntries[] = {
+	{"stored.bin", 1000, false, 0, true},
+	{"data/chunked.bin", 100000, false, 32768, true},
+	{"data/empty.bin", 0, false, 0, true},
+	{"data/deflated.txt", 20000, true, 0, false}
+};
+
+static const int vEntryCount = sizeof(vEntries) / sizeof(sEntry);
+
+deTObjectReference<deInternalModule> deadRegisterInternalModule(deModuleSystem *system);
+
+
+// deterministic test content. uses a small alphabet to be compressible
+static void detADFillData(decTList<uint8_t> &data, int size, uint32_t seed){
+	data.SetCountDiscard(size);
+	int i;
+	for(i=0; i<size; i++){
+		seed = seed * 1664525u + 1013904223u;
+		data.SetAt(i, (uint8_t)('a' + (seed >> 24) % 16));
+	}
+}
+
+
+
+// Class detArchiveDelga
+//////////////////////////
+
+// Constructors, destructor
+/////////////////////////////
+
+detArchiveDelga::detArchiveDelga() :
+pEngine(nullptr){
+}
+
+detArchiveDelga::~detArchiveDelga(){
+	CleanUp();
+}
+
+
+
+// Testing
+////////////
+
+void detArchiveDelga::Prepare(){
+	if(!pEngine){
+		pEngine = new deEngine(new deOSConsole, nullptr);
+		
+		pModule = deadRegisterInternalModule(pEngine->GetModuleSystem());
+		pEngine->GetModuleSystem()->AddModule(pModule);
+		pModule->LoadModule();
+	}
+	
+	pWriteArchive(DETAD_FILENAME);
+}
+
+void detArchiveDelga::Run(){
+	pTestMapped();
+	pTestLazyDataOffset();
+	pTestUnmapped();
+}
+
+void detArchiveDelga::CleanUp(){
+	remove(DETAD_FILENAME);
+	
+	pModule = nullptr;
+	if(pEngine){
+		delete pEngine;
+		pEngine = nullptr;
+	}
+}
+
+const char *detArchiveDelga::GetTestName(){
+	return "ArchiveDelga";
+}
+
+
+
+// Tests
+//////////
+
+void detArchiveDelga::pTestMapped(){
+	SetSubTestNum(0);
+	
+	// stored entries are read straight from the mapped archive. this includes entries
+	// written in chunks with combined crc values like projTaskDistribute does
+	const decDiskFileReader::Ref reader(decDiskFileReader::Ref::New(DETAD_FILENAME));
+	deadContainer container(pGetModule(), reader);
+	ASSERT_NOT_NULL(container.GetMappedFile());
+	
+	int i;
+	for(i=0; i<vEntryCount; i++){
+		pCheckEntry(container, i, vEntries[i].mapped);
+	}
+}
+
+void detArchiveDelga::pTestLazyDataOffset(){
+	SetSubTestNum(1);
+	
+	// opening the archive must not touch the local headers of the files
+	const decDiskFileReader::Ref reader(decDiskFileReader::Ref::New(DETAD_FILENAME));
+	deadContainer container(pGetModule(), reader);
+	
+	int i;
+	for(i=0; i<vEntryCount; i++){
+		const deadArchiveFile * const file = container.GetArchiveDirectory()->
+			GetFileByPath(decPath::CreatePathUnix(vEntries[i].path));
+		ASSERT_NOT_NULL(file);
+		ASSERT_FALSE(file->GetDataOffsetResolved());
+	}
+	
+	pCheckEntry(container, 0, true);
+	pCheckEntry(container, 3, false);
+	
+	ASSERT_TRUE(container.GetArchiveDirectory()->GetFileByPath(
+		decPath::CreatePathUnix(vEntries[0].path))->GetDataOffsetResolved());
+	ASSERT_FALSE(container.GetArchiveDirectory()->GetFileByPath(
+		decPath::CreatePathUnix(vEntries[1].path))->GetDataOffsetResolved());
+	ASSERT_FALSE(container.GetArchiveDirectory()->GetFileByPath(
+		decPath::CreatePathUnix(vEntries[3].path))->GetDataOffsetResolved());
+	
+	// reading again uses the resolved offset
+	pCheckEntry(container, 0, true);
+}
+
+void detArchiveDelga::pTestUnmapped(){
+	SetSubTestNum(2);
+	
+	// archives not located on disk can not be mapped and are read unpacking
+	const decDiskFileReader::Ref diskReader(decDiskFileReader::Ref::New(DETAD_FILENAME));
+	const decMemoryFile::Ref memoryFile(decMemoryFile::Ref::New(DETAD_FILENAME));
+	memoryFile->Resize(diskReader->GetLength());
+	diskReader->Read(memoryFile->GetPointer(), diskReader->GetLength());
+	
+	const decMemoryFileReader::Ref reader(decMemoryFileReader::Ref::New(memoryFile));
+	deadContainer container(pGetModule(), reader);
+	ASSERT_NULL(container.GetMappedFile());
+	
+	int i;
+	for(i=0; i<vEntryCount; i++){
+		pCheckEntry(container, i, false);
+	}
+}
+
+
+
+// Private Functions
+//////////////////////
+
+deArchiveDelga &detArchiveDelga::pGetModule() const{
+	DEASSERT_NOTNULL(pModule->GetModule())
+	return *((deArchiveDelga*)pModule->GetModule());
+}
+
+void detArchiveDelga::pWriteArchive(const char *filename){
+	zipFile const archive = zipOpen(filename, APPEND_STATUS_CREATE);
+	if(!archive){
+		DETHROW_INFO(deeWriteFile, filename);
+	}
+	
+	try{
+		int i;
+		for(i=0; i<vEntryCount; i++){
+			const sEntry &entry = vEntries[i];
+			decTList<uint8_t> data;
+			detADFillData(data, entry.size, (uint32_t)(i + 1));
+			pWriteEntry(archive, entry.path, data, entry.compress, entry.chunkSize);
+		}
+		
+	}catch(const deException &){
+		zipClose(archive, nullptr);
+		throw;
+	}
+	
+	if(zipClose(archive, nullptr) != ZIP_OK){
+		DETHROW_INFO(deeWriteFile, filename);
+	}
+}
+
+void detArchiveDelga::pWriteEntry(void *archive, const char *path,
+const decTList<uint8_t> &data, bool compress, int chunkSize){
+	// uses the same parameters as projTaskDistribute::pZipBeginFile
+	const int level = compress ? Z_DEFAULT_COMPRESSION : Z_NO_COMPRESSION;
+	const int method = level == Z_NO_COMPRESSION ? 0 : Z_DEFLATED;
+	
+	zip_fileinfo info;
+	memset(&info, 0, sizeof(info));
+	info.tmz_date.tm_year = 2026;
+	info.tmz_date.tm_mon = 0;
+	info.tmz_date.tm_mday = 1;
+	
+	if(zipOpenNewFileInZip2(archive, path, &info, nullptr, 0, nullptr, 0,
+	nullptr, method, level, 1) != ZIP_OK){
+		DETHROW_INFO(deeWriteFile, path);
+	}
+	
+	const int size = data.GetCount();
+	uLong crc = crc32(0, nullptr, 0);
+	
+	if(compress){
+		// single chunk raw deflate as done by projTaskDistributeFile
+		z_stream zstream;
+		memset(&zstream, 0, sizeof(zstream));
+		if(deflateInit2(&zstream, level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK){
+			DETHROW(deeOutOfMemory);
+		}
+		
+		decTList<uint8_t> compressed;
+		compressed.SetCountDiscard((int)deflateBound(&zstream, size) + 16);
+		zstream.next_in = (Bytef*)data.GetArrayPointer();
+		zstream.avail_in = size;
+		zstream.next_out = compressed.GetArrayPointer();
+		zstream.avail_out = compressed.GetCount();
+		
+		const int result = deflate(&zstream, Z_FINISH);
+		deflateEnd(&zstream);
+		if(result != Z_STREAM_END){
+			DETHROW_INFO(deeInvalidAction, path);
+		}
+		
+		if(zipWriteInFileInZip(archive, compressed.GetArrayPointer(),
+		(unsigned int)zstream.total_out) != ZIP_OK){
+			DETHROW_INFO(deeWriteFile, path);
+		}
+		crc = crc32(crc, data.GetArrayPointer(), size);
+		
+	}else{
+		// stored chunks are written as is combining the chunk crc values like
+		// projTaskDistribute::pWriteFileTask does
+		const int step = chunkSize > 0 ? chunkSize : decMath::max(size, 1);
+		int offset;
+		for(offset=0; offset<size; offset+=step){
+			const int length = decMath::min(size - offset, step);
+			const uLong chunkCrc = crc32(crc32(0, nullptr, 0), data.GetArrayPointer() + offset, length);
+			
+			if(zipWriteInFileInZip(archive, data.GetArrayPointer() + offset, length) != ZIP_OK){
+				DETHROW_INFO(deeWriteFile, path);
+			}
+			crc = crc32_combine(crc, chunkCrc, length);
+		}
+	}
+	
+	if(zipCloseFileInZipRaw(archive, (uLong)size, crc) != ZIP_OK){
+		DETHROW_INFO(deeWriteFile, path);
+	}
+}
+
+void detArchiveDelga::pCheckEntry(deadContainer &container, int index, bool mapped){
+	const sEntry &entry = vEntries[index];
+	decTList<uint8_t> data;
+	detADFillData(data, entry.size, (uint32_t)(index + 1));
+	
+	const decBaseFileReader::Ref reader(container.OpenFileForReading(
+		decPath::CreatePathUnix(entry.path)));
+	ASSERT_EQUAL(dynamic_cast<decMappedFileReader*>(reader.Pointer()) != nullptr, mapped);
+	ASSERT_EQUAL(reader->GetLength(), entry.size);
+	
+	if(entry.size > 0){
+		decTList<uint8_t> content;
+		content.SetCountDiscard(entry.size);
+		reader->Read(content.GetArrayPointer(), entry.size);
+		ASSERT_TRUE(memcmp(content.GetArrayPointer(), data.GetArrayPointer(), entry.size) == 0);
+	}
+}
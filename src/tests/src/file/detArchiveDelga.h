@@ -0,0 +1,44 @@
+// include only once
+#ifndef _DETARCHIVEDELGA_H_
+#define _DETARCHIVEDELGA_H_
+
+// includes
+#include "../detCase.h"
+
+#include <dragengine/common/collection/decTList.h>
+#include <dragengine/systems/modules/deInternalModule.h>
+
+class deEngine;
+class deArchiveDelga;
+class deadContainer;
+
+
+
+// class detArchiveDelga
+class detArchiveDelga : public detCase{
+private:
+	deEngine *pEngine;
+	deInternalModule::Ref pModule;
+	
+public:
+	detArchiveDelga();
+	~detArchiveDelga() override;
+	void Prepare() override;
+	void Run() override;
+	void CleanUp() override;
+	const char *GetTestName() override;
+	
+private:
+	void pTestMapped();
+	void pTestLazyDataOffset();
+	void pTestUnmapped();
+	
+	deArchiveDelga &pGetModule() const;
+	void pWriteArchive(const char *filename);
+	void pWriteEntry(void *archive, const char *path, const decTList<uint8_t> &data,
+		bool compress, int chunkSize);
+	void pCheckEntry(deadContainer &container, int index, bool mapped);
+};
+
+// end of include only once
+#endif
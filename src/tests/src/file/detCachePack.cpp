@@ -0,0 +1,336 @@
+// includes
+#include <stdio.h>
+#include <string.h>
+
+#include "detCachePack.h"
+
+#include <dragengine/common/collection/decTList.h>
+#include <dragengine/common/string/decString.h>
+#include <dragengine/filesystem/deCachePack.h>
+#include <dragengine/filesystem/deVFSDiskDirectory.h>
+#include <dragengine/common/exceptions.h>
+
+
+// definitions
+#define DETCP_COUNT 50
+#define DETCP_SIZE 3000
+
+
+
+// Create entry content. Text like data compresses, noise data does not
+static void detCPCreateData(decTList<uint8_t> &data, int size, int seed){
+	data.SetCountDiscard(size);
+	uint8_t * const pointer = data.GetArrayPointer();
+	unsigned int value = (unsigned int)seed;
+	int i;
+	
+	for(i=0; i<size; i++){
+		value = value * 1103515245 + 12345;
+		if(seed % 2 == 0){
+			const int letter = (value >> 16) % 30;
+			pointer[i] = letter < 26 ? (uint8_t)('a' + letter) : ' ';
+			
+		}else{
+			pointer[i] = (uint8_t)(value >> 16);
+		}
+	}
+}
+
+
+
+// Class detCachePack
+///////////////////////
+
+// Constructors, destructor
+/////////////////////////////
+
+detCachePack::detCachePack(){
+}
+
+detCachePack::~detCachePack(){
+	CleanUp();
+}
+
+
+
+// Testing
+////////////
+
+void detCachePack::Prepare(){
+	pBasePath = decPath::CreateWorkingDirectory();
+	pBasePath.AddComponent("detests_cache_pack");
+	
+	pVFS = deVirtualFileSystem::Ref::New();
+	pVFS->AddContainer(deVFSDiskDirectory::Ref::New(pBasePath));
+}
+
+void detCachePack::Run(){
+	pTestReadWrite();
+	pTestPersist();
+	pTestRecover();
+	pTestEvict();
+	pTestDeleteAll();
+	pTestUnflushed();
+}
+
+void detCachePack::CleanUp(){
+	if(!pVFS){
+		return;
+	}
+	
+	deCachePack(pVFS, decPath::CreatePathUnix("/cache")).DeleteAll();
+	pVFS = nullptr;
+	
+	const deVFSDiskDirectory::Ref base(deVFSDiskDirectory::Ref::New(pBasePath));
+	const decPath pathIndex(decPath::CreatePathUnix("/cache/index"));
+	if(base->ExistsFile(pathIndex)){
+		base->DeleteFile(pathIndex);
+	}
+	
+	const decPath pathCache(decPath::CreatePathUnix("/cache"));
+	if(base->ExistsFile(pathCache)){
+		base->DeleteFile(pathCache);
+	}
+	
+	deVFSDiskDirectory::Ref::New(pBasePath.GetParent())->DeleteFile(
+		decPath::CreatePathUnix(pBasePath.GetLastComponent()));
+}
+
+const char *detCachePack::GetTestName(){
+	return "CachePack";
+}
+
+
+
+// Private Functions
+//////////////////////
+
+void detCachePack::pTestReadWrite(){
+	SetSubTestNum(0);
+	
+	deCachePack pack(pVFS, decPath::CreatePathUnix("/cache"));
+	pack.DeleteAll();
+	ASSERT_EQUAL(pack.GetEntryCount(), 0);
+	ASSERT_NULL(pack.Read("missing"));
+	
+	// all compression methods with compressible and incompressible data
+	pack.SetCompressionMethod(deCachePack::ecmNoCompression);
+	pWriteEntry(pack, "none", DETCP_SIZE, 2);
+	pack.SetCompressionMethod(deCachePack::ecmZCompression);
+	pWriteEntry(pack, "zlib", DETCP_SIZE, 4);
+	pWriteEntry(pack, "zlib noise", DETCP_SIZE, 5);
+	pack.SetCompressionMethod(deCachePack::ecmFastCompression);
+	pWriteEntry(pack, "fast", DETCP_SIZE, 6);
+	pWriteEntry(pack, "fast noise", DETCP_SIZE, 7);
+	pWriteEntry(pack, "empty", 0, 8);
+	
+	ASSERT_EQUAL(pack.GetEntryCount(), 6);
+	ASSERT_TRUE(pCheckEntry(pack, "none", DETCP_SIZE, 2));
+	ASSERT_TRUE(pCheckEntry(pack, "zlib", DETCP_SIZE, 4));
+	ASSERT_TRUE(pCheckEntry(pack, "zlib noise", DETCP_SIZE, 5));
+	ASSERT_TRUE(pCheckEntry(pack, "fast", DETCP_SIZE, 6));
+	ASSERT_TRUE(pCheckEntry(pack, "fast noise", DETCP_SIZE, 7));
+	ASSERT_TRUE(pCheckEntry(pack, "empty", 0, 8));
+	
+	// readers keep their content if the entry is replaced
+	const decBaseFileReader::Ref reader(pack.Read("fast"));
+	ASSERT_NOT_NULL(reader);
+	pWriteEntry(pack, "fast", 100, 10);
+	ASSERT_EQUAL(reader->GetLength(), DETCP_SIZE);
+	ASSERT_TRUE(pCheckEntry(pack, "fast", 100, 10));
+	
+	// entries are replaced as soon as writing starts and stored once the writer is released
+	{
+	const decBaseFileWriter::Ref writer(pack.Write("zlib"));
+	writer->WriteInt(42);
+	ASSERT_NULL(pack.Read("zlib"));
+	}
+	const decBaseFileReader::Ref readerReplaced(pack.Read("zlib"));
+	ASSERT_NOT_NULL(readerReplaced);
+	ASSERT_EQUAL(readerReplaced->GetLength(), 4);
+	ASSERT_EQUAL(readerReplaced->ReadInt(), 42);
+	
+	pack.Delete("none");
+	pack.Delete("missing");
+	ASSERT_NULL(pack.Read("none"));
+	ASSERT_EQUAL(pack.GetEntryCount(), 5);
+}
+
+void detCachePack::pTestPersist(){
+	SetSubTestNum(1);
+	
+	int i;
+	
+	{
+	deCachePack pack(pVFS, decPath::CreatePathUnix("/cache"));
+	pack.DeleteAll();
+	pack.SetCompressionMethod(deCachePack::ecmFastCompression);
+	pack.SetSegmentSize(20000);
+	
+	for(i=0; i<DETCP_COUNT; i++){
+		decString id;
+		id.Format("/models/model%d.demodel", i);
+		pWriteEntry(pack, id, DETCP_SIZE + i, i);
+	}
+	
+	ASSERT_EQUAL(pack.GetEntryCount(), DETCP_COUNT);
+	ASSERT_TRUE(pack.GetSegmentCount() > 1);
+	}
+	
+	deCachePack pack(pVFS, decPath::CreatePathUnix("/cache"));
+	ASSERT_EQUAL(pack.GetEntryCount(), DETCP_COUNT);
+	ASSERT_TRUE(pack.GetSegmentCount() > 1);
+	ASSERT_EQUAL(pack.GetUsedSize(), pack.GetDiskSize());
+	
+	for(i=0; i<DETCP_COUNT; i++){
+		decString id;
+		id.Format("/models/model%d.demodel", i);
+		ASSERT_TRUE(pCheckEntry(pack, id, DETCP_SIZE + i, i));
+	}
+}
+
+void detCachePack::pTestRecover(){
+	SetSubTestNum(2);
+	
+	const decPath pathIndex(decPath::CreatePathUnix("/cache/index"));
+	int i;
+	
+	{
+	deCachePack pack(pVFS, decPath::CreatePathUnix("/cache"));
+	pack.DeleteAll();
+	pack.SetSegmentSize(10000);
+	
+	for(i=0; i<DETCP_COUNT; i++){
+		decString id;
+		id.Format("entry%d", i);
+		pWriteEntry(pack, id, DETCP_SIZE, i);
+	}
+	}
+	
+	// replace entry in a newer segment
+	{
+	deCachePack pack(pVFS, decPath::CreatePathUnix("/cache"));
+	pWriteEntry(pack, "entry3", 500, 100);
+	}
+	
+	// missing index restores the entries by scanning the segments
+	ASSERT_TRUE(pVFS->ExistsFile(pathIndex));
+	pVFS->DeleteFile(pathIndex);
+	
+	{
+	deCachePack pack(pVFS, decPath::CreatePathUnix("/cache"));
+	ASSERT_EQUAL(pack.GetEntryCount(), DETCP_COUNT);
+	ASSERT_TRUE(pCheckEntry(pack, "entry3", 500, 100));
+	ASSERT_TRUE(pCheckEntry(pack, "entry4", DETCP_SIZE, 4));
+	}
+	
+	// damaged index is ignored
+	pVFS->OpenFileForWriting(pathIndex)->WriteString("DECP garbage");
+	
+	deCachePack pack(pVFS, decPath::CreatePathUnix("/cache"));
+	ASSERT_EQUAL(pack.GetEntryCount(), DETCP_COUNT);
+	ASSERT_TRUE(pCheckEntry(pack, "entry3", 500, 100));
+	ASSERT_TRUE(pCheckEntry(pack, "entry49", DETCP_SIZE, 49));
+}
+
+void detCachePack::pTestEvict(){
+	SetSubTestNum(3);
+	
+	const int maxSize = 60000, segmentSize = 8000;
+	int i;
+	
+	{
+	deCachePack pack(pVFS, decPath::CreatePathUnix("/cache"));
+	pack.DeleteAll();
+	pack.SetCompressionMethod(deCachePack::ecmNoCompression);
+	pack.SetSegmentSize(segmentSize);
+	pack.SetMaxSize(maxSize);
+	
+	pWriteEntry(pack, "hot", 1000, 1);
+	
+	for(i=0; i<200; i++){
+		decString id;
+		id.Format("cold%d", i);
+		pWriteEntry(pack, id, 1500, i);
+		
+		// reading marks the entry as recently used
+		ASSERT_TRUE(pCheckEntry(pack, "hot", 1000, 1));
+		ASSERT_TRUE(pack.GetDiskSize() <= (uint64_t)(maxSize + segmentSize));
+	}
+	
+	ASSERT_TRUE(pack.GetEntryCount() < 100);
+	ASSERT_TRUE(pCheckEntry(pack, "cold199", 1500, 199));
+	ASSERT_NULL(pack.Read("cold0"));
+	}
+	
+	deCachePack pack(pVFS, decPath::CreatePathUnix("/cache"));
+	ASSERT_TRUE(pack.GetEntryCount() < 100);
+	ASSERT_TRUE(pack.GetDiskSize() <= (uint64_t)(maxSize + segmentSize));
+	ASSERT_TRUE(pCheckEntry(pack, "hot", 1000, 1));
+	ASSERT_TRUE(pCheckEntry(pack, "cold198", 1500, 198));
+	
+	// lowering the maximum size evicts immediately
+	pack.SetMaxSize(10000);
+	ASSERT_TRUE(pack.GetDiskSize() <= 10000);
+	ASSERT_TRUE(pCheckEntry(pack, "cold198", 1500, 198));
+}
+
+void detCachePack::pTestDeleteAll(){
+	SetSubTestNum(4);
+	
+	{
+	deCachePack pack(pVFS, decPath::CreatePathUnix("/cache"));
+	pWriteEntry(pack, "entry", 100, 1);
+	ASSERT_TRUE(pack.GetEntryCount() > 0);
+	
+	pack.DeleteAll();
+	ASSERT_EQUAL(pack.GetEntryCount(), 0);
+	ASSERT_EQUAL(pack.GetSegmentCount(), 0);
+	ASSERT_EQUAL(pack.GetDiskSize(), (uint64_t)0);
+	ASSERT_NULL(pack.Read("entry"));
+	}
+	
+	deCachePack pack(pVFS, decPath::CreatePathUnix("/cache"));
+	ASSERT_EQUAL(pack.GetEntryCount(), 0);
+	ASSERT_EQUAL(pack.GetDiskSize(), (uint64_t)0);
+}
+
+void detCachePack::pTestUnflushed(){
+	SetSubTestNum(5);
+	
+	deCachePack pack(pVFS, decPath::CreatePathUnix("/cache"));
+	pack.DeleteAll();
+	pWriteEntry(pack, "entry1", DETCP_SIZE, 1);
+	pWriteEntry(pack, "entry2", 100, 2);
+	pWriteEntry(pack, "entry1", 200, 3);
+	
+	// entries are on disk before flushing. opening the cache directory again without
+	// flushing restores them like after the application crashed
+	deCachePack recovered(pVFS, decPath::CreatePathUnix("/cache"));
+	ASSERT_EQUAL(recovered.GetEntryCount(), 2);
+	ASSERT_TRUE(pCheckEntry(recovered, "entry1", 200, 3));
+	ASSERT_TRUE(pCheckEntry(recovered, "entry2", 100, 2));
+}
+
+void detCachePack::pWriteEntry(deCachePack &pack, const char *id, int size, int seed){
+	decTList<uint8_t> data;
+	detCPCreateData(data, size, seed);
+	pack.Write(id)->Write(data.GetArrayPointer(), size);
+}
+
+bool detCachePack::pCheckEntry(deCachePack &pack, const char *id, int size, int seed){
+	const decBaseFileReader::Ref reader(pack.Read(id));
+	if(!reader || reader->GetLength() != size){
+		return false;
+	}
+	
+	if(size == 0){
+		return true;
+	}
+	
+	decTList<uint8_t> expected, data;
+	detCPCreateData(expected, size, seed);
+	data.SetCountDiscard(size);
+	reader->Read(data.GetArrayPointer(), size);
+	return memcmp(data.GetArrayPointer(), expected.GetArrayPointer(), size) == 0;
+}
@@ -0,0 +1,42 @@
+// include only once
+#ifndef _DETCACHEPACK_H_
+#define _DETCACHEPACK_H_
+
+// includes
+#include "../detCase.h"
+
+#include <dragengine/common/file/decPath.h>
+#include <dragengine/filesystem/deVirtualFileSystem.h>
+
+class deCachePack;
+
+
+
+// class detCachePack
+class detCachePack : public detCase{
+private:
+	decPath pBasePath;
+	deVirtualFileSystem::Ref pVFS;
+	
+public:
+	detCachePack();
+	~detCachePack() override;
+	void Prepare() override;
+	void Run() override;
+	void CleanUp() override;
+	const char *GetTestName() override;
+	
+private:
+	void pTestReadWrite();
+	void pTestPersist();
+	void pTestRecover();
+	void pTestEvict();
+	void pTestDeleteAll();
+	void pTestUnflushed();
+	
+	void pWriteEntry(deCachePack &pack, const char *id, int size, int seed);
+	bool pCheckEntry(deCachePack &pack, const char *id, int size, int seed);
+};
+
+// end of include only once
+#endif
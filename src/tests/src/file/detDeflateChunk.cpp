@@ -0,0 +1,304 @@
+// includes
+#include <stdio.h>
+#include <string.h>
+#include <zlib.h>
+
+#include "detDeflateChunk.h"
+
+#include <dragengine/deEngine.h>
+#include <dragengine/app/deOSConsole.h>
+#include <dragengine/common/file/decDeflateChunk.h>
+#include <dragengine/common/file/decDeflateFileReader.h>
+#include <dragengine/common/file/decMemoryFileReader.h>
+#include <dragengine/common/math/decMath.h>
+#include <dragengine/common/exceptions.h>
+#include <dragengine/parallel/deParallelProcessing.h>
+#include <dragengine/parallel/deParallelTask.h>
+
+
+// definitions
+#define DETDC_LENGTH 3000000
+#define DETDC_SMALL_LENGTH 50000
+#define DETDC_CHUNK_SIZE 262144
+#define DETDC_THREAD_COUNT 4
+
+
+// Task compressing a chunk like projTaskDistributeFile does
+class detDCTask : public deParallelTask{
+public:
+	using Ref = deTThreadSafeObjectReference<detDCTask>;
+	
+	const decMemoryFile::Ref file;
+	const int level, offset, length;
+	const bool lastChunk;
+	decTList<uint8_t> compressed;
+	uint32_t crc;
+	bool failed;
+	
+	detDCTask(decMemoryFile *nfile, int nlevel, int noffset, int nlength, bool nlastChunk) :
+	deParallelTask(nullptr),
+	file(nfile),
+	level(nlevel),
+	offset(noffset),
+	length(nlength),
+	lastChunk(nlastChunk),
+	crc(0),
+	failed(false){
+	}
+	
+	void Run() override{
+		try{
+			const decMemoryFileReader::Ref reader(decMemoryFileReader::Ref::New(file));
+			
+			if(level == decDeflateChunk::LevelStore){
+				crc = decDeflateChunk::Store(reader, offset, length, compressed);
+				
+			}else{
+				crc = decDeflateChunk::Deflate(reader, level, offset, length, lastChunk, compressed);
+			}
+			
+		}catch(const deException &){
+			failed = true;
+		}
+	}
+	
+	void Finished() override{
+	}
+	
+protected:
+	~detDCTask() override = default;
+};
+
+
+
+// Class detDeflateChunk
+//////////////////////////
+
+// Constructors, destructor
+/////////////////////////////
+
+detDeflateChunk::detDeflateChunk() :
+pEngine(nullptr){
+}
+
+detDeflateChunk::~detDeflateChunk(){
+	CleanUp();
+}
+
+
+
+// Testing
+////////////
+
+void detDeflateChunk::Prepare(){
+	if(!pEngine){
+		pEngine = new deEngine(new deOSConsole, nullptr);
+	}
+	
+	// compressible data made of pseudo random words. back references cross chunk
+	// boundaries which requires the dictionary of the previous chunk to be correct
+	pData.SetCountDiscard(DETDC_LENGTH);
+	uint8_t * const data = pData.GetArrayPointer();
+	unsigned int seed = 4711;
+	int i;
+	
+	for(i=0; i<DETDC_LENGTH; i++){
+		seed = seed * 1103515245 + 12345;
+		const int value = (seed >> 16) % 40;
+		data[i] = value < 26 ? (uint8_t)('a' + value) : (value < 34 ? ' ' : (uint8_t)(seed >> 8));
+	}
+	
+	pFile = decMemoryFile::Ref::New("/large.bin");
+	pFile->Resize(DETDC_LENGTH);
+	memcpy(pFile->GetPointer(), data, DETDC_LENGTH);
+}
+
+void detDeflateChunk::Run(){
+	pTestSingleChunk();
+	pTestChunksParallel();
+	pTestChunksStored();
+	pTestEmpty();
+	pTestInvalidRange();
+}
+
+void detDeflateChunk::CleanUp(){
+	pFile = nullptr;
+	pData.RemoveAll();
+	
+	if(pEngine){
+		delete pEngine;
+		pEngine = nullptr;
+	}
+}
+
+const char *detDeflateChunk::GetTestName(){
+	return "DeflateChunk";
+}
+
+
+
+// Tests
+//////////
+
+void detDeflateChunk::pTestSingleChunk(){
+	SetSubTestNum(0);
+	
+	// a single chunk has to produce the same data as deflating in one go
+	decTList<uint8_t> compressed;
+	const uint32_t crc = decDeflateChunk::Deflate(decMemoryFileReader::Ref::New(pFile),
+		decDeflateChunk::LevelDefault, 0, DETDC_SMALL_LENGTH, true, compressed);
+	
+	ASSERT_EQUAL(crc, (uint32_t)crc32(crc32(0, nullptr, 0),
+		pData.GetArrayPointer(), DETDC_SMALL_LENGTH));
+	
+	z_stream zstream;
+	memset(&zstream, 0, sizeof(zstream));
+	ASSERT_EQUAL(deflateInit2(&zstream, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+		-MAX_WBITS, 8, Z_DEFAULT_STRATEGY), Z_OK);
+	
+	decTList<uint8_t> expected;
+	expected.SetCountDiscard((int)deflateBound(&zstream, DETDC_SMALL_LENGTH));
+	zstream.next_in = pData.GetArrayPointer();
+	zstream.avail_in = DETDC_SMALL_LENGTH;
+	zstream.next_out = expected.GetArrayPointer();
+	zstream.avail_out = expected.GetCount();
+	const int result = deflate(&zstream, Z_FINISH);
+	expected.SetCount((int)zstream.total_out);
+	deflateEnd(&zstream);
+	ASSERT_EQUAL(result, Z_STREAM_END);
+	
+	ASSERT_EQUAL(compressed.GetCount(), expected.GetCount());
+	ASSERT_TRUE(memcmp(compressed.GetArrayPointer(), expected.GetArrayPointer(),
+		expected.GetCount()) == 0);
+}
+
+void detDeflateChunk::pTestChunksParallel(){
+	SetSubTestNum(1);
+	
+	// chunks compressed in parallel concatenate to a single deflate stream
+	deParallelProcessing parallel(*pEngine, DETDC_THREAD_COUNT);
+	decTList<uint8_t> compressed, inflated;
+	uint32_t crc;
+	
+	pRunChunks(parallel, DETDC_LENGTH, decDeflateChunk::LevelDefault, DETDC_CHUNK_SIZE, compressed, crc);
+	ASSERT_TRUE(compressed.GetCount() < DETDC_LENGTH);
+	ASSERT_EQUAL(crc, (uint32_t)crc32(crc32(0, nullptr, 0), pData.GetArrayPointer(), DETDC_LENGTH));
+	
+	pInflate(compressed, inflated, DETDC_LENGTH);
+	ASSERT_TRUE(memcmp(inflated.GetArrayPointer(), pData.GetArrayPointer(), DETDC_LENGTH) == 0);
+	
+	// result is deterministic
+	decTList<uint8_t> compressed2;
+	uint32_t crc2;
+	pRunChunks(parallel, DETDC_LENGTH, decDeflateChunk::LevelDefault, DETDC_CHUNK_SIZE, compressed2, crc2);
+	ASSERT_EQUAL(crc2, crc);
+	ASSERT_EQUAL(compressed2.GetCount(), compressed.GetCount());
+	ASSERT_TRUE(memcmp(compressed2.GetArrayPointer(), compressed.GetArrayPointer(),
+		compressed.GetCount()) == 0);
+}
+
+void detDeflateChunk::pTestChunksStored(){
+	SetSubTestNum(2);
+	
+	// no compression level stores the chunks as is
+	deParallelProcessing parallel(*pEngine, DETDC_THREAD_COUNT);
+	decTList<uint8_t> stored;
+	uint32_t crc;
+	
+	pRunChunks(parallel, DETDC_LENGTH, decDeflateChunk::LevelStore, DETDC_CHUNK_SIZE, stored, crc);
+	ASSERT_EQUAL(stored.GetCount(), DETDC_LENGTH);
+	ASSERT_TRUE(memcmp(stored.GetArrayPointer(), pData.GetArrayPointer(), DETDC_LENGTH) == 0);
+	ASSERT_EQUAL(crc, (uint32_t)crc32(crc32(0, nullptr, 0), pData.GetArrayPointer(), DETDC_LENGTH));
+}
+
+void detDeflateChunk::pTestEmpty(){
+	SetSubTestNum(3);
+	
+	const decMemoryFile::Ref file(decMemoryFile::Ref::New("/empty.bin"));
+	decTList<uint8_t> compressed;
+	const uint32_t crc = decDeflateChunk::Deflate(decMemoryFileReader::Ref::New(file),
+		decDeflateChunk::LevelDefault, 0, 0, true, compressed);
+	
+	ASSERT_EQUAL(crc, decDeflateChunk::InitialCrc());
+	ASSERT_EQUAL(crc, (uint32_t)crc32(0, nullptr, 0));
+	
+	decTList<uint8_t> inflated;
+	pInflate(compressed, inflated, 0);
+	
+	decTList<uint8_t> stored;
+	ASSERT_EQUAL(decDeflateChunk::Store(decMemoryFileReader::Ref::New(file), 0, 0, stored), crc);
+	ASSERT_TRUE(stored.IsEmpty());
+	
+	// combining with an empty chunk keeps the checksum
+	ASSERT_EQUAL(decDeflateChunk::CombineCrc(1234, crc, 0), 1234u);
+}
+
+void detDeflateChunk::pTestInvalidRange(){
+	SetSubTestNum(4);
+	
+	const decMemoryFileReader::Ref reader(decMemoryFileReader::Ref::New(pFile));
+	decTList<uint8_t> compressed;
+	
+	ASSERT_DOES_FAIL(decDeflateChunk::Deflate(reader, decDeflateChunk::LevelDefault,
+		-1, 100, true, compressed));
+	ASSERT_DOES_FAIL(decDeflateChunk::Deflate(reader, decDeflateChunk::LevelDefault,
+		DETDC_LENGTH - 50, 100, true, compressed));
+	ASSERT_DOES_FAIL(decDeflateChunk::Deflate(reader, decDeflateChunk::LevelStore,
+		0, 100, true, compressed));
+	ASSERT_DOES_FAIL(decDeflateChunk::Store(reader, DETDC_LENGTH - 50, 100, compressed));
+	ASSERT_DOES_FAIL(decDeflateChunk::CombineCrc(0, 0, -1));
+}
+
+
+
+// Private Functions
+//////////////////////
+
+void detDeflateChunk::pRunChunks(deParallelProcessing &parallel, int length,
+int level, int chunkSize, decTList<uint8_t> &output, uint32_t &crc){
+	decTList<detDCTask::Ref> tasks;
+	
+	// split file the same way projTaskDistribute does
+	int offset = 0;
+	do{
+		const int chunkLength = decMath::min(length - offset, chunkSize);
+		const detDCTask::Ref task(detDCTask::Ref::New(
+			pFile, level, offset, chunkLength, offset + chunkLength == length));
+		tasks.Add(task);
+		parallel.AddTask(task);
+		offset += chunkLength;
+	}while(offset < length);
+	
+	ASSERT_TRUE(tasks.GetCount() > 1);
+	
+	// collect results in order combining checksums
+	output.RemoveAll();
+	crc = decDeflateChunk::InitialCrc();
+	
+	tasks.Visit([&](detDCTask *task){
+		parallel.WaitForTask(task);
+		ASSERT_FALSE(task->failed);
+		
+		output += task->compressed;
+		crc = decDeflateChunk::CombineCrc(crc, task->crc, task->length);
+	});
+}
+
+void detDeflateChunk::pInflate(const decTList<uint8_t> &compressed,
+decTList<uint8_t> &output, int length){
+	const decMemoryFile::Ref memoryFile(decMemoryFile::Ref::New("compressed"));
+	memoryFile->Resize(compressed.GetCount());
+	if(compressed.IsNotEmpty()){
+		memcpy(memoryFile->GetPointer(), compressed.GetArrayPointer(), compressed.GetCount());
+	}
+	
+	const decDeflateFileReader::Ref reader(decDeflateFileReader::Ref::New(
+		decMemoryFileReader::Ref::New(memoryFile), "compressed", 0, 0,
+		compressed.GetCount(), length));
+	
+	output.SetCountDiscard(length);
+	if(length > 0){
+		reader->Read(output.GetArrayPointer(), length);
+	}
+	ASSERT_TRUE(reader->IsEOF());
+}
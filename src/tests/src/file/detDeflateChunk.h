@@ -0,0 +1,44 @@
+// include only once
+#ifndef _DETDEFLATECHUNK_H_
+#define _DETDEFLATECHUNK_H_
+
+// includes
+#include "../detCase.h"
+
+#include <dragengine/common/collection/decTList.h>
+#include <dragengine/common/file/decMemoryFile.h>
+
+class deEngine;
+class deParallelProcessing;
+
+
+
+// class detDeflateChunk
+class detDeflateChunk : public detCase{
+private:
+	deEngine *pEngine;
+	decMemoryFile::Ref pFile;
+	decTList<uint8_t> pData;
+	
+public:
+	detDeflateChunk();
+	~detDeflateChunk() override;
+	void Prepare() override;
+	void Run() override;
+	void CleanUp() override;
+	const char *GetTestName() override;
+	
+private:
+	void pTestSingleChunk();
+	void pTestChunksParallel();
+	void pTestChunksStored();
+	void pTestEmpty();
+	void pTestInvalidRange();
+	
+	void pRunChunks(deParallelProcessing &parallel, int length, int level,
+		int chunkSize, decTList<uint8_t> &output, uint32_t &crc);
+	void pInflate(const decTList<uint8_t> &compressed, decTList<uint8_t> &output, int length);
+};
+
+// end of include only once
+#endif
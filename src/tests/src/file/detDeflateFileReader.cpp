@@ -0,0 +1,229 @@
+// includes
+#include <stdio.h>
+#include <string.h>
+
+#include "detDeflateFileReader.h"
+
+#include <dragengine/common/file/decDeflateFileReader.h>
+#include <dragengine/common/file/decDeflateSeekIndex.h>
+#include <dragengine/common/file/decDiskFileWriter.h>
+#include <dragengine/common/file/decMappedFile.h>
+#include <dragengine/common/file/decMappedFileReader.h>
+#include <dragengine/common/file/decMemoryFileReader.h>
+#include <dragengine/common/file/decMemoryFileWriter.h>
+#include <dragengine/common/file/decZFileWriter.h>
+#include <dragengine/common/exceptions.h>
+
+
+// definitions
+#define DETDFR_FILENAME "detests_deflate_file"
+#define DETDFR_LENGTH 4000000
+#define DETDFR_SPAN 65536
+
+// pure z-compressed data has a 2 byte header and a 4 byte checksum around the deflate data
+#define DETDFR_HEADER 2
+#define DETDFR_TRAILER 4
+
+
+
+// Class detDeflateFileReader
+///////////////////////////////
+
+// Constructors, destructor
+/////////////////////////////
+
+detDeflateFileReader::detDeflateFileReader(){
+}
+
+detDeflateFileReader::~detDeflateFileReader(){
+	CleanUp();
+}
+
+
+
+// Testing
+////////////
+
+void detDeflateFileReader::Prepare(){
+	// compressible data made of pseudo random words. repeated words produce back
+	// references across deflate blocks which checkpoints have to restore
+	pData.SetCountDiscard(DETDFR_LENGTH);
+	uint8_t * const data = pData.GetArrayPointer();
+	unsigned int seed = 4711;
+	int i;
+	
+	for(i=0; i<DETDFR_LENGTH; i++){
+		seed = seed * 1103515245 + 12345;
+		const int value = (seed >> 16) % 40;
+		data[i] = value < 26 ? (uint8_t)('a' + value) : (value < 34 ? ' ' : (uint8_t)(seed >> 8));
+	}
+	
+	pCompressed = decMemoryFile::Ref::New("compressed");
+	decZFileWriter::Ref::New(decMemoryFileWriter::Ref::New(pCompressed, false), true)
+		->Write(data, DETDFR_LENGTH);
+	
+	decDiskFileWriter::Ref::New(DETDFR_FILENAME, false)->Write(
+		pCompressed->GetPointer(), pCompressed->GetLength());
+}
+
+void detDeflateFileReader::Run(){
+	pTestSequential();
+	pTestRandomSeekNoIndex();
+	pTestRandomSeekIndex();
+	pTestRandomSeekMapped();
+	pTestErrors();
+}
+
+void detDeflateFileReader::CleanUp(){
+	pCompressed = nullptr;
+	pData.RemoveAll();
+	remove(DETDFR_FILENAME);
+}
+
+const char *detDeflateFileReader::GetTestName(){
+	return "DeflateFileReader";
+}
+
+
+
+// Private Functions
+//////////////////////
+
+void detDeflateFileReader::pTestSequential(){
+	SetSubTestNum(0);
+	
+	const decBaseFileReader::Ref reader(pCreateReader(nullptr));
+	ASSERT_EQUAL(reader->GetLength(), DETDFR_LENGTH);
+	ASSERT_TRUE(strcmp(reader->GetFilename(), "deflate.bin") == 0);
+	ASSERT_EQUAL(reader->GetModificationTime(), (TIME_SYSTEM)1234);
+	
+	decTList<uint8_t> data;
+	data.SetCountDiscard(DETDFR_LENGTH);
+	
+	// read in odd sized chunks to cross window and block boundaries
+	int position = 0;
+	while(position < DETDFR_LENGTH){
+		const int size = decMath::min(DETDFR_LENGTH - position, 12345);
+		reader->Read(data.GetArrayPointer() + position, size);
+		position += size;
+	}
+	
+	ASSERT_EQUAL(reader->GetPosition(), DETDFR_LENGTH);
+	ASSERT_TRUE(memcmp(data.GetArrayPointer(), pData.GetArrayPointer(), DETDFR_LENGTH) == 0);
+}
+
+void detDeflateFileReader::pTestRandomSeekNoIndex(){
+	SetSubTestNum(1);
+	
+	const decBaseFileReader::Ref reader(pCreateReader(nullptr));
+	pRandomSeek(reader, 20, 17);
+}
+
+void detDeflateFileReader::pTestRandomSeekIndex(){
+	SetSubTestNum(2);
+	
+	const decDeflateSeekIndex::Ref index(decDeflateSeekIndex::Ref::New(DETDFR_SPAN));
+	const decBaseFileReader::Ref reader(pCreateReader(index));
+	
+	// reading forward does not activate the index
+	uint8_t data[100];
+	reader->SetPosition(DETDFR_LENGTH / 2);
+	reader->Read(data, 100);
+	ASSERT_FALSE(index->GetActive());
+	ASSERT_EQUAL(index->GetCheckpointCount(), 0);
+	
+	// seeking backwards activates the index
+	reader->SetPosition(DETDFR_SPAN * 3);
+	ASSERT_TRUE(index->GetActive());
+	ASSERT_TRUE(index->GetCheckpointCount() >= 2);
+	
+	pRandomSeek(reader, 500, 42);
+	
+	// index covers the entire data after seeking close to the end
+	reader->SetPositionEnd(10);
+	const int count = index->GetCheckpointCount();
+	ASSERT_TRUE(count >= DETDFR_LENGTH / DETDFR_SPAN / 2);
+	
+	int i, last = 0;
+	for(i=0; i<DETDFR_LENGTH; i+=DETDFR_SPAN / 2){
+		const decDeflateSeekIndex::cCheckpoint * const checkpoint = index->FindCheckpoint(i);
+		if(!checkpoint){
+			// first checkpoint is located at the first block boundary past one span
+			ASSERT_TRUE(i < DETDFR_SPAN * 2);
+			continue;
+		}
+		
+		ASSERT_TRUE(checkpoint->GetPositionOut() <= i);
+		ASSERT_TRUE(checkpoint->GetPositionOut() >= last);
+		ASSERT_TRUE(i - checkpoint->GetPositionOut() < DETDFR_SPAN * 2);
+		ASSERT_EQUAL(checkpoint->GetWindowSize(), decDeflateSeekIndex::WindowSize);
+		ASSERT_TRUE(memcmp(checkpoint->GetWindow(), pData.GetArrayPointer()
+			+ checkpoint->GetPositionOut() - decDeflateSeekIndex::WindowSize,
+			decDeflateSeekIndex::WindowSize) == 0);
+		last = checkpoint->GetPositionOut();
+	}
+	
+	// duplicate shares the index and does not add further checkpoints
+	const decBaseFileReader::Ref duplicate(reader->Duplicate());
+	ASSERT_EQUAL(duplicate->GetPosition(), DETDFR_LENGTH - 10);
+	pRandomSeek(duplicate, 200, 4711);
+	ASSERT_EQUAL(index->GetCheckpointCount(), count);
+}
+
+void detDeflateFileReader::pTestRandomSeekMapped(){
+	SetSubTestNum(3);
+	
+	const decDeflateSeekIndex::Ref index(decDeflateSeekIndex::Ref::New(DETDFR_SPAN));
+	const decDeflateFileReader::Ref reader(decDeflateFileReader::Ref::New(
+		decMappedFileReader::Ref::New(decMappedFile::Ref::New(DETDFR_FILENAME)),
+		"deflate.bin", 1234, DETDFR_HEADER,
+		pCompressed->GetLength() - DETDFR_HEADER - DETDFR_TRAILER, DETDFR_LENGTH, index));
+	
+	pRandomSeek(reader, 500, 99);
+	ASSERT_TRUE(index->GetCheckpointCount() > 0);
+}
+
+void detDeflateFileReader::pTestErrors(){
+	SetSubTestNum(4);
+	
+	const decBaseFileReader::Ref reader(pCreateReader(nullptr));
+	uint8_t data[10];
+	
+	reader->SetPosition(DETDFR_LENGTH - 5);
+	ASSERT_DOES_FAIL(reader->Read(data, 10));
+	ASSERT_DOES_FAIL(reader->SetPosition(DETDFR_LENGTH + 1));
+	ASSERT_DOES_FAIL(reader->SetPosition(-1));
+	
+	// compressed data located outside the source reader
+	ASSERT_DOES_FAIL(decDeflateFileReader::Ref::New(
+		decMemoryFileReader::Ref::New(pCompressed), "bad", 0,
+		DETDFR_HEADER, pCompressed->GetLength(), DETDFR_LENGTH));
+	
+	// uncompressed length larger than compressed data contains
+	const decBaseFileReader::Ref readerLong(decDeflateFileReader::Ref::New(
+		decMemoryFileReader::Ref::New(pCompressed), "bad", 0, DETDFR_HEADER,
+		pCompressed->GetLength() - DETDFR_HEADER - DETDFR_TRAILER, DETDFR_LENGTH + 100));
+	ASSERT_DOES_FAIL(readerLong->SetPosition(DETDFR_LENGTH + 50));
+}
+
+decBaseFileReader::Ref detDeflateFileReader::pCreateReader(decDeflateSeekIndex *seekIndex){
+	return decDeflateFileReader::Ref::New(decMemoryFileReader::Ref::New(pCompressed),
+		"deflate.bin", 1234, DETDFR_HEADER,
+		pCompressed->GetLength() - DETDFR_HEADER - DETDFR_TRAILER, DETDFR_LENGTH, seekIndex);
+}
+
+void detDeflateFileReader::pRandomSeek(decBaseFileReader &reader, int count, unsigned int seed){
+	uint8_t data[1000];
+	int i;
+	
+	for(i=0; i<count; i++){
+		seed = seed * 1103515245 + 12345;
+		const int position = (int)((seed >> 8) % (DETDFR_LENGTH - 1000));
+		const int size = 1 + (int)((seed >> 4) % 1000);
+		
+		reader.SetPosition(position);
+		reader.Read(data, size);
+		ASSERT_EQUAL(reader.GetPosition(), position + size);
+		ASSERT_TRUE(memcmp(data, pData.GetArrayPointer() + position, size) == 0);
+	}
+}
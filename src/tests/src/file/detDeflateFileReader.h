@@ -0,0 +1,42 @@
+// include only once
+#ifndef _DETDEFLATEFILEREADER_H_
+#define _DETDEFLATEFILEREADER_H_
+
+// includes
+#include "../detCase.h"
+
+#include <dragengine/common/collection/decTList.h>
+#include <dragengine/common/file/decBaseFileReader.h>
+#include <dragengine/common/file/decMemoryFile.h>
+
+class decDeflateSeekIndex;
+
+
+
+// class detDeflateFileReader
+class detDeflateFileReader : public detCase{
+private:
+	decTList<uint8_t> pData;
+	decMemoryFile::Ref pCompressed;
+	
+public:
+	detDeflateFileReader();
+	~detDeflateFileReader() override;
+	void Prepare() override;
+	void Run() override;
+	void CleanUp() override;
+	const char *GetTestName() override;
+	
+private:
+	void pTestSequential();
+	void pTestRandomSeekNoIndex();
+	void pTestRandomSeekIndex();
+	void pTestRandomSeekMapped();
+	void pTestErrors();
+	
+	decBaseFileReader::Ref pCreateReader(decDeflateSeekIndex *seekIndex);
+	void pRandomSeek(decBaseFileReader &reader, int count, unsigned int seed);
+};
+
+// end of include only once
+#endif
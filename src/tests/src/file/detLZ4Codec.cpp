@@ -0,0 +1,157 @@
+// includes
+#include <stdio.h>
+#include <string.h>
+
+#include "detLZ4Codec.h"
+
+#include <dragengine/common/file/decLZ4Codec.h>
+#include <dragengine/common/exceptions.h>
+
+
+
+// Class detLZ4Codec
+//////////////////////
+
+// Constructors, destructor
+/////////////////////////////
+
+detLZ4Codec::detLZ4Codec(){
+}
+
+detLZ4Codec::~detLZ4Codec(){
+	CleanUp();
+}
+
+
+
+// Testing
+////////////
+
+void detLZ4Codec::Prepare(){
+}
+
+void detLZ4Codec::Run(){
+	pTestRoundTrip();
+	pTestFormat();
+	pTestCorrupt();
+}
+
+void detLZ4Codec::CleanUp(){
+}
+
+const char *detLZ4Codec::GetTestName(){
+	return "LZ4Codec";
+}
+
+
+
+// Private Functions
+//////////////////////
+
+void detLZ4Codec::pTestRoundTrip(){
+	SetSubTestNum(0);
+	
+	decTList<uint8_t> data;
+	data.SetCountDiscard(300000);
+	uint8_t * const pointer = data.GetArrayPointer();
+	unsigned int seed = 4711;
+	int i;
+	
+	// empty and blocks too small to contain matches
+	pAssertRoundTrip(nullptr, 0);
+	pAssertRoundTrip((const uint8_t*)"aaaaaaaaaaaa", 12);
+	pAssertRoundTrip((const uint8_t*)"aaaaaaaaaaaaa", 13);
+	
+	// incompressible data
+	for(i=0; i<data.GetCount(); i++){
+		seed = seed * 1103515245 + 12345;
+		pointer[i] = (uint8_t)(seed >> 16);
+	}
+	pAssertRoundTrip(pointer, data.GetCount());
+	pAssertRoundTrip(pointer, 100);
+	
+	// runs of single bytes requiring overlapping matches and long length encoding
+	memset(pointer, 'x', data.GetCount());
+	pAssertRoundTrip(pointer, data.GetCount());
+	pAssertRoundTrip(pointer, 19);
+	
+	// compressible text like data
+	for(i=0; i<data.GetCount(); i++){
+		seed = seed * 1103515245 + 12345;
+		const int value = (seed >> 16) % 40;
+		pointer[i] = value < 26 ? (uint8_t)('a' + value) : (value < 34 ? ' ' : (uint8_t)(seed >> 8));
+	}
+	pAssertRoundTrip(pointer, data.GetCount());
+	
+	// repeating pattern farther away than the maximum match offset
+	for(i=0; i<data.GetCount(); i++){
+		pointer[i] = (uint8_t)((i % 70000) * 13 + (i % 70000) / 256);
+	}
+	pAssertRoundTrip(pointer, data.GetCount());
+	
+	ASSERT_DOES_FAIL(decLZ4Codec::CompressBound(-1));
+	
+	uint8_t compressed[64];
+	ASSERT_DOES_FAIL(decLZ4Codec::Compress(pointer, 100, compressed, 64));
+}
+
+void detLZ4Codec::pTestFormat(){
+	SetSubTestNum(1);
+	
+	// block written by the reference implementation: literal 'a', match of 8 bytes
+	// at offset 1 and 5 trailing literals
+	const uint8_t block[] = {0x14, 'a', 0x01, 0x00, 0x50, 'b', 'b', 'b', 'b', 'b'};
+	char output[15];
+	
+	decLZ4Codec::Decompress(block, sizeof(block), output, 14);
+	output[14] = 0;
+	ASSERT_TRUE(strcmp(output, "aaaaaaaaabbbbb") == 0);
+	
+	// compressed output follows the end of block restrictions
+	uint8_t data[1000], compressed[1100];
+	memset(data, 'a', sizeof(data));
+	const int size = decLZ4Codec::Compress(data, sizeof(data), compressed, sizeof(compressed));
+	ASSERT_TRUE(size < 20);
+	ASSERT_EQUAL(compressed[size - 6], 0x50);
+	ASSERT_TRUE(memcmp(compressed + size - 5, "aaaaa", 5) == 0);
+}
+
+void detLZ4Codec::pTestCorrupt(){
+	SetSubTestNum(2);
+	
+	uint8_t output[32];
+	
+	// wrong decompressed size
+	const uint8_t valid[] = {0x14, 'a', 0x01, 0x00, 0x50, 'b', 'b', 'b', 'b', 'b'};
+	ASSERT_DOES_FAIL(decLZ4Codec::Decompress(valid, sizeof(valid), output, 13));
+	ASSERT_DOES_FAIL(decLZ4Codec::Decompress(valid, sizeof(valid), output, 15));
+	
+	// truncated
+	ASSERT_DOES_FAIL(decLZ4Codec::Decompress(valid, 3, output, 14));
+	ASSERT_DOES_FAIL(decLZ4Codec::Decompress(valid, 0, output, 0));
+	
+	// offset of 0 or before the start of the output
+	const uint8_t zeroOffset[] = {0x14, 'a', 0x00, 0x00, 0x50, 'b', 'b', 'b', 'b', 'b'};
+	ASSERT_DOES_FAIL(decLZ4Codec::Decompress(zeroOffset, sizeof(zeroOffset), output, 14));
+	
+	const uint8_t farOffset[] = {0x14, 'a', 0x02, 0x00, 0x50, 'b', 'b', 'b', 'b', 'b'};
+	ASSERT_DOES_FAIL(decLZ4Codec::Decompress(farOffset, sizeof(farOffset), output, 14));
+	
+	// literal length beyond the end of the input
+	const uint8_t longLiterals[] = {0xf0, 0xff, 0xff, 0x10, 'a'};
+	ASSERT_DOES_FAIL(decLZ4Codec::Decompress(longLiterals, sizeof(longLiterals), output, 32));
+}
+
+void detLZ4Codec::pAssertRoundTrip(const uint8_t *data, int size){
+	decTList<uint8_t> compressed, decompressed;
+	const int bound = decLZ4Codec::CompressBound(size);
+	compressed.SetCountDiscard(bound);
+	decompressed.SetCountDiscard(size + 1);
+	
+	const int compressedSize = decLZ4Codec::Compress(data, size, compressed.GetArrayPointer(), bound);
+	ASSERT_TRUE(compressedSize > 0);
+	ASSERT_TRUE(compressedSize <= bound);
+	
+	decLZ4Codec::Decompress(compressed.GetArrayPointer(), compressedSize, decompressed.GetArrayPointer(), size);
+	ASSERT_TRUE(size == 0 || memcmp(decompressed.GetArrayPointer(), data, size) == 0);
+}
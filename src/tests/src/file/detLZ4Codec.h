@@ -0,0 +1,31 @@
+// include only once
+#ifndef _DETLZ4CODEC_H_
+#define _DETLZ4CODEC_H_
+
+// includes
+#include "../detCase.h"
+
+#include <dragengine/common/collection/decTList.h>
+
+
+
+// class detLZ4Codec
+class detLZ4Codec : public detCase{
+public:
+	detLZ4Codec();
+	~detLZ4Codec() override;
+	void Prepare() override;
+	void Run() override;
+	void CleanUp() override;
+	const char *GetTestName() override;
+	
+private:
+	void pTestRoundTrip();
+	void pTestFormat();
+	void pTestCorrupt();
+	
+	void pAssertRoundTrip(const uint8_t *data, int size);
+};
+
+// end of include only once
+#endif
@@ -0,0 +1,153 @@
+// includes
+#include <stdio.h>
+#include <string.h>
+
+#include "detMappedFile.h"
+
+#include <dragengine/common/file/decDiskFileWriter.h>
+#include <dragengine/common/file/decMappedFile.h>
+#include <dragengine/common/file/decMappedFileReader.h>
+#include <dragengine/common/exceptions.h>
+
+
+// definitions
+#define DETMF_FILENAME "detests_mapped_file"
+#define DETMF_FILENAME_EMPTY "detests_mapped_file_empty"
+#define DETMF_LENGTH 10000
+
+
+
+// Class detMappedFile
+////////////////////////
+
+// Constructors, destructor
+/////////////////////////////
+
+detMappedFile::detMappedFile(){
+}
+
+detMappedFile::~detMappedFile(){
+	CleanUp();
+}
+
+
+
+// Testing
+////////////
+
+void detMappedFile::Prepare(){
+	uint8_t data[DETMF_LENGTH];
+	int i;
+	for(i=0; i<DETMF_LENGTH; i++){
+		data[i] = (uint8_t)(i * 7);
+	}
+	
+	decDiskFileWriter::Ref::New(DETMF_FILENAME, false)->Write(data, DETMF_LENGTH);
+	decDiskFileWriter::Ref::New(DETMF_FILENAME_EMPTY, false);
+}
+
+void detMappedFile::Run(){
+	pTestMapFile();
+	pTestReadRange();
+	pTestDuplicate();
+	pTestEmptyFile();
+}
+
+void detMappedFile::CleanUp(){
+	remove(DETMF_FILENAME);
+	remove(DETMF_FILENAME_EMPTY);
+}
+
+const char *detMappedFile::GetTestName(){
+	return "MappedFile";
+}
+
+
+
+// Private Functions
+//////////////////////
+
+void detMappedFile::pTestMapFile(){
+	SetSubTestNum(0);
+	
+	const decMappedFile::Ref file(decMappedFile::Ref::New(DETMF_FILENAME));
+	ASSERT_EQUAL((int)file->GetLength(), DETMF_LENGTH);
+	ASSERT_NOT_NULL(file->GetPointer());
+	ASSERT_EQUAL(file->GetPointer()[0], 0);
+	ASSERT_EQUAL(file->GetPointer()[DETMF_LENGTH - 1], (uint8_t)((DETMF_LENGTH - 1) * 7));
+	
+	const decMappedFileReader::Ref reader(decMappedFileReader::Ref::New(file));
+	ASSERT_EQUAL(reader->GetLength(), DETMF_LENGTH);
+	ASSERT_EQUAL(reader->GetData(), file->GetPointer());
+	
+	uint8_t data[DETMF_LENGTH];
+	reader->Read(data, DETMF_LENGTH);
+	ASSERT_EQUAL(reader->GetPosition(), DETMF_LENGTH);
+	ASSERT_TRUE(memcmp(data, file->GetPointer(), DETMF_LENGTH) == 0);
+	
+	ASSERT_DOES_FAIL(decMappedFile::Ref::New("detests_mapped_file_missing"));
+}
+
+void detMappedFile::pTestReadRange(){
+	SetSubTestNum(1);
+	
+	const decMappedFile::Ref file(decMappedFile::Ref::New(DETMF_FILENAME));
+	const decMappedFileReader::Ref reader(decMappedFileReader::Ref::New(
+		file, "range.bin", 1234, 100, 50));
+	
+	ASSERT_EQUAL(reader->GetLength(), 50);
+	ASSERT_TRUE(strcmp(reader->GetFilename(), "range.bin") == 0);
+	ASSERT_EQUAL(reader->GetModificationTime(), (TIME_SYSTEM)1234);
+	ASSERT_EQUAL(reader->GetData(), file->GetPointer() + 100);
+	
+	ASSERT_EQUAL(reader->ReadByte(), (uint8_t)(100 * 7));
+	reader->SetPosition(10);
+	ASSERT_EQUAL(reader->GetDataAtPosition(), file->GetPointer() + 110);
+	ASSERT_EQUAL(reader->ReadByte(), (uint8_t)(110 * 7));
+	reader->MovePosition(-2);
+	ASSERT_EQUAL(reader->ReadByte(), (uint8_t)(109 * 7));
+	reader->SetPositionEnd(1);
+	ASSERT_EQUAL(reader->ReadByte(), (uint8_t)(149 * 7));
+	ASSERT_EQUAL(reader->GetPosition(), 50);
+	
+	// reading or seeking outside the range fails
+	uint8_t data[2];
+	reader->SetPosition(49);
+	ASSERT_DOES_FAIL(reader->Read(data, 2));
+	ASSERT_DOES_FAIL(reader->SetPosition(51));
+	ASSERT_DOES_FAIL(reader->MovePosition(-50));
+	
+	ASSERT_DOES_FAIL(decMappedFileReader::Ref::New(file, "bad", 0, DETMF_LENGTH - 10, 11));
+	ASSERT_DOES_FAIL(decMappedFileReader::Ref::New(file, "bad", 0, DETMF_LENGTH + 1, 0));
+}
+
+void detMappedFile::pTestDuplicate(){
+	SetSubTestNum(2);
+	
+	decMappedFileReader::Ref reader(decMappedFileReader::Ref::New(
+		decMappedFile::Ref::New(DETMF_FILENAME), "range.bin", 0, 200, 100));
+	reader->SetPosition(20);
+	
+	// duplicate keeps the mapping alive after the original reader is gone
+	const decBaseFileReader::Ref duplicate(reader->Duplicate());
+	reader = nullptr;
+	
+	ASSERT_EQUAL(duplicate->GetLength(), 100);
+	ASSERT_EQUAL(duplicate->GetPosition(), 20);
+	ASSERT_EQUAL(duplicate->ReadByte(), (uint8_t)(220 * 7));
+}
+
+void detMappedFile::pTestEmptyFile(){
+	SetSubTestNum(3);
+	
+	const decMappedFile::Ref file(decMappedFile::Ref::New(DETMF_FILENAME_EMPTY));
+	ASSERT_EQUAL((int)file->GetLength(), 0);
+	ASSERT_NULL(file->GetPointer());
+	
+	const decMappedFileReader::Ref reader(decMappedFileReader::Ref::New(file));
+	ASSERT_EQUAL(reader->GetLength(), 0);
+	
+	uint8_t data[1];
+	reader->Read(data, 0);
+	ASSERT_DOES_FAIL(reader->Read(data, 1));
+}
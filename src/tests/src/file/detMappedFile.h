@@ -0,0 +1,28 @@
+// include only once
+#ifndef _DETMAPPEDFILE_H_
+#define _DETMAPPEDFILE_H_
+
+// includes
+#include "../detCase.h"
+
+
+
+// class detMappedFile
+class detMappedFile : public detCase{
+public:
+	detMappedFile();
+	~detMappedFile() override;
+	void Prepare() override;
+	void Run() override;
+	void CleanUp() override;
+	const char *GetTestName() override;
+	
+private:
+	void pTestMapFile();
+	void pTestReadRange();
+	void pTestDuplicate();
+	void pTestEmptyFile();
+};
+
+// end of include only once
+#endif
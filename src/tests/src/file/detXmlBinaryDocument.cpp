@@ -0,0 +1,494 @@
+// includes
+#include <stdio.h>
+#include <string.h>
+
+#include "detXmlBinaryDocument.h"
+
+#include <dragengine/common/file/decMemoryFile.h>
+#include <dragengine/common/file/decMemoryFileReader.h>
+#include <dragengine/common/file/decMemoryFileWriter.h>
+#include <dragengine/common/xmlparser/decXmlParser.h>
+#include <dragengine/common/xmlparser/decXmlElementTag.h>
+#include <dragengine/common/xmlparser/decXmlAttValue.h>
+#include <dragengine/common/xmlparser/decXmlCharacterData.h>
+#include <dragengine/common/xmlparser/decXmlCDSect.h>
+#include <dragengine/common/xmlparser/decXmlComment.h>
+#include <dragengine/common/xmlparser/decXmlPI.h>
+#include <dragengine/common/xmlparser/decXmlEntityReference.h>
+#include <dragengine/common/xmlparser/decXmlCharReference.h>
+#include <dragengine/common/xmlparser/decXmlNamespace.h>
+#include <dragengine/common/xmlparser/decXmlBinaryDocument.h>
+#include <dragengine/common/xmlparser/decXmlBinaryElement.h>
+#include <dragengine/filesystem/deXmlDocumentCache.h>
+#include <dragengine/filesystem/deVFSDiskDirectory.h>
+#include <dragengine/logger/deLoggerConsole.h>
+#include <dragengine/common/exceptions.h>
+
+
+// definitions
+static const char * const vXmlSample =
+	"<?xml version='1.0' encoding='UTF-8' standalone='yes'?>\n"
+	"<!-- leading comment -->\n"
+	"<skin name='test'>\n"
+	"\t<?target command text?>\n"
+	"\t<texture name='diffuse' unit='2'>\n"
+	"\t\t<value type='color'>1 0.5 0.25</value>\n"
+	"\t\t<path>textures/diffuse.png</path>\n"
+	"\t\t<!-- texture comment -->\n"
+	"\t\t<script><![CDATA[a < b && c]]></script>\n"
+	"\t</texture>\n"
+	"\t<texture name='diffuse' unit='3'>\n"
+	"\t\t<path>textures/diffuse.png</path>\n"
+	"\t</texture>\n"
+	"\t<empty/>\n"
+	"</skin>\n";
+
+static const char * const vXmlChanged =
+	"<?xml version='1.0' encoding='UTF-8'?>\n"
+	"<skin name='changed'/>\n";
+
+
+
+// Class detXmlBinaryDocument
+///////////////////////////////
+
+// Constructors, destructor
+/////////////////////////////
+
+detXmlBinaryDocument::detXmlBinaryDocument(){
+}
+
+detXmlBinaryDocument::~detXmlBinaryDocument(){
+	CleanUp();
+}
+
+
+
+// Testing
+////////////
+
+void detXmlBinaryDocument::Prepare(){
+	pBasePath = decPath::CreateWorkingDirectory();
+	pBasePath.AddComponent("detests_xml_cache");
+	
+	pVFS = deVirtualFileSystem::Ref::New();
+	pVFS->AddContainer(deVFSDiskDirectory::Ref::New(pBasePath));
+}
+
+void detXmlBinaryDocument::Run(){
+	pTestCompile();
+	pTestSaveLoad();
+	pTestCorrupt();
+	pTestCache();
+	pTestCacheSameName();
+	pTestCacheKeepCharData();
+}
+
+void detXmlBinaryDocument::CleanUp(){
+	if(!pVFS){
+		return;
+	}
+	
+	deCachePack(pVFS, decPath::CreatePathUnix("/cache")).DeleteAll();
+	pVFS = nullptr;
+	
+	const deVFSDiskDirectory::Ref base(deVFSDiskDirectory::Ref::New(pBasePath));
+	const decPath pathIndex(decPath::CreatePathUnix("/cache/index"));
+	if(base->ExistsFile(pathIndex)){
+		base->DeleteFile(pathIndex);
+	}
+	
+	const decPath pathCache(decPath::CreatePathUnix("/cache"));
+	if(base->ExistsFile(pathCache)){
+		base->DeleteFile(pathCache);
+	}
+	
+	deVFSDiskDirectory::Ref::New(pBasePath.GetParent())->DeleteFile(
+		decPath::CreatePathUnix(pBasePath.GetLastComponent()));
+}
+
+const char *detXmlBinaryDocument::GetTestName(){
+	return "XmlBinaryDocument";
+}
+
+
+
+// Private Functions
+//////////////////////
+
+void detXmlBinaryDocument::pTestCompile(){
+	SetSubTestNum(0);
+	
+	const decXmlDocument::Ref document(pParse(vXmlSample));
+	const decXmlBinaryDocument::Ref binary(decXmlBinaryDocument::Ref::New(document));
+	
+	ASSERT_TRUE(binary->GetEncoding() == document->GetEncoding());
+	ASSERT_TRUE(binary->GetStandalone());
+	ASSERT_EQUAL(binary->GetDataSize() % 4, 0);
+	pCompare(*document, binary->GetDocument());
+	
+	// convenience accessors
+	const decXmlBinaryElement * const root = binary->GetRoot();
+	ASSERT_NOT_NULL(root);
+	ASSERT_TRUE(root->GetName() == "skin");
+	ASSERT_FALSE(root->GetName() != "skin");
+	ASSERT_EQUAL(root->GetLineNumber(), 3);
+	
+	const decXmlBinaryElement * const attName = root->FindAttribute("name");
+	ASSERT_NOT_NULL(attName);
+	ASSERT_TRUE(attName->GetValue() == "test");
+	ASSERT_NULL(root->FindAttribute("missing"));
+	
+	const decXmlBinaryElement *texture = nullptr;
+	int i;
+	for(i=0; i<root->GetElementCount(); i++){
+		texture = root->GetElementIfTag(i);
+		if(texture && texture->GetName() == "texture"){
+			break;
+		}
+	}
+	ASSERT_NOT_NULL(texture);
+	ASSERT_EQUAL(texture->FindAttribute("unit")->GetValue().ToInt(), 2);
+	ASSERT_NULL(texture->GetElementIfTag(0));
+	
+	const decXmlBinaryElement *script = nullptr;
+	for(i=0; i<texture->GetElementCount(); i++){
+		script = texture->GetElementIfTag(i);
+		if(script && script->GetName() == "script"){
+			break;
+		}
+	}
+	ASSERT_NOT_NULL(script);
+	ASSERT_NOT_NULL(script->GetFirstData());
+	ASSERT_TRUE(script->GetFirstData()->GetData() == "a < b && c");
+	ASSERT_TRUE(script->CastToElementTag() == script);
+	ASSERT_DOES_FAIL(script->CastToAttValue());
+	ASSERT_DOES_FAIL(script->GetElementAt(script->GetElementCount()));
+	
+	// equal strings are stored once
+	const decXmlBinaryElement::cString textureName1(texture->FindAttribute("name")->GetValue());
+	for(i=root->GetElementCount()-1; i>=0; i--){
+		const decXmlBinaryElement * const tag = root->GetElementIfTag(i);
+		if(tag && tag->GetName() == "texture" && tag != texture){
+			ASSERT_TRUE(tag->FindAttribute("name")->GetValue().GetString()
+				== textureName1.GetString());
+			break;
+		}
+	}
+	ASSERT_TRUE(i >= 0);
+	
+	// empty document
+	const decXmlBinaryDocument::Ref empty(decXmlBinaryDocument::Ref::New(
+		decXmlDocument::Ref::New()));
+	ASSERT_EQUAL(empty->GetElementCount(), 0);
+	ASSERT_NULL(empty->GetRoot());
+	ASSERT_TRUE(empty->GetEncoding().IsEmpty());
+}
+
+void detXmlBinaryDocument::pTestSaveLoad(){
+	SetSubTestNum(1);
+	
+	const decXmlDocument::Ref document(pParse(vXmlSample));
+	const decXmlBinaryDocument::Ref binary(decXmlBinaryDocument::Ref::New(document));
+	
+	const decMemoryFile::Ref file(decMemoryFile::Ref::New("test.dexb"));
+	binary->Save(decMemoryFileWriter::Ref::New(file, false));
+	ASSERT_EQUAL(file->GetLength(), binary->GetDataSize());
+	
+	const decXmlBinaryDocument::Ref loaded(decXmlBinaryDocument::Ref::New(
+		decMemoryFileReader::Ref::New(file)));
+	ASSERT_EQUAL(loaded->GetDataSize(), binary->GetDataSize());
+	ASSERT_TRUE(memcmp(loaded->GetData(), binary->GetData(), binary->GetDataSize()) == 0);
+	pCompare(*document, loaded->GetDocument());
+	
+	// loading starts at the current file position
+	const decMemoryFile::Ref file2(decMemoryFile::Ref::New("test2.dexb"));
+	{
+	const decMemoryFileWriter::Ref writer(decMemoryFileWriter::Ref::New(file2, false));
+	writer->WriteInt(12345);
+	binary->Save(writer);
+	}
+	
+	const decMemoryFileReader::Ref reader(decMemoryFileReader::Ref::New(file2));
+	ASSERT_EQUAL(reader->ReadInt(), 12345);
+	pCompare(*document, decXmlBinaryDocument::Ref::New(reader)->GetDocument());
+}
+
+void detXmlBinaryDocument::pTestCorrupt(){
+	SetSubTestNum(2);
+	
+	const decXmlBinaryDocument::Ref binary(decXmlBinaryDocument::Ref::New(pParse(vXmlSample)));
+	const int size = binary->GetDataSize();
+	const decMemoryFile::Ref file(decMemoryFile::Ref::New("corrupt.dexb"));
+	
+	#define DETXBD_CORRUPT(offset, value) \
+		file->Resize(size); \
+		memcpy(file->GetPointer(), binary->GetData(), size); \
+		((int32_t*)file->GetPointer())[(offset) / 4] = (value); \
+		ASSERT_DOES_FAIL(decXmlBinaryDocument::Ref::New(decMemoryFileReader::Ref::New(file)))
+	
+	// header. signature, version, size, string table offset
+	DETXBD_CORRUPT(0, 0x12345678);
+	DETXBD_CORRUPT(4, 99);
+	DETXBD_CORRUPT(8, size + 4);
+	DETXBD_CORRUPT(16, size + 4);
+	
+	// document node. type, name offset outside string table, child offset out of range
+	DETXBD_CORRUPT(36, 1);
+	DETXBD_CORRUPT(48, -100);
+	DETXBD_CORRUPT(60, size);
+	DETXBD_CORRUPT(60, -28);
+	
+	#undef DETXBD_CORRUPT
+	
+	// truncated files
+	file->Resize(20);
+	memcpy(file->GetPointer(), binary->GetData(), 20);
+	ASSERT_DOES_FAIL(decXmlBinaryDocument::Ref::New(decMemoryFileReader::Ref::New(file)));
+	
+	file->Resize(size - 2);
+	memcpy(file->GetPointer(), binary->GetData(), size - 2);
+	ASSERT_DOES_FAIL(decXmlBinaryDocument::Ref::New(decMemoryFileReader::Ref::New(file)));
+	
+	// string table not terminated
+	file->Resize(size);
+	memcpy(file->GetPointer(), binary->GetData(), size);
+	file->GetPointer()[size - 1] = 'x';
+	ASSERT_DOES_FAIL(decXmlBinaryDocument::Ref::New(decMemoryFileReader::Ref::New(file)));
+	
+	// unmodified data loads
+	file->GetPointer()[size - 1] = 0;
+	decXmlBinaryDocument::Ref::New(decMemoryFileReader::Ref::New(file));
+}
+
+void detXmlBinaryDocument::pTestCache(){
+	SetSubTestNum(3);
+	
+	const deLoggerConsole::Ref logger(deLoggerConsole::Ref::New());
+	const decMemoryFile::Ref file(decMemoryFile::Ref::New("/data/test.deskin"));
+	pSetContent(file, vXmlSample);
+	file->SetModificationTime(1000);
+	
+	{
+	deXmlDocumentCache cache(pVFS, decPath::CreatePathUnix("/cache"));
+	cache.GetCachePack().DeleteAll();
+	
+	// first load parses the file and caches it
+	const decXmlBinaryDocument::Ref loaded1(cache.Load(
+		decMemoryFileReader::Ref::New(file), "/data/test.deskin", logger));
+	ASSERT_EQUAL(cache.GetCachePack().GetEntryCount(), 1);
+	ASSERT_TRUE(loaded1->GetRoot()->FindAttribute("name")->GetValue() == "test");
+	
+	// comments are stripped
+	const decXmlDocument::Ref document(pParse(vXmlSample));
+	document->StripComments();
+	document->CleanCharData();
+	pCompare(*document, loaded1->GetDocument());
+	
+	// content replaced with same modification time and length uses the cache entry
+	decString modified(vXmlSample);
+	modified.ReplaceString("'test'", "'TEST'");
+	pSetContent(file, modified);
+	
+	const decXmlBinaryDocument::Ref loaded2(cache.Load(
+		decMemoryFileReader::Ref::New(file), "/data/test.deskin", logger));
+	ASSERT_TRUE(loaded2->GetRoot()->FindAttribute("name")->GetValue() == "test");
+	
+	// modification time changed parses the file again
+	file->SetModificationTime(2000);
+	const decXmlBinaryDocument::Ref loaded3(cache.Load(
+		decMemoryFileReader::Ref::New(file), "/data/test.deskin", logger));
+	ASSERT_TRUE(loaded3->GetRoot()->FindAttribute("name")->GetValue() == "TEST");
+	
+	// length changed parses the file again
+	pSetContent(file, vXmlChanged);
+	file->SetModificationTime(2000);
+	const decXmlBinaryDocument::Ref loaded4(cache.Load(
+		decMemoryFileReader::Ref::New(file), "/data/test.deskin", logger));
+	ASSERT_TRUE(loaded4->GetRoot()->FindAttribute("name")->GetValue() == "changed");
+	ASSERT_EQUAL(cache.GetCachePack().GetEntryCount(), 1);
+	}
+	
+	// cache persists across instances
+	deXmlDocumentCache cache(pVFS, decPath::CreatePathUnix("/cache"));
+	pSetContent(file, "<?xml version='1.0' encoding='UTF-8'?>\n<skin name='XXXXXXX'/>\n");
+	file->SetModificationTime(2000);
+	const decXmlBinaryDocument::Ref loaded5(cache.Load(
+		decMemoryFileReader::Ref::New(file), "/data/test.deskin", logger));
+	ASSERT_TRUE(loaded5->GetRoot()->FindAttribute("name")->GetValue() == "changed");
+	
+	cache.GetCachePack().DeleteAll();
+}
+
+void detXmlBinaryDocument::pTestCacheSameName(){
+	SetSubTestNum(4);
+	
+	// readers of archive files report only the file name. files with the same name
+	// in different directories have to use different cache entries even if their
+	// modification time and length match
+	const deLoggerConsole::Ref logger(deLoggerConsole::Ref::New());
+	const decMemoryFile::Ref file1(decMemoryFile::Ref::New("test.deskin"));
+	const decMemoryFile::Ref file2(decMemoryFile::Ref::New("test.deskin"));
+	pSetContent(file1, "<?xml version='1.0' encoding='UTF-8'?>\n<skin name='first'/>\n");
+	pSetContent(file2, "<?xml version='1.0' encoding='UTF-8'?>\n<skin name='other'/>\n");
+	file1->SetModificationTime(1000);
+	file2->SetModificationTime(1000);
+	
+	deXmlDocumentCache cache(pVFS, decPath::CreatePathUnix("/cache"));
+	cache.GetCachePack().DeleteAll();
+	
+	const decXmlBinaryDocument::Ref loaded1(cache.Load(
+		decMemoryFileReader::Ref::New(file1), "/data/a/test.deskin", logger));
+	const decXmlBinaryDocument::Ref loaded2(cache.Load(
+		decMemoryFileReader::Ref::New(file2), "/data/b/test.deskin", logger));
+	ASSERT_TRUE(loaded1->GetRoot()->FindAttribute("name")->GetValue() == "first");
+	ASSERT_TRUE(loaded2->GetRoot()->FindAttribute("name")->GetValue() == "other");
+	ASSERT_EQUAL(cache.GetCachePack().GetEntryCount(), 2);
+	
+	// cached entries are found again by path
+	const decXmlBinaryDocument::Ref loaded3(cache.Load(
+		decMemoryFileReader::Ref::New(file1), "/data/a/test.deskin", logger));
+	const decXmlBinaryDocument::Ref loaded4(cache.Load(
+		decMemoryFileReader::Ref::New(file2), "/data/b/test.deskin", logger));
+	ASSERT_TRUE(loaded3->GetRoot()->FindAttribute("name")->GetValue() == "first");
+	ASSERT_TRUE(loaded4->GetRoot()->FindAttribute("name")->GetValue() == "other");
+	ASSERT_EQUAL(cache.GetCachePack().GetEntryCount(), 2);
+	
+	// empty path parses the file without caching
+	const decXmlBinaryDocument::Ref loaded5(cache.Load(
+		decMemoryFileReader::Ref::New(file1), "", logger));
+	ASSERT_TRUE(loaded5->GetRoot()->FindAttribute("name")->GetValue() == "first");
+	ASSERT_EQUAL(cache.GetCachePack().GetEntryCount(), 2);
+	
+	cache.GetCachePack().DeleteAll();
+}
+
+void detXmlBinaryDocument::pTestCacheKeepCharData(){
+	SetSubTestNum(5);
+	
+	// language packs keep white space in translations. cleaned and uncleaned documents
+	// of the same file must not be mixed up
+	const char * const xml = "<?xml version='1.0' encoding='UTF-8'?>\n"
+		"<languagePack><missingText>  two  spaces </missingText></languagePack>\n";
+	
+	const deLoggerConsole::Ref logger(deLoggerConsole::Ref::New());
+	const decMemoryFile::Ref file(decMemoryFile::Ref::New("/data/test.delangpack"));
+	pSetContent(file, xml);
+	file->SetModificationTime(1000);
+	
+	deXmlDocumentCache cache(pVFS, decPath::CreatePathUnix("/cache"));
+	cache.GetCachePack().DeleteAll();
+	
+	const decXmlBinaryDocument::Ref loaded1(cache.Load(
+		decMemoryFileReader::Ref::New(file), "/data/test.delangpack", logger, false));
+	ASSERT_TRUE(loaded1->GetRoot()->GetElementIfTag(0)->GetFirstData()->GetData() == "  two  spaces ");
+	
+	// cached entry keeps white space
+	const decXmlBinaryDocument::Ref loaded2(cache.Load(
+		decMemoryFileReader::Ref::New(file), "/data/test.delangpack", logger, false));
+	ASSERT_TRUE(loaded2->GetRoot()->GetElementIfTag(0)->GetFirstData()->GetData() == "  two  spaces ");
+	
+	// loading with cleaning replaces the entry and the other way round
+	const decXmlBinaryDocument::Ref loaded3(cache.Load(
+		decMemoryFileReader::Ref::New(file), "/data/test.delangpack", logger));
+	ASSERT_TRUE(loaded3->GetRoot()->GetElementIfTag(0)->GetFirstData()->GetData() == "two spaces");
+	
+	const decXmlBinaryDocument::Ref loaded4(cache.Load(
+		decMemoryFileReader::Ref::New(file), "/data/test.delangpack", logger, false));
+	ASSERT_TRUE(loaded4->GetRoot()->GetElementIfTag(0)->GetFirstData()->GetData() == "  two  spaces ");
+	ASSERT_EQUAL(cache.GetCachePack().GetEntryCount(), 1);
+	
+	cache.GetCachePack().DeleteAll();
+}
+
+decXmlDocument::Ref detXmlBinaryDocument::pParse(const char *xml){
+	const decMemoryFile::Ref file(decMemoryFile::Ref::New("test.xml"));
+	pSetContent(file, xml);
+	
+	const decXmlDocument::Ref document(decXmlDocument::Ref::New());
+	ASSERT_TRUE(decXmlParser(deLoggerConsole::Ref::New()).ParseXml(
+		decMemoryFileReader::Ref::New(file), document));
+	return document;
+}
+
+void detXmlBinaryDocument::pSetContent(decMemoryFile &file, const char *xml){
+	const int length = (int)strlen(xml);
+	file.Resize(length);
+	memcpy(file.GetPointer(), xml, length);
+}
+
+void detXmlBinaryDocument::pCompare(const decXmlElement &element, const decXmlBinaryElement &binary){
+	ASSERT_EQUAL(binary.GetLineNumber(), element.GetLineNumber());
+	ASSERT_EQUAL(binary.GetPositionNumber(), element.GetPositionNumber());
+	
+	const decXmlContainer *container = nullptr;
+	
+	if(element.CanCastToDocument()){
+		const decXmlDocument &document = *((decXmlElement&)element).CastToDocument();
+		ASSERT_TRUE(binary.CanCastToDocument());
+		ASSERT_TRUE(binary.GetName() == document.GetDocType());
+		container = &document;
+		
+	}else if(element.CanCastToElementTag()){
+		decXmlElementTag &tag = *((decXmlElement&)element).CastToElementTag();
+		ASSERT_TRUE(binary.CanCastToElementTag());
+		ASSERT_TRUE(binary.GetName() == tag.GetName());
+		container = &tag;
+		
+	}else if(element.CanCastToAttValue()){
+		decXmlAttValue &value = *((decXmlElement&)element).CastToAttValue();
+		ASSERT_TRUE(binary.CanCastToAttValue());
+		ASSERT_TRUE(binary.GetName() == value.GetName());
+		ASSERT_TRUE(binary.GetValue() == value.GetValue());
+		
+	}else if(element.CanCastToCDSect()){
+		ASSERT_TRUE(binary.CanCastToCDSect());
+		ASSERT_TRUE(binary.CanCastToCharacterData());
+		ASSERT_TRUE(binary.GetData() == ((decXmlElement&)element).CastToCDSect()->GetData());
+		
+	}else if(element.CanCastToCharacterData()){
+		ASSERT_TRUE(binary.CanCastToCharacterData());
+		ASSERT_FALSE(binary.CanCastToCDSect());
+		ASSERT_TRUE(binary.GetData() == ((decXmlElement&)element).CastToCharacterData()->GetData());
+		
+	}else if(element.CanCastToComment()){
+		ASSERT_TRUE(binary.CanCastToComment());
+		ASSERT_TRUE(binary.GetComment() == ((decXmlElement&)element).CastToComment()->GetComment());
+		
+	}else if(element.CanCastToPI()){
+		decXmlPI &pi = *((decXmlElement&)element).CastToPI();
+		ASSERT_TRUE(binary.CanCastToPI());
+		ASSERT_TRUE(binary.GetTarget() == pi.GetTarget());
+		ASSERT_TRUE(binary.GetCommand() == pi.GetCommand());
+		
+	}else if(element.CanCastToEntityReference()){
+		ASSERT_TRUE(binary.CanCastToEntityReference());
+		ASSERT_TRUE(binary.GetName() == ((decXmlElement&)element).CastToEntityReference()->GetName());
+		
+	}else if(element.CanCastToCharReference()){
+		ASSERT_TRUE(binary.CanCastToCharReference());
+		ASSERT_TRUE(binary.GetData() == ((decXmlElement&)element).CastToCharReference()->GetData());
+		
+	}else if(element.CanCastToNamespace()){
+		decXmlNamespace &ns = *((decXmlElement&)element).CastToNamespace();
+		ASSERT_TRUE(binary.CanCastToNamespace());
+		ASSERT_TRUE(binary.GetName() == ns.GetName());
+		ASSERT_TRUE(binary.GetURL() == ns.GetURL());
+		
+	}else{
+		DETHROW_INFO(deeTestFailed, "unknown element type");
+	}
+	
+	if(!container){
+		ASSERT_EQUAL(binary.GetElementCount(), 0);
+		return;
+	}
+	
+	const int count = container->GetElementCount();
+	ASSERT_EQUAL(binary.GetElementCount(), count);
+	
+	int i;
+	for(i=0; i<count; i++){
+		pCompare(*container->GetElementAt(i), *binary.GetElementAt(i));
+	}
+}
@@ -0,0 +1,46 @@
+// include only once
+#ifndef _DETXMLBINARYDOCUMENT_H_
+#define _DETXMLBINARYDOCUMENT_H_
+
+// includes
+#include "../detCase.h"
+
+#include <dragengine/common/file/decPath.h>
+#include <dragengine/common/xmlparser/decXmlDocument.h>
+#include <dragengine/filesystem/deVirtualFileSystem.h>
+
+class decMemoryFile;
+class decXmlElement;
+class decXmlBinaryElement;
+
+
+
+// class detXmlBinaryDocument
+class detXmlBinaryDocument : public detCase{
+private:
+	decPath pBasePath;
+	deVirtualFileSystem::Ref pVFS;
+	
+public:
+	detXmlBinaryDocument();
+	~detXmlBinaryDocument() override;
+	void Prepare() override;
+	void Run() override;
+	void CleanUp() override;
+	const char *GetTestName() override;
+	
+private:
+	void pTestCompile();
+	void pTestSaveLoad();
+	void pTestCorrupt();
+	void pTestCache();
+	void pTestCacheSameName();
+	void pTestCacheKeepCharData();
+	
+	decXmlDocument::Ref pParse(const char *xml);
+	void pSetContent(decMemoryFile &file, const char *xml);
+	void pCompare(const decXmlElement &element, const decXmlBinaryElement &binary);
+};
+
+// end of include only once
+#endif
@@ -0,0 +1,284 @@
+// includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "detLoggerAsync.h"
+
+#include <dragengine/common/collection/decTList.h>
+#include <dragengine/common/collection/decTUniqueList.h>
+#include <dragengine/common/file/decDiskFileReader.h>
+#include <dragengine/common/file/decDiskFileWriter.h>
+#include <dragengine/common/string/decString.h>
+#include <dragengine/common/exceptions.h>
+#include <dragengine/logger/deLoggerAsync.h>
+#include <dragengine/logger/deLoggerFile.h>
+#include <dragengine/threading/deMutex.h>
+#include <dragengine/threading/deMutexGuard.h>
+#include <dragengine/threading/deThread.h>
+
+
+// definitions
+#define DETLA_FILENAME "detests_logger_async"
+#define DETLA_THREAD_COUNT 8
+#define DETLA_MESSAGE_COUNT 2000
+#define DETLA_ERROR_INTERVAL 16
+#define DETLA_PADDING_LENGTH 16384
+
+
+// Logger recording messages. The source is the index of the producer thread and the
+// message the index of the message logged by the producer thread
+class detLARecordLogger : public deLogger{
+public:
+	using Ref = deTObjectReference<detLARecordLogger>;
+	
+	struct sMessage{
+		int producer;
+		int index;
+		bool error;
+	};
+	
+private:
+	deMutex pMutex;
+	decTList<sMessage> pMessages;
+	int pFlushedCount;
+	int pFlushCount;
+	
+public:
+	detLARecordLogger() : pFlushedCount(0), pFlushCount(0){
+	}
+	
+	void LogInfo(const char *source, const char *message) override{
+		pRecord(source, message, false);
+	}
+	
+	void LogWarn(const char *source, const char *message) override{
+		pRecord(source, message, false);
+	}
+	
+	void LogError(const char *source, const char *message) override{
+		pRecord(source, message, true);
+	}
+	
+	void Flush() override{
+		const deMutexGuard lock(pMutex);
+		pFlushedCount = pMessages.GetCount();
+		pFlushCount++;
+	}
+	
+	decTList<sMessage> GetMessages(){
+		const deMutexGuard lock(pMutex);
+		return pMessages;
+	}
+	
+	int GetFlushCount(){
+		const deMutexGuard lock(pMutex);
+		return pFlushCount;
+	}
+	
+	// message has been written and flushed afterwards
+	bool IsFlushed(int producer, int index){
+		const deMutexGuard lock(pMutex);
+		int i;
+		for(i=0; i<pFlushedCount; i++){
+			if(pMessages[i].producer == producer && pMessages[i].index == index){
+				return true;
+			}
+		}
+		return false;
+	}
+	
+private:
+	void pRecord(const char *source, const char *message, bool error){
+		const deMutexGuard lock(pMutex);
+		pMessages.Add({atoi(source), atoi(message), error});
+	}
+};
+
+
+// Producer thread logging messages. Every few messages an error is logged. Once LogError
+// returns the error has to be written and flushed
+class detLAProducer : public deThread{
+private:
+	deLoggerAsync &pLogger;
+	detLARecordLogger &pTarget;
+	const int pProducer;
+	int pNotFlushedCount;
+	
+public:
+	detLAProducer(deLoggerAsync &logger, detLARecordLogger &target, int producer) :
+	pLogger(logger), pTarget(target), pProducer(producer), pNotFlushedCount(0){
+	}
+	
+	inline int GetNotFlushedCount() const{ return pNotFlushedCount; }
+	
+	void Run() override{
+		// long info messages take longer to be copied into their slot. this increases the
+		// chance of other producers logging an error while the slot is claimed but not filled
+		decString source, message, padding;
+		source.Format("%d", pProducer);
+		padding.Set(' ', DETLA_PADDING_LENGTH);
+		
+		int i;
+		for(i=0; i<DETLA_MESSAGE_COUNT; i++){
+			if(i % DETLA_ERROR_INTERVAL == DETLA_ERROR_INTERVAL - 1){
+				message.Format("%d", i);
+				pLogger.LogError(source, message);
+				if(!pTarget.IsFlushed(pProducer, i)){
+					pNotFlushedCount++;
+				}
+				
+			}else{
+				message.Format("%d%s", i, padding.GetString());
+				pLogger.LogInfo(source, message);
+			}
+		}
+	}
+};
+
+
+
+// Class detLoggerAsync
+/////////////////////////
+
+// Constructors, destructor
+/////////////////////////////
+
+detLoggerAsync::detLoggerAsync(){
+}
+
+detLoggerAsync::~detLoggerAsync(){
+	CleanUp();
+}
+
+
+
+// Testing
+////////////
+
+void detLoggerAsync::Prepare(){
+}
+
+void detLoggerAsync::Run(){
+	pTestOrder();
+	pTestErrorFlushed();
+	pTestDestroyWritesPending();
+	pTestFileLoggerFlush();
+}
+
+void detLoggerAsync::CleanUp(){
+	remove(DETLA_FILENAME);
+}
+
+const char *detLoggerAsync::GetTestName(){
+	return "LoggerAsync";
+}
+
+
+
+// Private Functions
+//////////////////////
+
+void detLoggerAsync::pTestOrder(){
+	SetSubTestNum(0);
+	
+	// single producer with a small ring buffer. all messages arrive in order
+	const detLARecordLogger::Ref target(detLARecordLogger::Ref::New());
+	const deLoggerAsync::Ref logger(deLoggerAsync::Ref::New(target, 4));
+	ASSERT_EQUAL(logger->GetCapacity(), 4);
+	
+	decString message;
+	int i;
+	for(i=0; i<1000; i++){
+		message.Format("%d", i);
+		logger->LogInfo("0", message);
+	}
+	logger->Flush();
+	
+	const decTList<detLARecordLogger::sMessage> messages(target->GetMessages());
+	ASSERT_EQUAL(messages.GetCount(), 1000);
+	for(i=0; i<1000; i++){
+		ASSERT_EQUAL(messages[i].index, i);
+	}
+	ASSERT_TRUE(target->IsFlushed(0, 999));
+}
+
+void detLoggerAsync::pTestErrorFlushed(){
+	SetSubTestNum(1);
+	
+	// producers racing each other. LogError of one producer can find slots claimed by
+	// other producers not filled yet. LogError has to wait for these too
+	const detLARecordLogger::Ref target(detLARecordLogger::Ref::New());
+	const deLoggerAsync::Ref logger(deLoggerAsync::Ref::New(target, 64));
+	
+	decTUniqueList<detLAProducer> producers;
+	int i;
+	for(i=0; i<DETLA_THREAD_COUNT; i++){
+		producers.Add(deTUniqueReference<detLAProducer>::New(logger, target, i));
+	}
+	producers.Visit([](detLAProducer *producer){
+		producer->Start();
+	});
+	producers.Visit([](detLAProducer *producer){
+		producer->WaitForExit();
+	});
+	
+	producers.Visit([&](const detLAProducer *producer){
+		ASSERT_EQUAL(producer->GetNotFlushedCount(), 0);
+	});
+	
+	// messages of each producer are written in the order they have been logged
+	logger->Flush();
+	const decTList<detLARecordLogger::sMessage> messages(target->GetMessages());
+	ASSERT_EQUAL(messages.GetCount(), DETLA_THREAD_COUNT * DETLA_MESSAGE_COUNT);
+	
+	decTList<int> nextIndex;
+	nextIndex.AddRange(DETLA_THREAD_COUNT, 0);
+	messages.Visit([&](const detLARecordLogger::sMessage &message){
+		ASSERT_EQUAL(message.index, nextIndex[message.producer]);
+		ASSERT_EQUAL(message.error, message.index % DETLA_ERROR_INTERVAL == DETLA_ERROR_INTERVAL - 1);
+		nextIndex[message.producer]++;
+	});
+}
+
+void detLoggerAsync::pTestDestroyWritesPending(){
+	SetSubTestNum(2);
+	
+	const detLARecordLogger::Ref target(detLARecordLogger::Ref::New());
+	{
+	const deLoggerAsync::Ref logger(deLoggerAsync::Ref::New(target));
+	decString message;
+	int i;
+	for(i=0; i<500; i++){
+		message.Format("%d", i);
+		logger->LogWarn("3", message);
+	}
+	}
+	
+	ASSERT_EQUAL(target->GetMessages().GetCount(), 500);
+	ASSERT_TRUE(target->IsFlushed(3, 499));
+	ASSERT_TRUE(target->GetFlushCount() > 0);
+}
+
+void detLoggerAsync::pTestFileLoggerFlush(){
+	SetSubTestNum(3);
+	
+	// file logger without auto flushing writes the file content only when flushed.
+	// flushing writes the content of the own file
+	const deLoggerFile::Ref loggerFile(deLoggerFile::Ref::New(
+		decDiskFileWriter::Ref::New(DETLA_FILENAME, false)));
+	loggerFile->SetAutoFlush(false);
+	
+	const deLoggerAsync::Ref logger(deLoggerAsync::Ref::New(loggerFile));
+	logger->LogInfo("Test", "first message");
+	logger->LogError("Test", "error message");
+	
+	const decDiskFileReader::Ref reader(decDiskFileReader::Ref::New(DETLA_FILENAME));
+	const int length = reader->GetLength();
+	decString content;
+	content.Set(' ', length);
+	reader->Read((char*)content.GetString(), length);
+	
+	ASSERT_TRUE(content.FindString("first message") != -1);
+	ASSERT_TRUE(content.FindString("error message") != -1);
+}
@@ -0,0 +1,28 @@
+// include only once
+#ifndef _DETLOGGERASYNC_H_
+#define _DETLOGGERASYNC_H_
+
+// includes
+#include "../detCase.h"
+
+
+
+// class detLoggerAsync
+class detLoggerAsync : public detCase{
+public:
+	detLoggerAsync();
+	~detLoggerAsync() override;
+	void Prepare() override;
+	void Run() override;
+	void CleanUp() override;
+	const char *GetTestName() override;
+	
+private:
+	void pTestOrder();
+	void pTestErrorFlushed();
+	void pTestDestroyWritesPending();
+	void pTestFileLoggerFlush();
+};
+
+// end of include only once
+#endif
@@ -3,6 +3,7 @@
 #include <stdlib.h>
 #include "detMath.h"
 #include "dragengine/common/math/decMath.h"
+#include "dragengine/common/math/decMathBatch.h"
 #include "dragengine/common/exceptions.h"
 
 	
@@ -107,6 +108,7 @@ void detMath::Run(){
 	ASSERT_TRUE((mat1 * tps).IsEqualTo(mat2 * tps));
 	
 	TestQuaternion();
+	TestMathBatch();
 }
 void detMath::CleanUp(){}
 const char *detMath::GetTestName(){return "Math";}
@@ -428,3 +430,90 @@ void detMath::TestQuaternion(){
 	dmrot3 = dmrot1 * decDMatrix::CreateRotationAxis(dmrot1.TransformView(), DEG2RAD * 30.0);
 	ASSERT_TRUE(dmrot3.IsEqualTo(dmrot2));
 }
+
+void detMath::TestMathBatch(){
+	SetSubTestNum(6);
+	
+	// odd count to test the remainder handling of SIMD implementations
+	const int count = 11;
+	decMatrix ma[count], mb[count], mr[count];
+	decVector v[count], vr[count];
+	decQuaternion qa[count], qb[count], qr[count];
+	float factors[count];
+	int i;
+	
+	for(i=0; i<count; i++){
+		const float f = (float)i;
+		ma[i] = decMatrix::CreateSRT(decVector(1.0f + 0.1f * f, 0.5f, 2.0f),
+			decVector(0.2f * f, -0.3f * f, 0.1f), decVector(f, -2.0f * f, 0.5f));
+		mb[i] = decMatrix::CreateRT(decVector(-0.1f * f, 0.4f, 0.3f * f), decVector(3.0f, f, -f));
+		v[i].Set(f - 5.0f, 2.0f * f, 3.0f - f);
+		qa[i] = decMatrix::CreateRotation(0.3f * f, -0.2f * f, 0.1f).ToQuaternion();
+		qb[i] = decMatrix::CreateRotation(-0.1f * f, 0.4f, 0.25f * f).ToQuaternion();
+		factors[i] = f / (float)(count - 1);
+	}
+	
+	decMathBatch::Multiply(ma, mb, mr, count);
+	for(i=0; i<count; i++){
+		ASSERT_TRUE(mr[i].IsEqualTo(ma[i] * mb[i], 1e-5f));
+	}
+	
+	decMathBatch::QuickMultiply(ma, mb, mr, count);
+	for(i=0; i<count; i++){
+		ASSERT_TRUE(mr[i].IsEqualTo(ma[i].QuickMultiply(mb[i]), 1e-5f));
+	}
+	
+	decMathBatch::QuickMultiply(ma, mb[3], mr, count);
+	for(i=0; i<count; i++){
+		ASSERT_TRUE(mr[i].IsEqualTo(ma[i].QuickMultiply(mb[3]), 1e-5f));
+	}
+	
+	// in place
+	for(i=0; i<count; i++){
+		mr[i] = ma[i];
+	}
+	decMathBatch::QuickMultiply(mr, mb, mr, count);
+	for(i=0; i<count; i++){
+		ASSERT_TRUE(mr[i].IsEqualTo(ma[i].QuickMultiply(mb[i]), 1e-5f));
+	}
+	
+	decMathBatch::Transform(ma[5], v, vr, count);
+	for(i=0; i<count; i++){
+		ASSERT_TRUE(vr[i].IsEqualTo(ma[5] * v[i], 1e-5f));
+	}
+	
+	decMathBatch::TransformNormal(ma[5], v, vr, count);
+	for(i=0; i<count; i++){
+		ASSERT_TRUE(vr[i].IsEqualTo(ma[5].TransformNormal(v[i]), 1e-5f));
+	}
+	
+	for(i=0; i<count; i++){
+		qr[i] = qa[i] * (1.0f + (float)i);
+	}
+	decMathBatch::Normalize(qr, count);
+	for(i=0; i<count; i++){
+		ASSERT_TRUE(qr[i].IsEqualTo(qa[i], 1e-5f));
+	}
+	
+	qr[7].Set(0.0f, 0.0f, 0.0f, 0.0f);
+	ASSERT_DOES_FAIL(decMathBatch::Normalize(qr, count));
+	
+	decMathBatch::Slerp(qa, qb, 0.3f, qr, count);
+	for(i=0; i<count; i++){
+		ASSERT_TRUE(qr[i].IsEqualTo(qa[i].Slerp(qb[i], 0.3f), 1e-4f));
+	}
+	
+	decMathBatch::Slerp(qa, qb, factors, qr, count);
+	for(i=0; i<count; i++){
+		ASSERT_TRUE(qr[i].IsEqualTo(qa[i].Slerp(qb[i], factors[i]), 1e-4f));
+	}
+	
+	// opposite hemisphere
+	for(i=0; i<count; i++){
+		qr[i] = qb[i] * -1.0f;
+	}
+	decMathBatch::Slerp(qa, qr, factors, qr, count);
+	for(i=0; i<count; i++){
+		ASSERT_TRUE(qr[i].IsEqualTo(qa[i].Slerp(qb[i] * -1.0f, factors[i]), 1e-4f));
+	}
+}
@@ -16,6 +16,7 @@ public:
 	const char *GetTestName() override;
 	
 	void TestQuaternion();
+	void TestMathBatch();
 };
 
 // end of include only once
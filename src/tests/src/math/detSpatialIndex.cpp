@@ -0,0 +1,601 @@
+// includes
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "detSpatialIndex.h"
+
+#include <dragengine/common/math/decSpatialIndex.h>
+#include <dragengine/common/utils/decPRNG.h>
+#include <dragengine/common/exceptions.h>
+
+
+
+// Class detSpatialIndex
+//////////////////////////
+
+// Constructors, destructor
+/////////////////////////////
+
+detSpatialIndex::detSpatialIndex(){
+}
+
+detSpatialIndex::~detSpatialIndex(){
+}
+
+
+
+// Testing
+////////////
+
+void detSpatialIndex::Prepare(){
+}
+
+void detSpatialIndex::Run(){
+	pTestEmpty();
+	pTestInsertRemove();
+	pTestQueryBox();
+	pTestQueryRay();
+	pTestQueryPlanes();
+	pTestBatch();
+	pTestFindNearest();
+	pTestFindNearestTies();
+	pTestFindNearestReject();
+}
+
+void detSpatialIndex::CleanUp(){
+}
+
+const char *detSpatialIndex::GetTestName(){
+	return "SpatialIndex";
+}
+
+
+
+// Private Functions
+//////////////////////
+
+void detSpatialIndex::pTestEmpty(){
+	SetSubTestNum(0);
+	
+	decSpatialIndex index;
+	ASSERT_EQUAL(index.GetElementCount(), 0);
+	ASSERT_EQUAL(index.GetNodeCount(), 0);
+	ASSERT_EQUAL(index.GetHeight(), 0);
+	ASSERT_EQUAL(index.GetRootNode(), -1);
+	ASSERT_FEQUAL(index.GetMargin(), decSpatialIndex::DefaultMargin);
+	ASSERT_FALSE(index.HasElement(0));
+	
+	decTList<int> found;
+	index.QueryBox(decVector(-1e6f, -1e6f, -1e6f), decVector(1e6f, 1e6f, 1e6f), found);
+	index.QueryRay(decVector(), decVector(1e6f, 0.0f, 0.0f), found);
+	index.QueryPlanes(nullptr, 0, found);
+	ASSERT_TRUE(found.IsEmpty());
+	
+	index.Rebuild();
+	ASSERT_EQUAL(index.GetNodeCount(), 0);
+	
+	ASSERT_DOES_FAIL(index.Remove(0));
+	ASSERT_DOES_FAIL(decSpatialIndex(-1.0f));
+}
+
+void detSpatialIndex::pTestInsertRemove(){
+	SetSubTestNum(1);
+	
+	decSpatialIndex index(0.5f);
+	ASSERT_FEQUAL(index.GetMargin(), 0.5f);
+	
+	// consecutive indices
+	ASSERT_EQUAL(index.Insert(decVector(0.0f, 0.0f, 0.0f), decVector(1.0f, 1.0f, 1.0f)), 0);
+	ASSERT_EQUAL(index.GetNodeCount(), 1);
+	ASSERT_EQUAL(index.GetHeight(), 1);
+	ASSERT_EQUAL(index.Insert(decVector(5.0f, 0.0f, 0.0f), decVector(6.0f, 1.0f, 1.0f)), 1);
+	ASSERT_EQUAL(index.Insert(decDVector(10.0, 0.0, 0.0), decDVector(11.0, 1.0, 1.0)), 2);
+	ASSERT_EQUAL(index.GetElementCount(), 3);
+	ASSERT_EQUAL(index.GetNodeCount(), 5);
+	ASSERT_TRUE(index.GetElementMinExtend(1).IsEqualTo(decVector(5.0f, 0.0f, 0.0f)));
+	ASSERT_TRUE(index.GetElementMaxExtend(2).IsEqualTo(decVector(11.0f, 1.0f, 1.0f)));
+	pValidate(index);
+	
+	// removed indices are reused
+	index.Remove(1);
+	ASSERT_FALSE(index.HasElement(1));
+	ASSERT_EQUAL(index.GetElementCount(), 2);
+	ASSERT_EQUAL(index.GetNodeCount(), 3);
+	ASSERT_DOES_FAIL(index.Remove(1));
+	ASSERT_DOES_FAIL(index.GetElementMinExtend(1));
+	pValidate(index);
+	
+	ASSERT_EQUAL(index.Insert(decVector(-5.0f, 0.0f, 0.0f), decVector(-4.0f, 1.0f, 1.0f)), 1);
+	pValidate(index);
+	
+	// moving inside the loose box does not reinsert
+	ASSERT_FALSE(index.Move(0, decVector(0.2f, 0.2f, 0.2f), decVector(1.2f, 1.2f, 1.2f)));
+	ASSERT_TRUE(index.GetElementMinExtend(0).IsEqualTo(decVector(0.2f, 0.2f, 0.2f)));
+	ASSERT_TRUE(index.Move(0, decVector(20.0f, 0.0f, 0.0f), decVector(21.0f, 1.0f, 1.0f)));
+	pValidate(index);
+	
+	decTList<int> found;
+	index.QueryBox(decVector(19.0f, 0.0f, 0.0f), decVector(19.9f, 1.0f, 1.0f), found);
+	ASSERT_TRUE(found.IsEmpty());
+	index.QueryBox(decVector(19.0f, 0.0f, 0.0f), decVector(20.0f, 1.0f, 1.0f), found);
+	ASSERT_EQUAL(found.GetCount(), 1);
+	ASSERT_EQUAL(found.First(), 0);
+	
+	// removing all elements restarts indices
+	index.Remove(0);
+	index.Remove(2);
+	index.Remove(1);
+	ASSERT_EQUAL(index.GetElementCount(), 0);
+	ASSERT_EQUAL(index.GetNodeCount(), 0);
+	ASSERT_EQUAL(index.Insert(decVector(), decVector(1.0f, 1.0f, 1.0f)), 0);
+	
+	index.RemoveAll();
+	ASSERT_EQUAL(index.GetElementCount(), 0);
+	ASSERT_EQUAL(index.GetRootNode(), -1);
+}
+
+void detSpatialIndex::pTestQueryBox(){
+	SetSubTestNum(2);
+	
+	decTList<decVector> minExtends, maxExtends;
+	decSpatialIndex index;
+	pAddRandomBoxes(index, minExtends, maxExtends, 2000, 999);
+	pValidate(index);
+	
+	decPRNG prng(111);
+	int i, j, k;
+	for(k=0; k<3; k++){
+		for(i=0; i<50; i++){
+			const decVector center(prng.RandomFloat(-50.0f, 50.0f),
+				prng.RandomFloat(-5.0f, 5.0f), prng.RandomFloat(-50.0f, 50.0f));
+			const decVector halfSize(prng.RandomFloat(0.0f, 20.0f),
+				prng.RandomFloat(0.0f, 10.0f), prng.RandomFloat(0.0f, 20.0f));
+			const decVector minExtend(center - halfSize), maxExtend(center + halfSize);
+			
+			decTList<int> expected;
+			for(j=0; j<minExtends.GetCount(); j++){
+				if(index.HasElement(j) && maxExtends[j] >= minExtend && minExtends[j] <= maxExtend){
+					expected.Add(j);
+				}
+			}
+			
+			decTList<int> found;
+			index.QueryBox(minExtend, maxExtend, found);
+			pAssertSameElements(found, expected);
+		}
+		
+		// move elements and remove some of them
+		pMoveRandomBoxes(index, minExtends, maxExtends, 2.0f, 200 + k);
+		for(j=k; j<minExtends.GetCount(); j+=7){
+			if(index.HasElement(j)){
+				index.Remove(j);
+			}
+		}
+		pValidate(index);
+	}
+}
+
+void detSpatialIndex::pTestQueryRay(){
+	SetSubTestNum(3);
+	
+	decTList<decVector> minExtends, maxExtends;
+	decSpatialIndex index;
+	pAddRandomBoxes(index, minExtends, maxExtends, 2000, 4242);
+	
+	decPRNG prng(222);
+	int i, j;
+	for(i=0; i<100; i++){
+		const decVector origin(prng.RandomFloat(-60.0f, 60.0f),
+			prng.RandomFloat(-10.0f, 10.0f), prng.RandomFloat(-60.0f, 60.0f));
+		decVector direction(prng.RandomFloat(-100.0f, 100.0f),
+			prng.RandomFloat(-10.0f, 10.0f), prng.RandomFloat(-100.0f, 100.0f));
+		
+		// axis aligned rays
+		if(i % 10 == 1){
+			direction.y = direction.z = 0.0f;
+			
+		}else if(i % 10 == 2){
+			direction.x = direction.z = 0.0f;
+		}
+		
+		decTList<int> expected;
+		for(j=0; j<2000; j++){
+			// clip segment against box using the slab test
+			float enter = 0.0f, leave = 1.0f;
+			int a;
+			for(a=0; a<3; a++){
+				const float o = a == 0 ? origin.x : (a == 1 ? origin.y : origin.z);
+				const float d = a == 0 ? direction.x : (a == 1 ? direction.y : direction.z);
+				const float lo = a == 0 ? minExtends[j].x : (a == 1 ? minExtends[j].y : minExtends[j].z);
+				const float hi = a == 0 ? maxExtends[j].x : (a == 1 ? maxExtends[j].y : maxExtends[j].z);
+				
+				if(d == 0.0f){
+					if(o < lo || o > hi){
+						leave = -1.0f;
+					}
+					
+				}else{
+					const float inv = 1.0f / d;
+					const float t1 = (lo - o) * inv, t2 = (hi - o) * inv;
+					enter = decMath::max(enter, decMath::min(t1, t2));
+					leave = decMath::min(leave, decMath::max(t1, t2));
+				}
+			}
+			
+			if(enter <= leave){
+				expected.Add(j);
+			}
+		}
+		
+		decTList<int> found;
+		index.QueryRay(origin, direction, found);
+		pAssertSameElements(found, expected);
+	}
+}
+
+void detSpatialIndex::pTestQueryPlanes(){
+	SetSubTestNum(4);
+	
+	decTList<decVector> minExtends, maxExtends;
+	decSpatialIndex index;
+	pAddRandomBoxes(index, minExtends, maxExtends, 2000, 31337);
+	
+	decPRNG prng(333);
+	int i, j, k;
+	for(i=0; i<50; i++){
+		// random convex volume made of planes facing a center point
+		const decVector center(prng.RandomFloat(-50.0f, 50.0f),
+			prng.RandomFloat(-5.0f, 5.0f), prng.RandomFloat(-50.0f, 50.0f));
+		const int planeCount = 1 + i % 9;
+		decVector4 planes[9];
+		
+		for(j=0; j<planeCount; j++){
+			const decVector normal(decVector(prng.RandomFloat(-1.0f, 1.0f),
+				prng.RandomFloat(-1.0f, 1.0f), prng.RandomFloat(-1.0f, 1.0f)).Normalized());
+			planes[j].Set(normal.x, normal.y, normal.z,
+				prng.RandomFloat(5.0f, 30.0f) - normal * center);
+		}
+		
+		decTList<int> expected;
+		for(j=0; j<2000; j++){
+			for(k=0; k<planeCount; k++){
+				const decVector4 &p = planes[k];
+				if(decMath::max(p.x * minExtends[j].x, p.x * maxExtends[j].x)
+				+ decMath::max(p.y * minExtends[j].y, p.y * maxExtends[j].y)
+				+ decMath::max(p.z * minExtends[j].z, p.z * maxExtends[j].z) + p.w < 0.0f){
+					break;
+				}
+			}
+			if(k == planeCount){
+				expected.Add(j);
+			}
+		}
+		
+		decTList<int> found;
+		index.QueryPlanes(planes, planeCount, found);
+		pAssertSameElements(found, expected);
+	}
+	
+	// no planes contains everything
+	decTList<int> found;
+	index.QueryPlanes(nullptr, 0, found);
+	ASSERT_EQUAL(found.GetCount(), 2000);
+	
+	decVector4 planes[decSpatialIndex::MaxPlanes + 1];
+	ASSERT_DOES_FAIL(index.QueryPlanes(planes, decSpatialIndex::MaxPlanes + 1, found));
+}
+
+void detSpatialIndex::pTestBatch(){
+	SetSubTestNum(5);
+	
+	decTList<decVector> minExtends, maxExtends;
+	decPRNG prng(555);
+	int i;
+	for(i=0; i<3000; i++){
+		const decVector position(prng.RandomFloat(-50.0f, 50.0f),
+			prng.RandomFloat(-5.0f, 5.0f), prng.RandomFloat(-50.0f, 50.0f));
+		minExtends.Add(position);
+		maxExtends.Add(position + decVector(1.0f, 1.0f, 1.0f));
+	}
+	
+	// batch insert into empty index builds tree with consecutive indices
+	decSpatialIndex index;
+	decTList<int> elements;
+	index.Insert(minExtends.GetArrayPointer(), maxExtends.GetArrayPointer(), 3000, elements);
+	ASSERT_EQUAL(elements.GetCount(), 3000);
+	for(i=0; i<3000; i++){
+		ASSERT_EQUAL(elements[i], i);
+	}
+	ASSERT_EQUAL(index.GetElementCount(), 3000);
+	ASSERT_EQUAL(index.GetNodeCount(), 5999);
+	ASSERT_TRUE(index.GetHeight() <= 14);
+	pValidate(index);
+	
+	// small batch inserts incrementally
+	decTList<int> elements2;
+	index.Insert(minExtends.GetArrayPointer(), maxExtends.GetArrayPointer(), 10, elements2);
+	ASSERT_EQUAL(elements2.GetCount(), 10);
+	ASSERT_EQUAL(elements2.First(), 3000);
+	index.Remove(elements2.GetArrayPointer(), 10);
+	ASSERT_EQUAL(index.GetElementCount(), 3000);
+	pValidate(index);
+	
+	// moving inside margin does not reinsert
+	for(i=0; i<3000; i++){
+		minExtends[i].x += 0.05f;
+		maxExtends[i].x += 0.05f;
+	}
+	ASSERT_EQUAL(index.Move(elements.GetArrayPointer(), minExtends.GetArrayPointer(),
+		maxExtends.GetArrayPointer(), 3000), 0);
+	
+	// moving few elements far reinserts them
+	for(i=0; i<100; i++){
+		minExtends[i].y += 20.0f;
+		maxExtends[i].y += 20.0f;
+	}
+	ASSERT_EQUAL(index.Move(elements.GetArrayPointer(), minExtends.GetArrayPointer(),
+		maxExtends.GetArrayPointer(), 100), 100);
+	pValidate(index);
+	
+	// moving all elements far rebuilds
+	for(i=0; i<3000; i++){
+		minExtends[i].z += 5.0f;
+		maxExtends[i].z += 5.0f;
+	}
+	ASSERT_EQUAL(index.Move(elements.GetArrayPointer(), minExtends.GetArrayPointer(),
+		maxExtends.GetArrayPointer(), 3000), 3000);
+	ASSERT_EQUAL(index.GetNodeCount(), 5999);
+	pValidate(index);
+	
+	decTList<int> found, expected;
+	const decVector minExtend(-10.0f, -10.0f, -10.0f), maxExtend(10.0f, 30.0f, 10.0f);
+	for(i=0; i<3000; i++){
+		if(maxExtends[i] >= minExtend && minExtends[i] <= maxExtend){
+			expected.Add(i);
+		}
+	}
+	index.QueryBox(minExtend, maxExtend, found);
+	pAssertSameElements(found, expected);
+	
+	// batch remove of most elements rebuilds
+	index.Remove(elements.GetArrayPointer() + 1000, 2000);
+	ASSERT_EQUAL(index.GetElementCount(), 1000);
+	ASSERT_EQUAL(index.GetNodeCount(), 1999);
+	pValidate(index);
+	
+	found.RemoveAll();
+	expected.RemoveAll();
+	for(i=0; i<1000; i++){
+		if(maxExtends[i] >= minExtend && minExtends[i] <= maxExtend){
+			expected.Add(i);
+		}
+	}
+	index.QueryBox(minExtend, maxExtend, found);
+	pAssertSameElements(found, expected);
+	
+	index.Remove(elements.GetArrayPointer(), 1000);
+	ASSERT_EQUAL(index.GetElementCount(), 0);
+	ASSERT_EQUAL(index.GetRootNode(), -1);
+}
+
+void detSpatialIndex::pTestFindNearest(){
+	SetSubTestNum(6);
+	
+	decSpatialIndex index;
+	float distSquared = -1.0f;
+	ASSERT_EQUAL(index.FindNearest(decVector(), 1e6f, distSquared, [](int, float &d){
+		d = 0.0f;
+		return true;
+	}), -1);
+	ASSERT_FEQUAL(distSquared, -1.0f);
+	
+	decTList<decVector> minExtends, maxExtends;
+	pAddRandomBoxes(index, minExtends, maxExtends, 1000, 12345);
+	
+	// run once on the incrementally built tree, once after moving and once rebuilt
+	decPRNG prng(54321);
+	int i, j, k;
+	for(i=0; i<3; i++){
+		if(i == 1){
+			pMoveRandomBoxes(index, minExtends, maxExtends, 2.0f, 999);
+			
+		}else if(i == 2){
+			index.Rebuild();
+		}
+		
+		for(j=0; j<100; j++){
+			const decVector point(prng.RandomFloat(-60.0f, 60.0f),
+				prng.RandomFloat(-10.0f, 10.0f), prng.RandomFloat(-60.0f, 60.0f));
+			
+			// brute force
+			float expectedDistSquared = 0.0f;
+			int expected = -1;
+			for(k=0; k<1000; k++){
+				const float d = decSpatialIndex::BoxDistanceSquared(point, minExtends[k], maxExtends[k]);
+				if(expected == -1 || d < expectedDistSquared){
+					expected = k;
+					expectedDistSquared = d;
+				}
+			}
+			
+			const int found = index.FindNearest(point, 1e30f, distSquared, [&](int element, float &d){
+				d = decSpatialIndex::BoxDistanceSquared(point, minExtends[element], maxExtends[element]);
+				return true;
+			});
+			
+			ASSERT_EQUAL(found, expected);
+			ASSERT_FEQUAL(distSquared, expectedDistSquared);
+		}
+	}
+}
+
+void detSpatialIndex::pTestFindNearestTies(){
+	SetSubTestNum(7);
+	
+	// many identical elements. lowest index has to win
+	decTList<decVector> minExtends, maxExtends;
+	int i;
+	for(i=0; i<50; i++){
+		minExtends.Add(decVector(1.0f, 0.0f, 0.0f));
+		maxExtends.Add(decVector(2.0f, 1.0f, 1.0f));
+	}
+	for(i=0; i<50; i++){
+		minExtends.Add(decVector(i * 3.0f, 0.0f, 0.0f));
+		maxExtends.Add(decVector(i * 3.0f + 1.0f, 1.0f, 1.0f));
+	}
+	
+	decSpatialIndex index(0.0f);
+	decTList<int> elements;
+	index.Insert(minExtends.GetArrayPointer(), maxExtends.GetArrayPointer(), 100, elements);
+	
+	float distSquared = 0.0f;
+	const decVector point(1.5f, 2.0f, 0.5f);
+	ASSERT_EQUAL(index.FindNearest(point, 1e30f, distSquared, [&](int, float &d){
+		d = 1.0f;
+		return true;
+	}), 0);
+	ASSERT_FEQUAL(distSquared, 1.0f);
+	
+	ASSERT_EQUAL(index.FindNearest(point, 1e30f, distSquared, [&](int element, float &d){
+		d = 1.0f;
+		return element >= 37;
+	}), 37);
+}
+
+void detSpatialIndex::pTestFindNearestReject(){
+	SetSubTestNum(8);
+	
+	decTList<decVector> minExtends, maxExtends;
+	decSpatialIndex index;
+	pAddRandomBoxes(index, minExtends, maxExtends, 500, 777);
+	
+	const decVector point(3.0f, 20.0f, -7.0f);
+	
+	// reject even elements
+	float expectedDistSquared = 0.0f;
+	int expected = -1, i;
+	for(i=1; i<500; i+=2){
+		const float d = decSpatialIndex::BoxDistanceSquared(point, minExtends[i], maxExtends[i]);
+		if(expected == -1 || d < expectedDistSquared){
+			expected = i;
+			expectedDistSquared = d;
+		}
+	}
+	
+	const auto evaluator = [&](int element, float &d){
+		d = decSpatialIndex::BoxDistanceSquared(point, minExtends[element], maxExtends[element]);
+		return (element % 2) == 1;
+	};
+	
+	float distSquared = 0.0f;
+	ASSERT_EQUAL(index.FindNearest(point, 1e30f, distSquared, evaluator), expected);
+	ASSERT_FEQUAL(distSquared, expectedDistSquared);
+	
+	// maximum distance is inclusive
+	ASSERT_EQUAL(index.FindNearest(point, expectedDistSquared, distSquared, evaluator), expected);
+	
+	// nothing inside maximum distance
+	ASSERT_TRUE(expectedDistSquared > 0.0f);
+	distSquared = -1.0f;
+	ASSERT_EQUAL(index.FindNearest(point, expectedDistSquared * 0.5f, distSquared, evaluator), -1);
+	ASSERT_FEQUAL(distSquared, -1.0f);
+}
+
+void detSpatialIndex::pAddRandomBoxes(decSpatialIndex &index, decTList<decVector> &minExtends,
+decTList<decVector> &maxExtends, int count, unsigned int seed){
+	decPRNG prng(seed);
+	int i;
+	for(i=0; i<count; i++){
+		const decVector position(prng.RandomFloat(-50.0f, 50.0f),
+			prng.RandomFloat(-5.0f, 5.0f), prng.RandomFloat(-50.0f, 50.0f));
+		const decVector size(prng.RandomFloat(0.0f, 3.0f),
+			prng.RandomFloat(0.0f, 1.0f), prng.RandomFloat(0.0f, 3.0f));
+		
+		minExtends.Add(position);
+		maxExtends.Add(position + size);
+		ASSERT_EQUAL(index.Insert(position, position + size), i);
+	}
+}
+
+void detSpatialIndex::pMoveRandomBoxes(decSpatialIndex &index, decTList<decVector> &minExtends,
+decTList<decVector> &maxExtends, float distance, unsigned int seed){
+	decPRNG prng(seed);
+	int i;
+	for(i=0; i<minExtends.GetCount(); i++){
+		if(!index.HasElement(i)){
+			continue;
+		}
+		
+		const decVector offset(prng.RandomFloat(-distance, distance),
+			prng.RandomFloat(-distance, distance), prng.RandomFloat(-distance, distance));
+		minExtends[i] += offset;
+		maxExtends[i] += offset;
+		index.Move(i, minExtends[i], maxExtends[i]);
+	}
+}
+
+void detSpatialIndex::pValidate(const decSpatialIndex &index){
+	const decTList<decSpatialIndex::sNode> &nodes = index.GetNodes();
+	if(index.GetRootNode() == -1){
+		ASSERT_EQUAL(index.GetElementCount(), 0);
+		return;
+	}
+	
+	// every element is reachable exactly once, leaves contain the element box and inner
+	// nodes contain their children
+	decTList<int> stack, depths, elements;
+	stack.Add(index.GetRootNode());
+	depths.Add(1);
+	int leafCount = 0, innerCount = 0, height = 0;
+	
+	while(stack.IsNotEmpty()){
+		const decSpatialIndex::sNode &node = nodes[stack.Last()];
+		const int depth = depths.Last();
+		stack.RemoveLast();
+		depths.RemoveLast();
+		height = decMath::max(height, depth);
+		
+		const decVector minExtend(node.minExtend[0], node.minExtend[1], node.minExtend[2]);
+		const decVector maxExtend(node.maxExtend[0], node.maxExtend[1], node.maxExtend[2]);
+		
+		if(node.child1 == -1){
+			ASSERT_TRUE(index.HasElement(node.child2));
+			ASSERT_FALSE(elements.Has(node.child2));
+			ASSERT_TRUE(index.GetElementMinExtend(node.child2) >= minExtend);
+			ASSERT_TRUE(index.GetElementMaxExtend(node.child2) <= maxExtend);
+			elements.Add(node.child2);
+			leafCount++;
+			continue;
+		}
+		
+		const int children[2] = {node.child1, node.child2};
+		int i;
+		for(i=0; i<2; i++){
+			const decSpatialIndex::sNode &child = nodes[children[i]];
+			ASSERT_TRUE(decVector(child.minExtend[0], child.minExtend[1], child.minExtend[2]) >= minExtend);
+			ASSERT_TRUE(decVector(child.maxExtend[0], child.maxExtend[1], child.maxExtend[2]) <= maxExtend);
+			stack.Add(children[i]);
+			depths.Add(depth + 1);
+		}
+		innerCount++;
+	}
+	
+	ASSERT_EQUAL(leafCount, index.GetElementCount());
+	ASSERT_EQUAL(innerCount, leafCount - 1);
+	ASSERT_EQUAL(index.GetNodeCount(), leafCount + innerCount);
+	ASSERT_EQUAL(index.GetHeight(), height);
+}
+
+void detSpatialIndex::pAssertSameElements(decTList<int> &found, decTList<int> &expected){
+	ASSERT_EQUAL(found.GetCount(), expected.GetCount());
+	
+	found.Sort([](int a, int b){
+		return a < b ? -1 : (a > b ? 1 : 0);
+	});
+	
+	const int count = found.GetCount();
+	int i;
+	for(i=0; i<count; i++){
+		ASSERT_EQUAL(found[i], expected[i]);
+	}
+}
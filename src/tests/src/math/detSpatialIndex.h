@@ -0,0 +1,45 @@
+// include only once
+#ifndef _DETSPATIALINDEX_H_
+#define _DETSPATIALINDEX_H_
+
+// includes
+#include "../detCase.h"
+
+#include <dragengine/common/collection/decTList.h>
+#include <dragengine/common/math/decMath.h>
+
+class decSpatialIndex;
+
+
+
+// class detSpatialIndex
+class detSpatialIndex : public detCase{
+public:
+	detSpatialIndex();
+	~detSpatialIndex() override;
+	void Prepare() override;
+	void Run() override;
+	void CleanUp() override;
+	const char *GetTestName() override;
+	
+private:
+	void pTestEmpty();
+	void pTestInsertRemove();
+	void pTestQueryBox();
+	void pTestQueryRay();
+	void pTestQueryPlanes();
+	void pTestBatch();
+	void pTestFindNearest();
+	void pTestFindNearestTies();
+	void pTestFindNearestReject();
+	
+	void pAddRandomBoxes(decSpatialIndex &index, decTList<decVector> &minExtends,
+		decTList<decVector> &maxExtends, int count, unsigned int seed);
+	void pMoveRandomBoxes(decSpatialIndex &index, decTList<decVector> &minExtends,
+		decTList<decVector> &maxExtends, float distance, unsigned int seed);
+	void pValidate(const decSpatialIndex &index);
+	void pAssertSameElements(decTList<int> &found, decTList<int> &expected);
+};
+
+// end of include only once
+#endif